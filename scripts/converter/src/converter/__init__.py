@@ -26,8 +26,14 @@ def cli():
               default='binary',
               help='输出格式 (binary 或 c_array)')
 @click.option('--workers', type=int, default=4, help='并行处理线程数')
+@click.option('--byte-order', type=click.Choice(['native', 'little']), default='native',
+              help='二进制像素字节序: native=面板字节序RGB565_SWAPPED(设备flush免交换), little=小端RGB565')
+@click.option('--color-format', type=click.Choice(['rgb565', 'i8', 'i4']), default='rgb565',
+              help='二进制颜色格式: rgb565, i8=256色调色板(SD读取量1/2), i4=16色调色板(1/4)')
+@click.option('--dither/--no-dither', default=True, help='索引色量化是否使用Floyd-Steinberg抖动')
 def convert(source: Path, output: Path, max_width: Optional[int],
-           max_height: Optional[int], output_format: str, workers: int):
+           max_height: Optional[int], output_format: str, workers: int, byte_order: str,
+           color_format: str, dither: bool):
     """
     批量转换图片文件
 
@@ -57,11 +63,14 @@ def convert(source: Path, output: Path, max_width: Optional[int],
     if max_size:
         click.echo(f"  最大尺寸: {max_size[0]}x{max_size[1]}")
     click.echo(f"  并行线程数: {workers}")
+    click.echo(f"  字节序: {byte_order}")
+    click.echo(f"  颜色格式: {color_format}")
     click.echo()
 
     # 执行批量转换
     success, failed = processor.batch_convert(
-        source, output, max_size, output_format
+        source, output, max_size, output_format, byte_order == 'native',
+        color_format, dither
     )
 
     if failed == 0:
@@ -80,8 +89,14 @@ def convert(source: Path, output: Path, max_width: Optional[int],
               type=click.Choice(['binary', 'c_array']),
               default='binary',
               help='输出格式 (binary 或 c_array)')
+@click.option('--byte-order', type=click.Choice(['native', 'little']), default='native',
+              help='二进制像素字节序: native=面板字节序RGB565_SWAPPED(设备flush免交换), little=小端RGB565')
+@click.option('--color-format', type=click.Choice(['rgb565', 'i8', 'i4']), default='rgb565',
+              help='二进制颜色格式: rgb565, i8=256色调色板(SD读取量1/2), i4=16色调色板(1/4)')
+@click.option('--dither/--no-dither', default=True, help='索引色量化是否使用Floyd-Steinberg抖动')
 def single(input_file: Path, output_file: Path, max_width: Optional[int],
-          max_height: Optional[int], array_name: Optional[str], output_format: str):
+          max_height: Optional[int], array_name: Optional[str], output_format: str, byte_order: str,
+          color_format: str, dither: bool):
     """
     转换单个图片文件
 
@@ -119,7 +134,8 @@ def single(input_file: Path, output_file: Path, max_width: Optional[int],
         )
     else:
         success = processor.convert_single_file(
-            input_file, output_file, max_size
+            input_file, output_file, max_size, byte_order == 'native',
+            color_format, None, dither
         )
 
     if success:
@@ -133,7 +149,17 @@ def single(input_file: Path, output_file: Path, max_width: Optional[int],
 @click.argument('output_bundle', type=click.Path(path_type=Path))
 @click.option('--width', type=int, default=120, help='帧宽度 (像素, 默认120)')
 @click.option('--height', type=int, default=120, help='帧高度 (像素, 默认120)')
-def pack(source_dir: Path, output_bundle: Path, width: int, height: int):
+@click.option('--sprite', is_flag=True, help='精灵bundle: 一张背景图 + 每帧小鸟包围盒精灵(需要RGB565帧)')
+@click.option('--mask', type=click.Choice(['a1', 'a8']), default='a1',
+              help='精灵透明度平面: a1=1位掩码(默认), a8=8位')
+@click.option('--threshold', type=int, default=24, help='精灵前景判定阈值(与背景的通道差之和, 默认24)')
+@click.option('--fps', type=click.IntRange(0, 255), default=0, help='小鸟帧率, 写入bundle (默认0: 固件默认15fps)')
+@click.option('--dedup-threshold', type=int, default=12,
+              help='相邻帧合并阈值(通道差之和, 默认12; 0: 只合并完全相同的帧)')
+@click.option('--align', type=int, default=512,
+              help='RGB565帧像素数据对齐字节数(默认512扇区, 可设为簇大小; 0: 紧凑排列)')
+def pack(source_dir: Path, output_bundle: Path, width: int, height: int,
+         sprite: bool, mask: str, threshold: int, fps: int, dedup_threshold: int, align: int):
     """
     将目录中的帧文件打包为bundle.bin
 
@@ -157,18 +183,34 @@ def pack(source_dir: Path, output_bundle: Path, width: int, height: int):
     click.echo(f"  帧数: {len(frame_files)}")
     click.echo(f"  输出文件: {output_bundle}")
     click.echo(f"  帧尺寸: {width}x{height}")
+    if sprite:
+        click.echo(f"  精灵模式: 掩码 {mask}, 阈值 {threshold}")
     click.echo()
 
     # 确保输出目录存在
     output_bundle.parent.mkdir(parents=True, exist_ok=True)
 
     # 执行打包
-    success = RGB565Converter.pack_frames_to_bundle(
-        frame_files=frame_files,
-        output_bundle=output_bundle,
-        width=width,
-        height=height
-    )
+    if sprite:
+        success = RGB565Converter.pack_sprite_bundle(
+            frame_files=frame_files,
+            output_bundle=output_bundle,
+            width=width,
+            height=height,
+            mask=mask,
+            threshold=threshold,
+            fps=fps
+        )
+    else:
+        success = RGB565Converter.pack_frames_to_bundle(
+            frame_files=frame_files,
+            output_bundle=output_bundle,
+            width=width,
+            height=height,
+            fps=fps,
+            dedup_threshold=dedup_threshold,
+            align=align
+        )
 
     if success:
         click.echo("\n[SUCCESS] 打包成功!")
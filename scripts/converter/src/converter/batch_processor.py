@@ -9,7 +9,7 @@ from tqdm import tqdm
 import concurrent.futures
 import threading
 
-from .rgb565 import RGB565Converter
+from .rgb565 import RGB565Converter, INDEXED_FORMATS
 
 
 class BatchProcessor:
@@ -97,7 +97,11 @@ class BatchProcessor:
         return output_dir / f"{input_path.stem}_rgb565.c"
 
     def convert_single_file(self, input_path: Path, output_path: Path,
-                           max_size: Optional[Tuple[int, int]] = None) -> bool:
+                           max_size: Optional[Tuple[int, int]] = None,
+                           native_order: bool = True,
+                           color_format: str = 'rgb565',
+                           palette=None,
+                           dither: bool = True) -> bool:
         """
         转换单个文件
 
@@ -105,6 +109,10 @@ class BatchProcessor:
             input_path: 输入文件路径
             output_path: 输出文件路径
             max_size: 最大尺寸限制
+            native_order: 是否输出面板字节序(RGB565_SWAPPED)
+            color_format: 'rgb565'，或索引色 'i8'/'i4'
+            palette: 索引色共享调色板，None时为本帧单独生成
+            dither: 索引色量化是否抖动
 
         Returns:
             转换是否成功
@@ -114,8 +122,12 @@ class BatchProcessor:
             output_path.parent.mkdir(parents=True, exist_ok=True)
 
             # 执行转换
+            if color_format in INDEXED_FORMATS:
+                return RGB565Converter.convert_image_to_indexed(
+                    input_path, output_path, color_format, max_size, palette, dither
+                )
             return RGB565Converter.convert_image_to_rgb565(
-                input_path, output_path, max_size
+                input_path, output_path, max_size, native_order
             )
         except Exception as e:
             print(f"处理文件 {input_path} 时出错: {e}")
@@ -150,7 +162,10 @@ class BatchProcessor:
 
     def batch_convert(self, source_dir: Path, output_dir: Path,
                      max_size: Optional[Tuple[int, int]] = None,
-                     output_format: str = 'binary') -> Tuple[int, int]:
+                     output_format: str = 'binary',
+                     native_order: bool = True,
+                     color_format: str = 'rgb565',
+                     dither: bool = True) -> Tuple[int, int]:
         """
         批量转换图片
 
@@ -159,6 +174,10 @@ class BatchProcessor:
             output_dir: 输出目录
             max_size: 最大尺寸限制
             output_format: 输出格式 ('binary' 或 'c_array')
+            native_order: 二进制输出是否使用面板字节序(RGB565_SWAPPED)
+            color_format: 二进制输出的颜色格式 ('rgb565'、'i8'、'i4')，
+                          索引色时目录内所有帧共用一个调色板
+            dither: 索引色量化是否使用Floyd-Steinberg抖动
 
         Returns:
             (成功数量, 失败数量)
@@ -172,6 +191,14 @@ class BatchProcessor:
 
         print(f"找到 {len(image_files)} 个图片文件")
 
+        # 索引色: 先从所有帧生成共享调色板
+        palette = None
+        if output_format != 'c_array' and color_format in INDEXED_FORMATS:
+            colors = INDEXED_FORMATS[color_format][1]
+            print(f"生成 {colors} 色共享调色板...")
+            images = [RGB565Converter.load_image(path, max_size) for path in image_files]
+            palette = RGB565Converter.build_palette(images, colors)
+
         success_count = 0
         failed_count = 0
 
@@ -192,7 +219,8 @@ class BatchProcessor:
                         output_path = self.get_output_path(input_path, output_dir)
                         future = executor.submit(
                             self.convert_single_file,
-                            input_path, output_path, max_size
+                            input_path, output_path, max_size, native_order,
+                            color_format, palette, dither
                         )
                     future_to_file[future] = (input_path, output_path)
 
@@ -10,6 +10,38 @@ from typing import Tuple, Optional
 import struct
 
 
+# LVGL 9.x颜色格式
+LV_COLOR_FORMAT_RGB565 = 0x12
+LV_COLOR_FORMAT_RGB565_SWAPPED = 0x1B  # 高字节在前(面板字节序), 设备flush时无需交换
+LV_COLOR_FORMAT_I4 = 0x09              # 16色调色板, 每像素4位
+LV_COLOR_FORMAT_I8 = 0x0A              # 256色调色板, 每像素8位
+LV_COLOR_FORMAT_RGB565A8 = 0x14        # RGB565颜色平面(小端) + A8透明度平面
+
+# 索引色格式: 名称 -> (LVGL颜色格式, 调色板颜色数)
+INDEXED_FORMATS = {
+    'i8': (LV_COLOR_FORMAT_I8, 256),
+    'i4': (LV_COLOR_FORMAT_I4, 16),
+}
+
+# Bundle标志位
+BUNDLE_FLAG_NATIVE_ORDER = 0x01
+BUNDLE_FLAG_SHARED_PALETTE = 0x02      # 所有帧调色板相同, 设备只解析一次
+BUNDLE_FLAG_SPRITE = 0x04              # 一张背景图 + 每帧小鸟精灵
+BUNDLE_FLAG_ALIGNED = 0x08             # RGB565帧像素数据按payload_align对齐并补齐
+BUNDLE_FLAG_UNIFORM = 0x10             # 所有帧等长等时长且无别名: 第i帧在data_offset + i×步长, 设备不读索引
+
+# 精灵帧头flags: 透明度平面为1位掩码(每行(w+7)/8字节, 高位在前)
+SPRITE_FRAME_FLAG_MASK_A1 = 0x0100
+
+# Bundle v2帧索引: offset, size, checksum, duration_ms, flags (16字节)
+BUNDLE_VERSION = 2
+INDEX_ENTRY_FORMAT = '<IIIHH'
+FRAME_FLAG_ALIAS = 0x0001              # 数据与之前某帧相同(offset指向该帧)
+
+# 固件默认帧间隔(BIRD_FRAME_INTERVAL_MS), bundle未指定fps时使用
+DEFAULT_FRAME_MS = 66
+
+
 class RGB565Converter:
     """RGB565格式转换器"""
 
@@ -36,7 +68,8 @@ class RGB565Converter:
 
     @staticmethod
     def convert_image_to_rgb565(image_path: Path, output_path: Path,
-                               max_size: Optional[Tuple[int, int]] = None) -> bool:
+                               max_size: Optional[Tuple[int, int]] = None,
+                               native_order: bool = True) -> bool:
         """
         将图片转换为RGB565格式并保存为LVGL 7.9.1兼容的二进制文件
 
@@ -44,6 +77,8 @@ class RGB565Converter:
             image_path: 输入图片路径
             output_path: 输出文件路径
             max_size: 最大尺寸 (width, height)，如果图片超过此尺寸则会等比缩放
+            native_order: True输出面板字节序(RGB565_SWAPPED, 高字节在前)，
+                          False输出小端RGB565
 
         Returns:
             转换是否成功
@@ -83,10 +118,10 @@ class RGB565Converter:
                 # 写入LVGL 9.x兼容的二进制文件
                 with open(output_path, 'wb') as f:
                     # LVGL 9.x图像头部
-                    # cf (color format): LV_COLOR_FORMAT_RGB565 = 0x12 (18) for RGB565
-                    LV_COLOR_FORMAT_RGB565 = 0x12
+                    # cf (color format): RGB565 = 0x12, RGB565_SWAPPED = 0x1B
+                    color_format = LV_COLOR_FORMAT_RGB565_SWAPPED if native_order else LV_COLOR_FORMAT_RGB565
                     magic = 0x37  # LVGL 9.x magic number '7' (LVGL_VERSION_MAJOR = 9 -> '7')
-                    header_cf = (magic << 24) | (LV_COLOR_FORMAT_RGB565)  # 32-bit header
+                    header_cf = (magic << 24) | color_format  # 32-bit header
 
                     # 写入LVGL 9.x图像头部 - 参考lv_bin_decoder.c期望的格式
                     f.write(struct.pack('<I', header_cf))  # 4字节: magic + cf
@@ -97,9 +132,10 @@ class RGB565Converter:
                     data_size = len(rgb565_data) * 2  # RGB565每像素2字节
                     f.write(struct.pack('<I', data_size))  # 4字节: data_size
                     
-                    # 写入RGB565像素数据
+                    # 写入RGB565像素数据(面板字节序为大端)
+                    pixel_format = '>H' if native_order else '<H'
                     for pixel in rgb565_data:
-                        f.write(struct.pack('<H', pixel))
+                        f.write(struct.pack(pixel_format, pixel))
 
                 return True
 
@@ -107,6 +143,120 @@ class RGB565Converter:
             print(f"转换图片 {image_path} 时出错: {e}")
             return False
 
+    @staticmethod
+    def load_image(image_path: Path, max_size: Optional[Tuple[int, int]] = None) -> Image.Image:
+        """打开图片并转换为RGB模式，按需等比缩放"""
+        with Image.open(image_path) as img:
+            img = img.convert('RGB')
+        if max_size:
+            img.thumbnail(max_size, Image.Resampling.LANCZOS)
+        return img
+
+    @staticmethod
+    def build_palette(images: list[Image.Image], colors: int) -> Image.Image:
+        """
+        为一组帧生成共享调色板
+
+        所有帧拼接后统一量化，整段动画使用同一调色板，避免逐帧调色板造成的颜色闪烁
+
+        Args:
+            images: RGB模式的帧列表
+            colors: 调色板颜色数 (256或16)
+
+        Returns:
+            P模式的调色板图像，可直接传给Image.quantize(palette=...)
+        """
+        mosaic_width = max(img.width for img in images)
+        mosaic_height = sum(img.height for img in images)
+        mosaic = Image.new('RGB', (mosaic_width, mosaic_height))
+        y = 0
+        for img in images:
+            mosaic.paste(img, (0, y))
+            y += img.height
+
+        quantized = mosaic.quantize(colors=colors, method=Image.Quantize.MEDIANCUT, dither=Image.Dither.NONE)
+
+        # 调色板补齐到256项(用第0项填充)，后续量化结果不会落到填充项以外的新颜色上
+        palette = quantized.getpalette()[:colors * 3]
+        palette += [0] * (colors * 3 - len(palette))
+        palette_image = Image.new('P', (1, 1))
+        palette_image.putpalette(palette + palette[:3] * (256 - colors))
+        return palette_image
+
+    @staticmethod
+    def convert_image_to_indexed(image_path: Path, output_path: Path,
+                                 color_format: str = 'i8',
+                                 max_size: Optional[Tuple[int, int]] = None,
+                                 palette: Optional[Image.Image] = None,
+                                 dither: bool = True) -> bool:
+        """
+        将图片量化为索引色(LVGL I8/I4)并保存为LVGL 9.x二进制文件
+
+        文件布局: 24字节头部 + 调色板(每项B,G,R,A) + 像素索引(I4每字节2像素，偶数列在高4位)
+
+        Args:
+            image_path: 输入图片路径
+            output_path: 输出文件路径
+            color_format: 'i8' (256色) 或 'i4' (16色)
+            max_size: 最大尺寸 (width, height)，如果图片超过此尺寸则会等比缩放
+            palette: 共享调色板(build_palette的结果)，None时为本帧单独生成
+            dither: 是否使用Floyd-Steinberg抖动
+
+        Returns:
+            转换是否成功
+        """
+        try:
+            lv_format, colors = INDEXED_FORMATS[color_format]
+
+            img = RGB565Converter.load_image(image_path, max_size)
+            width, height = img.size
+
+            if palette is None:
+                palette = RGB565Converter.build_palette([img], colors)
+
+            dither_mode = Image.Dither.FLOYDSTEINBERG if dither else Image.Dither.NONE
+            quantized = img.quantize(palette=palette, dither=dither_mode)
+
+            # 填充项与第0项颜色相同，映射回有效范围
+            palette_values = palette.getpalette()[:256 * 3]
+            indices = np.array(quantized, dtype=np.uint8)
+            indices[indices >= colors] = 0
+
+            # 调色板: lv_color32_t (B, G, R, A)
+            palette_bytes = bytearray()
+            for i in range(colors):
+                r, g, b = palette_values[i * 3:i * 3 + 3]
+                palette_bytes += bytes((b, g, r, 0xFF))
+
+            if lv_format == LV_COLOR_FORMAT_I4:
+                # 奇数宽度补一列, 两个像素打包为一个字节
+                if width % 2:
+                    indices = np.pad(indices, ((0, 0), (0, 1)))
+                packed = (indices[:, 0::2] << 4) | indices[:, 1::2]
+                stride = (width + 1) // 2
+            else:
+                packed = indices
+                stride = width
+
+            pixel_bytes = packed.astype(np.uint8).tobytes()
+
+            with open(output_path, 'wb') as f:
+                header_cf = (0x37 << 24) | lv_format
+                f.write(struct.pack('<I', header_cf))                 # 4字节: magic + cf
+                f.write(struct.pack('<I', 0))                         # 4字节: flags
+                f.write(struct.pack('<HH', width, height))            # 4字节: width + height
+                f.write(struct.pack('<I', stride))                    # 4字节: stride (索引行字节数)
+                f.write(struct.pack('<I', 0))                         # 4字节: reserved_2
+                f.write(struct.pack('<I', len(palette_bytes) + len(pixel_bytes)))  # 4字节: data_size
+                f.write(palette_bytes)
+                f.write(pixel_bytes)
+
+            return True
+
+        except Exception as e:
+            print(f"转换图片 {image_path} 为索引色时出错: {e}")
+            return False
+
     @staticmethod
     def convert_image_to_c_array(image_path: Path, output_path: Path,
                                 array_name: Optional[str] = None,
@@ -184,20 +334,29 @@ class RGB565Converter:
 
     @staticmethod
     def pack_frames_to_bundle(frame_files: list[Path], output_bundle: Path,
-                              width: int = 120, height: int = 120) -> bool:
+                              width: int = 120, height: int = 120,
+                              fps: int = 0, dedup_threshold: int = 12,
+                              align: int = 512) -> bool:
         """
         将多个帧文件打包为bundle.bin
 
         Bundle文件格式:
         - Bundle Header (64字节): magic, version, frame_count, 等元数据
-        - Frame Index (N×12字节): 每帧的offset, size, checksum
+        - Frame Index (N×16字节): 每帧的offset, size, checksum, duration_ms, flags
         - Frame Data: 所有帧的LVGL 9.x格式数据
+          (RGB565/RGB565_SWAPPED，或I8/I4: 头部后紧跟调色板和索引)
+
+        相邻的感知相同帧合并为一项并加长显示时长, 不相邻的重复帧作为别名指向之前的数据
 
         Args:
             frame_files: 帧文件列表（按顺序，1.bin, 2.bin, ...）
             output_bundle: 输出bundle文件路径
             width: 帧宽度
             height: 帧高度
+            fps: 小鸟帧率, 写入bundle头部 (0: 使用固件默认帧间隔)
+            dedup_threshold: 相邻帧合并阈值(通道差之和, 0: 只合并完全相同的帧)
+            align: RGB565帧像素数据(24字节LVGL头之后)的起始对齐并补齐到的字节数,
+                   512为扇区, 也可取簇大小; 0不对齐。索引色帧不对齐(设备端按块展开)
 
         Returns:
             转换是否成功
@@ -217,16 +376,17 @@ class RGB565Converter:
 
             # 常量定义
             MAGIC = 0x42495244  # "BIRD"
-            VERSION = 1
-            COLOR_FORMAT_RGB565 = 0x12
+            SUPPORTED_FORMATS = (LV_COLOR_FORMAT_RGB565, LV_COLOR_FORMAT_RGB565_SWAPPED,
+                                 LV_COLOR_FORMAT_I8, LV_COLOR_FORMAT_I4)
+            PALETTE_SIZES = {LV_COLOR_FORMAT_I8: 256 * 4, LV_COLOR_FORMAT_I4: 16 * 4}
             HEADER_SIZE = 64
-            INDEX_ENTRY_SIZE = 12
-            INDEX_TABLE_SIZE = frame_count * INDEX_ENTRY_SIZE
-            DATA_OFFSET = HEADER_SIZE + INDEX_TABLE_SIZE
 
             # 验证帧文件并收集信息
             print("验证帧文件...")
-            frame_info_list = []
+            valid_frames = []
+            bundle_color_format = None
+            first_palette = None
+            shared_palette = True
             for i, frame_file in enumerate(frame_files):
                 if not frame_file.exists():
                     print(f"错误: 帧文件不存在: {frame_file}")
@@ -248,65 +408,377 @@ class RGB565Converter:
                     color_format = header_cf & 0xFF
                     magic = (header_cf >> 24) & 0xFF
 
-                    if color_format != COLOR_FORMAT_RGB565 or magic != 0x37:
+                    if color_format not in SUPPORTED_FORMATS or magic != 0x37:
                         print(f"错误: 无效的LVGL 9.x格式: {frame_file} (cf=0x{color_format:02X}, magic=0x{magic:02X})")
                         return False
 
-                frame_size = frame_file.stat().st_size
-                frame_info_list.append({
-                    'path': frame_file,
-                    'size': frame_size,
-                    'offset': DATA_OFFSET + sum(info['size'] for info in frame_info_list)
-                })
+                    # 同一bundle内字节序必须一致
+                    if bundle_color_format is None:
+                        bundle_color_format = color_format
+                    elif color_format != bundle_color_format:
+                        print(f"错误: 帧颜色格式不一致: {frame_file} (cf=0x{color_format:02X}, "
+                              f"首帧cf=0x{bundle_color_format:02X})，请用相同的 --byte-order/--color-format 重新转换")
+                        return False
+
+                    # 索引色: 比较调色板(位于24字节头部之后)，全部相同则标记为共享调色板
+                    if color_format in PALETTE_SIZES:
+                        f.seek(24)
+                        palette = f.read(PALETTE_SIZES[color_format])
+                        if first_palette is None:
+                            first_palette = palette
+                        elif palette != first_palette:
+                            shared_palette = False
+
+                valid_frames.append(frame_file)
 
-            # 计算总文件大小
-            total_data_size = sum(info['size'] for info in frame_info_list)
-            total_size = DATA_OFFSET + total_data_size
+            # 去重合并, 计算每项的数据偏移
+            frame_ms = 1000 // fps if fps else DEFAULT_FRAME_MS
+            entries = RGB565Converter.dedup_frames(valid_frames, bundle_color_format, frame_ms, dedup_threshold)
+            entry_count = len(entries)
+
+            if align and (align < 512 or align & (align - 1) or align > 0xFFFF):
+                print(f"错误: --align 必须是512到32768之间的2的幂: {align}")
+                return False
+            if bundle_color_format in PALETTE_SIZES:
+                align = 0
+
+            def align_up(value: int) -> int:
+                return (value + align - 1) // align * align if align else value
+
+            # 对齐时像素数据从扇区边界开始, 设备端可直接多块读取整扇区。
+            # 每帧(含24字节头)补齐到整扇区, 下一帧的头落在上一帧最后一个扇区的末尾24字节,
+            # 帧间连续不再空出一个扇区; 末尾补24字节, 最后一帧按整扇区读取也不超出文件
+            data_offset = HEADER_SIZE + entry_count * struct.calcsize(INDEX_ENTRY_FORMAT)
+            offset = align_up(data_offset + 24) - 24
+            read_end = offset
+            for entry in entries:
+                if 'alias' not in entry:
+                    entry['offset'] = offset
+                    entry['padded'] = align_up(len(entry['data']))
+                    read_end = offset + 24 + align_up(len(entry['data']) - 24)
+                    offset += entry['padded']
+            total_size = max(offset, read_end)
+            alias_count = sum(1 for entry in entries if 'alias' in entry)
+
+            # 等步长: 设备按帧号直接计算偏移, 不需要常驻或分页读取索引
+            # (data_offset写为第一帧的偏移, 对齐时索引后的填充不计入数据区;
+            #  步长取实际排布的帧间距写入头部, 设备不自行推算)
+            frame_stride = 0
+            if alias_count == 0:
+                frame_stride = entries[1]['offset'] - entries[0]['offset'] if entry_count > 1 else entries[0]['padded']
+            uniform = (alias_count == 0 and
+                       all(len(entry['data']) == len(entries[0]['data']) for entry in entries) and
+                       all(entry['duration'] == frame_ms for entry in entries) and
+                       all(entry['offset'] == entries[0]['offset'] + i * frame_stride for i, entry in enumerate(entries)))
+            data_offset = entries[0]['offset']
 
             # 写入bundle文件
             print(f"写入bundle文件 (总大小: {total_size / 1024 / 1024:.2f} MB)...")
             with open(output_bundle, 'wb') as f:
                 # 1. 写入Bundle Header (64字节)
                 f.write(struct.pack('<I', MAGIC))                    # magic (4B)
-                f.write(struct.pack('<H', VERSION))                  # version (2B)
-                f.write(struct.pack('<H', frame_count))              # frame_count (2B)
+                f.write(struct.pack('<H', BUNDLE_VERSION))           # version (2B)
+                f.write(struct.pack('<H', entry_count))              # frame_count (2B)
                 f.write(struct.pack('<H', width))                    # frame_width (2B)
                 f.write(struct.pack('<H', height))                   # frame_height (2B)
-                f.write(struct.pack('<I', frame_info_list[0]['size']))  # frame_size (4B, 假设所有帧相同)
+                f.write(struct.pack('<I', len(entries[0]['data'])))  # frame_size (4B, 假设所有帧相同)
                 f.write(struct.pack('<I', HEADER_SIZE))              # index_offset (4B)
-                f.write(struct.pack('<I', DATA_OFFSET))              # data_offset (4B)
+                f.write(struct.pack('<I', data_offset))              # data_offset (4B)
                 f.write(struct.pack('<I', total_size))               # total_size (4B)
-                f.write(struct.pack('<B', COLOR_FORMAT_RGB565))      # color_format (1B)
-                f.write(bytes(35))                                   # reserved (35B)
-
-                # 2. 写入Frame Index表 (N×12字节)
-                for frame_info in frame_info_list:
-                    # 计算帧数据的CRC32校验
-                    with open(frame_info['path'], 'rb') as frame_file:
-                        frame_data = frame_file.read()
-                        checksum = zlib.crc32(frame_data) & 0xFFFFFFFF
-
-                    f.write(struct.pack('<I', frame_info['offset']))  # offset (4B)
-                    f.write(struct.pack('<I', frame_info['size']))    # size (4B)
-                    f.write(struct.pack('<I', checksum))              # checksum (4B)
-
-                # 3. 写入所有帧数据
+                native_order = bundle_color_format == LV_COLOR_FORMAT_RGB565_SWAPPED
+                indexed = bundle_color_format in PALETTE_SIZES
+                bundle_flags = BUNDLE_FLAG_NATIVE_ORDER if native_order else 0
+                if indexed and shared_palette:
+                    bundle_flags |= BUNDLE_FLAG_SHARED_PALETTE
+                if align:
+                    bundle_flags |= BUNDLE_FLAG_ALIGNED
+                if uniform:
+                    bundle_flags |= BUNDLE_FLAG_UNIFORM
+                f.write(struct.pack('<B', bundle_color_format))      # color_format (1B)
+                f.write(struct.pack('<B', bundle_flags))             # flags (1B)
+                f.write(struct.pack('<II', 0, 0))                    # background_offset/size (8B, 仅精灵bundle)
+                f.write(struct.pack('<B', fps))                      # fps (1B)
+                f.write(struct.pack('<H', align))                    # payload_align (2B)
+                f.write(struct.pack('<I', frame_stride if uniform else 0))  # frame_stride (4B, 仅等步长)
+                f.write(bytes(19))                                   # reserved (19B)
+
+                # 2. 写入Frame Index表 (N×16字节)
+                for entry in entries:
+                    target = entry.get('alias', entry)
+                    checksum = zlib.crc32(target['data']) & 0xFFFFFFFF
+                    f.write(struct.pack(INDEX_ENTRY_FORMAT, target['offset'], len(target['data']), checksum,
+                                        entry['duration'], FRAME_FLAG_ALIAS if 'alias' in entry else 0))
+
+                # 3. 写入所有帧数据(别名项不重复写入, 对齐时前后补0)
                 print("写入帧数据...")
-                for i, frame_info in enumerate(frame_info_list):
-                    with open(frame_info['path'], 'rb') as frame_file:
-                        frame_data = frame_file.read()
-                        f.write(frame_data)
+                for i, entry in enumerate(entries):
+                    if 'alias' not in entry:
+                        f.write(bytes(entry['offset'] - f.tell()))
+                        f.write(entry['data'])
+                        f.write(bytes(entry['padded'] - len(entry['data'])))
 
-                    if (i + 1) % 10 == 0 or (i + 1) == frame_count:
-                        print(f"  已写入 {i + 1}/{frame_count} 帧")
+                    if (i + 1) % 10 == 0 or (i + 1) == entry_count:
+                        print(f"  已写入 {i + 1}/{entry_count} 项")
+                f.write(bytes(total_size - f.tell()))
 
             print(f"✓ 成功打包 {frame_count} 帧")
             print(f"  输出文件: {output_bundle}")
             print(f"  文件大小: {total_size / 1024 / 1024:.2f} MB")
+            print(f"  索引项: {entry_count} (合并 {frame_count - entry_count} 帧, 别名 {alias_count} 项), "
+                  f"帧率: {fps if fps else '默认'}")
+            print(f"  像素数据对齐: {f'{align}字节' if align else '无'}")
+            print(f"  帧寻址: {f'等步长{frame_stride}字节(设备不读索引)' if uniform else '索引分页'}")
+            if indexed:
+                rgb565_size = 24 + width * height * 2
+                print(f"  颜色格式: {'I8' if bundle_color_format == LV_COLOR_FORMAT_I8 else 'I4'}, "
+                      f"{'共享调色板' if shared_palette else '逐帧调色板'}")
+                frame_size = len(entries[0]['data'])
+                print(f"  每帧 {frame_size} 字节 (RGB565: {rgb565_size} 字节, {rgb565_size / frame_size:.1f}x)")
+            else:
+                print(f"  字节序: {'面板字节序 (RGB565_SWAPPED)' if native_order else '小端 RGB565'}")
             return True
 
         except Exception as e:
             print(f"打包帧文件时出错: {e}")
             import traceback
             traceback.print_exc()
-            return False
\ No newline at end of file
+            return False
+
+    @staticmethod
+    def dedup_frames(frame_files: list[Path], color_format: int, frame_ms: int,
+                     threshold: int) -> list[dict]:
+        """
+        合并重复帧
+
+        - 相邻帧完全相同, 或(RGB565帧)感知相同: 合并为一项, 时长累加
+        - 不相邻的完全相同帧: 作为别名('alias')指向第一次出现的项, 不重复存储
+
+        Args:
+            frame_files: 按顺序排列的帧文件
+            color_format: 帧颜色格式
+            frame_ms: 单帧时长(毫秒)
+            threshold: 感知相同阈值(通道差之和), 0表示只比较字节
+
+        Returns:
+            索引项列表: {'data': bytes, 'duration': ms[, 'alias': 被引用的项]}
+        """
+        import zlib
+
+        perceptual = threshold > 0 and color_format in (LV_COLOR_FORMAT_RGB565, LV_COLOR_FORMAT_RGB565_SWAPPED)
+        entries = []
+        run_channels = None
+
+        for frame_file in frame_files:
+            data = frame_file.read_bytes()
+            channels = None
+            if perceptual:
+                channels = RGB565Converter.rgb565_channels(RGB565Converter.read_rgb565_frame(frame_file)[0])
+
+            if entries and entries[-1]['duration'] + frame_ms <= 0xFFFF:
+                prev = entries[-1]
+                same = data == prev['data']
+                if not same and perceptual:
+                    # 与合并段的第一帧比较, 避免缓慢变化逐帧累积
+                    same = RGB565Converter.frames_similar(run_channels, channels, threshold)
+                if same:
+                    prev['duration'] += frame_ms
+                    continue
+
+            entries.append({'data': data, 'duration': frame_ms})
+            run_channels = channels
+
+        # 不相邻的重复帧作为别名
+        first_seen = {}
+        for entry in entries:
+            key = zlib.crc32(entry['data'])
+            first = first_seen.get(key)
+            if first is not None and first['data'] == entry['data']:
+                entry['alias'] = first
+            else:
+                first_seen[key] = entry
+
+        return entries
+
+    @staticmethod
+    def rgb565_channels(pixels: np.ndarray) -> np.ndarray:
+        """RGB565数值拆分为8位刻度的R、G、B通道 (3, h, w)"""
+        pixels = pixels.astype(np.int32)
+        return np.stack((((pixels >> 11) & 0x1F) * 8, ((pixels >> 5) & 0x3F) * 4, (pixels & 0x1F) * 8))
+
+    @staticmethod
+    def frames_similar(a: np.ndarray, b: np.ndarray, threshold: int, max_changed: float = 0.002) -> bool:
+        """变化超过阈值的像素不超过max_changed比例时视为感知相同"""
+        if a is None or b is None or a.shape != b.shape:
+            return False
+        diff = np.abs(a - b).sum(axis=0)
+        return (diff > threshold).mean() <= max_changed
+
+    @staticmethod
+    def read_rgb565_frame(frame_file: Path) -> Tuple[np.ndarray, int]:
+        """
+        读取LVGL 9.x RGB565/RGB565_SWAPPED帧文件
+
+        Returns:
+            (像素数组(h, w)，按标准RGB565数值, 颜色格式)
+        """
+        with open(frame_file, 'rb') as f:
+            header = f.read(24)
+            if len(header) != 24:
+                raise ValueError(f"帧文件太小: {frame_file}")
+
+            header_cf, _, width, height, _, _, data_size = struct.unpack('<IIHHIII', header)
+            color_format = header_cf & 0xFF
+            if (header_cf >> 24) != 0x37 or color_format not in (LV_COLOR_FORMAT_RGB565, LV_COLOR_FORMAT_RGB565_SWAPPED):
+                raise ValueError(f"精灵打包需要RGB565帧: {frame_file} (cf=0x{color_format:02X})")
+
+            dtype = '>u2' if color_format == LV_COLOR_FORMAT_RGB565_SWAPPED else '<u2'
+            pixels = np.frombuffer(f.read(width * height * 2), dtype=dtype)
+            if pixels.size != width * height:
+                raise ValueError(f"帧数据不完整: {frame_file}")
+
+        return pixels.astype(np.uint16).reshape(height, width), color_format
+
+    @staticmethod
+    def pack_sprite_bundle(frame_files: list[Path], output_bundle: Path,
+                           width: int = 120, height: int = 120,
+                           mask: str = 'a1', threshold: int = 24, fps: int = 0) -> bool:
+        """
+        将帧序列打包为精灵bundle: 一张背景图 + 每帧小鸟精灵
+
+        背景取各帧逐像素中值; 与背景差异超过阈值的像素(外扩1像素)属于前景,
+        每帧只保存前景包围盒内的RGB565A8精灵, 位置写入帧头reserved_2 ((y << 16) | x)
+
+        Args:
+            frame_files: RGB565/RGB565_SWAPPED帧文件列表
+            output_bundle: 输出bundle文件路径
+            width: 帧宽度
+            height: 帧高度
+            mask: 透明度平面 'a1' (1位掩码, 设备端展开) 或 'a8'
+            threshold: 前景判定阈值(8位通道差之和)
+            fps: 小鸟帧率, 写入bundle头部 (0: 使用固件默认帧间隔)
+
+        Returns:
+            转换是否成功
+        """
+        try:
+            import zlib
+
+            if not frame_files:
+                print("错误: 没有提供帧文件")
+                return False
+
+            frame_files = sorted(frame_files, key=lambda p: int(p.stem) if p.stem.isdigit() else 0)
+            frame_count = len(frame_files)
+            print(f"开始打包 {frame_count} 帧精灵到 {output_bundle}")
+
+            frames = []
+            bundle_color_format = None
+            for frame_file in frame_files:
+                pixels, color_format = RGB565Converter.read_rgb565_frame(frame_file)
+                if pixels.shape != (height, width):
+                    print(f"错误: 帧尺寸不是 {width}x{height}: {frame_file}")
+                    return False
+                if bundle_color_format is None:
+                    bundle_color_format = color_format
+                elif color_format != bundle_color_format:
+                    print(f"错误: 帧字节序不一致: {frame_file}")
+                    return False
+                frames.append(pixels)
+
+            stack = np.stack(frames).astype(np.int32)
+            r = (stack >> 11) & 0x1F
+            g = (stack >> 5) & 0x3F
+            b = stack & 0x1F
+
+            # 背景: 逐像素中值, 短暂经过的小鸟不会进入背景
+            bg_r = np.median(r, axis=0).astype(np.int32)
+            bg_g = np.median(g, axis=0).astype(np.int32)
+            bg_b = np.median(b, axis=0).astype(np.int32)
+            background = ((bg_r << 11) | (bg_g << 5) | bg_b).astype(np.uint16)
+
+            # 前景掩码: 换算到8位刻度的通道差之和, 外扩1像素避免边缘残影
+            diff = np.abs(r - bg_r) * 8 + np.abs(g - bg_g) * 4 + np.abs(b - bg_b) * 8
+            fg = diff > threshold
+            grown = fg.copy()
+            grown[:, 1:, :] |= fg[:, :-1, :]
+            grown[:, :-1, :] |= fg[:, 1:, :]
+            grown[:, :, 1:] |= fg[:, :, :-1]
+            grown[:, :, :-1] |= fg[:, :, 1:]
+
+            native_order = bundle_color_format == LV_COLOR_FORMAT_RGB565_SWAPPED
+            pixel_dtype = '>u2' if native_order else '<u2'
+
+            def lvgl_header(cf: int, flags: int, w: int, h: int, stride: int, reserved_2: int, data_size: int) -> bytes:
+                return struct.pack('<IIHHIII', (0x37 << 24) | cf, flags, w, h, stride, reserved_2, data_size)
+
+            # 背景图: 与普通帧相同格式
+            bg_pixels = background.astype(pixel_dtype).tobytes()
+            background_data = lvgl_header(bundle_color_format, 0, width, height, width * 2, 0, len(bg_pixels)) + bg_pixels
+
+            # 每帧精灵: RGB565A8 (颜色平面按LVGL要求为小端RGB565)
+            sprites = []
+            sprite_area = 0
+            for i in range(frame_count):
+                ys, xs = np.nonzero(grown[i])
+                if ys.size == 0:
+                    # 没有前景: 1x1全透明精灵
+                    x0, y0, x1, y1 = 0, 0, 0, 0
+                    alpha = np.zeros((1, 1), dtype=bool)
+                else:
+                    x0, x1 = int(xs.min()), int(xs.max())
+                    y0, y1 = int(ys.min()), int(ys.max())
+                    alpha = grown[i, y0:y1 + 1, x0:x1 + 1]
+
+                sw, sh = x1 - x0 + 1, y1 - y0 + 1
+                sprite_area += sw * sh
+                colors = frames[i][y0:y1 + 1, x0:x1 + 1].astype('<u2').tobytes()
+                if mask == 'a1':
+                    alpha_bytes = np.packbits(alpha, axis=1).tobytes()
+                    flags = SPRITE_FRAME_FLAG_MASK_A1
+                else:
+                    alpha_bytes = (alpha.astype(np.uint8) * 0xFF).tobytes()
+                    flags = 0
+
+                data = colors + alpha_bytes
+                sprites.append(lvgl_header(LV_COLOR_FORMAT_RGB565A8, flags, sw, sh, sw * 2,
+                                           (y0 << 16) | x0, len(data)) + data)
+
+            HEADER_SIZE = 64
+            background_offset = HEADER_SIZE + frame_count * struct.calcsize(INDEX_ENTRY_FORMAT)
+            data_offset = background_offset + len(background_data)
+            total_size = data_offset + sum(len(sprite) for sprite in sprites)
+            avg_sprite_size = sum(len(sprite) for sprite in sprites) // frame_count
+
+            bundle_flags = BUNDLE_FLAG_SPRITE | (BUNDLE_FLAG_NATIVE_ORDER if native_order else 0)
+
+            with open(output_bundle, 'wb') as f:
+                f.write(struct.pack('<IHHHHIIII', 0x42495244, BUNDLE_VERSION, frame_count, width, height,
+                                    avg_sprite_size, HEADER_SIZE, data_offset, total_size))
+                f.write(struct.pack('<BB', bundle_color_format, bundle_flags))
+                f.write(struct.pack('<II', background_offset, len(background_data)))
+                f.write(struct.pack('<BHI', fps, 0, 0))               # payload_align, frame_stride: 不适用
+                f.write(bytes(19))
+
+                offset = data_offset
+                for sprite in sprites:
+                    f.write(struct.pack(INDEX_ENTRY_FORMAT, offset, len(sprite), zlib.crc32(sprite) & 0xFFFFFFFF, 0, 0))
+                    offset += len(sprite)
+
+                f.write(background_data)
+                for sprite in sprites:
+                    f.write(sprite)
+
+            full_size = data_offset - len(background_data) + frame_count * (24 + width * height * 2)
+            coverage = sprite_area / (frame_count * width * height) * 100
+            print(f"✓ 成功打包 {frame_count} 帧精灵")
+            print(f"  输出文件: {output_bundle}")
+            print(f"  文件大小: {total_size / 1024:.1f} KB (整帧bundle: {full_size / 1024:.1f} KB)")
+            print(f"  平均精灵: {avg_sprite_size} 字节, 包围盒平均占帧面积 {coverage:.1f}%")
+            print(f"  掩码: {mask.upper()}")
+            return True
+
+        except Exception as e:
+            print(f"打包精灵bundle时出错: {e}")
+            import traceback
+            traceback.print_exc()
+            return False
@@ -0,0 +1,112 @@
+"""
+bundle帧排布检查: 转换器写入的偏移与设备端(BirdBundleLoader::setupFrameAddressing)的寻址一致
+
+运行: cd scripts/converter && uv run python -m unittest discover tests
+"""
+
+import struct
+import sys
+import tempfile
+import unittest
+from pathlib import Path
+
+import numpy as np
+
+sys.path.insert(0, str(Path(__file__).resolve().parents[1] / 'src'))
+
+from converter.rgb565 import (RGB565Converter, LV_COLOR_FORMAT_RGB565,  # noqa: E402
+                              BUNDLE_FLAG_ALIGNED, BUNDLE_FLAG_UNIFORM, INDEX_ENTRY_FORMAT)
+
+LVGL_HEADER_SIZE = 24
+
+
+def write_frame(path: Path, width: int, height: int, seed: int) -> None:
+    pixels = np.random.default_rng(seed).integers(0, 0x10000, width * height, dtype=np.uint16)
+    data = pixels.astype('<u2').tobytes()
+    header = struct.pack('<IIHHIII', (0x37 << 24) | LV_COLOR_FORMAT_RGB565, 0, width, height,
+                         width * 2, 0, len(data))
+    path.write_bytes(header + data)
+
+
+def read_bundle(path: Path) -> tuple[dict, list[tuple]]:
+    raw = path.read_bytes()
+    header = {
+        'frame_count': struct.unpack_from('<H', raw, 6)[0],
+        'frame_size': struct.unpack_from('<I', raw, 12)[0],
+        'index_offset': struct.unpack_from('<I', raw, 16)[0],
+        'data_offset': struct.unpack_from('<I', raw, 20)[0],
+        'total_size': struct.unpack_from('<I', raw, 24)[0],
+        'flags': raw[29],
+        'payload_align': struct.unpack_from('<H', raw, 39)[0],
+        'frame_stride': struct.unpack_from('<I', raw, 41)[0],
+        'file_size': len(raw),
+    }
+    entry_size = struct.calcsize(INDEX_ENTRY_FORMAT)
+    entries = [struct.unpack_from(INDEX_ENTRY_FORMAT, raw, header['index_offset'] + i * entry_size)
+               for i in range(header['frame_count'])]
+    return header, entries
+
+
+def device_stride(header: dict) -> int:
+    """与BirdBundleLoader::setupFrameAddressing()相同, 0表示设备改用索引"""
+    stride = header['frame_stride']
+    if stride == 0 and not header['flags'] & BUNDLE_FLAG_ALIGNED:
+        stride = header['frame_size']
+    uniform = (header['flags'] & BUNDLE_FLAG_UNIFORM and stride >= header['frame_size'] and
+               header['data_offset'] + stride * (header['frame_count'] - 1) + header['frame_size'] <= header['total_size'])
+    return stride if uniform else 0
+
+
+class BundleLayoutTest(unittest.TestCase):
+    def pack(self, frames: int, align: int, repeat_first: bool = False) -> tuple[dict, list[tuple]]:
+        with tempfile.TemporaryDirectory() as tmp:
+            tmp = Path(tmp)
+            files = []
+            for i in range(frames):
+                path = tmp / f'{i + 1}.bin'
+                write_frame(path, 120, 120, 0 if repeat_first and i == frames - 1 else i)
+                files.append(path)
+            bundle = tmp / 'bundle.bin'
+            self.assertTrue(RGB565Converter.pack_frames_to_bundle(files, bundle, 120, 120, align=align))
+            return read_bundle(bundle)
+
+    def check_uniform(self, header: dict, entries: list[tuple]) -> None:
+        stride = device_stride(header)
+        self.assertGreater(stride, 0, 'device should use uniform addressing')
+        self.assertEqual(entries[1][0] - entries[0][0], stride)
+        for i, (offset, size, _, _, _) in enumerate(entries):
+            self.assertEqual(offset, header['data_offset'] + i * stride)
+            self.assertEqual(size, header['frame_size'])
+
+    def test_aligned_uniform_stride(self):
+        header, entries = self.pack(3, 512)
+        self.check_uniform(header, entries)
+        for offset, size, _, _, _ in entries:
+            payload = offset + LVGL_HEADER_SIZE
+            self.assertEqual(payload % 512, 0)
+            # 设备按整扇区读取像素数据, 不能超出文件
+            read_end = payload + (size - LVGL_HEADER_SIZE + 511) // 512 * 512
+            self.assertLessEqual(read_end, header['total_size'])
+        self.assertEqual(header['total_size'], header['file_size'])
+        # 帧间连续: 下一帧的头紧接在上一帧补齐后的扇区之后
+        self.assertEqual(header['frame_stride'], (header['frame_size'] + 511) // 512 * 512)
+
+    def test_cluster_aligned_uniform_stride(self):
+        header, entries = self.pack(2, 4096)
+        self.check_uniform(header, entries)
+        self.assertEqual((entries[0][0] + LVGL_HEADER_SIZE) % 4096, 0)
+
+    def test_packed_uniform_stride(self):
+        header, entries = self.pack(2, 0)
+        self.check_uniform(header, entries)
+        self.assertEqual(header['frame_stride'], header['frame_size'])
+
+    def test_alias_uses_index(self):
+        header, entries = self.pack(3, 512, repeat_first=True)
+        self.assertEqual(header['frame_stride'], 0)
+        self.assertEqual(device_stride(header), 0)
+        self.assertEqual(entries[2][0], entries[0][0])
+
+
+if __name__ == '__main__':
+    unittest.main()
@@ -0,0 +1,265 @@
+// 小鸟收藏分区镜像工具
+//
+// 使用固件中的FavPartition(主机端以mmap映射镜像文件)生成、检查birdfav分区镜像,
+// 写入flash后开机即可从flash映射播放, 不必等待后台同步。
+// 编译与用法见同目录 README.md。
+
+#include "favourite_partition.h"
+
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <vector>
+
+using namespace BirdWatching;
+
+// bundle头部中用到的字段(与bird_bundle_loader.h中BirdBundleHeader的偏移一致)
+#define BUNDLE_MAGIC            0x42495244
+#define BUNDLE_HEADER_SIZE      64
+#define BUNDLE_FLAG_SPRITE      0x04
+#define BUNDLE_FLAG_ALIGNED     0x08
+#define BUNDLE_FLAG_UNIFORM     0x10
+#define LVGL_HEADER_SIZE        24
+#define LVGL_MAGIC              0x37
+#define CF_RGB565               0x12
+#define CF_RGB565_SWAPPED       0x1B
+#define CF_I4                   0x09
+#define CF_I8                   0x0A
+#define CF_RGB565A8             0x14
+#define SPRITE_FLAG_MASK_A1     0x0100
+
+static uint16_t rd16(const uint8_t* p)
+{
+	return (uint16_t)(p[0] | (p[1] << 8));
+}
+
+static uint32_t rd32(const uint8_t* p)
+{
+	return (uint32_t)p[0] | ((uint32_t)p[1] << 8) | ((uint32_t)p[2] << 16) | ((uint32_t)p[3] << 24);
+}
+
+static bool readFile(const char* path, std::vector<uint8_t>& out)
+{
+	FILE* fp = fopen(path, "rb");
+	if (!fp) {
+		fprintf(stderr, "Cannot open %s\n", path);
+		return false;
+	}
+	fseek(fp, 0, SEEK_END);
+	long size = ftell(fp);
+	fseek(fp, 0, SEEK_SET);
+	out.resize(size > 0 ? size : 0);
+	bool ok = size > 0 && fread(out.data(), 1, out.size(), fp) == out.size();
+	fclose(fp);
+	return ok;
+}
+
+static int cmdCreate(const char* image, uint32_t size_kb)
+{
+	uint32_t size = size_kb * 1024;
+	if (size < FAV_DATA_START || size % FAV_SECTOR_SIZE != 0) {
+		fprintf(stderr, "Size must be a multiple of %u KB\n", FAV_SECTOR_SIZE / 1024);
+		return 1;
+	}
+
+	// 与擦除后的flash一致: 全部为0xFF
+	FILE* fp = fopen(image, "wb");
+	if (!fp) {
+		fprintf(stderr, "Cannot create %s\n", image);
+		return 1;
+	}
+	std::vector<uint8_t> blank(FAV_SECTOR_SIZE, 0xFF);
+	for (uint32_t done = 0; done < size; done += FAV_SECTOR_SIZE) {
+		fwrite(blank.data(), 1, blank.size(), fp);
+	}
+	fclose(fp);
+
+	FavPartition part;
+	FavDirectory dir;
+	uint8_t slot = 0;
+	favInitDirectory(dir);
+	if (!part.open(image) || !part.saveDirectory(dir, &slot)) {
+		fprintf(stderr, "Failed to write directory\n");
+		return 1;
+	}
+	printf("Created %s: %u KB, %u KB for bundles\n", image, size_kb, (size - FAV_DATA_START) / 1024);
+	return 0;
+}
+
+static int cmdAdd(const char* image, uint16_t bird_id, const char* bundle_path, uint16_t plays)
+{
+	std::vector<uint8_t> bundle;
+	if (!readFile(bundle_path, bundle)) {
+		return 1;
+	}
+	if (bundle.size() < BUNDLE_HEADER_SIZE || rd32(&bundle[0]) != BUNDLE_MAGIC) {
+		fprintf(stderr, "%s is not a bird bundle\n", bundle_path);
+		return 1;
+	}
+	uint8_t cf = bundle[28];
+	if (cf == CF_I4 || cf == CF_I8) {
+		fprintf(stderr, "Indexed bundles are expanded while playing and cannot be mapped, keep them on SD\n");
+		return 1;
+	}
+
+	FavPartition part;
+	FavDirectory dir;
+	uint8_t slot = 0;
+	if (!part.open(image)) {
+		fprintf(stderr, "Cannot open image %s (create it first)\n", image);
+		return 1;
+	}
+	part.loadDirectory(dir, &slot);
+	favRemoveBundle(dir, bird_id);
+
+	uint32_t size = (uint32_t)bundle.size();
+	uint32_t offset = favFindSpace(dir, part.size(), size);
+	if (offset == 0) {
+		fprintf(stderr, "No room for %u KB (or %u bundles already stored)\n", size / 1024, FAV_MAX_BUNDLES);
+		return 1;
+	}
+
+	uint32_t erase_size = (size + FAV_SECTOR_SIZE - 1) / FAV_SECTOR_SIZE * FAV_SECTOR_SIZE;
+	FavBundleEntry entry;
+	entry.bird_id = bird_id;
+	entry.reserved = 0;
+	entry.offset = offset;
+	entry.size = size;
+	entry.header_crc = favCrc32(bundle.data(), BUNDLE_HEADER_SIZE);
+	if (!part.erase(offset, erase_size) || !part.write(offset, bundle.data(), size) ||
+	    !favInsertBundle(dir, entry)) {
+		fprintf(stderr, "Failed to write bundle\n");
+		return 1;
+	}
+
+	// 预置播放次数, 避免设备上被更常播的小鸟立即替换
+	for (int i = 0; i < FAV_MAX_TRACKED; i++) {
+		if (dir.plays[i].bird_id == bird_id || dir.plays[i].bird_id == 0) {
+			dir.plays[i].bird_id = bird_id;
+			dir.plays[i].plays = plays > dir.plays[i].plays ? plays : dir.plays[i].plays;
+			break;
+		}
+	}
+
+	if (!part.saveDirectory(dir, &slot)) {
+		fprintf(stderr, "Failed to write directory\n");
+		return 1;
+	}
+	printf("Bird %u: %u KB at 0x%06X\n", bird_id, size / 1024, offset);
+	return 0;
+}
+
+// 按固件的方式映射并遍历每一帧, 统计可零拷贝的帧
+static bool checkBundle(FavPartition& part, const FavBundleEntry& entry)
+{
+	uint32_t handle = 0;
+	const uint8_t* base = part.map(entry.offset, entry.size, &handle);
+	if (!base) {
+		printf("  map failed\n");
+		return false;
+	}
+
+	bool ok = rd32(base) == BUNDLE_MAGIC && favCrc32(base, BUNDLE_HEADER_SIZE) == entry.header_crc;
+	uint16_t version = rd16(base + 4);
+	uint16_t frames = rd16(base + 6);
+	uint32_t frame_size = rd32(base + 12);
+	uint32_t index_offset = rd32(base + 16);
+	uint32_t data_offset = rd32(base + 20);
+	uint8_t flags = base[29];
+	uint32_t frame_stride = rd32(base + 41);
+	uint32_t entry_size = version >= 2 ? 16 : 12;
+	bool sprite = (flags & BUNDLE_FLAG_SPRITE) != 0;
+
+	// 与BirdBundleLoader::setupFrameAddressing()相同: 步长取头部frame_stride, 旧版对齐bundle改用索引
+	uint32_t stride = frame_stride;
+	if (stride == 0 && !(flags & BUNDLE_FLAG_ALIGNED)) {
+		stride = frame_size;
+	}
+	bool uniform = (flags & BUNDLE_FLAG_UNIFORM) && !sprite && stride >= frame_size && frame_size > 0;
+
+	uint16_t zero_copy = 0;
+	uint16_t expanded = 0;
+	uint16_t bad = 0;
+	for (uint16_t i = 0; ok && i < frames; i++) {
+		uint32_t offset = data_offset + i * stride;
+		if (!uniform) {
+			uint32_t index_pos = index_offset + i * entry_size;
+			if (index_pos + entry_size > entry.size) {
+				bad++;
+				continue;
+			}
+			offset = rd32(base + index_pos);
+		}
+		if (offset + LVGL_HEADER_SIZE > entry.size) {
+			bad++;
+			continue;
+		}
+		const uint8_t* fh = base + offset;
+		uint8_t cf = fh[0];
+		uint32_t frame_flags = rd32(fh + 4);
+		uint32_t data_size = rd32(fh + 20);
+		if (fh[3] != LVGL_MAGIC || offset + LVGL_HEADER_SIZE + data_size > entry.size) {
+			bad++;
+		} else if (sprite && cf == CF_RGB565A8 && (frame_flags & SPRITE_FLAG_MASK_A1)) {
+			expanded++;
+		} else if (cf == CF_RGB565 || cf == CF_RGB565_SWAPPED || (sprite && cf == CF_RGB565A8)) {
+			zero_copy++;
+		} else {
+			bad++;
+		}
+	}
+
+	printf("  %s, %u frames: %u zero-copy, %u expanded (1-bit mask), %u invalid\n",
+	       ok ? "header ok" : "HEADER MISMATCH", frames, zero_copy, expanded, bad);
+	part.unmap(handle);
+	return ok && bad == 0;
+}
+
+static int cmdList(const char* image)
+{
+	FavPartition part;
+	FavDirectory dir;
+	uint8_t slot = 0;
+	if (!part.open(image)) {
+		fprintf(stderr, "Cannot open image %s\n", image);
+		return 1;
+	}
+	if (!part.loadDirectory(dir, &slot)) {
+		printf("%s: no valid directory\n", image);
+		return 1;
+	}
+
+	printf("%s: %u KB, directory slot %u seq %u, %u bundles\n", image, part.size() / 1024, slot, dir.sequence,
+	       dir.count);
+	bool ok = true;
+	for (uint16_t i = 0; i < dir.count; i++) {
+		const FavBundleEntry& entry = dir.bundles[i];
+		printf("bird %-5u 0x%06X %6u KB\n", entry.bird_id, entry.offset, entry.size / 1024);
+		ok = checkBundle(part, entry) && ok;
+	}
+	return ok ? 0 : 1;
+}
+
+static void usage()
+{
+	fprintf(stderr,
+	        "Usage:\n"
+	        "  fav_image create <image> [size_kb]                 (default 2048, see partitions.csv)\n"
+	        "  fav_image add <image> <bird_id> <bundle.bin> [plays]\n"
+	        "  fav_image list <image>\n");
+}
+
+int main(int argc, char** argv)
+{
+	if (argc >= 3 && strcmp(argv[1], "create") == 0) {
+		return cmdCreate(argv[2], argc >= 4 ? (uint32_t)atoi(argv[3]) : 2048);
+	}
+	if (argc >= 5 && strcmp(argv[1], "add") == 0) {
+		return cmdAdd(argv[2], (uint16_t)atoi(argv[3]), argv[4], argc >= 6 ? (uint16_t)atoi(argv[5]) : 0);
+	}
+	if (argc >= 3 && strcmp(argv[1], "list") == 0) {
+		return cmdList(argv[2]);
+	}
+	usage();
+	return 1;
+}
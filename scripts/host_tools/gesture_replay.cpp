@@ -0,0 +1,227 @@
+// 手势识别离线回放工具
+//
+// 将录制的IMU轨迹逐样本送入固件中的GestureEngine, 统计检测延迟与误触发率。
+// 编译与用法见同目录 README.md。
+
+#include "gesture_engine.h"
+
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <string>
+#include <vector>
+
+struct Label {
+	uint32_t time_ms;
+	GestureType gesture;
+	bool matched;
+};
+
+struct Detection {
+	uint32_t time_ms;
+	GestureType gesture;
+};
+
+static GestureType parseGesture(const char* name)
+{
+	for (int i = 0; i < GESTURE_TYPE_COUNT; i++) {
+		if (strcmp(name, GestureEngine::gestureName((GestureType)i)) == 0) {
+			return (GestureType)i;
+		}
+	}
+	return GESTURE_NONE;
+}
+
+// 轨迹格式(CSV): t_ms,ax,ay,az[,gx,gy,gz], '#'开头为注释
+static bool loadTrace(const char* path, std::vector<GestureSample>& samples)
+{
+	FILE* fp = fopen(path, "r");
+	if (!fp) {
+		fprintf(stderr, "Cannot open trace: %s\n", path);
+		return false;
+	}
+
+	char line[256];
+	while (fgets(line, sizeof(line), fp)) {
+		if (line[0] == '#' || line[0] == '\n' || line[0] == '\r') {
+			continue;
+		}
+		long v[7] = { 0 };
+		int n = sscanf(line, "%ld,%ld,%ld,%ld,%ld,%ld,%ld", &v[0], &v[1], &v[2], &v[3], &v[4], &v[5], &v[6]);
+		if (n < 4) {
+			continue;   // 表头或无效行
+		}
+		GestureSample s;
+		s.time_ms = (uint32_t)v[0];
+		s.ax = (int16_t)v[1];
+		s.ay = (int16_t)v[2];
+		s.az = (int16_t)v[3];
+		s.gx = (int16_t)v[4];
+		s.gy = (int16_t)v[5];
+		s.gz = (int16_t)v[6];
+		samples.push_back(s);
+	}
+	fclose(fp);
+	return !samples.empty();
+}
+
+// 标注格式(CSV): t_ms,GESTURE_NAME  表示该时刻用户开始做该手势
+static bool loadLabels(const char* path, std::vector<Label>& labels)
+{
+	FILE* fp = fopen(path, "r");
+	if (!fp) {
+		fprintf(stderr, "Cannot open labels: %s\n", path);
+		return false;
+	}
+
+	char line[128];
+	while (fgets(line, sizeof(line), fp)) {
+		if (line[0] == '#') {
+			continue;
+		}
+		unsigned long t;
+		char name[64];
+		if (sscanf(line, "%lu,%63[A-Z_]", &t, name) == 2) {
+			GestureType g = parseGesture(name);
+			if (g != GESTURE_NONE) {
+				Label label = { (uint32_t)t, g, false };
+				labels.push_back(label);
+			}
+		}
+	}
+	fclose(fp);
+	return true;
+}
+
+static void usage()
+{
+	fprintf(stderr,
+		"Usage: gesture_replay <trace.csv> [labels.csv] [--window ms] [--verbose]\n"
+		"  trace.csv   t_ms,ax,ay,az[,gx,gy,gz]\n"
+		"  labels.csv  t_ms,GESTURE_NAME (expected gesture onsets)\n"
+		"  --window    max delay between label and detection to count as a hit (default 2000)\n");
+}
+
+int main(int argc, char** argv)
+{
+	const char* trace_path = nullptr;
+	const char* labels_path = nullptr;
+	uint32_t window_ms = 2000;
+	bool verbose = false;
+
+	for (int i = 1; i < argc; i++) {
+		if (strcmp(argv[i], "--window") == 0 && i + 1 < argc) {
+			window_ms = (uint32_t)atoi(argv[++i]);
+		} else if (strcmp(argv[i], "--verbose") == 0) {
+			verbose = true;
+		} else if (!trace_path) {
+			trace_path = argv[i];
+		} else if (!labels_path) {
+			labels_path = argv[i];
+		} else {
+			usage();
+			return 2;
+		}
+	}
+
+	if (!trace_path) {
+		usage();
+		return 2;
+	}
+
+	std::vector<GestureSample> samples;
+	if (!loadTrace(trace_path, samples)) {
+		return 1;
+	}
+
+	std::vector<Label> labels;
+	if (labels_path && !loadLabels(labels_path, labels)) {
+		return 1;
+	}
+
+	// 回放
+	GestureEngine engine;
+	std::vector<Detection> detections;
+	for (size_t i = 0; i < samples.size(); i++) {
+		GestureType g = engine.process(samples[i]);
+		if (g != GESTURE_NONE) {
+			Detection d = { samples[i].time_ms, g };
+			detections.push_back(d);
+			if (verbose) {
+				printf("%8u ms  %s\n", d.time_ms, GestureEngine::gestureName(g));
+			}
+		}
+	}
+
+	uint32_t duration_ms = samples.back().time_ms - samples.front().time_ms;
+	printf("Trace: %zu samples, %.1f s\n", samples.size(), duration_ms / 1000.0);
+	printf("\nEngine latency (raw threshold crossing -> trigger):\n");
+	printf("%-16s %8s %8s %8s %8s\n", "gesture", "count", "avg_ms", "min_ms", "max_ms");
+	for (int i = 1; i < GESTURE_TYPE_COUNT; i++) {
+		const GestureStats& st = engine.getStats((GestureType)i);
+		if (st.triggers == 0) {
+			continue;
+		}
+		printf("%-16s %8u %8u %8u %8u\n", GestureEngine::gestureName((GestureType)i),
+			   st.triggers, st.latency_total_ms / st.triggers, st.latency_min_ms, st.latency_max_ms);
+	}
+
+	if (labels.empty()) {
+		return 0;
+	}
+
+	// 与标注匹配: 每个检测结果匹配最早的、同类型、未匹配且在窗口内的标注
+	uint32_t hits[GESTURE_TYPE_COUNT] = { 0 };
+	uint32_t false_triggers[GESTURE_TYPE_COUNT] = { 0 };
+	uint32_t latency_total[GESTURE_TYPE_COUNT] = { 0 };
+	uint32_t latency_max[GESTURE_TYPE_COUNT] = { 0 };
+
+	for (size_t i = 0; i < detections.size(); i++) {
+		const Detection& d = detections[i];
+		bool matched = false;
+		for (size_t j = 0; j < labels.size(); j++) {
+			Label& l = labels[j];
+			if (!l.matched && l.gesture == d.gesture &&
+				d.time_ms >= l.time_ms && d.time_ms - l.time_ms <= window_ms) {
+				l.matched = true;
+				matched = true;
+				uint32_t latency = d.time_ms - l.time_ms;
+				hits[d.gesture]++;
+				latency_total[d.gesture] += latency;
+				if (latency > latency_max[d.gesture]) {
+					latency_max[d.gesture] = latency;
+				}
+				break;
+			}
+		}
+		if (!matched) {
+			false_triggers[d.gesture]++;
+		}
+	}
+
+	uint32_t expected[GESTURE_TYPE_COUNT] = { 0 };
+	for (size_t j = 0; j < labels.size(); j++) {
+		expected[labels[j].gesture]++;
+	}
+
+	printf("\nAgainst labels (window %u ms):\n", window_ms);
+	printf("%-16s %8s %8s %8s %8s %10s %8s\n", "gesture", "expected", "hit", "missed", "false", "avg_lat_ms", "max_lat");
+	uint32_t total_false = 0, total_missed = 0;
+	for (int i = 1; i < GESTURE_TYPE_COUNT; i++) {
+		if (expected[i] == 0 && false_triggers[i] == 0) {
+			continue;
+		}
+		uint32_t missed = expected[i] - hits[i];
+		total_false += false_triggers[i];
+		total_missed += missed;
+		printf("%-16s %8u %8u %8u %8u %10u %8u\n", GestureEngine::gestureName((GestureType)i),
+			   expected[i], hits[i], missed, false_triggers[i],
+			   hits[i] ? latency_total[i] / hits[i] : 0, latency_max[i]);
+	}
+
+	double minutes = duration_ms / 60000.0;
+	printf("\nFalse triggers: %u (%.2f per minute), missed: %u\n",
+		   total_false, minutes > 0 ? total_false / minutes : 0.0, total_missed);
+
+	return 0;
+}
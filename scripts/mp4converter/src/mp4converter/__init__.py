@@ -142,6 +142,9 @@ def process(video_path: Path, output_dir: Path, frame_rate: Optional[int],
 @click.option('--max-width', type=int, help='最大宽度限制')
 @click.option('--max-height', type=int, help='最大高度限制')
 @click.option('--pack-bundle', is_flag=True, help='打包为bundle.bin文件（减少文件数量）')
+@click.option('--color-format', type=click.Choice(['rgb565', 'i8', 'i4']), default='rgb565',
+              help='帧颜色格式: i8=256色/i4=16色调色板（抖动量化，SD读取量降为1/2或1/4）')
+@click.option('--sprite', is_flag=True, help='打包为精灵bundle（静态背景 + 每帧小鸟精灵，需配合--pack-bundle）')
 @click.option('--workers', type=int, default=4, help='并行处理线程数')
 @click.option('--continue-on-error', is_flag=True, help='遇到错误时继续处理其他文件')
 @click.option('--keep-temp', is_flag=True, help='保留临时文件用于调试')
@@ -150,7 +153,8 @@ def batch(input_dir: Path, output_dir: Path, frame_rate: Optional[int],
          frame_count: Optional[int], resize: Optional[str],
          watermark_region: Optional[str], output_format: str,
          rgb565_format: str, max_width: Optional[int], max_height: Optional[int],
-         pack_bundle: bool, workers: int, continue_on_error: bool, keep_temp: bool, palindrome: bool):
+         pack_bundle: bool, color_format: str, sprite: bool, workers: int, continue_on_error: bool, keep_temp: bool,
+         palindrome: bool):
     """批量处理目录中的所有MP4文件
 
     INPUT_DIR: 包含MP4文件的输入目录
@@ -164,6 +168,8 @@ def batch(input_dir: Path, output_dir: Path, frame_rate: Optional[int],
         mp4-converter batch videos/ output/ --output-format rgb565 --rgb565-format c_array
 
         mp4-converter batch videos/ output/ --frame-count 40 --palindrome  # 创建回文拷贝用于倒序播放
+
+        mp4-converter batch videos/ output/ --pack-bundle --color-format i8  # 256色调色板bundle
     """
     try:
         print(f"开始批量处理:")
@@ -184,7 +190,10 @@ def batch(input_dir: Path, output_dir: Path, frame_rate: Optional[int],
                 enabled=True,
                 pack_bundle=pack_bundle,
                 bundle_width=120,
-                bundle_height=120
+                bundle_height=120,
+                color_format=color_format,
+                sprite=sprite,
+                fps=frame_rate or 0
             )
 
         # 创建处理配置
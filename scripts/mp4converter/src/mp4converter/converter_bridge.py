@@ -49,6 +49,9 @@ class RGB565Config:
     pack_bundle: bool = False  # 是否打包为bundle.bin
     bundle_width: int = 120  # bundle帧宽度
     bundle_height: int = 120  # bundle帧高度
+    color_format: str = 'rgb565'  # 'rgb565'，或索引色 'i8'/'i4'（整段视频共用一个调色板）
+    sprite: bool = False  # 打包为精灵bundle（一张背景 + 每帧小鸟包围盒精灵）
+    fps: int = 0  # 采样帧率，写入bundle供设备按原速播放（0: 设备默认帧率）
 
     def to_converter_args(self) -> List[str]:
         """转换为converter命令行参数
@@ -71,6 +74,24 @@ class RGB565Config:
             args.extend(['--format', 'c_array'])
             if self.array_name:
                 args.extend(['--array-name', self.array_name])
+        elif self.color_format != 'rgb565':
+            args.extend(['--color-format', self.color_format])
+
+        return args
+
+    def to_pack_args(self) -> List[str]:
+        """转换为converter pack命令的附加参数
+
+        Returns:
+            List[str]: 命令行参数列表
+        """
+        args = []
+
+        if self.sprite:
+            args.append('--sprite')
+
+        if self.fps:
+            args.extend(['--fps', str(self.fps)])
 
         return args
 
@@ -517,6 +538,7 @@ class ConverterBridge:
                 "--width", str(config.bundle_width),
                 "--height", str(config.bundle_height)
             ]
+            cmd.extend(config.to_pack_args())
 
             print(f"执行打包命令: {' '.join(cmd)}")
 
@@ -602,6 +624,7 @@ class ConverterBridge:
                 "--width", str(config.bundle_width),
                 "--height", str(config.bundle_height)
             ]
+            cmd.extend(config.to_pack_args())
 
             print(f"执行打包命令: {' '.join(cmd)}")
 
@@ -2,8 +2,8 @@
 # -*- coding: utf-8 -*-
 """
 字体字符提取工具
-自动从 ui_texts.h 和 bird_config.csv 中提取所有需要的字符
-用于生成 LVGL 字体时指定字符范围
+自动从 ui_texts.h 和 bird_config.csv 中提取所有需要的字符,
+并输出生成SD卡字体(/static/fonts/notosanssc_<字号>.bin)的 lv_font_conv 命令
 """
 
 import os
@@ -20,6 +20,14 @@ fixed_chars = [
     '，。？！@#￥%……&*（）——+：',
 ]
 
+# 固件加载的字号(与 src/system/fonts/font_manager.h 中的 FONT_SIZES 一致)
+font_sizes = [12, 16, 18]
+
+# 全量字体的字符范围: ASCII、中文标点、全部常用汉字、全角符号
+full_ranges = ['0x20-0x7E', '0x3000-0x303F', '0x4E00-0x9FA5', '0xFF00-0xFFEF']
+
+font_ttf = 'scripts/uniq_fonts/fonts/NotoSansSC-Medium.ttf'
+
 
 def extract_chinese_from_ui_texts(ui_texts_path):
     """
@@ -80,6 +88,26 @@ def extract_bird_names_from_csv(csv_path):
     return bird_names
 
 
+def print_font_commands(chars_file, project_root):
+    """
+    输出生成SD卡字体的 lv_font_conv 命令(固件只支持 --format bin --no-compress)
+    """
+    chars_path = chars_file.relative_to(project_root).as_posix()
+    ranges = ' '.join(f'-r {r}' for r in full_ranges)
+
+    print("\n🖋️  生成SD卡字体 (需要 Node.js, 生成后复制到SD卡 /static/fonts/):")
+    print("=" * 60)
+    print("全量字体 (推荐, 添加新小鸟无需重新生成):")
+    for size in font_sizes:
+        print(f"  npx lv_font_conv --font {font_ttf} --size {size} --bpp 2 --no-compress --format bin "
+              f"{ranges} -o notosanssc_{size}.bin")
+    print("\n子集字体 (只含上面的字符, 文件更小, 新增字符后需重新生成):")
+    for size in font_sizes:
+        print(f"  npx lv_font_conv --font {font_ttf} --size {size} --bpp 2 --no-compress --format bin "
+              f"--symbols \"$(cat {chars_path})\" -o notosanssc_{size}.bin")
+    print("=" * 60)
+
+
 def get_project_root():
     """
     获取项目根目录（从脚本所在位置向上查找）
@@ -153,6 +181,8 @@ def main():
         f.write(unique_chars)
     print(f"\n💾 字符集已保存到: {output_file}")
     
+    print_font_commands(output_file, project_root)
+
     # 显示示例词汇
     print("\n📝 示例词汇 (前10个):")
     for i, word in enumerate(all_words[:10], 1):
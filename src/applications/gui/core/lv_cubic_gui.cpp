@@ -5,6 +5,8 @@
 #include "Arduino.h"
 #include "SD.h"
 #include "system/logging/log_manager.h"
+#include "system/memory/mem_tracker.h"
+#include "system/fonts/font_manager.h"
 #include "config/version.h"
 #include "config/ui_texts.h"
 
@@ -67,11 +69,11 @@ static void hideLogo()
 	
 	// 释放logo图片内存
 	if (logo_img_data != NULL) {
-		free(logo_img_data);
+		MemTracker::free(logo_img_data);
 		logo_img_data = NULL;
 	}
 	if (logo_img_dsc != NULL) {
-		free(logo_img_dsc);
+		MemTracker::free(logo_img_dsc);
 		logo_img_dsc = NULL;
 		LOG_INFO("GUI", "Logo memory freed");
 	}
@@ -116,7 +118,7 @@ static bool load_logo_from_sd(const char* file_path)
 	uint8_t color_format = header_cf & 0xFF;
 	uint8_t magic = (header_cf >> 24) & 0xFF;
 
-	if (color_format != 0x12) { // LVGL 9.x: LV_COLOR_FORMAT_RGB565 = 0x12
+	if (color_format != LV_COLOR_FORMAT_RGB565 && color_format != LV_COLOR_FORMAT_RGB565_SWAPPED) {
 		LOG_ERROR("GUI", "Invalid color format: 0x" + String(color_format, HEX));
 		file.close();
 		return false;
@@ -129,17 +131,17 @@ static bool load_logo_from_sd(const char* file_path)
 	}
 
 	// 分配内存
-	logo_img_dsc = (lv_image_dsc_t*)malloc(sizeof(lv_image_dsc_t));
+	logo_img_dsc = (lv_image_dsc_t*)MemTracker::alloc(MEM_TAG_LVGL, sizeof(lv_image_dsc_t));
 	if (!logo_img_dsc) {
 		LOG_ERROR("GUI", "Failed to allocate logo descriptor");
 		file.close();
 		return false;
 	}
 
-	logo_img_data = (uint8_t*)malloc(data_size);
+	logo_img_data = (uint8_t*)MemTracker::alloc(MEM_TAG_LVGL, data_size);
 	if (!logo_img_data) {
 		LOG_ERROR("GUI", "Failed to allocate logo data");
-		free(logo_img_dsc);
+		MemTracker::free(logo_img_dsc);
 		logo_img_dsc = NULL;
 		file.close();
 		return false;
@@ -151,8 +153,8 @@ static bool load_logo_from_sd(const char* file_path)
 
 	if (bytes_read != data_size) {
 		LOG_ERROR("GUI", "Failed to read logo data: " + String(bytes_read) + "/" + String(data_size));
-		free(logo_img_dsc);
-		free(logo_img_data);
+		MemTracker::free(logo_img_dsc);
+		MemTracker::free(logo_img_data);
 		logo_img_dsc = NULL;
 		logo_img_data = NULL;
 		return false;
@@ -226,7 +228,10 @@ void lv_init_gui(void)
 		
 		// 设置版本号样式（灰色，不太明显）
 		lv_obj_set_style_text_color(logo_version_label, lv_color_hex(0x808080), LV_PART_MAIN);
-		lv_obj_set_style_text_font(logo_version_label, &lv_font_notosanssc_12, LV_PART_MAIN);
+		// 字体从SD按需读取: 先预读本屏字形, 避免首次绘制时逐字读卡
+		const lv_font_t* version_font = FontManager::getInstance()->getFont(12);
+		FontManager::getInstance()->prefetch(version_font, version_text.c_str());
+		lv_obj_set_style_text_font(logo_version_label, version_font, LV_PART_MAIN);
 		
 		// 位置：底部居中，距离边缘 10 像素
 		lv_obj_align(logo_version_label, LV_ALIGN_BOTTOM_MID, 0, -10);
@@ -1,6 +1,9 @@
 #include "bird_animation.h"
 #include "bird_utils.h"
+#include "frame_cache.h"
+#include "favourite_store.h"
 #include "system/logging/log_manager.h"
+#include "system/memory/mem_tracker.h"
 #include "drivers/storage/sd_card/sd_card.h"
 #include "system/tasks/task_manager.h"
 #include <cstring>
@@ -10,25 +13,41 @@ namespace BirdWatching {
 
 BirdAnimation::BirdAnimation()
     : display_obj_(nullptr)
+    , sprite_obj_(nullptr)
     , current_frame_(0)
     , current_frame_count_(0)
     , play_timer_(nullptr)
     , is_playing_(false)
     , frame_processing_(false)
+    , frame_interval_ms_(BIRD_FRAME_INTERVAL_MS)
     , current_img_dsc_(nullptr)
     , current_img_data_(nullptr)
     , next_img_dsc_(nullptr)
     , next_img_data_(nullptr)
     , next_frame_ready_(false)
+    , bg_img_dsc_(nullptr)
+    , bg_img_data_(nullptr)
+    , bg_origin_x_(0)
+    , bg_origin_y_(0)
+    , current_pos_{0, 0}
+    , next_pos_{0, 0}
     , preload_fail_count_(0)
     , preload_enabled_(true)
     , running_in_ui_task_(false)
+    , bundle_loader_(&loaders_[0])
+    , warm_loader_(&loaders_[1])
+    , warm_step_(0)
+    , warm_done_(false)
+    , warm_enabled_(true)
+    , last_load_warm_(false)
 {
 }
 
 BirdAnimation::~BirdAnimation() {
+    endTransition(nullptr);
     stop();
     releasePreviousFrame();
+    releaseBackground();
 }
 
 bool BirdAnimation::init(lv_obj_t* parent_obj) {
@@ -75,6 +94,9 @@ bool BirdAnimation::init(lv_obj_t* parent_obj) {
         lv_obj_set_pos(display_obj_, 0, 0);
     }
 
+    // 启动时创建帧缓存: 默认预算按此时的空闲堆计算
+    FrameCache::getInstance();
+
     LOG_INFO("ANIM", "Bird animation system initialized");
     return true;
 }
@@ -83,6 +105,9 @@ bool BirdAnimation::loadBird(const BirdInfo& bird_info) {
     // 停止当前动画
     stop();
 
+    // 同一只小鸟且bundle仍打开时直接沿用
+    bool reuse = bundle_loader_->isLoaded() && current_bird_.id == bird_info.id;
+
     // 设置小鸟信息
     current_bird_ = bird_info;
     current_frame_ = 0;
@@ -91,19 +116,130 @@ bool BirdAnimation::loadBird(const BirdInfo& bird_info) {
     char bundle_path[64];
     snprintf(bundle_path, sizeof(bundle_path), "/birds/%d/bundle.bin", bird_info.id);
 
-    // 加载bundle文件（必需，无后备方案）
-    if (!bundle_loader_.loadBundle(bundle_path)) {
+    // 预热过的小鸟: 接管已打开的bundle(头部/扇区映射), 开头几帧已在帧缓存中
+    last_load_warm_ = reuse;
+    if (!reuse && warm_enabled_ && warm_bird_.id == bird_info.id && warm_loader_->isLoaded()) {
+        BirdBundleLoader* loader = bundle_loader_;
+        bundle_loader_ = warm_loader_;
+        warm_loader_ = loader;
+        last_load_warm_ = true;
+    }
+    warm_loader_->close();
+    warm_bird_ = BirdInfo();
+
+    // 加载bundle文件: 优先从flash收藏库映射, 否则从SD读取
+    if (!last_load_warm_ && !bundle_loader_->loadFavourite(bird_info.id) && !bundle_loader_->loadBundle(bundle_path)) {
         LOG_ERROR("ANIM", "Failed to load bundle: " + String(bundle_path));
         return false;
     }
 
     // 从bundle获取帧数
-    current_frame_count_ = bundle_loader_.getFrameCount();
-    LOG_INFO("ANIM", "Bundle loaded: " + String(current_frame_count_) + " frames from " + String(bundle_path));
+    current_frame_count_ = bundle_loader_->getFrameCount();
+    LOG_INFO("ANIM", "Bundle loaded: " + String(current_frame_count_) + " frames from " + String(bundle_path) +
+             (bundle_loader_->isSprite() ? " (sprite)" : "") + (bundle_loader_->isMapped() ? " (flash)" : "") +
+             (last_load_warm_ ? " (warm)" : ""));
+
+    // flash映射的帧不占用堆, 不需要缓存
+    if (bundle_loader_->isMapped()) {
+        FrameCache::getInstance()->endClip();
+        return true;
+    }
+
+    // 整段动画放得进缓存预算时固定在缓存中, 循环播放不再重复读SD
+    uint32_t clip_bytes = (uint32_t)current_frame_count_ * bundle_loader_->estimateFrameBytes();
+    if (bundle_loader_->isSprite()) {
+        clip_bytes += (uint32_t)bundle_loader_->getFrameWidth() * bundle_loader_->getFrameHeight() * 2;
+    }
+    FrameCache::getInstance()->beginClip(bird_info.id, clip_bytes);
 
     return true;
 }
 
+void BirdAnimation::warmBird(const BirdInfo& bird_info) {
+    warm_loader_->close();
+    warm_bird_ = BirdInfo();
+    warm_step_ = 0;
+    warm_done_ = false;
+
+    // 与当前小鸟相同时沿用当前bundle, 不需要预热
+    if (!warm_enabled_ || bird_info.id == 0 || bird_info.id == current_bird_.id) {
+        return;
+    }
+    warm_bird_ = bird_info;
+}
+
+void BirdAnimation::setWarmStart(bool enabled) {
+    warm_enabled_ = enabled;
+    if (!enabled) {
+        warm_loader_->close();
+        warm_bird_ = BirdInfo();
+    }
+}
+
+void BirdAnimation::serviceWarm() {
+    if (!warm_enabled_ || warm_bird_.id == 0 || warm_done_) {
+        return;
+    }
+
+    // 第一步: 打开bundle(读头部, 建立扇区映射)
+    if (!warm_loader_->isLoaded()) {
+        char bundle_path[64];
+        snprintf(bundle_path, sizeof(bundle_path), "/birds/%d/bundle.bin", warm_bird_.id);
+        if (!warm_loader_->loadFavourite(warm_bird_.id) && !warm_loader_->loadBundle(bundle_path)) {
+            warm_done_ = true;
+            return;
+        }
+        // flash中的小鸟映射后即可直接出帧, 不需要预读
+        if (warm_loader_->isMapped()) {
+            warm_done_ = true;
+            return;
+        }
+        FrameCache::getInstance()->beginWarm(warm_bird_.id);
+        return;
+    }
+
+    // 之后每步读一帧到帧缓存: 精灵bundle先读背景
+    bool sprite = warm_loader_->isSprite();
+    uint16_t frames = warm_loader_->getFrameCount() < BIRD_WARM_FRAMES ? warm_loader_->getFrameCount() : BIRD_WARM_FRAMES;
+    if (warm_step_ >= frames + (sprite ? 1 : 0)) {
+        warm_done_ = true;
+        LOG_INFO("ANIM", "Bird " + String(warm_bird_.id) + " warmed: " + String(warm_step_) + " images cached");
+        return;
+    }
+
+    uint16_t frame = sprite ? (warm_step_ == 0 ? FRAME_CACHE_BACKGROUND : warm_step_ - 1) : warm_step_;
+    FrameCache* cache = FrameCache::getInstance();
+    if (!cache->contains(warm_bird_.id, frame)) {
+        uint32_t frame_bytes = frame == FRAME_CACHE_BACKGROUND
+            ? (uint32_t)warm_loader_->getFrameWidth() * warm_loader_->getFrameHeight() * 2
+            : warm_loader_->estimateFrameBytes();
+        // 预热只用富余内存, 不为它淘汰缓存
+        if (ESP.getMaxAllocHeap() < frame_bytes + FRAME_CACHE_HEAP_RESERVE) {
+            warm_done_ = true;
+            return;
+        }
+
+        lv_image_dsc_t* img_dsc = nullptr;
+        uint8_t* img_data = nullptr;
+        FramePlacement pos = {0, 0};
+        bool ok = frame == FRAME_CACHE_BACKGROUND ? warm_loader_->loadBackground(&img_dsc, &img_data)
+                                                  : warm_loader_->loadFrame(frame, &img_dsc, &img_data, &pos);
+        uint32_t sd_bytes = frame == FRAME_CACHE_BACKGROUND ? warm_loader_->getBackgroundFileSize()
+                                                            : warm_loader_->getFrameFileSize(frame);
+        if (!ok || !cache->insert(warm_bird_.id, frame, img_dsc, pos, sd_bytes)) {
+            if (ok) {
+                MemTracker::free(img_data);
+                MemTracker::free(img_dsc);
+            }
+            warm_done_ = true;
+            return;
+        }
+        // 预热的帧不在屏幕上, 立即归还引用
+        cache->release(img_dsc);
+    }
+    warm_step_++;
+}
+
 void BirdAnimation::startLoop() {
     if (is_playing_) {
         stop();
@@ -126,6 +262,12 @@ void BirdAnimation::startLoop() {
     preload_fail_count_ = 0;
     preload_enabled_ = true;  // 25MHz SD卡：启用预加载优化
 
+    // 精灵bundle先显示背景, 之后每帧只更新精灵
+    if (bundle_loader_->isSprite() && !showBackground()) {
+        LOG_ERROR("ANIM", "Failed to load background");
+        return;
+    }
+
     // 加载并显示第一帧
     if (!loadAndShowFrame(0)) {
         LOG_ERROR("ANIM", "Failed to load first frame");
@@ -145,7 +287,7 @@ void BirdAnimation::startLoop() {
         return;
     }
 
-    LOG_INFO("ANIM", "Animation started at 20 FPS (50ms/frame) with 25MHz SD card");
+    LOG_INFO("ANIM", "Animation started, first frame " + String(getFrameDuration(0)) + "ms");
 }
 
 void BirdAnimation::stop() {
@@ -158,18 +300,78 @@ void BirdAnimation::stop() {
     current_frame_ = 0;
     last_frame_time_ = 0;
 
+    // 清除显示内容(先解除引用再释放图像内存); 换鸟过渡中继续显示过渡缓冲区
+    if (display_obj_) {
+        lv_image_set_src(display_obj_, transition_.isActive() ? transition_.getImage() : nullptr);  // LVGL 9.x: lv_img_set_src → lv_image_set_src
+    }
+    if (sprite_obj_) {
+        lv_image_set_src(sprite_obj_, nullptr);
+        lv_obj_add_flag(sprite_obj_, LV_OBJ_FLAG_HIDDEN);
+    }
+
     // 释放图像内存
     releasePreviousFrame();
+    releaseBackground();
 
-    // 清除显示内容
-    if (display_obj_) {
-        lv_image_set_src(display_obj_, nullptr);  // LVGL 9.x: lv_img_set_src → lv_image_set_src
+    LOG_INFO("ANIM", "Animation stopped");
+}
+
+void BirdAnimation::beginTransition() {
+    if (!display_obj_) {
+        return;
     }
 
-    LOG_INFO("ANIM", "Animation stopped");
+    // 上一次过渡还没结束: 屏幕上就是过渡缓冲区, 从它重新开始淡化
+    if (transition_.isActive()) {
+        transition_.restart();
+        return;
+    }
+
+    // 精灵bundle: 背景叠加当前精灵作为退出画面
+    const lv_image_dsc_t* base = bg_img_dsc_ ? bg_img_dsc_ : current_img_dsc_;
+    const lv_image_dsc_t* sprite = bg_img_dsc_ ? current_img_dsc_ : nullptr;
+    if (!base) {
+        return;
+    }
+
+    FrameCache::getInstance()->makeRoom((uint32_t)base->header.w * base->header.h * 2);
+    if (!transition_.begin(base, sprite, current_pos_)) {
+        return;
+    }
+
+    // 尺寸与原画面相同, 缩放和位置不变, 只换图像源
+    lv_image_set_src(display_obj_, transition_.getImage());
+    if (sprite_obj_) {
+        lv_image_set_src(sprite_obj_, nullptr);
+        lv_obj_add_flag(sprite_obj_, LV_OBJ_FLAG_HIDDEN);
+    }
+}
+
+void BirdAnimation::cancelTransition() {
+    endTransition(nullptr);
+}
+
+void BirdAnimation::advanceTransition(const lv_image_dsc_t* target) {
+    if (transition_.isCompatible(target) && !transition_.step(target)) {
+        lv_obj_invalidate(display_obj_);
+        return;
+    }
+    endTransition(target);
+}
+
+void BirdAnimation::endTransition(const lv_image_dsc_t* target) {
+    if (!transition_.isActive()) {
+        return;
+    }
+    if (display_obj_) {
+        lv_image_set_src(display_obj_, target);
+        lv_obj_invalidate(display_obj_);
+    }
+    transition_.end();
 }
 
 void BirdAnimation::setDisplayObject(lv_obj_t* obj) {
+    endTransition(nullptr);
     if (is_playing_) {
         stop();
     }
@@ -183,6 +385,14 @@ std::string BirdAnimation::getFramePath(uint16_t frame_index) const {
     return std::string(path);
 }
 
+uint32_t BirdAnimation::getFrameDuration(uint16_t frame_index) const {
+    uint32_t duration = bundle_loader_->getFrameDuration(frame_index);
+    if (duration == 0) {
+        return frame_interval_ms_;
+    }
+    return duration * frame_interval_ms_ / BIRD_FRAME_INTERVAL_MS;
+}
+
 bool BirdAnimation::loadAndShowFrame(uint16_t frame_index) {
     if (!display_obj_) {
         LOG_ERROR("ANIM", "Display object not set");
@@ -201,7 +411,7 @@ bool BirdAnimation::loadAndShowFrame(uint16_t frame_index) {
     lv_image_dsc_t* img_dsc = nullptr;
     uint8_t* img_data = nullptr;
 
-    if (!bundle_loader_.loadFrame(frame_index, &img_dsc, &img_data)) {
+    if (!fetchFrame(frame_index, &img_dsc, &img_data, &current_pos_)) {
         LOG_ERROR("ANIM", "Failed to load frame " + String(frame_index) + " from bundle");
         return false;
     }
@@ -215,18 +425,43 @@ bool BirdAnimation::loadAndShowFrame(uint16_t frame_index) {
     current_img_dsc_ = img_dsc;
     current_img_data_ = img_data;
 
+    showFrame(img_dsc, current_pos_);
+
+    return true;
+}
+
+void BirdAnimation::showFrame(lv_image_dsc_t* img_dsc, const FramePlacement& pos) {
+    if (sprite_obj_ && bg_img_dsc_) {
+        // 精灵模式: 背景不动, 只更新精灵对象, LVGL只重绘精灵新旧包围盒
+        lv_image_set_src(sprite_obj_, img_dsc);
+        lv_img_set_pivot(sprite_obj_, 0, 0);
+        lv_img_set_zoom(sprite_obj_, BIRD_IMAGE_ZOOM);
+        lv_obj_set_pos(sprite_obj_,
+                       bg_origin_x_ + pos.x * BIRD_IMAGE_ZOOM / 256,
+                       bg_origin_y_ + pos.y * BIRD_IMAGE_ZOOM / 256);
+        lv_obj_clear_flag(sprite_obj_, LV_OBJ_FLAG_HIDDEN);
+        return;
+    }
+
+    // 换鸟过渡中: 显示对象继续显示过渡缓冲区, 新小鸟的第一帧立即混合一步,
+    // 之后由定时器每个周期朝当前帧混合一步; 画面不兼容时直接切换
+    if (transition_.isActive()) {
+        if (transition_.getStep() == 0) {
+            advanceTransition(img_dsc);
+        } else if (!transition_.isCompatible(img_dsc)) {
+            endTransition(img_dsc);
+        }
+        if (transition_.isActive()) {
+            return;
+        }
+    }
+
     // 设置图像源
     lv_image_set_src(display_obj_, img_dsc);
 
-    // 计算缩放比例 - canvas是240x240，图像是120x120，需要2倍缩放
-    // LVGL缩放：256 = 1.0x, 512 = 2.0x
-    uint16_t zoom_factor = 512; // 2.0x缩放
-
-    // 设置缩放中心点为图像中心
+    // canvas是240x240，图像是120x120，需要2倍缩放; 缩放中心点为图像中心
     lv_img_set_pivot(display_obj_, img_dsc->header.w / 2, img_dsc->header.h / 2);
-
-    // 应用缩放
-    lv_img_set_zoom(display_obj_, zoom_factor);
+    lv_img_set_zoom(display_obj_, BIRD_IMAGE_ZOOM);
 
     // 设置图像位置到canvas中心
     lv_obj_center(display_obj_);
@@ -236,10 +471,103 @@ bool BirdAnimation::loadAndShowFrame(uint16_t frame_index) {
 
     // 强制刷新LVGL显示
     lv_obj_invalidate(display_obj_);
+}
+
+bool BirdAnimation::showBackground() {
+    releaseBackground();
+
+    lv_image_dsc_t* img_dsc = nullptr;
+    uint8_t* img_data = nullptr;
+    if (!fetchFrame(FRAME_CACHE_BACKGROUND, &img_dsc, &img_data)) {
+        return false;
+    }
+
+    // 精灵对象紧贴在背景对象之上
+    if (!sprite_obj_) {
+        sprite_obj_ = lv_image_create(lv_obj_get_parent(display_obj_));
+        if (!sprite_obj_) {
+            releaseFrame(img_dsc, img_data);
+            return false;
+        }
+        lv_obj_move_to_index(sprite_obj_, lv_obj_get_index(display_obj_) + 1);
+    }
+    lv_obj_add_flag(sprite_obj_, LV_OBJ_FLAG_HIDDEN);
+
+    // 背景按普通帧方式居中放大显示, 之后不再更新
+    showFrame(img_dsc, current_pos_);
+    bg_img_dsc_ = img_dsc;
+    bg_img_data_ = img_data;
+
+    // 放大后背景左上角 = 对象位置 - 以中心为轴缩放带来的外扩
+    lv_obj_update_layout(display_obj_);
+    int32_t w = img_dsc->header.w;
+    int32_t h = img_dsc->header.h;
+    bg_origin_x_ = lv_obj_get_x(display_obj_) - (w * BIRD_IMAGE_ZOOM / 256 - w) / 2;
+    bg_origin_y_ = lv_obj_get_y(display_obj_) - (h * BIRD_IMAGE_ZOOM / 256 - h) / 2;
 
     return true;
 }
 
+void BirdAnimation::releaseBackground() {
+    releaseFrame(bg_img_dsc_, bg_img_data_);
+    bg_img_dsc_ = nullptr;
+    bg_img_data_ = nullptr;
+}
+
+bool BirdAnimation::fetchFrame(uint16_t frame_index, lv_image_dsc_t** out_dsc, uint8_t** out_data,
+                               FramePlacement* out_pos) {
+    // flash映射的帧直接指向flash: 不查缓存、不腾内存、不进缓存
+    FrameCache* cache = FrameCache::getInstance();
+    bool mapped = bundle_loader_->isMapped();
+    if (!mapped && cache->lookup(current_bird_.id, frame_index, out_dsc, out_pos)) {
+        *out_data = const_cast<uint8_t*>((*out_dsc)->data);
+        return true;
+    }
+
+    // 内存紧张时缓存先让出空间
+    bool background = frame_index == FRAME_CACHE_BACKGROUND;
+    uint32_t frame_bytes = bundle_loader_->estimateFrameBytes();
+    if (background) {
+        frame_bytes = (uint32_t)bundle_loader_->getFrameWidth() * bundle_loader_->getFrameHeight() * 2;
+    }
+    if (!mapped) {
+        cache->makeRoom(frame_bytes);
+    }
+
+    FramePlacement pos = {0, 0};
+    bool ok = background ? bundle_loader_->loadBackground(out_dsc, out_data)
+                         : bundle_loader_->loadFrame(frame_index, out_dsc, out_data, &pos);
+    if (!ok) {
+        return false;
+    }
+    if (out_pos) {
+        *out_pos = pos;
+    }
+
+    if (!mapped) {
+        uint32_t sd_bytes = background ? bundle_loader_->getBackgroundFileSize() : bundle_loader_->getFrameFileSize(frame_index);
+        cache->insert(current_bird_.id, frame_index, *out_dsc, pos, sd_bytes);
+    }
+    return true;
+}
+
+void BirdAnimation::releaseFrame(lv_image_dsc_t* img_dsc, uint8_t* img_data) {
+    if (FrameCache::getInstance()->release(img_dsc)) {
+        return;
+    }
+    // flash映射的帧只归还描述符
+    if (loaders_[0].releaseMappedFrame(img_dsc) || loaders_[1].releaseMappedFrame(img_dsc)) {
+        return;
+    }
+
+    if (img_data) {
+        MemTracker::free(img_data);
+    }
+    if (img_dsc) {
+        MemTracker::free(img_dsc);
+    }
+}
+
 void BirdAnimation::playNextFrame() {
     if (!is_playing_ || frame_processing_ || !display_obj_) {
         return;
@@ -248,18 +576,23 @@ void BirdAnimation::playNextFrame() {
     // 检查是否到了播放下一帧的时间
     // 25MHz SD卡速度：~1.5MB/s，每帧加载~18ms
     // 加上vTaskDelay(1)的10ms，总计约30ms，可以支持30+ FPS
+    // 换鸟交叉淡化: 每个定时器周期混合一步(精灵bundle混合到背景, 精灵直接叠加在上面)
+    if (transition_.isActive()) {
+        advanceTransition(bg_img_dsc_ ? bg_img_dsc_ : current_img_dsc_);
+    }
+
     uint32_t now = millis();
-    const uint32_t FRAME_INTERVAL_MS = 66; // 15 FPS - 平衡流畅度和看门狗安全
+    const uint32_t FRAME_INTERVAL_MS = getFrameDuration(current_frame_);
     
     if (now - last_frame_time_ < FRAME_INTERVAL_MS) {
         // 利用空闲时间预加载下一帧（25MHz SD卡足够快）
-        if (preload_enabled_ && !next_frame_ready_) {
-            uint16_t next_frame = (current_frame_ + 1) % current_frame_count_;
+        uint16_t next_frame = (current_frame_ + 1) % current_frame_count_;
+        if (preload_enabled_ && !next_frame_ready_ && !bundle_loader_->isSameFrameData(current_frame_, next_frame)) {
             
             // 检查剩余时间是否足够预加载（至少需要20ms）
             uint32_t time_left = FRAME_INTERVAL_MS - (now - last_frame_time_);
             if (time_left >= 20) {
-                bool success = preloadFrameToBuffer(next_frame, &next_img_dsc_, &next_img_data_);
+                bool success = preloadFrameToBuffer(next_frame, &next_img_dsc_, &next_img_data_, &next_pos_);
                 if (success && next_img_dsc_ && next_img_data_) {
                     next_frame_ready_ = true;
                     preload_fail_count_ = 0;
@@ -271,53 +604,60 @@ void BirdAnimation::playNextFrame() {
                     }
                 }
             }
+        } else if (FRAME_INTERVAL_MS - (now - last_frame_time_) >= 20) {
+            // 下一帧已就绪(或无需预加载)时, 用剩余时间预热下一只小鸟, 预热完成后同步flash收藏库
+            if (warm_enabled_ && warm_bird_.id != 0 && !warm_done_) {
+                serviceWarm();
+            } else {
+                FavouriteStore::getInstance()->service(FRAME_INTERVAL_MS - (now - last_frame_time_));
+            }
         }
         return;
     }
 
-    // 标记开始处理帧
-    frame_processing_ = true;
-    uint32_t frame_start = millis();
-
+    uint16_t prev_frame = current_frame_;
     current_frame_++;
     if (current_frame_ >= current_frame_count_) {
         current_frame_ = 0;
     }
 
+    // 与上一帧是同一份数据(别名): 不读SD也不刷新, 只继续保持画面
+    if (bundle_loader_->isSameFrameData(prev_frame, current_frame_)) {
+        last_frame_time_ = now;
+        return;
+    }
+
+    // 标记开始处理帧
+    frame_processing_ = true;
+    uint32_t frame_start = millis();
+
     // 如果下一帧已预加载，直接使用（双缓冲）
     if (next_frame_ready_ && next_img_dsc_ && next_img_data_) {
         // 释放当前帧
-        if (current_img_data_) free(current_img_data_);
-        if (current_img_dsc_) free(current_img_dsc_);
+        releaseFrame(current_img_dsc_, current_img_data_);
         
         // 交换缓冲区
         current_img_dsc_ = next_img_dsc_;
         current_img_data_ = next_img_data_;
+        current_pos_ = next_pos_;
         next_img_dsc_ = nullptr;
         next_img_data_ = nullptr;
         next_frame_ready_ = false;
         
         // 显示预加载的帧
-        lv_image_set_src(display_obj_, current_img_dsc_);
-        
-        if (current_img_dsc_) {
-            lv_img_set_pivot(display_obj_, current_img_dsc_->header.w / 2, current_img_dsc_->header.h / 2);
-            lv_img_set_zoom(display_obj_, 512); // 2.0x
-            lv_obj_center(display_obj_);
-            lv_obj_clear_flag(display_obj_, LV_OBJ_FLAG_HIDDEN);
-        }
+        showFrame(current_img_dsc_, current_pos_);
         
         // 让出CPU给看门狗任务，防止触发看门狗超时
         vTaskDelay(1); // 延迟1个tick (~10ms)
     } else {
         // 预加载失败或未启用，实时加载
-        if (next_img_data_) free(next_img_data_);
-        if (next_img_dsc_) free(next_img_dsc_);
+        releaseFrame(next_img_dsc_, next_img_data_);
         next_img_data_ = nullptr;
         next_img_dsc_ = nullptr;
         next_frame_ready_ = false;
         
         if (!loadAndShowFrame(current_frame_)) {
+            endTransition(nullptr);
             stop();
             frame_processing_ = false;
             return;
@@ -371,7 +711,7 @@ bool BirdAnimation::tryManualImageLoad(const std::string& file_path) {
     uint8_t color_format = header_cf & 0xFF;
     uint8_t magic = (header_cf >> 24) & 0xFF;
 
-    if (color_format != 0x12) { // LVGL 9.x: LV_COLOR_FORMAT_RGB565 = 0x12
+    if (color_format != LV_COLOR_FORMAT_RGB565 && color_format != LV_COLOR_FORMAT_RGB565_SWAPPED) {
         LOG_ERROR("BIRD", "Invalid color format: 0x" + String(color_format, HEX));
         file.close();
         return false;
@@ -400,17 +740,17 @@ bool BirdAnimation::tryManualImageLoad(const std::string& file_path) {
     }
 
     // 分配内存
-    lv_image_dsc_t* img_dsc = static_cast<lv_image_dsc_t*>(malloc(sizeof(lv_image_dsc_t)));
+    lv_image_dsc_t* img_dsc = static_cast<lv_image_dsc_t*>(MemTracker::alloc(MEM_TAG_ANIMATION, sizeof(lv_image_dsc_t)));
     if (!img_dsc) {
         LOG_ERROR("BIRD", "Failed to allocate descriptor");
         file.close();
         return false;
     }
 
-    uint8_t* img_data = static_cast<uint8_t*>(malloc(data_size));
+    uint8_t* img_data = static_cast<uint8_t*>(MemTracker::alloc(MEM_TAG_ANIMATION, data_size));
     if (!img_data) {
         LOG_ERROR("BIRD", "Failed to allocate image data");
-        free(img_dsc);
+        MemTracker::free(img_dsc);
         file.close();
         return false;
     }
@@ -431,14 +771,14 @@ bool BirdAnimation::tryManualImageLoad(const std::string& file_path) {
 
     if (bytes_read != data_size) {
         LOG_ERROR("BIRD", "Failed to read pixel data: " + String(bytes_read) + "/" + String(data_size));
-        free(img_dsc);
-        free(img_data);
+        MemTracker::free(img_dsc);
+        MemTracker::free(img_data);
         return false;
     }
 
     // 设置LVGL图像描述符 - LVGL 9.x格式
     img_dsc->header.magic = LV_IMAGE_HEADER_MAGIC;
-    img_dsc->header.cf = color_format;  // 0x12 for RGB565
+    img_dsc->header.cf = color_format;  // RGB565 或 RGB565_SWAPPED
     img_dsc->header.flags = 0;
     img_dsc->header.w = width;
     img_dsc->header.h = height;
@@ -484,27 +824,15 @@ bool BirdAnimation::tryManualImageLoad(const std::string& file_path) {
 }
 
 void BirdAnimation::releasePreviousFrame() {
-    // 释放前一帧的内存
-    if (current_img_data_) {
-        free(current_img_data_);
-        current_img_data_ = nullptr;
-    }
+    // 释放前一帧的内存(缓存中的帧只归还引用)
+    releaseFrame(current_img_dsc_, current_img_data_);
+    current_img_dsc_ = nullptr;
+    current_img_data_ = nullptr;
 
-    if (current_img_dsc_) {
-        free(current_img_dsc_);
-        current_img_dsc_ = nullptr;
-    }
-    
     // 释放预加载缓冲区
-    if (next_img_data_) {
-        free(next_img_data_);
-        next_img_data_ = nullptr;
-    }
-
-    if (next_img_dsc_) {
-        free(next_img_dsc_);
-        next_img_dsc_ = nullptr;
-    }
+    releaseFrame(next_img_dsc_, next_img_data_);
+    next_img_dsc_ = nullptr;
+    next_img_data_ = nullptr;
     
     next_frame_ready_ = false;
 }
@@ -519,13 +847,13 @@ void BirdAnimation::createTestImage() {
     releasePreviousFrame();
 
     // 分配内存
-    lv_image_dsc_t* img_dsc = static_cast<lv_image_dsc_t*>(malloc(sizeof(lv_image_dsc_t)));
-    uint8_t* img_data = static_cast<uint8_t*>(malloc(data_size));
+    lv_image_dsc_t* img_dsc = static_cast<lv_image_dsc_t*>(MemTracker::alloc(MEM_TAG_ANIMATION, sizeof(lv_image_dsc_t)));
+    uint8_t* img_data = static_cast<uint8_t*>(MemTracker::alloc(MEM_TAG_ANIMATION, data_size));
 
     if (!img_dsc || !img_data) {
         LOG_ERROR("BIRD", "Failed to allocate test image");
-        if (img_dsc) free(img_dsc);
-        if (img_data) free(img_data);
+        if (img_dsc) MemTracker::free(img_dsc);
+        if (img_data) MemTracker::free(img_data);
         return;
     }
 
@@ -569,7 +897,8 @@ void BirdAnimation::timerCallback(lv_timer_t* timer) {
     animation->playNextFrame();
 }
 
-bool BirdAnimation::preloadFrameToBuffer(uint16_t frame_index, lv_image_dsc_t** out_dsc, uint8_t** out_data) {
+bool BirdAnimation::preloadFrameToBuffer(uint16_t frame_index, lv_image_dsc_t** out_dsc, uint8_t** out_data,
+                                         FramePlacement* out_pos) {
     if (!out_dsc || !out_data) {
         LOG_ERROR("ANIM", "Invalid output parameters for preload");
         return false;
@@ -579,8 +908,8 @@ bool BirdAnimation::preloadFrameToBuffer(uint16_t frame_index, lv_image_dsc_t**
         return false;
     }
 
-    // 使用bundle loader加载帧
-    return bundle_loader_.loadFrame(frame_index, out_dsc, out_data);
+    // 先查帧缓存, 未命中时用bundle loader加载
+    return fetchFrame(frame_index, out_dsc, out_data, out_pos);
 }
 
 } // namespace BirdWatching
\ No newline at end of file
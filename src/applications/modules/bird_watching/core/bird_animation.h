@@ -3,8 +3,18 @@
 
 #include "bird_types.h"
 #include "bird_bundle_loader.h"
+#include "bird_transition.h"
 #include <string>
 
+// 默认帧间隔: 15 FPS - 平衡流畅度和看门狗安全
+#define BIRD_FRAME_INTERVAL_MS 66
+
+// 120x120帧放大到240x240屏幕 (LVGL缩放: 256 = 1.0x)
+#define BIRD_IMAGE_ZOOM 512
+
+// 预热下一只小鸟时读入缓存的开头帧数(精灵bundle另加背景)
+#define BIRD_WARM_FRAMES 2
+
 namespace BirdWatching {
 
 class BirdAnimation {
@@ -27,14 +37,35 @@ public:
     // 检查是否正在播放
     bool isPlaying() const { return is_playing_; }
 
+    // 设置帧间隔(环境光较暗时降低帧率)
+    void setFrameInterval(uint32_t interval_ms) { frame_interval_ms_ = interval_ms; }
+    uint32_t getFrameInterval() const { return frame_interval_ms_; }
+
     // 获取当前小鸟信息
     const BirdInfo& getCurrentBird() const { return current_bird_; }
 
+    // 预热下一只小鸟: 播放空闲时分步打开其bundle并把开头几帧读入帧缓存,
+    // 之后loadBird同一只小鸟时直接接管(在UI任务中调用)
+    void warmBird(const BirdInfo& bird_info);
+    void setWarmStart(bool enabled);
+    bool isWarmStartEnabled() const { return warm_enabled_; }
+
+    // 上一次loadBird是否命中预热(或沿用已打开的bundle)
+    bool wasLastLoadWarm() const { return last_load_warm_; }
+
+    // 换鸟前调用(在stop之前): 保留当前画面, 新小鸟开始播放后交叉淡化过去
+    void beginTransition();
+    // 新小鸟没能播放时放弃过渡并清空显示
+    void cancelTransition();
+    void setFadeSteps(uint8_t steps) { transition_.setSteps(steps); }
+    uint8_t getFadeSteps() const { return transition_.getSteps(); }
+
     // 设置显示对象
     void setDisplayObject(lv_obj_t* obj);
 
 private:
-    lv_obj_t* display_obj_;      // LVGL显示对象
+    lv_obj_t* display_obj_;      // LVGL显示对象(精灵bundle时显示背景)
+    lv_obj_t* sprite_obj_;       // 精灵bundle的小鸟对象(叠加在背景上)
     BirdInfo current_bird_;      // 当前小鸟信息
     uint16_t current_frame_;     // 当前帧（支持最多65535帧）
     uint16_t current_frame_count_; // 当前小鸟的实际帧数（支持最多65535帧）
@@ -42,6 +73,7 @@ private:
     bool is_playing_;            // 播放状态
     bool frame_processing_;      // 当前是否正在处理帧
     uint32_t last_frame_time_;   // 上一帧处理完成的时间
+    uint32_t frame_interval_ms_; // 帧间隔
 
     // 内存管理
     lv_image_dsc_t* current_img_dsc_; // 当前图像描述符 (LVGL 9.x: lv_img_dsc_t → lv_image_dsc_t)
@@ -51,6 +83,14 @@ private:
     lv_image_dsc_t* next_img_dsc_;  // 下一帧图像描述符
     uint8_t* next_img_data_;        // 下一帧图像数据
     bool next_frame_ready_;         // 下一帧是否已准备好
+
+    // 精灵bundle: 背景只加载一次, 每帧只更新精灵
+    lv_image_dsc_t* bg_img_dsc_;
+    uint8_t* bg_img_data_;
+    int32_t bg_origin_x_;           // 放大后背景左上角在父对象中的位置
+    int32_t bg_origin_y_;
+    FramePlacement current_pos_;    // 当前/下一帧精灵位置
+    FramePlacement next_pos_;
     
     // 预加载统计（用于自适应优化）
     uint8_t preload_fail_count_;    // 连续预加载失败次数
@@ -59,6 +99,21 @@ private:
     // 释放前一帧的内存
     void releasePreviousFrame();
 
+    // 取得一帧: 先查帧缓存, 未命中时从bundle加载并尝试放入缓存
+    // (frame_index为FRAME_CACHE_BACKGROUND时加载精灵bundle的背景)
+    bool fetchFrame(uint16_t frame_index, lv_image_dsc_t** out_dsc, uint8_t** out_data,
+                    FramePlacement* out_pos = nullptr);
+
+    // 归还一帧: 缓存中的帧只减少引用, 其他直接释放
+    void releaseFrame(lv_image_dsc_t* img_dsc, uint8_t* img_data);
+
+    // 加载并显示精灵bundle的背景
+    bool showBackground();
+    void releaseBackground();
+
+    // 把帧设置到显示对象(精灵bundle时设置到精灵对象并定位)
+    void showFrame(lv_image_dsc_t* img_dsc, const FramePlacement& pos);
+
     // 创建测试图像（调试用）
     void createTestImage();
 
@@ -68,12 +123,35 @@ private:
     // 标志：是否在UI任务中运行
     bool running_in_ui_task_;
 
-    // Bundle加载器
-    BirdBundleLoader bundle_loader_;
+    // Bundle加载器: 一个用于当前播放, 另一个用于预热下一只小鸟, 命中时交换
+    BirdBundleLoader loaders_[2];
+    BirdBundleLoader* bundle_loader_;
+    BirdBundleLoader* warm_loader_;
+
+    // 预热状态
+    BirdInfo warm_bird_;            // id为0表示没有预热目标
+    uint16_t warm_step_;            // 已完成的预热步数(精灵bundle第0步为背景)
+    bool warm_done_;
+    bool warm_enabled_;
+    bool last_load_warm_;
+
+    // 播放空闲时执行一步预热(打开bundle或读一帧)
+    void serviceWarm();
+
+    // 换鸟交叉淡化: 过渡期间显示对象显示过渡缓冲区
+    BirdTransition transition_;
+
+    // 朝target混合一步, 完成或不兼容时结束过渡
+    void advanceTransition(const lv_image_dsc_t* target);
+    // 结束过渡: 显示对象切到target(可为空)后释放缓冲区
+    void endTransition(const lv_image_dsc_t* target);
 
     // 获取帧文件路径
     std::string getFramePath(uint16_t frame_index) const;
 
+    // 帧显示时长: bundle中的时长/帧率, 按当前显示模式的帧间隔等比放慢
+    uint32_t getFrameDuration(uint16_t frame_index) const;
+
     // 加载并显示指定帧
     bool loadAndShowFrame(uint16_t frame_index);
 
@@ -87,7 +165,8 @@ private:
     bool tryManualImageLoad(const std::string& file_path);
 
     // 预加载图像到缓冲区
-    bool preloadFrameToBuffer(uint16_t frame_index, lv_image_dsc_t** out_dsc, uint8_t** out_data);
+    bool preloadFrameToBuffer(uint16_t frame_index, lv_image_dsc_t** out_dsc, uint8_t** out_data,
+                              FramePlacement* out_pos = nullptr);
     
     // 交换当前帧和下一帧缓冲区
     void swapBuffers();
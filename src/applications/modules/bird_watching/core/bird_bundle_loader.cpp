@@ -1,15 +1,99 @@
 #include "bird_bundle_loader.h"
 #include "system/logging/log_manager.h"
+#include "system/memory/mem_tracker.h"
+#include "drivers/display/display.h"
+#include "drivers/storage/sd_card/sd_card.h"
+#include "favourite_store.h"
+#include <fcntl.h>
+#include <unistd.h>
+#include "ff.h"
+#include "diskio.h"
 
 namespace BirdWatching {
 
 // Bundle文件魔数: "BIRD"
 constexpr uint32_t BUNDLE_MAGIC = 0x42495244;
-constexpr uint16_t BUNDLE_VERSION = 1;
+constexpr uint16_t BUNDLE_VERSION = 2;
 constexpr uint8_t RGB565_COLOR_FORMAT = 0x12;
+constexpr uint8_t RGB565_SWAPPED_COLOR_FORMAT = 0x1B;
+constexpr uint8_t I4_COLOR_FORMAT = 0x09;
+constexpr uint8_t I8_COLOR_FORMAT = 0x0A;
+constexpr uint8_t RGB565A8_COLOR_FORMAT = 0x14;
+
+// 索引色帧展开后的输出格式
+constexpr uint8_t INDEXED_OUTPUT_FORMAT = LCD_NATIVE_BYTE_ORDER ? RGB565_SWAPPED_COLOR_FORMAT : RGB565_COLOR_FORMAT;
+
+// invalidateExtentMaps()计数, 与各加载器建立映射时记录的值比较
+static volatile uint32_t s_extent_generation = 0;
+
+// FatFs卷锁: ESP-IDF以FF_FS_REENTRANT编译FatFs, 经VFS的读写(日志、IMU录制等)都在这把锁内访问卡。
+// 绕过FatFs直接disk_read时同样持有它, 不与其他任务的SD事务交错
+static bool lockVolume(FATFS* fs) {
+#if FF_FS_REENTRANT
+#if FF_DEFINED < 86000
+    return ff_mutex_take(fs->ldrv);     // R0.15起按逻辑驱动器加锁
+#else
+    return ff_req_grant(fs->sobj);
+#endif
+#else
+    (void)fs;
+    return true;
+#endif
+}
+
+static void unlockVolume(FATFS* fs) {
+#if FF_FS_REENTRANT
+#if FF_DEFINED < 86000
+    ff_mutex_give(fs->ldrv);
+#else
+    ff_rel_grant(fs->sobj);
+#endif
+#else
+    (void)fs;
+#endif
+}
+
+static bool isIndexedColorFormat(uint8_t cf) {
+    return cf == I8_COLOR_FORMAT || cf == I4_COLOR_FORMAT;
+}
+
+static bool isSupportedColorFormat(uint8_t cf) {
+    return cf == RGB565_COLOR_FORMAT || cf == RGB565_SWAPPED_COLOR_FORMAT || isIndexedColorFormat(cf);
+}
+
+static uint16_t paletteEntries(uint8_t cf) {
+    return cf == I8_COLOR_FORMAT ? 256 : 16;
+}
+
+static uint32_t indexedStride(uint8_t cf, uint16_t width) {
+    return cf == I8_COLOR_FORMAT ? width : (width + 1) / 2;
+}
+
+// 1位掩码(每行mask_stride字节, 高位在前)展开为A8
+static void expandMaskA1(const uint8_t* mask, uint32_t mask_stride, uint16_t width, uint16_t rows, uint8_t* alpha) {
+    for (uint16_t r = 0; r < rows; r++) {
+        const uint8_t* src = mask + r * mask_stride;
+        for (uint16_t x = 0; x < width; x++) {
+            *alpha++ = (src[x >> 3] & (0x80 >> (x & 7))) ? 0xFF : 0x00;
+        }
+    }
+}
 
 BirdBundleLoader::BirdBundleLoader()
     : is_loaded_(false)
+    , frame_stride_(0)
+    , fd_(-1)
+    , index_use_counter_(0)
+    , extent_count_(0)
+    , pdrv_(0)
+    , fs_(nullptr)
+    , extent_generation_(0)
+    , raw_reads_(true)
+    , mapped_(nullptr)
+    , mapped_size_(0)
+    , mapped_bird_(0)
+    , mapped_dsc_used_(0)
+    , palette_valid_(false)
 {
 }
 
@@ -44,29 +128,114 @@ bool BirdBundleLoader::loadBundle(const std::string& bundle_path) {
         return false;
     }
 
-    // 读取Frame Index表
-    index_table_.resize(header_.frame_count);
-    file.seek(header_.index_offset);
+    file.close();
 
-    size_t index_size = header_.frame_count * sizeof(FrameIndexEntry);
-    bytes_read = file.read((uint8_t*)index_table_.data(), index_size);
+    // 帧寻址: 等步长bundle计算偏移, 其他bundle的索引在读帧时按块分页读取
+    setupFrameAddressing();
+    uint32_t align = header_.payload_align;
 
-    if (bytes_read != index_size) {
-        LOG_ERROR("BUNDLE", "Failed to read frame index table");
-        file.close();
+    is_loaded_ = true;
+
+    // 对齐的RGB565 bundle: 打开常驻POSIX句柄用于整扇区直读, 失败时退回File逐帧读取
+    if ((header_.flags & BUNDLE_FLAG_ALIGNED) && !isIndexed() && !isSprite() &&
+        align >= 512 && (align & (align - 1)) == 0) {
+        std::string posix_path = std::string(SD_MOUNT_POINT) + bundle_path;
+        fd_ = ::open(posix_path.c_str(), O_RDONLY);
+        if (fd_ < 0) {
+            LOG_WARN("BUNDLE", "Direct read unavailable for " + String(posix_path.c_str()) + ", using File reads");
+        } else if (!buildExtentMap()) {
+            extent_count_ = 0;
+        }
+    }
+
+    String format;
+    if (isIndexed()) {
+        // 每帧SD读取量与同尺寸RGB565帧对比
+        uint32_t rgb565_size = (uint32_t)header_.frame_width * header_.frame_height * 2;
+        format = String(header_.color_format == I8_COLOR_FORMAT ? ", I8" : ", I4") +
+                 ((header_.flags & BUNDLE_FLAG_SHARED_PALETTE) ? " shared palette" : " per-frame palette") +
+                 ", SD " + String(header_.frame_size) + " B/frame (RGB565 " + String(rgb565_size) + " B)";
+    } else {
+        format = isNativeByteOrder() ? ", native byte order" : ", RGB565 (swapped while rendering)";
+    }
+    if (isSprite()) {
+        format += ", sprite over background (avg " + String(header_.frame_size) + " B/sprite)";
+    }
+    if (header_.fps) {
+        format += ", " + String(header_.fps) + " fps";
+    }
+    if (extent_count_) {
+        format += ", raw sector reads (" + String(extent_count_) + " extent" + (extent_count_ > 1 ? "s)" : ")");
+    } else if (fd_ >= 0) {
+        format += ", " + String(align) + "B-aligned direct reads";
+    }
+    format += isUniform() ? ", uniform stride" : ", paged index";
+    LOG_INFO("BUNDLE", "Bundle loaded: " + String(header_.frame_count) + " frames, " +
+             String(header_.frame_width) + "x" + String(header_.frame_height) + format);
+
+    return true;
+}
+
+bool BirdBundleLoader::loadFavourite(uint16_t bird_id) {
+    close();
+
+    uint32_t size = 0;
+    const uint8_t* base = FavouriteStore::getInstance()->mapBundle(bird_id, &size);
+    if (!base) {
         return false;
     }
+    mapped_ = base;
+    mapped_size_ = size;
+    mapped_bird_ = bird_id;
 
-    file.close();
+    // 收藏分区中是SD上bundle的逐字节副本, 头部与索引直接从映射区域读取
+    if (size < sizeof(BirdBundleHeader)) {
+        close();
+        return false;
+    }
+    memcpy(&header_, base, sizeof(BirdBundleHeader));
+    if (!validateHeader() || isIndexed() || (header_.total_size && header_.total_size > size)) {
+        LOG_WARN("BUNDLE", "Flash copy of bird " + String(bird_id) + " not usable, reading from SD");
+        close();
+        return false;
+    }
 
+    setupFrameAddressing();
     is_loaded_ = true;
-    LOG_INFO("BUNDLE", "Bundle loaded: " + String(header_.frame_count) + " frames, " +
-             String(header_.frame_width) + "x" + String(header_.frame_height));
 
+    LOG_INFO("BUNDLE", "Bundle mapped from flash: " + String(header_.frame_count) + " frames, " +
+             String(header_.frame_width) + "x" + String(header_.frame_height) + ", " + String(size / 1024) + " KB" +
+             (isSprite() ? ", sprite over background" : "") + ", zero-copy frames");
     return true;
 }
 
-bool BirdBundleLoader::loadFrame(uint16_t frame_index, lv_image_dsc_t** out_dsc, uint8_t** out_data) {
+void BirdBundleLoader::setupFrameAddressing() {
+    resetIndexCache();
+    // 步长以转换器写入的为准; 旧版转换器未写入时, 只有紧凑排列的bundle能确定步长(= frame_size),
+    // 对齐bundle的帧间距取决于当时的排布方式, 不做推算而改用索引
+    frame_stride_ = header_.frame_stride;
+    if (frame_stride_ == 0 && !(header_.flags & BUNDLE_FLAG_ALIGNED)) {
+        frame_stride_ = header_.frame_size;
+    }
+    if (isUniform() && (isSprite() || frame_stride_ < header_.frame_size ||
+                        header_.frame_count == 0 ||
+                        (uint64_t)header_.data_offset + (uint64_t)frame_stride_ * (header_.frame_count - 1) +
+                        header_.frame_size > header_.total_size)) {
+        LOG_WARN("BUNDLE", "Invalid uniform stride " + String(frame_stride_) + ", using frame index");
+        header_.flags &= ~BUNDLE_FLAG_UNIFORM;
+    }
+}
+
+bool BirdBundleLoader::releaseMappedFrame(const lv_image_dsc_t* dsc) {
+    if (dsc < &mapped_dscs_[0] || dsc >= &mapped_dscs_[BUNDLE_MAPPED_DESCRIPTORS]) {
+        return false;
+    }
+    mapped_dsc_used_ &= ~(1 << (dsc - &mapped_dscs_[0]));
+    return true;
+}
+
+bool BirdBundleLoader::loadFrame(uint16_t frame_index, lv_image_dsc_t** out_dsc, uint8_t** out_data,
+                                 FramePlacement* out_pos) {
     if (!is_loaded_) {
         LOG_ERROR("BUNDLE", "Bundle not loaded");
         return false;
@@ -84,7 +253,268 @@ bool BirdBundleLoader::loadFrame(uint16_t frame_index, lv_image_dsc_t** out_dsc,
     }
 
     // 获取帧索引信息
-    const FrameIndexEntry& entry = index_table_[frame_index];
+    FrameIndexEntry entry;
+    if (!getFrameEntry(frame_index, entry)) {
+        LOG_ERROR("BUNDLE", "Failed to read index entry of frame " + String(frame_index));
+        return false;
+    }
+
+    if (mapped_) {
+        return readMappedImage(entry.offset, frame_index, out_dsc, out_data, out_pos);
+    }
+
+    if (isRawSectorRead()) {
+        if (out_pos) {
+            out_pos->x = 0;
+            out_pos->y = 0;
+        }
+        if (readRawImage(entry, frame_index, out_dsc, out_data)) {
+            return true;
+        }
+        // 直读失败(卡被换/映射失效)后不再尝试, 退回FatFs路径
+        LOG_WARN("BUNDLE", "Raw sector read failed at frame " + String(frame_index) + ", falling back to FAT reads");
+        extent_count_ = 0;
+    }
+
+    return readImage(entry.offset, frame_index, out_dsc, out_data, out_pos);
+}
+
+uint16_t BirdBundleLoader::getFrameDuration(uint16_t frame_index) const {
+    FrameIndexEntry entry;
+    if (!getFrameEntry(frame_index, entry)) {
+        return 0;
+    }
+
+    uint16_t duration = entry.duration_ms;
+    if (duration == 0 && header_.fps) {
+        duration = 1000 / header_.fps;
+    }
+    return duration;
+}
+
+uint32_t BirdBundleLoader::getFrameFileSize(uint16_t frame_index) const {
+    FrameIndexEntry entry;
+    return getFrameEntry(frame_index, entry) ? entry.size : 0;
+}
+
+uint32_t BirdBundleLoader::estimateFrameBytes() const {
+    if (isSprite()) {
+        return header_.frame_size * 3 / 2;
+    }
+    return (uint32_t)header_.frame_width * header_.frame_height * 2;
+}
+
+bool BirdBundleLoader::isSameFrameData(uint16_t a, uint16_t b) const {
+    // 等步长bundle没有合并和别名
+    if (isUniform()) {
+        return a == b;
+    }
+
+    FrameIndexEntry entry_a, entry_b;
+    return getFrameEntry(a, entry_a) && getFrameEntry(b, entry_b) && entry_a.offset == entry_b.offset;
+}
+
+bool BirdBundleLoader::getFrameEntry(uint16_t frame_index, FrameIndexEntry& out) const {
+    if (!is_loaded_ || frame_index >= header_.frame_count) {
+        return false;
+    }
+
+    if (isUniform()) {
+        out.offset = header_.data_offset + frame_index * frame_stride_;
+        out.size = header_.frame_size;
+        out.checksum = 0;
+        out.duration_ms = 0;
+        out.flags = 0;
+        return true;
+    }
+
+    // 命中则更新使用时间, 未命中替换最久未用的块
+    uint16_t block = frame_index / BUNDLE_INDEX_BLOCK_ENTRIES;
+    IndexBlock* victim = &index_cache_[0];
+    for (IndexBlock& cached : index_cache_) {
+        if (cached.block == block) {
+            cached.last_use = ++index_use_counter_;
+            out = cached.entries[frame_index % BUNDLE_INDEX_BLOCK_ENTRIES];
+            return true;
+        }
+        if (cached.block == 0xFFFF || (victim->block != 0xFFFF && cached.last_use < victim->last_use)) {
+            victim = &cached;
+        }
+    }
+
+    if (!readIndexBlock(block, victim->entries)) {
+        victim->block = 0xFFFF;
+        return false;
+    }
+    victim->block = block;
+    victim->last_use = ++index_use_counter_;
+    out = victim->entries[frame_index % BUNDLE_INDEX_BLOCK_ENTRIES];
+    return true;
+}
+
+bool BirdBundleLoader::readIndexBlock(uint16_t block, FrameIndexEntry* out) const {
+    uint32_t first = (uint32_t)block * BUNDLE_INDEX_BLOCK_ENTRIES;
+    uint32_t count = header_.frame_count - first;
+    if (count > BUNDLE_INDEX_BLOCK_ENTRIES) {
+        count = BUNDLE_INDEX_BLOCK_ENTRIES;
+    }
+
+    // v2索引项直接读入, v1的12字节项读入临时缓冲区后补齐
+    uint32_t entry_size = header_.version >= 2 ? sizeof(FrameIndexEntry) : FRAME_INDEX_ENTRY_SIZE_V1;
+    uint32_t offset = header_.index_offset + first * entry_size;
+    uint32_t size = count * entry_size;
+    uint8_t v1_buf[BUNDLE_INDEX_BLOCK_ENTRIES * FRAME_INDEX_ENTRY_SIZE_V1];
+    uint8_t* dst = header_.version >= 2 ? reinterpret_cast<uint8_t*>(out) : v1_buf;
+
+    bool ok;
+    if (mapped_) {
+        ok = (uint64_t)offset + size <= mapped_size_;
+        if (ok) {
+            memcpy(dst, mapped_ + offset, size);
+        }
+    } else if (fd_ >= 0) {
+        ok = lseek(fd_, offset, SEEK_SET) == (off_t)offset && ::read(fd_, dst, size) == (ssize_t)size;
+    } else {
+        File file = SD.open(bundle_path_.c_str());
+        ok = file && file.seek(offset) && file.read(dst, size) == size;
+        if (file) {
+            file.close();
+        }
+    }
+    if (!ok) {
+        return false;
+    }
+
+    if (header_.version < 2) {
+        for (uint32_t i = 0; i < count; i++) {
+            memcpy(&out[i], v1_buf + i * FRAME_INDEX_ENTRY_SIZE_V1, FRAME_INDEX_ENTRY_SIZE_V1);
+            out[i].duration_ms = 0;
+            out[i].flags = 0;
+        }
+    }
+    return true;
+}
+
+void BirdBundleLoader::resetIndexCache() {
+    for (IndexBlock& cached : index_cache_) {
+        cached.block = 0xFFFF;
+        cached.last_use = 0;
+    }
+    index_use_counter_ = 0;
+}
+
+bool BirdBundleLoader::loadBackground(lv_image_dsc_t** out_dsc, uint8_t** out_data) {
+    if (!is_loaded_ || !isSprite()) {
+        LOG_ERROR("BUNDLE", "No background in bundle");
+        return false;
+    }
+
+    if (!out_dsc || !out_data) {
+        LOG_ERROR("BUNDLE", "Invalid output parameters");
+        return false;
+    }
+
+    if (mapped_) {
+        return readMappedImage(header_.background_offset, -1, out_dsc, out_data, nullptr);
+    }
+    return readImage(header_.background_offset, -1, out_dsc, out_data, nullptr);
+}
+
+bool BirdBundleLoader::readMappedImage(uint32_t offset, int32_t frame_index, lv_image_dsc_t** out_dsc,
+                                       uint8_t** out_data, FramePlacement* out_pos) {
+    String label = frame_index < 0 ? String("background") : "frame " + String(frame_index);
+
+    if ((uint64_t)offset + sizeof(LvglFrameHeader) > mapped_size_) {
+        LOG_ERROR("BUNDLE", "Mapped " + label + " out of range");
+        return false;
+    }
+    LvglFrameHeader fh;
+    memcpy(&fh, mapped_ + offset, sizeof(fh));
+
+    uint8_t color_format = fh.header_cf & 0xFF;
+    uint8_t magic = (fh.header_cf >> 24) & 0xFF;
+    bool sprite = isSprite() && frame_index >= 0;
+    uint8_t expected_format = sprite ? RGB565A8_COLOR_FORMAT : header_.color_format;
+    if (color_format != expected_format || magic != 0x37 || fh.width == 0 || fh.height == 0 ||
+        (uint64_t)offset + sizeof(fh) + fh.data_size > mapped_size_) {
+        LOG_ERROR("BUNDLE", "Invalid LVGL format in mapped " + label +
+                  ": cf=0x" + String(color_format, HEX) + ", magic=0x" + String(magic, HEX));
+        return false;
+    }
+
+    const uint8_t* pixels = mapped_ + offset + sizeof(fh);
+    uint32_t count = (uint32_t)fh.width * fh.height;
+    bool mask_a1 = sprite && (fh.flags & SPRITE_FRAME_FLAG_MASK_A1);
+    uint32_t mask_stride = mask_a1 ? (fh.width + 7) / 8 : fh.width;
+    uint32_t out_size = sprite ? count * 3 : count * 2;
+    if (fh.data_size < (sprite ? count * 2 + mask_stride * fh.height : out_size)) {
+        LOG_ERROR("BUNDLE", "Invalid pixel data size in mapped " + label + ": " + String(fh.data_size));
+        return false;
+    }
+
+    // 零拷贝: 借出内部描述符, 像素直接指向flash
+    lv_image_dsc_t* img_dsc = nullptr;
+    uint8_t* img_data = nullptr;
+    if (!mask_a1) {
+        for (uint8_t i = 0; i < BUNDLE_MAPPED_DESCRIPTORS; i++) {
+            if (!(mapped_dsc_used_ & (1 << i))) {
+                mapped_dsc_used_ |= 1 << i;
+                img_dsc = &mapped_dscs_[i];
+                img_data = const_cast<uint8_t*>(pixels);
+                break;
+            }
+        }
+    }
+
+    // 1位掩码需要展开(或描述符已借完): 复制到堆上, 由调用方释放
+    if (!img_dsc) {
+        img_dsc = static_cast<lv_image_dsc_t*>(MemTracker::alloc(MEM_TAG_LOADER, sizeof(lv_image_dsc_t)));
+        img_data = static_cast<uint8_t*>(MemTracker::alloc(MEM_TAG_LOADER, out_size));
+        if (!img_dsc || !img_data) {
+            LOG_ERROR("BUNDLE", "Failed to allocate memory for mapped " + label);
+            if (img_dsc) MemTracker::free(img_dsc);
+            if (img_data) MemTracker::free(img_data);
+            return false;
+        }
+        if (mask_a1) {
+            memcpy(img_data, pixels, count * 2);
+            expandMaskA1(pixels + count * 2, mask_stride, fh.width, fh.height, img_data + count * 2);
+        } else {
+            memcpy(img_data, pixels, out_size);
+        }
+    }
+
+    img_dsc->header.magic = LV_IMAGE_HEADER_MAGIC;
+    img_dsc->header.cf = color_format;
+    img_dsc->header.flags = 0;
+    img_dsc->header.w = fh.width;
+    img_dsc->header.h = fh.height;
+    img_dsc->header.stride = fh.width * 2;
+    img_dsc->header.reserved_2 = 0;
+    img_dsc->data_size = out_size;
+    img_dsc->data = img_data;
+
+    if (out_pos) {
+        out_pos->x = sprite ? (int16_t)(fh.reserved_2 & 0xFFFF) : 0;
+        out_pos->y = sprite ? (int16_t)(fh.reserved_2 >> 16) : 0;
+    }
+
+    *out_dsc = img_dsc;
+    *out_data = img_data;
+    return true;
+}
+
+bool BirdBundleLoader::readImage(uint32_t offset, int32_t frame_index, lv_image_dsc_t** out_dsc,
+                                 uint8_t** out_data, FramePlacement* out_pos) {
+    if (fd_ >= 0) {
+        if (out_pos) {
+            out_pos->x = 0;
+            out_pos->y = 0;
+        }
+        return readAlignedImage(offset, frame_index, out_dsc, out_data);
+    }
+
+    String label = frame_index < 0 ? String("background") : "frame " + String(frame_index);
 
     // 打开bundle文件
     File file = SD.open(bundle_path_.c_str());
@@ -94,9 +524,9 @@ bool BirdBundleLoader::loadFrame(uint16_t frame_index, lv_image_dsc_t** out_dsc,
     }
 
     // 定位到帧数据位置
-    file.seek(entry.offset);
+    file.seek(offset);
 
-    // 读取LVGL 9.x头部 (32字节)
+    // 读取LVGL 9.x头部 (24字节)
     uint32_t header_cf, flags, stride, reserved_2, data_size;
     uint16_t width, height;
 
@@ -107,55 +537,76 @@ bool BirdBundleLoader::loadFrame(uint16_t frame_index, lv_image_dsc_t** out_dsc,
         file.read((uint8_t*)&stride, 4) != 4 ||
         file.read((uint8_t*)&reserved_2, 4) != 4 ||
         file.read((uint8_t*)&data_size, 4) != 4) {
-        LOG_ERROR("BUNDLE", "Failed to read LVGL header for frame " + String(frame_index));
+        LOG_ERROR("BUNDLE", "Failed to read LVGL header for " + label);
         file.close();
         return false;
     }
 
-    // 验证LVGL格式
+    // 验证LVGL格式: 精灵bundle的动画帧为RGB565A8, 背景与普通帧使用bundle的颜色格式
     uint8_t color_format = header_cf & 0xFF;
     uint8_t magic = (header_cf >> 24) & 0xFF;
+    bool sprite = isSprite() && frame_index >= 0;
+    uint8_t expected_format = sprite ? RGB565A8_COLOR_FORMAT : header_.color_format;
 
-    if (color_format != RGB565_COLOR_FORMAT || magic != 0x37) {
-        LOG_ERROR("BUNDLE", "Invalid LVGL format in frame " + String(frame_index) +
+    if (color_format != expected_format || magic != 0x37 || width == 0 || height == 0) {
+        LOG_ERROR("BUNDLE", "Invalid LVGL format in " + label +
                   ": cf=0x" + String(color_format, HEX) + ", magic=0x" + String(magic, HEX));
         file.close();
         return false;
     }
 
+    // 索引色帧展开为RGB565, 精灵的1位掩码展开为A8, 输出大小与文件中的数据大小不同
+    bool indexed = isIndexedColorFormat(color_format);
+    uint32_t pixels = (uint32_t)width * height;
+    uint32_t out_size = data_size;
+    if (indexed) {
+        out_size = pixels * 2;
+    } else if (sprite) {
+        out_size = pixels * 3;
+    }
+
     // 检查可用内存
     size_t free_heap = ESP.getFreeHeap();
-    if (free_heap < data_size + 4096) {
-        LOG_ERROR("BUNDLE", "Insufficient memory - need " + String(data_size) +
-                  " + 4096, have " + String(free_heap));
+    if (free_heap < out_size + 4096) {
+        LOG_ERROR("BUNDLE", "Insufficient memory - need " + String(out_size) +
+                  " + 4096, have " + String(free_heap) +
+                  " (largest block " + String(ESP.getMaxAllocHeap()) + "), see 'mem'");
         file.close();
         return false;
     }
 
     // 分配内存
-    lv_image_dsc_t* img_dsc = static_cast<lv_image_dsc_t*>(malloc(sizeof(lv_image_dsc_t)));
-    uint8_t* img_data = static_cast<uint8_t*>(malloc(data_size));
+    lv_image_dsc_t* img_dsc = static_cast<lv_image_dsc_t*>(MemTracker::alloc(MEM_TAG_LOADER, sizeof(lv_image_dsc_t)));
+    uint8_t* img_data = static_cast<uint8_t*>(MemTracker::alloc(MEM_TAG_LOADER, out_size));
 
     if (!img_dsc || !img_data) {
-        LOG_ERROR("BUNDLE", "Failed to allocate memory for frame " + String(frame_index));
-        if (img_dsc) free(img_dsc);
-        if (img_data) free(img_data);
+        LOG_ERROR("BUNDLE", "Failed to allocate memory for " + label);
+        if (img_dsc) MemTracker::free(img_dsc);
+        if (img_data) MemTracker::free(img_data);
         file.close();
         return false;
     }
 
     // 读取像素数据
-    size_t bytes_read = file.read(img_data, data_size);
+    bool ok;
+    if (indexed) {
+        ok = readIndexedPixels(file, color_format, width, height, stride, data_size,
+                               reinterpret_cast<uint16_t*>(img_data));
+        color_format = INDEXED_OUTPUT_FORMAT;
+    } else if (sprite) {
+        ok = readSpritePixels(file, flags, width, height, data_size, img_data);
+    } else {
+        ok = file.read(img_data, data_size) == data_size;
+    }
     file.close();
 
     // 让出CPU，避免看门狗超时
     vTaskDelay(1);
 
-    if (bytes_read != data_size) {
-        LOG_ERROR("BUNDLE", "Failed to read pixel data: " + String(bytes_read) +
-                  "/" + String(data_size));
-        free(img_dsc);
-        free(img_data);
+    if (!ok) {
+        LOG_ERROR("BUNDLE", "Failed to read pixel data of " + label + " (" + String(data_size) + " B)");
+        MemTracker::free(img_dsc);
+        MemTracker::free(img_data);
         return false;
     }
 
@@ -165,7 +616,280 @@ bool BirdBundleLoader::loadFrame(uint16_t frame_index, lv_image_dsc_t** out_dsc,
     img_dsc->header.flags = 0;
     img_dsc->header.w = width;
     img_dsc->header.h = height;
-    img_dsc->header.stride = width * 2;  // RGB565每像素2字节
+    img_dsc->header.stride = width * 2;  // RGB565(及RGB565A8的颜色平面)每像素2字节
+    img_dsc->header.reserved_2 = 0;
+    img_dsc->data_size = out_size;
+    img_dsc->data = img_data;
+
+    // 精灵在背景上的位置保存在帧头的reserved_2中: (y << 16) | x
+    if (out_pos) {
+        out_pos->x = sprite ? (int16_t)(reserved_2 & 0xFFFF) : 0;
+        out_pos->y = sprite ? (int16_t)(reserved_2 >> 16) : 0;
+    }
+
+    *out_dsc = img_dsc;
+    *out_data = img_data;
+
+    return true;
+}
+
+bool BirdBundleLoader::readAlignedImage(uint32_t offset, int32_t frame_index, lv_image_dsc_t** out_dsc,
+                                        uint8_t** out_data) {
+    LvglFrameHeader fh;
+    if (lseek(fd_, offset, SEEK_SET) != (off_t)offset ||
+        ::read(fd_, &fh, sizeof(fh)) != (ssize_t)sizeof(fh)) {
+        LOG_ERROR("BUNDLE", "Failed to read LVGL header for frame " + String(frame_index));
+        return false;
+    }
+
+    uint8_t color_format = fh.header_cf & 0xFF;
+    uint8_t magic = (fh.header_cf >> 24) & 0xFF;
+    if (color_format != header_.color_format || magic != 0x37) {
+        LOG_ERROR("BUNDLE", "Invalid LVGL format in frame " + String(frame_index) +
+                  ": cf=0x" + String(color_format, HEX) + ", magic=0x" + String(magic, HEX));
+        return false;
+    }
+
+    // 读取长度补齐到对齐单位(转换器已在文件中补齐), 请求全部是整扇区,
+    // FatFs直接多块读入目标缓冲区, 不经过扇区窗口拷贝
+    uint32_t align = header_.payload_align;
+    uint32_t read_size = (fh.data_size + align - 1) & ~(align - 1);
+
+    // 帧头来自卡上数据, 不可信: 尺寸须与bundle头一致, 补齐后的读取不得超出文件
+    uint32_t expected = (uint32_t)header_.frame_width * header_.frame_height * 2;
+    uint64_t read_end = (uint64_t)offset + sizeof(fh) + read_size;
+    if (fh.width != header_.frame_width || fh.height != header_.frame_height || fh.data_size != expected ||
+        fh.data_size + sizeof(fh) > header_.frame_size || (header_.total_size && read_end > header_.total_size)) {
+        LOG_ERROR("BUNDLE", "Frame " + String(frame_index) + " header does not match bundle: " +
+                  String(fh.width) + "x" + String(fh.height) + ", data_size=" + String(fh.data_size));
+        return false;
+    }
+
+    size_t free_heap = ESP.getFreeHeap();
+    if (free_heap < read_size + 4096) {
+        LOG_ERROR("BUNDLE", "Insufficient memory - need " + String(read_size) +
+                  " + 4096, have " + String(free_heap) +
+                  " (largest block " + String(ESP.getMaxAllocHeap()) + "), see 'mem'");
+        return false;
+    }
+
+    lv_image_dsc_t* img_dsc = static_cast<lv_image_dsc_t*>(MemTracker::alloc(MEM_TAG_LOADER, sizeof(lv_image_dsc_t)));
+    uint8_t* img_data = static_cast<uint8_t*>(MemTracker::allocAligned(MEM_TAG_LOADER, read_size, 4));
+    if (!img_dsc || !img_data) {
+        LOG_ERROR("BUNDLE", "Failed to allocate memory for frame " + String(frame_index));
+        if (img_dsc) MemTracker::free(img_dsc);
+        if (img_data) MemTracker::free(img_data);
+        return false;
+    }
+
+    ssize_t bytes_read = ::read(fd_, img_data, read_size);
+
+    // 让出CPU，避免看门狗超时
+    vTaskDelay(1);
+
+    if (bytes_read != (ssize_t)read_size) {
+        LOG_ERROR("BUNDLE", "Failed to read pixel data: " + String((int)bytes_read) +
+                  "/" + String(read_size));
+        MemTracker::free(img_dsc);
+        MemTracker::free(img_data);
+        return false;
+    }
+
+    img_dsc->header.magic = LV_IMAGE_HEADER_MAGIC;
+    img_dsc->header.cf = color_format;
+    img_dsc->header.flags = 0;
+    img_dsc->header.w = fh.width;
+    img_dsc->header.h = fh.height;
+    img_dsc->header.stride = fh.width * 2;
+    img_dsc->header.reserved_2 = 0;
+    img_dsc->data_size = fh.data_size;
+    img_dsc->data = img_data;
+
+    *out_dsc = img_dsc;
+    *out_data = img_data;
+
+    return true;
+}
+
+bool BirdBundleLoader::setRawSectorReads(bool enabled) {
+    raw_reads_ = enabled;
+    return !enabled || extent_count_ > 0;
+}
+
+void BirdBundleLoader::invalidateExtentMaps() {
+    s_extent_generation++;
+}
+
+bool BirdBundleLoader::buildExtentMap() {
+    extent_count_ = 0;
+    // 先记录计数: 遍历期间文件被改写时, 第一次直读就会发现并放弃映射
+    extent_generation_ = s_extent_generation;
+
+    // 路径须带SD卡的驱动器号, 不能依赖默认驱动器(挂载了其他FAT卷时会打开错误的卷)
+    uint8_t drive = tf.getFatDrive();
+    if (drive >= FF_VOLUMES) {
+        LOG_WARN("BUNDLE", "Raw sector reads unavailable: SD drive unknown");
+        return false;
+    }
+    std::string fat_path = std::string(1, (char)('0' + drive)) + ":" + bundle_path_;
+
+    FIL fil;
+    if (f_open(&fil, fat_path.c_str(), FA_READ) != FR_OK) {
+        LOG_WARN("BUNDLE", "Raw sector reads unavailable: f_open failed");
+        return false;
+    }
+
+    FATFS* fs = fil.obj.fs;
+    if (fs->pdrv != drive) {
+        LOG_WARN("BUNDLE", "Raw sector reads unavailable: " + String(fat_path.c_str()) + " is not on the SD volume");
+        f_close(&fil);
+        return false;
+    }
+#if FF_MAX_SS != FF_MIN_SS
+    uint32_t sector_size = fs->ssize;
+#else
+    uint32_t sector_size = FF_MAX_SS;
+#endif
+    if (sector_size != BUNDLE_SECTOR_SIZE) {
+        LOG_WARN("BUNDLE", "Raw sector reads unavailable: sector size " + String(sector_size));
+        f_close(&fil);
+        return false;
+    }
+
+    // 逐簇定位(落在簇内第1字节, 边界位置FatFs不会切换到下一簇), 相邻簇号合并为一段
+    // f_lseek每次调用都在FatFs卷锁内读取FAT, 不能在外面再持有该锁(非递归)
+    uint32_t cluster_bytes = (uint32_t)fs->csize * BUNDLE_SECTOR_SIZE;
+    FSIZE_t file_size = f_size(&fil);
+    DWORD prev_cluster = 0;
+    bool ok = true;
+
+    for (FSIZE_t pos = 0; pos < file_size; pos += cluster_bytes) {
+        if (f_lseek(&fil, pos + 1) != FR_OK || fil.clust < 2) {
+            ok = false;
+            break;
+        }
+
+        DWORD cluster = fil.clust;
+        if (extent_count_ > 0 && cluster == prev_cluster + 1) {
+            extents_[extent_count_ - 1].sectors += fs->csize;
+        } else if (extent_count_ < BUNDLE_MAX_EXTENTS) {
+            BundleExtent& extent = extents_[extent_count_++];
+            extent.file_sector = (uint32_t)(pos / BUNDLE_SECTOR_SIZE);
+            extent.lba = (uint32_t)(fs->database + (LBA_t)(cluster - 2) * fs->csize);
+            extent.sectors = fs->csize;
+        } else {
+            LOG_WARN("BUNDLE", "Raw sector reads unavailable: more than " + String(BUNDLE_MAX_EXTENTS) + " extents");
+            ok = false;
+            break;
+        }
+        prev_cluster = cluster;
+    }
+
+    pdrv_ = fs->pdrv;
+    fs_ = fs;
+    f_close(&fil);
+
+    if (!ok || extent_count_ == 0) {
+        extent_count_ = 0;
+        return false;
+    }
+    return true;
+}
+
+bool BirdBundleLoader::readSectors(uint32_t file_sector, uint32_t count, uint8_t* out) {
+    if (!fs_ || !lockVolume(fs_)) {
+        return false;
+    }
+
+    // 在卷锁内检查: 改写文件的一方先调用invalidateExtentMaps()再经FatFs写卡
+    if (extent_generation_ != s_extent_generation) {
+        unlockVolume(fs_);
+        LOG_WARN("BUNDLE", "Bundle file may have been rewritten, dropping sector map");
+        return false;
+    }
+
+    bool ok = true;
+    uint8_t e = 0;
+    while (ok && count > 0) {
+        // 帧按顺序读取, 段也按文件顺序排列, 从头查找即可(最多BUNDLE_MAX_EXTENTS段)
+        while (e < extent_count_ && file_sector >= extents_[e].file_sector + extents_[e].sectors) {
+            e++;
+        }
+        if (e == extent_count_ || file_sector < extents_[e].file_sector) {
+            ok = false;
+            break;
+        }
+
+        const BundleExtent& extent = extents_[e];
+        uint32_t n = extent.file_sector + extent.sectors - file_sector;
+        if (n > count) {
+            n = count;
+        }
+
+        // 一次多块读取(CMD18)直接写入目标缓冲区
+        if (disk_read(pdrv_, out, extent.lba + (file_sector - extent.file_sector), n) != RES_OK) {
+            ok = false;
+            break;
+        }
+
+        file_sector += n;
+        count -= n;
+        out += n * BUNDLE_SECTOR_SIZE;
+    }
+
+    unlockVolume(fs_);
+    return ok;
+}
+
+bool BirdBundleLoader::readRawImage(const FrameIndexEntry& entry, uint16_t frame_index,
+                                    lv_image_dsc_t** out_dsc, uint8_t** out_data) {
+    // 像素数据紧跟24字节LVGL头, 对齐bundle中从扇区边界开始
+    uint32_t payload = entry.offset + sizeof(LvglFrameHeader);
+    uint32_t data_size = entry.size - sizeof(LvglFrameHeader);
+    uint32_t expected = (uint32_t)header_.frame_width * header_.frame_height * 2;
+    if (entry.size <= sizeof(LvglFrameHeader) || (payload % BUNDLE_SECTOR_SIZE) != 0 || data_size != expected) {
+        LOG_ERROR("BUNDLE", "Frame " + String(frame_index) + " not sector aligned: offset=" +
+                  String(entry.offset) + ", size=" + String(entry.size));
+        return false;
+    }
+
+    uint32_t sectors = (data_size + BUNDLE_SECTOR_SIZE - 1) / BUNDLE_SECTOR_SIZE;
+    uint32_t read_size = sectors * BUNDLE_SECTOR_SIZE;
+
+    size_t free_heap = ESP.getFreeHeap();
+    if (free_heap < read_size + 4096) {
+        LOG_ERROR("BUNDLE", "Insufficient memory - need " + String(read_size) +
+                  " + 4096, have " + String(free_heap) +
+                  " (largest block " + String(ESP.getMaxAllocHeap()) + "), see 'mem'");
+        return false;
+    }
+
+    lv_image_dsc_t* img_dsc = static_cast<lv_image_dsc_t*>(MemTracker::alloc(MEM_TAG_LOADER, sizeof(lv_image_dsc_t)));
+    uint8_t* img_data = static_cast<uint8_t*>(MemTracker::allocAligned(MEM_TAG_LOADER, read_size, 4));
+    if (!img_dsc || !img_data) {
+        LOG_ERROR("BUNDLE", "Failed to allocate memory for frame " + String(frame_index));
+        if (img_dsc) MemTracker::free(img_dsc);
+        if (img_data) MemTracker::free(img_data);
+        return false;
+    }
+
+    bool ok = readSectors(payload / BUNDLE_SECTOR_SIZE, sectors, img_data);
+
+    // 让出CPU，避免看门狗超时
+    vTaskDelay(1);
+
+    if (!ok) {
+        MemTracker::free(img_dsc);
+        MemTracker::free(img_data);
+        return false;
+    }
+
+    img_dsc->header.magic = LV_IMAGE_HEADER_MAGIC;
+    img_dsc->header.cf = header_.color_format;
+    img_dsc->header.flags = 0;
+    img_dsc->header.w = header_.frame_width;
+    img_dsc->header.h = header_.frame_height;
+    img_dsc->header.stride = header_.frame_width * 2;
     img_dsc->header.reserved_2 = 0;
     img_dsc->data_size = data_size;
     img_dsc->data = img_data;
@@ -176,12 +900,126 @@ bool BirdBundleLoader::loadFrame(uint16_t frame_index, lv_image_dsc_t** out_dsc,
     return true;
 }
 
+bool BirdBundleLoader::readSpritePixels(File& file, uint32_t flags, uint16_t width, uint16_t height,
+                                        uint32_t data_size, uint8_t* out) {
+    uint32_t pixels = (uint32_t)width * height;
+    uint32_t color_bytes = pixels * 2;
+    bool mask_a1 = (flags & SPRITE_FRAME_FLAG_MASK_A1) != 0;
+    uint32_t mask_stride = mask_a1 ? (width + 7) / 8 : width;
+
+    if (data_size < color_bytes + mask_stride * height || mask_stride > sizeof(read_buf_)) {
+        LOG_ERROR("BUNDLE", "Invalid sprite layout: " + String(width) + "x" + String(height) +
+                  ", data_size=" + String(data_size));
+        return false;
+    }
+
+    // 颜色平面直接读入, A8平面紧随其后
+    if (file.read(out, color_bytes) != color_bytes) {
+        return false;
+    }
+
+    uint8_t* alpha = out + color_bytes;
+    if (!mask_a1) {
+        return file.read(alpha, pixels) == pixels;
+    }
+
+    // 1位掩码(高位在前)按块读取并展开为A8
+    uint16_t rows_per_chunk = sizeof(read_buf_) / mask_stride;
+    for (uint16_t row = 0; row < height; row += rows_per_chunk) {
+        uint16_t rows = height - row < rows_per_chunk ? height - row : rows_per_chunk;
+        size_t chunk = (size_t)rows * mask_stride;
+        if (file.read(read_buf_, chunk) != chunk) {
+            return false;
+        }
+
+        expandMaskA1(read_buf_, mask_stride, width, rows, alpha);
+        alpha += (size_t)rows * width;
+    }
+
+    return true;
+}
+
+bool BirdBundleLoader::readIndexedPixels(File& file, uint8_t color_format, uint16_t width, uint16_t height,
+                                         uint32_t stride, uint32_t data_size, uint16_t* out) {
+    uint16_t entries = paletteEntries(color_format);
+    uint32_t palette_bytes = (uint32_t)entries * 4;
+
+    if (stride < indexedStride(color_format, width) || stride > sizeof(read_buf_) ||
+        data_size < palette_bytes + stride * height) {
+        LOG_ERROR("BUNDLE", "Invalid indexed frame layout: stride=" + String(stride) +
+                  ", data_size=" + String(data_size));
+        return false;
+    }
+
+    // 共享调色板只解析一次, 之后直接跳过
+    if (palette_valid_ && (header_.flags & BUNDLE_FLAG_SHARED_PALETTE)) {
+        file.seek(file.position() + palette_bytes);
+    } else {
+        if (file.read(read_buf_, palette_bytes) != palette_bytes) {
+            return false;
+        }
+        // 调色板项为lv_color32_t: B, G, R, A (透明度忽略, 小鸟帧不透明)
+        for (uint16_t i = 0; i < entries; i++) {
+            const uint8_t* c = read_buf_ + i * 4;
+            uint16_t rgb565 = ((c[2] & 0xF8) << 8) | ((c[1] & 0xFC) << 3) | (c[0] >> 3);
+#if LCD_NATIVE_BYTE_ORDER
+            rgb565 = (rgb565 >> 8) | (rgb565 << 8);
+#endif
+            palette_lut_[i] = rgb565;
+        }
+        palette_valid_ = true;
+    }
+
+    // 按块读取多行索引, 边读边查表展开
+    uint16_t rows_per_chunk = sizeof(read_buf_) / stride;
+    for (uint16_t row = 0; row < height; row += rows_per_chunk) {
+        uint16_t rows = height - row < rows_per_chunk ? height - row : rows_per_chunk;
+        size_t chunk = (size_t)rows * stride;
+        if (file.read(read_buf_, chunk) != chunk) {
+            return false;
+        }
+
+        for (uint16_t r = 0; r < rows; r++) {
+            const uint8_t* src = read_buf_ + r * stride;
+            if (color_format == I8_COLOR_FORMAT) {
+                for (uint16_t x = 0; x < width; x++) {
+                    *out++ = palette_lut_[src[x]];
+                }
+            } else {
+                // I4: 偶数列在高4位
+                for (uint16_t x = 0; x < width; x += 2) {
+                    uint8_t b = src[x >> 1];
+                    *out++ = palette_lut_[b >> 4];
+                    if (x + 1 < width) {
+                        *out++ = palette_lut_[b & 0x0F];
+                    }
+                }
+            }
+        }
+    }
+
+    return true;
+}
+
 void BirdBundleLoader::close() {
+    if (fd_ >= 0) {
+        ::close(fd_);
+        fd_ = -1;
+    }
+    extent_count_ = 0;
+    if (mapped_) {
+        FavouriteStore::getInstance()->unmapBundle(mapped_bird_);
+        mapped_ = nullptr;
+        mapped_size_ = 0;
+        mapped_bird_ = 0;
+        mapped_dsc_used_ = 0;
+    }
     if (is_loaded_) {
-        index_table_.clear();
+        resetIndexCache();
         bundle_path_.clear();
         is_loaded_ = false;
     }
+    palette_valid_ = false;
 }
 
 bool BirdBundleLoader::validateHeader() {
@@ -193,18 +1031,30 @@ bool BirdBundleLoader::validateHeader() {
     }
 
     // 验证版本
-    if (header_.version != BUNDLE_VERSION) {
+    if (header_.version == 0 || header_.version > BUNDLE_VERSION) {
         LOG_WARN("BUNDLE", "Bundle version mismatch: " + String(header_.version) +
-                 " (expected " + String(BUNDLE_VERSION) + ")");
+                 " (supported 1-" + String(BUNDLE_VERSION) + ")");
         // 版本不匹配只是警告，不阻止加载
     }
 
     // 验证颜色格式
-    if (header_.color_format != RGB565_COLOR_FORMAT) {
+    if (!isSupportedColorFormat(header_.color_format)) {
         LOG_ERROR("BUNDLE", "Unsupported color format: 0x" + String(header_.color_format, HEX));
         return false;
     }
 
+    if (!isIndexedColorFormat(header_.color_format) &&
+        ((header_.flags & BUNDLE_FLAG_NATIVE_ORDER) != 0) != (header_.color_format == RGB565_SWAPPED_COLOR_FORMAT)) {
+        LOG_WARN("BUNDLE", "Byte order flag does not match color format, using color format");
+    }
+
+    // 精灵bundle必须带背景图
+    if ((header_.flags & BUNDLE_FLAG_SPRITE) &&
+        (header_.background_offset == 0 || header_.background_size == 0)) {
+        LOG_ERROR("BUNDLE", "Sprite bundle without background");
+        return false;
+    }
+
     // 验证帧数
     if (header_.frame_count == 0) {
         LOG_ERROR("BUNDLE", "Invalid frame count: 0");
@@ -5,7 +5,7 @@
 #include <SD.h>
 #include <lvgl.h>
 #include <string>
-#include <vector>
+#include "ff.h"
 
 namespace BirdWatching {
 
@@ -16,31 +16,118 @@ namespace BirdWatching {
  */
 struct BirdBundleHeader {
     uint32_t magic;          // 0x42495244 ("BIRD")
-    uint16_t version;        // 版本号 (当前: 1)
+    uint16_t version;        // 版本号 (当前: 2; 1为12字节索引项)
     uint16_t frame_count;    // 总帧数
     uint16_t frame_width;    // 帧宽度 (120)
     uint16_t frame_height;   // 帧高度 (120)
-    uint32_t frame_size;     // 单帧大小（字节，含LVGL头）
+    uint32_t frame_size;     // 单帧大小（字节，含LVGL头；精灵bundle为平均精灵大小）
     uint32_t index_offset;   // 索引表偏移量（通常为64）
     uint32_t data_offset;    // 数据区偏移量
     uint32_t total_size;     // 文件总大小
-    uint8_t  color_format;   // 颜色格式 (0x12=RGB565)
-    uint8_t  reserved[35];   // 保留字段
+    uint8_t  color_format;   // 颜色格式 (0x12=RGB565, 0x1B=RGB565_SWAPPED, 0x0A=I8, 0x09=I4)
+    uint8_t  flags;          // BUNDLE_FLAG_*
+    uint32_t background_offset;  // 精灵bundle: 背景图(LVGL格式)偏移量
+    uint32_t background_size;    // 精灵bundle: 背景图大小
+    uint8_t  fps;            // 小鸟自身帧率 (0: 使用默认BIRD_FRAME_INTERVAL_MS)
+    uint16_t payload_align;  // BUNDLE_FLAG_ALIGNED: 像素数据起始与长度的对齐字节数(512或簇大小)
+    uint32_t frame_stride;   // BUNDLE_FLAG_UNIFORM: 相邻帧间距(转换器按实际排布写入; 旧版为0)
+    uint8_t  reserved[19];   // 保留字段
 } __attribute__((packed));
 
+// Bundle标志位
+#define BUNDLE_FLAG_NATIVE_ORDER 0x01   // 像素为面板字节序(高字节在前), 与color_format=0x1B一致
+#define BUNDLE_FLAG_SHARED_PALETTE 0x02 // I8/I4: 所有帧调色板相同, 只需解析一次
+#define BUNDLE_FLAG_SPRITE 0x04         // 一张背景图 + 每帧小鸟精灵(RGB565A8, 包围盒位置在reserved_2)
+#define BUNDLE_FLAG_ALIGNED 0x08        // RGB565帧像素数据按payload_align对齐并补齐, 可整扇区直读
+#define BUNDLE_FLAG_UNIFORM 0x10        // 所有帧等长等时长且无别名: 第i帧在data_offset + i×frame_stride, 不读索引
+
+// 精灵帧头flags: 透明度平面为1位掩码(每行(w+7)/8字节, 高位在前), 加载时展开为A8
+#define SPRITE_FRAME_FLAG_MASK_A1 0x0100
+
+// 索引色帧按块读取的缓冲区大小(需能容纳256色调色板和至少一行索引)
+#define BUNDLE_READ_CHUNK 1024
+
+// 扇区直读: 只支持512字节扇区; 簇链超过该段数时认为碎片过多, 退回FatFs读取
+#define BUNDLE_SECTOR_SIZE 512
+#define BUNDLE_MAX_EXTENTS 8
+
+// 索引分页: 每块16项(v2为256字节), 缓存4块(LRU)
+#define BUNDLE_INDEX_BLOCK_ENTRIES 16
+#define BUNDLE_INDEX_CACHE_BLOCKS 4
+
+// flash映射的bundle零拷贝出帧时可同时借出的描述符数(当前帧、预加载帧、背景、测速)
+#define BUNDLE_MAPPED_DESCRIPTORS 4
+
 /**
- * 帧索引条目 (12字节)
+ * 帧索引条目 (v2: 16字节, v1: 前12字节)
+ *
+ * 相邻的相同帧由转换器合并为一项并加长duration_ms;
+ * 不相邻的重复帧可指向之前帧的offset(别名), 不重复存储数据
  */
 struct FrameIndexEntry {
     uint32_t offset;         // 帧数据偏移量（从文件开头）
     uint32_t size;           // 帧数据大小（字节）
     uint32_t checksum;       // CRC32校验（可选）
+    uint16_t duration_ms;    // 本帧显示时长 (0: 使用bundle帧率)
+    uint16_t flags;          // FRAME_FLAG_*
+} __attribute__((packed));
+
+#define FRAME_INDEX_ENTRY_SIZE_V1 12
+
+// 帧索引标志位
+#define FRAME_FLAG_ALIAS 0x0001     // 数据与之前某帧相同(offset指向该帧)
+
+/**
+ * 帧的LVGL 9.x头部 (24字节)
+ */
+struct LvglFrameHeader {
+    uint32_t header_cf;      // (0x37 << 24) | color_format
+    uint32_t flags;
+    uint16_t width;
+    uint16_t height;
+    uint32_t stride;
+    uint32_t reserved_2;
+    uint32_t data_size;
 } __attribute__((packed));
 
+/**
+ * bundle文件的一段连续扇区(文件内扇区号 -> 卡上LBA)
+ */
+struct BundleExtent {
+    uint32_t file_sector;    // 本段第一个扇区在文件内的序号
+    uint32_t lba;            // 本段第一个扇区在卡上的LBA
+    uint32_t sectors;        // 扇区数
+};
+
+/**
+ * 精灵在背景图上的位置(源像素, 未缩放)
+ */
+struct FramePlacement {
+    int16_t x;
+    int16_t y;
+};
+
 /**
  * Bundle文件加载器
  *
  * 用于从单个bundle.bin文件中按需加载帧数据，减少SD卡文件打开次数
+ *
+ * 帧寻址不常驻整张索引表: 等步长bundle按帧号直接计算偏移;
+ * 其他bundle按块读取索引, 放在小LRU缓存中, 加载时间和内存与帧数无关
+ *
+ * 索引色帧(I8/I4)布局: LVGL头 + 调色板(ARGB8888, 256/16项) + 索引;
+ * 读取时经256项查找表展开为面板字节序的RGB565, 输出与RGB565 bundle相同
+ *
+ * 精灵bundle: 背景图只存一份, 每帧只存小鸟包围盒内的RGB565A8精灵,
+ * 播放时背景作为独立LVGL对象显示一次, 只更新精灵对象
+ *
+ * 对齐bundle: 常驻一个POSIX文件句柄, 像素数据按整扇区直接读入目标缓冲区
+ * (绕过stdio缓冲, FatFs对整扇区请求使用多块读取, 不经过扇区窗口拷贝);
+ * 打开时再沿簇链建立一次扇区映射, 之后按索引直接用disk_read多块读取像素数据,
+ * 不再经过FatFs的文件定位和FAT表查找; 文件碎片过多或读取失败时退回POSIX句柄
+ *
+ * flash收藏库中的bundle(loadFavourite): 整个文件映射到地址空间, 索引直接读映射区域,
+ * 帧的img_dsc->data指向flash, 描述符来自加载器内部, 不读SD也不分配内存
  */
 class BirdBundleLoader {
 public:
@@ -55,15 +142,40 @@ public:
      */
     bool loadBundle(const std::string& bundle_path);
 
+    /**
+     * 从flash收藏分区映射小鸟的bundle
+     *
+     * 不在收藏库中或映射失败时返回false, 调用方改用loadBundle;
+     * 之后loadFrame/loadBackground返回的描述符须经releaseMappedFrame归还
+     */
+    bool loadFavourite(uint16_t bird_id);
+
+    /**
+     * 是否从flash映射读取
+     */
+    bool isMapped() const { return mapped_ != nullptr; }
+
+    /**
+     * 归还映射帧的描述符(像素在flash中, 无需释放), 不属于本加载器时返回false
+     */
+    bool releaseMappedFrame(const lv_image_dsc_t* dsc);
+
     /**
      * 从bundle中加载指定帧
      *
      * @param frame_index 帧索引 (0-based，最大65535)
      * @param out_dsc 输出LVGL图像描述符指针
      * @param out_data 输出图像数据指针
+     * @param out_pos 输出精灵位置(可选, 非精灵bundle为0,0)
      * @return 成功返回true
      */
-    bool loadFrame(uint16_t frame_index, lv_image_dsc_t** out_dsc, uint8_t** out_data);
+    bool loadFrame(uint16_t frame_index, lv_image_dsc_t** out_dsc, uint8_t** out_data,
+                   FramePlacement* out_pos = nullptr);
+
+    /**
+     * 加载精灵bundle的背景图
+     */
+    bool loadBackground(lv_image_dsc_t** out_dsc, uint8_t** out_data);
 
     /**
      * 获取bundle中的帧数
@@ -80,6 +192,78 @@ public:
      */
     uint16_t getFrameHeight() const { return header_.frame_height; }
 
+    /**
+     * 帧显示时长(毫秒, 0表示使用默认帧间隔)
+     */
+    uint16_t getFrameDuration(uint16_t frame_index) const;
+
+    /**
+     * 帧在bundle文件中的大小(即从SD读取的字节数, 失败返回0)
+     */
+    uint32_t getFrameFileSize(uint16_t frame_index) const;
+
+    /**
+     * 精灵bundle背景图在文件中的大小
+     */
+    uint32_t getBackgroundFileSize() const { return header_.background_size; }
+
+    /**
+     * 单帧加载后占用内存的估计(精灵bundle按平均精灵大小, 1位掩码展开后约为存储的1.5倍)
+     */
+    uint32_t estimateFrameBytes() const;
+
+    /**
+     * 两帧是否为同一份数据(合并/别名), 切换时无需重新读取和刷新
+     */
+    bool isSameFrameData(uint16_t a, uint16_t b) const;
+
+    /**
+     * 是否为等步长bundle(按帧号计算偏移, 不读索引)
+     */
+    bool isUniform() const { return (header_.flags & BUNDLE_FLAG_UNIFORM) != 0; }
+
+    /**
+     * 像素是否为面板字节序(RGB565_SWAPPED)
+     */
+    bool isNativeByteOrder() const { return header_.color_format == LV_COLOR_FORMAT_RGB565_SWAPPED; }
+
+    /**
+     * 是否为索引色(I8/I4) bundle
+     */
+    bool isIndexed() const {
+        return header_.color_format == LV_COLOR_FORMAT_I8 || header_.color_format == LV_COLOR_FORMAT_I4;
+    }
+
+    /**
+     * 是否为精灵bundle(背景 + 每帧精灵)
+     */
+    bool isSprite() const { return (header_.flags & BUNDLE_FLAG_SPRITE) != 0; }
+
+    /**
+     * 是否使用扇区对齐直读
+     */
+    bool isAlignedDirect() const { return fd_ >= 0; }
+
+    /**
+     * 是否使用扇区映射直接读卡(绕过FatFs)
+     */
+    bool isRawSectorRead() const { return raw_reads_ && extent_count_ > 0; }
+
+    /**
+     * 开关扇区直读(测速对比用), bundle不支持时返回false
+     */
+    bool setRawSectorReads(bool enabled);
+
+    /**
+     * 扇区映射的段数(1表示文件完全连续)
+     */
+    uint8_t getExtentCount() const { return extent_count_; }
+
+    /**
+     * SD上的文件被改写或删除前调用: 簇链可能改变, 所有加载器在下次直读时丢弃扇区映射
+     */
+    static void invalidateExtentMaps();
+
     /**
      * 检查bundle是否已加载
      */
@@ -92,14 +276,109 @@ public:
 
 private:
     BirdBundleHeader header_;
-    std::vector<FrameIndexEntry> index_table_;
+    uint32_t frame_stride_;      // 等步长bundle的帧间距
     std::string bundle_path_;
     bool is_loaded_;
+    int fd_;                     // 对齐bundle的常驻POSIX句柄(-1: 使用File逐帧打开)
+
+    // 索引分页缓存(block == 0xFFFF为空), 查询帧时长等const接口也会填充
+    struct IndexBlock {
+        uint16_t block;
+        uint32_t last_use;
+        FrameIndexEntry entries[BUNDLE_INDEX_BLOCK_ENTRIES];
+    };
+    mutable IndexBlock index_cache_[BUNDLE_INDEX_CACHE_BLOCKS];
+    mutable uint32_t index_use_counter_;
+
+    // 扇区映射(extent_count_ == 0: 不可用)
+    BundleExtent extents_[BUNDLE_MAX_EXTENTS];
+    uint8_t extent_count_;
+    uint8_t pdrv_;               // FatFs物理驱动器号
+    FATFS* fs_;                  // 直读时加FatFs卷锁(SD只在启动时挂载一次)
+    uint32_t extent_generation_; // 建立映射时的invalidateExtentMaps()计数
+    bool raw_reads_;
+
+    // flash映射(mapped_为空: 从SD读取)
+    const uint8_t* mapped_;
+    uint32_t mapped_size_;
+    uint16_t mapped_bird_;
+    lv_image_dsc_t mapped_dscs_[BUNDLE_MAPPED_DESCRIPTORS];
+    uint8_t mapped_dsc_used_;    // 按位标记借出的描述符
+
+    // 调色板查找表(已转换为输出字节序的RGB565)
+    uint16_t palette_lut_[256];
+    bool palette_valid_;
+    uint8_t read_buf_[BUNDLE_READ_CHUNK];
 
     /**
      * 验证bundle文件头部
      */
     bool validateHeader();
+
+    /**
+     * 根据头部计算帧步长, 等步长标志无效时清除
+     */
+    void setupFrameAddressing();
+
+    /**
+     * 获取帧的索引项(等步长bundle直接计算, 其他经分页缓存读取)
+     */
+    bool getFrameEntry(uint16_t frame_index, FrameIndexEntry& out) const;
+
+    /**
+     * 从文件读取一块索引项(v1的12字节项补齐为16字节)
+     */
+    bool readIndexBlock(uint16_t block, FrameIndexEntry* out) const;
+
+    /**
+     * 清空索引分页缓存
+     */
+    void resetIndexCache();
+
+    /**
+     * 读取offset处的LVGL图像(frame_index < 0 表示背景图)
+     */
+    bool readImage(uint32_t offset, int32_t frame_index, lv_image_dsc_t** out_dsc,
+                   uint8_t** out_data, FramePlacement* out_pos);
+
+    /**
+     * 通过常驻句柄读取对齐bundle的帧(头部 + 整扇区像素数据)
+     */
+    bool readAlignedImage(uint32_t offset, int32_t frame_index, lv_image_dsc_t** out_dsc, uint8_t** out_data);
+
+    /**
+     * 从flash映射区域取得offset处的LVGL图像: 普通帧和A8精灵零拷贝, 1位掩码精灵展开到堆上
+     */
+    bool readMappedImage(uint32_t offset, int32_t frame_index, lv_image_dsc_t** out_dsc,
+                         uint8_t** out_data, FramePlacement* out_pos);
+
+    /**
+     * 沿簇链建立bundle文件的扇区映射
+     */
+    bool buildExtentMap();
+
+    /**
+     * 按扇区映射直接读卡: 读取帧的整扇区像素数据(不读LVGL头, 尺寸来自bundle头和索引)
+     */
+    bool readRawImage(const FrameIndexEntry& entry, uint16_t frame_index,
+                      lv_image_dsc_t** out_dsc, uint8_t** out_data);
+
+    /**
+     * 从文件内扇区file_sector开始读取count个扇区
+     */
+    bool readSectors(uint32_t file_sector, uint32_t count, uint8_t* out);
+
+    /**
+     * 读取精灵的颜色平面和透明度平面(1位掩码展开为A8)
+     */
+    bool readSpritePixels(File& file, uint32_t flags, uint16_t width, uint16_t height,
+                          uint32_t data_size, uint8_t* out);
+
+    /**
+     * 读取索引色帧的调色板和索引, 展开为RGB565写入out
+     */
+    bool readIndexedPixels(File& file, uint8_t color_format, uint16_t width, uint16_t height,
+                           uint32_t stride, uint32_t data_size, uint16_t* out);
 };
 
 } // namespace BirdWatching
@@ -1,10 +1,13 @@
 #include "bird_manager.h"
 #include "bird_utils.h"
+#include "favourite_store.h"
 #include "system/logging/log_manager.h"
 #include "drivers/sensors/imu/imu.h"
 #include "drivers/io/rgb_led/rgb_led.h"
+#include "system/tasks/task_manager.h"
 #include "config/ui_texts.h"
 #include <cstdlib>
+#include <cstring>
 #include "esp_system.h"
 
 // 声明外部全局对象
@@ -29,11 +32,12 @@ BirdManager::BirdManager()
     , system_start_time_(0)
     , bird_info_show_time_(0)
     , bird_info_visible_(false)
+    , first_pixel_start_ms_(0)
+    , first_pixel_pending_(false)
+    , first_pixel_warm_(false)
+    , refr_cb_registered_(false)
 {
-    trigger_request_.pending = false;
-    trigger_request_.type = TRIGGER_AUTO;
-    trigger_request_.bird_id = 0;
-    trigger_request_.record_stats = true;
+    resetTriggerLatency();
 }
 
 BirdManager::~BirdManager() {
@@ -96,30 +100,143 @@ void BirdManager::update() {
     }
 }
 
-void BirdManager::processTriggerRequest() {
+void BirdManager::processTriggerRequest(const BirdTriggerMsg& request) {
     if (!initialized_) {
         return;
     }
 
     // 注意: 此函数在UI任务中调用,已持有LVGL锁
 
-    // 安全地处理动画播放
-    if (trigger_request_.pending) {
-        bool record_stats = trigger_request_.record_stats;
-        trigger_request_.pending = false;
-
-        if (isPlaying()) {
-            animation_->stop();
+    // 首帧上屏以刷新完成事件为准(此时像素已经通过flush送到屏幕)
+    if (!refr_cb_registered_) {
+        lv_display_t* disp = lv_display_get_default();
+        if (disp) {
+            lv_display_add_event_cb(disp, refreshReadyCallback, LV_EVENT_REFR_READY, this);
+            refr_cb_registered_ = true;
         }
+    }
+    uint32_t start = request.request_ms ? request.request_ms : millis();
+
+    // 安全地处理动画播放: 保留当前画面, 新小鸟开始播放后交叉淡化过去(避免黑屏)
+    if (isPlaying()) {
+        animation_->beginTransition();
+        animation_->stop();
+    }
+
+    bool played;
+    if (request.bird_id > 0) {
+        // 播放指定的小鸟
+        played = playBird(request.bird_id, request.record_stats);
+    } else {
+        // 播放随机小鸟（总是记录统计）
+        played = playRandomBird();
+    }
+
+    if (!played) {
+        animation_->cancelTransition();
+    } else {
+        first_pixel_start_ms_ = start;
+        first_pixel_warm_ = animation_->wasLastLoadWarm();
+        first_pixel_pending_ = true;
+    }
+
+    // 预先抽取下一只随机小鸟, 在播放空闲时预热, 下次触发可直接切换
+    prepareNextBird();
+}
+
+void BirdManager::prepareNextBird() {
+    if (!selector_ || !animation_ || !animation_->isWarmStartEnabled()) {
+        next_random_bird_ = BirdInfo();
+        return;
+    }
+
+    next_random_bird_ = selector_->getRandomBird();
+    animation_->warmBird(next_random_bird_);
+}
+
+void BirdManager::setWarmStart(bool enabled) {
+    if (!animation_) {
+        return;
+    }
+    animation_->setWarmStart(enabled);
+    if (enabled) {
+        prepareNextBird();
+    } else {
+        next_random_bird_ = BirdInfo();
+    }
+    LOG_INFO("BIRD", String("Warm start ") + (enabled ? "enabled" : "disabled"));
+}
+
+void BirdManager::setFadeSteps(uint8_t steps) {
+    if (!animation_) {
+        return;
+    }
+    animation_->setFadeSteps(steps);
+    LOG_INFO("BIRD", "Cross-fade steps: " + String(animation_->getFadeSteps()));
+}
+
+void BirdManager::refreshReadyCallback(lv_event_t* e) {
+    BirdManager* manager = static_cast<BirdManager*>(lv_event_get_user_data(e));
+    if (manager) {
+        manager->onRefreshReady();
+    }
+}
+
+void BirdManager::onRefreshReady() {
+    if (!first_pixel_pending_) {
+        return;
+    }
+    first_pixel_pending_ = false;
+
+    uint32_t latency = millis() - first_pixel_start_ms_;
+    LatencyStats& stats = latency_[first_pixel_warm_ ? 1 : 0];
+    if (stats.count == 0 || latency < stats.min_ms) {
+        stats.min_ms = latency;
+    }
+    if (latency > stats.max_ms) {
+        stats.max_ms = latency;
+    }
+    stats.total_ms += latency;
+    stats.last_ms = latency;
+    stats.count++;
 
-        if (trigger_request_.bird_id > 0) {
-            // 播放指定的小鸟
-            playBird(trigger_request_.bird_id, record_stats);
-        } else {
-            // 播放随机小鸟（总是记录统计）
-            playRandomBird();
+    LOG_INFO("BIRD", "Trigger to first pixel: " + String(latency) + " ms (" +
+             (first_pixel_warm_ ? "warm" : "cold") + ")");
+}
+
+void BirdManager::printTriggerLatency() {
+    static const char* const kNames[2] = { "cold", "warm" };
+    Serial.println("=== Trigger to First Pixel ===");
+    Serial.printf("Warm start: %s, next random bird: %u\r\n",
+                  isWarmStartEnabled() ? "on" : "off", next_random_bird_.id);
+    for (int i = 0; i < 2; i++) {
+        const LatencyStats& stats = latency_[i];
+        if (stats.count == 0) {
+            Serial.printf("%s: no samples\r\n", kNames[i]);
+            continue;
         }
+        Serial.printf("%s: %u triggers, avg %u ms, min %u ms, max %u ms, last %u ms\r\n", kNames[i],
+                      stats.count, stats.total_ms / stats.count, stats.min_ms, stats.max_ms, stats.last_ms);
+    }
+}
+
+void BirdManager::resetTriggerLatency() {
+    memset(latency_, 0, sizeof(latency_));
+}
+
+bool BirdManager::postTriggerRequest(uint16_t bird_id, TriggerType trigger_type, bool record_stats) {
+    BirdTriggerMsg request;
+    request.bird_id = bird_id;
+    request.trigger_type = (uint8_t)trigger_type;
+    request.record_stats = record_stats;
+    request.request_ms = millis();
+
+    // 非阻塞投递; 若UI任务尚未处理上一个请求, 会被本次请求合并覆盖
+    if (!TaskManager::getInstance()->sendToUITask(request)) {
+        LOG_WARN("BIRD_MGR", "UI queue full, trigger request dropped");
+        return false;
     }
+    return true;
 }
 
 bool BirdManager::triggerBird(TriggerType trigger_type) {
@@ -128,13 +245,8 @@ bool BirdManager::triggerBird(TriggerType trigger_type) {
         return false;
     }
 
-    // 设置触发请求,由UI任务处理
-    trigger_request_.pending = true;
-    trigger_request_.type = trigger_type;
-    trigger_request_.bird_id = 0; // 随机小鸟
-    trigger_request_.record_stats = true;
-
-    return true;
+    // 投递触发请求(随机小鸟),由UI任务处理
+    return postTriggerRequest(0, trigger_type, true);
 }
 
 bool BirdManager::triggerBirdById(uint16_t bird_id, TriggerType trigger_type) {
@@ -163,11 +275,10 @@ bool BirdManager::triggerBirdById(uint16_t bird_id, TriggerType trigger_type) {
         return false;
     }
 
-    // 设置触发请求,由UI任务处理
-    trigger_request_.pending = true;
-    trigger_request_.type = trigger_type;
-    trigger_request_.bird_id = bird_id; // 指定小鸟
-    trigger_request_.record_stats = true;
+    // 投递触发请求(指定小鸟),由UI任务处理
+    if (!postTriggerRequest(bird_id, trigger_type, true)) {
+        return false;
+    }
 
     LOG_INFO("BIRD_MGR", String("Trigger request set for bird ID: ") + String(bird_id));
     return true;
@@ -184,13 +295,8 @@ bool BirdManager::playBirdWithoutRecording(uint16_t bird_id) {
         return false;
     }
 
-    // 设置触发请求,由UI任务处理（不记录统计）
-    trigger_request_.pending = true;
-    trigger_request_.type = TRIGGER_AUTO;
-    trigger_request_.bird_id = bird_id;
-    trigger_request_.record_stats = false;
-
-    return true;
+    // 投递触发请求,由UI任务处理（不记录统计）
+    return postTriggerRequest(bird_id, TRIGGER_AUTO, false);
 }
 
 void BirdManager::onGestureEvent(int gesture_type) {
@@ -217,6 +323,9 @@ bool BirdManager::initializeSubsystems(lv_obj_t* display_obj) {
     // guider_ui已在文件顶部通过extern "C"声明
     lv_obj_t* canvas_obj = guider_ui.scenes_canvas;
     
+    // flash收藏分区(可选): 常播小鸟从flash映射播放
+    FavouriteStore::getInstance()->init();
+
     // 初始化动画播放器（使用scenes_canvas）
     animation_ = new BirdAnimation();
     if (!animation_ || !animation_->init(canvas_obj)) {
@@ -246,8 +355,9 @@ bool BirdManager::playRandomBird() {
         return false;
     }
 
-    // 随机选择一只小鸟
-    BirdInfo bird = selector_->getRandomBird();
+    // 随机选择一只小鸟: 优先使用预先抽取(已在预热)的那只
+    BirdInfo bird = next_random_bird_.id != 0 ? next_random_bird_ : selector_->getRandomBird();
+    next_random_bird_ = BirdInfo();
     if (bird.id == 0) {
         LOG_ERROR("BIRD", "Failed to select random bird");
         return false;
@@ -287,6 +397,11 @@ bool BirdManager::playBird(uint16_t bird_id, bool record_stats) {
     // 播放动画（循环播放）
     animation_->startLoop();
 
+    // 计入统计的播放决定哪些小鸟同步到flash收藏库
+    if (record_stats) {
+        FavouriteStore::getInstance()->notePlay(bird_id);
+    }
+
     LOG_INFO("BIRD", (String("Playing bird animation (ID: ") + String(bird_id) + 
              ", record: " + String(record_stats ? "yes" : "no") + ")").c_str());
     return true;
@@ -5,6 +5,7 @@
 #include "bird_selector.h"
 #include "bird_types.h"
 #include "drivers/sensors/imu/imu.h"
+#include "system/tasks/task_messages.h"
 #include <string>
 #include <vector>
 
@@ -17,14 +18,6 @@ enum TriggerType {
     TRIGGER_GESTURE         // 手势触发
 };
 
-// 触发请求结构(用于任务间通信)
-struct BirdTriggerRequest {
-    bool pending;
-    TriggerType type;
-    uint16_t bird_id;  // 0表示随机
-    bool record_stats; // 是否记录统计
-};
-
 class BirdManager {
 public:
     BirdManager();
@@ -37,9 +30,9 @@ public:
     void update();
 
     // 处理触发请求(在UI任务中调用)
-    void processTriggerRequest();
+    void processTriggerRequest(const BirdTriggerMsg& request);
 
-    // 手动触发小鸟出现(设置触发请求)
+    // 手动触发小鸟出现(投递触发请求到UI任务)
     bool triggerBird(TriggerType trigger_type = TRIGGER_MANUAL);
     
     // 触发指定小鸟ID
@@ -55,6 +48,9 @@ public:
     bool isInitialized() const { return initialized_; }
     bool isPlaying() const { return animation_ ? animation_->isPlaying() : false; }
 
+    // 设置动画帧间隔(在UI任务中调用)
+    void setFrameInterval(uint32_t interval_ms) { if (animation_) animation_->setFrameInterval(interval_ms); }
+
     // 配置管理
     BirdConfig& getConfig() { return config_; }
     void setConfig(const BirdConfig& config);
@@ -63,6 +59,17 @@ public:
     // 获取小鸟列表
     const std::vector<BirdInfo>& getAllBirds() const;
 
+    // 预热下一只随机小鸟(warm start)开关, 在UI任务中调用(或持有LVGL锁)
+    void setWarmStart(bool enabled);
+    bool isWarmStartEnabled() const { return animation_ ? animation_->isWarmStartEnabled() : false; }
+
+    // 换鸟交叉淡化步数(0: 直接切换), 在UI任务中调用(或持有LVGL锁)
+    void setFadeSteps(uint8_t steps);
+
+    // 触发到首帧上屏的延迟统计(冷启动/预热命中分开)
+    void printTriggerLatency();
+    void resetTriggerLatency();
+
 private:
     bool initialized_;                           // 初始化状态
     bool first_bird_loaded_;                     // 首次小鸟是否已加载
@@ -75,13 +82,34 @@ private:
     uint32_t last_stats_save_time_;              // 上次统计数据保存时间
     uint32_t system_start_time_;                 // 系统启动时间
 
-    // 触发请求(用于跨任务通信)
-    BirdTriggerRequest trigger_request_;
-
     // 小鸟信息显示时间戳
     uint32_t bird_info_show_time_;
     bool bird_info_visible_;
 
+    // 预先抽取的下一只随机小鸟(播放空闲时预热), id为0表示没有
+    BirdInfo next_random_bird_;
+
+    // 触发到首帧上屏的延迟: [0]冷启动, [1]预热命中
+    struct LatencyStats {
+        uint32_t count;
+        uint32_t total_ms;
+        uint32_t min_ms;
+        uint32_t max_ms;
+        uint32_t last_ms;
+    };
+    LatencyStats latency_[2];
+    uint32_t first_pixel_start_ms_;
+    bool first_pixel_pending_;
+    bool first_pixel_warm_;
+    bool refr_cb_registered_;
+
+    // 显示刷新完成(首帧已送到屏幕)时记录延迟
+    static void refreshReadyCallback(lv_event_t* e);
+    void onRefreshReady();
+
+    // 抽取下一只随机小鸟并交给动画预热
+    void prepareNextBird();
+
     // 初始化各个子系统
     bool initializeSubsystems(lv_obj_t* display_obj);
     
@@ -97,6 +125,9 @@ private:
     // 播放指定小鸟（内部使用，可选择是否记录统计）
     bool playBird(uint16_t bird_id, bool record_stats = true);
 
+    // 投递触发请求到UI任务
+    bool postTriggerRequest(uint16_t bird_id, TriggerType trigger_type, bool record_stats);
+
     // 更新手势检测
     void updateGestureDetection();
 
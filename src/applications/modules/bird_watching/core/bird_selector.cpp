@@ -1,6 +1,7 @@
 #include "bird_selector.h"
 #include "bird_utils.h"
 #include "system/logging/log_manager.h"
+#include "system/memory/mem_tracker.h"
 #include "drivers/storage/sd_card/sd_card.h"
 #include "esp_system.h"
 #include <cstdlib>
@@ -59,10 +60,11 @@ namespace {
 
 namespace BirdWatching {
 
-BirdSelector::BirdSelector() : total_weight_(0) {
+BirdSelector::BirdSelector() : total_weight_(0), accounted_bytes_(0) {
 }
 
 BirdSelector::~BirdSelector() {
+    MemTracker::adjust(MEM_TAG_SELECTOR, -(int32_t)accounted_bytes_);
 }
 
 bool BirdSelector::initialize(const std::string& config_path) {
@@ -83,6 +85,8 @@ bool BirdSelector::initialize(const std::string& config_path) {
 
     LOG_INFO("SELECTOR", "Bird selector initialized");
 
+    updateMemoryAccounting();
+
     return !birds_.empty();
 }
 
@@ -120,6 +124,17 @@ const BirdInfo* BirdSelector::findBird(const std::string& name) const {
     return nullptr;
 }
 
+void BirdSelector::updateMemoryAccounting() {
+    // 小鸟列表由std::vector/std::string持有, 按容量手动记账
+    size_t bytes = birds_.capacity() * sizeof(BirdInfo);
+    for (const auto& bird : birds_) {
+        bytes += bird.name.capacity() + 1;
+    }
+
+    MemTracker::adjust(MEM_TAG_SELECTOR, (int32_t)bytes - (int32_t)accounted_bytes_);
+    accounted_bytes_ = bytes;
+}
+
 bool BirdSelector::reloadConfig() {
     return initialize("S:/configs/bird_config.csv");
 }
@@ -153,7 +168,12 @@ bool BirdSelector::loadBirdConfig(const std::string& config_path) {
         return false;
     }
 
-    char* buffer = new char[file_size + 1];
+    char* buffer = static_cast<char*>(MemTracker::alloc(MEM_TAG_SELECTOR, file_size + 1));
+    if (!buffer) {
+        LOG_ERROR("SELECTOR", "Failed to allocate config buffer");
+        file.close();
+        return false;
+    }
     size_t bytes_read = file.readBytes(buffer, file_size);
     buffer[bytes_read] = '\0';
     file.close();
@@ -233,7 +253,7 @@ bool BirdSelector::loadBirdConfig(const std::string& config_path) {
     snprintf(complete_msg, sizeof(complete_msg), "Parsing complete. Found %d valid birds", bird_count);
     LOG_INFO("SELECTOR", complete_msg);
 
-    delete[] buffer;
+    MemTracker::free(buffer);
 
     if (!birds_.empty()) {
         LOG_INFO("SELECTOR", "Bird config loaded successfully");
@@ -36,6 +36,7 @@ public:
 private:
     std::vector<BirdInfo> birds_;    // 小鸟列表
     int total_weight_;               // 总权重
+    size_t accounted_bytes_;         // 已计入内存统计的字节数
 
     // 从JSON配置文件加载小鸟列表
     bool loadBirdConfig(const std::string& config_path);
@@ -43,6 +44,9 @@ private:
     // 从单个小鸟目录加载信息
     bool loadBirdInfo(const std::string& bird_dir_path);
 
+    // 更新小鸟列表的内存统计
+    void updateMemoryAccounting();
+
     // 验证小鸟资源是否完整
     bool validateBirdResources(const BirdInfo& bird) const;
 };
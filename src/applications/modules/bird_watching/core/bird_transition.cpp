@@ -0,0 +1,208 @@
+#include "bird_transition.h"
+#include "system/logging/log_manager.h"
+#include "system/memory/mem_tracker.h"
+#include <cstring>
+
+namespace BirdWatching {
+
+// 一个32位字中两个RGB565像素(低16位为像素0)的字段分成两组, 每个字段上方至少空出5位,
+// 乘以alpha(最大32)不会溢出到相邻字段:
+//   组X: 像素0的B(0-4)、R(11-15), 像素1的G(21-26)
+//   组Y: 像素0的G(5-10), 像素1的B(16-20)、R(27-31), 先右移5位再乘
+#define BLEND_MASK_X    0x07E0F81FUL
+#define BLEND_MASK_Y    0xF81F07E0UL
+
+static inline uint32_t swapPixelPair(uint32_t w) {
+    return ((w & 0x00FF00FFUL) << 8) | ((w >> 8) & 0x00FF00FFUL);
+}
+
+static inline uint32_t blendPair(uint32_t dst, uint32_t src, uint32_t alpha) {
+    uint32_t inv = 32 - alpha;
+    uint32_t x = (((src & BLEND_MASK_X) * alpha + (dst & BLEND_MASK_X) * inv) >> 5) & BLEND_MASK_X;
+    uint32_t y = (((src & BLEND_MASK_Y) >> 5) * alpha + ((dst & BLEND_MASK_Y) >> 5) * inv) & BLEND_MASK_Y;
+    return x | y;
+}
+
+// 单个像素: 把G移到高16位后与组X的掩码相同
+static inline uint16_t blendPixel(uint16_t dst, uint16_t src, uint32_t alpha) {
+    uint32_t s = (src | ((uint32_t)src << 16)) & BLEND_MASK_X;
+    uint32_t d = (dst | ((uint32_t)dst << 16)) & BLEND_MASK_X;
+    uint32_t r = ((s * alpha + d * (32 - alpha)) >> 5) & BLEND_MASK_X;
+    return (uint16_t)(r | (r >> 16));
+}
+
+static inline uint16_t swapPixel(uint16_t p) {
+    return (uint16_t)((p << 8) | (p >> 8));
+}
+
+void BirdTransition::blendRGB565(uint16_t* dst, const uint16_t* src, uint32_t pixels, uint8_t alpha, bool swapped) {
+    if (alpha >= 32) {
+        memcpy(dst, src, pixels * 2);
+        return;
+    }
+    if (alpha == 0) {
+        return;
+    }
+
+    if ((((uintptr_t)dst | (uintptr_t)src) & 3) == 0) {
+        uint32_t* d = reinterpret_cast<uint32_t*>(dst);
+        const uint32_t* s = reinterpret_cast<const uint32_t*>(src);
+        uint32_t words = pixels / 2;
+        if (swapped) {
+            for (uint32_t i = 0; i < words; i++) {
+                d[i] = swapPixelPair(blendPair(swapPixelPair(d[i]), swapPixelPair(s[i]), alpha));
+            }
+        } else {
+            for (uint32_t i = 0; i < words; i++) {
+                d[i] = blendPair(d[i], s[i], alpha);
+            }
+        }
+        dst += words * 2;
+        src += words * 2;
+        pixels -= words * 2;
+    }
+
+    for (uint32_t i = 0; i < pixels; i++) {
+        dst[i] = swapped ? swapPixel(blendPixel(swapPixel(dst[i]), swapPixel(src[i]), alpha))
+                         : blendPixel(dst[i], src[i], alpha);
+    }
+}
+
+BirdTransition::BirdTransition()
+    : buffer_(nullptr)
+    , steps_(BIRD_FADE_STEPS)
+    , step_(0)
+    , begin_ms_(0)
+    , blend_us_(0)
+{
+    memset(&dsc_, 0, sizeof(dsc_));
+}
+
+BirdTransition::~BirdTransition() {
+    end();
+}
+
+bool BirdTransition::begin(const lv_image_dsc_t* base, const lv_image_dsc_t* sprite, const FramePlacement& pos) {
+    end();
+
+    if (steps_ == 0 || !base || !base->data) {
+        return false;
+    }
+    uint8_t cf = base->header.cf;
+    if (cf != LV_COLOR_FORMAT_RGB565 && cf != LV_COLOR_FORMAT_RGB565_SWAPPED) {
+        return false;
+    }
+
+    uint32_t size = (uint32_t)base->header.w * base->header.h * 2;
+    if (base->header.stride != base->header.w * 2 || base->data_size < size) {
+        return false;
+    }
+
+    buffer_ = static_cast<uint8_t*>(MemTracker::allocAligned(MEM_TAG_ANIMATION, size, 4));
+    if (!buffer_) {
+        LOG_WARN("FADE", "No memory for transition buffer (" + String(size) + " B), switching directly");
+        return false;
+    }
+    memcpy(buffer_, base->data, size);
+
+    dsc_.header = base->header;
+    dsc_.header.flags = 0;
+    dsc_.header.reserved_2 = 0;
+    dsc_.data_size = size;
+    dsc_.data = buffer_;
+
+    if (sprite && sprite->header.cf == LV_COLOR_FORMAT_RGB565A8) {
+        compositeSprite(sprite, pos);
+    }
+
+    step_ = 0;
+    begin_ms_ = millis();
+    blend_us_ = 0;
+    return true;
+}
+
+void BirdTransition::compositeSprite(const lv_image_dsc_t* sprite, const FramePlacement& pos) {
+    // RGB565A8: 颜色平面(w*h*2, 不交换字节)之后是透明度平面(w*h)
+    int32_t sw = sprite->header.w;
+    int32_t sh = sprite->header.h;
+    if (sprite->data_size < (uint32_t)(sw * sh * 3)) {
+        return;
+    }
+
+    const uint16_t* color = reinterpret_cast<const uint16_t*>(sprite->data);
+    const uint8_t* alpha = sprite->data + sw * sh * 2;
+    uint16_t* dst = reinterpret_cast<uint16_t*>(buffer_);
+    int32_t w = dsc_.header.w;
+    int32_t h = dsc_.header.h;
+    bool swapped = dsc_.header.cf == LV_COLOR_FORMAT_RGB565_SWAPPED;
+
+    for (int32_t y = 0; y < sh; y++) {
+        int32_t dy = pos.y + y;
+        if (dy < 0 || dy >= h) {
+            continue;
+        }
+        for (int32_t x = 0; x < sw; x++) {
+            int32_t dx = pos.x + x;
+            uint8_t a = alpha[y * sw + x];
+            if (dx < 0 || dx >= w || a == 0) {
+                continue;
+            }
+            uint16_t* p = &dst[dy * w + dx];
+            uint16_t bg = swapped ? swapPixel(*p) : *p;
+            uint16_t out = blendPixel(bg, color[y * sw + x], (a + 4) >> 3);
+            *p = swapped ? swapPixel(out) : out;
+        }
+    }
+}
+
+void BirdTransition::restart() {
+    step_ = 0;
+    begin_ms_ = millis();
+    blend_us_ = 0;
+}
+
+bool BirdTransition::isCompatible(const lv_image_dsc_t* target) const {
+    return buffer_ && target && target->data &&
+           target->header.cf == dsc_.header.cf &&
+           target->header.w == dsc_.header.w &&
+           target->header.h == dsc_.header.h &&
+           target->header.stride == dsc_.header.stride &&
+           target->data_size >= dsc_.data_size;
+}
+
+bool BirdTransition::step(const lv_image_dsc_t* target) {
+    if (!isCompatible(target)) {
+        return true;
+    }
+
+    // 第k步与目标按1/(N-k+1)混合, 累积起来等于从旧画面到新画面的线性淡化
+    step_++;
+    uint32_t remaining = steps_ > step_ ? steps_ - step_ + 1 : 1;
+    uint8_t alpha = (uint8_t)((32 + remaining / 2) / remaining);
+
+    uint32_t start = micros();
+    blendRGB565(reinterpret_cast<uint16_t*>(buffer_), reinterpret_cast<const uint16_t*>(target->data),
+                (uint32_t)dsc_.header.w * dsc_.header.h, alpha,
+                dsc_.header.cf == LV_COLOR_FORMAT_RGB565_SWAPPED);
+    blend_us_ += micros() - start;
+
+    return step_ >= steps_;
+}
+
+void BirdTransition::end() {
+    if (!buffer_) {
+        return;
+    }
+
+    if (step_ > 0) {
+        LOG_INFO("FADE", "Cross-fade done: " + String(step_) + " steps in " + String(millis() - begin_ms_) +
+                 " ms, blend " + String(blend_us_ / step_) + " us/step");
+    }
+    MemTracker::free(buffer_);
+    buffer_ = nullptr;
+    dsc_.data = nullptr;
+    dsc_.data_size = 0;
+    step_ = 0;
+}
+
+} // namespace BirdWatching
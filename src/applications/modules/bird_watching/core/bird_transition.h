@@ -0,0 +1,77 @@
+#ifndef BIRD_TRANSITION_H
+#define BIRD_TRANSITION_H
+
+#include <Arduino.h>
+#include <lvgl.h>
+#include "bird_bundle_loader.h"
+
+// 换鸟淡入淡出的步数(每步一个动画定时器周期20ms, 0表示直接切换)
+#define BIRD_FADE_STEPS         8
+#define BIRD_FADE_MAX_STEPS     32
+
+namespace BirdWatching {
+
+/**
+ * @brief 换鸟时的交叉淡化
+ *
+ * - begin(): 把即将退出的画面(普通帧, 或精灵bundle的背景+精灵)拷贝到过渡缓冲区,
+ *   显示对象改为显示缓冲区, 旧小鸟的帧随即释放, 新小鸟加载期间屏幕不会变黑
+ * - step(): 缓冲区每步朝新小鸟当前显示的画面混合一次, 最后一步与目标完全相同;
+ *   目标可以在过程中变化(新小鸟照常播放), 加载延迟被隐藏在淡化过程中
+ * - 只支持同尺寸的RGB565/RGB565_SWAPPED画面, 其他情况调用方直接切换
+ *
+ * 混合核一次处理一个32位字中的两个像素, 见blendRGB565()
+ */
+class BirdTransition {
+public:
+    BirdTransition();
+    ~BirdTransition();
+
+    // 拷贝退出画面: base为显示对象上的图像, sprite非空时按pos叠加(RGB565A8)
+    // 步数为0、格式不支持或内存不足时返回false
+    bool begin(const lv_image_dsc_t* base, const lv_image_dsc_t* sprite, const FramePlacement& pos);
+
+    // 过渡中再次换鸟: 以缓冲区当前内容(屏幕上的画面)为起点重新计步
+    void restart();
+
+    // 目标画面能否与缓冲区混合(尺寸和颜色格式相同)
+    bool isCompatible(const lv_image_dsc_t* target) const;
+
+    // 朝目标推进一步, 返回true表示已完成(缓冲区内容等于目标)
+    bool step(const lv_image_dsc_t* target);
+
+    // 结束过渡并释放缓冲区(调用前显示对象不能再引用getImage())
+    void end();
+
+    bool isActive() const { return buffer_ != nullptr; }
+    uint8_t getStep() const { return step_; }
+    uint32_t getBufferSize() const { return dsc_.data_size; }
+    lv_image_dsc_t* getImage() { return &dsc_; }
+
+    void setSteps(uint8_t steps) { steps_ = steps > BIRD_FADE_MAX_STEPS ? BIRD_FADE_MAX_STEPS : steps; }
+    uint8_t getSteps() const { return steps_; }
+
+    // dst = dst + (src - dst) * alpha / 32, alpha范围0..32
+    // 两个缓冲区4字节对齐时按32位字(两个像素)处理, 否则逐像素
+    static void blendRGB565(uint16_t* dst, const uint16_t* src, uint32_t pixels, uint8_t alpha, bool swapped);
+
+private:
+    lv_image_dsc_t dsc_;
+    uint8_t* buffer_;
+    uint8_t steps_;
+    uint8_t step_;
+
+    // 统计(结束时输出日志)
+    uint32_t begin_ms_;
+    uint32_t blend_us_;
+
+    // 把RGB565A8精灵按其透明度叠加到缓冲区
+    void compositeSprite(const lv_image_dsc_t* sprite, const FramePlacement& pos);
+
+    BirdTransition(const BirdTransition&) = delete;
+    BirdTransition& operator=(const BirdTransition&) = delete;
+};
+
+} // namespace BirdWatching
+
+#endif // BIRD_TRANSITION_H
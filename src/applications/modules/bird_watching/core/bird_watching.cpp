@@ -1,6 +1,11 @@
 #include "bird_watching.h"
 #include "bird_utils.h"
+#include "bird_bundle_loader.h"
 #include "system/logging/log_manager.h"
+#include "system/memory/mem_tracker.h"
+#include "drivers/storage/sd_card/sd_card.h"
+#include "system/tasks/task_manager.h"
+#include <memory>
 
 namespace BirdWatching {
 
@@ -32,9 +37,9 @@ bool initializeBirdWatching(lv_obj_t* display_obj) {
     return true;
 }
 
-void processBirdTriggerRequest() {
+void handleTriggerRequest(const BirdTriggerMsg& request) {
     if (g_birdManager) {
-        g_birdManager->processTriggerRequest();
+        g_birdManager->processTriggerRequest(request);
     }
 }
 
@@ -62,6 +67,12 @@ void onGesture(int gesture_type) {
     g_birdManager->onGestureEvent(gesture_type);
 }
 
+void setFrameInterval(uint32_t interval_ms) {
+    if (g_birdManager) {
+        g_birdManager->setFrameInterval(interval_ms);
+    }
+}
+
 void listBirds() {
     if (!g_birdManager) {
         Serial.println("Bird watching system not initialized");
@@ -105,6 +116,134 @@ void listBirds() {
     }
 }
 
+void benchmarkBundle(uint16_t bird_id) {
+    char bundle_path[64];
+    snprintf(bundle_path, sizeof(bundle_path), "/birds/%d/bundle.bin", bird_id);
+
+    // 加载器含读缓冲和索引缓存, 放在堆上避免占用串口任务栈
+    std::unique_ptr<BirdBundleLoader> loader_ptr(new BirdBundleLoader());
+    BirdBundleLoader& loader = *loader_ptr;
+    if (!loader.loadBundle(bundle_path)) {
+        Serial.printf("Failed to load %s\r\n", bundle_path);
+        return;
+    }
+
+    Serial.printf("%s: %u frames %ux%u, SPI clock %u MHz\r\n", bundle_path, loader.getFrameCount(),
+                  loader.getFrameWidth(), loader.getFrameHeight(), tf.getMountFrequency() / 1000000);
+
+    // 两种读取路径各读一遍全部帧(不显示), 帧率只反映SD读取
+    static const char* const kPathNames[] = { "raw sector", "FAT" };
+    for (int pass = 0; pass < 2; pass++) {
+        bool raw = pass == 0;
+        if (!loader.setRawSectorReads(raw)) {
+            Serial.printf("%-10s: n/a (%s)\r\n", kPathNames[pass],
+                          loader.isAlignedDirect() ? "file fragmented or sector size != 512" : "bundle not aligned, repack with --align");
+            continue;
+        }
+
+        uint32_t bytes = 0;
+        uint16_t frames = 0;
+        uint32_t start = millis();
+        for (uint16_t i = 0; i < loader.getFrameCount(); i++) {
+            lv_image_dsc_t* dsc = nullptr;
+            uint8_t* data = nullptr;
+            if (!loader.loadFrame(i, &dsc, &data)) {
+                break;
+            }
+            bytes += dsc->data_size;
+            frames++;
+            MemTracker::free(data);
+            MemTracker::free(dsc);
+        }
+        uint32_t elapsed = millis() - start;
+        if (elapsed == 0) {
+            elapsed = 1;
+        }
+
+        uint32_t fps_x10 = (uint32_t)frames * 10000 / elapsed;
+        Serial.printf("%-10s: %u frames in %u ms, %u.%u fps, %u KB/s\r\n", kPathNames[pass], frames, elapsed,
+                      fps_x10 / 10, fps_x10 % 10, (uint32_t)((uint64_t)bytes * 1000 / 1024 / elapsed));
+    }
+
+    if (loader.getExtentCount() > 1) {
+        Serial.printf("Note: bundle spans %u extents, copying it to a freshly formatted card makes it contiguous\r\n",
+                      loader.getExtentCount());
+    }
+
+    // flash收藏库中的小鸟: 映射读取(零拷贝, 每4字节读一次像素以计入flash cache的读取开销)
+    // 收藏库的映射表归UI任务管理, 映射和解除映射时持有LVGL锁
+    TaskManager* taskMgr = TaskManager::getInstance();
+    if (!taskMgr->takeLVGLMutex(500)) {
+        return;
+    }
+    bool mapped = loader.loadFavourite(bird_id);
+    taskMgr->giveLVGLMutex();
+    if (!mapped) {
+        Serial.printf("%-10s: n/a (not in flash favourites)\r\n", "flash mmap");
+        return;
+    }
+
+    uint32_t bytes = 0;
+    uint16_t frames = 0;
+    uint32_t sum = 0;
+    uint32_t start = millis();
+    for (uint16_t i = 0; i < loader.getFrameCount(); i++) {
+        lv_image_dsc_t* dsc = nullptr;
+        uint8_t* data = nullptr;
+        if (!loader.loadFrame(i, &dsc, &data)) {
+            break;
+        }
+        const uint8_t* p = dsc->data;
+        for (uint32_t n = 0; n < dsc->data_size; n += 4) {
+            sum += p[n];
+        }
+        bytes += dsc->data_size;
+        frames++;
+        if (!loader.releaseMappedFrame(dsc)) {
+            MemTracker::free(data);
+            MemTracker::free(dsc);
+        }
+    }
+    uint32_t elapsed = millis() - start;
+    if (elapsed == 0) {
+        elapsed = 1;
+    }
+    uint32_t fps_x10 = (uint32_t)frames * 10000 / elapsed;
+    Serial.printf("%-10s: %u frames in %u ms, %u.%u fps, %u KB/s (checksum %08X)\r\n", "flash mmap", frames, elapsed,
+                  fps_x10 / 10, fps_x10 % 10, (uint32_t)((uint64_t)bytes * 1000 / 1024 / elapsed), sum);
+
+    if (taskMgr->takeLVGLMutex(500)) {
+        loader.close();
+        taskMgr->giveLVGLMutex();
+    }
+}
+
+void printTriggerLatency() {
+    if (!g_birdManager) {
+        Serial.println("Bird watching system not initialized");
+        return;
+    }
+    g_birdManager->printTriggerLatency();
+}
+
+void resetTriggerLatency() {
+    if (g_birdManager) {
+        g_birdManager->resetTriggerLatency();
+    }
+}
+
+void setWarmStart(bool enabled) {
+    if (g_birdManager) {
+        g_birdManager->setWarmStart(enabled);
+    }
+}
+
+void setFadeSteps(uint8_t steps) {
+    if (g_birdManager) {
+        g_birdManager->setFadeSteps(steps);
+    }
+}
+
 bool isBirdManagerInitialized() {
     return g_birdManager != nullptr;
 }
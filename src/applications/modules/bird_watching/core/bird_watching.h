@@ -25,8 +25,8 @@ namespace BirdWatching {
 // 便捷函数：初始化整个观鸟系统
 bool initializeBirdWatching(lv_obj_t* display_obj = nullptr);
 
-// 便捷函数：处理触发请求(在UI任务中调用)
-void processBirdTriggerRequest();
+// 便捷函数：处理触发请求(在UI任务中调用, 调用方需持有LVGL锁)
+void handleTriggerRequest(const BirdTriggerMsg& request);
 
 // 便捷函数：手动触发小鸟
 // bird_id: 小鸟ID，0表示随机选择
@@ -35,9 +35,25 @@ bool triggerBird(uint16_t bird_id = 0);
 // 便捷函数：处理手势事件
 void onGesture(int gesture_type);
 
+// 便捷函数：设置动画帧间隔(在UI任务中调用, 调用方需持有LVGL锁)
+void setFrameInterval(uint32_t interval_ms);
+
 // 便捷函数：列出所有可用小鸟
 void listBirds();
 
+// 便捷函数：读取小鸟bundle全部帧, 对比扇区直读与FatFs读取的帧率
+void benchmarkBundle(uint16_t bird_id);
+
+// 便捷函数：触发到首帧上屏的延迟统计
+void printTriggerLatency();
+void resetTriggerLatency();
+
+// 便捷函数：预热下一只随机小鸟的开关(调用方需持有LVGL锁)
+void setWarmStart(bool enabled);
+
+// 便捷函数：换鸟交叉淡化步数, 0为直接切换(调用方需持有LVGL锁)
+void setFadeSteps(uint8_t steps);
+
 // 便捷函数：检查系统状态
 bool isBirdManagerInitialized();
 bool isAnimationPlaying();
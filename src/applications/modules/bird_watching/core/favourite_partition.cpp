@@ -0,0 +1,298 @@
+#include "favourite_partition.h"
+#include <cstring>
+
+#ifndef ESP_PLATFORM
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+namespace BirdWatching {
+
+uint32_t favCrc32(const void* data, size_t size, uint32_t crc) {
+    const uint8_t* p = static_cast<const uint8_t*>(data);
+    crc = ~crc;
+    for (size_t i = 0; i < size; i++) {
+        crc ^= p[i];
+        for (int bit = 0; bit < 8; bit++) {
+            crc = (crc >> 1) ^ (0xEDB88320UL & (0 - (crc & 1)));
+        }
+    }
+    return ~crc;
+}
+
+void favInitDirectory(FavDirectory& dir) {
+    memset(&dir, 0, sizeof(dir));
+    dir.magic = FAV_DIR_MAGIC;
+    dir.version = FAV_DIR_VERSION;
+}
+
+static uint32_t roundUpSector(uint32_t size) {
+    return (size + FAV_SECTOR_SIZE - 1) & ~(uint32_t)(FAV_SECTOR_SIZE - 1);
+}
+
+uint32_t favFindSpace(const FavDirectory& dir, uint32_t partition_size, uint32_t size) {
+    uint32_t need = roundUpSector(size);
+    if (need == 0 || dir.count >= FAV_MAX_BUNDLES) {
+        return 0;
+    }
+
+    // 目录项按offset有序, 依次检查各项之间的空隙
+    uint32_t cursor = FAV_DATA_START;
+    for (uint16_t i = 0; i < dir.count; i++) {
+        if (dir.bundles[i].offset >= cursor + need) {
+            return cursor;
+        }
+        uint32_t end = dir.bundles[i].offset + roundUpSector(dir.bundles[i].size);
+        if (end > cursor) {
+            cursor = end;
+        }
+    }
+    return cursor + need <= partition_size ? cursor : 0;
+}
+
+bool favInsertBundle(FavDirectory& dir, const FavBundleEntry& entry) {
+    if (dir.count >= FAV_MAX_BUNDLES || favFindBundle(dir, entry.bird_id)) {
+        return false;
+    }
+
+    uint16_t pos = dir.count;
+    while (pos > 0 && dir.bundles[pos - 1].offset > entry.offset) {
+        dir.bundles[pos] = dir.bundles[pos - 1];
+        pos--;
+    }
+    dir.bundles[pos] = entry;
+    dir.count++;
+    return true;
+}
+
+bool favRemoveBundle(FavDirectory& dir, uint16_t bird_id) {
+    for (uint16_t i = 0; i < dir.count; i++) {
+        if (dir.bundles[i].bird_id == bird_id) {
+            memmove(&dir.bundles[i], &dir.bundles[i + 1], (dir.count - i - 1) * sizeof(FavBundleEntry));
+            dir.count--;
+            memset(&dir.bundles[dir.count], 0, sizeof(FavBundleEntry));
+            return true;
+        }
+    }
+    return false;
+}
+
+const FavBundleEntry* favFindBundle(const FavDirectory& dir, uint16_t bird_id) {
+    for (uint16_t i = 0; i < dir.count; i++) {
+        if (dir.bundles[i].bird_id == bird_id) {
+            return &dir.bundles[i];
+        }
+    }
+    return nullptr;
+}
+
+static bool directoryValid(const FavDirectory& dir, uint32_t partition_size) {
+    if (dir.magic != FAV_DIR_MAGIC || dir.version != FAV_DIR_VERSION || dir.count > FAV_MAX_BUNDLES ||
+        dir.checksum != favCrc32(&dir, offsetof(FavDirectory, checksum))) {
+        return false;
+    }
+    for (uint16_t i = 0; i < dir.count; i++) {
+        const FavBundleEntry& entry = dir.bundles[i];
+        if (entry.offset < FAV_DATA_START || entry.offset % FAV_SECTOR_SIZE != 0 ||
+            entry.size == 0 || entry.offset + entry.size > partition_size) {
+            return false;
+        }
+    }
+    return true;
+}
+
+bool FavPartition::loadDirectory(FavDirectory& out, uint8_t* out_slot) {
+    favInitDirectory(out);
+    *out_slot = 0;
+    if (!isOpen()) {
+        return false;
+    }
+
+    bool found = false;
+    for (uint8_t slot = 0; slot < FAV_DIR_SECTORS; slot++) {
+        FavDirectory dir;
+        if (!read(slot * FAV_SECTOR_SIZE, &dir, sizeof(dir)) || !directoryValid(dir, size())) {
+            continue;
+        }
+        if (!found || dir.sequence > out.sequence) {
+            out = dir;
+            *out_slot = slot;
+            found = true;
+        }
+    }
+    return found;
+}
+
+bool FavPartition::saveDirectory(FavDirectory& dir, uint8_t* slot) {
+    uint8_t target = (*slot + 1) % FAV_DIR_SECTORS;
+    dir.magic = FAV_DIR_MAGIC;
+    dir.version = FAV_DIR_VERSION;
+    dir.sequence++;
+    dir.checksum = favCrc32(&dir, offsetof(FavDirectory, checksum));
+
+    if (!erase(target * FAV_SECTOR_SIZE, FAV_SECTOR_SIZE) || !write(target * FAV_SECTOR_SIZE, &dir, sizeof(dir))) {
+        return false;
+    }
+    *slot = target;
+    return true;
+}
+
+#ifdef ESP_PLATFORM
+
+FavPartition::FavPartition()
+    : part_(nullptr)
+{
+}
+
+FavPartition::~FavPartition() {
+    close();
+}
+
+bool FavPartition::open(const char* name) {
+    part_ = esp_partition_find_first(ESP_PARTITION_TYPE_DATA, (esp_partition_subtype_t)FAV_PARTITION_SUBTYPE, name);
+    return part_ != nullptr;
+}
+
+void FavPartition::close() {
+    part_ = nullptr;
+}
+
+bool FavPartition::isOpen() const {
+    return part_ != nullptr;
+}
+
+uint32_t FavPartition::size() const {
+    return part_ ? part_->size : 0;
+}
+
+bool FavPartition::read(uint32_t offset, void* out, uint32_t size) {
+    return part_ && esp_partition_read(part_, offset, out, size) == ESP_OK;
+}
+
+bool FavPartition::erase(uint32_t offset, uint32_t size) {
+    return part_ && esp_partition_erase_range(part_, offset, size) == ESP_OK;
+}
+
+bool FavPartition::write(uint32_t offset, const void* data, uint32_t size) {
+    return part_ && esp_partition_write(part_, offset, data, size) == ESP_OK;
+}
+
+const uint8_t* FavPartition::map(uint32_t offset, uint32_t size, uint32_t* out_handle) {
+    // esp_partition_mmap按64KB页映射, 返回的指针已加上页内偏移
+    const void* ptr = nullptr;
+    spi_flash_mmap_handle_t handle;
+    if (!part_ || esp_partition_mmap(part_, offset, size, SPI_FLASH_MMAP_DATA, &ptr, &handle) != ESP_OK) {
+        return nullptr;
+    }
+    *out_handle = handle;
+    return static_cast<const uint8_t*>(ptr);
+}
+
+void FavPartition::unmap(uint32_t handle) {
+    spi_flash_munmap(handle);
+}
+
+#else // 主机端: 镜像文件 + mmap
+
+FavPartition::FavPartition()
+    : fd_(-1)
+    , size_(0)
+{
+}
+
+FavPartition::~FavPartition() {
+    close();
+}
+
+bool FavPartition::open(const char* name) {
+    close();
+    fd_ = ::open(name, O_RDWR);
+    if (fd_ < 0) {
+        return false;
+    }
+    struct stat st;
+    if (fstat(fd_, &st) != 0 || st.st_size < FAV_DATA_START) {
+        close();
+        return false;
+    }
+    size_ = (uint32_t)st.st_size;
+    return true;
+}
+
+void FavPartition::close() {
+    for (const HostMapping& mapping : mappings_) {
+        if (mapping.addr) {
+            munmap(mapping.addr, mapping.length);
+        }
+    }
+    mappings_.clear();
+    if (fd_ >= 0) {
+        ::close(fd_);
+        fd_ = -1;
+    }
+    size_ = 0;
+}
+
+bool FavPartition::isOpen() const {
+    return fd_ >= 0;
+}
+
+uint32_t FavPartition::size() const {
+    return size_;
+}
+
+bool FavPartition::read(uint32_t offset, void* out, uint32_t size) {
+    return fd_ >= 0 && offset + size <= size_ && pread(fd_, out, size, offset) == (ssize_t)size;
+}
+
+bool FavPartition::erase(uint32_t offset, uint32_t size) {
+    if (fd_ < 0 || offset % FAV_SECTOR_SIZE != 0 || size % FAV_SECTOR_SIZE != 0 || offset + size > size_) {
+        return false;
+    }
+    uint8_t blank[FAV_SECTOR_SIZE];
+    memset(blank, 0xFF, sizeof(blank));
+    for (uint32_t done = 0; done < size; done += FAV_SECTOR_SIZE) {
+        if (pwrite(fd_, blank, FAV_SECTOR_SIZE, offset + done) != FAV_SECTOR_SIZE) {
+            return false;
+        }
+    }
+    return true;
+}
+
+bool FavPartition::write(uint32_t offset, const void* data, uint32_t size) {
+    return fd_ >= 0 && offset + size <= size_ && pwrite(fd_, data, size, offset) == (ssize_t)size;
+}
+
+const uint8_t* FavPartition::map(uint32_t offset, uint32_t size, uint32_t* out_handle) {
+    if (fd_ < 0 || size == 0 || offset + size > size_) {
+        return nullptr;
+    }
+
+    // 与esp_partition_mmap相同: 从页边界映射, 返回加上页内偏移的指针
+    long page = sysconf(_SC_PAGESIZE);
+    uint32_t base = offset - offset % page;
+    size_t length = size + (offset - base);
+    void* addr = mmap(nullptr, length, PROT_READ, MAP_SHARED, fd_, base);
+    if (addr == MAP_FAILED) {
+        return nullptr;
+    }
+
+    HostMapping mapping = { addr, length };
+    mappings_.push_back(mapping);
+    *out_handle = (uint32_t)mappings_.size();
+    return static_cast<const uint8_t*>(addr) + (offset - base);
+}
+
+void FavPartition::unmap(uint32_t handle) {
+    if (handle == 0 || handle > mappings_.size() || !mappings_[handle - 1].addr) {
+        return;
+    }
+    munmap(mappings_[handle - 1].addr, mappings_[handle - 1].length);
+    mappings_[handle - 1].addr = nullptr;
+}
+
+#endif // ESP_PLATFORM
+
+} // namespace BirdWatching
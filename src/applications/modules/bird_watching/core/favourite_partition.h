@@ -0,0 +1,119 @@
+#ifndef FAVOURITE_PARTITION_H
+#define FAVOURITE_PARTITION_H
+
+#include <cstdint>
+#include <cstddef>
+
+#ifdef ESP_PLATFORM
+#include <esp_partition.h>
+#include <esp_spi_flash.h>
+#else
+#include <vector>
+#endif
+
+// 收藏分区(见partitions.csv): 常播小鸟的bundle原样复制到内部flash, 播放时内存映射直接读取
+#define FAV_PARTITION_LABEL     "birdfav"
+#define FAV_PARTITION_SUBTYPE   0x40
+#define FAV_SECTOR_SIZE         4096        // flash擦除单位, bundle按扇区对齐存放
+#define FAV_DIR_SECTORS         2           // 目录A/B交替写入, 掉电时至少保留一份
+#define FAV_DATA_START          (FAV_SECTOR_SIZE * FAV_DIR_SECTORS)
+#define FAV_MAX_BUNDLES         8
+#define FAV_MAX_TRACKED         32          // 记录播放次数的小鸟数
+#define FAV_DIR_MAGIC           0x56414642  // "BFAV"
+#define FAV_DIR_VERSION         1
+
+namespace BirdWatching {
+
+/**
+ * 分区中的一个bundle: 与SD上/birds/<id>/bundle.bin逐字节相同
+ */
+struct FavBundleEntry {
+    uint16_t bird_id;
+    uint16_t reserved;
+    uint32_t offset;         // 分区内偏移(扇区对齐)
+    uint32_t size;           // bundle文件大小
+    uint32_t header_crc;     // SD上bundle头部(64字节)的CRC32, 用于发现SD上的bundle已更新
+} __attribute__((packed));
+
+struct FavPlayCount {
+    uint16_t bird_id;
+    uint16_t plays;
+} __attribute__((packed));
+
+/**
+ * 分区目录(位于第0或第1扇区, sequence较大且校验正确的一份有效)
+ */
+struct FavDirectory {
+    uint32_t magic;
+    uint16_t version;
+    uint16_t count;          // bundles中的有效项数, 按offset升序
+    uint32_t sequence;
+    FavBundleEntry bundles[FAV_MAX_BUNDLES];
+    FavPlayCount plays[FAV_MAX_TRACKED];
+    uint32_t checksum;       // 之前所有字节的CRC32
+} __attribute__((packed));
+
+// CRC32(与zlib相同), crc为之前的结果, 可分段计算
+uint32_t favCrc32(const void* data, size_t size, uint32_t crc = 0);
+
+// 空目录
+void favInitDirectory(FavDirectory& dir);
+
+// 在数据区中为size字节找一段空闲区域(首次适配), 没有时返回0
+uint32_t favFindSpace(const FavDirectory& dir, uint32_t partition_size, uint32_t size);
+
+// 按offset有序插入/删除目录项
+bool favInsertBundle(FavDirectory& dir, const FavBundleEntry& entry);
+bool favRemoveBundle(FavDirectory& dir, uint16_t bird_id);
+const FavBundleEntry* favFindBundle(const FavDirectory& dir, uint16_t bird_id);
+
+/**
+ * 收藏分区的读写与内存映射
+ *
+ * 固件中为flash分区(esp_partition_*), 只读映射经过flash cache, 不占用堆;
+ * 主机端以同样接口操作一个镜像文件, 映射使用mmap, 供scripts/host_tools/fav_image生成和检查镜像
+ */
+class FavPartition {
+public:
+    FavPartition();
+    ~FavPartition();
+
+    // 固件: name为分区标签; 主机: name为镜像文件路径
+    bool open(const char* name);
+    void close();
+    bool isOpen() const;
+    uint32_t size() const;
+
+    bool read(uint32_t offset, void* out, uint32_t size);
+    bool erase(uint32_t offset, uint32_t size);     // offset和size按扇区对齐
+    bool write(uint32_t offset, const void* data, uint32_t size);
+
+    // 只读映射[offset, offset + size), 失败返回nullptr; 用unmap释放
+    const uint8_t* map(uint32_t offset, uint32_t size, uint32_t* out_handle);
+    void unmap(uint32_t handle);
+
+    // 读取有效目录(两份都无效时返回false, out为空目录), slot为所在扇区
+    bool loadDirectory(FavDirectory& out, uint8_t* out_slot);
+    // 写入另一扇区(sequence加1, 重新计算校验), 成功后更新slot
+    bool saveDirectory(FavDirectory& dir, uint8_t* slot);
+
+private:
+#ifdef ESP_PLATFORM
+    const esp_partition_t* part_;
+#else
+    struct HostMapping {
+        void* addr;
+        size_t length;
+    };
+    int fd_;
+    uint32_t size_;
+    std::vector<HostMapping> mappings_;
+#endif
+
+    FavPartition(const FavPartition&) = delete;
+    FavPartition& operator=(const FavPartition&) = delete;
+};
+
+} // namespace BirdWatching
+
+#endif // FAVOURITE_PARTITION_H
@@ -0,0 +1,493 @@
+#include "favourite_store.h"
+#include "bird_bundle_loader.h"
+#include "system/logging/log_manager.h"
+#include "system/memory/mem_tracker.h"
+#include <cstring>
+
+namespace BirdWatching {
+
+FavouriteStore* FavouriteStore::instance_ = nullptr;
+
+FavouriteStore* FavouriteStore::getInstance() {
+    if (!instance_) {
+        instance_ = new FavouriteStore();
+    }
+    return instance_;
+}
+
+FavouriteStore::FavouriteStore()
+    : dir_slot_(0)
+    , available_(false)
+    , pending_plays_(0)
+    , verify_index_(0)
+    , sync_bird_(0)
+    , forced_bird_(0)
+    , sync_buf_(nullptr)
+    , sync_offset_(0)
+    , sync_size_(0)
+    , sync_done_(0)
+    , sync_erased_(0)
+    , sync_header_crc_(0)
+    , sync_start_ms_(0)
+    , last_step_ms_(0)
+    , rejected_next_(0)
+    , bundles_synced_(0)
+    , bytes_synced_(0)
+    , maps_(0)
+{
+    favInitDirectory(dir_);
+    memset(mappings_, 0, sizeof(mappings_));
+    memset(rejected_, 0, sizeof(rejected_));
+}
+
+bool FavouriteStore::init() {
+    if (available_) {
+        return true;
+    }
+
+    if (!partition_.open(FAV_PARTITION_LABEL)) {
+        LOG_WARN("FAV", "No '" FAV_PARTITION_LABEL "' partition, flash favourites disabled");
+        return false;
+    }
+
+    if (!partition_.loadDirectory(dir_, &dir_slot_)) {
+        LOG_INFO("FAV", "Favourites directory empty or invalid, starting fresh");
+    }
+    available_ = true;
+
+    uint32_t used = 0;
+    for (uint16_t i = 0; i < dir_.count; i++) {
+        used += dir_.bundles[i].size;
+    }
+    LOG_INFO("FAV", "Favourites partition " + String(partition_.size() / 1024) + " KB, " + String(dir_.count) +
+             " bundles, " + String(used / 1024) + " KB used");
+    return true;
+}
+
+void FavouriteStore::notePlay(uint16_t bird_id) {
+    if (!available_ || bird_id == 0) {
+        return;
+    }
+
+    // 已记录的小鸟加1, 否则替换播放次数最少的一项
+    FavPlayCount* slot = nullptr;
+    for (FavPlayCount& count : dir_.plays) {
+        if (count.bird_id == bird_id) {
+            slot = &count;
+            break;
+        }
+        if (!slot || count.plays < slot->plays) {
+            slot = &count;
+        }
+    }
+    if (slot->bird_id != bird_id) {
+        slot->bird_id = bird_id;
+        slot->plays = 0;
+    }
+    if (slot->plays < 0xFFFF) {
+        slot->plays++;
+    }
+    pending_plays_++;
+}
+
+uint16_t FavouriteStore::getPlays(uint16_t bird_id) const {
+    for (const FavPlayCount& count : dir_.plays) {
+        if (count.bird_id == bird_id) {
+            return count.plays;
+        }
+    }
+    return 0;
+}
+
+bool FavouriteStore::contains(uint16_t bird_id) const {
+    return available_ && favFindBundle(dir_, bird_id) != nullptr;
+}
+
+bool FavouriteStore::isMapped(uint16_t bird_id) const {
+    for (const Mapping& mapping : mappings_) {
+        if (mapping.refs > 0 && mapping.bird_id == bird_id) {
+            return true;
+        }
+    }
+    return false;
+}
+
+const uint8_t* FavouriteStore::mapBundle(uint16_t bird_id, uint32_t* out_size) {
+    const FavBundleEntry* entry = available_ ? favFindBundle(dir_, bird_id) : nullptr;
+    if (!entry) {
+        return nullptr;
+    }
+
+    Mapping* free_slot = nullptr;
+    for (Mapping& mapping : mappings_) {
+        if (mapping.refs > 0 && mapping.bird_id == bird_id) {
+            mapping.refs++;
+            *out_size = entry->size;
+            return mapping.ptr;
+        }
+        if (mapping.refs == 0 && !free_slot) {
+            free_slot = &mapping;
+        }
+    }
+    if (!free_slot) {
+        LOG_WARN("FAV", "No free mapping slot for bird " + String(bird_id));
+        return nullptr;
+    }
+
+    uint32_t handle = 0;
+    const uint8_t* ptr = partition_.map(entry->offset, entry->size, &handle);
+    if (!ptr) {
+        LOG_WARN("FAV", "Failed to map bird " + String(bird_id) + " (" + String(entry->size / 1024) + " KB)");
+        return nullptr;
+    }
+
+    free_slot->bird_id = bird_id;
+    free_slot->handle = handle;
+    free_slot->ptr = ptr;
+    free_slot->refs = 1;
+    maps_++;
+    *out_size = entry->size;
+    return ptr;
+}
+
+void FavouriteStore::unmapBundle(uint16_t bird_id) {
+    for (Mapping& mapping : mappings_) {
+        if (mapping.refs > 0 && mapping.bird_id == bird_id) {
+            if (--mapping.refs == 0) {
+                partition_.unmap(mapping.handle);
+                mapping.ptr = nullptr;
+                mapping.bird_id = 0;
+            }
+            return;
+        }
+    }
+}
+
+void FavouriteStore::service(uint32_t slack_ms) {
+    if (!available_ || slack_ms < FAV_SYNC_MIN_SLACK_MS) {
+        return;
+    }
+    uint32_t now = millis();
+    if (now - last_step_ms_ < FAV_SYNC_INTERVAL_MS) {
+        return;
+    }
+    last_step_ms_ = now;
+
+    // 每次只做一件事: 继续同步 > 比对已有项 > 写回播放计数 > 开始新的同步
+    if (sync_bird_) {
+        syncStep();
+        return;
+    }
+    if (verify_index_ < dir_.count) {
+        verifyEntry(verify_index_++);
+        return;
+    }
+    if (pending_plays_ >= FAV_COUNT_FLUSH_PLAYS) {
+        saveDirectory();
+        return;
+    }
+
+    uint16_t candidate = pickCandidate();
+    bool forced = candidate != 0 && candidate == forced_bird_;
+    forced_bird_ = 0;
+    if (candidate && !startSync(candidate, forced)) {
+        reject(candidate);
+    }
+}
+
+uint16_t FavouriteStore::pickCandidate() const {
+    if (forced_bird_) {
+        return favFindBundle(dir_, forced_bird_) ? 0 : forced_bird_;
+    }
+
+    uint16_t best = 0;
+    uint16_t best_plays = FAV_MIN_PLAYS - 1;
+    for (const FavPlayCount& count : dir_.plays) {
+        if (count.bird_id == 0 || count.plays <= best_plays || favFindBundle(dir_, count.bird_id) ||
+            isRejected(count.bird_id)) {
+            continue;
+        }
+        best = count.bird_id;
+        best_plays = count.plays;
+    }
+    if (!best) {
+        return 0;
+    }
+
+    // 没有空位时, 只有比收藏库中最少播放的小鸟播放得更多才值得替换
+    if (dir_.count >= FAV_MAX_BUNDLES) {
+        for (uint16_t i = 0; i < dir_.count; i++) {
+            if (getPlays(dir_.bundles[i].bird_id) < best_plays && !isMapped(dir_.bundles[i].bird_id)) {
+                return best;
+            }
+        }
+        return 0;
+    }
+    return best;
+}
+
+bool FavouriteStore::readSdHeader(File& file, uint32_t* out_size, uint32_t* out_crc, uint8_t* out_header) {
+    uint8_t header[sizeof(BirdBundleHeader)];
+    if (!file || !file.seek(0) || file.read(header, sizeof(header)) != sizeof(header)) {
+        return false;
+    }
+    *out_size = file.size();
+    *out_crc = favCrc32(header, sizeof(header));
+    if (out_header) {
+        memcpy(out_header, header, sizeof(header));
+    }
+    return true;
+}
+
+bool FavouriteStore::startSync(uint16_t bird_id, bool forced) {
+    char path[64];
+    snprintf(path, sizeof(path), "/birds/%d/bundle.bin", bird_id);
+    sync_file_ = SD.open(path);
+
+    BirdBundleHeader header;
+    uint32_t size = 0;
+    uint32_t crc = 0;
+    if (!readSdHeader(sync_file_, &size, &crc, reinterpret_cast<uint8_t*>(&header))) {
+        LOG_WARN("FAV", "Cannot read " + String(path) + ", not adding to favourites");
+        if (sync_file_) {
+            sync_file_.close();
+        }
+        return false;
+    }
+
+    // 索引色bundle播放时需要展开调色板, 无法直接映射, 且本身从SD读取就很小
+    bool indexed = header.color_format == LV_COLOR_FORMAT_I8 || header.color_format == LV_COLOR_FORMAT_I4;
+    if (header.magic != 0x42495244 || indexed || size > partition_.size() - FAV_DATA_START) {
+        LOG_INFO("FAV", "Bird " + String(bird_id) + " not eligible (" + String(size / 1024) + " KB" +
+                 (indexed ? ", indexed" : "") + ")");
+        sync_file_.close();
+        return false;
+    }
+
+    // 空间不足时淘汰播放次数最少且未在播放的小鸟, 目录先写回再覆盖其数据
+    uint16_t plays = getPlays(bird_id);
+    bool evicted = false;
+    uint32_t offset;
+    while ((offset = favFindSpace(dir_, partition_.size(), size)) == 0) {
+        int victim = -1;
+        for (uint16_t i = 0; i < dir_.count; i++) {
+            uint16_t id = dir_.bundles[i].bird_id;
+            if (isMapped(id) || (!forced && getPlays(id) >= plays)) {
+                continue;
+            }
+            if (victim < 0 || getPlays(id) < getPlays(dir_.bundles[victim].bird_id)) {
+                victim = i;
+            }
+        }
+        if (victim < 0) {
+            LOG_INFO("FAV", "No room for bird " + String(bird_id) + " (" + String(size / 1024) + " KB)");
+            sync_file_.close();
+            if (evicted) {
+                saveDirectory();
+            }
+            return false;
+        }
+        LOG_INFO("FAV", "Evicting bird " + String(dir_.bundles[victim].bird_id) + " for bird " + String(bird_id));
+        favRemoveBundle(dir_, dir_.bundles[victim].bird_id);
+        evicted = true;
+    }
+    if (evicted && !saveDirectory()) {
+        sync_file_.close();
+        return false;
+    }
+
+    sync_buf_ = static_cast<uint8_t*>(MemTracker::alloc(MEM_TAG_LOADER, FAV_SECTOR_SIZE));
+    if (!sync_buf_) {
+        sync_file_.close();
+        return false;
+    }
+
+    sync_bird_ = bird_id;
+    sync_offset_ = offset;
+    sync_size_ = size;
+    sync_done_ = 0;
+    sync_erased_ = 0;
+    sync_header_crc_ = crc;
+    sync_start_ms_ = millis();
+    LOG_INFO("FAV", "Syncing bird " + String(bird_id) + " (" + String(size / 1024) + " KB, " +
+             String(plays) + " plays) to flash offset 0x" + String(offset, HEX));
+    return true;
+}
+
+void FavouriteStore::syncStep() {
+    // 擦除与写入分开执行, 每步最多阻塞一次扇区擦除的时间
+    if (sync_erased_ <= sync_done_) {
+        if (!partition_.erase(sync_offset_ + sync_erased_, FAV_SECTOR_SIZE)) {
+            LOG_ERROR("FAV", "Flash erase failed at 0x" + String(sync_offset_ + sync_erased_, HEX));
+            finishSync(false);
+            return;
+        }
+        sync_erased_ += FAV_SECTOR_SIZE;
+        return;
+    }
+
+    uint32_t chunk = sync_size_ - sync_done_;
+    if (chunk > FAV_SECTOR_SIZE) {
+        chunk = FAV_SECTOR_SIZE;
+    }
+    if (!sync_file_.seek(sync_done_) || sync_file_.read(sync_buf_, chunk) != chunk ||
+        !partition_.write(sync_offset_ + sync_done_, sync_buf_, chunk)) {
+        LOG_ERROR("FAV", "Copy failed at " + String(sync_done_) + "/" + String(sync_size_));
+        finishSync(false);
+        return;
+    }
+    sync_done_ += chunk;
+
+    if (sync_done_ >= sync_size_) {
+        finishSync(true);
+    }
+}
+
+void FavouriteStore::finishSync(bool ok) {
+    uint16_t bird_id = sync_bird_;
+    sync_file_.close();
+    MemTracker::free(sync_buf_);
+    sync_buf_ = nullptr;
+    sync_bird_ = 0;
+
+    if (ok) {
+        // 回读头部确认写入正确
+        uint8_t header[sizeof(BirdBundleHeader)];
+        ok = partition_.read(sync_offset_, header, sizeof(header)) &&
+             favCrc32(header, sizeof(header)) == sync_header_crc_;
+    }
+
+    FavBundleEntry entry;
+    entry.bird_id = bird_id;
+    entry.reserved = 0;
+    entry.offset = sync_offset_;
+    entry.size = sync_size_;
+    entry.header_crc = sync_header_crc_;
+    if (!ok || !favInsertBundle(dir_, entry) || !saveDirectory()) {
+        favRemoveBundle(dir_, bird_id);
+        reject(bird_id);
+        LOG_ERROR("FAV", "Failed to sync bird " + String(bird_id) + " to flash");
+        return;
+    }
+
+    // 新加入的项不需要再比对
+    verify_index_++;
+    bundles_synced_++;
+    bytes_synced_ += sync_size_;
+    LOG_INFO("FAV", "Bird " + String(bird_id) + " synced to flash: " + String(sync_size_ / 1024) + " KB in " +
+             String((millis() - sync_start_ms_) / 1000) + " s");
+}
+
+void FavouriteStore::verifyEntry(uint16_t index) {
+    if (index >= dir_.count) {
+        return;
+    }
+    FavBundleEntry entry = dir_.bundles[index];
+
+    char path[64];
+    snprintf(path, sizeof(path), "/birds/%d/bundle.bin", entry.bird_id);
+    File file = SD.open(path);
+    uint32_t size = 0;
+    uint32_t crc = 0;
+    bool same = readSdHeader(file, &size, &crc, nullptr) && size == entry.size && crc == entry.header_crc;
+    if (file) {
+        file.close();
+    }
+    if (same || isMapped(entry.bird_id)) {
+        return;
+    }
+
+    // SD上的bundle已更新或被删除: 移出收藏库, 之后按播放次数重新同步
+    LOG_INFO("FAV", "Bird " + String(entry.bird_id) + " changed on SD, removing from favourites");
+    favRemoveBundle(dir_, entry.bird_id);
+    verify_index_--;
+    saveDirectory();
+}
+
+bool FavouriteStore::remove(uint16_t bird_id) {
+    if (!available_ || isMapped(bird_id) || !favFindBundle(dir_, bird_id)) {
+        return false;
+    }
+    favRemoveBundle(dir_, bird_id);
+    reject(bird_id);
+    return saveDirectory();
+}
+
+void FavouriteStore::clear() {
+    if (!available_) {
+        return;
+    }
+    if (sync_bird_) {
+        finishSync(false);
+    }
+    for (uint16_t i = dir_.count; i > 0; i--) {
+        uint16_t id = dir_.bundles[i - 1].bird_id;
+        if (!isMapped(id)) {
+            favRemoveBundle(dir_, id);
+        }
+    }
+    memset(dir_.plays, 0, sizeof(dir_.plays));
+    memset(rejected_, 0, sizeof(rejected_));
+    saveDirectory();
+}
+
+bool FavouriteStore::isRejected(uint16_t bird_id) const {
+    for (uint16_t id : rejected_) {
+        if (id == bird_id) {
+            return true;
+        }
+    }
+    return false;
+}
+
+void FavouriteStore::reject(uint16_t bird_id) {
+    if (!isRejected(bird_id)) {
+        rejected_[rejected_next_] = bird_id;
+        rejected_next_ = (rejected_next_ + 1) % FAV_MAX_BUNDLES;
+    }
+}
+
+bool FavouriteStore::saveDirectory() {
+    if (!partition_.saveDirectory(dir_, &dir_slot_)) {
+        LOG_ERROR("FAV", "Failed to write favourites directory");
+        return false;
+    }
+    pending_plays_ = 0;
+    return true;
+}
+
+void FavouriteStore::printStatus() {
+    Serial.println("=== Flash Favourites ===");
+    if (!available_) {
+        Serial.println("No '" FAV_PARTITION_LABEL "' partition (flash with partitions.csv)");
+        return;
+    }
+
+    uint32_t used = 0;
+    for (uint16_t i = 0; i < dir_.count; i++) {
+        used += dir_.bundles[i].size;
+    }
+    Serial.printf("Partition: %u KB, used %u KB in %u/%u bundles, directory seq %u\r\n",
+                  partition_.size() / 1024, used / 1024, dir_.count, FAV_MAX_BUNDLES, dir_.sequence);
+    for (uint16_t i = 0; i < dir_.count; i++) {
+        const FavBundleEntry& entry = dir_.bundles[i];
+        Serial.printf("  bird %-5u 0x%06X %5u KB %4u plays%s\r\n", entry.bird_id, entry.offset, entry.size / 1024,
+                      getPlays(entry.bird_id), isMapped(entry.bird_id) ? " (mapped)" : "");
+    }
+    if (sync_bird_) {
+        Serial.printf("Syncing bird %u: %u/%u KB\r\n", sync_bird_, sync_done_ / 1024, sync_size_ / 1024);
+    }
+    Serial.printf("Synced this boot: %u bundles, %u KB; maps: %u\r\n", bundles_synced_, bytes_synced_ / 1024, maps_);
+
+    Serial.print("Play counts:");
+    uint16_t shown = 0;
+    for (const FavPlayCount& count : dir_.plays) {
+        if (count.bird_id && shown < 8) {
+            Serial.printf(" %u(%u)", count.bird_id, count.plays);
+            shown++;
+        }
+    }
+    Serial.println(shown ? "" : " none");
+}
+
+} // namespace BirdWatching
@@ -0,0 +1,123 @@
+#ifndef FAVOURITE_STORE_H
+#define FAVOURITE_STORE_H
+
+#include <Arduino.h>
+#include <SD.h>
+#include "favourite_partition.h"
+
+// 后台同步策略
+#define FAV_MIN_PLAYS           3       // 播放次数达到该值的小鸟才会同步到flash
+#define FAV_SYNC_INTERVAL_MS    100     // 两步同步之间的最小间隔
+#define FAV_SYNC_MIN_SLACK_MS   50      // 动画空闲时间不少于该值才执行一步(擦除一个扇区约45ms)
+#define FAV_COUNT_FLUSH_PLAYS   16      // 播放计数累计这么多次后写回目录
+#define FAV_MAX_MAPPINGS        3       // 同时映射的bundle数(当前、预热、测速)
+
+namespace BirdWatching {
+
+/**
+ * @brief 常播小鸟的flash收藏库
+ *
+ * - 记录每只小鸟的播放次数(保存在分区目录中), 播放次数最多的小鸟的bundle
+ *   在动画空闲时分步从SD复制到收藏分区: 每步擦除一个扇区或写入4KB, 不影响播放
+ * - 分区放满时淘汰播放次数更少的小鸟; 启动后逐个比对SD上的bundle头部, 已更新的重新同步
+ * - mapBundle()把整个bundle映射到地址空间, BirdBundleLoader直接让img_dsc->data
+ *   指向映射区域, 播放时既不读SD也不分配帧缓冲区
+ *
+ * 只在UI任务中使用(调用方持有LVGL锁); 串口命令访问前也需先获取LVGL锁
+ */
+class FavouriteStore {
+public:
+    static FavouriteStore* getInstance();
+
+    // 打开分区并读取目录, 没有收藏分区时返回false(之后所有接口都是空操作)
+    bool init();
+    bool isAvailable() const { return available_; }
+
+    // 记录一次播放(计入统计的触发)
+    void notePlay(uint16_t bird_id);
+
+    bool contains(uint16_t bird_id) const;
+
+    // 映射小鸟的bundle(引用计数), 不在收藏库中返回nullptr
+    const uint8_t* mapBundle(uint16_t bird_id, uint32_t* out_size);
+    void unmapBundle(uint16_t bird_id);
+
+    // 动画空闲时调用, slack_ms为距下一帧的剩余时间
+    void service(uint32_t slack_ms);
+
+    // 串口命令: 立即排队同步指定小鸟 / 移出收藏库 / 清空
+    void requestSync(uint16_t bird_id) { forced_bird_ = bird_id; }
+    bool remove(uint16_t bird_id);
+    void clear();
+
+    void printStatus();
+
+private:
+    FavouriteStore();
+
+    static FavouriteStore* instance_;
+
+    FavPartition partition_;
+    FavDirectory dir_;
+    uint8_t dir_slot_;
+    bool available_;
+    uint16_t pending_plays_;        // 尚未写回目录的播放次数
+    uint16_t verify_index_;         // 启动后已比对的目录项数
+
+    struct Mapping {
+        uint16_t bird_id;
+        uint32_t handle;
+        const uint8_t* ptr;
+        uint8_t refs;
+    };
+    Mapping mappings_[FAV_MAX_MAPPINGS];
+
+    // 同步状态(sync_bird_为0表示空闲)
+    uint16_t sync_bird_;
+    uint16_t forced_bird_;
+    File sync_file_;
+    uint8_t* sync_buf_;
+    uint32_t sync_offset_;          // 目标在分区中的偏移
+    uint32_t sync_size_;
+    uint32_t sync_done_;            // 已写入字节数
+    uint32_t sync_erased_;          // 已擦除字节数
+    uint32_t sync_header_crc_;
+    uint32_t sync_start_ms_;
+    uint32_t last_step_ms_;
+
+    // 同步失败或不适合收藏的小鸟(避免反复尝试)
+    uint16_t rejected_[FAV_MAX_BUNDLES];
+    uint8_t rejected_next_;
+
+    // 统计
+    uint32_t bundles_synced_;
+    uint32_t bytes_synced_;
+    uint32_t maps_;
+
+    uint16_t getPlays(uint16_t bird_id) const;
+    bool isRejected(uint16_t bird_id) const;
+    void reject(uint16_t bird_id);
+    bool isMapped(uint16_t bird_id) const;
+
+    // 选择下一只要同步的小鸟(0: 没有)
+    uint16_t pickCandidate() const;
+    // forced: 串口命令指定的小鸟, 需要时淘汰任何未在播放的小鸟
+    bool startSync(uint16_t bird_id, bool forced);
+    void syncStep();
+    void finishSync(bool ok);
+
+    // 比对目录项与SD上的bundle, 不一致时移出
+    void verifyEntry(uint16_t index);
+
+    // 读取SD上bundle的大小和头部CRC
+    static bool readSdHeader(File& file, uint32_t* out_size, uint32_t* out_crc, uint8_t* out_header);
+
+    bool saveDirectory();
+
+    FavouriteStore(const FavouriteStore&) = delete;
+    FavouriteStore& operator=(const FavouriteStore&) = delete;
+};
+
+} // namespace BirdWatching
+
+#endif // FAVOURITE_STORE_H
@@ -0,0 +1,271 @@
+#include "frame_cache.h"
+#include "system/logging/log_manager.h"
+#include "system/memory/mem_tracker.h"
+
+namespace BirdWatching {
+
+FrameCache* FrameCache::instance_ = nullptr;
+
+FrameCache* FrameCache::getInstance() {
+    if (!instance_) {
+        instance_ = new FrameCache();
+    }
+    return instance_;
+}
+
+FrameCache::FrameCache()
+    : budget_(defaultBudget())
+    , resident_bytes_(0)
+    , pinned_bird_(0)
+    , warm_bird_(0)
+    , use_counter_(0)
+    , hits_(0)
+    , misses_(0)
+    , evictions_(0)
+    , sd_bytes_saved_(0)
+{
+    LOG_INFO("CACHE", "Frame cache budget " + String(budget_ / 1024) + " KB (free heap " +
+             String(ESP.getFreeHeap() / 1024) + " KB)");
+}
+
+uint32_t FrameCache::defaultBudget() {
+    // 固定的64KB只够两帧; 按启动时的空闲堆给缓存, 留出播放本身需要的内存
+    uint32_t playback = 2 * FRAME_CACHE_FRAME_BYTES + FRAME_CACHE_HEAP_RESERVE;
+    uint32_t free_heap = ESP.getFreeHeap();
+    uint32_t budget = free_heap > playback ? (free_heap - playback) / 100 * FRAME_CACHE_BUDGET_HEAP_PCT : 0;
+    if (budget < FRAME_CACHE_BUDGET_MIN_BYTES) {
+        budget = FRAME_CACHE_BUDGET_MIN_BYTES;
+    }
+    if (budget > FRAME_CACHE_BUDGET_MAX_BYTES) {
+        budget = FRAME_CACHE_BUDGET_MAX_BYTES;
+    }
+    return budget;
+}
+
+void FrameCache::beginClip(uint16_t bird_id, uint32_t clip_bytes) {
+    pinned_bird_ = clip_bytes <= budget_ ? bird_id : 0;
+    if (warm_bird_ == bird_id) {
+        warm_bird_ = 0;
+    }
+    LOG_INFO("CACHE", "Bird " + String(bird_id) + " clip ~" + String(clip_bytes / 1024) + " KB, " +
+             (pinned_bird_ ? "pinned" : "not cached") + " (budget " + String(budget_ / 1024) +
+             " KB, resident " + String(resident_bytes_ / 1024) + " KB)");
+}
+
+bool FrameCache::contains(uint16_t bird_id, uint16_t frame) const {
+    for (const Entry& entry : entries_) {
+        if (entry.bird_id == bird_id && entry.frame == frame) {
+            return true;
+        }
+    }
+    return false;
+}
+
+bool FrameCache::lookup(uint16_t bird_id, uint16_t frame, lv_image_dsc_t** out_dsc, FramePlacement* out_pos) {
+    for (Entry& entry : entries_) {
+        if (entry.bird_id == bird_id && entry.frame == frame) {
+            entry.refs++;
+            entry.last_use = ++use_counter_;
+            hits_++;
+            sd_bytes_saved_ += entry.sd_bytes;
+            *out_dsc = entry.dsc;
+            if (out_pos) {
+                *out_pos = entry.pos;
+            }
+            return true;
+        }
+    }
+    misses_++;
+    return false;
+}
+
+bool FrameCache::insert(uint16_t bird_id, uint16_t frame, lv_image_dsc_t* dsc, const FramePlacement& pos,
+                        uint32_t sd_bytes) {
+    bool warm = bird_id != 0 && bird_id == warm_bird_;
+    if ((!isPinned(bird_id) && !warm) || !dsc) {
+        return false;
+    }
+
+    // 按实际分配计: 整扇区读入的帧缓冲区比data_size大
+    uint32_t bytes = MemTracker::allocatedBytes(dsc) + MemTracker::allocatedBytes(dsc->data);
+    uint32_t limit = budget_ + (warm ? FRAME_CACHE_WARM_BYTES : 0);
+
+    // 超出预算时先淘汰其他小鸟的帧, 仍放不下则不缓存
+    while (resident_bytes_ + bytes > limit) {
+        if (!evictOne(false)) {
+            return false;
+        }
+    }
+
+    Entry entry;
+    entry.bird_id = bird_id;
+    entry.frame = frame;
+    entry.dsc = dsc;
+    entry.pos = pos;
+    entry.bytes = bytes;
+    entry.sd_bytes = sd_bytes;
+    entry.last_use = ++use_counter_;
+    entry.refs = 1;
+    entries_.push_back(entry);
+    resident_bytes_ += bytes;
+    return true;
+}
+
+bool FrameCache::release(lv_image_dsc_t* dsc) {
+    if (!dsc) {
+        return false;
+    }
+
+    for (Entry& entry : entries_) {
+        if (entry.dsc == dsc) {
+            if (entry.refs > 0) {
+                entry.refs--;
+            }
+            return true;
+        }
+    }
+    return false;
+}
+
+void FrameCache::makeRoom(uint32_t bytes) {
+    if (entries_.empty()) {
+        return;
+    }
+
+    uint32_t freed = 0;
+    while (ESP.getMaxAllocHeap() < bytes + FRAME_CACHE_HEAP_RESERVE && evictOne(true)) {
+        freed++;
+    }
+    if (freed) {
+        LOG_INFO("CACHE", "Evicted " + String(freed) + " frames for a " + String(bytes) +
+                 " B allocation, resident " + String(resident_bytes_ / 1024) + " KB");
+    }
+}
+
+uint32_t FrameCache::evictAll() {
+    uint32_t before = resident_bytes_;
+    while (evictOne(true)) {
+    }
+    return before - resident_bytes_;
+}
+
+uint32_t FrameCache::evictBird(uint16_t bird_id) {
+    if (pinned_bird_ == bird_id) {
+        pinned_bird_ = 0;
+    }
+    if (warm_bird_ == bird_id) {
+        warm_bird_ = 0;
+    }
+
+    uint32_t freed = 0;
+    size_t i = 0;
+    while (i < entries_.size()) {
+        Entry& entry = entries_[i];
+        if (entry.bird_id != bird_id) {
+            i++;
+            continue;
+        }
+        if (entry.refs == 0) {
+            freed += entry.bytes;
+            evictAt(i);
+            continue;
+        }
+        // 仍在显示: 只移出缓存, 不释放
+        resident_bytes_ -= entry.bytes;
+        entries_[i] = entries_.back();
+        entries_.pop_back();
+    }
+    return freed;
+}
+
+void FrameCache::setBudget(uint32_t bytes) {
+    budget_ = bytes;
+    while (resident_bytes_ > budget_ && evictOne(true)) {
+    }
+    LOG_INFO("CACHE", "Budget set to " + String(budget_ / 1024) + " KB");
+}
+
+bool FrameCache::evictOne(bool include_pinned) {
+    // 优先淘汰其他小鸟最久未用的帧, 其次才是固定的小鸟
+    size_t victim = entries_.size();
+    bool victim_pinned = true;
+    for (size_t i = 0; i < entries_.size(); i++) {
+        const Entry& entry = entries_[i];
+        if (entry.refs > 0) {
+            continue;
+        }
+        bool pinned = entry.bird_id == pinned_bird_;
+        if (pinned && !include_pinned) {
+            continue;
+        }
+        if (victim == entries_.size() || (victim_pinned && !pinned) ||
+            (pinned == victim_pinned && entry.last_use < entries_[victim].last_use)) {
+            victim = i;
+            victim_pinned = pinned;
+        }
+    }
+
+    if (victim == entries_.size()) {
+        return false;
+    }
+    evictAt(victim);
+    return true;
+}
+
+void FrameCache::evictAt(size_t index) {
+    Entry& entry = entries_[index];
+    MemTracker::free(const_cast<uint8_t*>(entry.dsc->data));
+    MemTracker::free(entry.dsc);
+    resident_bytes_ -= entry.bytes;
+    evictions_++;
+
+    entries_[index] = entries_.back();
+    entries_.pop_back();
+}
+
+void FrameCache::printStats() {
+    uint32_t lookups = hits_ + misses_;
+    Serial.println("=== Frame Cache ===");
+    Serial.printf("Budget: %u KB (+%u KB warm), resident: %u KB in %u frames, pinned bird: %u, warm bird: %u\r\n",
+                  budget_ / 1024, (uint32_t)(FRAME_CACHE_WARM_BYTES / 1024), resident_bytes_ / 1024,
+                  (unsigned)entries_.size(), pinned_bird_, warm_bird_);
+    Serial.printf("Hits: %u, misses: %u, hit rate: %u%%\r\n",
+                  hits_, misses_, lookups ? (unsigned)((uint64_t)hits_ * 100 / lookups) : 0);
+    Serial.printf("SD bytes saved: %u KB, evictions: %u\r\n",
+                  (uint32_t)(sd_bytes_saved_ / 1024), evictions_);
+
+    // 按小鸟汇总驻留帧
+    std::vector<uint16_t> birds;
+    for (const Entry& entry : entries_) {
+        bool seen = false;
+        for (uint16_t id : birds) {
+            seen = seen || id == entry.bird_id;
+        }
+        if (!seen) {
+            birds.push_back(entry.bird_id);
+        }
+    }
+    for (uint16_t id : birds) {
+        uint32_t frames = 0;
+        uint32_t bytes = 0;
+        uint32_t in_use = 0;
+        for (const Entry& entry : entries_) {
+            if (entry.bird_id == id) {
+                frames++;
+                bytes += entry.bytes;
+                in_use += entry.refs > 0 ? 1 : 0;
+            }
+        }
+        Serial.printf("  bird %-5u %3u frames %4u KB, %u in use%s\r\n", id, frames, bytes / 1024, in_use,
+                      id == pinned_bird_ ? " (pinned)" : (id == warm_bird_ ? " (warm)" : ""));
+    }
+}
+
+void FrameCache::resetStats() {
+    hits_ = 0;
+    misses_ = 0;
+    evictions_ = 0;
+    sd_bytes_saved_ = 0;
+}
+
+} // namespace BirdWatching
@@ -0,0 +1,119 @@
+#ifndef FRAME_CACHE_H
+#define FRAME_CACHE_H
+
+#include <Arduino.h>
+#include <lvgl.h>
+#include <vector>
+#include "bird_bundle_loader.h"
+
+// 转换器默认输出的一帧(120x120 RGB565, 像素数据按512字节整扇区读入)实际占用的内存
+#define FRAME_CACHE_FRAME_BYTES     ((120UL * 120 * 2 + 511) / 512 * 512 + sizeof(lv_image_dsc_t))
+// 默认预算: 启动时空闲堆扣除播放所需(显示中与预读的两帧及余量)后的这一比例(可用 `bird cache budget <KB>` 修改)
+#define FRAME_CACHE_BUDGET_HEAP_PCT 50
+#define FRAME_CACHE_BUDGET_MIN_BYTES (2 * FRAME_CACHE_FRAME_BYTES)
+#define FRAME_CACHE_BUDGET_MAX_BYTES (1024UL * 1024)
+// 动画从SD加载新帧前, 最大空闲块至少要比帧大这么多, 否则先淘汰缓存
+#define FRAME_CACHE_HEAP_RESERVE    (16UL * 1024)
+// 预热下一只小鸟的开头几帧时, 在预算之外额外允许的字节数
+#define FRAME_CACHE_WARM_BYTES      (64UL * 1024)
+// 精灵bundle的背景图使用的帧号
+#define FRAME_CACHE_BACKGROUND      0xFFFF
+
+namespace BirdWatching {
+
+/**
+ * @brief 解码后帧的内存缓存, 按(小鸟ID, 帧号)做LRU
+ *
+ * - 整段动画估计大小不超过预算时, 播放期间该小鸟被固定(pin): 读过的帧留在缓存中,
+ *   循环播放从第二圈开始不再读SD; 放不下的动画不进缓存(循环访问下LRU只会抖动)
+ * - 换鸟后之前小鸟的帧继续保留, 预算不够时先淘汰它们, 再次触发同一只小鸟可直接命中
+ * - 动画需要内存时(makeRoom)缓存最先被淘汰; 正在显示的帧有引用计数, 不会被淘汰
+ * - 预热(warm)的小鸟可以在预算之外再占用FRAME_CACHE_WARM_BYTES, 触发时直接命中
+ *
+ * 只在UI任务中使用(调用方持有LVGL锁); 串口命令访问前也需先获取LVGL锁
+ */
+class FrameCache {
+public:
+    static FrameCache* getInstance();
+
+    // 开始播放: clip_bytes不超过预算时固定该小鸟
+    void beginClip(uint16_t bird_id, uint32_t clip_bytes);
+    bool isPinned(uint16_t bird_id) const { return bird_id != 0 && bird_id == pinned_bird_; }
+    // 开始播放不需要缓存的小鸟(帧从flash映射): 取消固定
+    void endClip() { pinned_bird_ = 0; }
+
+    // 预热下一只小鸟: 允许插入它的帧(不固定, 需要内存时和其他小鸟一样先被淘汰)
+    void beginWarm(uint16_t bird_id) { warm_bird_ = bird_id; }
+
+    bool contains(uint16_t bird_id, uint16_t frame) const;
+
+    // 命中时返回缓存的帧并增加引用
+    bool lookup(uint16_t bird_id, uint16_t frame, lv_image_dsc_t** out_dsc, FramePlacement* out_pos);
+
+    // 交给缓存管理(引用计数为1); 预算不足时返回false, 帧仍归调用方
+    bool insert(uint16_t bird_id, uint16_t frame, lv_image_dsc_t* dsc, const FramePlacement& pos,
+                uint32_t sd_bytes);
+
+    // 归还帧: 缓存中的帧只减少引用; 返回false表示不属于缓存, 调用方自行释放
+    bool release(lv_image_dsc_t* dsc);
+
+    // 为新的帧分配腾出内存: 最大空闲块不足时按LRU淘汰未在使用的帧
+    void makeRoom(uint32_t bytes);
+
+    // 淘汰所有未在使用的帧, 返回释放的字节数
+    uint32_t evictAll();
+
+    // 小鸟的bundle被覆盖或删除: 丢弃它的所有帧并取消固定/预热, 返回释放的字节数。
+    // 正在显示的帧移出缓存, 归还时release返回false, 由调用方自行释放
+    uint32_t evictBird(uint16_t bird_id);
+
+    void setBudget(uint32_t bytes);
+    uint32_t getBudget() const { return budget_; }
+    uint32_t getResidentBytes() const { return resident_bytes_; }
+
+    void printStats();
+    void resetStats();
+
+private:
+    FrameCache();
+
+    // 按当前空闲堆计算默认预算(构造时调用, 应在启动时、加载小鸟之前)
+    static uint32_t defaultBudget();
+
+    struct Entry {
+        uint16_t bird_id;
+        uint16_t frame;
+        lv_image_dsc_t* dsc;
+        FramePlacement pos;
+        uint32_t bytes;         // 实际分配的内存(描述符 + 对齐补齐后的像素缓冲区, 含记账头)
+        uint32_t sd_bytes;      // 对应的SD读取量
+        uint32_t last_use;
+        uint8_t refs;
+    };
+
+    static FrameCache* instance_;
+
+    std::vector<Entry> entries_;
+    uint32_t budget_;
+    uint32_t resident_bytes_;
+    uint16_t pinned_bird_;
+    uint16_t warm_bird_;
+    uint32_t use_counter_;
+
+    // 统计
+    uint32_t hits_;
+    uint32_t misses_;
+    uint32_t evictions_;
+    uint64_t sd_bytes_saved_;
+
+    // 淘汰一个未在使用的帧: 优先其他小鸟, include_pinned为false时不动固定的小鸟
+    bool evictOne(bool include_pinned);
+    void evictAt(size_t index);
+
+    FrameCache(const FrameCache&) = delete;
+    FrameCache& operator=(const FrameCache&) = delete;
+};
+
+} // namespace BirdWatching
+
+#endif // FRAME_CACHE_H
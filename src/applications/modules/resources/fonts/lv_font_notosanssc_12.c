@@ -1,1867 +0,0 @@
-/*******************************************************************************
- * Size: 12 px
- * Bpp: 2
- * Opts: --bpp 2 --size 12 --no-compress --stride 1 --align 1 --font NotoSansSC-Medium.ttf --symbols  !#$%&()*+,-./0123456789:@ABCDEFGHIJKLMNOPQRSTUVWXYZ^_abcdefghijklmnopqrstuvwxyz—…。䴘䴙一上下乌了八冠凤加卷叉反发叶哥啄喜嘴噪夜大太头寿小尾山带恶戴拟捣文斑新日普暗木本来松林次水池灰燕狗珠琵白眶眼紫红统绣绿缝翅翠翡耳胜胸脚脸腰腹苇苍苦莺蓝蛇蛋蜂褐观角计通金银长阳隼雀雕雨页领颈鬼鱼鳽鵟鸟鸠鸢鸦鸫鸬鸮鸰鸲鸺鸻鹃鹊鹎鹚鹞鹠鹡鹬鹭鹰黄黑！（），：？￥ --format lvgl -o lv_font_notosanssc_12.c
- ******************************************************************************/
-
-#ifdef __has_include
-    #if __has_include("lvgl.h")
-        #ifndef LV_LVGL_H_INCLUDE_SIMPLE
-            #define LV_LVGL_H_INCLUDE_SIMPLE
-        #endif
-    #endif
-#endif
-
-#ifdef LV_LVGL_H_INCLUDE_SIMPLE
-    #include "lvgl.h"
-#else
-    #include "lvgl/lvgl.h"
-#endif
-
-
-
-#ifndef LV_FONT_NOTOSANSSC_12
-#define LV_FONT_NOTOSANSSC_12 1
-#endif
-
-#if LV_FONT_NOTOSANSSC_12
-
-/*-----------------
- *    BITMAPS
- *----------------*/
-
-/*Store the image of the glyphs*/
-static LV_ATTRIBUTE_LARGE_CONST const uint8_t glyph_bitmap[] = {
-    /* U+0020 " " */
-
-    /* U+0021 "!" */
-    0xba, 0xaa, 0x66, 0xb, 0xb0,
-
-    /* U+0023 "#" */
-    0xc, 0x60, 0x31, 0x43, 0xff, 0x42, 0x20, 0x18,
-    0xc2, 0xff, 0xc2, 0x4c, 0x8, 0x20, 0x20, 0x80,
-
-    /* U+0024 "$" */
-    0x1, 0x0, 0xc, 0x0, 0xfd, 0xe, 0x14, 0x34,
-    0x0, 0xb4, 0x0, 0xbc, 0x0, 0x3c, 0x0, 0x70,
-    0xd2, 0xc2, 0xfc, 0x0, 0xc0, 0x1, 0x0,
-
-    /* U+0025 "%" */
-    0x2e, 0x2, 0x1, 0x89, 0x8, 0x9, 0x18, 0x80,
-    0x18, 0x96, 0x78, 0x2e, 0x33, 0x18, 0x1, 0x98,
-    0x30, 0xc, 0x60, 0xc0, 0x50, 0xc6, 0x3, 0x1,
-    0xf0,
-
-    /* U+0026 "&" */
-    0xb, 0xc0, 0x7, 0x28, 0x1, 0xcd, 0x0, 0x3e,
-    0x0, 0x1f, 0x3, 0x1d, 0xe2, 0x8b, 0xf, 0xc1,
-    0xd2, 0xf4, 0x2f, 0xd7, 0x0,
-
-    /* U+0028 "(" */
-    0x0, 0x93, 0x18, 0x93, 0x4c, 0x30, 0xd2, 0x46,
-    0xc, 0x24, 0x0,
-
-    /* U+0029 ")" */
-    0x0, 0x30, 0x34, 0x18, 0xc, 0xc, 0xc, 0xc,
-    0xc, 0xc, 0x18, 0x24, 0x30, 0x0,
-
-    /* U+002A "*" */
-    0x9, 0x2, 0xe8, 0x1f, 0x1, 0xb4, 0x0, 0x0,
-
-    /* U+002B "+" */
-    0x1, 0x0, 0xc, 0x0, 0x30, 0x2f, 0xfd, 0x3,
-    0x0, 0xc, 0x0, 0x30, 0x0,
-
-    /* U+002C "," */
-    0x24, 0xf0, 0xcd, 0x0,
-
-    /* U+002D "-" */
-    0x7e, 0x0,
-
-    /* U+002E "." */
-    0x0, 0xe3, 0x80,
-
-    /* U+002F "/" */
-    0x2, 0x40, 0xc0, 0x20, 0x14, 0xc, 0x3, 0x1,
-    0x80, 0x90, 0x30, 0xc, 0x6, 0x2, 0x0,
-
-    /* U+0030 "0" */
-    0xf, 0x80, 0xe2, 0x83, 0x7, 0x1c, 0xc, 0x70,
-    0x35, 0xc0, 0xc3, 0x7, 0xe, 0x38, 0xf, 0x80,
-
-    /* U+0031 "1" */
-    0x2d, 0x6, 0xd0, 0xd, 0x0, 0xd0, 0xd, 0x0,
-    0xd0, 0xd, 0x0, 0xd0, 0xff, 0xc0,
-
-    /* U+0032 "2" */
-    0x2f, 0x81, 0xc7, 0x80, 0xb, 0x0, 0x28, 0x0,
-    0xd0, 0xe, 0x0, 0xb0, 0xb, 0x40, 0x7f, 0xf0,
-
-    /* U+0033 "3" */
-    0x2f, 0xc0, 0x83, 0xc0, 0xe, 0x3, 0xf0, 0x1,
-    0xe0, 0x1, 0xc0, 0x7, 0x1d, 0x7c, 0x2f, 0x80,
-
-    /* U+0034 "4" */
-    0x2, 0xd0, 0x1f, 0x40, 0xdd, 0xa, 0x34, 0x70,
-    0xd3, 0xff, 0xd0, 0xd, 0x0, 0x34, 0x0, 0xd0,
-
-    /* U+0035 "5" */
-    0x2f, 0xf0, 0xe0, 0x3, 0x40, 0xf, 0xe0, 0x10,
-    0xf0, 0x1, 0xc0, 0x7, 0x19, 0x7c, 0x2f, 0x80,
-
-    /* U+0036 "6" */
-    0xb, 0xe0, 0xb5, 0x43, 0x40, 0x1d, 0xf4, 0x78,
-    0xb1, 0xc0, 0xd3, 0x3, 0x4a, 0x2c, 0xb, 0xc0,
-
-    /* U+0037 "7" */
-    0x7f, 0xf4, 0x2, 0xc0, 0xc, 0x0, 0xa0, 0x3,
-    0x40, 0xc, 0x0, 0x70, 0x2, 0xc0, 0xb, 0x0,
-
-    /* U+0038 "8" */
-    0xf, 0xc0, 0xe2, 0xc3, 0x3, 0xa, 0x18, 0x1f,
-    0xc0, 0xc2, 0xc7, 0x3, 0x5d, 0x1c, 0x1f, 0xd0,
-
-    /* U+0039 "9" */
-    0x1f, 0x80, 0xd3, 0x87, 0x7, 0x1c, 0x1c, 0x2f,
-    0xb0, 0x0, 0xc0, 0x7, 0x9, 0x74, 0x2f, 0x80,
-
-    /* U+003A ":" */
-    0x38, 0xe0, 0x0, 0x0, 0xe3, 0x80,
-
-    /* U+0040 "@" */
-    0x0, 0xbf, 0x80, 0x1d, 0x2, 0xc1, 0xc0, 0x2,
-    0x4d, 0x1f, 0xc3, 0x30, 0xc7, 0xd, 0x86, 0x18,
-    0x36, 0x24, 0x60, 0xcc, 0xa3, 0x89, 0x34, 0xf7,
-    0xd0, 0x38, 0x0, 0x0, 0x2f, 0xe0, 0x0,
-
-    /* U+0041 "A" */
-    0x3, 0x80, 0xa, 0xc0, 0xd, 0xd0, 0xc, 0xa0,
-    0x28, 0x70, 0x3f, 0xf4, 0x34, 0x38, 0xb0, 0x1c,
-    0xe0, 0xd,
-
-    /* U+0042 "B" */
-    0xff, 0x83, 0x83, 0xce, 0x7, 0x38, 0x28, 0xff,
-    0xd3, 0x81, 0xce, 0x3, 0x78, 0x1d, 0xff, 0xd0,
-
-    /* U+0043 "C" */
-    0x7, 0xf4, 0x1e, 0x5c, 0x38, 0x0, 0x30, 0x0,
-    0x70, 0x0, 0x30, 0x0, 0x38, 0x0, 0x1e, 0x5c,
-    0x7, 0xf4,
-
-    /* U+0044 "D" */
-    0xff, 0x83, 0x87, 0xce, 0x3, 0x78, 0xe, 0xe0,
-    0x2b, 0x80, 0xee, 0x3, 0x78, 0x7c, 0xff, 0x80,
-
-    /* U+0045 "E" */
-    0xff, 0xde, 0x0, 0xe0, 0xe, 0x0, 0xff, 0xce,
-    0x0, 0xe0, 0xe, 0x0, 0xff, 0xe0,
-
-    /* U+0046 "F" */
-    0xff, 0xde, 0x0, 0xe0, 0xe, 0x0, 0xff, 0xce,
-    0x0, 0xe0, 0xe, 0x0, 0xe0, 0x0,
-
-    /* U+0047 "G" */
-    0x7, 0xf8, 0x1e, 0x58, 0x38, 0x0, 0x30, 0x0,
-    0x70, 0x7e, 0x30, 0xe, 0x38, 0xa, 0x1e, 0x5e,
-    0x7, 0xf8,
-
-    /* U+0048 "H" */
-    0xe0, 0x2b, 0x80, 0xae, 0x2, 0xb8, 0xa, 0xff,
-    0xfb, 0x80, 0xae, 0x2, 0xb8, 0xa, 0xe0, 0x28,
-
-    /* U+0049 "I" */
-    0xee, 0xee, 0xee, 0xee, 0xe0,
-
-    /* U+004A "J" */
-    0x0, 0xd0, 0xd, 0x0, 0xd0, 0xd, 0x0, 0xd0,
-    0xd, 0x0, 0xd7, 0x6c, 0x2f, 0x40,
-
-    /* U+004B "K" */
-    0xe0, 0x73, 0x87, 0x4e, 0x38, 0x3b, 0xc0, 0xff,
-    0x43, 0xcb, 0xe, 0xe, 0x38, 0x1c, 0xe0, 0x38,
-
-    /* U+004C "L" */
-    0xe0, 0xe, 0x0, 0xe0, 0xe, 0x0, 0xe0, 0xe,
-    0x0, 0xe0, 0xe, 0x0, 0xff, 0xd0,
-
-    /* U+004D "M" */
-    0xf0, 0xf, 0xf4, 0x1f, 0xf8, 0x2f, 0xec, 0x3b,
-    0xdd, 0x67, 0xd6, 0x97, 0xd3, 0xc7, 0xd2, 0x87,
-    0xd0, 0x7,
-
-    /* U+004E "N" */
-    0xf0, 0x2b, 0xd0, 0xae, 0xc2, 0xb7, 0x8a, 0xd7,
-    0x2b, 0x4a, 0xad, 0xe, 0xb4, 0x2e, 0xd0, 0x38,
-
-    /* U+004F "O" */
-    0x7, 0xf4, 0x7, 0x9b, 0x83, 0x80, 0x71, 0xc0,
-    0xd, 0x70, 0x3, 0x4c, 0x0, 0xd3, 0x80, 0xb0,
-    0x79, 0xb4, 0x7, 0xf4, 0x0,
-
-    /* U+0050 "P" */
-    0xff, 0xc3, 0x82, 0xce, 0x3, 0x38, 0x2c, 0xff,
-    0xd3, 0x80, 0xe, 0x0, 0x38, 0x0, 0xe0, 0x0,
-
-    /* U+0051 "Q" */
-    0x7, 0xf4, 0x7, 0x9b, 0x83, 0x80, 0x71, 0xc0,
-    0xd, 0x70, 0x3, 0x4c, 0x0, 0xd3, 0x80, 0x70,
-    0x74, 0x74, 0x7, 0xf4, 0x0, 0x3c, 0x0, 0x2,
-    0xf8, 0x0, 0x0,
-
-    /* U+0052 "R" */
-    0xff, 0xd3, 0x82, 0xce, 0x3, 0x38, 0x2c, 0xff,
-    0xd3, 0x8e, 0xe, 0x1c, 0x38, 0x3c, 0xe0, 0x74,
-
-    /* U+0053 "S" */
-    0xb, 0xe0, 0xf5, 0xc3, 0x40, 0xb, 0x40, 0xb,
-    0xe0, 0x1, 0xe0, 0x2, 0xce, 0x5e, 0x1f, 0xe0,
-
-    /* U+0054 "T" */
-    0xbf, 0xfc, 0x1e, 0x0, 0x34, 0x0, 0xd0, 0x3,
-    0x40, 0xd, 0x0, 0x34, 0x0, 0xd0, 0x3, 0x40,
-
-    /* U+0055 "U" */
-    0xe0, 0x2b, 0x80, 0xae, 0x2, 0xb8, 0xa, 0xe0,
-    0x2b, 0x80, 0xaa, 0x3, 0x9e, 0x6c, 0x1f, 0xd0,
-
-    /* U+0056 "V" */
-    0x38, 0x7, 0xb, 0x2, 0x81, 0xc0, 0xd0, 0x34,
-    0x30, 0xa, 0x2c, 0x1, 0xcd, 0x0, 0x37, 0x0,
-    0xb, 0xc0, 0x1, 0xe0, 0x0,
-
-    /* U+0057 "W" */
-    0xb0, 0x70, 0x35, 0xc2, 0xd0, 0xc3, 0xe, 0x87,
-    0xd, 0x37, 0x2c, 0x35, 0xcc, 0xa0, 0xaa, 0x37,
-    0x41, 0xe4, 0xac, 0x3, 0xc1, 0xf0, 0xf, 0x3,
-    0xc0,
-
-    /* U+0058 "X" */
-    0x70, 0x38, 0xe1, 0xc1, 0xcd, 0x3, 0xf0, 0x7,
-    0x80, 0x3b, 0x1, 0xce, 0xd, 0x1c, 0xb0, 0x38,
-
-    /* U+0059 "Y" */
-    0x38, 0xd, 0x1c, 0x1c, 0xe, 0x34, 0x7, 0x70,
-    0x3, 0xe0, 0x1, 0xc0, 0x1, 0xc0, 0x1, 0xc0,
-    0x1, 0xc0,
-
-    /* U+005A "Z" */
-    0x3f, 0xf8, 0x1, 0xd0, 0xe, 0x0, 0x70, 0x3,
-    0x40, 0x38, 0x1, 0xc0, 0xe, 0x0, 0x7f, 0xfc,
-
-    /* U+005E "^" */
-    0x2, 0x0, 0x2d, 0x0, 0xdc, 0x7, 0x30, 0x24,
-    0xa0, 0xc1, 0xc0,
-
-    /* U+005F "_" */
-    0xbf, 0xf8,
-
-    /* U+0061 "a" */
-    0x1f, 0xc2, 0x4f, 0x0, 0xb1, 0xeb, 0x30, 0x77,
-    0x4f, 0x2f, 0x70,
-
-    /* U+0062 "b" */
-    0xd0, 0xd, 0x0, 0xd0, 0xe, 0xf8, 0xf5, 0xed,
-    0xb, 0xd0, 0x7d, 0xb, 0xf5, 0xdd, 0xf8,
-
-    /* U+0063 "c" */
-    0xb, 0xd3, 0xd4, 0x70, 0x7, 0x0, 0x70, 0x3,
-    0xd5, 0xb, 0xd0,
-
-    /* U+0064 "d" */
-    0x0, 0x38, 0x0, 0xe0, 0x3, 0x83, 0xee, 0x3c,
-    0x79, 0xc0, 0xe7, 0x3, 0x9c, 0xe, 0x38, 0x78,
-    0x7e, 0xa0,
-
-    /* U+0065 "e" */
-    0xb, 0xc0, 0xe1, 0xc7, 0x3, 0x1f, 0xfd, 0x70,
-    0x0, 0xe0, 0x40, 0xbe, 0x0,
-
-    /* U+0066 "f" */
-    0xf, 0x4b, 0x2, 0x82, 0xfc, 0x38, 0xa, 0x2,
-    0x80, 0xa0, 0x28, 0xa, 0x0,
-
-    /* U+0067 "g" */
-    0x1f, 0xf8, 0xd2, 0x83, 0x7, 0xd, 0x28, 0x2f,
-    0x80, 0xd0, 0x2, 0xff, 0x5c, 0xa, 0x70, 0x34,
-    0xbf, 0x40,
-
-    /* U+0068 "h" */
-    0xd0, 0xd, 0x0, 0xd0, 0xe, 0xf8, 0xf5, 0xdd,
-    0xe, 0xd0, 0xed, 0xe, 0xd0, 0xed, 0xe,
-
-    /* U+0069 "i" */
-    0x34, 0x90, 0xd, 0x34, 0xd3, 0x4d, 0x34, 0xd0,
-
-    /* U+006A "j" */
-    0xd, 0x9, 0x0, 0xd, 0xd, 0xd, 0xd, 0xd,
-    0xd, 0xd, 0xd, 0x1d, 0x78,
-
-    /* U+006B "k" */
-    0xd0, 0xd, 0x0, 0xd0, 0xd, 0x1c, 0xd3, 0x4d,
-    0xe0, 0xfe, 0xf, 0x34, 0xd2, 0xcd, 0xd,
-
-    /* U+006C "l" */
-    0xd3, 0x4d, 0x34, 0xd3, 0x4d, 0x34, 0xe2, 0xc0,
-
-    /* U+006D "m" */
-    0xdf, 0x8f, 0x8f, 0x1f, 0x1c, 0xd0, 0xd0, 0xdd,
-    0xd, 0xd, 0xd0, 0xd0, 0xdd, 0xd, 0xd, 0xd0,
-    0xd0, 0xd0,
-
-    /* U+006E "n" */
-    0xdf, 0x8f, 0xd, 0xd0, 0xed, 0xe, 0xd0, 0xed,
-    0xe, 0xd0, 0xe0,
-
-    /* U+006F "o" */
-    0xb, 0xd0, 0xe1, 0xd7, 0x3, 0x9c, 0xb, 0x70,
-    0x38, 0xe1, 0xd0, 0xbd, 0x0,
-
-    /* U+0070 "p" */
-    0xef, 0x8f, 0xe, 0xd0, 0xbd, 0x7, 0xd0, 0xbf,
-    0x5d, 0xef, 0x8d, 0x0, 0xd0, 0xd, 0x0,
-
-    /* U+0071 "q" */
-    0xf, 0xa8, 0xf1, 0xe7, 0x3, 0x9c, 0xe, 0x70,
-    0x38, 0xe1, 0xe1, 0xfb, 0x80, 0xe, 0x0, 0x38,
-    0x0, 0xe0,
-
-    /* U+0072 "r" */
-    0x0, 0xdf, 0xf4, 0xe0, 0xd0, 0xd0, 0xd0, 0xd0,
-
-    /* U+0073 "s" */
-    0x2f, 0x83, 0x44, 0x34, 0x1, 0xf4, 0x1, 0xd6,
-    0x1c, 0x2f, 0x80,
-
-    /* U+0074 "t" */
-    0x28, 0xa, 0xb, 0xf4, 0xe0, 0x28, 0xa, 0x2,
-    0x80, 0xb0, 0xf, 0x40,
-
-    /* U+0075 "u" */
-    0x34, 0x34, 0xd0, 0xd3, 0x43, 0x4d, 0xd, 0x34,
-    0x34, 0xe6, 0xd1, 0xf7, 0x40,
-
-    /* U+0076 "v" */
-    0xa0, 0x31, 0xc1, 0xc3, 0x4a, 0xa, 0x30, 0x1d,
-    0xc0, 0x3e, 0x0, 0xb4, 0x0,
-
-    /* U+0077 "w" */
-    0xb0, 0xf0, 0xe7, 0xf, 0xd, 0x35, 0xb4, 0xc3,
-    0x9a, 0x9c, 0x2a, 0x5e, 0x81, 0xf0, 0xf4, 0xf,
-    0xf, 0x0,
-
-    /* U+0078 "x" */
-    0x70, 0xa0, 0xe3, 0x0, 0xf8, 0x3, 0xc0, 0x1f,
-    0x80, 0xd7, 0xb, 0xb, 0x0,
-
-    /* U+0079 "y" */
-    0xa0, 0x31, 0xc1, 0xc3, 0x4a, 0xa, 0x30, 0xd,
-    0xc0, 0x3e, 0x0, 0x74, 0x1, 0xc0, 0xe, 0x1,
-    0xe0, 0x0,
-
-    /* U+007A "z" */
-    0x3f, 0xd0, 0x2c, 0x3, 0x40, 0xe0, 0x1c, 0x3,
-    0x80, 0xbf, 0xe0,
-
-    /* U+2014 "—" */
-    0x7f, 0xff, 0xf0,
-
-    /* U+2026 "…" */
-    0xa0, 0xa0, 0xaa, 0xa, 0xa,
-
-    /* U+3002 "。" */
-    0x2d, 0x83, 0x82, 0x3d,
-
-    /* U+4D18 "䴘" */
-    0x0, 0x0, 0x0, 0x16, 0xb0, 0x90, 0x35, 0x83,
-    0xfc, 0x30, 0xe7, 0x8c, 0x3b, 0xfb, 0x2c, 0x39,
-    0x9b, 0x68, 0x3a, 0xd7, 0x10, 0x38, 0xe6, 0xad,
-    0x2d, 0xe0, 0x9, 0x2e, 0x77, 0xf9, 0x6b, 0x34,
-    0x8, 0x55, 0x10, 0x3c,
-
-    /* U+4D19 "䴙" */
-    0x0, 0x0, 0x50, 0x3f, 0x31, 0xe4, 0x33, 0xff,
-    0xac, 0x33, 0x8b, 0x9c, 0x3b, 0x9b, 0x2c, 0x35,
-    0xab, 0x2c, 0x35, 0xbb, 0x10, 0x3b, 0x32, 0xae,
-    0x77, 0xfd, 0x55, 0xb7, 0x32, 0xa9, 0xaf, 0x30,
-    0x9, 0x24, 0x30, 0x3c,
-
-    /* U+4E00 "一" */
-    0x15, 0x55, 0x54, 0x7f, 0xff, 0xfe,
-
-    /* U+4E0A "上" */
-    0x0, 0x30, 0x0, 0x0, 0x30, 0x0, 0x0, 0x30,
-    0x0, 0x0, 0x30, 0x0, 0x0, 0x3f, 0xf4, 0x0,
-    0x30, 0x0, 0x0, 0x30, 0x0, 0x0, 0x30, 0x0,
-    0x0, 0x30, 0x0, 0x6a, 0xfa, 0xa8, 0x55, 0x55,
-    0x54,
-
-    /* U+4E0B "下" */
-    0x15, 0x55, 0x54, 0x7f, 0xff, 0xfd, 0x0, 0x34,
-    0x0, 0x0, 0x34, 0x0, 0x0, 0x3f, 0x0, 0x0,
-    0x36, 0xe0, 0x0, 0x34, 0x34, 0x0, 0x34, 0x0,
-    0x0, 0x34, 0x0, 0x0, 0x34, 0x0, 0x0, 0x34,
-    0x0,
-
-    /* U+4E4C "乌" */
-    0x0, 0x0, 0x0, 0x0, 0x30, 0x0, 0xb, 0xff,
-    0xf0, 0xd, 0x0, 0x70, 0xd, 0x1, 0xa0, 0xd,
-    0x1, 0x40, 0xf, 0xff, 0xfc, 0x0, 0x0, 0xc,
-    0x0, 0x0, 0xc, 0x7f, 0xff, 0xcc, 0x0, 0x0,
-    0x1c, 0x0, 0x1, 0xf4,
-
-    /* U+4E86 "了" */
-    0x0, 0x0, 0x2, 0xff, 0xff, 0xc0, 0x0, 0x3c,
-    0x0, 0x7, 0x80, 0x0, 0x74, 0x0, 0x1, 0xc0,
-    0x0, 0x7, 0x0, 0x0, 0x1c, 0x0, 0x0, 0x70,
-    0x0, 0x1, 0xc0, 0x0, 0xbe, 0x0, 0x0, 0x0,
-    0x0,
-
-    /* U+516B "八" */
-    0x0, 0x0, 0x0, 0x2, 0x83, 0x0, 0x2, 0x83,
-    0x40, 0x2, 0x42, 0x40, 0x3, 0x42, 0x80, 0x3,
-    0x1, 0xc0, 0x7, 0x0, 0xd0, 0xd, 0x0, 0xa0,
-    0x1c, 0x0, 0x34, 0x34, 0x0, 0x2c, 0x60, 0x0,
-    0x9,
-
-    /* U+51A0 "冠" */
-    0x3f, 0xff, 0xfc, 0x30, 0x0, 0xc, 0x30, 0x0,
-    0x2c, 0x2f, 0xe0, 0x34, 0x0, 0xa, 0xb9, 0x7f,
-    0xf6, 0x30, 0xc, 0xc3, 0x30, 0xc, 0xc1, 0x30,
-    0x18, 0xc0, 0xf5, 0x34, 0xc0, 0xa, 0x60, 0xbf,
-    0xfc, 0x0, 0x0, 0x0,
-
-    /* U+51E4 "凤" */
-    0x1f, 0xff, 0xf0, 0x1c, 0x0, 0x30, 0x1c, 0x0,
-    0x30, 0x1d, 0xff, 0x70, 0x1c, 0x3, 0x30, 0x18,
-    0xc6, 0x30, 0x18, 0x7c, 0x34, 0x28, 0x3d, 0x34,
-    0x34, 0xb7, 0x65, 0x33, 0x81, 0x1a, 0x60, 0x0,
-    0xd, 0x0, 0x0, 0x0,
-
-    /* U+52A0 "加" */
-    0xd, 0x0, 0x0, 0xd, 0x2, 0xa8, 0x7f, 0xf3,
-    0x5c, 0xd, 0x73, 0xc, 0xc, 0x73, 0xc, 0xc,
-    0x63, 0xc, 0xc, 0x63, 0xc, 0x1c, 0x63, 0xc,
-    0x28, 0xa3, 0xc, 0x34, 0xa3, 0xfc, 0x63, 0xc3,
-    0xc, 0x0, 0x0, 0x0,
-
-    /* U+5377 "卷" */
-    0x0, 0x0, 0x0, 0x1, 0x18, 0x50, 0x3, 0x28,
-    0xd0, 0x1f, 0xff, 0xf8, 0x0, 0xb0, 0x0, 0x3f,
-    0xff, 0xfe, 0x7, 0x41, 0xd0, 0x2f, 0xff, 0xbd,
-    0x13, 0x2, 0x45, 0x3, 0x1f, 0x10, 0x3, 0x0,
-    0x34, 0x2, 0xff, 0xf0,
-
-    /* U+53C9 "叉" */
-    0x0, 0x0, 0x0, 0x3f, 0xff, 0xf4, 0xd, 0x10,
-    0x30, 0xa, 0x34, 0x60, 0x3, 0xc, 0xd0, 0x2,
-    0xc2, 0x80, 0x0, 0xeb, 0x0, 0x0, 0x3c, 0x0,
-    0x1, 0xff, 0x40, 0x1f, 0x81, 0xf8, 0x74, 0x0,
-    0x18, 0x0, 0x0, 0x0,
-
-    /* U+53CD "反" */
-    0x0, 0x0, 0x0, 0x4, 0x56, 0xf0, 0xf, 0xe9,
-    0x40, 0xc, 0x0, 0x0, 0xd, 0x55, 0x50, 0xf,
-    0xff, 0xf0, 0xc, 0xc0, 0x70, 0xc, 0x70, 0xd0,
-    0x1c, 0x3b, 0x80, 0x28, 0x1f, 0x0, 0x34, 0xbb,
-    0xd0, 0x33, 0x80, 0x7c, 0x0, 0x0, 0x0,
-
-    /* U+53D1 "发" */
-    0x5, 0x34, 0x80, 0xd, 0x34, 0x70, 0x1d, 0x75,
-    0x64, 0x2f, 0xff, 0xfc, 0x0, 0xe0, 0x0, 0x1,
-    0xff, 0xf0, 0x3, 0xe0, 0xa0, 0xb, 0x36, 0xc0,
-    0x2c, 0x1f, 0x0, 0xb0, 0x7f, 0xd0, 0x3, 0x90,
-    0x7c, 0x0, 0x0, 0x0,
-
-    /* U+53F6 "叶" */
-    0x0, 0x3, 0x40, 0x3f, 0x83, 0x40, 0x32, 0x83,
-    0x40, 0x32, 0x83, 0x40, 0x32, 0xff, 0xfd, 0x32,
-    0x83, 0x40, 0x32, 0x83, 0x40, 0x3f, 0x83, 0x40,
-    0x30, 0x3, 0x40, 0x0, 0x3, 0x40, 0x0, 0x3,
-    0x40,
-
-    /* U+54E5 "哥" */
-    0x3f, 0xff, 0xfc, 0x0, 0x0, 0x70, 0xf, 0xfd,
-    0x30, 0xd, 0xd, 0x30, 0x6, 0xa8, 0x30, 0x7f,
-    0xff, 0xfd, 0x0, 0x0, 0x74, 0xf, 0xfd, 0x30,
-    0xc, 0xd, 0x30, 0xf, 0xfc, 0x30, 0x4, 0x3,
-    0xf0, 0x0, 0x0, 0x0,
-
-    /* U+5544 "啄" */
-    0x0, 0x15, 0x54, 0x3f, 0xbf, 0xfd, 0x33, 0xa,
-    0x0, 0x33, 0x7b, 0xd, 0x33, 0x93, 0xb8, 0x33,
-    0x3e, 0xf0, 0x33, 0xba, 0xd8, 0x3f, 0xb, 0xcc,
-    0x30, 0x78, 0xcd, 0x0, 0x91, 0xc4, 0x0, 0xf,
-    0x40, 0x0, 0x0, 0x0,
-
-    /* U+559C "喜" */
-    0x0, 0x28, 0x0, 0x2a, 0xbe, 0xa8, 0xf, 0xff,
-    0xf4, 0x5, 0x55, 0x50, 0xa, 0x55, 0xb0, 0xb,
-    0xeb, 0xe0, 0x17, 0x96, 0xd5, 0x2a, 0xaa, 0xa9,
-    0xf, 0xff, 0xf0, 0xc, 0x0, 0x30, 0xf, 0xff,
-    0xf0,
-
-    /* U+5634 "嘴" */
-    0x0, 0x0, 0x0, 0x14, 0xce, 0xdc, 0x3d, 0xcd,
-    0xe4, 0x25, 0x5d, 0xc5, 0x26, 0x94, 0x68, 0x25,
-    0x3a, 0xe0, 0x26, 0xff, 0xfc, 0x25, 0x76, 0x5c,
-    0x3d, 0x7b, 0xac, 0x20, 0x7f, 0xfc, 0x0, 0x92,
-    0xc, 0x1, 0xc2, 0x7c, 0x0, 0x0, 0x0,
-
-    /* U+566A "噪" */
-    0x0, 0x2f, 0xf0, 0x3f, 0x24, 0x30, 0x33, 0x2e,
-    0xb0, 0x33, 0x68, 0xa8, 0x33, 0x89, 0xcc, 0x33,
-    0xad, 0xec, 0x33, 0x17, 0x54, 0x3f, 0xff, 0xfd,
-    0x20, 0xf, 0xd0, 0x0, 0xb7, 0x7c, 0x0, 0x83,
-    0x44,
-
-    /* U+591C "夜" */
-    0x0, 0x0, 0x0, 0x0, 0x1c, 0x0, 0x3f, 0xff,
-    0xfe, 0x2, 0x47, 0x0, 0x3, 0xf, 0xfc, 0xe,
-    0x1d, 0x1c, 0x2e, 0x76, 0xa8, 0x3a, 0x9c, 0x70,
-    0xa, 0x7, 0xd0, 0xa, 0x3, 0xc0, 0xa, 0x2d,
-    0xb8, 0xa, 0xa0, 0x1d, 0x0, 0x0, 0x0,
-
-    /* U+5927 "大" */
-    0x0, 0x1c, 0x0, 0x0, 0x1c, 0x0, 0x0, 0x28,
-    0x0, 0x3f, 0xff, 0xfe, 0x0, 0x3d, 0x0, 0x0,
-    0x3e, 0x0, 0x0, 0xb3, 0x0, 0x0, 0xd2, 0xc0,
-    0x3, 0x80, 0xe0, 0x2e, 0x0, 0x3d, 0x24, 0x0,
-    0x8,
-
-    /* U+592A "太" */
-    0x0, 0x1c, 0x0, 0x0, 0x1c, 0x0, 0x0, 0x28,
-    0x0, 0x3f, 0xff, 0xfe, 0x0, 0x3d, 0x0, 0x0,
-    0x3a, 0x0, 0x0, 0x73, 0x0, 0x0, 0xd2, 0xc0,
-    0x3, 0xf0, 0xe0, 0x1e, 0x2c, 0x3c, 0x34, 0x8,
-    0x9, 0x0, 0x0, 0x0,
-
-    /* U+5934 "头" */
-    0x1, 0xa, 0x0, 0x2, 0xda, 0x0, 0x4, 0xa,
-    0x0, 0xf, 0x4a, 0x0, 0x1, 0x49, 0x0, 0x3f,
-    0xff, 0xfe, 0x0, 0x1c, 0x0, 0x0, 0x3a, 0x40,
-    0x0, 0xe1, 0xe0, 0x1b, 0x80, 0x2d, 0x24, 0x0,
-    0x4,
-
-    /* U+5BFF "寿" */
-    0x0, 0x0, 0x0, 0x0, 0x34, 0x0, 0x2f, 0xff,
-    0xf8, 0x5, 0x75, 0x50, 0x5, 0xf5, 0x50, 0x3f,
-    0xff, 0xfd, 0x1, 0xc0, 0x50, 0x3, 0x95, 0xd4,
-    0xb, 0xaa, 0xf8, 0x2c, 0xd0, 0xd0, 0x20, 0x70,
-    0xd0, 0x0, 0x7, 0xc0, 0x0, 0x0, 0x0,
-
-    /* U+5C0F "小" */
-    0x0, 0x1c, 0x0, 0x0, 0x1c, 0x0, 0x0, 0x1c,
-    0x0, 0xa, 0x1c, 0x30, 0xd, 0x1c, 0x28, 0xc,
-    0x1c, 0x1c, 0x28, 0x1c, 0xd, 0x30, 0x1c, 0xb,
-    0x0, 0x1c, 0x1, 0x0, 0x1c, 0x0, 0x1, 0xf8,
-    0x0, 0x0, 0x0, 0x0,
-
-    /* U+5C3E "尾" */
-    0x2f, 0xff, 0xfc, 0x28, 0x0, 0xc, 0x2e, 0xaa,
-    0xbc, 0x28, 0x1, 0x90, 0x29, 0xaf, 0x80, 0x29,
-    0x5c, 0x50, 0x2a, 0xbf, 0x90, 0x25, 0x1d, 0x6d,
-    0x36, 0xfe, 0x54, 0x30, 0xc, 0xa, 0x60, 0xf,
-    0xfc, 0x0, 0x0, 0x0,
-
-    /* U+5C71 "山" */
-    0x0, 0xd0, 0x0, 0xd, 0x0, 0x40, 0xd0, 0x5d,
-    0xd, 0xa, 0xd0, 0xd0, 0xad, 0xd, 0xa, 0xd0,
-    0xd0, 0xad, 0xd, 0xa, 0xd0, 0xd0, 0xaf, 0xff,
-    0xfe, 0x0, 0x0, 0xa0,
-
-    /* U+5E26 "带" */
-    0xa, 0x34, 0x70, 0x7f, 0xff, 0xfe, 0xa, 0x34,
-    0x70, 0x0, 0x10, 0x10, 0x3f, 0xff, 0xfc, 0x30,
-    0x34, 0xc, 0x1f, 0xff, 0xf8, 0xc, 0x34, 0x30,
-    0xc, 0x34, 0x30, 0xc, 0x34, 0xf0, 0x0, 0x34,
-    0x0,
-
-    /* U+6076 "恶" */
-    0x3f, 0xff, 0xfc, 0x15, 0xeb, 0x54, 0xc, 0xd3,
-    0x34, 0x9, 0xd3, 0x70, 0x0, 0xd3, 0x0, 0x7f,
-    0xff, 0xfd, 0x0, 0x34, 0x0, 0x17, 0x1c, 0x24,
-    0x27, 0x9, 0x1c, 0x33, 0x40, 0x9d, 0x22, 0xff,
-    0xc4,
-
-    /* U+6234 "戴" */
-    0x3, 0x43, 0x60, 0x2b, 0xab, 0x68, 0xab, 0xeb,
-    0xe8, 0x15, 0x57, 0x80, 0x37, 0xae, 0x48, 0x37,
-    0xae, 0x98, 0x1e, 0xe5, 0xf4, 0x2e, 0xf8, 0xf0,
-    0x6e, 0xf8, 0xd0, 0x8, 0x92, 0xe9, 0x30, 0x26,
-    0x3c, 0x0, 0x0, 0x0,
-
-    /* U+62DF "拟" */
-    0x0, 0x0, 0x0, 0xc, 0x30, 0x1c, 0xc, 0x3a,
-    0x18, 0x7f, 0x33, 0x18, 0xc, 0x33, 0x68, 0xc,
-    0x31, 0x64, 0x1f, 0x30, 0x34, 0xbc, 0x31, 0x34,
-    0xc, 0x3b, 0xbc, 0xc, 0x78, 0xdd, 0xc, 0x92,
-    0xca, 0x38, 0x2, 0x1,
-
-    /* U+6363 "捣" */
-    0x0, 0x0, 0x0, 0xc, 0x7, 0x0, 0xc, 0x3a,
-    0xb4, 0xbf, 0x75, 0x24, 0xc, 0x32, 0x70, 0xc,
-    0x30, 0xa0, 0x1f, 0x7f, 0xfd, 0xbc, 0x0, 0x9,
-    0xc, 0x8c, 0x8c, 0xc, 0xcc, 0xcc, 0xc, 0xbf,
-    0xcc, 0x38, 0x0, 0xb8,
-
-    /* U+6587 "文" */
-    0x0, 0x0, 0x0, 0x0, 0x2c, 0x0, 0x0, 0xc,
-    0x0, 0x3f, 0xff, 0xfe, 0x3, 0x0, 0xa0, 0x2,
-    0x80, 0xc0, 0x0, 0xc2, 0x80, 0x0, 0x7b, 0x0,
-    0x0, 0x3d, 0x0, 0x0, 0xfb, 0x40, 0x1b, 0x81,
-    0xf8, 0x38, 0x0, 0x19,
-
-    /* U+6591 "斑" */
-    0x0, 0x0, 0x0, 0x15, 0x24, 0x54, 0x2e, 0x18,
-    0xb9, 0xc, 0xff, 0x30, 0xc, 0x49, 0x30, 0x2d,
-    0x9c, 0x30, 0x2d, 0x3c, 0xfd, 0xc, 0x2c, 0x30,
-    0xc, 0x2c, 0x30, 0x1f, 0x79, 0x30, 0x64, 0xd1,
-    0xb9, 0x0, 0x81, 0xa9,
-
-    /* U+65B0 "新" */
-    0x0, 0x0, 0x0, 0x7, 0x0, 0x68, 0x7f, 0xf7,
-    0x90, 0x14, 0x96, 0x0, 0x18, 0xc6, 0x0, 0x7f,
-    0xfb, 0xfd, 0x3, 0x6, 0x30, 0x7f, 0xf6, 0x30,
-    0x17, 0x4a, 0x30, 0x33, 0x69, 0x30, 0x53, 0x1c,
-    0x30, 0xe, 0x8, 0x30,
-
-    /* U+65E5 "日" */
-    0x3f, 0xff, 0x8c, 0x0, 0xa3, 0x0, 0x28, 0xc0,
-    0xa, 0x30, 0x2, 0x8f, 0xff, 0xe3, 0x0, 0x28,
-    0xc0, 0xa, 0x30, 0x2, 0x8f, 0xff, 0xe3, 0x0,
-    0x28, 0x0, 0x0,
-
-    /* U+666E "普" */
-    0x0, 0x0, 0x0, 0x3, 0x40, 0xc0, 0x2f, 0xff,
-    0xfc, 0xc, 0x93, 0x20, 0x9, 0x93, 0x30, 0x6a,
-    0xfb, 0xa9, 0x15, 0x55, 0x54, 0xf, 0xff, 0xf0,
-    0xd, 0x0, 0x30, 0xf, 0xff, 0xf0, 0xd, 0x0,
-    0x30, 0xf, 0xff, 0xf0, 0x0, 0x0, 0x0,
-
-    /* U+6697 "暗" */
-    0x0, 0x0, 0x0, 0x15, 0x2, 0x80, 0x3b, 0x7f,
-    0xfc, 0x33, 0xc, 0x24, 0x33, 0xc, 0x30, 0x3b,
-    0xbf, 0xfe, 0x37, 0x0, 0x0, 0x33, 0x2f, 0xfc,
-    0x33, 0x24, 0x1c, 0x3f, 0x2e, 0xbc, 0x20, 0x24,
-    0x1c, 0x0, 0x2e, 0xbc, 0x0, 0x0, 0x0,
-
-    /* U+6728 "木" */
-    0x0, 0x34, 0x0, 0x0, 0x34, 0x0, 0x0, 0x34,
-    0x0, 0x7f, 0xff, 0xfc, 0x0, 0xbc, 0x0, 0x1,
-    0xff, 0x0, 0x3, 0x76, 0x80, 0xe, 0x34, 0xe0,
-    0x78, 0x34, 0x3c, 0x50, 0x34, 0x8, 0x0, 0x34,
-    0x0,
-
-    /* U+672C "本" */
-    0x0, 0x34, 0x0, 0x0, 0x34, 0x0, 0x7f, 0xff,
-    0xfc, 0x15, 0xff, 0x54, 0x2, 0xb7, 0x0, 0x7,
-    0x35, 0xc0, 0xd, 0x34, 0xe0, 0x3c, 0x38, 0x78,
-    0xbb, 0xff, 0xdc, 0x0, 0x34, 0x0, 0x0, 0x34,
-    0x0,
-
-    /* U+6765 "来" */
-    0x0, 0x34, 0x0, 0x3f, 0xff, 0xf8, 0x8, 0x34,
-    0x60, 0xa, 0x34, 0xd0, 0x2, 0x34, 0xc0, 0xbf,
-    0xff, 0xfc, 0x0, 0xfe, 0x0, 0x2, 0xbb, 0x40,
-    0xe, 0x34, 0xe0, 0x78, 0x34, 0x3c, 0x0, 0x34,
-    0x4,
-
-    /* U+677E "松" */
-    0xc, 0x8, 0x50, 0xc, 0xc, 0x70, 0xbf, 0x9c,
-    0x30, 0x1d, 0x35, 0x2c, 0x1f, 0x73, 0xc, 0x2f,
-    0x47, 0x0, 0x3d, 0x8d, 0x10, 0x9c, 0xc, 0x30,
-    0x4c, 0x28, 0x38, 0xc, 0x3f, 0xfc, 0xc, 0x24,
-    0x8,
-
-    /* U+6797 "林" */
-    0x3, 0x0, 0xc0, 0x3, 0x0, 0xc0, 0x3f, 0xdf,
-    0xfd, 0x1b, 0x45, 0xe4, 0xf, 0xc2, 0xf0, 0xf,
-    0xa3, 0xf4, 0x2b, 0xa, 0xec, 0x73, 0x1c, 0xcd,
-    0x13, 0x24, 0xc5, 0x3, 0x0, 0xc0, 0x3, 0x0,
-    0xc0,
-
-    /* U+6B21 "次" */
-    0x0, 0x0, 0x0, 0x0, 0x34, 0x0, 0x38, 0x34,
-    0x0, 0xd, 0x7f, 0xfc, 0x0, 0xe2, 0x1c, 0x1,
-    0xc7, 0x28, 0x0, 0x7, 0x10, 0xe, 0xb, 0x40,
-    0x1c, 0xe, 0xc0, 0x34, 0x3c, 0xe0, 0x20, 0xf0,
-    0x38, 0x2, 0x80, 0x8, 0x0, 0x0, 0x0,
-
-    /* U+6C34 "水" */
-    0x0, 0x34, 0x0, 0x0, 0x34, 0x0, 0x0, 0x34,
-    0x20, 0x7f, 0xb8, 0xe0, 0x2, 0x7f, 0x80, 0x3,
-    0x3f, 0x0, 0xa, 0x37, 0x40, 0xc, 0x34, 0xe0,
-    0x38, 0x34, 0x7c, 0x20, 0x34, 0x8, 0x0, 0xf0,
-    0x0,
-
-    /* U+6C60 "池" */
-    0x18, 0x3, 0x40, 0xb, 0x23, 0x40, 0x0, 0x33,
-    0x5c, 0x10, 0x37, 0xec, 0x3c, 0xbf, 0x4c, 0x5,
-    0xf3, 0x4c, 0x0, 0x33, 0x4c, 0x7, 0x33, 0x78,
-    0xd, 0x31, 0x5, 0x2c, 0x30, 0xa, 0x20, 0x2f,
-    0xfc,
-
-    /* U+7070 "灰" */
-    0x0, 0x0, 0x0, 0x2, 0x80, 0x0, 0x3f, 0xff,
-    0xfc, 0x3, 0x41, 0x0, 0x3, 0x3, 0x0, 0x3,
-    0x23, 0x24, 0xa, 0x67, 0x30, 0xd, 0x5b, 0x50,
-    0x1c, 0xf, 0x80, 0x74, 0x2c, 0xe0, 0x10, 0xb0,
-    0x38, 0x1, 0x80, 0x8,
-
-    /* U+71D5 "燕" */
-    0x1, 0x83, 0x40, 0x7f, 0xff, 0xfd, 0x1, 0xd7,
-    0x0, 0xa, 0x55, 0x90, 0x3d, 0xff, 0x7c, 0x9,
-    0xc3, 0x60, 0x1d, 0xd7, 0x65, 0x69, 0xaa, 0x7c,
-    0x8, 0x41, 0x24, 0x34, 0xc3, 0x1c, 0x60, 0x92,
-    0x49, 0x0, 0x0, 0x0,
-
-    /* U+72D7 "狗" */
-    0x22, 0x8, 0x0, 0x2f, 0x28, 0x0, 0x1d, 0x3f,
-    0xfc, 0x7a, 0xa0, 0xc, 0x7, 0x7f, 0xcc, 0xf,
-    0x30, 0xcc, 0x2f, 0x30, 0xcc, 0x73, 0x3f, 0xcc,
-    0x3, 0x30, 0xc, 0x6, 0x0, 0x2c, 0x3d, 0x0,
-    0xf4, 0x0, 0x0, 0x0,
-
-    /* U+73E0 "珠" */
-    0x0, 0x0, 0x0, 0x1f, 0xe7, 0x70, 0x6, 0xe6,
-    0x9c, 0x0, 0x30, 0xff, 0xf0, 0xc, 0x31, 0xc0,
-    0x1f, 0xd4, 0x70, 0x0, 0xc7, 0xff, 0xf0, 0x30,
-    0xf, 0x80, 0xc, 0xb, 0xf0, 0xb, 0xeb, 0x77,
-    0x6, 0x4b, 0x1c, 0xb0, 0x0, 0x7, 0x0,
-
-    /* U+7435 "琵" */
-    0x7f, 0xef, 0xfd, 0x7, 0x0, 0xc0, 0x3f, 0xdf,
-    0xfc, 0x7, 0x0, 0xc0, 0x7f, 0xeb, 0xfd, 0x14,
-    0x4, 0x0, 0x28, 0xd, 0x14, 0x2f, 0xee, 0xf4,
-    0x28, 0xe, 0x0, 0x29, 0x5d, 0x9, 0x3f, 0x9b,
-    0xfc, 0x0, 0x0, 0x0,
-
-    /* U+767D "白" */
-    0x0, 0x0, 0x0, 0xd, 0x0, 0x1, 0xd0, 0x7,
-    0xff, 0xfd, 0x70, 0x0, 0xd7, 0x0, 0xd, 0x7f,
-    0xff, 0xd7, 0x0, 0xd, 0x70, 0x0, 0xd7, 0x0,
-    0xd, 0x7f, 0xff, 0xd7, 0x0, 0xd, 0x0, 0x0,
-    0x0,
-
-    /* U+7736 "眶" */
-    0x3f, 0x7f, 0xfd, 0x32, 0x70, 0x0, 0x32, 0x71,
-    0x50, 0x3b, 0x76, 0xe8, 0x32, 0x70, 0xc0, 0x37,
-    0x77, 0xf8, 0x3b, 0x70, 0xc0, 0x32, 0x76, 0xe8,
-    0x3f, 0x75, 0x54, 0x30, 0x3f, 0xfd, 0x0, 0x0,
-    0x0,
-
-    /* U+773C "眼" */
-    0x3f, 0x6f, 0xf8, 0x32, 0x64, 0x28, 0x32, 0x6e,
-    0xb8, 0x3f, 0x6a, 0xb8, 0x32, 0x64, 0x28, 0x32,
-    0x6f, 0xf8, 0x3b, 0x65, 0x88, 0x32, 0x64, 0xf8,
-    0x3f, 0x64, 0xa0, 0x30, 0x3f, 0x78, 0x0, 0x39,
-    0x8,
-
-    /* U+7D2B "紫" */
-    0x3, 0xc, 0x10, 0x33, 0xee, 0xf4, 0x33, 0xd,
-    0x8, 0x7f, 0xeb, 0xfc, 0x55, 0xa2, 0x0, 0xb,
-    0xee, 0x0, 0x6, 0xf4, 0xc0, 0x1f, 0xeb, 0xf0,
-    0x1a, 0x75, 0x18, 0x1d, 0x34, 0xe0, 0x21, 0xf0,
-    0x14, 0x0, 0x0, 0x0,
-
-    /* U+7EA2 "红" */
-    0x0, 0x0, 0x0, 0x7, 0x0, 0x0, 0xd, 0x3f,
-    0xfd, 0x1c, 0x81, 0xc0, 0x3a, 0xc1, 0xc0, 0x7f,
-    0x1, 0xc0, 0xd, 0x1, 0xc0, 0x3e, 0xc1, 0xc0,
-    0x25, 0x1, 0xc0, 0x1, 0x41, 0xc0, 0x7f, 0xbf,
-    0xfe, 0x10, 0x5, 0x54,
-
-    /* U+7EDF "统" */
-    0x0, 0x0, 0x0, 0xd, 0x3, 0x0, 0xc, 0x17,
-    0x94, 0x29, 0x6f, 0xa8, 0x77, 0xd, 0x20, 0xbe,
-    0x39, 0x74, 0x1c, 0xbe, 0xac, 0x7b, 0x1c, 0xc0,
-    0xb9, 0x1c, 0xc0, 0x2, 0x28, 0xc4, 0x7e, 0x70,
-    0xc8, 0x50, 0xd0, 0xbc, 0x0, 0x0, 0x0,
-
-    /* U+7EE3 "绣" */
-    0x4, 0x0, 0x50, 0xc, 0x3f, 0xe4, 0x28, 0x2,
-    0x40, 0x31, 0x7f, 0xfe, 0xa7, 0x4b, 0xf0, 0x6e,
-    0x3a, 0x6c, 0x1c, 0x21, 0x44, 0x7f, 0x6e, 0xe0,
-    0x50, 0xc, 0xbc, 0x6, 0x4c, 0xc, 0xb9, 0x28,
-    0xc, 0x0, 0x60, 0xb8,
-
-    /* U+7EFF "绿" */
-    0x0, 0x0, 0x0, 0xd, 0x2f, 0xfc, 0x1c, 0x0,
-    0x18, 0x35, 0x1f, 0xf8, 0x77, 0x40, 0x18, 0x7e,
-    0x3f, 0xff, 0xc, 0x10, 0xc4, 0x3e, 0x5d, 0xdc,
-    0x64, 0x6, 0xf0, 0x6, 0x5e, 0xf8, 0x7d, 0x60,
-    0xca, 0x0, 0x7, 0x80,
-
-    /* U+7F1D "缝" */
-    0x8, 0x41, 0x40, 0xc, 0x93, 0xf8, 0x28, 0x6b,
-    0x70, 0x37, 0x2, 0xf4, 0xbe, 0xf9, 0x98, 0xc,
-    0x3a, 0xe8, 0x3f, 0x36, 0xf4, 0x64, 0x35, 0xd4,
-    0x6, 0x75, 0xd4, 0x7d, 0xe8, 0x40, 0x0, 0x87,
-    0xfc, 0x0, 0x0, 0x0,
-
-    /* U+7FC5 "翅" */
-    0x0, 0x0, 0x0, 0xc, 0x3f, 0xfc, 0x1d, 0x3,
-    0xc, 0xaf, 0x53, 0x4c, 0xc, 0x1b, 0x6c, 0xbf,
-    0x87, 0xc, 0x72, 0x8f, 0x7c, 0x33, 0x77, 0x8c,
-    0x2b, 0x3, 0xc, 0xd, 0x1e, 0x7c, 0x3f, 0x80,
-    0x0, 0xa0, 0xbf, 0xfd, 0x0, 0x0, 0x0,
-
-    /* U+7FE0 "翠" */
-    0x3f, 0xef, 0xf8, 0x1d, 0x63, 0x58, 0x7, 0xe1,
-    0xf8, 0x38, 0x6a, 0x58, 0x0, 0x28, 0x0, 0x3f,
-    0xff, 0xfc, 0x3, 0x82, 0xc0, 0x1d, 0x69, 0x70,
-    0x7f, 0xff, 0xfd, 0x0, 0x28, 0x0, 0x0, 0x28,
-    0x0,
-
-    /* U+7FE1 "翡" */
-    0x3f, 0xd7, 0xfc, 0x0, 0xd7, 0x0, 0x2f, 0xd7,
-    0xf4, 0x15, 0xd7, 0x54, 0x15, 0xd7, 0xa9, 0x2a,
-    0xd7, 0xa8, 0x14, 0xa6, 0xc, 0xc, 0xa3, 0x8c,
-    0x6, 0xa1, 0xac, 0x38, 0xaf, 0x4c, 0x3, 0xd0,
-    0x7c, 0x0, 0x0, 0x0,
-
-    /* U+8033 "耳" */
-    0x7f, 0xff, 0xfd, 0x2f, 0xaa, 0xf8, 0x7, 0x0,
-    0xd0, 0x7, 0xff, 0xd0, 0x7, 0x0, 0xd0, 0x7,
-    0x0, 0xd0, 0x7, 0xff, 0xd0, 0x7, 0x0, 0xd0,
-    0x1b, 0xab, 0xfd, 0x7a, 0x95, 0xe0, 0x0, 0x0,
-    0xd0,
-
-    /* U+80DC "胜" */
-    0x3f, 0x48, 0xc0, 0x32, 0x5c, 0xc0, 0x32, 0x6e,
-    0xe9, 0x3f, 0xba, 0xe8, 0x32, 0xf0, 0xc0, 0x32,
-    0x40, 0xc0, 0x3f, 0x5f, 0xfc, 0x32, 0x40, 0xc0,
-    0x32, 0x40, 0xc0, 0x62, 0x6a, 0xe9, 0x9b, 0x7f,
-    0xfe, 0x0, 0x0, 0x0,
-
-    /* U+80F8 "胸" */
-    0x0, 0x4, 0x0, 0x3f, 0x1c, 0x0, 0x33, 0x3f,
-    0xfd, 0x33, 0xb5, 0x5d, 0x3f, 0xe4, 0x99, 0x33,
-    0x3a, 0x39, 0x33, 0x33, 0x39, 0x3f, 0x3a, 0xb9,
-    0x33, 0x34, 0xb9, 0x33, 0x3f, 0xf9, 0x63, 0x0,
-    0xc, 0x5f, 0x0, 0xbc, 0x0, 0x0, 0x0,
-
-    /* U+811A "脚" */
-    0x3f, 0xc, 0xfd, 0x33, 0x1c, 0xc9, 0x33, 0x7f,
-    0xc9, 0x3f, 0xc, 0xc9, 0x33, 0x6e, 0xc9, 0x33,
-    0x29, 0xc9, 0x3f, 0x29, 0xc9, 0x23, 0x36, 0xc9,
-    0x23, 0x7b, 0xec, 0x63, 0x66, 0xc0, 0x9e, 0x0,
-    0xc0, 0x0, 0x0, 0x0,
-
-    /* U+8138 "脸" */
-    0x0, 0x1, 0x0, 0x3f, 0x43, 0x80, 0x32, 0x4a,
-    0xd0, 0x32, 0x5c, 0x34, 0x3b, 0xb4, 0x1d, 0x37,
-    0xdf, 0xe1, 0x32, 0x41, 0x4, 0x3f, 0x65, 0x8c,
-    0x33, 0x59, 0xa4, 0x32, 0x44, 0x30, 0x63, 0xbf,
-    0xfd, 0x5b, 0x15, 0x54, 0x0, 0x0, 0x0,
-
-    /* U+8170 "腰" */
-    0x3f, 0xbf, 0xfc, 0x33, 0x5a, 0xe4, 0x33, 0x2f,
-    0xe4, 0x3f, 0x36, 0xd8, 0x33, 0x3a, 0xe8, 0x33,
-    0x2a, 0xa4, 0x3f, 0x7f, 0xfc, 0x33, 0x1c, 0x30,
-    0x23, 0x2e, 0xa0, 0x63, 0x7, 0xe0, 0x9f, 0x3d,
-    0x2c, 0x0, 0x0, 0x0,
-
-    /* U+8179 "腹" */
-    0x0, 0x4, 0x0, 0x3f, 0x5c, 0x0, 0x32, 0x7f,
-    0xfd, 0x32, 0xf5, 0x54, 0x3f, 0xb9, 0x5c, 0x32,
-    0x7e, 0xac, 0x32, 0x7a, 0xac, 0x3f, 0x4a, 0x54,
-    0x32, 0x5f, 0xf8, 0x32, 0xfd, 0x70, 0x62, 0x47,
-    0xe0, 0x5b, 0xb8, 0x2d, 0x0, 0x0, 0x0,
-
-    /* U+82C7 "苇" */
-    0x3, 0x43, 0x40, 0x7f, 0xff, 0xfc, 0x3, 0x22,
-    0x0, 0x3f, 0xff, 0xf8, 0x0, 0x30, 0x0, 0x1f,
-    0xff, 0xf0, 0x0, 0x30, 0x0, 0x7f, 0xff, 0xfc,
-    0x0, 0x30, 0x1c, 0x0, 0x30, 0xf8, 0x0, 0x30,
-    0x0,
-
-    /* U+82CD "苍" */
-    0x3, 0x41, 0xc0, 0x7f, 0xff, 0xfd, 0x3, 0x59,
-    0xc0, 0x0, 0xbd, 0x0, 0x7, 0xc3, 0xd0, 0x7e,
-    0x55, 0xbd, 0x17, 0xff, 0xc0, 0x7, 0x0, 0xc0,
-    0x7, 0xf, 0x90, 0x7, 0x0, 0x34, 0x3, 0xff,
-    0xf0,
-
-    /* U+82E6 "苦" */
-    0x3, 0x3, 0x40, 0xff, 0xff, 0xf0, 0x30, 0x34,
-    0x0, 0xc, 0x0, 0x7f, 0xff, 0xfc, 0x0, 0xd0,
-    0x0, 0xab, 0xaa, 0x3, 0x55, 0x6c, 0xc, 0x0,
-    0x70, 0x3f, 0xff, 0xc0, 0xd5, 0x5b, 0x0, 0x0,
-    0x0,
-
-    /* U+83BA "莺" */
-    0x2, 0x81, 0xc0, 0x3f, 0xff, 0xfd, 0x16, 0x96,
-    0x94, 0x35, 0x79, 0x5c, 0x2b, 0xff, 0xe8, 0xa,
-    0x20, 0x60, 0xa, 0x9, 0x90, 0x7, 0xff, 0xfc,
-    0x0, 0x0, 0xc, 0x3f, 0xff, 0xcc, 0x0, 0x0,
-    0xf8,
-
-    /* U+84DD "蓝" */
-    0x7f, 0xff, 0xfe, 0x0, 0x80, 0x80, 0x0, 0xc3,
-    0x0, 0x1c, 0xd7, 0xfc, 0x1c, 0xd9, 0x90, 0x1c,
-    0xd8, 0x70, 0x0, 0x80, 0x20, 0xf, 0xff, 0xf4,
-    0xc, 0x23, 0x24, 0x1d, 0x77, 0x68, 0x7f, 0xff,
-    0xfe,
-
-    /* U+86C7 "蛇" */
-    0x0, 0x0, 0x0, 0x9, 0x0, 0xc0, 0x9, 0x5,
-    0xd4, 0x3f, 0xee, 0xac, 0x25, 0xe8, 0x8, 0x25,
-    0xc3, 0x0, 0x39, 0xc3, 0x28, 0x3f, 0x83, 0xe0,
-    0x9, 0x83, 0x0, 0x9, 0xc3, 0x4, 0x7f, 0xe3,
-    0x9, 0x10, 0x13, 0xfc,
-
-    /* U+86CB "蛋" */
-    0x0, 0x0, 0x0, 0x2f, 0xff, 0xfc, 0x2, 0x1c,
-    0x18, 0x7, 0x1f, 0xe0, 0xf, 0x9c, 0x0, 0x38,
-    0x7f, 0xfd, 0x20, 0x8, 0x0, 0xf, 0xff, 0xf0,
-    0xd, 0x5d, 0x70, 0x5, 0x6d, 0xe0, 0x16, 0xae,
-    0xf4, 0x2a, 0x55, 0x5c, 0x0, 0x0, 0x0,
-
-    /* U+8702 "蜂" */
-    0x0, 0x0, 0x0, 0x9, 0x3, 0x40, 0x9, 0xf,
-    0xf8, 0x3f, 0xff, 0x70, 0x28, 0xc3, 0xe0, 0x28,
-    0xdf, 0xbd, 0x29, 0xe9, 0xc9, 0x3f, 0x8a, 0xe8,
-    0x9, 0x4a, 0xe8, 0x9, 0xc5, 0xd4, 0x6f, 0xeb,
-    0xe9, 0x10, 0x40, 0xc0,
-
-    /* U+8910 "褐" */
-    0x4, 0x0, 0x0, 0xc, 0x3f, 0xfc, 0x9, 0x30,
-    0xc, 0x7f, 0x7f, 0xfc, 0x3, 0x39, 0x5c, 0xa,
-    0x5d, 0x54, 0x1f, 0x6f, 0xfd, 0x3f, 0xb1, 0x4d,
-    0x5d, 0x73, 0x8d, 0xc, 0x39, 0x5c, 0xc, 0x2f,
-    0xdc, 0xc, 0x0, 0x78, 0x0, 0x0, 0x0,
-
-    /* U+89C2 "观" */
-    0x0, 0xf, 0xfc, 0x7f, 0xdc, 0xc, 0x0, 0xcc,
-    0x4c, 0x31, 0xcd, 0x8c, 0x2e, 0x8d, 0x8c, 0xf,
-    0x4d, 0x8c, 0x7, 0x6, 0x44, 0xf, 0xc3, 0xc0,
-    0x1d, 0xc7, 0xc2, 0x34, 0x1c, 0xc2, 0x10, 0x74,
-    0xbd, 0x0, 0x0, 0x0,
-
-    /* U+89D2 "角" */
-    0x0, 0x80, 0x0, 0xb, 0xff, 0x0, 0x70, 0x28,
-    0x7, 0x95, 0xd5, 0x3f, 0xae, 0xb8, 0x28, 0x30,
-    0x60, 0xbf, 0xff, 0x82, 0x43, 0x6, 0xf, 0xff,
-    0xf8, 0x30, 0x30, 0xa1, 0xc0, 0xc2, 0x8d, 0x3,
-    0x3d, 0x0, 0x0, 0x0,
-
-    /* U+8BA1 "计" */
-    0x8, 0x3, 0x40, 0xa, 0x3, 0x40, 0x1, 0x3,
-    0x40, 0x14, 0x3, 0x40, 0x7d, 0xff, 0xfd, 0x9,
-    0x3, 0x40, 0x9, 0x3, 0x40, 0x9, 0x3, 0x40,
-    0xb, 0xc3, 0x40, 0xe, 0x3, 0x40, 0x8, 0x3,
-    0x40,
-
-    /* U+901A "通" */
-    0x0, 0x0, 0x0, 0x20, 0x7f, 0xfc, 0x2c, 0x19,
-    0xb0, 0x9, 0x7, 0xd0, 0x0, 0xbb, 0xec, 0x14,
-    0xa3, 0x4c, 0x6c, 0xbb, 0xac, 0xc, 0xbb, 0xac,
-    0xc, 0xa3, 0x4c, 0xd, 0x93, 0x3c, 0x3b, 0x40,
-    0x0, 0x60, 0xbf, 0xfd, 0x0, 0x0, 0x0,
-
-    /* U+91D1 "金" */
-    0x0, 0x0, 0x0, 0x0, 0x38, 0x0, 0x0, 0xbd,
-    0x0, 0x7, 0x83, 0x80, 0x7f, 0x56, 0xf8, 0x56,
-    0xba, 0x84, 0x0, 0x34, 0x0, 0x3f, 0xff, 0xf4,
-    0x9, 0x34, 0x80, 0x7, 0x35, 0xc0, 0x2b, 0xba,
-    0xa8, 0x7f, 0xff, 0xfc,
-
-    /* U+94F6 "银" */
-    0x4, 0x0, 0x0, 0x18, 0x2f, 0xf8, 0x3f, 0xa8,
-    0x18, 0xb0, 0x29, 0x68, 0x65, 0x2f, 0xf8, 0x1e,
-    0x68, 0x18, 0xd, 0x2f, 0xf8, 0x7f, 0xa9, 0x88,
-    0xc, 0x28, 0xf8, 0xc, 0x28, 0xa0, 0xf, 0xaa,
-    0x74, 0xc, 0x3d, 0xc, 0x0, 0x0, 0x0,
-
-    /* U+957F "长" */
-    0x3, 0x0, 0x20, 0x3, 0x1, 0xe0, 0x3, 0xb,
-    0x40, 0x3, 0x38, 0x0, 0x17, 0x55, 0x54, 0x7f,
-    0xff, 0xfd, 0x3, 0xd, 0x0, 0x3, 0x7, 0x0,
-    0x3, 0x2, 0xc0, 0x3, 0xbc, 0xb8, 0x7, 0x90,
-    0x18, 0x0, 0x0, 0x0,
-
-    /* U+9633 "阳" */
-    0x0, 0x0, 0x0, 0x3f, 0xef, 0xfc, 0x32, 0xa8,
-    0xc, 0x33, 0x28, 0xc, 0x36, 0x28, 0xc, 0x33,
-    0x28, 0xc, 0x31, 0xaf, 0xfc, 0x30, 0xe8, 0xc,
-    0x37, 0xa8, 0xc, 0x30, 0x28, 0xc, 0x30, 0x2f,
-    0xfc, 0x30, 0x28, 0xc, 0x0, 0x0, 0x0,
-
-    /* U+96BC "隼" */
-    0x0, 0x0, 0x0, 0x3, 0xd, 0x0, 0xb, 0xff,
-    0xf8, 0x2e, 0xe, 0x0, 0x2f, 0xff, 0xf0, 0xe,
-    0xae, 0xa0, 0xe, 0x5e, 0x50, 0xf, 0xff, 0xfc,
-    0x4, 0x1c, 0x0, 0x3f, 0xff, 0xff, 0x0, 0xc,
-    0x0, 0x0, 0xc, 0x0,
-
-    /* U+96C0 "雀" */
-    0x1, 0x34, 0x40, 0x7, 0x34, 0xb0, 0x1c, 0x3b,
-    0x9c, 0x4, 0x7d, 0x0, 0x1b, 0xda, 0x0, 0x2b,
-    0xaf, 0xa8, 0x7, 0xaf, 0xa4, 0x7, 0xb, 0x0,
-    0x7, 0xff, 0xf4, 0x7, 0x5b, 0x54, 0x7, 0xaa,
-    0xa8,
-
-    /* U+96D5 "雕" */
-    0x0, 0x0, 0x0, 0x3f, 0xf2, 0x70, 0x31, 0x33,
-    0x20, 0x37, 0x77, 0xfd, 0x33, 0x3f, 0x30, 0x3b,
-    0xbf, 0x74, 0x30, 0x37, 0xb9, 0x3a, 0xb3, 0x30,
-    0x38, 0xb3, 0xfd, 0x3b, 0xb3, 0x30, 0x64, 0x33,
-    0xb9, 0x50, 0xf3, 0x55,
-
-    /* U+96E8 "雨" */
-    0xbf, 0xff, 0xfc, 0xaa, 0xbe, 0xa8, 0x0, 0x30,
-    0x0, 0x3f, 0xff, 0xf8, 0x34, 0x34, 0x28, 0x37,
-    0x77, 0x98, 0x30, 0x70, 0xa8, 0x3a, 0x3a, 0x18,
-    0x32, 0xb1, 0xe8, 0x30, 0x30, 0x18, 0x30, 0x30,
-    0xf4, 0x0, 0x0, 0x0,
-
-    /* U+9875 "页" */
-    0x3f, 0xff, 0xfd, 0x0, 0x34, 0x0, 0x0, 0x30,
-    0x0, 0xf, 0xff, 0xf0, 0xc, 0x4, 0x30, 0xc,
-    0x28, 0x30, 0xc, 0x28, 0x30, 0xc, 0x28, 0x30,
-    0x8, 0x77, 0x50, 0x6, 0xd1, 0xf4, 0x3d, 0x0,
-    0x1c, 0x0, 0x0, 0x0,
-
-    /* U+9886 "领" */
-    0x2, 0x0, 0x0, 0x7, 0xf, 0xfd, 0xf, 0x80,
-    0xc0, 0x18, 0xd0, 0xc0, 0x35, 0x3b, 0xac, 0x2,
-    0x9, 0x8c, 0x2f, 0xd9, 0xcc, 0x0, 0xc9, 0xcc,
-    0x1, 0x89, 0xcc, 0x1f, 0x5, 0xc4, 0xb, 0x3,
-    0xb8, 0x2, 0x5e, 0x9, 0x0, 0x0, 0x0,
-
-    /* U+9888 "颈" */
-    0x3f, 0xdf, 0xff, 0x1, 0xc0, 0xd0, 0x3, 0x41,
-    0xd4, 0xf, 0x8b, 0xfd, 0x34, 0xa9, 0x59, 0x15,
-    0x49, 0x99, 0x2f, 0x99, 0x99, 0x3, 0x9, 0xd9,
-    0x3, 0x1, 0xd4, 0x2f, 0xe3, 0x5c, 0x14, 0xd,
-    0x6, 0x0, 0x0, 0x0,
-
-    /* U+9B3C "鬼" */
-    0x0, 0x0, 0x0, 0x0, 0x30, 0x0, 0xf, 0xff,
-    0xf0, 0xc, 0x34, 0x30, 0xf, 0xff, 0xf0, 0xc,
-    0x30, 0x30, 0xf, 0xff, 0xf0, 0x0, 0x74, 0x80,
-    0x0, 0xf9, 0xa0, 0x2, 0xdb, 0xf8, 0xf, 0x1c,
-    0x9, 0x38, 0xf, 0xfc, 0x0, 0x0, 0x0,
-
-    /* U+9C7C "鱼" */
-    0x0, 0x0, 0x0, 0x0, 0xc0, 0x0, 0x3, 0xff,
-    0x80, 0xe, 0x7, 0x0, 0x3f, 0xff, 0xf4, 0xd,
-    0x1c, 0x24, 0xf, 0xff, 0xf4, 0xd, 0x1c, 0x24,
-    0xe, 0xae, 0xb4, 0x5, 0x55, 0x50, 0x3f, 0xff,
-    0xfd, 0x15, 0x55, 0x54,
-
-    /* U+9CFD "鳽" */
-    0x0, 0x0, 0x80, 0x3f, 0xe6, 0xe4, 0x1d, 0xcb,
-    0x5c, 0xc, 0xcb, 0xac, 0xc, 0xca, 0xc, 0x1d,
-    0xcb, 0xf8, 0x7f, 0xeb, 0xaa, 0xc, 0xcb, 0xa9,
-    0x18, 0xc1, 0x69, 0x28, 0xcd, 0xad, 0x34, 0xdd,
-    0x58, 0x20, 0xd4, 0x2c, 0x0, 0x0, 0x0,
-
-    /* U+9D5F "鵟" */
-    0x5, 0x0, 0x0, 0x1f, 0x57, 0x94, 0x77, 0x3,
-    0x40, 0x1b, 0x2b, 0xa4, 0x27, 0x7b, 0xa8, 0xb,
-    0xba, 0xa0, 0x7, 0xaa, 0xb0, 0x7, 0xaa, 0xb0,
-    0x7, 0xaa, 0xa8, 0x7, 0xaa, 0xa4, 0x9, 0x62,
-    0x18, 0x30, 0x54, 0xb4, 0x0, 0x0, 0x0,
-
-    /* U+9E1F "鸟" */
-    0x0, 0x0, 0x0, 0x0, 0x38, 0x0, 0xb, 0xff,
-    0xf0, 0x9, 0x50, 0x20, 0x9, 0x2c, 0x60, 0x9,
-    0x1, 0x80, 0xb, 0xff, 0xfc, 0x0, 0x0, 0xd,
-    0x0, 0x0, 0xc, 0x3f, 0xff, 0xcc, 0x0, 0x0,
-    0x1c, 0x0, 0x0, 0xf4,
-
-    /* U+9E20 "鸠" */
-    0x0, 0x0, 0x0, 0xc, 0x3, 0x40, 0xc, 0x1e,
-    0xb8, 0x7f, 0x9a, 0x18, 0x1d, 0x98, 0xa8, 0x19,
-    0x98, 0xb4, 0x19, 0x98, 0x50, 0x19, 0x9f, 0xfc,
-    0x25, 0xc0, 0xc, 0x32, 0x7f, 0xdc, 0x70, 0x0,
-    0x1c, 0x10, 0x0, 0xf8, 0x0, 0x0, 0x0,
-
-    /* U+9E22 "鸢" */
-    0x0, 0x0, 0x0, 0x0, 0x28, 0xd0, 0x2b, 0xff,
-    0xa8, 0x0, 0x23, 0x96, 0x6, 0xfa, 0xfd, 0xa,
-    0x50, 0x60, 0x9, 0x75, 0xa0, 0x9, 0x5, 0x80,
-    0xb, 0xff, 0xfd, 0x0, 0x0, 0xc, 0x2a, 0xaa,
-    0x8c, 0x0, 0x0, 0xf8,
-
-    /* U+9E26 "鸦" */
-    0x0, 0x0, 0x40, 0x3f, 0xf2, 0x80, 0x2a, 0xdf,
-    0xfc, 0x24, 0xcd, 0x4c, 0x24, 0xcc, 0x9c, 0x3a,
-    0xec, 0x2c, 0x2b, 0xec, 0x10, 0x7, 0xcf, 0xfd,
-    0xd, 0xc0, 0x5, 0x28, 0xcf, 0xf9, 0x30, 0xc0,
-    0xc, 0xb, 0x80, 0x7c,
-
-    /* U+9E2B "鸫" */
-    0x0, 0x0, 0x40, 0x9, 0x1, 0xd0, 0x7f, 0xf7,
-    0xac, 0x1c, 0x6, 0x8c, 0x26, 0x6, 0x9c, 0x33,
-    0x6, 0x68, 0x3f, 0xe6, 0x10, 0x13, 0x47, 0xfd,
-    0x27, 0xa0, 0x9, 0x33, 0x3b, 0xe8, 0x23, 0x20,
-    0xc, 0xf, 0x0, 0xb8, 0x0, 0x0, 0x0,
-
-    /* U+9E2C "鸬" */
-    0x0, 0x0, 0x0, 0x6, 0x1, 0x80, 0x7, 0xff,
-    0xfc, 0x6, 0xd, 0x4c, 0x3f, 0xec, 0x8c, 0x30,
-    0xac, 0x68, 0x30, 0x6c, 0x50, 0x3f, 0xef, 0xfd,
-    0x30, 0x10, 0x9, 0x30, 0x1f, 0xdc, 0x60, 0x0,
-    0xc, 0x40, 0x0, 0xb8,
-
-    /* U+9E2E "鸮" */
-    0x0, 0x0, 0x40, 0x3f, 0xd2, 0x80, 0x30, 0x9b,
-    0xfc, 0x30, 0x99, 0x4c, 0x2f, 0xd9, 0x9c, 0x15,
-    0x59, 0x1c, 0x7e, 0xa9, 0x10, 0x29, 0x4b, 0xfd,
-    0x1a, 0xd0, 0x5, 0x0, 0xdf, 0xf9, 0x0, 0xc0,
-    0xc, 0xb, 0x80, 0x7c,
-
-    /* U+9E30 "鸰" */
-    0x0, 0x0, 0x0, 0x3, 0x2, 0x80, 0xb, 0x4f,
-    0xfc, 0x1c, 0xcd, 0x4c, 0x35, 0x7c, 0x9c, 0x13,
-    0xc, 0x2c, 0x15, 0x4c, 0x10, 0x2a, 0xdf, 0xfe,
-    0x1, 0xc0, 0x9, 0x1b, 0x5f, 0xf9, 0xb, 0x0,
-    0xd, 0x1, 0x40, 0x7c,
-
-    /* U+9E32 "鸲" */
-    0x0, 0x0, 0x0, 0x1c, 0x3, 0x50, 0x2e, 0xae,
-    0xb8, 0x35, 0x7e, 0x58, 0x60, 0x7c, 0xe8, 0x7f,
-    0x6c, 0x74, 0x33, 0x6c, 0x50, 0x33, 0x6f, 0xfc,
-    0x3b, 0x60, 0xc, 0x34, 0x7f, 0xdc, 0x0, 0x90,
-    0x1c, 0x7, 0xc0, 0xf4, 0x0, 0x0, 0x0,
-
-    /* U+9E3A "鸺" */
-    0x0, 0x0, 0x0, 0x8, 0xc0, 0x90, 0xc, 0xc3,
-    0xfc, 0x1c, 0xd3, 0x4c, 0x3f, 0xf7, 0x6c, 0x78,
-    0xd3, 0x1c, 0x19, 0xf3, 0x10, 0x1a, 0xeb, 0xfd,
-    0x1f, 0xc0, 0x5, 0x1d, 0xc7, 0xf9, 0x18, 0xc0,
-    0x8, 0x18, 0xc0, 0x3c,
-
-    /* U+9E3B "鸻" */
-    0x4, 0x0, 0x50, 0xd, 0xf8, 0x80, 0x34, 0x3,
-    0xfc, 0x20, 0x3, 0x8c, 0xe, 0xa7, 0x6c, 0x2c,
-    0x77, 0x6c, 0x7c, 0x33, 0x10, 0x1c, 0x32, 0xfd,
-    0xc, 0x30, 0x5, 0xc, 0x3b, 0xf9, 0xc, 0x30,
-    0x8, 0xc, 0xe0, 0x3c, 0x0, 0x0, 0x0,
-
-    /* U+9E43 "鹃" */
-    0x0, 0x1, 0x40, 0x3f, 0xc3, 0x40, 0x30, 0xcf,
-    0xf8, 0x3a, 0xcd, 0x18, 0x15, 0x4c, 0xd8, 0x3f,
-    0xdc, 0x74, 0x30, 0x9c, 0x50, 0x3f, 0xdf, 0xfc,
-    0x30, 0x90, 0xc, 0x3f, 0xef, 0xdc, 0x30, 0x90,
-    0x1c, 0x32, 0xc0, 0xf8, 0x0, 0x0, 0x0,
-
-    /* U+9E4A "鹊" */
-    0x0, 0x0, 0x0, 0xc, 0xc0, 0x90, 0x3f, 0xf7,
-    0xac, 0xc, 0xd3, 0x8c, 0xc, 0xc3, 0x6c, 0x7f,
-    0xf7, 0x28, 0x5, 0x43, 0x10, 0x2a, 0xa3, 0xfd,
-    0x29, 0x60, 0x9, 0x2e, 0xab, 0xf9, 0x28, 0x60,
-    0x8, 0x2e, 0xe0, 0x3c, 0x0, 0x0, 0x0,
-
-    /* U+9E4E "鹎" */
-    0x0, 0x0, 0x0, 0x7, 0x0, 0xd0, 0x3f, 0xf7,
-    0xfc, 0x33, 0x37, 0x8c, 0x3f, 0xf7, 0x5c, 0x33,
-    0x37, 0x28, 0x3f, 0xf7, 0x10, 0x1c, 0x87, 0xfd,
-    0x35, 0xc0, 0x9, 0x3f, 0xfb, 0xf8, 0x0, 0xc0,
-    0x8, 0x0, 0xc0, 0x7c, 0x0, 0x0, 0x0,
-
-    /* U+9E5A "鹚" */
-    0x0, 0x0, 0x0, 0x8, 0x30, 0x80, 0xc, 0x93,
-    0xfc, 0x3f, 0xff, 0x88, 0x8, 0x23, 0x1c, 0x15,
-    0x57, 0x6c, 0x33, 0xdb, 0x10, 0x3e, 0xf7, 0xfd,
-    0xc, 0x30, 0x5, 0x29, 0xaf, 0xf5, 0x3f, 0xe8,
-    0x8, 0x1, 0x4, 0x7c, 0x0, 0x0, 0x0,
-
-    /* U+9E5E "鹞" */
-    0x0, 0x0, 0x0, 0x6, 0xe0, 0xd0, 0x2a, 0x13,
-    0xfc, 0x33, 0x33, 0x4c, 0x25, 0x53, 0x2c, 0x2e,
-    0xa3, 0x2c, 0x33, 0x3, 0x54, 0x7f, 0xf2, 0xad,
-    0x23, 0x15, 0x59, 0x33, 0x36, 0xad, 0x3b, 0xb0,
-    0xc, 0x15, 0x70, 0x7c,
-
-    /* U+9E60 "鹠" */
-    0x0, 0x0, 0x0, 0x1d, 0x50, 0xc0, 0x31, 0xfb,
-    0xfd, 0x34, 0x97, 0x49, 0x39, 0xa7, 0x28, 0x3b,
-    0xb7, 0x1c, 0x15, 0x53, 0x14, 0x3b, 0xb3, 0xfd,
-    0x37, 0x71, 0x55, 0x37, 0x76, 0xa5, 0x3b, 0xb0,
-    0x8, 0x35, 0x70, 0x7c, 0x0, 0x0, 0x0,
-
-    /* U+9E61 "鹡" */
-    0x0, 0x0, 0x0, 0x23, 0x50, 0x90, 0x17, 0x63,
-    0xfc, 0x2b, 0x27, 0x4c, 0x1b, 0xd7, 0x2c, 0x2c,
-    0x77, 0x28, 0x3f, 0xf7, 0x10, 0x19, 0x73, 0xfd,
-    0x1d, 0x70, 0x9, 0x1f, 0xf6, 0xa8, 0x18, 0x30,
-    0xc, 0x19, 0xe0, 0x38,
-
-    /* U+9E6C "鹬" */
-    0x0, 0x0, 0x0, 0x2f, 0xf1, 0xd4, 0x9, 0xc3,
-    0xfc, 0x7f, 0xf7, 0x4c, 0x1f, 0x73, 0x2c, 0x67,
-    0x3, 0x1c, 0x2b, 0xa3, 0x10, 0x36, 0xa7, 0xfd,
-    0x3d, 0xf4, 0x9, 0x39, 0xea, 0xa9, 0x3a, 0xa4,
-    0xc, 0x30, 0x70, 0x7c,
-
-    /* U+9E6D "鹭" */
-    0x0, 0x0, 0x40, 0x3a, 0xe7, 0xb8, 0x3a, 0xea,
-    0xf0, 0x17, 0x5a, 0x6d, 0x27, 0x57, 0xa8, 0x3a,
-    0x66, 0xa4, 0xb, 0xff, 0xd0, 0x9, 0x60, 0x50,
-    0x9, 0x1a, 0xd0, 0x6, 0xaa, 0xac, 0x3f, 0xff,
-    0x8c, 0x0, 0x0, 0xb8, 0x0, 0x0, 0x0,
-
-    /* U+9E70 "鹰" */
-    0x0, 0x8, 0x0, 0x2f, 0xff, 0xfd, 0x28, 0xc8,
-    0xc0, 0x29, 0xde, 0xe8, 0x2f, 0xfe, 0xe4, 0x28,
-    0xce, 0xe4, 0x24, 0xde, 0xa8, 0x24, 0xba, 0xa4,
-    0x25, 0x99, 0xb0, 0x31, 0xea, 0xad, 0x36, 0xaa,
-    0x89, 0x60, 0x0, 0xac, 0x0, 0x0, 0x0,
-
-    /* U+9EC4 "黄" */
-    0x2, 0x83, 0x40, 0x1f, 0xff, 0xf8, 0x2, 0x83,
-    0x40, 0x7f, 0xff, 0xfd, 0x0, 0x38, 0x0, 0xe,
-    0xbe, 0xb0, 0xe, 0xba, 0xb0, 0xc, 0x34, 0x30,
-    0xf, 0xff, 0xf0, 0x7, 0x82, 0xd0, 0x39, 0x0,
-    0x2c, 0x0, 0x0, 0x0,
-
-    /* U+9ED1 "黑" */
-    0xf, 0xff, 0xf0, 0xd, 0x28, 0x70, 0xc, 0xaa,
-    0x70, 0xc, 0x6a, 0x30, 0xf, 0xff, 0xf0, 0x5,
-    0x7d, 0x50, 0x5, 0x7d, 0x50, 0x7f, 0xff, 0xfd,
-    0x18, 0x55, 0x24, 0x28, 0xc7, 0x28, 0x30, 0x93,
-    0xc, 0x0, 0x0, 0x0,
-
-    /* U+FF01 "！" */
-    0x38, 0xe3, 0x4d, 0x34, 0x90, 0x9, 0x38, 0x0,
-
-    /* U+FF08 "（" */
-    0x0, 0xc, 0x34, 0x70, 0xa0, 0xd0, 0xd0, 0xd0,
-    0xa0, 0x30, 0x24, 0xc, 0x0,
-
-    /* U+FF09 "）" */
-    0x0, 0x30, 0x1c, 0xd, 0xa, 0x7, 0x7, 0x7,
-    0xa, 0xc, 0x18, 0x30, 0x0,
-
-    /* U+FF0C "，" */
-    0x28, 0x3c, 0xc, 0x34, 0x0,
-
-    /* U+FF1A "：" */
-    0x28, 0x3c, 0x0, 0x0, 0x0, 0x0, 0x28, 0x3c,
-    0x0,
-
-    /* U+FF1F "？" */
-    0x0, 0x2, 0xfc, 0x60, 0xd0, 0xe, 0x2, 0xc0,
-    0x70, 0xd, 0x0, 0x0, 0x9, 0x0, 0xe0, 0x0,
-    0x0,
-
-    /* U+FFE5 "￥" */
-    0xa0, 0x9, 0x34, 0x1c, 0x1c, 0x34, 0xe, 0x70,
-    0x17, 0xd4, 0x17, 0xd4, 0x3f, 0xfc, 0x2, 0x80,
-    0x2, 0x80
-};
-
-
-/*---------------------
- *  GLYPH DESCRIPTION
- *--------------------*/
-
-static const lv_font_fmt_txt_glyph_dsc_t glyph_dsc[] = {
-    {.bitmap_index = 0, .adv_w = 0, .box_w = 0, .box_h = 0, .ofs_x = 0, .ofs_y = 0} /* id = 0 reserved */,
-    {.bitmap_index = 0, .adv_w = 43, .box_w = 0, .box_h = 0, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 0, .adv_w = 66, .box_w = 2, .box_h = 9, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 5, .adv_w = 109, .box_w = 7, .box_h = 9, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 21, .adv_w = 109, .box_w = 7, .box_h = 13, .ofs_x = 0, .ofs_y = -2},
-    {.bitmap_index = 44, .adv_w = 180, .box_w = 11, .box_h = 9, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 69, .adv_w = 136, .box_w = 9, .box_h = 9, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 90, .adv_w = 68, .box_w = 3, .box_h = 14, .ofs_x = 1, .ofs_y = -3},
-    {.bitmap_index = 101, .adv_w = 68, .box_w = 4, .box_h = 14, .ofs_x = 0, .ofs_y = -3},
-    {.bitmap_index = 115, .adv_w = 93, .box_w = 6, .box_h = 5, .ofs_x = 0, .ofs_y = 5},
-    {.bitmap_index = 123, .adv_w = 109, .box_w = 7, .box_h = 7, .ofs_x = 0, .ofs_y = 1},
-    {.bitmap_index = 136, .adv_w = 57, .box_w = 3, .box_h = 5, .ofs_x = 0, .ofs_y = -3},
-    {.bitmap_index = 140, .adv_w = 69, .box_w = 4, .box_h = 2, .ofs_x = 0, .ofs_y = 2},
-    {.bitmap_index = 142, .adv_w = 57, .box_w = 3, .box_h = 3, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 145, .adv_w = 75, .box_w = 5, .box_h = 12, .ofs_x = 0, .ofs_y = -2},
-    {.bitmap_index = 160, .adv_w = 109, .box_w = 7, .box_h = 9, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 176, .adv_w = 109, .box_w = 6, .box_h = 9, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 190, .adv_w = 109, .box_w = 7, .box_h = 9, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 206, .adv_w = 109, .box_w = 7, .box_h = 9, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 222, .adv_w = 109, .box_w = 7, .box_h = 9, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 238, .adv_w = 109, .box_w = 7, .box_h = 9, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 254, .adv_w = 109, .box_w = 7, .box_h = 9, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 270, .adv_w = 109, .box_w = 7, .box_h = 9, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 286, .adv_w = 109, .box_w = 7, .box_h = 9, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 302, .adv_w = 109, .box_w = 7, .box_h = 9, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 318, .adv_w = 57, .box_w = 3, .box_h = 7, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 324, .adv_w = 187, .box_w = 11, .box_h = 11, .ofs_x = 0, .ofs_y = -2},
-    {.bitmap_index = 355, .adv_w = 119, .box_w = 8, .box_h = 9, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 373, .adv_w = 128, .box_w = 7, .box_h = 9, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 389, .adv_w = 124, .box_w = 8, .box_h = 9, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 407, .adv_w = 134, .box_w = 7, .box_h = 9, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 423, .adv_w = 115, .box_w = 6, .box_h = 9, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 437, .adv_w = 109, .box_w = 6, .box_h = 9, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 451, .adv_w = 135, .box_w = 8, .box_h = 9, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 469, .adv_w = 142, .box_w = 7, .box_h = 9, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 485, .adv_w = 59, .box_w = 2, .box_h = 9, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 490, .adv_w = 105, .box_w = 6, .box_h = 9, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 504, .adv_w = 127, .box_w = 7, .box_h = 9, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 520, .adv_w = 107, .box_w = 6, .box_h = 9, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 534, .adv_w = 159, .box_w = 8, .box_h = 9, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 552, .adv_w = 141, .box_w = 7, .box_h = 9, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 568, .adv_w = 145, .box_w = 9, .box_h = 9, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 589, .adv_w = 124, .box_w = 7, .box_h = 9, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 605, .adv_w = 145, .box_w = 9, .box_h = 12, .ofs_x = 0, .ofs_y = -3},
-    {.bitmap_index = 632, .adv_w = 126, .box_w = 7, .box_h = 9, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 648, .adv_w = 117, .box_w = 7, .box_h = 9, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 664, .adv_w = 117, .box_w = 7, .box_h = 9, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 680, .adv_w = 141, .box_w = 7, .box_h = 9, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 696, .adv_w = 114, .box_w = 9, .box_h = 9, .ofs_x = -1, .ofs_y = 0},
-    {.bitmap_index = 717, .adv_w = 172, .box_w = 11, .box_h = 9, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 742, .adv_w = 114, .box_w = 7, .box_h = 9, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 758, .adv_w = 106, .box_w = 8, .box_h = 9, .ofs_x = -1, .ofs_y = 0},
-    {.bitmap_index = 776, .adv_w = 117, .box_w = 7, .box_h = 9, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 792, .adv_w = 109, .box_w = 7, .box_h = 6, .ofs_x = 0, .ofs_y = 4},
-    {.bitmap_index = 803, .adv_w = 108, .box_w = 7, .box_h = 1, .ofs_x = 0, .ofs_y = -2},
-    {.bitmap_index = 805, .adv_w = 110, .box_w = 6, .box_h = 7, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 816, .adv_w = 121, .box_w = 6, .box_h = 10, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 831, .adv_w = 99, .box_w = 6, .box_h = 7, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 842, .adv_w = 121, .box_w = 7, .box_h = 10, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 860, .adv_w = 109, .box_w = 7, .box_h = 7, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 873, .adv_w = 66, .box_w = 5, .box_h = 10, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 886, .adv_w = 111, .box_w = 7, .box_h = 10, .ofs_x = 0, .ofs_y = -3},
-    {.bitmap_index = 904, .adv_w = 119, .box_w = 6, .box_h = 10, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 919, .adv_w = 55, .box_w = 3, .box_h = 10, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 927, .adv_w = 55, .box_w = 4, .box_h = 13, .ofs_x = -1, .ofs_y = -3},
-    {.bitmap_index = 940, .adv_w = 110, .box_w = 6, .box_h = 10, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 955, .adv_w = 57, .box_w = 3, .box_h = 10, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 963, .adv_w = 181, .box_w = 10, .box_h = 7, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 981, .adv_w = 120, .box_w = 6, .box_h = 7, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 992, .adv_w = 118, .box_w = 7, .box_h = 7, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 1005, .adv_w = 121, .box_w = 6, .box_h = 10, .ofs_x = 1, .ofs_y = -3},
-    {.bitmap_index = 1020, .adv_w = 121, .box_w = 7, .box_h = 10, .ofs_x = 0, .ofs_y = -3},
-    {.bitmap_index = 1038, .adv_w = 79, .box_w = 4, .box_h = 8, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 1046, .adv_w = 92, .box_w = 6, .box_h = 7, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 1057, .adv_w = 76, .box_w = 5, .box_h = 9, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 1069, .adv_w = 119, .box_w = 7, .box_h = 7, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 1082, .adv_w = 105, .box_w = 7, .box_h = 7, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 1095, .adv_w = 159, .box_w = 10, .box_h = 7, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 1113, .adv_w = 101, .box_w = 7, .box_h = 7, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 1126, .adv_w = 104, .box_w = 7, .box_h = 10, .ofs_x = 0, .ofs_y = -3},
-    {.bitmap_index = 1144, .adv_w = 94, .box_w = 6, .box_h = 7, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 1155, .adv_w = 173, .box_w = 11, .box_h = 1, .ofs_x = 0, .ofs_y = 3},
-    {.bitmap_index = 1158, .adv_w = 192, .box_w = 10, .box_h = 2, .ofs_x = 1, .ofs_y = 4},
-    {.bitmap_index = 1163, .adv_w = 192, .box_w = 4, .box_h = 4, .ofs_x = 0, .ofs_y = -1},
-    {.bitmap_index = 1167, .adv_w = 192, .box_w = 12, .box_h = 12, .ofs_x = 0, .ofs_y = -1},
-    {.bitmap_index = 1203, .adv_w = 192, .box_w = 12, .box_h = 12, .ofs_x = 0, .ofs_y = -1},
-    {.bitmap_index = 1239, .adv_w = 192, .box_w = 12, .box_h = 2, .ofs_x = 0, .ofs_y = 4},
-    {.bitmap_index = 1245, .adv_w = 192, .box_w = 12, .box_h = 11, .ofs_x = 0, .ofs_y = -1},
-    {.bitmap_index = 1278, .adv_w = 192, .box_w = 12, .box_h = 11, .ofs_x = 0, .ofs_y = -1},
-    {.bitmap_index = 1311, .adv_w = 192, .box_w = 12, .box_h = 12, .ofs_x = 0, .ofs_y = -1},
-    {.bitmap_index = 1347, .adv_w = 192, .box_w = 11, .box_h = 12, .ofs_x = 1, .ofs_y = -2},
-    {.bitmap_index = 1380, .adv_w = 192, .box_w = 12, .box_h = 11, .ofs_x = 0, .ofs_y = -1},
-    {.bitmap_index = 1413, .adv_w = 192, .box_w = 12, .box_h = 12, .ofs_x = 0, .ofs_y = -2},
-    {.bitmap_index = 1449, .adv_w = 192, .box_w = 12, .box_h = 12, .ofs_x = 0, .ofs_y = -2},
-    {.bitmap_index = 1485, .adv_w = 192, .box_w = 12, .box_h = 12, .ofs_x = 0, .ofs_y = -2},
-    {.bitmap_index = 1521, .adv_w = 192, .box_w = 12, .box_h = 12, .ofs_x = 0, .ofs_y = -1},
-    {.bitmap_index = 1557, .adv_w = 192, .box_w = 12, .box_h = 12, .ofs_x = 0, .ofs_y = -2},
-    {.bitmap_index = 1593, .adv_w = 192, .box_w = 12, .box_h = 13, .ofs_x = 0, .ofs_y = -2},
-    {.bitmap_index = 1632, .adv_w = 192, .box_w = 12, .box_h = 12, .ofs_x = 0, .ofs_y = -2},
-    {.bitmap_index = 1668, .adv_w = 192, .box_w = 12, .box_h = 11, .ofs_x = 0, .ofs_y = -1},
-    {.bitmap_index = 1701, .adv_w = 192, .box_w = 12, .box_h = 12, .ofs_x = 0, .ofs_y = -2},
-    {.bitmap_index = 1737, .adv_w = 192, .box_w = 12, .box_h = 12, .ofs_x = 0, .ofs_y = -2},
-    {.bitmap_index = 1773, .adv_w = 192, .box_w = 12, .box_h = 11, .ofs_x = 0, .ofs_y = -1},
-    {.bitmap_index = 1806, .adv_w = 192, .box_w = 12, .box_h = 13, .ofs_x = 0, .ofs_y = -2},
-    {.bitmap_index = 1845, .adv_w = 192, .box_w = 12, .box_h = 11, .ofs_x = 0, .ofs_y = -1},
-    {.bitmap_index = 1878, .adv_w = 192, .box_w = 12, .box_h = 13, .ofs_x = 0, .ofs_y = -2},
-    {.bitmap_index = 1917, .adv_w = 192, .box_w = 12, .box_h = 11, .ofs_x = 0, .ofs_y = -1},
-    {.bitmap_index = 1950, .adv_w = 192, .box_w = 12, .box_h = 12, .ofs_x = 0, .ofs_y = -2},
-    {.bitmap_index = 1986, .adv_w = 192, .box_w = 12, .box_h = 11, .ofs_x = 0, .ofs_y = -1},
-    {.bitmap_index = 2019, .adv_w = 192, .box_w = 12, .box_h = 13, .ofs_x = 0, .ofs_y = -2},
-    {.bitmap_index = 2058, .adv_w = 192, .box_w = 12, .box_h = 12, .ofs_x = 0, .ofs_y = -2},
-    {.bitmap_index = 2094, .adv_w = 192, .box_w = 12, .box_h = 12, .ofs_x = 0, .ofs_y = -2},
-    {.bitmap_index = 2130, .adv_w = 192, .box_w = 10, .box_h = 11, .ofs_x = 1, .ofs_y = -1},
-    {.bitmap_index = 2158, .adv_w = 192, .box_w = 12, .box_h = 11, .ofs_x = 0, .ofs_y = -1},
-    {.bitmap_index = 2191, .adv_w = 192, .box_w = 12, .box_h = 11, .ofs_x = 0, .ofs_y = -1},
-    {.bitmap_index = 2224, .adv_w = 192, .box_w = 12, .box_h = 12, .ofs_x = 0, .ofs_y = -2},
-    {.bitmap_index = 2260, .adv_w = 192, .box_w = 12, .box_h = 12, .ofs_x = 0, .ofs_y = -1},
-    {.bitmap_index = 2296, .adv_w = 192, .box_w = 12, .box_h = 12, .ofs_x = 0, .ofs_y = -1},
-    {.bitmap_index = 2332, .adv_w = 192, .box_w = 12, .box_h = 12, .ofs_x = 0, .ofs_y = -1},
-    {.bitmap_index = 2368, .adv_w = 192, .box_w = 12, .box_h = 12, .ofs_x = 0, .ofs_y = -1},
-    {.bitmap_index = 2404, .adv_w = 192, .box_w = 12, .box_h = 12, .ofs_x = 0, .ofs_y = -1},
-    {.bitmap_index = 2440, .adv_w = 192, .box_w = 9, .box_h = 12, .ofs_x = 1, .ofs_y = -2},
-    {.bitmap_index = 2467, .adv_w = 192, .box_w = 12, .box_h = 13, .ofs_x = 0, .ofs_y = -2},
-    {.bitmap_index = 2506, .adv_w = 192, .box_w = 12, .box_h = 13, .ofs_x = 0, .ofs_y = -2},
-    {.bitmap_index = 2545, .adv_w = 192, .box_w = 12, .box_h = 11, .ofs_x = 0, .ofs_y = -1},
-    {.bitmap_index = 2578, .adv_w = 192, .box_w = 12, .box_h = 11, .ofs_x = 0, .ofs_y = -1},
-    {.bitmap_index = 2611, .adv_w = 192, .box_w = 12, .box_h = 11, .ofs_x = 0, .ofs_y = -1},
-    {.bitmap_index = 2644, .adv_w = 192, .box_w = 12, .box_h = 11, .ofs_x = 0, .ofs_y = -1},
-    {.bitmap_index = 2677, .adv_w = 192, .box_w = 12, .box_h = 11, .ofs_x = 0, .ofs_y = -1},
-    {.bitmap_index = 2710, .adv_w = 192, .box_w = 12, .box_h = 13, .ofs_x = 0, .ofs_y = -2},
-    {.bitmap_index = 2749, .adv_w = 192, .box_w = 12, .box_h = 11, .ofs_x = 0, .ofs_y = -1},
-    {.bitmap_index = 2782, .adv_w = 192, .box_w = 12, .box_h = 11, .ofs_x = 0, .ofs_y = -1},
-    {.bitmap_index = 2815, .adv_w = 192, .box_w = 12, .box_h = 12, .ofs_x = 0, .ofs_y = -1},
-    {.bitmap_index = 2851, .adv_w = 192, .box_w = 12, .box_h = 12, .ofs_x = 0, .ofs_y = -2},
-    {.bitmap_index = 2887, .adv_w = 192, .box_w = 12, .box_h = 12, .ofs_x = 0, .ofs_y = -2},
-    {.bitmap_index = 2923, .adv_w = 192, .box_w = 13, .box_h = 12, .ofs_x = 0, .ofs_y = -1},
-    {.bitmap_index = 2962, .adv_w = 192, .box_w = 12, .box_h = 12, .ofs_x = 0, .ofs_y = -2},
-    {.bitmap_index = 2998, .adv_w = 192, .box_w = 10, .box_h = 13, .ofs_x = 1, .ofs_y = -2},
-    {.bitmap_index = 3031, .adv_w = 192, .box_w = 12, .box_h = 11, .ofs_x = 0, .ofs_y = -1},
-    {.bitmap_index = 3064, .adv_w = 192, .box_w = 12, .box_h = 11, .ofs_x = 0, .ofs_y = -1},
-    {.bitmap_index = 3097, .adv_w = 192, .box_w = 12, .box_h = 12, .ofs_x = 0, .ofs_y = -2},
-    {.bitmap_index = 3133, .adv_w = 192, .box_w = 12, .box_h = 12, .ofs_x = 0, .ofs_y = -1},
-    {.bitmap_index = 3169, .adv_w = 192, .box_w = 12, .box_h = 13, .ofs_x = 0, .ofs_y = -2},
-    {.bitmap_index = 3208, .adv_w = 192, .box_w = 12, .box_h = 12, .ofs_x = 0, .ofs_y = -1},
-    {.bitmap_index = 3244, .adv_w = 192, .box_w = 12, .box_h = 12, .ofs_x = 0, .ofs_y = -1},
-    {.bitmap_index = 3280, .adv_w = 192, .box_w = 12, .box_h = 12, .ofs_x = 0, .ofs_y = -2},
-    {.bitmap_index = 3316, .adv_w = 192, .box_w = 12, .box_h = 13, .ofs_x = 0, .ofs_y = -2},
-    {.bitmap_index = 3355, .adv_w = 192, .box_w = 12, .box_h = 11, .ofs_x = 0, .ofs_y = -1},
-    {.bitmap_index = 3388, .adv_w = 192, .box_w = 12, .box_h = 12, .ofs_x = 0, .ofs_y = -2},
-    {.bitmap_index = 3424, .adv_w = 192, .box_w = 12, .box_h = 11, .ofs_x = 0, .ofs_y = -1},
-    {.bitmap_index = 3457, .adv_w = 192, .box_w = 12, .box_h = 12, .ofs_x = 0, .ofs_y = -2},
-    {.bitmap_index = 3493, .adv_w = 192, .box_w = 12, .box_h = 13, .ofs_x = 0, .ofs_y = -2},
-    {.bitmap_index = 3532, .adv_w = 192, .box_w = 12, .box_h = 12, .ofs_x = 0, .ofs_y = -2},
-    {.bitmap_index = 3568, .adv_w = 192, .box_w = 12, .box_h = 13, .ofs_x = 0, .ofs_y = -2},
-    {.bitmap_index = 3607, .adv_w = 192, .box_w = 12, .box_h = 12, .ofs_x = 0, .ofs_y = -2},
-    {.bitmap_index = 3643, .adv_w = 192, .box_w = 12, .box_h = 13, .ofs_x = 0, .ofs_y = -2},
-    {.bitmap_index = 3682, .adv_w = 192, .box_w = 12, .box_h = 11, .ofs_x = 0, .ofs_y = -1},
-    {.bitmap_index = 3715, .adv_w = 192, .box_w = 12, .box_h = 11, .ofs_x = 0, .ofs_y = -1},
-    {.bitmap_index = 3748, .adv_w = 192, .box_w = 11, .box_h = 12, .ofs_x = 0, .ofs_y = -2},
-    {.bitmap_index = 3781, .adv_w = 192, .box_w = 12, .box_h = 11, .ofs_x = 0, .ofs_y = -1},
-    {.bitmap_index = 3814, .adv_w = 192, .box_w = 12, .box_h = 11, .ofs_x = 0, .ofs_y = -1},
-    {.bitmap_index = 3847, .adv_w = 192, .box_w = 12, .box_h = 12, .ofs_x = 0, .ofs_y = -1},
-    {.bitmap_index = 3883, .adv_w = 192, .box_w = 12, .box_h = 13, .ofs_x = 0, .ofs_y = -2},
-    {.bitmap_index = 3922, .adv_w = 192, .box_w = 12, .box_h = 12, .ofs_x = 0, .ofs_y = -1},
-    {.bitmap_index = 3958, .adv_w = 192, .box_w = 12, .box_h = 13, .ofs_x = 0, .ofs_y = -2},
-    {.bitmap_index = 3997, .adv_w = 192, .box_w = 12, .box_h = 12, .ofs_x = 0, .ofs_y = -2},
-    {.bitmap_index = 4033, .adv_w = 192, .box_w = 11, .box_h = 13, .ofs_x = 0, .ofs_y = -2},
-    {.bitmap_index = 4069, .adv_w = 192, .box_w = 12, .box_h = 11, .ofs_x = 0, .ofs_y = -1},
-    {.bitmap_index = 4102, .adv_w = 192, .box_w = 12, .box_h = 13, .ofs_x = 0, .ofs_y = -2},
-    {.bitmap_index = 4141, .adv_w = 192, .box_w = 12, .box_h = 12, .ofs_x = 0, .ofs_y = -1},
-    {.bitmap_index = 4177, .adv_w = 192, .box_w = 12, .box_h = 13, .ofs_x = 0, .ofs_y = -2},
-    {.bitmap_index = 4216, .adv_w = 192, .box_w = 12, .box_h = 12, .ofs_x = 0, .ofs_y = -2},
-    {.bitmap_index = 4252, .adv_w = 192, .box_w = 12, .box_h = 13, .ofs_x = 0, .ofs_y = -2},
-    {.bitmap_index = 4291, .adv_w = 192, .box_w = 12, .box_h = 12, .ofs_x = 0, .ofs_y = -1},
-    {.bitmap_index = 4327, .adv_w = 192, .box_w = 12, .box_h = 11, .ofs_x = 0, .ofs_y = -1},
-    {.bitmap_index = 4360, .adv_w = 192, .box_w = 12, .box_h = 12, .ofs_x = 0, .ofs_y = -1},
-    {.bitmap_index = 4396, .adv_w = 192, .box_w = 12, .box_h = 12, .ofs_x = 0, .ofs_y = -2},
-    {.bitmap_index = 4432, .adv_w = 192, .box_w = 12, .box_h = 12, .ofs_x = 0, .ofs_y = -2},
-    {.bitmap_index = 4468, .adv_w = 192, .box_w = 12, .box_h = 13, .ofs_x = 0, .ofs_y = -2},
-    {.bitmap_index = 4507, .adv_w = 192, .box_w = 12, .box_h = 12, .ofs_x = 0, .ofs_y = -2},
-    {.bitmap_index = 4543, .adv_w = 192, .box_w = 12, .box_h = 13, .ofs_x = 0, .ofs_y = -2},
-    {.bitmap_index = 4582, .adv_w = 192, .box_w = 12, .box_h = 12, .ofs_x = 0, .ofs_y = -1},
-    {.bitmap_index = 4618, .adv_w = 192, .box_w = 12, .box_h = 13, .ofs_x = 0, .ofs_y = -2},
-    {.bitmap_index = 4657, .adv_w = 192, .box_w = 12, .box_h = 13, .ofs_x = 0, .ofs_y = -2},
-    {.bitmap_index = 4696, .adv_w = 192, .box_w = 12, .box_h = 12, .ofs_x = 0, .ofs_y = -1},
-    {.bitmap_index = 4732, .adv_w = 192, .box_w = 12, .box_h = 13, .ofs_x = 0, .ofs_y = -2},
-    {.bitmap_index = 4771, .adv_w = 192, .box_w = 12, .box_h = 12, .ofs_x = 0, .ofs_y = -1},
-    {.bitmap_index = 4807, .adv_w = 192, .box_w = 12, .box_h = 12, .ofs_x = 0, .ofs_y = -1},
-    {.bitmap_index = 4843, .adv_w = 192, .box_w = 12, .box_h = 13, .ofs_x = 0, .ofs_y = -2},
-    {.bitmap_index = 4882, .adv_w = 192, .box_w = 12, .box_h = 12, .ofs_x = 0, .ofs_y = -1},
-    {.bitmap_index = 4918, .adv_w = 192, .box_w = 12, .box_h = 12, .ofs_x = 0, .ofs_y = -1},
-    {.bitmap_index = 4954, .adv_w = 192, .box_w = 12, .box_h = 12, .ofs_x = 0, .ofs_y = -1},
-    {.bitmap_index = 4990, .adv_w = 192, .box_w = 12, .box_h = 13, .ofs_x = 0, .ofs_y = -2},
-    {.bitmap_index = 5029, .adv_w = 192, .box_w = 12, .box_h = 12, .ofs_x = 0, .ofs_y = -1},
-    {.bitmap_index = 5065, .adv_w = 192, .box_w = 12, .box_h = 13, .ofs_x = 0, .ofs_y = -2},
-    {.bitmap_index = 5104, .adv_w = 192, .box_w = 12, .box_h = 13, .ofs_x = 0, .ofs_y = -2},
-    {.bitmap_index = 5143, .adv_w = 192, .box_w = 12, .box_h = 13, .ofs_x = 0, .ofs_y = -2},
-    {.bitmap_index = 5182, .adv_w = 192, .box_w = 12, .box_h = 13, .ofs_x = 0, .ofs_y = -2},
-    {.bitmap_index = 5221, .adv_w = 192, .box_w = 12, .box_h = 13, .ofs_x = 0, .ofs_y = -2},
-    {.bitmap_index = 5260, .adv_w = 192, .box_w = 12, .box_h = 12, .ofs_x = 0, .ofs_y = -1},
-    {.bitmap_index = 5296, .adv_w = 192, .box_w = 12, .box_h = 13, .ofs_x = 0, .ofs_y = -2},
-    {.bitmap_index = 5335, .adv_w = 192, .box_w = 12, .box_h = 12, .ofs_x = 0, .ofs_y = -1},
-    {.bitmap_index = 5371, .adv_w = 192, .box_w = 12, .box_h = 12, .ofs_x = 0, .ofs_y = -1},
-    {.bitmap_index = 5407, .adv_w = 192, .box_w = 12, .box_h = 13, .ofs_x = 0, .ofs_y = -2},
-    {.bitmap_index = 5446, .adv_w = 192, .box_w = 12, .box_h = 13, .ofs_x = 0, .ofs_y = -2},
-    {.bitmap_index = 5485, .adv_w = 192, .box_w = 12, .box_h = 12, .ofs_x = 0, .ofs_y = -2},
-    {.bitmap_index = 5521, .adv_w = 192, .box_w = 12, .box_h = 12, .ofs_x = 0, .ofs_y = -2},
-    {.bitmap_index = 5557, .adv_w = 192, .box_w = 3, .box_h = 10, .ofs_x = 1, .ofs_y = -1},
-    {.bitmap_index = 5565, .adv_w = 192, .box_w = 4, .box_h = 13, .ofs_x = 8, .ofs_y = -2},
-    {.bitmap_index = 5578, .adv_w = 192, .box_w = 4, .box_h = 13, .ofs_x = 0, .ofs_y = -2},
-    {.bitmap_index = 5591, .adv_w = 192, .box_w = 4, .box_h = 5, .ofs_x = 1, .ofs_y = -2},
-    {.bitmap_index = 5596, .adv_w = 192, .box_w = 4, .box_h = 9, .ofs_x = 1, .ofs_y = -1},
-    {.bitmap_index = 5605, .adv_w = 192, .box_w = 6, .box_h = 11, .ofs_x = 0, .ofs_y = -1},
-    {.bitmap_index = 5622, .adv_w = 192, .box_w = 8, .box_h = 9, .ofs_x = 2, .ofs_y = 0}
-};
-
-/*---------------------
- *  CHARACTER MAPPING
- *--------------------*/
-
-static const uint8_t glyph_id_ofs_list_0[] = {
-    0, 1, 0, 2, 3, 4, 5
-};
-
-static const uint16_t unicode_list_5[] = {
-    0x0, 0x12, 0xfee, 0x2d04, 0x2d05, 0x2dec, 0x2df6, 0x2df7,
-    0x2e38, 0x2e72, 0x3157, 0x318c, 0x31d0, 0x328c, 0x3363, 0x33b5,
-    0x33b9, 0x33bd, 0x33e2, 0x34d1, 0x3530, 0x3588, 0x3620, 0x3656,
-    0x3908, 0x3913, 0x3916, 0x3920, 0x3beb, 0x3bfb, 0x3c2a, 0x3c5d,
-    0x3e12, 0x4062, 0x4220, 0x42cb, 0x434f, 0x4573, 0x457d, 0x459c,
-    0x45d1, 0x465a, 0x4683, 0x4714, 0x4718, 0x4751, 0x476a, 0x4783,
-    0x4b0d, 0x4c20, 0x4c4c, 0x505c, 0x51c1, 0x52c3, 0x53cc, 0x5421,
-    0x5669, 0x5722, 0x5728, 0x5d17, 0x5e8e, 0x5ecb, 0x5ecf, 0x5eeb,
-    0x5f09, 0x5fb1, 0x5fcc, 0x5fcd, 0x601f, 0x60c8, 0x60e4, 0x6106,
-    0x6124, 0x615c, 0x6165, 0x62b3, 0x62b9, 0x62d2, 0x63a6, 0x64c9,
-    0x66b3, 0x66b7, 0x66ee, 0x68fc, 0x69ae, 0x69be, 0x6b8d, 0x7006,
-    0x71bd, 0x74e2, 0x756b, 0x761f, 0x76a8, 0x76ac, 0x76c1, 0x76d4,
-    0x7861, 0x7872, 0x7874, 0x7b28, 0x7c68, 0x7ce9, 0x7d4b, 0x7e0b,
-    0x7e0c, 0x7e0e, 0x7e12, 0x7e17, 0x7e18, 0x7e1a, 0x7e1c, 0x7e1e,
-    0x7e26, 0x7e27, 0x7e2f, 0x7e36, 0x7e3a, 0x7e46, 0x7e4a, 0x7e4c,
-    0x7e4d, 0x7e58, 0x7e59, 0x7e5c, 0x7eb0, 0x7ebd, 0xdeed, 0xdef4,
-    0xdef5, 0xdef8, 0xdf06, 0xdf0b, 0xdfd1
-};
-
-/*Collect the unicode lists and glyph_id offsets*/
-static const lv_font_fmt_txt_cmap_t cmaps[] =
-{
-    {
-        .range_start = 32, .range_length = 7, .glyph_id_start = 1,
-        .unicode_list = NULL, .glyph_id_ofs_list = glyph_id_ofs_list_0, .list_length = 7, .type = LV_FONT_FMT_TXT_CMAP_FORMAT0_FULL
-    },
-    {
-        .range_start = 40, .range_length = 19, .glyph_id_start = 7,
-        .unicode_list = NULL, .glyph_id_ofs_list = NULL, .list_length = 0, .type = LV_FONT_FMT_TXT_CMAP_FORMAT0_TINY
-    },
-    {
-        .range_start = 64, .range_length = 27, .glyph_id_start = 26,
-        .unicode_list = NULL, .glyph_id_ofs_list = NULL, .list_length = 0, .type = LV_FONT_FMT_TXT_CMAP_FORMAT0_TINY
-    },
-    {
-        .range_start = 94, .range_length = 2, .glyph_id_start = 53,
-        .unicode_list = NULL, .glyph_id_ofs_list = NULL, .list_length = 0, .type = LV_FONT_FMT_TXT_CMAP_FORMAT0_TINY
-    },
-    {
-        .range_start = 97, .range_length = 26, .glyph_id_start = 55,
-        .unicode_list = NULL, .glyph_id_ofs_list = NULL, .list_length = 0, .type = LV_FONT_FMT_TXT_CMAP_FORMAT0_TINY
-    },
-    {
-        .range_start = 8212, .range_length = 57298, .glyph_id_start = 81,
-        .unicode_list = unicode_list_5, .glyph_id_ofs_list = NULL, .list_length = 133, .type = LV_FONT_FMT_TXT_CMAP_SPARSE_TINY
-    }
-};
-
-/*-----------------
- *    KERNING
- *----------------*/
-
-
-/*Map glyph_ids to kern left classes*/
-static const uint8_t kern_left_class_mapping[] =
-{
-    0, 0, 0, 0, 0, 0, 0, 1,
-    0, 0, 0, 2, 3, 2, 4, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 5, 0, 6, 7, 8, 9, 10,
-    11, 12, 0, 0, 13, 14, 15, 0,
-    0, 9, 16, 9, 17, 18, 19, 20,
-    21, 22, 23, 24, 25, 0, 0, 26,
-    27, 28, 0, 29, 30, 31, 32, 0,
-    0, 33, 34, 32, 32, 27, 27, 35,
-    36, 37, 38, 35, 39, 40, 41, 42,
-    43, 3, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0
-};
-
-/*Map glyph_ids to kern right classes*/
-static const uint8_t kern_right_class_mapping[] =
-{
-    0, 0, 1, 0, 0, 0, 0, 0,
-    2, 3, 0, 4, 5, 6, 7, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 8, 0, 9, 0, 10, 0, 0,
-    0, 10, 0, 0, 11, 0, 0, 0,
-    0, 10, 0, 10, 0, 12, 13, 14,
-    15, 16, 17, 18, 19, 0, 0, 20,
-    0, 21, 21, 21, 22, 23, 0, 24,
-    25, 0, 0, 26, 26, 21, 26, 21,
-    26, 27, 28, 29, 30, 31, 32, 33,
-    34, 5, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0
-};
-
-/*Kern values between classes*/
-static const int8_t kern_class_values[] =
-{
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, -5, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    17, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, -32, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, -22, -6,
-    -15, -8, 0, -22, 0, 0, -3, 0,
-    0, 0, 6, 0, 0, -12, 0, -10,
-    -6, 0, -5, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, -5, -5,
-    -12, 0, -5, -3, -7, -16, -5, 0,
-    0, 0, 0, 0, 0, 0, 0, -6,
-    0, -3, 0, -4, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, -9, -3,
-    -18, 0, 0, 0, 0, 0, 0, 0,
-    0, -6, -7, 0, -3, 3, 3, 0,
-    0, 0, -5, 0, 0, 0, 0, 0,
-    0, 0, -10, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, -7, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, -20, 0, 0, 0,
-    0, 0, -2, -3, 0, 0, -14, -4,
-    -4, 0, -1, -4, -2, 4, 0, -3,
-    0, 0, 0, 0, 4, -4, -2, -3,
-    -2, -2, -3, 0, 0, 0, -7, 0,
-    0, 0, 0, 0, 0, 0, -4, -4,
-    -6, 0, -2, -2, -2, -4, -2, 0,
-    0, 0, 0, 0, 0, 0, 0, -3,
-    0, -4, -3, -3, -4, 0, 0, 0,
-    0, 0, -7, 0, 0, 0, 0, -7,
-    -3, -6, -4, -4, -2, -2, -2, -3,
-    -3, 0, 0, 0, -5, 0, 0, 0,
-    0, -7, -3, -4, -3, 0, -4, 0,
-    0, 0, -7, 0, 0, 0, -4, 0,
-    -3, 0, -10, 0, -6, 0, -3, -2,
-    -5, -5, -5, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, -4,
-    0, -3, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, -3, 0,
-    0, 0, 0, 0, 0, -6, 0, -3,
-    0, -8, -3, 0, 0, 0, 0, -18,
-    0, -18, -15, 0, -9, -3, -30, -6,
-    0, 0, -1, -1, -6, -2, -7, -8,
-    -4, 0, -6, 0, 0, -5, -6, -3,
-    -4, -6, -5, -7, -5, -8, 0, 0,
-    -6, 0, 0, 0, 0, 0, -2, 0,
-    0, 0, -5, 0, -4, -2, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, -6, 0, -6, 0, 0,
-    0, 0, -9, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, -9, 0, -8, 0,
-    0, 0, -3, -6, 0, -3, -5, -4,
-    -4, -3, 0, -5, 0, 0, -3, 0,
-    0, 0, -3, 0, 0, -9, -4, -6,
-    -5, -5, -6, -4, 0, 0, -35, 0,
-    -12, 0, 0, 0, -1, -7, 0, -6,
-    -27, -7, -17, -13, 0, -18, 0, 0,
-    -3, -4, -2, 0, 0, 0, 0, -6,
-    -3, -10, -8, 0, -10, 0, 0, 0,
-    0, -26, -7, -26, -16, 0, -12, 0,
-    -32, -3, -5, 0, 0, 0, -6, -3,
-    -17, -9, -6, 0, -7, 0, 0, 0,
-    -3, 0, 0, 0, 0, -4, 0, -5,
-    0, 0, -3, 0, -7, 0, 0, 0,
-    -2, 0, -4, -4, -4, 0, -1, 0,
-    -2, -2, -3, -2, -3, 0, -2, 0,
-    0, 0, 0, 0, 0, 0, 0, -3,
-    0, -3, 0, 0, -4, 0, 2, 0,
-    0, 0, 0, 0, -4, -4, -5, 0,
-    0, 0, 0, -4, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, -6, 0, 0,
-    0, 0, 0, -2, 0, 0, 0, -24,
-    -16, -24, -19, -5, -9, -6, -28, -8,
-    0, 0, 0, 0, -5, -4, -12, -16,
-    -16, -4, -16, 0, 0, -10, -13, -4,
-    -10, -7, -7, -8, -7, -16, 0, 0,
-    0, -5, 0, -5, -7, 0, -4, 0,
-    -12, -3, 0, 0, -2, 0, -3, -4,
-    0, -2, 0, 0, -3, 0, 0, 0,
-    -2, 0, 0, 0, 0, -3, 0, 0,
-    0, 0, 0, -15, -5, -15, -10, 0,
-    -4, -3, -16, -3, 0, -3, 1, 0,
-    0, 0, -5, -6, -4, 0, -5, 0,
-    0, -5, -4, 0, -7, -3, -3, -4,
-    -3, -6, 0, 0, 0, -8, -3, -8,
-    -6, 0, 0, -2, -14, -2, 0, 0,
-    0, 0, 0, 0, -2, -4, 0, 0,
-    -3, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, -3, 0, 0, -3, 0,
-    -7, 0, 0, 0, -1, -5, -2, -4,
-    -5, -3, 0, 0, 0, 0, 0, -3,
-    -3, -5, 0, 0, 0, 0, 0, -5,
-    -3, -5, -4, -3, -5, -4, 0, 0,
-    0, -22, -16, -22, -14, -7, -4, -4,
-    -22, -4, -4, -3, 0, 0, 0, 0,
-    -6, -16, -11, 0, -14, 0, 0, -9,
-    -11, -8, -8, -4, -6, -8, -4, -12,
-    0, 0, 0, 0, -7, 0, 0, 0,
-    -2, -5, -7, -7, 0, -3, -2, -2,
-    0, -4, -4, -4, -5, -5, -4, 0,
-    0, 0, 0, -4, -5, -4, -4, -6,
-    -4, 0, 0, 0, -12, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, -6, 0,
-    -5, -2, 0, -6, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, -4, 0, 0,
-    0, 0, 0, 0, 0, 0, -5, -3,
-    0, -3, 0, 0, 0, 0, 0, 0,
-    -13, 0, -5, 0, -2, -11, 0, -4,
-    0, -1, 0, 0, 0, 0, -1, -5,
-    0, -2, -2, -5, -2, -2, 0, 0,
-    0, 0, -6, 0, 0, 0, 0, 0,
-    0, 0, -5, 0, -4, 0, 0, -6,
-    0, -3, -6, 0, -3, 0, 0, 0,
-    0, -3, 0, 0, 0, 0, 0, 0,
-    0, 0, -7, 0, 1, 0, 0, 0,
-    0, 0, -5, -5, -6, 0, -5, -3,
-    0, -7, 0, -4, 0, -1, -3, 0,
-    0, 0, 0, -3, 0, 0, 0, -3,
-    0, -1, 2, 9, 0, -12, -4, -12,
-    -3, 0, 0, 0, 0, 0, 9, 0,
-    13, 9, 6, 11, 0, -5, -3, 0,
-    -4, 0, -3, 0, -2, 0, 0, 1,
-    0, -2, 0, -4, 0, 2, -7, 0,
-    0, 0, 8, 0, 0, 0, 0, 0,
-    -7, 0, 0, 0, 0, -4, 0, -4,
-    -4, 0, 0, 0, 8, 0, 0, 0,
-    0, -2, -2, 0, 2, -4, 0, 0,
-    -7, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, -6, 0, -3, 0, 0, -5,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, -5, 1, -12, 1, 0, 1,
-    0, 0, 0, 0, -9, 0, 0, 0,
-    0, -4, 0, -3, -5, 0, -3, 0,
-    -3, 0, 0, -6, -4, 0, 0, -3,
-    0, -3, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 1, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, -5, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    -5, 0, -4, 0, 0, -7, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, -15, -6, -15, -7, 3, -4, 0,
-    -14, 0, 0, 0, 0, 0, 0, 0,
-    -3, -6, -3, 0, -3, 0, 0, 0,
-    -2, 0, 0, 3, 2, 0, 3, -2,
-    0, 0, -10, 0, 1, 0, 0, 0,
-    0, 0, 0, 0, -6, 0, -3, 0,
-    0, -5, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, -5, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, -1, -7, -1,
-    0, 2, 0, 0, 0, 0, -4, 0,
-    0, 0, 0, -2, 0, -5, -4, 0,
-    -3, 0, 0, 0, -3, -5, 0, 0,
-    0, -4, 0, 0, 0, 0, -3, -10,
-    -3, -10, -5, 0, -3, 0, -9, 0,
-    -5, 0, -3, 0, 0, -4, -3, -5,
-    -2, 0, 0, 0, -3, 0, 0, 0,
-    0, 0, 0, 0, 0, -6, 0, 0,
-    -3, -12, 0, -12, -2, 0, -2, 0,
-    -7, 0, -6, 0, -3, 0, -4, -6,
-    0, -3, -2, 0, 0, 0, -3, 0,
-    0, 0, 0, 0, 0, 0, 0, -5,
-    -4, 0, -6, 1, -4, -3, 0, 0,
-    0, -3, 0, -2, -7, 0, -4, 0,
-    -3, -8, 0, -3, -5, 0, 0, 0,
-    0, 0, 0, -6, 0, 0, 0, 0,
-    -2, 0, 0, 0, 0, -10, 0, -10,
-    -3, 0, 0, 0, -9, 0, -5, 0,
-    -2, 0, -2, -3, 0, -5, -2, 0,
-    0, 0, -3, 0, 0, 0, 0, 0,
-    0, -4, 0, -6, 0, 0, 0, 0,
-    -5, 0, 0, 0, 0, 0, 0, 0,
-    -6, 0, 0, 0, 0, -6, 0, -5,
-    -3, 0, -2, 0, 0, 0, 0, 0,
-    -3, -2, 0, 0, -2, 0
-};
-
-
-/*Collect the kern class' data in one place*/
-static const lv_font_fmt_txt_kern_classes_t kern_classes =
-{
-    .class_pair_values   = kern_class_values,
-    .left_class_mapping  = kern_left_class_mapping,
-    .right_class_mapping = kern_right_class_mapping,
-    .left_class_cnt      = 43,
-    .right_class_cnt     = 34,
-};
-
-/*--------------------
- *  ALL CUSTOM DATA
- *--------------------*/
-
-#if LVGL_VERSION_MAJOR == 8
-/*Store all the custom data of the font*/
-static  lv_font_fmt_txt_glyph_cache_t cache;
-#endif
-
-#if LVGL_VERSION_MAJOR >= 8
-static const lv_font_fmt_txt_dsc_t font_dsc = {
-#else
-static lv_font_fmt_txt_dsc_t font_dsc = {
-#endif
-    .glyph_bitmap = glyph_bitmap,
-    .glyph_dsc = glyph_dsc,
-    .cmaps = cmaps,
-    .kern_dsc = &kern_classes,
-    .kern_scale = 16,
-    .cmap_num = 6,
-    .bpp = 2,
-    .kern_classes = 1,
-    .bitmap_format = 0,
-#if LVGL_VERSION_MAJOR == 8
-    .cache = &cache
-#endif
-
-};
-
-
-
-/*-----------------
- *  PUBLIC FONT
- *----------------*/
-
-/*Initialize a public general font descriptor*/
-#if LVGL_VERSION_MAJOR >= 8
-const lv_font_t lv_font_notosanssc_12 = {
-#else
-lv_font_t lv_font_notosanssc_12 = {
-#endif
-    .get_glyph_dsc = lv_font_get_glyph_dsc_fmt_txt,    /*Function pointer to get glyph's data*/
-    .get_glyph_bitmap = lv_font_get_bitmap_fmt_txt,    /*Function pointer to get glyph's bitmap*/
-    .line_height = 14,          /*The maximum line height required by the font*/
-    .base_line = 3,             /*Baseline measured from the bottom of the line*/
-#if !(LVGL_VERSION_MAJOR == 6 && LVGL_VERSION_MINOR == 0)
-    .subpx = LV_FONT_SUBPX_NONE,
-#endif
-#if LV_VERSION_CHECK(7, 4, 0) || LVGL_VERSION_MAJOR >= 8
-    .underline_position = -1,
-    .underline_thickness = 1,
-#endif
-    .static_bitmap = 0,
-    .dsc = &font_dsc,          /*The custom font data. Will be accessed by `get_glyph_bitmap/dsc` */
-#if LV_VERSION_CHECK(8, 2, 0) || LVGL_VERSION_MAJOR >= 9
-    .fallback = NULL,
-#endif
-    .user_data = NULL,
-};
-
-
-
-#endif /*#if LV_FONT_NOTOSANSSC_12*/
@@ -1,2347 +0,0 @@
-/*******************************************************************************
- * Size: 16 px
- * Bpp: 2
- * Opts: --bpp 2 --size 16 --no-compress --stride 1 --align 1 --font NotoSansSC-Medium.ttf --symbols  !#$%&()*+,-./0123456789:@ABCDEFGHIJKLMNOPQRSTUVWXYZ^_abcdefghijklmnopqrstuvwxyz—…。䴘䴙一上下乌了八冠凤加卷叉反发叶哥啄喜嘴噪夜大太头寿小尾山带恶戴拟捣文斑新日普暗木本来松林次水池灰燕狗珠琵白眶眼紫红统绣绿缝翅翠翡耳胜胸脚脸腰腹苇苍苦莺蓝蛇蛋蜂褐观角计通金银长阳隼雀雕雨页领颈鬼鱼鳽鵟鸟鸠鸢鸦鸫鸬鸮鸰鸲鸺鸻鹃鹊鹎鹚鹞鹠鹡鹬鹭鹰黄黑！（），：？￥ --format lvgl -o lv_font_notosanssc_16.c
- ******************************************************************************/
-
-#ifdef __has_include
-    #if __has_include("lvgl.h")
-        #ifndef LV_LVGL_H_INCLUDE_SIMPLE
-            #define LV_LVGL_H_INCLUDE_SIMPLE
-        #endif
-    #endif
-#endif
-
-#ifdef LV_LVGL_H_INCLUDE_SIMPLE
-    #include "lvgl.h"
-#else
-    #include "lvgl/lvgl.h"
-#endif
-
-
-
-#ifndef LV_FONT_NOTOSANSSC_16
-#define LV_FONT_NOTOSANSSC_16 1
-#endif
-
-#if LV_FONT_NOTOSANSSC_16
-
-/*-----------------
- *    BITMAPS
- *----------------*/
-
-/*Store the image of the glyphs*/
-static LV_ATTRIBUTE_LARGE_CONST const uint8_t glyph_bitmap[] = {
-    /* U+0020 " " */
-
-    /* U+0021 "!" */
-    0x38, 0xe3, 0x8e, 0x38, 0xd3, 0x4d, 0x0, 0x97,
-    0xce,
-
-    /* U+0023 "#" */
-    0x3, 0x9, 0x0, 0xc3, 0x40, 0x70, 0xc0, 0xff,
-    0xfe, 0x1a, 0x5d, 0x2, 0x47, 0x0, 0xd1, 0xc1,
-    0xff, 0xfc, 0xd, 0x28, 0x3, 0xd, 0x0, 0xc3,
-    0x40, 0x70, 0xc0,
-
-    /* U+0024 "$" */
-    0x0, 0x80, 0x0, 0x34, 0x0, 0x7f, 0x80, 0x3e,
-    0xb8, 0x2c, 0x0, 0xb, 0x0, 0x1, 0xf0, 0x0,
-    0x2f, 0x80, 0x0, 0xbc, 0x0, 0x7, 0xc0, 0x0,
-    0xf0, 0x40, 0x3c, 0x3e, 0xbe, 0x2, 0xfd, 0x0,
-    0xd, 0x0, 0x2, 0x0,
-
-    /* U+0025 "%" */
-    0x1f, 0x80, 0xc, 0x0, 0xe3, 0x80, 0xa0, 0x7,
-    0x7, 0x3, 0x0, 0x1c, 0x1c, 0x24, 0x0, 0x70,
-    0x71, 0xc0, 0x0, 0xd2, 0x8d, 0x2f, 0x41, 0xfc,
-    0x72, 0xc7, 0x0, 0x3, 0x4d, 0xd, 0x0, 0x18,
-    0x34, 0x34, 0x0, 0xc0, 0xd0, 0xd0, 0x6, 0x2,
-    0xcb, 0x0, 0x30, 0x2, 0xf4,
-
-    /* U+0026 "&" */
-    0x2, 0xf8, 0x0, 0xb, 0x6d, 0x0, 0xe, 0xd,
-    0x0, 0xe, 0x1c, 0x0, 0xb, 0xb4, 0x0, 0x7,
-    0xd0, 0x14, 0x1f, 0xd0, 0x38, 0x38, 0xf4, 0xb0,
-    0x74, 0x3e, 0xe0, 0x78, 0xf, 0xc0, 0x3e, 0x6f,
-    0xf8, 0xb, 0xf4, 0x28,
-
-    /* U+0028 "(" */
-    0x0, 0xa, 0xd, 0x2c, 0x38, 0x34, 0x70, 0xb0,
-    0xb0, 0xb0, 0xb0, 0x70, 0x34, 0x38, 0x2c, 0xd,
-    0xa, 0x0,
-
-    /* U+0029 ")" */
-    0x0, 0xd, 0x2, 0xc0, 0x30, 0xe, 0x2, 0xc0,
-    0x70, 0x1c, 0x7, 0x41, 0xd0, 0x70, 0x1c, 0xb,
-    0x3, 0x80, 0xc0, 0xb0, 0x34, 0x0, 0x0,
-
-    /* U+002A "*" */
-    0x2, 0x40, 0x4e, 0x3, 0xff, 0x82, 0xf0, 0xe,
-    0xa0, 0x10, 0x40,
-
-    /* U+002B "+" */
-    0x0, 0x40, 0x0, 0x34, 0x0, 0xd, 0x0, 0x3,
-    0x40, 0x7f, 0xff, 0x85, 0x75, 0x40, 0xd, 0x0,
-    0x3, 0x40, 0x0, 0xd0, 0x0,
-
-    /* U+002C "," */
-    0x4, 0x2e, 0x2f, 0xb, 0xd, 0x34, 0x0,
-
-    /* U+002D "-" */
-    0x0, 0x1f, 0xf1, 0x54,
-
-    /* U+002E "." */
-    0x23, 0xeb, 0x40,
-
-    /* U+002F "/" */
-    0x0, 0xb0, 0xd, 0x0, 0xc0, 0x1c, 0x2, 0x80,
-    0x34, 0x3, 0x0, 0xb0, 0xd, 0x0, 0xc0, 0x1c,
-    0x2, 0x80, 0x34, 0x3, 0x0, 0xb0, 0x5, 0x0,
-
-    /* U+0030 "0" */
-    0x7, 0xf4, 0x3, 0xdf, 0x42, 0xc0, 0xf0, 0xf0,
-    0x2c, 0x38, 0x7, 0x4e, 0x1, 0xd3, 0x80, 0x74,
-    0xe0, 0x1d, 0x3c, 0xb, 0xb, 0x3, 0xc0, 0xfb,
-    0xd0, 0x1f, 0xd0,
-
-    /* U+0031 "1" */
-    0xb, 0xc0, 0x3f, 0xc0, 0x3, 0xc0, 0x3, 0xc0,
-    0x3, 0xc0, 0x3, 0xc0, 0x3, 0xc0, 0x3, 0xc0,
-    0x3, 0xc0, 0x3, 0xc0, 0x6b, 0xe8, 0xbf, 0xfc,
-
-    /* U+0032 "2" */
-    0xb, 0xf4, 0xf, 0xaf, 0x2, 0x1, 0xe0, 0x0,
-    0x3c, 0x0, 0xe, 0x0, 0xb, 0x40, 0x3, 0xc0,
-    0x3, 0xc0, 0x2, 0xd0, 0x2, 0xd0, 0x3, 0xfa,
-    0xa1, 0xff, 0xfd,
-
-    /* U+0033 "3" */
-    0xb, 0xf4, 0xf, 0xaf, 0x40, 0x0, 0xf0, 0x0,
-    0x3c, 0x0, 0x7d, 0x0, 0xfd, 0x0, 0x17, 0xd0,
-    0x0, 0x3c, 0x0, 0xb, 0x8, 0x3, 0xc7, 0xeb,
-    0xe0, 0x2f, 0xd0,
-
-    /* U+0034 "4" */
-    0x0, 0x7c, 0x0, 0x3f, 0x0, 0x1e, 0xc0, 0xe,
-    0xb0, 0xb, 0x2c, 0x3, 0x8b, 0x3, 0xc2, 0xc1,
-    0xe0, 0xb4, 0xbf, 0xff, 0x85, 0x5b, 0x40, 0x2,
-    0xc0, 0x0, 0xb0,
-
-    /* U+0035 "5" */
-    0x1f, 0xfe, 0x7, 0xaa, 0x41, 0xc0, 0x0, 0xb0,
-    0x0, 0x2f, 0xf8, 0x7, 0x5b, 0x80, 0x0, 0xf0,
-    0x0, 0x2c, 0x0, 0xb, 0x8, 0x3, 0xc7, 0xeb,
-    0xd0, 0x2f, 0xd0,
-
-    /* U+0036 "6" */
-    0x2, 0xfd, 0x3, 0xeb, 0xc1, 0xd0, 0x0, 0xf0,
-    0x0, 0x38, 0x0, 0xe, 0xbf, 0x3, 0xe5, 0xf0,
-    0xf0, 0x1d, 0x3c, 0x7, 0x4b, 0x2, 0xd0, 0xf6,
-    0xf0, 0xb, 0xe0,
-
-    /* U+0037 "7" */
-    0x3f, 0xff, 0x4a, 0xab, 0xc0, 0x1, 0xd0, 0x0,
-    0xf0, 0x0, 0x74, 0x0, 0x3c, 0x0, 0xe, 0x0,
-    0x7, 0x40, 0x2, 0xd0, 0x0, 0xb0, 0x0, 0x3c,
-    0x0, 0xf, 0x0,
-
-    /* U+0038 "8" */
-    0x7, 0xf8, 0x7, 0x9b, 0x82, 0xc0, 0xb0, 0xb0,
-    0x2c, 0x1e, 0xe, 0x1, 0xfe, 0x0, 0xeb, 0xd0,
-    0xe0, 0x3c, 0x34, 0x7, 0x4e, 0x2, 0xd2, 0xe6,
-    0xf0, 0x2f, 0xe0,
-
-    /* U+0039 "9" */
-    0xb, 0xf0, 0xb, 0x9f, 0x3, 0x80, 0xe1, 0xd0,
-    0x2c, 0x78, 0xb, 0xf, 0x47, 0xd1, 0xff, 0xb0,
-    0x0, 0x2c, 0x0, 0xf, 0x0, 0x7, 0x83, 0xeb,
-    0xc0, 0x3f, 0x80,
-
-    /* U+003A ":" */
-    0xb7, 0xe2, 0x0, 0x0, 0x2, 0x3e, 0xb4,
-
-    /* U+0040 "@" */
-    0x0, 0x1b, 0xf9, 0x0, 0x3, 0xe4, 0x6e, 0x0,
-    0x38, 0x0, 0xe, 0x3, 0x80, 0x0, 0xc, 0x1c,
-    0xb, 0xec, 0x34, 0xe0, 0xb5, 0xe0, 0xa3, 0x43,
-    0x43, 0x42, 0x8c, 0x1c, 0xc, 0xa, 0x30, 0x70,
-    0x70, 0x34, 0xd1, 0xd3, 0xc2, 0x82, 0xc2, 0xf6,
-    0xf8, 0x3, 0x80, 0x0, 0x0, 0x7, 0xd0, 0x14,
-    0x0, 0x2, 0xff, 0xd0, 0x0, 0x0, 0x0, 0x0,
-    0x0,
-
-    /* U+0041 "A" */
-    0x1, 0xf0, 0x0, 0x2f, 0x80, 0x3, 0xac, 0x0,
-    0x35, 0xc0, 0xb, 0xe, 0x0, 0xf0, 0xf0, 0xe,
-    0xb, 0x2, 0xff, 0xf4, 0x3d, 0x57, 0xc3, 0x80,
-    0x2c, 0xb4, 0x1, 0xdf, 0x0, 0xf,
-
-    /* U+0042 "B" */
-    0x7f, 0xf8, 0x1e, 0x5b, 0xc7, 0x40, 0xb5, 0xd0,
-    0x2d, 0x74, 0x1f, 0x1f, 0xff, 0x47, 0x95, 0xf5,
-    0xd0, 0xf, 0x74, 0x3, 0xdd, 0x0, 0xf7, 0x96,
-    0xf5, 0xff, 0xe4,
-
-    /* U+0043 "C" */
-    0x0, 0xbf, 0x40, 0x7e, 0xbd, 0xf, 0x0, 0x42,
-    0xd0, 0x0, 0x3c, 0x0, 0x3, 0xc0, 0x0, 0x3c,
-    0x0, 0x3, 0xc0, 0x0, 0x2d, 0x0, 0x1, 0xf0,
-    0x8, 0x7, 0xeb, 0xe0, 0x1b, 0xf4,
-
-    /* U+0044 "D" */
-    0x7f, 0xf4, 0x7, 0xab, 0xe0, 0x74, 0xb, 0x87,
-    0x40, 0x3c, 0x74, 0x3, 0xc7, 0x40, 0x2d, 0x74,
-    0x2, 0xd7, 0x40, 0x3c, 0x74, 0x3, 0xc7, 0x40,
-    0xf4, 0x7a, 0xbe, 0x7, 0xff, 0x40,
-
-    /* U+0045 "E" */
-    0x7f, 0xfe, 0x7a, 0xa9, 0x74, 0x0, 0x74, 0x0,
-    0x74, 0x0, 0x7f, 0xf8, 0x7a, 0xa4, 0x74, 0x0,
-    0x74, 0x0, 0x74, 0x0, 0x7e, 0xa9, 0x7f, 0xfe,
-
-    /* U+0046 "F" */
-    0x7f, 0xfe, 0x7a, 0xa9, 0x74, 0x0, 0x74, 0x0,
-    0x74, 0x0, 0x7a, 0xa4, 0x7f, 0xfc, 0x74, 0x0,
-    0x74, 0x0, 0x74, 0x0, 0x74, 0x0, 0x74, 0x0,
-
-    /* U+0047 "G" */
-    0x0, 0xbf, 0x80, 0x1f, 0xaf, 0x80, 0xf0, 0x4,
-    0xb, 0x40, 0x0, 0x3c, 0x0, 0x0, 0xf0, 0x2a,
-    0x83, 0xc0, 0xff, 0xf, 0x0, 0x2c, 0x2d, 0x0,
-    0xb0, 0x3c, 0x2, 0xc0, 0x7f, 0xbf, 0x0, 0x2f,
-    0xe0,
-
-    /* U+0048 "H" */
-    0x74, 0x2, 0xd7, 0x40, 0x2d, 0x74, 0x2, 0xd7,
-    0x40, 0x2d, 0x74, 0x2, 0xd7, 0xff, 0xfd, 0x7e,
-    0xab, 0xd7, 0x40, 0x2d, 0x74, 0x2, 0xd7, 0x40,
-    0x2d, 0x74, 0x2, 0xd7, 0x40, 0x2d,
-
-    /* U+0049 "I" */
-    0x75, 0xd7, 0x5d, 0x75, 0xd7, 0x5d, 0x75, 0xd7,
-    0x5d,
-
-    /* U+004A "J" */
-    0x0, 0x2d, 0x0, 0x2d, 0x0, 0x2d, 0x0, 0x2d,
-    0x0, 0x2d, 0x0, 0x2d, 0x0, 0x2d, 0x0, 0x2d,
-    0x0, 0x2d, 0x20, 0x3c, 0x3e, 0xf8, 0xf, 0xe0,
-
-    /* U+004B "K" */
-    0x74, 0x7, 0x87, 0x41, 0xf0, 0x74, 0x3c, 0x7,
-    0x4f, 0x40, 0x76, 0xe0, 0x7, 0xff, 0x0, 0x7f,
-    0xb4, 0x7, 0xc3, 0xc0, 0x74, 0x1e, 0x7, 0x40,
-    0xf0, 0x74, 0x7, 0x87, 0x40, 0x2d,
-
-    /* U+004C "L" */
-    0x74, 0x0, 0x74, 0x0, 0x74, 0x0, 0x74, 0x0,
-    0x74, 0x0, 0x74, 0x0, 0x74, 0x0, 0x74, 0x0,
-    0x74, 0x0, 0x74, 0x0, 0x7e, 0xa8, 0x7f, 0xfd,
-
-    /* U+004D "M" */
-    0x7c, 0x0, 0xbd, 0xf0, 0x3, 0xf7, 0xe0, 0x1f,
-    0xde, 0xc0, 0xbf, 0x77, 0x43, 0x7d, 0xce, 0x1c,
-    0xf7, 0x2c, 0xb3, 0xdc, 0x37, 0x4f, 0x70, 0xfc,
-    0x3d, 0xc1, 0xe0, 0xf7, 0x3, 0x43, 0xdc, 0x0,
-    0xf,
-
-    /* U+004E "N" */
-    0x78, 0x2, 0xc7, 0xd0, 0x2c, 0x7f, 0x2, 0xc7,
-    0x74, 0x2c, 0x73, 0xc2, 0xc7, 0x5d, 0x2c, 0x74,
-    0xb2, 0xc7, 0x43, 0xac, 0x74, 0x2e, 0xc7, 0x40,
-    0xfc, 0x74, 0xb, 0xc7, 0x40, 0x3c,
-
-    /* U+004F "O" */
-    0x1, 0xff, 0x40, 0xb, 0xeb, 0xe0, 0x1f, 0x0,
-    0xf4, 0x2d, 0x0, 0x3c, 0x3c, 0x0, 0x3c, 0x3c,
-    0x0, 0x3c, 0x3c, 0x0, 0x3c, 0x3c, 0x0, 0x3c,
-    0x2d, 0x0, 0x3c, 0x1f, 0x0, 0xf4, 0xb, 0xeb,
-    0xe0, 0x1, 0xff, 0x40,
-
-    /* U+0050 "P" */
-    0x7f, 0xf8, 0x1e, 0xab, 0xc7, 0x40, 0xb5, 0xd0,
-    0xe, 0x74, 0x7, 0x9d, 0x7, 0xc7, 0xff, 0xd1,
-    0xe9, 0x40, 0x74, 0x0, 0x1d, 0x0, 0x7, 0x40,
-    0x1, 0xd0, 0x0,
-
-    /* U+0051 "Q" */
-    0x1, 0xff, 0x40, 0xb, 0xeb, 0xe0, 0x1f, 0x0,
-    0xf4, 0x2d, 0x0, 0x3c, 0x3c, 0x0, 0x3c, 0x3c,
-    0x0, 0x3c, 0x3c, 0x0, 0x3c, 0x3c, 0x0, 0x3c,
-    0x2d, 0x0, 0x3c, 0x1f, 0x0, 0xf4, 0xb, 0xeb,
-    0xe0, 0x1, 0xff, 0x40, 0x0, 0x2e, 0x0, 0x0,
-    0xf, 0xe8, 0x0, 0x1, 0xfd,
-
-    /* U+0052 "R" */
-    0x7f, 0xf8, 0x7, 0xaa, 0xf0, 0x74, 0x7, 0x87,
-    0x40, 0x38, 0x74, 0x7, 0x87, 0x41, 0xf0, 0x7f,
-    0xfd, 0x7, 0x9b, 0x40, 0x74, 0x3c, 0x7, 0x41,
-    0xe0, 0x74, 0xf, 0x7, 0x40, 0x7c,
-
-    /* U+0053 "S" */
-    0x2, 0xfd, 0x0, 0xfa, 0xf4, 0x2d, 0x1, 0x2,
-    0xd0, 0x0, 0x1f, 0x40, 0x0, 0xbf, 0x80, 0x0,
-    0xbf, 0x40, 0x0, 0xbc, 0x0, 0x3, 0xc2, 0x40,
-    0x3c, 0x3f, 0xaf, 0x40, 0x7f, 0xd0,
-
-    /* U+0054 "T" */
-    0xbf, 0xff, 0xd6, 0xaf, 0xa8, 0x0, 0xf0, 0x0,
-    0xf, 0x0, 0x0, 0xf0, 0x0, 0xf, 0x0, 0x0,
-    0xf0, 0x0, 0xf, 0x0, 0x0, 0xf0, 0x0, 0xf,
-    0x0, 0x0, 0xf0, 0x0, 0xf, 0x0,
-
-    /* U+0055 "U" */
-    0xb4, 0x2, 0xcb, 0x40, 0x2c, 0xb4, 0x2, 0xcb,
-    0x40, 0x2c, 0xb4, 0x2, 0xcb, 0x40, 0x2c, 0xb4,
-    0x2, 0xc7, 0x40, 0x2c, 0x78, 0x3, 0xc3, 0xc0,
-    0x7c, 0x2f, 0xaf, 0x40, 0x7f, 0xd0,
-
-    /* U+0056 "V" */
-    0x3c, 0x0, 0xb4, 0xb4, 0x3, 0xc1, 0xe0, 0xf,
-    0x3, 0xc0, 0x74, 0xb, 0x2, 0xc0, 0x1d, 0xf,
-    0x0, 0x3c, 0x38, 0x0, 0xb1, 0xc0, 0x1, 0xdb,
-    0x0, 0x3, 0xb8, 0x0, 0xf, 0xd0, 0x0, 0x1f,
-    0x0,
-
-    /* U+0057 "W" */
-    0xb4, 0xb, 0x0, 0xf7, 0x80, 0xf4, 0xe, 0x38,
-    0xf, 0x81, 0xd3, 0xc1, 0xec, 0x1c, 0x2c, 0x29,
-    0xc2, 0xc2, 0xc3, 0x8d, 0x3c, 0x1d, 0x34, 0xe3,
-    0x80, 0xe7, 0xf, 0x34, 0xf, 0xb0, 0xb7, 0x40,
-    0xbe, 0x7, 0xb0, 0xb, 0xd0, 0x3f, 0x0, 0x7c,
-    0x3, 0xe0,
-
-    /* U+0058 "X" */
-    0x7c, 0x3, 0xc2, 0xd0, 0xb4, 0xf, 0xe, 0x0,
-    0xb6, 0xc0, 0x3, 0xf8, 0x0, 0x2f, 0x0, 0x3,
-    0xf4, 0x0, 0x7b, 0xc0, 0xf, 0x2d, 0x1, 0xd0,
-    0xf0, 0x3c, 0xb, 0x47, 0x40, 0x3c,
-
-    /* U+0059 "Y" */
-    0x3c, 0x1, 0xe1, 0xe0, 0x2c, 0xf, 0x3, 0x80,
-    0x74, 0xb0, 0x3, 0xcf, 0x0, 0x1e, 0xd0, 0x0,
-    0xfc, 0x0, 0xb, 0x40, 0x0, 0xb4, 0x0, 0xb,
-    0x40, 0x0, 0xb4, 0x0, 0xb, 0x40,
-
-    /* U+005A "Z" */
-    0x2f, 0xff, 0xc1, 0xaa, 0xf8, 0x0, 0xf, 0x0,
-    0x2, 0xd0, 0x0, 0x3c, 0x0, 0xf, 0x0, 0x1,
-    0xe0, 0x0, 0x3c, 0x0, 0xb, 0x40, 0x1, 0xe0,
-    0x0, 0x3e, 0xaa, 0x87, 0xff, 0xfc,
-
-    /* U+005E "^" */
-    0x7, 0x80, 0xf, 0xc0, 0xd, 0xd0, 0x2c, 0xe0,
-    0x38, 0x70, 0x70, 0x38, 0xf0, 0x2c,
-
-    /* U+005F "_" */
-    0xff, 0xff, 0xc0, 0x0, 0x0,
-
-    /* U+0061 "a" */
-    0x7, 0xf8, 0x2e, 0xbe, 0x0, 0xf, 0x0, 0x6f,
-    0xf, 0xef, 0x3c, 0xf, 0x38, 0xf, 0x3e, 0xbf,
-    0xf, 0xdb,
-
-    /* U+0062 "b" */
-    0xb0, 0x0, 0x2c, 0x0, 0xb, 0x0, 0x2, 0xc0,
-    0x0, 0xb6, 0xf8, 0x2f, 0xaf, 0x8b, 0x40, 0xf2,
-    0xc0, 0x2c, 0xb0, 0xb, 0x6c, 0x3, 0xcb, 0x40,
-    0xf2, 0xfa, 0xf4, 0xb3, 0xf4, 0x0,
-
-    /* U+0063 "c" */
-    0x2, 0xf8, 0xf, 0xad, 0x3d, 0x0, 0x3c, 0x0,
-    0x38, 0x0, 0x3c, 0x0, 0x3d, 0x0, 0x1f, 0xae,
-    0x3, 0xf8,
-
-    /* U+0064 "d" */
-    0x0, 0x3, 0x80, 0x0, 0xe0, 0x0, 0x38, 0x0,
-    0xe, 0x7, 0xf7, 0x87, 0xeb, 0xe3, 0xd0, 0x38,
-    0xf0, 0xe, 0x38, 0x3, 0x8f, 0x0, 0xe3, 0xc0,
-    0x78, 0x7e, 0xbe, 0x7, 0xf3, 0x80,
-
-    /* U+0065 "e" */
-    0x2, 0xf8, 0x3, 0xeb, 0x83, 0xc0, 0xb0, 0xe0,
-    0x1d, 0x3f, 0xff, 0x4e, 0x0, 0x3, 0xc0, 0x0,
-    0x7e, 0x68, 0x2, 0xfd, 0x0,
-
-    /* U+0066 "f" */
-    0x7, 0xf0, 0x3e, 0x41, 0xe0, 0x7, 0x80, 0x7f,
-    0xd0, 0xbd, 0x1, 0xe0, 0x7, 0x80, 0x1e, 0x0,
-    0x78, 0x1, 0xe0, 0x7, 0x80, 0x1e, 0x0,
-
-    /* U+0067 "g" */
-    0x7, 0xff, 0xc1, 0xe6, 0xe8, 0x3c, 0xe, 0x3,
-    0xc0, 0xe0, 0x2d, 0x1d, 0x0, 0xff, 0x80, 0x2c,
-    0x0, 0x2, 0xe5, 0x40, 0xf, 0xff, 0x83, 0x80,
-    0x3c, 0x34, 0x3, 0xc3, 0xd1, 0xf4, 0xb, 0xf8,
-    0x0,
-
-    /* U+0068 "h" */
-    0xb0, 0x0, 0xb0, 0x0, 0xb0, 0x0, 0xb0, 0x0,
-    0xb6, 0xf8, 0xbf, 0xbd, 0xb8, 0x1e, 0xb0, 0xe,
-    0xb0, 0xe, 0xb0, 0xe, 0xb0, 0xe, 0xb0, 0xe,
-    0xb0, 0xe,
-
-    /* U+0069 "i" */
-    0xb2, 0xd0, 0x0, 0xb2, 0xcb, 0x2c, 0xb2, 0xcb,
-    0x2c, 0xb0,
-
-    /* U+006A "j" */
-    0xb, 0x2, 0xd0, 0x0, 0x0, 0xb, 0x42, 0xd0,
-    0xb4, 0x2d, 0xb, 0x42, 0xd0, 0xb4, 0x2d, 0xb,
-    0x42, 0xd0, 0xb1, 0xbc, 0xbd, 0x0,
-
-    /* U+006B "k" */
-    0xb0, 0x0, 0x2c, 0x0, 0xb, 0x0, 0x2, 0xc0,
-    0x0, 0xb0, 0x2d, 0x2c, 0x2e, 0xb, 0x1e, 0x2,
-    0xdf, 0x0, 0xbf, 0xd0, 0x2f, 0x7c, 0xb, 0x47,
-    0x82, 0xc0, 0xf0, 0xb0, 0xe, 0x0,
-
-    /* U+006C "l" */
-    0xb0, 0xb0, 0xb0, 0xb0, 0xb0, 0xb0, 0xb0, 0xb0,
-    0xb0, 0xb0, 0xb0, 0xb8, 0x3c,
-
-    /* U+006D "m" */
-    0xb2, 0xf4, 0xbe, 0x2f, 0x9f, 0xe7, 0xdb, 0x41,
-    0xe0, 0x3a, 0xc0, 0x78, 0xf, 0xb0, 0x1e, 0x3,
-    0xec, 0x7, 0x80, 0xfb, 0x1, 0xe0, 0x3e, 0xc0,
-    0x78, 0xf, 0xb0, 0x1e, 0x3, 0xc0,
-
-    /* U+006E "n" */
-    0xb2, 0xf8, 0xbe, 0x7d, 0xb4, 0x1e, 0xb0, 0xe,
-    0xb0, 0xe, 0xb0, 0xe, 0xb0, 0xe, 0xb0, 0xe,
-    0xb0, 0xe,
-
-    /* U+006F "o" */
-    0x2, 0xf8, 0x1, 0xfa, 0xf0, 0x3c, 0x7, 0x83,
-    0xc0, 0x3c, 0x38, 0x3, 0xc3, 0xc0, 0x3c, 0x3c,
-    0x7, 0x81, 0xfa, 0xf0, 0x2, 0xf8, 0x0,
-
-    /* U+0070 "p" */
-    0xb6, 0xf8, 0x2f, 0x9b, 0x8b, 0x40, 0xf2, 0xc0,
-    0x2c, 0xb0, 0xb, 0x6c, 0x3, 0xcb, 0x40, 0xf2,
-    0xfa, 0xf4, 0xb7, 0xf4, 0x2c, 0x0, 0xb, 0x0,
-    0x2, 0xc0, 0x0, 0xb0, 0x0, 0x0,
-
-    /* U+0071 "q" */
-    0x7, 0xf7, 0x87, 0xeb, 0xe3, 0xd0, 0x38, 0xf0,
-    0xe, 0x38, 0x3, 0x8f, 0x0, 0xe3, 0xc0, 0x78,
-    0x7e, 0xbe, 0x7, 0xf7, 0x80, 0x0, 0xe0, 0x0,
-    0x38, 0x0, 0xe, 0x0, 0x3, 0x80,
-
-    /* U+0072 "r" */
-    0x0, 0xb, 0x2d, 0xbe, 0x4b, 0x80, 0xb4, 0xb,
-    0x0, 0xb0, 0xb, 0x0, 0xb0, 0xb, 0x0,
-
-    /* U+0073 "s" */
-    0xb, 0xf4, 0x3e, 0x78, 0x3c, 0x0, 0x3e, 0x0,
-    0xb, 0xf0, 0x0, 0x7c, 0x0, 0x2c, 0x79, 0xbc,
-    0x1f, 0xe0,
-
-    /* U+0074 "t" */
-    0x9, 0x0, 0x38, 0x0, 0xe0, 0x2f, 0xfc, 0x6f,
-    0x50, 0x78, 0x1, 0xe0, 0x7, 0x80, 0x1e, 0x0,
-    0x78, 0x0, 0xf9, 0x1, 0xfc,
-
-    /* U+0075 "u" */
-    0xb0, 0x1e, 0xb0, 0x1e, 0xb0, 0x1e, 0xb0, 0x1e,
-    0xb0, 0x1e, 0xb0, 0x1e, 0xb4, 0x2e, 0x7e, 0xfe,
-    0x2f, 0x8e,
-
-    /* U+0076 "v" */
-    0xb0, 0x7, 0x5e, 0x3, 0xc3, 0xc0, 0xe0, 0xb0,
-    0x74, 0xd, 0x2c, 0x3, 0xce, 0x0, 0xb7, 0x40,
-    0xf, 0xc0, 0x3, 0xe0, 0x0,
-
-    /* U+0077 "w" */
-    0x74, 0x1e, 0x3, 0x8e, 0xb, 0xc1, 0xd3, 0xc3,
-    0xb0, 0x70, 0xb0, 0xdd, 0x2c, 0x1d, 0x73, 0x8e,
-    0x3, 0xac, 0xb3, 0x40, 0xfe, 0x1e, 0xc0, 0x2f,
-    0x43, 0xf0, 0x7, 0xc0, 0xf8, 0x0,
-
-    /* U+0078 "x" */
-    0x38, 0xe, 0xb, 0x4b, 0x0, 0xf7, 0x80, 0x1f,
-    0xc0, 0x3, 0xd0, 0x2, 0xfc, 0x0, 0xe7, 0x80,
-    0xf0, 0xb0, 0x74, 0xf, 0x0,
-
-    /* U+0079 "y" */
-    0xb4, 0x7, 0x4e, 0x2, 0xc3, 0xc0, 0xe0, 0x74,
-    0x74, 0xe, 0x2c, 0x2, 0xce, 0x0, 0x77, 0x40,
-    0xf, 0xc0, 0x2, 0xe0, 0x0, 0x74, 0x0, 0x3c,
-    0x0, 0xad, 0x0, 0x3d, 0x0, 0x0,
-
-    /* U+007A "z" */
-    0x3f, 0xfd, 0x15, 0xbc, 0x0, 0xb0, 0x1, 0xe0,
-    0x3, 0xc0, 0xb, 0x40, 0x1e, 0x0, 0x3e, 0x54,
-    0x7f, 0xfd,
-
-    /* U+2014 "—" */
-    0x0, 0x0, 0x0, 0x7, 0xff, 0xff, 0xfe, 0x0,
-    0x0, 0x0, 0x0,
-
-    /* U+2026 "…" */
-    0x10, 0x0, 0x0, 0x47, 0x80, 0xf0, 0x2d, 0x38,
-    0xf, 0x2, 0xc0,
-
-    /* U+3002 "。" */
-    0xf, 0x83, 0x4a, 0x30, 0x23, 0xa, 0x1f, 0x80,
-
-    /* U+4D18 "䴘" */
-    0x0, 0x1, 0x1, 0x0, 0x16, 0xbe, 0x7, 0x0,
-    0x39, 0x70, 0x3f, 0xf4, 0x30, 0x3f, 0x78, 0x34,
-    0x30, 0x30, 0x3b, 0x74, 0x37, 0xff, 0xf5, 0x74,
-    0x37, 0x20, 0xb4, 0x70, 0x37, 0xbe, 0x36, 0xe0,
-    0x37, 0x31, 0x79, 0x54, 0x37, 0x2f, 0x2a, 0xbc,
-    0x36, 0x29, 0x0, 0x1c, 0x36, 0x69, 0xbf, 0xdc,
-    0x69, 0x9a, 0x40, 0x1c, 0xad, 0xcb, 0x0, 0x2c,
-    0x5, 0x44, 0x1, 0xf4,
-
-    /* U+4D19 "䴙" */
-    0x0, 0x1, 0x1, 0x80, 0x2f, 0xc3, 0x2, 0xc0,
-    0x29, 0xdf, 0xef, 0xfc, 0x24, 0xd9, 0x9d, 0x1c,
-    0x24, 0xcc, 0xde, 0xe8, 0x2f, 0xcc, 0xcc, 0x68,
-    0x29, 0x4d, 0x9c, 0xb4, 0x34, 0x2f, 0xfc, 0x50,
-    0x3f, 0xc3, 0xe, 0xa8, 0x3d, 0xc3, 0xa, 0xad,
-    0x3c, 0xef, 0xd0, 0xd, 0x3c, 0xd7, 0x5f, 0xed,
-    0x7c, 0xc3, 0x0, 0x1c, 0x6f, 0xc3, 0x0, 0x1c,
-    0xc, 0x3, 0x0, 0xf8, 0x0, 0x0, 0x0, 0x0,
-
-    /* U+4E00 "一" */
-    0x0, 0x0, 0x0, 0x0, 0x3f, 0xff, 0xff, 0xfe,
-    0x2a, 0xaa, 0xaa, 0xa9,
-
-    /* U+4E0A "上" */
-    0x0, 0xb, 0x0, 0x0, 0x0, 0xb, 0x0, 0x0,
-    0x0, 0xb, 0x0, 0x0, 0x0, 0xb, 0x0, 0x0,
-    0x0, 0xb, 0x0, 0x0, 0x0, 0xb, 0xaa, 0x90,
-    0x0, 0xb, 0xff, 0xf0, 0x0, 0xb, 0x0, 0x0,
-    0x0, 0xb, 0x0, 0x0, 0x0, 0xb, 0x0, 0x0,
-    0x0, 0xb, 0x0, 0x0, 0x0, 0xb, 0x0, 0x0,
-    0x0, 0xb, 0x0, 0x0, 0x7f, 0xff, 0xff, 0xfc,
-    0x6a, 0xaa, 0xaa, 0xa8,
-
-    /* U+4E0B "下" */
-    0x15, 0x55, 0x55, 0x54, 0x3f, 0xff, 0xff, 0xfc,
-    0x15, 0x57, 0x95, 0x54, 0x0, 0x3, 0x80, 0x0,
-    0x0, 0x3, 0x80, 0x0, 0x0, 0x3, 0xf8, 0x0,
-    0x0, 0x3, 0xaf, 0x40, 0x0, 0x3, 0x83, 0xf0,
-    0x0, 0x3, 0x80, 0xb0, 0x0, 0x3, 0x80, 0x0,
-    0x0, 0x3, 0x80, 0x0, 0x0, 0x3, 0x80, 0x0,
-    0x0, 0x3, 0x80, 0x0, 0x0, 0x3, 0x80, 0x0,
-
-    /* U+4E4C "乌" */
-    0x0, 0x2, 0x0, 0x0, 0x0, 0x2c, 0x0, 0x0,
-    0x3f, 0xff, 0xfd, 0x0, 0xe5, 0x55, 0xb4, 0x3,
-    0x40, 0x1, 0xc0, 0xd, 0x0, 0x5f, 0x0, 0x34,
-    0x3, 0xf4, 0x0, 0xe0, 0x0, 0x0, 0x3, 0xff,
-    0xff, 0xfc, 0x0, 0x0, 0x0, 0xb0, 0x0, 0x0,
-    0x2, 0x8f, 0xff, 0xff, 0xce, 0x0, 0x0, 0x0,
-    0x38, 0x0, 0x0, 0x16, 0xd0, 0x0, 0x0, 0xfe,
-    0x0, 0x0, 0x0, 0x0,
-
-    /* U+4E86 "了" */
-    0x15, 0x55, 0x55, 0x47, 0xff, 0xff, 0xfc, 0x0,
-    0x0, 0x1f, 0x40, 0x0, 0xb, 0xc0, 0x0, 0x7,
-    0xe0, 0x0, 0x0, 0xb0, 0x0, 0x0, 0xb, 0x0,
-    0x0, 0x0, 0xb0, 0x0, 0x0, 0xb, 0x0, 0x0,
-    0x0, 0xb0, 0x0, 0x0, 0xb, 0x0, 0x0, 0x0,
-    0xb0, 0x0, 0x1, 0x5f, 0x0, 0x0, 0x2f, 0xd0,
-    0x0, 0x0, 0x0, 0x0, 0x0,
-
-    /* U+516B "八" */
-    0x0, 0x0, 0x4, 0x0, 0x0, 0x74, 0x2c, 0x0,
-    0x0, 0x70, 0x2c, 0x0, 0x0, 0xb0, 0x1c, 0x0,
-    0x0, 0xb0, 0x1d, 0x0, 0x0, 0xf0, 0xd, 0x0,
-    0x0, 0xe0, 0xe, 0x0, 0x1, 0xd0, 0xb, 0x0,
-    0x2, 0xc0, 0x7, 0x40, 0x3, 0x80, 0x3, 0xc0,
-    0x7, 0x40, 0x1, 0xd0, 0xf, 0x0, 0x0, 0xf0,
-    0x3c, 0x0, 0x0, 0x7c, 0x34, 0x0, 0x0, 0x1c,
-    0x0, 0x0, 0x0, 0x0,
-
-    /* U+51A0 "冠" */
-    0x3f, 0xff, 0xff, 0xf8, 0x39, 0x55, 0x55, 0x78,
-    0x38, 0x0, 0x0, 0x78, 0x1f, 0xfc, 0x0, 0xd0,
-    0x1a, 0xa8, 0x55, 0xe4, 0x0, 0x0, 0xff, 0xfc,
-    0x2a, 0xaa, 0x0, 0xd0, 0x3f, 0xff, 0x70, 0xd0,
-    0xa, 0x38, 0x38, 0xd0, 0xa, 0x38, 0x14, 0xd0,
-    0xe, 0x38, 0x5, 0xd0, 0xc, 0x38, 0xb, 0x8d,
-    0x3c, 0x3d, 0x55, 0x6c, 0x30, 0x1f, 0xff, 0xf8,
-    0x0, 0x0, 0x0, 0x0,
-
-    /* U+51E4 "凤" */
-    0xf, 0xff, 0xff, 0xe0, 0xf, 0x55, 0x55, 0xe0,
-    0xf, 0x0, 0x0, 0xe0, 0xf, 0x15, 0x54, 0xe0,
-    0xf, 0x3f, 0xfc, 0xe0, 0xe, 0x0, 0x1c, 0xe0,
-    0xe, 0x28, 0x38, 0xe0, 0xe, 0x1e, 0x70, 0xe0,
-    0xe, 0x3, 0xe0, 0xa0, 0xd, 0x3, 0xf0, 0xb0,
-    0x1c, 0xf, 0x7c, 0xb0, 0x2c, 0x7c, 0xd, 0x76,
-    0x38, 0xa0, 0x0, 0x3d, 0x30, 0x0, 0x0, 0x2c,
-    0x0, 0x0, 0x0, 0x0,
-
-    /* U+52A0 "加" */
-    0x3, 0x40, 0x0, 0x0, 0xd, 0x0, 0x0, 0x0,
-    0x34, 0x2, 0xff, 0x8a, 0xea, 0x4b, 0xfe, 0x3f,
-    0xff, 0x28, 0x38, 0xd, 0x2c, 0xa0, 0xe0, 0x34,
-    0xb2, 0x83, 0x81, 0xc2, 0xca, 0xe, 0x7, 0xb,
-    0x28, 0x38, 0x2c, 0x2c, 0xa0, 0xe0, 0xe0, 0xb2,
-    0x83, 0x83, 0x43, 0x8a, 0xe, 0x1c, 0xe, 0x2e,
-    0xb8, 0xe1, 0x74, 0xbf, 0xe7, 0xf, 0xc2, 0x83,
-    0x80, 0x0, 0x0, 0x0,
-
-    /* U+5377 "卷" */
-    0x0, 0x1, 0x80, 0x0, 0x1, 0xc2, 0xc3, 0x80,
-    0x0, 0xe3, 0x87, 0x0, 0xf, 0xff, 0xff, 0xf0,
-    0x5, 0x5f, 0x55, 0x50, 0x0, 0x1e, 0x0, 0x0,
-    0x3f, 0xff, 0xff, 0xfc, 0x15, 0xf5, 0x5f, 0x54,
-    0x7, 0xe5, 0x5b, 0xd0, 0x3f, 0xff, 0xfe, 0xfd,
-    0x34, 0xd0, 0xd, 0x2c, 0x0, 0xd0, 0x6c, 0x0,
-    0x0, 0xd1, 0xf8, 0x90, 0x0, 0xe5, 0x55, 0xe0,
-    0x0, 0x7f, 0xff, 0xc0,
-
-    /* U+53C9 "叉" */
-    0x0, 0x0, 0x0, 0x0, 0x2f, 0xff, 0xff, 0xf0,
-    0xb, 0x95, 0x55, 0xe0, 0x3, 0x86, 0x1, 0xd0,
-    0x2, 0xc7, 0xc2, 0xc0, 0x0, 0xd0, 0xd7, 0x40,
-    0x0, 0xb0, 0xf, 0x0, 0x0, 0x3c, 0x2d, 0x0,
-    0x0, 0x1e, 0xb8, 0x0, 0x0, 0xb, 0xe0, 0x0,
-    0x0, 0xf, 0xf4, 0x0, 0x0, 0xbd, 0x7e, 0x40,
-    0x1b, 0xe0, 0xb, 0xf8, 0x3e, 0x0, 0x0, 0x7c,
-    0x0, 0x0, 0x0, 0x0,
-
-    /* U+53CD "反" */
-    0x0, 0x0, 0x0, 0x40, 0x1, 0x56, 0xbf, 0xe0,
-    0x7, 0xff, 0xe9, 0x0, 0x7, 0x0, 0x0, 0x0,
-    0x7, 0x0, 0x0, 0x0, 0x7, 0xff, 0xff, 0xe0,
-    0x7, 0xbe, 0xaa, 0xe0, 0xb, 0x2c, 0x2, 0xc0,
-    0xb, 0xd, 0x3, 0x80, 0xb, 0xb, 0xf, 0x0,
-    0xe, 0x3, 0xed, 0x0, 0xe, 0x1, 0xf8, 0x0,
-    0x1d, 0x7, 0xfe, 0x0, 0x3c, 0xbe, 0xb, 0xf4,
-    0x24, 0xe0, 0x0, 0x74, 0x0, 0x0, 0x0, 0x0,
-
-    /* U+53D1 "发" */
-    0x0, 0x1, 0x40, 0x0, 0x2, 0xc3, 0x83, 0x80,
-    0x3, 0x83, 0x81, 0xe0, 0xb, 0x7, 0x40, 0x40,
-    0xf, 0xff, 0xff, 0xfc, 0x9, 0x5f, 0x55, 0x54,
-    0x0, 0x1e, 0x0, 0x0, 0x0, 0x2f, 0xff, 0xe0,
-    0x0, 0x3e, 0x56, 0xd0, 0x0, 0xfe, 0x3, 0xc0,
-    0x2, 0xe3, 0x8b, 0x40, 0xb, 0x81, 0xfd, 0x0,
-    0x3e, 0x1, 0xfd, 0x0, 0x34, 0x1f, 0xdf, 0xd0,
-    0x0, 0xfd, 0x1, 0xfc, 0x0, 0x0, 0x0, 0x0,
-
-    /* U+53F6 "叶" */
-    0x0, 0x0, 0x34, 0x0, 0x0, 0x0, 0xd0, 0xb,
-    0xfc, 0x3, 0x40, 0x3d, 0xb0, 0xd, 0x0, 0xe1,
-    0xc0, 0x34, 0x3, 0x87, 0x0, 0xe0, 0xe, 0x1f,
-    0xff, 0xff, 0xb8, 0x79, 0x6e, 0x54, 0xe1, 0xc0,
-    0x34, 0x3, 0x87, 0x0, 0xd0, 0xf, 0xfc, 0x3,
-    0x40, 0x39, 0x50, 0xd, 0x0, 0x50, 0x0, 0x34,
-    0x0, 0x0, 0x0, 0xd0, 0x0, 0x0, 0x3, 0x40,
-    0x0,
-
-    /* U+54E5 "哥" */
-    0x3f, 0xff, 0xff, 0xf8, 0x15, 0x55, 0x56, 0xd0,
-    0x3, 0xff, 0xf1, 0xc0, 0x3, 0x0, 0x71, 0xc0,
-    0x3, 0x0, 0x71, 0xc0, 0x3, 0xff, 0xf1, 0xc0,
-    0x15, 0x55, 0x56, 0xd4, 0x7f, 0xff, 0xff, 0xfc,
-    0x0, 0x0, 0x1, 0xd0, 0x7, 0xff, 0xf1, 0xd0,
-    0x7, 0x40, 0xb1, 0xd0, 0x7, 0x55, 0xb1, 0xd0,
-    0x7, 0xff, 0xf6, 0xd0, 0x1, 0x0, 0xf, 0xc0,
-    0x0, 0x0, 0x0, 0x0,
-
-    /* U+5544 "啄" */
-    0x0, 0x15, 0x55, 0x52, 0xfd, 0xff, 0xff, 0xdb,
-    0x74, 0xf, 0x0, 0x28, 0xd1, 0xf0, 0x4, 0xa3,
-    0xbe, 0xe0, 0xb6, 0x8e, 0xd2, 0xdf, 0x4a, 0x35,
-    0xef, 0xf8, 0x28, 0xd7, 0xcb, 0x70, 0xa7, 0xbb,
-    0x7c, 0xc2, 0xfd, 0x7, 0xb3, 0x8a, 0x0, 0xb5,
-    0xc7, 0x14, 0x1f, 0xb, 0xe, 0x0, 0x11, 0x78,
-    0x0, 0x0, 0xf, 0xc0, 0x0, 0x0, 0x0, 0x0,
-    0x0,
-
-    /* U+559C "喜" */
-    0x0, 0x3, 0x80, 0x0, 0x2f, 0xff, 0xff, 0xf8,
-    0x1a, 0xab, 0xea, 0xa4, 0x5, 0x57, 0xd5, 0x50,
-    0x6, 0xaa, 0xaa, 0xa0, 0x2, 0xaa, 0xaa, 0x80,
-    0x3, 0x80, 0x2, 0xc0, 0x3, 0xff, 0xff, 0xc0,
-    0x0, 0xb0, 0xf, 0x0, 0x2a, 0xfe, 0xbf, 0xa9,
-    0x15, 0x55, 0x55, 0x54, 0x3, 0xff, 0xff, 0xd0,
-    0x3, 0x55, 0x55, 0xd0, 0x3, 0x40, 0x1, 0xd0,
-    0x3, 0xff, 0xff, 0xd0,
-
-    /* U+5634 "嘴" */
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xd, 0x34, 0x5,
-    0x53, 0x79, 0xeb, 0x3f, 0xcd, 0xe7, 0xd0, 0xd7,
-    0x37, 0x9e, 0x33, 0x4d, 0xfe, 0x6f, 0xcd, 0x35,
-    0x70, 0x0, 0x34, 0xc3, 0xff, 0xc0, 0xd3, 0x3d,
-    0x1e, 0x3, 0x4d, 0xff, 0xff, 0x8d, 0x32, 0xc3,
-    0x4a, 0x3f, 0xcb, 0xff, 0xf8, 0xfa, 0x2c, 0x34,
-    0xa2, 0x40, 0xff, 0xff, 0x80, 0x3, 0x43, 0x4a,
-    0x0, 0x28, 0xd, 0xf4, 0x0, 0x0, 0x0, 0x0,
-
-    /* U+566A "噪" */
-    0x0, 0x7, 0xff, 0x83, 0xfc, 0x1c, 0xe, 0xe,
-    0x70, 0x75, 0x78, 0x34, 0xc0, 0xaa, 0x90, 0xd3,
-    0x7f, 0xcf, 0xf3, 0x4d, 0xd3, 0x71, 0xcd, 0x37,
-    0xd, 0xc3, 0x34, 0xdf, 0xf7, 0xfc, 0xe3, 0x0,
-    0x30, 0x3, 0xfe, 0xff, 0xff, 0xde, 0x51, 0x6f,
-    0xe5, 0x14, 0x2, 0xee, 0xd0, 0x0, 0xbc, 0x31,
-    0xf0, 0x2, 0x40, 0xc0, 0x40,
-
-    /* U+591C "夜" */
-    0x0, 0x2, 0x40, 0x0, 0x0, 0x3, 0xc0, 0x0,
-    0x3f, 0xff, 0xff, 0xfc, 0x15, 0xe5, 0xb9, 0x54,
-    0x0, 0xe0, 0xb0, 0x0, 0x2, 0xc0, 0xff, 0xf8,
-    0x7, 0x83, 0xd5, 0x74, 0xf, 0x4b, 0x68, 0x70,
-    0x3f, 0x6f, 0x8d, 0xe0, 0x33, 0x65, 0xd2, 0xc0,
-    0x3, 0x40, 0xbb, 0x40, 0x3, 0x40, 0x3e, 0x0,
-    0x3, 0x41, 0xff, 0x80, 0x3, 0x5f, 0xc2, 0xf8,
-    0x3, 0x5d, 0x0, 0x2c, 0x0, 0x0, 0x0, 0x0,
-
-    /* U+5927 "大" */
-    0x0, 0x3, 0xc0, 0x0, 0x0, 0x3, 0xc0, 0x0,
-    0x0, 0x3, 0xc0, 0x0, 0x0, 0x3, 0x80, 0x0,
-    0x0, 0x3, 0x80, 0x0, 0x3f, 0xff, 0xff, 0xfc,
-    0x2a, 0xab, 0xea, 0xa8, 0x0, 0xb, 0xe0, 0x0,
-    0x0, 0xf, 0xb0, 0x0, 0x0, 0x1d, 0x78, 0x0,
-    0x0, 0x3c, 0x2c, 0x0, 0x0, 0xf4, 0xf, 0x0,
-    0x3, 0xd0, 0x7, 0xc0, 0x1f, 0x80, 0x1, 0xf8,
-    0x3d, 0x0, 0x0, 0x3c, 0x0, 0x0, 0x0, 0x0,
-
-    /* U+592A "太" */
-    0x0, 0x3, 0xc0, 0x0, 0x0, 0x3, 0xc0, 0x0,
-    0x0, 0x3, 0x80, 0x0, 0x0, 0x3, 0x80, 0x0,
-    0x2a, 0xab, 0xea, 0xa8, 0x3f, 0xff, 0xff, 0xfc,
-    0x0, 0x7, 0xe0, 0x0, 0x0, 0xb, 0xf0, 0x0,
-    0x0, 0xe, 0x74, 0x0, 0x0, 0x1d, 0x3c, 0x0,
-    0x0, 0x3c, 0x1e, 0x0, 0x0, 0xfd, 0xb, 0x40,
-    0x3, 0xdf, 0x43, 0xd0, 0x2f, 0x43, 0xd0, 0xf8,
-    0x3c, 0x0, 0xd0, 0x2c, 0x0, 0x0, 0x0, 0x0,
-
-    /* U+5934 "头" */
-    0x0, 0x0, 0xb0, 0x0, 0x3, 0xe0, 0xb0, 0x0,
-    0x0, 0x7c, 0xb0, 0x0, 0x0, 0x8, 0xb0, 0x0,
-    0xe, 0x0, 0xb0, 0x0, 0x7, 0xe0, 0xe0, 0x0,
-    0x0, 0xa0, 0xe0, 0x0, 0x15, 0x55, 0xe5, 0x54,
-    0x3f, 0xff, 0xff, 0xfc, 0x0, 0x3, 0xc0, 0x0,
-    0x0, 0x7, 0x90, 0x0, 0x0, 0xf, 0x3d, 0x0,
-    0x0, 0xbc, 0xb, 0xd0, 0xb, 0xe0, 0x0, 0xf8,
-    0x3e, 0x40, 0x0, 0x28, 0x0, 0x0, 0x0, 0x0,
-
-    /* U+5BFF "寿" */
-    0x0, 0x2, 0x0, 0x0, 0x5, 0x5b, 0x95, 0x50,
-    0x1f, 0xff, 0xff, 0xf4, 0x0, 0xb, 0x0, 0x0,
-    0xb, 0xff, 0xff, 0xe0, 0x1, 0x6e, 0x55, 0x40,
-    0x15, 0x6d, 0x55, 0x54, 0x3f, 0xff, 0xff, 0xfc,
-    0x0, 0xb0, 0x2, 0x0, 0x0, 0xf5, 0x5b, 0x94,
-    0x3, 0xef, 0xff, 0xf8, 0xf, 0x18, 0x3, 0x40,
-    0x3c, 0x1e, 0x3, 0x40, 0x0, 0x6, 0x1b, 0x40,
-    0x0, 0x0, 0x3f, 0x0, 0x0, 0x0, 0x0, 0x0,
-
-    /* U+5C0F "小" */
-    0x0, 0x2, 0xc0, 0x0, 0x0, 0x2, 0xc0, 0x0,
-    0x0, 0x2, 0xc0, 0x0, 0x0, 0x2, 0xc0, 0x0,
-    0x3, 0x82, 0xc2, 0xc0, 0x7, 0x42, 0xc0, 0xe0,
-    0xb, 0x2, 0xc0, 0xb0, 0xf, 0x2, 0xc0, 0x78,
-    0x1e, 0x2, 0xc0, 0x3c, 0x3c, 0x2, 0xc0, 0x2d,
-    0x38, 0x2, 0xc0, 0xe, 0x0, 0x2, 0xc0, 0x8,
-    0x0, 0x2, 0xc0, 0x0, 0x0, 0x5b, 0xc0, 0x0,
-    0x0, 0x7f, 0x40, 0x0, 0x0, 0x0, 0x0, 0x0,
-
-    /* U+5C3E "尾" */
-    0xf, 0xff, 0xff, 0xf0, 0xe, 0x55, 0x55, 0xb0,
-    0xe, 0x0, 0x0, 0x70, 0xf, 0xff, 0xff, 0xf0,
-    0xe, 0x55, 0x6f, 0x50, 0xe, 0x6b, 0xf9, 0x0,
-    0xd, 0x66, 0xc0, 0x40, 0xd, 0x6, 0xff, 0xd0,
-    0xd, 0xff, 0xe4, 0x0, 0x1c, 0x1, 0xea, 0xf8,
-    0x2c, 0xbf, 0xfa, 0x50, 0x3c, 0xa5, 0xc0, 0x18,
-    0x38, 0x0, 0xe5, 0x7c, 0x70, 0x0, 0xbf, 0xf4,
-    0x0, 0x0, 0x0, 0x0,
-
-    /* U+5C71 "山" */
-    0x0, 0xe, 0x0, 0x0, 0x0, 0xe0, 0x0, 0x0,
-    0xe, 0x0, 0x1, 0x0, 0xe0, 0x4, 0x70, 0xe,
-    0x0, 0xe7, 0x0, 0xe0, 0xe, 0x70, 0xe, 0x0,
-    0xe7, 0x0, 0xe0, 0xe, 0x70, 0xe, 0x0, 0xe7,
-    0x0, 0xe0, 0xe, 0x70, 0xe, 0x0, 0xe7, 0x0,
-    0xe0, 0xe, 0x7a, 0xaf, 0xaa, 0xe7, 0xff, 0xff,
-    0xfe, 0x0, 0x0, 0x0, 0xe0,
-
-    /* U+5E26 "带" */
-    0x3, 0x83, 0x83, 0x80, 0x3, 0x83, 0x83, 0x80,
-    0x3f, 0xff, 0xff, 0xfc, 0x17, 0xd7, 0xd7, 0xd4,
-    0x2, 0x83, 0x83, 0x80, 0x15, 0x55, 0x55, 0x50,
-    0x3f, 0xff, 0xff, 0xfc, 0x38, 0x3, 0x80, 0x3c,
-    0x39, 0x57, 0x95, 0x7c, 0x7, 0xff, 0xff, 0xd0,
-    0x3, 0x43, 0x81, 0xd0, 0x3, 0x43, 0x81, 0xd0,
-    0x3, 0x43, 0x86, 0xd0, 0x3, 0x43, 0x8f, 0x80,
-    0x0, 0x3, 0x80, 0x0,
-
-    /* U+6076 "恶" */
-    0x1f, 0xff, 0xff, 0xf4, 0xa, 0xbe, 0xba, 0xa4,
-    0x1, 0x1c, 0x30, 0x90, 0x7, 0x1c, 0x30, 0xd0,
-    0x3, 0x9c, 0x32, 0xc0, 0x1, 0x5c, 0x32, 0x0,
-    0x2a, 0xae, 0xba, 0xa8, 0x3f, 0xff, 0xff, 0xfc,
-    0x0, 0x7, 0x0, 0x0, 0x9, 0xd3, 0xc0, 0xe0,
-    0xd, 0xe0, 0xe0, 0xb0, 0x1c, 0xe0, 0x3, 0x78,
-    0x38, 0xf5, 0x5b, 0x2c, 0x10, 0x7f, 0xfe, 0x0,
-
-    /* U+6234 "戴" */
-    0x0, 0x70, 0x1c, 0x40, 0x0, 0x74, 0x1d, 0xd0,
-    0xf, 0xff, 0xdc, 0xb0, 0x0, 0x70, 0x1c, 0x20,
-    0x3f, 0xff, 0xff, 0xfc, 0x1a, 0xaa, 0x9d, 0x0,
-    0x1d, 0xb6, 0xcd, 0x34, 0x1e, 0xfb, 0xcd, 0x34,
-    0x1d, 0xb6, 0xce, 0x70, 0x7, 0x9e, 0x4b, 0xe0,
-    0x2f, 0xff, 0xc7, 0xc0, 0x17, 0x9e, 0x47, 0x80,
-    0x2b, 0xae, 0x9b, 0x8c, 0xb, 0x4e, 0x3e, 0xec,
-    0x2c, 0x2, 0x20, 0xb8, 0x0, 0x0, 0x0, 0x0,
-
-    /* U+62DF "拟" */
-    0x7, 0x0, 0x0, 0x0, 0x7, 0xb, 0x0, 0x34,
-    0x7, 0xb, 0x70, 0x74, 0x1b, 0x4b, 0x34, 0x70,
-    0x7f, 0xdb, 0x3c, 0x70, 0xb, 0xb, 0x1c, 0x70,
-    0x7, 0xb, 0xd, 0xb0, 0x7, 0x4b, 0x0, 0xe0,
-    0x2f, 0xdb, 0x0, 0xe0, 0x7f, 0xb, 0x15, 0xf0,
-    0x7, 0xb, 0xba, 0xf4, 0x7, 0xb, 0xd3, 0xac,
-    0x7, 0xf, 0xf, 0x1d, 0x1b, 0x4, 0x3d, 0xe,
-    0x3d, 0x0, 0x24, 0x4,
-
-    /* U+6363 "捣" */
-    0x0, 0x0, 0x0, 0x0, 0x7, 0x0, 0x38, 0x0,
-    0x7, 0x1, 0xb9, 0x50, 0x7, 0x7, 0xff, 0xf0,
-    0x1b, 0x47, 0x0, 0xa0, 0x7f, 0xe7, 0x74, 0xa0,
-    0x7, 0x7, 0x1c, 0xe0, 0x7, 0x7, 0x3, 0xd0,
-    0x7, 0x57, 0x55, 0x54, 0x1f, 0xe7, 0xff, 0xfd,
-    0x7f, 0x0, 0x40, 0xd, 0x7, 0x8, 0xd2, 0xc,
-    0x7, 0x1c, 0xd3, 0xc, 0x7, 0x1e, 0xeb, 0x1c,
-    0x1b, 0xa, 0xab, 0x2c, 0x3e, 0x0, 0x3, 0xf4,
-    0x0, 0x0, 0x0, 0x0,
-
-    /* U+6587 "文" */
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x3, 0xc0, 0x0,
-    0x0, 0x1, 0xd0, 0x0, 0x2a, 0xaa, 0xea, 0xa8,
-    0x3f, 0xff, 0xff, 0xfd, 0x1, 0xc0, 0x3, 0xc0,
-    0x0, 0xe0, 0x7, 0x40, 0x0, 0x74, 0xf, 0x0,
-    0x0, 0x3c, 0x2d, 0x0, 0x0, 0xf, 0x78, 0x0,
-    0x0, 0x7, 0xf0, 0x0, 0x0, 0xb, 0xf0, 0x0,
-    0x0, 0x7e, 0x7e, 0x0, 0x7, 0xf4, 0xb, 0xe4,
-    0x3f, 0x40, 0x1, 0xbd, 0x10, 0x0, 0x0, 0x4,
-
-    /* U+6591 "斑" */
-    0x0, 0x0, 0x0, 0x0, 0x15, 0x4b, 0x5, 0x54,
-    0xbf, 0xc3, 0x4f, 0xfc, 0xd, 0x17, 0x51, 0xc0,
-    0xd, 0x3f, 0xf1, 0xc0, 0xd, 0x0, 0xd1, 0xc0,
-    0x1e, 0x78, 0xc1, 0xc0, 0x7f, 0x8e, 0xcf, 0xf8,
-    0xd, 0xb, 0xc6, 0xd4, 0xd, 0x3, 0x81, 0xc0,
-    0xd, 0x7, 0xc1, 0xc0, 0xe, 0xcf, 0xd1, 0xc0,
-    0xbf, 0x9c, 0xd1, 0xc0, 0x60, 0x38, 0x2b, 0xe8,
-    0x0, 0x70, 0x2a, 0xa8, 0x0, 0x0, 0x0, 0x0,
-
-    /* U+65B0 "新" */
-    0x1, 0x40, 0x0, 0x0, 0x1, 0xc0, 0x6, 0xf8,
-    0x3f, 0xff, 0x7e, 0x40, 0x1d, 0x5d, 0x70, 0x0,
-    0xe, 0x2c, 0x70, 0x0, 0x1f, 0x7d, 0x75, 0x54,
-    0x7f, 0xff, 0xbf, 0xfe, 0x0, 0xc0, 0x70, 0xb0,
-    0x15, 0xe5, 0x70, 0xb0, 0x3f, 0xff, 0x70, 0xb0,
-    0x4, 0xd4, 0x70, 0xb0, 0x1c, 0xdd, 0xb0, 0xb0,
-    0x34, 0xc7, 0xe0, 0xb0, 0x11, 0xc1, 0xc0, 0xb0,
-    0x7, 0xc0, 0x80, 0xb0,
-
-    /* U+65E5 "日" */
-    0xbf, 0xff, 0xfc, 0xba, 0xaa, 0xbc, 0xb0, 0x0,
-    0x2c, 0xb0, 0x0, 0x2c, 0xb0, 0x0, 0x2c, 0xb0,
-    0x0, 0x2c, 0xbf, 0xff, 0xfc, 0xba, 0xaa, 0xbc,
-    0xb0, 0x0, 0x2c, 0xb0, 0x0, 0x2c, 0xb0, 0x0,
-    0x2c, 0xb5, 0x55, 0x7c, 0xbf, 0xff, 0xfc, 0xb0,
-    0x0, 0x2c, 0x0, 0x0, 0x0,
-
-    /* U+666E "普" */
-    0x0, 0x40, 0x0, 0x0, 0x0, 0xe0, 0xb, 0x0,
-    0xa, 0xfa, 0xaf, 0xa4, 0xb, 0xbf, 0xfe, 0xe4,
-    0x7, 0x1c, 0x34, 0xd0, 0x3, 0x9c, 0x36, 0x80,
-    0x2b, 0xbe, 0xbf, 0xe8, 0x2a, 0xaa, 0xaa, 0xa8,
-    0x0, 0x0, 0x0, 0x0, 0x3, 0xff, 0xff, 0xc0,
-    0x3, 0x40, 0x1, 0xc0, 0x3, 0xff, 0xff, 0xc0,
-    0x3, 0x80, 0x2, 0xc0, 0x3, 0x95, 0x56, 0xc0,
-    0x3, 0xff, 0xff, 0xc0, 0x0, 0x0, 0x0, 0x0,
-
-    /* U+6697 "暗" */
-    0x0, 0x0, 0x20, 0x1, 0xa9, 0x0, 0xd0, 0xb,
-    0xf9, 0xff, 0xff, 0x28, 0xa1, 0xd5, 0xb4, 0xa2,
-    0x83, 0x43, 0x82, 0x8a, 0x5e, 0x5e, 0x4b, 0xfb,
-    0xff, 0xff, 0x6d, 0xe0, 0x0, 0x0, 0xa2, 0x8f,
-    0xff, 0xd2, 0x8a, 0x39, 0x57, 0x4a, 0x28, 0xe0,
-    0xd, 0x2f, 0xe3, 0xff, 0xf4, 0xb5, 0x4d, 0x0,
-    0xd1, 0x40, 0x39, 0x57, 0x40, 0x0, 0xff, 0xfd,
-    0x0, 0x0, 0x0, 0x0,
-
-    /* U+6728 "木" */
-    0x0, 0x3, 0x80, 0x0, 0x0, 0x3, 0x80, 0x0,
-    0x0, 0x3, 0x80, 0x0, 0x0, 0x3, 0x80, 0x0,
-    0x2a, 0xab, 0xea, 0xa4, 0x3f, 0xff, 0xff, 0xfc,
-    0x0, 0xf, 0xe0, 0x0, 0x0, 0x2f, 0xf4, 0x0,
-    0x0, 0x77, 0xac, 0x0, 0x1, 0xe3, 0x8f, 0x0,
-    0x7, 0xc3, 0x83, 0xc0, 0x2f, 0x3, 0x80, 0xf4,
-    0x78, 0x3, 0x80, 0x3c, 0x10, 0x3, 0x80, 0x0,
-    0x0, 0x3, 0x80, 0x0,
-
-    /* U+672C "本" */
-    0x0, 0x3, 0x80, 0x0, 0x0, 0x3, 0x80, 0x0,
-    0x0, 0x3, 0x80, 0x0, 0x0, 0x3, 0x80, 0x0,
-    0x3f, 0xff, 0xff, 0xfc, 0x2a, 0xbf, 0xfa, 0xa4,
-    0x0, 0x37, 0xac, 0x0, 0x0, 0xb3, 0x8d, 0x0,
-    0x1, 0xd3, 0x8b, 0x0, 0x3, 0x83, 0x83, 0xc0,
-    0xf, 0x3, 0x81, 0xf0, 0x7e, 0xff, 0xff, 0xbc,
-    0x21, 0xab, 0xea, 0x14, 0x0, 0x3, 0x80, 0x0,
-    0x0, 0x3, 0x80, 0x0,
-
-    /* U+6765 "来" */
-    0x0, 0x3, 0x80, 0x0, 0x0, 0x3, 0x80, 0x0,
-    0x1a, 0xab, 0xea, 0xa0, 0x1f, 0xff, 0xff, 0xf4,
-    0x2, 0x43, 0x81, 0x80, 0x3, 0xc3, 0x83, 0xc0,
-    0x1, 0xd3, 0x87, 0x40, 0x15, 0xd7, 0xdb, 0x54,
-    0x7f, 0xff, 0xff, 0xfc, 0x0, 0x1f, 0xf0, 0x0,
-    0x0, 0x7b, 0xac, 0x0, 0x2, 0xe3, 0x8f, 0x40,
-    0x1f, 0x43, 0x82, 0xe0, 0x7c, 0x3, 0x80, 0x7c,
-    0x0, 0x3, 0x80, 0x0,
-
-    /* U+677E "松" */
-    0x3, 0x40, 0x0, 0x40, 0x3, 0x40, 0xb2, 0xc0,
-    0x3, 0x40, 0xe0, 0xd0, 0x3, 0x80, 0xd0, 0xe0,
-    0x7f, 0xf6, 0xc0, 0xb0, 0x7, 0x83, 0x80, 0x38,
-    0xb, 0xcb, 0x1d, 0x2c, 0xf, 0xe5, 0x2c, 0x4,
-    0xf, 0xb4, 0x38, 0x0, 0x2b, 0x64, 0x70, 0x80,
-    0x73, 0x40, 0xf0, 0xe0, 0x23, 0x41, 0xd0, 0xb0,
-    0x3, 0x43, 0xd6, 0xb8, 0x3, 0x47, 0xff, 0xbc,
-    0x3, 0x41, 0x40, 0x14,
-
-    /* U+6797 "林" */
-    0x1, 0xc0, 0x7, 0x0, 0x1, 0xc0, 0x7, 0x0,
-    0x1, 0xc0, 0x7, 0x0, 0x2, 0xc0, 0xb, 0x0,
-    0x3f, 0xfd, 0xff, 0xfc, 0x17, 0xd4, 0x5f, 0x94,
-    0x3, 0xf0, 0xf, 0xc0, 0x7, 0xfc, 0x2f, 0xc0,
-    0xf, 0xcd, 0x3f, 0xe0, 0x2d, 0xc4, 0xb7, 0x70,
-    0x75, 0xc1, 0xd7, 0x3c, 0x31, 0xc3, 0x87, 0x1c,
-    0x1, 0xc1, 0x7, 0x0, 0x1, 0xc0, 0x7, 0x0,
-    0x1, 0xc0, 0x7, 0x0,
-
-    /* U+6B21 "次" */
-    0x0, 0x1, 0x40, 0x0, 0x0, 0x3, 0x80, 0x0,
-    0x3d, 0x7, 0x40, 0x0, 0xb, 0x8b, 0xff, 0xf8,
-    0x2, 0xf, 0xaa, 0xbc, 0x0, 0x2c, 0x34, 0x34,
-    0x0, 0x3c, 0x38, 0xb0, 0x0, 0x20, 0x38, 0xa0,
-    0x2, 0x80, 0x7c, 0x0, 0x3, 0x80, 0xbc, 0x0,
-    0xf, 0x0, 0xfe, 0x0, 0x2d, 0x2, 0xd7, 0x40,
-    0x3c, 0xb, 0x83, 0xd0, 0x10, 0x3e, 0x0, 0xf8,
-    0x0, 0xb4, 0x0, 0x2c, 0x0, 0x0, 0x0, 0x0,
-
-    /* U+6C34 "水" */
-    0x0, 0x2, 0xc0, 0x0, 0x0, 0x2, 0xc0, 0x0,
-    0x0, 0x2, 0xc0, 0x0, 0x0, 0x2, 0xc0, 0x10,
-    0x15, 0x52, 0xc0, 0xf0, 0x3f, 0xf6, 0xd2, 0xd0,
-    0x0, 0x72, 0xfb, 0x40, 0x0, 0xb2, 0xfd, 0x0,
-    0x0, 0xe2, 0xdd, 0x0, 0x2, 0xc2, 0xcb, 0x0,
-    0x7, 0x82, 0xc3, 0xd0, 0x1f, 0x2, 0xc0, 0xf8,
-    0x3c, 0x2, 0xc0, 0x2d, 0x0, 0x2b, 0xc0, 0x0,
-    0x0, 0x2f, 0x40, 0x0,
-
-    /* U+6C60 "池" */
-    0x8, 0x0, 0x1c, 0x0, 0x1f, 0x84, 0x1c, 0x0,
-    0x2, 0x8e, 0x1c, 0x0, 0x0, 0xe, 0x1c, 0xb8,
-    0x0, 0xe, 0x2f, 0xf8, 0x78, 0xf, 0xfe, 0x38,
-    0x2f, 0x2f, 0xac, 0x38, 0x1, 0x7e, 0x1c, 0x38,
-    0x0, 0xe, 0x1c, 0x38, 0x1, 0x4e, 0x1d, 0x74,
-    0x3, 0x8e, 0x1d, 0xf0, 0xb, 0xe, 0x0, 0x8,
-    0xe, 0xe, 0x0, 0x1c, 0x2c, 0xf, 0x55, 0x7c,
-    0x14, 0x7, 0xff, 0xf4,
-
-    /* U+7070 "灰" */
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x70, 0x0, 0x0,
-    0x0, 0xb0, 0x0, 0x0, 0x1a, 0xfa, 0xaa, 0xa4,
-    0x3f, 0xff, 0xff, 0xfc, 0x0, 0xe0, 0x10, 0x0,
-    0x0, 0xe0, 0x38, 0x0, 0x1, 0xd0, 0x38, 0x10,
-    0x2, 0xcb, 0x38, 0xb0, 0x3, 0xce, 0x38, 0xd0,
-    0x3, 0x8c, 0x78, 0x80, 0xb, 0x0, 0xbd, 0x0,
-    0x1e, 0x0, 0xeb, 0x0, 0x3c, 0x3, 0xc3, 0xc0,
-    0x24, 0x1f, 0x40, 0xf0, 0x0, 0x7d, 0x0, 0x3c,
-    0x0, 0x10, 0x0, 0x0,
-
-    /* U+71D5 "燕" */
-    0x0, 0x34, 0x28, 0x0, 0x15, 0x79, 0x7d, 0x54,
-    0x7f, 0xff, 0xff, 0xfd, 0x0, 0x34, 0x28, 0x0,
-    0x0, 0x3f, 0xf9, 0x0, 0x3, 0x80, 0x3, 0x40,
-    0x3f, 0x9f, 0xf3, 0xbc, 0x3, 0x9c, 0x73, 0xd0,
-    0x3, 0x9c, 0x33, 0x44, 0x2f, 0x9d, 0xb3, 0x8c,
-    0x37, 0x9a, 0xa2, 0xfc, 0x1, 0x0, 0x0, 0x50,
-    0xe, 0x2c, 0x34, 0xf0, 0x2c, 0x1c, 0x38, 0x38,
-    0x38, 0x1c, 0x2c, 0x2d, 0x0, 0x0, 0x0, 0x0,
-
-    /* U+72D7 "狗" */
-    0x0, 0x0, 0x40, 0x0, 0xe3, 0x87, 0x0, 0x0,
-    0xfc, 0x2c, 0x0, 0x2, 0xe0, 0xff, 0xff, 0x2f,
-    0x8b, 0x0, 0x2c, 0xeb, 0x74, 0x0, 0xb0, 0x1d,
-    0xff, 0xf2, 0xc0, 0xf5, 0xd6, 0xcb, 0xb, 0xd7,
-    0x7, 0x2c, 0xbb, 0x5c, 0x1c, 0xe3, 0x8d, 0x7f,
-    0xf3, 0x80, 0x31, 0xd5, 0x4e, 0x1, 0xc2, 0x0,
-    0x34, 0x5f, 0x0, 0x16, 0xd2, 0xf4, 0x0, 0x7e,
-    0x0, 0x0, 0x0, 0x0,
-
-    /* U+73E0 "珠" */
-    0x0, 0x0, 0xd, 0x0, 0x7f, 0xf2, 0xcd, 0x0,
-    0x7f, 0xf3, 0x8d, 0x0, 0x7, 0x3, 0x9e, 0x54,
-    0x7, 0x3, 0xff, 0xf8, 0x7, 0xb, 0xd, 0x0,
-    0x2f, 0xa9, 0xd, 0x0, 0x2f, 0xe5, 0x5e, 0x54,
-    0x7, 0xf, 0xff, 0xfd, 0x7, 0x0, 0x3f, 0x40,
-    0x7, 0x0, 0xbf, 0xc0, 0xb, 0xf2, 0xcd, 0xb0,
-    0x7f, 0x9b, 0x4d, 0x3c, 0x10, 0x2d, 0xd, 0xd,
-    0x0, 0x0, 0xd, 0x0,
-
-    /* U+7435 "琵" */
-    0x3f, 0xfe, 0xff, 0xfc, 0x2b, 0xe9, 0xaf, 0xe8,
-    0x6, 0xd4, 0x17, 0x50, 0x2f, 0xfd, 0x7f, 0xf8,
-    0x1, 0xc0, 0x3, 0x40, 0x2b, 0xe9, 0xaf, 0xe8,
-    0x15, 0x55, 0xaa, 0xa8, 0xd, 0x0, 0xb0, 0x0,
-    0xe, 0x54, 0xb0, 0xb4, 0xf, 0xfe, 0xbb, 0xe0,
-    0xe, 0x0, 0xb8, 0x0, 0xe, 0x0, 0xb0, 0xd,
-    0xf, 0xbe, 0xb5, 0x6c, 0x1f, 0xa4, 0x3f, 0xf8,
-    0x0, 0x0, 0x0, 0x0,
-
-    /* U+767D "白" */
-    0x0, 0x14, 0x0, 0x0, 0x78, 0x0, 0x0, 0xb0,
-    0x0, 0xff, 0xff, 0xff, 0xf5, 0x55, 0x5f, 0xf0,
-    0x0, 0xb, 0xf0, 0x0, 0xb, 0xf0, 0x0, 0xf,
-    0xff, 0xff, 0xff, 0xf5, 0x55, 0x5f, 0xf0, 0x0,
-    0xb, 0xf0, 0x0, 0xb, 0xf5, 0x55, 0x5f, 0xff,
-    0xff, 0xff, 0xf0, 0x0, 0xf, 0x0, 0x0, 0x0,
-
-    /* U+7736 "眶" */
-    0xff, 0x9f, 0xff, 0xf7, 0xde, 0x75, 0x55, 0x4e,
-    0x29, 0xc0, 0x0, 0x39, 0xe7, 0x7f, 0xf8, 0xff,
-    0x9c, 0x5e, 0x43, 0x8a, 0x70, 0x34, 0xe, 0x29,
-    0xcf, 0xfd, 0x3f, 0xe7, 0x17, 0x90, 0xe7, 0x9c,
-    0xd, 0x3, 0x8a, 0x76, 0xbe, 0x8f, 0xf9, 0xda,
-    0xaa, 0x3e, 0x97, 0x0, 0x0, 0xe0, 0x1f, 0xff,
-    0xf4, 0x0, 0x15, 0x55, 0x40,
-
-    /* U+773C "眼" */
-    0xff, 0x8f, 0xff, 0xe3, 0x9e, 0x39, 0x57, 0x8e,
-    0x28, 0xe0, 0xe, 0x38, 0xe3, 0xff, 0xf8, 0xff,
-    0x8e, 0x55, 0xe3, 0x8a, 0x38, 0x3, 0x8e, 0x28,
-    0xff, 0xfe, 0x3f, 0xe3, 0x9e, 0x50, 0xe7, 0x8e,
-    0x2c, 0x73, 0x8a, 0x38, 0x7b, 0x8e, 0x78, 0xe0,
-    0xf4, 0x3f, 0xe3, 0x81, 0xd0, 0xe0, 0xf, 0xb2,
-    0xe1, 0x0, 0x7e, 0x42, 0xd0, 0x0, 0x40, 0x0,
-    0x0,
-
-    /* U+7D2B "紫" */
-    0x0, 0xb0, 0x70, 0x0, 0x8, 0xb0, 0x70, 0x20,
-    0x1c, 0xbf, 0x7b, 0xf4, 0x1c, 0xb5, 0x7e, 0x0,
-    0x1c, 0xb1, 0x70, 0xd, 0x3f, 0xff, 0x7f, 0xfc,
-    0x69, 0x4b, 0x5, 0x50, 0x0, 0xbd, 0x6d, 0x0,
-    0x7, 0xff, 0xf5, 0x0, 0x0, 0x6e, 0x43, 0xc0,
-    0xb, 0xff, 0xff, 0xf0, 0xe, 0xa7, 0xd0, 0x3c,
-    0x1, 0xd2, 0xcb, 0x80, 0x1f, 0x46, 0xc1, 0xf4,
-    0x18, 0x1f, 0x80, 0x10, 0x0, 0x0, 0x0, 0x0,
-
-    /* U+7EA2 "红" */
-    0x1, 0x40, 0x0, 0x0, 0x3, 0xc1, 0x55, 0x54,
-    0x7, 0x47, 0xff, 0xfc, 0xf, 0x0, 0xf, 0x0,
-    0x2c, 0x38, 0xe, 0x0, 0x7e, 0xf0, 0xe, 0x0,
-    0x7f, 0xd0, 0xe, 0x0, 0x7, 0x80, 0xe, 0x0,
-    0xe, 0x0, 0xe, 0x0, 0x3f, 0xf4, 0xe, 0x0,
-    0x3e, 0x90, 0xe, 0x0, 0x0, 0x0, 0xe, 0x0,
-    0x1, 0xb0, 0xe, 0x0, 0x7f, 0xeb, 0xff, 0xfd,
-    0x24, 0x6, 0xaa, 0xa8,
-
-    /* U+7EDF "统" */
-    0x1, 0x0, 0x8, 0x0, 0x3, 0xc0, 0x1d, 0x0,
-    0x7, 0x41, 0x5e, 0x54, 0xf, 0xb, 0xff, 0xfc,
-    0x1c, 0x70, 0x78, 0x40, 0x3e, 0xe0, 0xf0, 0xe0,
-    0x7f, 0xc3, 0xd5, 0xb4, 0x7, 0x4f, 0xff, 0xbc,
-    0xe, 0x15, 0xd2, 0x48, 0x3f, 0xf0, 0xd3, 0x80,
-    0x39, 0x0, 0xd3, 0x80, 0x0, 0x11, 0xc3, 0x84,
-    0x1b, 0xf3, 0xc3, 0x8d, 0x7e, 0xf, 0x43, 0x9c,
-    0x10, 0x2d, 0x2, 0xf8, 0x0, 0x0, 0x0, 0x0,
-
-    /* U+7EE3 "绣" */
-    0x2, 0x40, 0x5, 0xa0, 0x3, 0x43, 0xff, 0xe0,
-    0xb, 0x0, 0xa, 0x0, 0xd, 0x1, 0x5e, 0x54,
-    0x2c, 0x37, 0xff, 0xfd, 0x75, 0xf0, 0x7f, 0xc0,
-    0x7f, 0xc2, 0xde, 0xb4, 0x3, 0x4b, 0x4e, 0x2c,
-    0xe, 0x2, 0xaa, 0x80, 0x2f, 0xf2, 0xba, 0xc0,
-    0x79, 0x0, 0xb2, 0xfc, 0x0, 0x10, 0xa1, 0x6c,
-    0x2b, 0xf0, 0xd0, 0x2c, 0x79, 0x7, 0xc0, 0x38,
-    0x0, 0xa, 0x2, 0xf0, 0x0, 0x0, 0x0, 0x0,
-
-    /* U+7EFF "绿" */
-    0x1, 0x0, 0x0, 0x0, 0x3, 0x43, 0xff, 0xf8,
-    0xb, 0x0, 0x55, 0x78, 0xe, 0x0, 0x55, 0x74,
-    0x1c, 0x51, 0xff, 0xf4, 0x38, 0xe0, 0x0, 0x34,
-    0x7f, 0xc7, 0xff, 0xfd, 0x17, 0x46, 0xaf, 0xa8,
-    0xe, 0x2, 0x4d, 0x18, 0x2f, 0xe1, 0xde, 0xb4,
-    0x39, 0x40, 0x6f, 0xc0, 0x0, 0x51, 0xff, 0xd0,
-    0x1b, 0xeb, 0x4d, 0x7c, 0x39, 0x0, 0x1d, 0x8,
-    0x0, 0x0, 0x3c, 0x0,
-
-    /* U+7F1D "缝" */
-    0x0, 0x0, 0x0, 0x0, 0x3, 0x48, 0xe, 0x0,
-    0xb, 0xd, 0x2f, 0xf8, 0xe, 0xa, 0xbc, 0xb0,
-    0x1c, 0x96, 0xb, 0xd0, 0x39, 0xd0, 0x2f, 0xe4,
-    0x7f, 0xef, 0xa5, 0x6c, 0x7, 0xb, 0x7f, 0xf8,
-    0xe, 0x7, 0x17, 0x90, 0x2f, 0xe7, 0x3f, 0xf4,
-    0x39, 0x47, 0x3, 0x40, 0x0, 0x7, 0xff, 0xfc,
-    0x1b, 0xeb, 0x3, 0x40, 0x7e, 0x2e, 0xe6, 0x54,
-    0x0, 0x30, 0x6f, 0xfc, 0x0, 0x0, 0x0, 0x0,
-
-    /* U+7FC5 "翅" */
-    0x3, 0x40, 0x0, 0x0, 0x3, 0x47, 0xff, 0xf8,
-    0x17, 0x95, 0x79, 0x78, 0x7f, 0xf9, 0x35, 0x38,
-    0x3, 0x43, 0x77, 0x78, 0x3, 0x41, 0xb5, 0xf8,
-    0x7f, 0xf4, 0x34, 0x38, 0x39, 0x74, 0x74, 0xb8,
-    0x28, 0x72, 0xfb, 0xf8, 0xc, 0xb7, 0x3a, 0x38,
-    0xe, 0xd0, 0x34, 0x38, 0x7, 0xc0, 0x74, 0x78,
-    0xb, 0xd2, 0xf2, 0xf4, 0x2d, 0xbe, 0x55, 0x54,
-    0x34, 0xb, 0xff, 0xfc, 0x0, 0x0, 0x0, 0x0,
-
-    /* U+7FE0 "翠" */
-    0x1f, 0xfd, 0xff, 0xf4, 0xa, 0xd, 0x38, 0x38,
-    0x7, 0xcd, 0x1f, 0x38, 0x6, 0xfd, 0x1b, 0xf8,
-    0x1e, 0x4d, 0xb9, 0x38, 0x0, 0x3, 0x80, 0x0,
-    0x1f, 0xff, 0xff, 0xfc, 0x0, 0x74, 0xf, 0x0,
-    0x0, 0xf4, 0x1f, 0x0, 0x7, 0x9d, 0xb6, 0xe0,
-    0x6, 0x2, 0xd0, 0x50, 0x3f, 0xff, 0xff, 0xfc,
-    0x0, 0x3, 0xc0, 0x0, 0x0, 0x3, 0xc0, 0x0,
-
-    /* U+7FE1 "翡" */
-    0x0, 0x1c, 0x70, 0x0, 0x2f, 0xfc, 0x7f, 0xf8,
-    0x0, 0x1c, 0x74, 0x0, 0x5, 0x6c, 0x75, 0x50,
-    0xf, 0xfc, 0x7f, 0xe0, 0x15, 0x6c, 0x75, 0x54,
-    0x3f, 0xfc, 0x7f, 0xfc, 0x0, 0x1c, 0x70, 0x0,
-    0x2f, 0xfd, 0xff, 0xf4, 0x9, 0x5d, 0x65, 0x74,
-    0xb, 0xd, 0x3c, 0x34, 0x1, 0x5d, 0x9, 0x74,
-    0x1b, 0xdd, 0x6f, 0x74, 0x38, 0xd, 0xa0, 0x34,
-    0x0, 0xfc, 0x3, 0xf0, 0x0, 0x0, 0x0, 0x0,
-
-    /* U+8033 "耳" */
-    0x3f, 0xff, 0xff, 0xfc, 0x3f, 0xff, 0xff, 0xfc,
-    0x2, 0xc0, 0x3, 0x80, 0x2, 0xc0, 0x3, 0x80,
-    0x2, 0xff, 0xff, 0x80, 0x2, 0xd5, 0x57, 0x80,
-    0x2, 0xc0, 0x3, 0x80, 0x2, 0xd5, 0x57, 0x80,
-    0x2, 0xff, 0xff, 0x80, 0x2, 0xc0, 0x3, 0x80,
-    0x2, 0xc0, 0x17, 0xe8, 0x3f, 0xff, 0xff, 0xfc,
-    0x3a, 0x95, 0x43, 0x80, 0x0, 0x0, 0x3, 0x80,
-
-    /* U+80DC "胜" */
-    0x0, 0x0, 0xe, 0x0, 0x2f, 0xf1, 0x8e, 0x0,
-    0x2d, 0xb2, 0xce, 0x0, 0x2c, 0x73, 0x8e, 0x0,
-    0x2c, 0xb3, 0xff, 0xfc, 0x2f, 0xf7, 0x5f, 0x54,
-    0x2c, 0xbe, 0xe, 0x0, 0x2c, 0x74, 0xe, 0x0,
-    0x2d, 0xb1, 0x5e, 0x50, 0x2f, 0xf3, 0xff, 0xf8,
-    0x28, 0x70, 0xe, 0x0, 0x38, 0x70, 0xe, 0x0,
-    0x34, 0x70, 0xe, 0x0, 0x31, 0xb6, 0xaf, 0xa8,
-    0x72, 0xeb, 0xff, 0xfd, 0x0, 0x0, 0x0, 0x0,
-
-    /* U+80F8 "胸" */
-    0x0, 0x0, 0x40, 0x0, 0x2f, 0xe1, 0xd0, 0x0,
-    0x2d, 0xe3, 0xea, 0xa8, 0x2c, 0xa7, 0xff, 0xfd,
-    0x2c, 0xff, 0x0, 0xd, 0x2f, 0xfd, 0x86, 0xd,
-    0x2c, 0xa7, 0xac, 0xcd, 0x2c, 0xa7, 0x38, 0xcd,
-    0x2d, 0xe7, 0x3c, 0xcd, 0x2f, 0xe7, 0x6d, 0xcd,
-    0x28, 0xa7, 0xc3, 0xcd, 0x38, 0xa7, 0x41, 0xcd,
-    0x34, 0xa7, 0xff, 0xdd, 0x71, 0xe0, 0x1, 0x6c,
-    0x23, 0xd0, 0x2, 0xf8, 0x0, 0x0, 0x0, 0x0,
-
-    /* U+811A "脚" */
-    0x0, 0x1, 0xc0, 0x0, 0x2f, 0xd1, 0xc3, 0xfd,
-    0x2d, 0xd1, 0xc3, 0x9d, 0x28, 0xdf, 0xf7, 0x4d,
-    0x28, 0xd6, 0xd3, 0x4d, 0x2f, 0xd1, 0xc3, 0x4d,
-    0x2d, 0xd1, 0xc3, 0x4d, 0x28, 0xef, 0xfb, 0x4d,
-    0x2d, 0xd7, 0x93, 0x4d, 0x2f, 0xd3, 0x63, 0x4d,
-    0x24, 0xd3, 0x33, 0x4d, 0x34, 0xdb, 0x77, 0xbc,
-    0x30, 0xdf, 0xfb, 0x54, 0x31, 0xd8, 0x7, 0x40,
-    0x23, 0xc0, 0x3, 0x40, 0x0, 0x0, 0x0, 0x0,
-
-    /* U+8138 "脸" */
-    0x0, 0x0, 0x8, 0x0, 0x2f, 0xe0, 0x2d, 0x0,
-    0x2d, 0xe0, 0x7f, 0x40, 0x28, 0xa0, 0xe2, 0xc0,
-    0x28, 0xa3, 0xc0, 0xf4, 0x2f, 0xff, 0x55, 0x7d,
-    0x2e, 0xfd, 0xff, 0xc8, 0x28, 0xa0, 0x0, 0x0,
-    0x2d, 0xe3, 0xc, 0x28, 0x2f, 0xe3, 0x4d, 0x34,
-    0x38, 0xa2, 0x8d, 0x70, 0x34, 0xa1, 0x85, 0xd0,
-    0x34, 0xa0, 0x1, 0xc0, 0x71, 0xef, 0xff, 0xfc,
-    0x63, 0xd5, 0x55, 0x54, 0x0, 0x0, 0x0, 0x0,
-
-    /* U+8170 "腰" */
-    0x2f, 0xef, 0xff, 0xfc, 0x2d, 0xda, 0xfb, 0xe8,
-    0x28, 0xd0, 0x73, 0x80, 0x28, 0xdb, 0xff, 0xf8,
-    0x2f, 0xda, 0x33, 0x28, 0x29, 0xda, 0x33, 0x28,
-    0x28, 0xdb, 0xff, 0xf8, 0x2d, 0xd1, 0x75, 0x50,
-    0x2f, 0xdf, 0xff, 0xfc, 0x34, 0xd6, 0xd5, 0xf4,
-    0x34, 0xd3, 0xc1, 0xd0, 0x30, 0xd1, 0xff, 0x80,
-    0x71, 0xd0, 0x7f, 0xe4, 0x63, 0xcf, 0xe0, 0x7c,
-    0x0, 0x0, 0x0, 0x0,
-
-    /* U+8179 "腹" */
-    0x0, 0x0, 0x50, 0x0, 0x1f, 0xf0, 0xe0, 0x0,
-    0x1d, 0xf2, 0xff, 0xfc, 0x1c, 0xb7, 0x80, 0x0,
-    0x1c, 0xbf, 0xff, 0xf4, 0x1f, 0xf2, 0xc0, 0x38,
-    0x1c, 0xb1, 0xff, 0xf8, 0x1c, 0xb1, 0xc0, 0x38,
-    0x2d, 0xf1, 0xff, 0xf4, 0x2f, 0xf0, 0x78, 0x0,
-    0x28, 0xb1, 0xff, 0xf4, 0x38, 0xbb, 0xf1, 0xe0,
-    0x34, 0xb5, 0x3f, 0x80, 0x31, 0xf6, 0xff, 0xe4,
-    0x63, 0xdb, 0x90, 0x7c, 0x0, 0x0, 0x0, 0x0,
-
-    /* U+82C7 "苇" */
-    0x2, 0xc0, 0x38, 0x0, 0xb, 0x0, 0xe0, 0xf,
-    0xff, 0xff, 0xff, 0x0, 0xb0, 0xe, 0x0, 0x0,
-    0x4e, 0x10, 0x0, 0xff, 0xff, 0xff, 0x41, 0x55,
-    0xe5, 0x54, 0x1, 0x57, 0x95, 0x40, 0x1f, 0xff,
-    0xff, 0x40, 0x0, 0x38, 0x0, 0xb, 0xff, 0xff,
-    0xff, 0x15, 0x57, 0x95, 0x7c, 0x0, 0xe, 0x0,
-    0xe0, 0x0, 0x38, 0x3f, 0x40, 0x0, 0xe0, 0x50,
-    0x0,
-
-    /* U+82CD "苍" */
-    0x0, 0xe0, 0xe, 0x0, 0x0, 0xe0, 0xe, 0x0,
-    0x7f, 0xff, 0xff, 0xfc, 0x15, 0xf6, 0x9f, 0x54,
-    0x0, 0x93, 0xca, 0x0, 0x0, 0x1f, 0xf0, 0x0,
-    0x1, 0xf8, 0x3e, 0x40, 0x2f, 0xd0, 0x7, 0xf8,
-    0x3a, 0xff, 0xff, 0x28, 0x2, 0xd5, 0x5e, 0x0,
-    0x2, 0xc0, 0xe, 0x0, 0x2, 0xc1, 0xfd, 0x0,
-    0x2, 0xc0, 0x50, 0xe0, 0x1, 0xe5, 0x56, 0xd0,
-    0x0, 0xbf, 0xff, 0x80,
-
-    /* U+82E6 "苦" */
-    0x0, 0xe0, 0xd, 0x0, 0x3, 0x80, 0x34, 0x3,
-    0xff, 0xff, 0xff, 0xc5, 0x7d, 0x57, 0x95, 0x0,
-    0xe2, 0x4d, 0x0, 0x0, 0xe, 0x0, 0x3, 0xff,
-    0xff, 0xff, 0xc5, 0x55, 0xf5, 0x55, 0x0, 0x3,
-    0x80, 0x0, 0x1f, 0xff, 0xff, 0x40, 0x7a, 0xaa,
-    0xad, 0x1, 0xc0, 0x0, 0x34, 0x7, 0x0, 0x0,
-    0xd0, 0x1f, 0xff, 0xff, 0x40, 0x75, 0x55, 0x6d,
-    0x0, 0x0, 0x0, 0x0,
-
-    /* U+83BA "莺" */
-    0x0, 0xb0, 0xe, 0x0, 0x15, 0xb5, 0x5e, 0x54,
-    0x3f, 0xff, 0xff, 0xfc, 0x0, 0x70, 0xd, 0x0,
-    0x2f, 0xff, 0xff, 0xfc, 0x28, 0x3, 0x40, 0x2c,
-    0x2b, 0xff, 0xff, 0xe8, 0x3, 0x8d, 0x1, 0xc0,
-    0x3, 0x8b, 0x82, 0xc0, 0x3, 0x80, 0x8f, 0x40,
-    0x3, 0xff, 0xff, 0xf8, 0x0, 0x0, 0x0, 0x28,
-    0x3f, 0xff, 0xfe, 0x28, 0x15, 0x55, 0x55, 0x34,
-    0x0, 0x0, 0x7, 0xf0,
-
-    /* U+84DD "蓝" */
-    0x0, 0xb0, 0xe, 0x0, 0x3f, 0xff, 0xff, 0xfc,
-    0x15, 0xb5, 0x5e, 0x54, 0x0, 0x10, 0x14, 0x0,
-    0x8, 0x34, 0x34, 0x0, 0xd, 0x34, 0x7f, 0xf8,
-    0xd, 0x34, 0xe6, 0x50, 0xd, 0x36, 0xc3, 0x40,
-    0xd, 0x35, 0x42, 0xc0, 0x0, 0x20, 0x0, 0x80,
-    0xb, 0xff, 0xff, 0xe0, 0xb, 0x5d, 0x75, 0xe0,
-    0xb, 0xc, 0x34, 0xe0, 0x1b, 0x6d, 0x79, 0xf4,
-    0x7f, 0xff, 0xff, 0xfd,
-
-    /* U+86C7 "蛇" */
-    0x0, 0x0, 0x0, 0x0, 0x2, 0xc0, 0xb, 0x0,
-    0x2, 0xc0, 0x7, 0x0, 0x2, 0xc0, 0x7, 0x40,
-    0x1b, 0xea, 0xff, 0xfd, 0x2f, 0xee, 0xc0, 0xd,
-    0x25, 0x8d, 0xd0, 0xd, 0x25, 0x8c, 0x34, 0x0,
-    0x25, 0x8c, 0x34, 0x38, 0x2f, 0xfc, 0x36, 0xf0,
-    0x2a, 0xd4, 0x3f, 0x40, 0x2, 0xd8, 0x34, 0x0,
-    0x2, 0xcc, 0x34, 0x4, 0x17, 0xfe, 0x34, 0xa,
-    0x3f, 0xab, 0x39, 0x5e, 0x0, 0x0, 0x2f, 0xfc,
-
-    /* U+86CB "蛋" */
-    0x0, 0x0, 0x0, 0x0, 0xf, 0xff, 0xff, 0xfc,
-    0xa, 0xab, 0xea, 0xbc, 0x0, 0xc2, 0xd5, 0x74,
-    0x2, 0xc2, 0xff, 0x90, 0x7, 0xbb, 0xd5, 0x54,
-    0x2d, 0xb, 0xff, 0xfd, 0x34, 0x1, 0xc0, 0x0,
-    0x7, 0xff, 0xff, 0xf0, 0xb, 0x56, 0xd5, 0xb0,
-    0xb, 0x2, 0xc0, 0xb0, 0x7, 0xff, 0xff, 0xf0,
-    0x0, 0x2, 0xc3, 0xc0, 0x2a, 0xab, 0xff, 0xf4,
-    0x2a, 0xaa, 0x95, 0x6d, 0x0, 0x0, 0x0, 0x0,
-
-    /* U+8702 "蜂" */
-    0x0, 0x0, 0x0, 0x0, 0x3, 0x0, 0x38, 0x0,
-    0x3, 0x0, 0x7a, 0x90, 0x3, 0x0, 0xff, 0xf0,
-    0x2b, 0xa3, 0xe1, 0xd0, 0x3b, 0xbf, 0x7b, 0x40,
-    0x33, 0x30, 0x2f, 0x0, 0x33, 0x36, 0xf6, 0xf4,
-    0x33, 0x3e, 0x4d, 0x2c, 0x3f, 0xf3, 0xff, 0xf4,
-    0x37, 0x50, 0xe, 0x0, 0x3, 0x71, 0xff, 0xf0,
-    0x3, 0x34, 0xe, 0x0, 0x1b, 0xff, 0xff, 0xfc,
-    0x7e, 0x68, 0xe, 0x0, 0x0, 0x0, 0xd, 0x0,
-
-    /* U+8910 "褐" */
-    0x1, 0x0, 0x0, 0x0, 0x7, 0x3, 0xff, 0xf8,
-    0x3, 0x43, 0x80, 0x38, 0x3f, 0xf3, 0xff, 0xf8,
-    0x15, 0xe3, 0x95, 0x78, 0x0, 0xd3, 0x95, 0x78,
-    0x3, 0x82, 0xff, 0xf4, 0xb, 0xb4, 0xd0, 0x0,
-    0x1f, 0xe3, 0xff, 0xfc, 0x7f, 0x7f, 0x9, 0x1c,
-    0x23, 0xb, 0x5f, 0x1c, 0x3, 0x3, 0x71, 0xac,
-    0x3, 0x3, 0xff, 0xac, 0x3, 0x1, 0x55, 0x78,
-    0x3, 0x0, 0x1, 0xf4, 0x0, 0x0, 0x0, 0x0,
-
-    /* U+89C2 "观" */
-    0x15, 0x52, 0xff, 0xf8, 0x3f, 0xfa, 0xd5, 0x78,
-    0x0, 0x3a, 0xc0, 0x38, 0x0, 0x76, 0xce, 0x38,
-    0x38, 0x72, 0xce, 0x38, 0x1d, 0xb2, 0xcd, 0x38,
-    0xb, 0xe2, 0xcd, 0x38, 0x3, 0xd2, 0xcd, 0x38,
-    0x3, 0xd1, 0x5e, 0x14, 0x7, 0xf0, 0x2f, 0x0,
-    0xf, 0x78, 0x3b, 0x8, 0x2d, 0x20, 0xf3, 0xd,
-    0x78, 0x7, 0xc3, 0x4d, 0x10, 0xf, 0x3, 0xfc,
-    0x0, 0x0, 0x0, 0x0,
-
-    /* U+89D2 "角" */
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xe0, 0x0, 0x0,
-    0x7, 0xff, 0xe0, 0x0, 0x39, 0x57, 0x80, 0x3,
-    0xc0, 0x2c, 0x0, 0x3f, 0xaa, 0xfa, 0x82, 0xff,
-    0xff, 0xff, 0x0, 0xe0, 0x34, 0x2c, 0x3, 0xff,
-    0xff, 0xf0, 0xf, 0x57, 0x96, 0xc0, 0x38, 0xd,
-    0xb, 0x0, 0xe5, 0x79, 0x6c, 0x7, 0xff, 0xff,
-    0xf0, 0x2c, 0x3, 0x42, 0xc0, 0xe0, 0xd, 0x5f,
-    0x7, 0x0, 0x35, 0xf8, 0x0, 0x0, 0x0, 0x0,
-
-    /* U+8BA1 "计" */
-    0x5, 0x0, 0xe, 0x0, 0xb, 0x40, 0xe, 0x0,
-    0x2, 0xd0, 0xe, 0x0, 0x0, 0x80, 0xe, 0x0,
-    0x0, 0x0, 0xe, 0x0, 0x2b, 0x4a, 0xaf, 0xa8,
-    0x7f, 0x8f, 0xff, 0xfd, 0x3, 0x80, 0xe, 0x0,
-    0x3, 0x80, 0xe, 0x0, 0x3, 0x80, 0xe, 0x0,
-    0x3, 0x80, 0xe, 0x0, 0x3, 0xfc, 0xe, 0x0,
-    0x3, 0xf0, 0xe, 0x0, 0x7, 0x80, 0xe, 0x0,
-    0x1, 0x0, 0xe, 0x0,
-
-    /* U+901A "通" */
-    0x0, 0x0, 0x0, 0x0, 0x24, 0x1f, 0xff, 0xf4,
-    0x2e, 0x1, 0x82, 0xe0, 0x7, 0x41, 0xff, 0x40,
-    0x1, 0x5, 0xbf, 0x94, 0x0, 0x1e, 0xbe, 0xbc,
-    0x15, 0x1c, 0x2c, 0x3c, 0x7f, 0x1f, 0xff, 0xfc,
-    0x3, 0x1c, 0x1c, 0x2c, 0x3, 0x1f, 0xff, 0xfc,
-    0x3, 0x1c, 0x2c, 0x3c, 0x3, 0x1c, 0x1c, 0x38,
-    0xb, 0x9c, 0x1c, 0xf4, 0x3d, 0xf5, 0x1, 0x54,
-    0x30, 0x1f, 0xff, 0xfc, 0x0, 0x0, 0x0, 0x0,
-
-    /* U+91D1 "金" */
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x3, 0xc0, 0x0,
-    0x0, 0xf, 0xe0, 0x0, 0x0, 0x7c, 0x7d, 0x0,
-    0x7, 0xf0, 0xf, 0x80, 0x7f, 0xea, 0xab, 0xfc,
-    0x25, 0xff, 0xff, 0x18, 0x0, 0x3, 0x80, 0x0,
-    0x5, 0x57, 0xd5, 0x50, 0xf, 0xff, 0xff, 0xf0,
-    0x2, 0x43, 0x82, 0x40, 0x1, 0xc3, 0x83, 0x40,
-    0x0, 0xe3, 0x8e, 0x0, 0x2a, 0xeb, 0xee, 0xa8,
-    0x3f, 0xff, 0xff, 0xfc,
-
-    /* U+94F6 "银" */
-    0x1, 0x0, 0x0, 0x0, 0xb, 0x2, 0xff, 0xf4,
-    0xf, 0xf6, 0xd5, 0x74, 0x3d, 0x52, 0xc0, 0x34,
-    0x74, 0x2, 0xff, 0xf4, 0x2a, 0xa2, 0xea, 0xb4,
-    0xb, 0xe2, 0xc0, 0x34, 0x3, 0x82, 0xff, 0xf4,
-    0x17, 0x96, 0xee, 0xa4, 0x3f, 0xfa, 0xca, 0x1c,
-    0x3, 0x82, 0xc7, 0xb8, 0x3, 0x82, 0xc3, 0xd0,
-    0x3, 0x9a, 0xc1, 0xd0, 0x3, 0xf6, 0xed, 0xb4,
-    0x7, 0x83, 0xf8, 0x2c, 0x0, 0x1, 0x0, 0x0,
-
-    /* U+957F "长" */
-    0x0, 0xe0, 0x0, 0x80, 0x0, 0xe0, 0x3, 0xd0,
-    0x0, 0xe0, 0xf, 0x40, 0x0, 0xe0, 0xbd, 0x0,
-    0x0, 0xe3, 0xe0, 0x0, 0x0, 0xe1, 0x40, 0x0,
-    0x16, 0xe5, 0x55, 0x54, 0x3f, 0xff, 0xff, 0xfd,
-    0x0, 0xe0, 0xe0, 0x0, 0x0, 0xe0, 0xb0, 0x0,
-    0x0, 0xe0, 0x3c, 0x0, 0x0, 0xe0, 0xf, 0x0,
-    0x0, 0xe6, 0xc7, 0xe0, 0x1, 0xff, 0x80, 0xfd,
-    0x1, 0xe0, 0x0, 0x18, 0x0, 0x0, 0x0, 0x0,
-
-    /* U+9633 "阳" */
-    0x0, 0x0, 0x0, 0xf, 0xfd, 0xff, 0xfe, 0xe7,
-    0xcf, 0x55, 0xed, 0x38, 0xe0, 0xe, 0xd7, 0xe,
-    0x0, 0xed, 0xa0, 0xe0, 0xe, 0xd7, 0x4e, 0x0,
-    0xed, 0x2c, 0xff, 0xfe, 0xd0, 0xce, 0x55, 0xed,
-    0x1c, 0xe0, 0xe, 0xef, 0xce, 0x0, 0xed, 0x50,
-    0xe0, 0xe, 0xd0, 0xf, 0x55, 0xed, 0x0, 0xff,
-    0xfe, 0xd0, 0xe, 0x0, 0xe0, 0x0, 0x0, 0x0,
-
-    /* U+96BC "隼" */
-    0x0, 0x40, 0x40, 0x0, 0x3, 0xc1, 0xc0, 0x0,
-    0xb, 0xeb, 0xfa, 0xa4, 0x2f, 0x56, 0xe5, 0x50,
-    0x7f, 0xff, 0xff, 0xe0, 0x17, 0x56, 0xd5, 0x40,
-    0x7, 0xff, 0xff, 0xe0, 0x7, 0x56, 0xd5, 0x40,
-    0x7, 0xab, 0xea, 0xa4, 0x7, 0xaa, 0xaa, 0xa0,
-    0x0, 0x3, 0x80, 0x0, 0x7f, 0xff, 0xff, 0xfc,
-    0x15, 0x57, 0x95, 0x54, 0x0, 0x3, 0x80, 0x0,
-    0x0, 0x3, 0x80, 0x0,
-
-    /* U+96C0 "雀" */
-    0x0, 0x3, 0x81, 0x0, 0x0, 0xd3, 0x83, 0xc0,
-    0x3, 0xc3, 0x8a, 0xf0, 0xf, 0x3, 0xae, 0x3c,
-    0x8, 0x3, 0xf4, 0x0, 0x0, 0x1f, 0xf0, 0x0,
-    0x2, 0xfd, 0x74, 0x0, 0x7f, 0xfa, 0xbe, 0xa4,
-    0x26, 0xea, 0xba, 0xa4, 0x2, 0xea, 0xba, 0xa0,
-    0x2, 0xd5, 0x79, 0x50, 0x2, 0xff, 0xff, 0xe0,
-    0x2, 0xd5, 0x79, 0x50, 0x2, 0xea, 0xba, 0xa4,
-    0x2, 0xea, 0xaa, 0xa8,
-
-    /* U+96D5 "雕" */
-    0x0, 0x0, 0x4, 0x40, 0x2f, 0xff, 0x4d, 0xc0,
-    0x2d, 0x57, 0x5c, 0xa0, 0x28, 0xc3, 0x6e, 0xe8,
-    0x2b, 0xf7, 0x7f, 0xfc, 0x28, 0xd3, 0xfc, 0xd0,
-    0x2a, 0xf7, 0xfd, 0xe4, 0x29, 0x53, 0xaf, 0xfc,
-    0x2a, 0xf3, 0x6c, 0xd0, 0x2b, 0x73, 0x6c, 0xd0,
-    0x2b, 0x23, 0x6f, 0xfc, 0x37, 0xb3, 0x6c, 0xd0,
-    0x37, 0x53, 0x6c, 0xd0, 0x30, 0x17, 0x6f, 0xfd,
-    0x60, 0x3e, 0x2e, 0xa9,
-
-    /* U+96E8 "雨" */
-    0x7f, 0xff, 0xff, 0xfc, 0x7f, 0xff, 0xff, 0xfc,
-    0x0, 0x3, 0x80, 0x0, 0x0, 0x3, 0x80, 0x0,
-    0x1f, 0xff, 0xff, 0xf8, 0x1c, 0x3, 0x80, 0x38,
-    0x1d, 0xd3, 0xa8, 0x38, 0x1c, 0xb7, 0x8b, 0x78,
-    0x1c, 0x3, 0x81, 0x38, 0x1d, 0x83, 0xb8, 0x38,
-    0x1c, 0xb7, 0x8f, 0x78, 0x1c, 0x13, 0x82, 0x38,
-    0x1c, 0x3, 0x80, 0x38, 0x1c, 0x3, 0x83, 0xf0,
-    0x0, 0x0, 0x0, 0x0,
-
-    /* U+9875 "页" */
-    0x3f, 0xff, 0xff, 0xfc, 0x15, 0x57, 0xd5, 0x54,
-    0x0, 0x7, 0x40, 0x0, 0x1, 0x5f, 0x55, 0x50,
-    0x7, 0xff, 0xff, 0xe0, 0x7, 0x0, 0x0, 0xe0,
-    0x7, 0x2, 0xc0, 0xe0, 0x7, 0x2, 0xc0, 0xe0,
-    0x7, 0x2, 0xc0, 0xe0, 0x7, 0x3, 0xc0, 0xe0,
-    0x7, 0x7, 0x90, 0xe0, 0x0, 0x1f, 0x3e, 0x0,
-    0x1, 0xf8, 0x7, 0xe0, 0x3f, 0x90, 0x0, 0x7c,
-    0x4, 0x0, 0x0, 0x0,
-
-    /* U+9886 "领" */
-    0x0, 0x80, 0x0, 0x0, 0x1, 0xd0, 0xff, 0xfd,
-    0x3, 0xf0, 0x57, 0x94, 0xb, 0x3c, 0x7, 0x0,
-    0x1d, 0xe, 0xbf, 0xfc, 0x79, 0xc6, 0xb1, 0x2c,
-    0x10, 0xa0, 0xb3, 0x2c, 0x5, 0x54, 0xb3, 0x2c,
-    0x1f, 0xfd, 0xb3, 0x2c, 0x0, 0x2c, 0xb3, 0x2c,
-    0x0, 0x74, 0xb3, 0x2c, 0xe, 0xe0, 0x5b, 0x14,
-    0x3, 0xc0, 0xe, 0xe0, 0x1, 0xe0, 0x7c, 0x78,
-    0x0, 0x62, 0xe0, 0xc, 0x0, 0x0, 0x0, 0x0,
-
-    /* U+9888 "颈" */
-    0x3f, 0xfa, 0xff, 0xfc, 0x15, 0xb9, 0x5f, 0x54,
-    0x0, 0xb0, 0xe, 0x0, 0x2, 0xd0, 0xff, 0xf8,
-    0xf, 0xf4, 0xe5, 0x78, 0x3d, 0x1d, 0xd6, 0x38,
-    0x10, 0x0, 0xd7, 0x38, 0x2a, 0xa9, 0xd7, 0x38,
-    0x2b, 0xe9, 0xd7, 0x38, 0x1, 0xc0, 0xdb, 0x38,
-    0x1, 0xc0, 0x8e, 0x14, 0x2, 0xed, 0x1d, 0xd0,
-    0x3f, 0xe4, 0x74, 0xb8, 0x24, 0x2, 0xd0, 0x1c,
-    0x0, 0x0, 0x0, 0x0,
-
-    /* U+9B3C "鬼" */
-    0x0, 0x1, 0x0, 0x0, 0x0, 0x7, 0x40, 0x0,
-    0x7, 0xff, 0xff, 0xd0, 0xb, 0x57, 0xd6, 0xe0,
-    0xb, 0x3, 0x81, 0xe0, 0xb, 0xff, 0xff, 0xe0,
-    0xb, 0x3, 0x80, 0xe0, 0xb, 0x57, 0x95, 0xe0,
-    0xb, 0xff, 0xff, 0xd0, 0x0, 0xf, 0x82, 0x0,
-    0x0, 0x1f, 0xc7, 0x50, 0x0, 0x79, 0xde, 0xb0,
-    0x1, 0xf1, 0xda, 0x68, 0xf, 0x81, 0xd5, 0x5d,
-    0x3d, 0x0, 0xff, 0xfc, 0x0, 0x0, 0x0, 0x0,
-
-    /* U+9C7C "鱼" */
-    0x0, 0x14, 0x0, 0x0, 0x0, 0x79, 0x50, 0x0,
-    0x1, 0xff, 0xfd, 0x0, 0x7, 0xc0, 0x38, 0x0,
-    0x1f, 0x55, 0xf5, 0x50, 0x3f, 0xff, 0xff, 0xe0,
-    0x7, 0x2, 0xc0, 0xe0, 0x7, 0x3, 0xc0, 0xe0,
-    0x7, 0xff, 0xff, 0xe0, 0x7, 0x2, 0xc0, 0xe0,
-    0x7, 0x57, 0xd5, 0xe0, 0x7, 0xff, 0xff, 0xe0,
-    0x0, 0x0, 0x0, 0x0, 0x3f, 0xff, 0xff, 0xfc,
-    0x15, 0x55, 0x55, 0x54,
-
-    /* U+9CFD "鳽" */
-    0x0, 0x0, 0xd, 0x0, 0x7f, 0xfd, 0x1c, 0x0,
-    0x7f, 0xfe, 0xff, 0xf0, 0xd, 0x71, 0xc0, 0x70,
-    0xd, 0x71, 0xff, 0xf0, 0xd, 0x71, 0xd0, 0xb0,
-    0x1e, 0x75, 0xff, 0xf0, 0xbf, 0xff, 0xd5, 0x54,
-    0xd, 0x71, 0xea, 0xa8, 0xd, 0x71, 0xea, 0xa8,
-    0xd, 0x70, 0xaa, 0xbc, 0x1c, 0x71, 0x55, 0xec,
-    0x2c, 0x72, 0x66, 0x7c, 0x74, 0x73, 0x25, 0x38,
-    0x70, 0x71, 0x2, 0xf4, 0x0, 0x0, 0x0, 0x0,
-
-    /* U+9D5F "鵟" */
-    0x5, 0x50, 0x0, 0x0, 0x7, 0xd6, 0xae, 0xa8,
-    0x3e, 0xd0, 0x1c, 0x0, 0x2, 0xe7, 0xff, 0xf4,
-    0x3d, 0xa5, 0x5d, 0x54, 0x6, 0xcb, 0xea, 0xa8,
-    0x2, 0xeb, 0xea, 0x80, 0x2, 0xd5, 0x56, 0xc0,
-    0x2, 0xea, 0xaa, 0xc0, 0x2, 0xff, 0xff, 0xc0,
-    0x2, 0xd5, 0x55, 0x54, 0x2, 0xd5, 0x55, 0x54,
-    0x2, 0xff, 0xff, 0xf4, 0xe, 0x31, 0x8d, 0x34,
-    0x28, 0x24, 0x83, 0xf0, 0x0, 0x0, 0x0, 0x0,
-
-    /* U+9E1F "鸟" */
-    0x0, 0x2, 0x40, 0x0, 0x0, 0x1d, 0x0, 0x0,
-    0x3f, 0xff, 0xfc, 0x0, 0xe5, 0x55, 0x70, 0x3,
-    0x5e, 0x1, 0xc0, 0xd, 0x1f, 0xb, 0x0, 0x34,
-    0x4, 0xf4, 0x0, 0xd0, 0x1, 0x40, 0x3, 0xff,
-    0xff, 0xfc, 0x5, 0x55, 0x55, 0xf0, 0x0, 0x0,
-    0x3, 0x8f, 0xff, 0xff, 0xce, 0x0, 0x0, 0x0,
-    0x34, 0x0, 0x0, 0x16, 0xd0, 0x0, 0x0, 0x7e,
-    0x0,
-
-    /* U+9E20 "鸠" */
-    0x0, 0x0, 0x0, 0x0, 0x28, 0x0, 0x70, 0x0,
-    0xa0, 0x7, 0xd6, 0x2, 0x80, 0x7f, 0xfd, 0x1e,
-    0x51, 0xc0, 0x34, 0xff, 0xd7, 0x34, 0xc0, 0xe3,
-    0x5c, 0x77, 0x3, 0x4d, 0x70, 0x6c, 0xd, 0x35,
-    0xc3, 0xe0, 0x34, 0xd7, 0x55, 0x50, 0xc3, 0x9f,
-    0xff, 0xc7, 0xf, 0x0, 0xb, 0x2c, 0xb7, 0xff,
-    0xac, 0xe0, 0x0, 0x0, 0xe7, 0x0, 0x0, 0x3,
-    0x84, 0x0, 0x0, 0xfc, 0x0, 0x0, 0x0, 0x0,
-
-    /* U+9E22 "鸢" */
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x3, 0x87, 0x40,
-    0x0, 0x2, 0xdb, 0xfc, 0x3f, 0xff, 0xfe, 0x94,
-    0x15, 0x0, 0x3d, 0x8, 0x0, 0xe, 0xb, 0xec,
-    0x3, 0xff, 0xff, 0xf8, 0x3, 0x99, 0x56, 0xc0,
-    0x3, 0x8e, 0x2, 0xc0, 0x3, 0x83, 0xdf, 0x80,
-    0x3, 0x95, 0x55, 0x50, 0x3, 0xff, 0xff, 0xf8,
-    0x0, 0x0, 0x0, 0x28, 0x3f, 0xff, 0xfe, 0x38,
-    0x15, 0x55, 0x55, 0x74, 0x0, 0x0, 0x7, 0xf0,
-    0x0, 0x0, 0x0, 0x0,
-
-    /* U+9E26 "鸦" */
-    0x0, 0x0, 0x9, 0x0, 0x3f, 0xfd, 0xd, 0x0,
-    0x2a, 0xbd, 0xbf, 0xf8, 0x8, 0x34, 0xa4, 0x38,
-    0x1c, 0x34, 0xab, 0x28, 0x2c, 0x34, 0xa2, 0x78,
-    0x2d, 0x79, 0xa1, 0x74, 0x3f, 0xfe, 0xa1, 0xe0,
-    0x1, 0xf4, 0xa5, 0x54, 0x3, 0xb4, 0xbf, 0xfd,
-    0xb, 0x34, 0x0, 0xd, 0x1e, 0x36, 0xff, 0xdc,
-    0x3c, 0x34, 0x0, 0x1c, 0x21, 0x74, 0x0, 0x3c,
-    0x3, 0xf0, 0x2, 0xf4,
-
-    /* U+9E2B "鸫" */
-    0x0, 0x0, 0x1, 0x0, 0x3, 0x80, 0x7, 0x0,
-    0x17, 0x95, 0x7f, 0xf4, 0x3f, 0xff, 0x75, 0x78,
-    0xa, 0x0, 0x77, 0x24, 0xd, 0xd0, 0x72, 0x74,
-    0x1c, 0xd0, 0x71, 0xb0, 0x3f, 0xfd, 0x70, 0x50,
-    0x25, 0xe4, 0x7f, 0xfc, 0x4, 0xe8, 0x15, 0x5c,
-    0xc, 0xdd, 0x0, 0xc, 0x18, 0xdb, 0x7f, 0xdc,
-    0x34, 0xd3, 0x55, 0x5c, 0x21, 0xd1, 0x1, 0x68,
-    0x7, 0xc0, 0x3, 0xf4, 0x0, 0x0, 0x0, 0x0,
-
-    /* U+9E2C "鸬" */
-    0x1, 0xc0, 0x3, 0x40, 0x1, 0xc0, 0x7, 0x0,
-    0x1, 0xff, 0x7f, 0xf8, 0x1, 0xd0, 0x75, 0x78,
-    0x1, 0xc0, 0x77, 0x28, 0x1f, 0xfe, 0x72, 0xa4,
-    0x1d, 0x5e, 0x70, 0x34, 0x1c, 0xa, 0x71, 0xf0,
-    0x1d, 0x5e, 0x75, 0x54, 0x1f, 0xfe, 0x7f, 0xfc,
-    0x1c, 0xa, 0x0, 0xc, 0x2c, 0x0, 0xff, 0xdc,
-    0x38, 0x0, 0x0, 0x1c, 0x34, 0x0, 0x0, 0x2c,
-    0x20, 0x0, 0x1, 0xf4, 0x0, 0x0, 0x0, 0x0,
-
-    /* U+9E2E "鸮" */
-    0x0, 0x0, 0x6, 0x0, 0x1f, 0xfc, 0xe, 0x0,
-    0x1c, 0x1c, 0xbf, 0xfc, 0x1c, 0xc, 0xb1, 0x28,
-    0x1d, 0x5c, 0xb7, 0x28, 0x1f, 0xfc, 0xb2, 0xa8,
-    0x0, 0x0, 0xb0, 0x38, 0x7f, 0xff, 0xb1, 0xf0,
-    0xe, 0x0, 0xb5, 0x54, 0xe, 0x54, 0xbf, 0xfd,
-    0xa, 0xac, 0x0, 0xd, 0x0, 0x1d, 0xff, 0xdc,
-    0x0, 0x2c, 0x0, 0x1c, 0x1, 0x38, 0x0, 0x2c,
-    0x3, 0xf0, 0x1, 0xf4, 0x0, 0x0, 0x0, 0x0,
-
-    /* U+9E30 "鸰" */
-    0x0, 0x40, 0x5, 0x0, 0x1, 0xc0, 0xd, 0x0,
-    0x3, 0xf0, 0xff, 0xf8, 0x7, 0x78, 0xe4, 0x38,
-    0xe, 0x1d, 0xea, 0x38, 0x3d, 0x8b, 0xe3, 0x78,
-    0x20, 0xd0, 0xe0, 0x74, 0x0, 0x40, 0xe1, 0xf0,
-    0x2f, 0xfc, 0xe5, 0x54, 0x1a, 0xbc, 0xff, 0xfd,
-    0x0, 0x34, 0x0, 0xd, 0xe, 0xb2, 0xff, 0xdc,
-    0x7, 0xd0, 0x0, 0x1c, 0x1, 0xe0, 0x0, 0x2c,
-    0x0, 0x30, 0x2, 0xf4, 0x0, 0x0, 0x0, 0x0,
-
-    /* U+9E32 "鸲" */
-    0x1, 0x0, 0x5, 0x0, 0x2c, 0x0, 0x38, 0x0,
-    0xe5, 0x57, 0xff, 0x47, 0xff, 0x9d, 0xc, 0x3c,
-    0xa, 0x7b, 0x31, 0xe5, 0x29, 0xc9, 0xc3, 0xfd,
-    0xa7, 0x1b, 0x7, 0x36, 0x9c, 0xb4, 0x1c, 0xde,
-    0x75, 0x54, 0x73, 0x79, 0xff, 0xf1, 0xed, 0xd0,
-    0x2, 0xc7, 0x53, 0x7f, 0xfa, 0x4, 0xd, 0x55,
-    0x28, 0x1, 0xb0, 0x5, 0xd0, 0x1f, 0x80, 0x3f,
-    0x0, 0x0, 0x0, 0x0,
-
-    /* U+9E3A "鸺" */
-    0x0, 0x0, 0x0, 0x0, 0x3, 0x5c, 0x3, 0x40,
-    0x7, 0x1c, 0x1b, 0x50, 0xb, 0x1c, 0x3f, 0xf8,
-    0xd, 0x1c, 0x35, 0x38, 0x1d, 0xff, 0xbb, 0x74,
-    0x3d, 0x7d, 0x75, 0xb4, 0xbd, 0x3c, 0x34, 0x74,
-    0x6d, 0x3e, 0x35, 0xe0, 0xd, 0x7f, 0x38, 0x0,
-    0xd, 0xfe, 0xbf, 0xfc, 0xe, 0xdc, 0x0, 0xc,
-    0xe, 0x9c, 0xff, 0xdc, 0xd, 0x1c, 0x0, 0x1c,
-    0xd, 0x1c, 0x0, 0x2c, 0xd, 0x1c, 0x1, 0xf4,
-
-    /* U+9E3B "鸻" */
-    0x5, 0x0, 0x3, 0x40, 0xd, 0xbf, 0x43, 0x0,
-    0x2c, 0x15, 0x3f, 0xf8, 0x34, 0x0, 0x39, 0x38,
-    0x13, 0x0, 0x3b, 0x34, 0xb, 0xaa, 0x75, 0xb4,
-    0xd, 0xaf, 0x74, 0x74, 0x3d, 0xd, 0x36, 0xe0,
-    0x7d, 0xd, 0x39, 0x54, 0xd, 0xd, 0x3f, 0xfc,
-    0xd, 0xd, 0x0, 0xc, 0xd, 0xd, 0xff, 0xec,
-    0xd, 0xd, 0x0, 0x1c, 0xd, 0xd, 0x0, 0x2c,
-    0xd, 0x7c, 0x2, 0xf4, 0x0, 0x0, 0x0, 0x0,
-
-    /* U+9E43 "鹃" */
-    0x0, 0x0, 0x18, 0x7, 0xff, 0x3, 0x80, 0x70,
-    0x31, 0xff, 0xd7, 0x7, 0x1d, 0x4c, 0x7f, 0xf1,
-    0xdc, 0xc0, 0x0, 0x1c, 0x9c, 0xff, 0xf9, 0xc6,
-    0xce, 0x3, 0x9c, 0x64, 0xff, 0xf9, 0xff, 0xee,
-    0x57, 0x85, 0x5b, 0xe0, 0x38, 0x0, 0xbf, 0xff,
-    0xbf, 0xfa, 0xe0, 0x38, 0x54, 0xae, 0x7, 0x80,
-    0x5d, 0xe1, 0xf4, 0xf, 0xc0, 0x0, 0x0, 0x0,
-
-    /* U+9E4A "鹊" */
-    0x0, 0x0, 0x0, 0x0, 0xd, 0x34, 0x7, 0x0,
-    0xd, 0x34, 0xb, 0x0, 0x1e, 0x79, 0x7f, 0xf4,
-    0x7f, 0xfe, 0x75, 0x74, 0xd, 0x34, 0x7a, 0x34,
-    0xe, 0x38, 0x73, 0xb4, 0xbf, 0xff, 0x71, 0x70,
-    0x0, 0x0, 0x72, 0xe0, 0x1a, 0xa9, 0x70, 0x0,
-    0x2e, 0xad, 0x7f, 0xfc, 0x2c, 0x1d, 0x0, 0x1c,
-    0x2f, 0xff, 0xff, 0xdc, 0x28, 0xd, 0x0, 0x2c,
-    0x2d, 0x6d, 0x0, 0x3c, 0x2f, 0xfd, 0x3, 0xf4,
-    0x0, 0x0, 0x0, 0x0,
-
-    /* U+9E4E "鹎" */
-    0x1, 0x80, 0x2, 0x0, 0x3, 0xc0, 0xb, 0x0,
-    0x3f, 0xfd, 0x7f, 0xf4, 0x35, 0xcd, 0x70, 0x34,
-    0x35, 0xcd, 0x7b, 0x34, 0x3f, 0xfd, 0x73, 0x74,
-    0x35, 0xcd, 0x70, 0x70, 0x3f, 0xfd, 0x72, 0xe0,
-    0x1b, 0xa4, 0x75, 0x54, 0x1d, 0x70, 0x7f, 0xfc,
-    0x38, 0x70, 0x0, 0x1c, 0x7f, 0xfe, 0xbf, 0xdc,
-    0x0, 0x70, 0x15, 0x2c, 0x0, 0x70, 0x0, 0x38,
-    0x0, 0x70, 0x3, 0xf4, 0x0, 0x0, 0x0, 0x0,
-
-    /* U+9E5A "鹚" */
-    0x0, 0x0, 0x1, 0x0, 0xd, 0xa, 0x3, 0x40,
-    0x7, 0xc, 0x2f, 0xf8, 0x17, 0x6d, 0x79, 0x68,
-    0x3f, 0xff, 0xf7, 0x28, 0x9, 0x9, 0x35, 0xa8,
-    0xc, 0xc, 0x34, 0x78, 0x1d, 0xd9, 0xb5, 0xf0,
-    0x3a, 0xb7, 0x79, 0x54, 0x3f, 0x7f, 0x2f, 0xfc,
-    0x7, 0x7, 0x0, 0xc, 0xf, 0x4e, 0xbf, 0xdc,
-    0x2a, 0x9d, 0x80, 0x1c, 0x3e, 0xfe, 0xc0, 0x2c,
-    0x0, 0x40, 0x41, 0xf4, 0x0, 0x0, 0x0, 0x0,
-
-    /* U+9E5E "鹞" */
-    0x0, 0x4, 0x1, 0x0, 0x16, 0xfe, 0xa, 0x0,
-    0x3a, 0x80, 0x7f, 0xf8, 0x32, 0x8b, 0x71, 0x34,
-    0x29, 0xcd, 0x77, 0x34, 0x18, 0x5c, 0x72, 0x74,
-    0x1d, 0x54, 0x70, 0x74, 0x2f, 0xfd, 0x72, 0xf0,
-    0x31, 0xc0, 0x75, 0x54, 0x6a, 0xea, 0x7f, 0xfd,
-    0x2a, 0xda, 0x0, 0x1c, 0x35, 0xca, 0xff, 0xdc,
-    0x35, 0xca, 0x0, 0x2c, 0x3f, 0xfe, 0x0, 0x3c,
-    0x2a, 0x5e, 0x3, 0xf4, 0x0, 0x0, 0x0, 0x0,
-
-    /* U+9E60 "鹠" */
-    0x0, 0x0, 0x1, 0x0, 0x1f, 0x55, 0x47, 0x0,
-    0x34, 0x7f, 0xbf, 0xfc, 0x31, 0x29, 0xb5, 0x28,
-    0x33, 0x25, 0xb7, 0x68, 0x3b, 0x71, 0x74, 0xa8,
-    0x3a, 0xfb, 0x75, 0xb4, 0x0, 0x0, 0x34, 0xa0,
-    0x2f, 0xff, 0x39, 0x54, 0x2e, 0xeb, 0x3f, 0xfd,
-    0x28, 0xd3, 0x0, 0xc, 0x2f, 0xff, 0xbf, 0xdc,
-    0x28, 0xd3, 0x0, 0x1c, 0x2f, 0xff, 0x0, 0x2c,
-    0x29, 0x57, 0x2, 0xf4, 0x0, 0x0, 0x0, 0x0,
-
-    /* U+9E61 "鹡" */
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xc0, 0x7, 0x0,
-    0x39, 0xc7, 0xe, 0x0, 0x9, 0xdd, 0x7f, 0xf4,
-    0x6, 0x88, 0x75, 0x34, 0xbb, 0xdb, 0x77, 0x34,
-    0xb, 0x78, 0x71, 0x30, 0x3d, 0x1e, 0x72, 0xf0,
-    0x7f, 0xfe, 0x70, 0x0, 0x1c, 0xd, 0x7f, 0xfc,
-    0x1f, 0xfd, 0x15, 0x6c, 0x1d, 0xd, 0x0, 0x2c,
-    0x1d, 0x5d, 0xff, 0xec, 0x1f, 0xfd, 0x55, 0x2c,
-    0x1c, 0xd, 0x0, 0x38, 0x1c, 0xbc, 0x2, 0xf0,
-
-    /* U+9E6C "鹬" */
-    0x0, 0x0, 0x1, 0x0, 0x1f, 0xfe, 0x7, 0x0,
-    0x6, 0x3c, 0x3f, 0xf8, 0x17, 0xf5, 0x35, 0x28,
-    0x2b, 0xff, 0x37, 0x68, 0xb, 0x9b, 0x35, 0xa8,
-    0x38, 0x90, 0x34, 0x34, 0x12, 0xd0, 0x35, 0xf0,
-    0x3f, 0xff, 0x39, 0x54, 0x35, 0x63, 0x3f, 0xfd,
-    0x3b, 0x2b, 0x0, 0x1c, 0x37, 0xf3, 0xbf, 0xdc,
-    0x37, 0x33, 0x55, 0x6c, 0x37, 0xf3, 0x0, 0x3c,
-    0x36, 0x1f, 0x3, 0xf4, 0x0, 0x0, 0x0, 0x0,
-
-    /* U+9E6D "鹭" */
-    0x0, 0x0, 0x1, 0x0, 0x1f, 0xfd, 0x2f, 0xf4,
-    0x1d, 0x5e, 0xed, 0xb0, 0x5, 0xd4, 0x6f, 0xe4,
-    0xc, 0xfd, 0xb9, 0x78, 0xd, 0xd5, 0x35, 0x74,
-    0x3f, 0xea, 0x3f, 0xf4, 0x0, 0x7, 0x40, 0x0,
-    0x3, 0xff, 0xff, 0xc0, 0x3, 0x4e, 0x42, 0x80,
-    0x3, 0x41, 0xce, 0x0, 0x3, 0xff, 0xff, 0xfc,
-    0x1, 0x55, 0x54, 0x2c, 0x3f, 0xff, 0xfe, 0x38,
-    0x0, 0x0, 0x7, 0xf4, 0x0, 0x0, 0x0, 0x0,
-
-    /* U+9E70 "鹰" */
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x2, 0xc0, 0x0,
-    0x1f, 0xff, 0xff, 0xfc, 0x1c, 0x18, 0x86, 0x0,
-    0x1c, 0x35, 0xeb, 0xa4, 0x1c, 0xf3, 0xd7, 0x50,
-    0x1f, 0xfb, 0xeb, 0xa0, 0x1d, 0x71, 0xeb, 0xa0,
-    0x1c, 0x71, 0xeb, 0xa4, 0x1c, 0x27, 0x40, 0x0,
-    0x1c, 0xbf, 0xff, 0xf0, 0x2c, 0xa2, 0xe6, 0xe0,
-    0x38, 0xba, 0xba, 0xa4, 0x34, 0x15, 0x55, 0x78,
-    0x73, 0xff, 0xff, 0x38, 0x60, 0x0, 0x3, 0xf0,
-    0x0, 0x0, 0x0, 0x0,
-
-    /* U+9EC4 "黄" */
-    0x0, 0x70, 0xd, 0x0, 0x0, 0x74, 0x1e, 0x0,
-    0xf, 0xff, 0xff, 0xf4, 0x0, 0x74, 0xe, 0x0,
-    0x2a, 0xba, 0xaf, 0xa8, 0x3f, 0xff, 0xff, 0xfd,
-    0x0, 0x3, 0x80, 0x0, 0x7, 0xff, 0xff, 0xf0,
-    0x7, 0x3, 0x80, 0xf0, 0x7, 0xff, 0xff, 0xf0,
-    0x7, 0x3, 0x80, 0xf0, 0x7, 0xab, 0xea, 0xf0,
-    0x1, 0x75, 0x5e, 0x50, 0x2, 0xf4, 0xf, 0xd0,
-    0x2f, 0x40, 0x0, 0xbc, 0x0, 0x0, 0x0, 0x0,
-
-    /* U+9ED1 "黑" */
-    0xb, 0xff, 0xff, 0xe0, 0xb, 0x13, 0xc4, 0xe0,
-    0xb, 0x32, 0xcd, 0xe0, 0xb, 0x26, 0xdc, 0xe0,
-    0xb, 0x57, 0xd9, 0xe0, 0x7, 0xff, 0xff, 0xe0,
-    0x0, 0x2, 0xc0, 0x0, 0xf, 0xff, 0xff, 0xf0,
-    0x0, 0x3, 0xc0, 0x0, 0x2a, 0xab, 0xea, 0xa8,
-    0x2a, 0xaa, 0xaa, 0xa8, 0xa, 0x4, 0x20, 0xa0,
-    0xe, 0x1c, 0x38, 0x74, 0x3c, 0x1c, 0x2c, 0x2c,
-    0x0, 0x0, 0x0, 0x0,
-
-    /* U+FF01 "！" */
-    0x3c, 0x3c, 0x3c, 0x3c, 0x3c, 0x3c, 0x38, 0x38,
-    0x0, 0x0, 0x3c, 0x3c, 0x0,
-
-    /* U+FF08 "（" */
-    0x0, 0x80, 0x38, 0xb, 0x0, 0xd0, 0x2c, 0x3,
-    0x80, 0x34, 0x3, 0x40, 0x34, 0x3, 0x40, 0x38,
-    0x2, 0xc0, 0xd, 0x0, 0xb0, 0x3, 0xc0, 0x4,
-
-    /* U+FF09 "）" */
-    0x20, 0x2, 0xc0, 0xe, 0x0, 0x70, 0x3, 0x80,
-    0x2c, 0x1, 0xc0, 0x1c, 0x1, 0xc0, 0x1c, 0x2,
-    0xc0, 0x38, 0x7, 0x0, 0xe0, 0x3c, 0x1, 0x0,
-
-    /* U+FF0C "，" */
-    0x2c, 0x3e, 0x1e, 0xd, 0x3c, 0x60,
-
-    /* U+FF1A "：" */
-    0x0, 0x3c, 0x3d, 0x14, 0x0, 0x0, 0x0, 0x0,
-    0x14, 0x3d, 0x3c, 0x0,
-
-    /* U+FF1F "？" */
-    0x0, 0x0, 0x1f, 0xf4, 0x3d, 0x7c, 0x10, 0x1d,
-    0x0, 0x1d, 0x0, 0x3c, 0x0, 0xf0, 0x3, 0xc0,
-    0x3, 0x80, 0x0, 0x0, 0x0, 0x0, 0x7, 0xc0,
-    0x3, 0xc0, 0x0, 0x0,
-
-    /* U+FFE5 "￥" */
-    0x28, 0x0, 0x28, 0x1e, 0x0, 0xb4, 0xf, 0x0,
-    0xf0, 0x3, 0xc2, 0xc0, 0x1, 0xd3, 0x40, 0x0,
-    0xff, 0x0, 0xf, 0xff, 0xf0, 0x0, 0x3c, 0x0,
-    0xf, 0xff, 0xf0, 0x0, 0x3c, 0x0, 0x0, 0x3c,
-    0x0, 0x0, 0x28, 0x0
-};
-
-
-/*---------------------
- *  GLYPH DESCRIPTION
- *--------------------*/
-
-static const lv_font_fmt_txt_glyph_dsc_t glyph_dsc[] = {
-    {.bitmap_index = 0, .adv_w = 0, .box_w = 0, .box_h = 0, .ofs_x = 0, .ofs_y = 0} /* id = 0 reserved */,
-    {.bitmap_index = 0, .adv_w = 58, .box_w = 0, .box_h = 0, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 0, .adv_w = 88, .box_w = 3, .box_h = 12, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 9, .adv_w = 146, .box_w = 9, .box_h = 12, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 36, .adv_w = 146, .box_w = 9, .box_h = 16, .ofs_x = 0, .ofs_y = -2},
-    {.bitmap_index = 72, .adv_w = 240, .box_w = 15, .box_h = 12, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 117, .adv_w = 181, .box_w = 12, .box_h = 12, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 153, .adv_w = 91, .box_w = 4, .box_h = 18, .ofs_x = 1, .ofs_y = -4},
-    {.bitmap_index = 171, .adv_w = 91, .box_w = 5, .box_h = 18, .ofs_x = 0, .ofs_y = -4},
-    {.bitmap_index = 194, .adv_w = 124, .box_w = 7, .box_h = 6, .ofs_x = 0, .ofs_y = 7},
-    {.bitmap_index = 205, .adv_w = 146, .box_w = 9, .box_h = 9, .ofs_x = 0, .ofs_y = 2},
-    {.bitmap_index = 226, .adv_w = 76, .box_w = 4, .box_h = 7, .ofs_x = 0, .ofs_y = -4},
-    {.bitmap_index = 233, .adv_w = 91, .box_w = 5, .box_h = 3, .ofs_x = 0, .ofs_y = 3},
-    {.bitmap_index = 237, .adv_w = 76, .box_w = 3, .box_h = 3, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 240, .adv_w = 100, .box_w = 6, .box_h = 16, .ofs_x = 0, .ofs_y = -3},
-    {.bitmap_index = 264, .adv_w = 146, .box_w = 9, .box_h = 12, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 291, .adv_w = 146, .box_w = 8, .box_h = 12, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 315, .adv_w = 146, .box_w = 9, .box_h = 12, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 342, .adv_w = 146, .box_w = 9, .box_h = 12, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 369, .adv_w = 146, .box_w = 9, .box_h = 12, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 396, .adv_w = 146, .box_w = 9, .box_h = 12, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 423, .adv_w = 146, .box_w = 9, .box_h = 12, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 450, .adv_w = 146, .box_w = 9, .box_h = 12, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 477, .adv_w = 146, .box_w = 9, .box_h = 12, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 504, .adv_w = 146, .box_w = 9, .box_h = 12, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 531, .adv_w = 76, .box_w = 3, .box_h = 9, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 538, .adv_w = 249, .box_w = 15, .box_h = 15, .ofs_x = 0, .ofs_y = -3},
-    {.bitmap_index = 595, .adv_w = 159, .box_w = 10, .box_h = 12, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 625, .adv_w = 171, .box_w = 9, .box_h = 12, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 652, .adv_w = 165, .box_w = 10, .box_h = 12, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 682, .adv_w = 179, .box_w = 10, .box_h = 12, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 712, .adv_w = 154, .box_w = 8, .box_h = 12, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 736, .adv_w = 145, .box_w = 8, .box_h = 12, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 760, .adv_w = 179, .box_w = 11, .box_h = 12, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 793, .adv_w = 190, .box_w = 10, .box_h = 12, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 823, .adv_w = 79, .box_w = 3, .box_h = 12, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 832, .adv_w = 141, .box_w = 8, .box_h = 12, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 856, .adv_w = 170, .box_w = 10, .box_h = 12, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 886, .adv_w = 143, .box_w = 8, .box_h = 12, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 910, .adv_w = 212, .box_w = 11, .box_h = 12, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 943, .adv_w = 188, .box_w = 10, .box_h = 12, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 973, .adv_w = 193, .box_w = 12, .box_h = 12, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 1009, .adv_w = 166, .box_w = 9, .box_h = 12, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 1036, .adv_w = 193, .box_w = 12, .box_h = 15, .ofs_x = 0, .ofs_y = -3},
-    {.bitmap_index = 1081, .adv_w = 168, .box_w = 10, .box_h = 12, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 1111, .adv_w = 156, .box_w = 10, .box_h = 12, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 1141, .adv_w = 156, .box_w = 10, .box_h = 12, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 1171, .adv_w = 188, .box_w = 10, .box_h = 12, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 1201, .adv_w = 152, .box_w = 11, .box_h = 12, .ofs_x = -1, .ofs_y = 0},
-    {.bitmap_index = 1234, .adv_w = 229, .box_w = 14, .box_h = 12, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 1276, .adv_w = 153, .box_w = 10, .box_h = 12, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 1306, .adv_w = 142, .box_w = 10, .box_h = 12, .ofs_x = -1, .ofs_y = 0},
-    {.bitmap_index = 1336, .adv_w = 155, .box_w = 10, .box_h = 12, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 1366, .adv_w = 146, .box_w = 8, .box_h = 7, .ofs_x = 1, .ofs_y = 5},
-    {.bitmap_index = 1380, .adv_w = 144, .box_w = 9, .box_h = 2, .ofs_x = 0, .ofs_y = -3},
-    {.bitmap_index = 1385, .adv_w = 147, .box_w = 8, .box_h = 9, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 1403, .adv_w = 161, .box_w = 9, .box_h = 13, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 1433, .adv_w = 132, .box_w = 8, .box_h = 9, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 1451, .adv_w = 161, .box_w = 9, .box_h = 13, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 1481, .adv_w = 145, .box_w = 9, .box_h = 9, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 1502, .adv_w = 89, .box_w = 7, .box_h = 13, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 1525, .adv_w = 148, .box_w = 10, .box_h = 13, .ofs_x = 0, .ofs_y = -4},
-    {.bitmap_index = 1558, .adv_w = 159, .box_w = 8, .box_h = 13, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 1584, .adv_w = 74, .box_w = 3, .box_h = 13, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 1594, .adv_w = 74, .box_w = 5, .box_h = 17, .ofs_x = -1, .ofs_y = -4},
-    {.bitmap_index = 1616, .adv_w = 147, .box_w = 9, .box_h = 13, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 1646, .adv_w = 76, .box_w = 4, .box_h = 13, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 1659, .adv_w = 241, .box_w = 13, .box_h = 9, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 1689, .adv_w = 160, .box_w = 8, .box_h = 9, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 1707, .adv_w = 157, .box_w = 10, .box_h = 9, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 1730, .adv_w = 161, .box_w = 9, .box_h = 13, .ofs_x = 1, .ofs_y = -4},
-    {.bitmap_index = 1760, .adv_w = 161, .box_w = 9, .box_h = 13, .ofs_x = 0, .ofs_y = -4},
-    {.bitmap_index = 1790, .adv_w = 105, .box_w = 6, .box_h = 10, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 1805, .adv_w = 123, .box_w = 8, .box_h = 9, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 1823, .adv_w = 101, .box_w = 7, .box_h = 12, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 1844, .adv_w = 159, .box_w = 8, .box_h = 9, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 1862, .adv_w = 140, .box_w = 9, .box_h = 9, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 1883, .adv_w = 212, .box_w = 13, .box_h = 9, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 1913, .adv_w = 135, .box_w = 9, .box_h = 9, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 1934, .adv_w = 139, .box_w = 9, .box_h = 13, .ofs_x = 0, .ofs_y = -4},
-    {.bitmap_index = 1964, .adv_w = 126, .box_w = 8, .box_h = 9, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 1982, .adv_w = 230, .box_w = 14, .box_h = 3, .ofs_x = 0, .ofs_y = 3},
-    {.bitmap_index = 1993, .adv_w = 256, .box_w = 14, .box_h = 3, .ofs_x = 1, .ofs_y = 5},
-    {.bitmap_index = 2004, .adv_w = 256, .box_w = 6, .box_h = 5, .ofs_x = 0, .ofs_y = -1},
-    {.bitmap_index = 2012, .adv_w = 256, .box_w = 16, .box_h = 15, .ofs_x = 0, .ofs_y = -1},
-    {.bitmap_index = 2072, .adv_w = 256, .box_w = 16, .box_h = 16, .ofs_x = 0, .ofs_y = -2},
-    {.bitmap_index = 2136, .adv_w = 256, .box_w = 16, .box_h = 3, .ofs_x = 0, .ofs_y = 5},
-    {.bitmap_index = 2148, .adv_w = 256, .box_w = 16, .box_h = 15, .ofs_x = 0, .ofs_y = -1},
-    {.bitmap_index = 2208, .adv_w = 256, .box_w = 16, .box_h = 14, .ofs_x = 0, .ofs_y = -1},
-    {.bitmap_index = 2264, .adv_w = 256, .box_w = 15, .box_h = 16, .ofs_x = 0, .ofs_y = -2},
-    {.bitmap_index = 2324, .adv_w = 256, .box_w = 14, .box_h = 15, .ofs_x = 1, .ofs_y = -2},
-    {.bitmap_index = 2377, .adv_w = 256, .box_w = 16, .box_h = 15, .ofs_x = 0, .ofs_y = -2},
-    {.bitmap_index = 2437, .adv_w = 256, .box_w = 16, .box_h = 15, .ofs_x = 0, .ofs_y = -2},
-    {.bitmap_index = 2497, .adv_w = 256, .box_w = 16, .box_h = 15, .ofs_x = 0, .ofs_y = -2},
-    {.bitmap_index = 2557, .adv_w = 256, .box_w = 15, .box_h = 16, .ofs_x = 0, .ofs_y = -2},
-    {.bitmap_index = 2617, .adv_w = 256, .box_w = 16, .box_h = 15, .ofs_x = 0, .ofs_y = -1},
-    {.bitmap_index = 2677, .adv_w = 256, .box_w = 16, .box_h = 15, .ofs_x = 0, .ofs_y = -2},
-    {.bitmap_index = 2737, .adv_w = 256, .box_w = 16, .box_h = 16, .ofs_x = 0, .ofs_y = -2},
-    {.bitmap_index = 2801, .adv_w = 256, .box_w = 16, .box_h = 16, .ofs_x = 0, .ofs_y = -2},
-    {.bitmap_index = 2865, .adv_w = 256, .box_w = 15, .box_h = 15, .ofs_x = 1, .ofs_y = -1},
-    {.bitmap_index = 2922, .adv_w = 256, .box_w = 16, .box_h = 15, .ofs_x = 0, .ofs_y = -2},
-    {.bitmap_index = 2982, .adv_w = 256, .box_w = 15, .box_h = 15, .ofs_x = 1, .ofs_y = -2},
-    {.bitmap_index = 3039, .adv_w = 256, .box_w = 16, .box_h = 15, .ofs_x = 0, .ofs_y = -1},
-    {.bitmap_index = 3099, .adv_w = 256, .box_w = 15, .box_h = 17, .ofs_x = 1, .ofs_y = -2},
-    {.bitmap_index = 3163, .adv_w = 256, .box_w = 15, .box_h = 14, .ofs_x = 1, .ofs_y = -1},
-    {.bitmap_index = 3216, .adv_w = 256, .box_w = 16, .box_h = 16, .ofs_x = 0, .ofs_y = -2},
-    {.bitmap_index = 3280, .adv_w = 256, .box_w = 16, .box_h = 16, .ofs_x = 0, .ofs_y = -2},
-    {.bitmap_index = 3344, .adv_w = 256, .box_w = 16, .box_h = 16, .ofs_x = 0, .ofs_y = -2},
-    {.bitmap_index = 3408, .adv_w = 256, .box_w = 16, .box_h = 16, .ofs_x = 0, .ofs_y = -2},
-    {.bitmap_index = 3472, .adv_w = 256, .box_w = 16, .box_h = 16, .ofs_x = 0, .ofs_y = -2},
-    {.bitmap_index = 3536, .adv_w = 256, .box_w = 16, .box_h = 16, .ofs_x = 0, .ofs_y = -2},
-    {.bitmap_index = 3600, .adv_w = 256, .box_w = 16, .box_h = 15, .ofs_x = 0, .ofs_y = -2},
-    {.bitmap_index = 3660, .adv_w = 256, .box_w = 14, .box_h = 15, .ofs_x = 1, .ofs_y = -1},
-    {.bitmap_index = 3713, .adv_w = 256, .box_w = 16, .box_h = 15, .ofs_x = 0, .ofs_y = -1},
-    {.bitmap_index = 3773, .adv_w = 256, .box_w = 16, .box_h = 14, .ofs_x = 0, .ofs_y = -1},
-    {.bitmap_index = 3829, .adv_w = 256, .box_w = 16, .box_h = 16, .ofs_x = 0, .ofs_y = -2},
-    {.bitmap_index = 3893, .adv_w = 256, .box_w = 16, .box_h = 15, .ofs_x = 0, .ofs_y = -1},
-    {.bitmap_index = 3953, .adv_w = 256, .box_w = 16, .box_h = 17, .ofs_x = 0, .ofs_y = -2},
-    {.bitmap_index = 4021, .adv_w = 256, .box_w = 16, .box_h = 16, .ofs_x = 0, .ofs_y = -2},
-    {.bitmap_index = 4085, .adv_w = 256, .box_w = 16, .box_h = 16, .ofs_x = 0, .ofs_y = -2},
-    {.bitmap_index = 4149, .adv_w = 256, .box_w = 16, .box_h = 15, .ofs_x = 0, .ofs_y = -1},
-    {.bitmap_index = 4209, .adv_w = 256, .box_w = 12, .box_h = 15, .ofs_x = 2, .ofs_y = -2},
-    {.bitmap_index = 4254, .adv_w = 256, .box_w = 16, .box_h = 16, .ofs_x = 0, .ofs_y = -2},
-    {.bitmap_index = 4318, .adv_w = 256, .box_w = 15, .box_h = 16, .ofs_x = 1, .ofs_y = -2},
-    {.bitmap_index = 4378, .adv_w = 256, .box_w = 16, .box_h = 15, .ofs_x = 0, .ofs_y = -1},
-    {.bitmap_index = 4438, .adv_w = 256, .box_w = 16, .box_h = 15, .ofs_x = 0, .ofs_y = -1},
-    {.bitmap_index = 4498, .adv_w = 256, .box_w = 16, .box_h = 15, .ofs_x = 0, .ofs_y = -1},
-    {.bitmap_index = 4558, .adv_w = 256, .box_w = 16, .box_h = 15, .ofs_x = 0, .ofs_y = -1},
-    {.bitmap_index = 4618, .adv_w = 256, .box_w = 16, .box_h = 15, .ofs_x = 0, .ofs_y = -1},
-    {.bitmap_index = 4678, .adv_w = 256, .box_w = 16, .box_h = 16, .ofs_x = 0, .ofs_y = -2},
-    {.bitmap_index = 4742, .adv_w = 256, .box_w = 16, .box_h = 15, .ofs_x = 0, .ofs_y = -1},
-    {.bitmap_index = 4802, .adv_w = 256, .box_w = 16, .box_h = 15, .ofs_x = 0, .ofs_y = -1},
-    {.bitmap_index = 4862, .adv_w = 256, .box_w = 16, .box_h = 17, .ofs_x = 0, .ofs_y = -2},
-    {.bitmap_index = 4930, .adv_w = 256, .box_w = 16, .box_h = 16, .ofs_x = 0, .ofs_y = -2},
-    {.bitmap_index = 4994, .adv_w = 256, .box_w = 15, .box_h = 16, .ofs_x = 0, .ofs_y = -2},
-    {.bitmap_index = 5054, .adv_w = 256, .box_w = 16, .box_h = 15, .ofs_x = 0, .ofs_y = -1},
-    {.bitmap_index = 5114, .adv_w = 256, .box_w = 16, .box_h = 15, .ofs_x = 0, .ofs_y = -2},
-    {.bitmap_index = 5174, .adv_w = 256, .box_w = 12, .box_h = 16, .ofs_x = 2, .ofs_y = -2},
-    {.bitmap_index = 5222, .adv_w = 256, .box_w = 15, .box_h = 14, .ofs_x = 1, .ofs_y = -1},
-    {.bitmap_index = 5275, .adv_w = 256, .box_w = 15, .box_h = 15, .ofs_x = 1, .ofs_y = -2},
-    {.bitmap_index = 5332, .adv_w = 256, .box_w = 16, .box_h = 16, .ofs_x = 0, .ofs_y = -2},
-    {.bitmap_index = 5396, .adv_w = 256, .box_w = 16, .box_h = 15, .ofs_x = 0, .ofs_y = -1},
-    {.bitmap_index = 5456, .adv_w = 256, .box_w = 16, .box_h = 16, .ofs_x = 0, .ofs_y = -2},
-    {.bitmap_index = 5520, .adv_w = 256, .box_w = 16, .box_h = 16, .ofs_x = 0, .ofs_y = -2},
-    {.bitmap_index = 5584, .adv_w = 256, .box_w = 16, .box_h = 15, .ofs_x = 0, .ofs_y = -1},
-    {.bitmap_index = 5644, .adv_w = 256, .box_w = 16, .box_h = 16, .ofs_x = 0, .ofs_y = -2},
-    {.bitmap_index = 5708, .adv_w = 256, .box_w = 16, .box_h = 16, .ofs_x = 0, .ofs_y = -2},
-    {.bitmap_index = 5772, .adv_w = 256, .box_w = 16, .box_h = 14, .ofs_x = 0, .ofs_y = -1},
-    {.bitmap_index = 5828, .adv_w = 256, .box_w = 16, .box_h = 16, .ofs_x = 0, .ofs_y = -2},
-    {.bitmap_index = 5892, .adv_w = 256, .box_w = 16, .box_h = 14, .ofs_x = 0, .ofs_y = -1},
-    {.bitmap_index = 5948, .adv_w = 256, .box_w = 16, .box_h = 16, .ofs_x = 0, .ofs_y = -2},
-    {.bitmap_index = 6012, .adv_w = 256, .box_w = 16, .box_h = 16, .ofs_x = 0, .ofs_y = -2},
-    {.bitmap_index = 6076, .adv_w = 256, .box_w = 16, .box_h = 16, .ofs_x = 0, .ofs_y = -2},
-    {.bitmap_index = 6140, .adv_w = 256, .box_w = 16, .box_h = 16, .ofs_x = 0, .ofs_y = -2},
-    {.bitmap_index = 6204, .adv_w = 256, .box_w = 16, .box_h = 15, .ofs_x = 0, .ofs_y = -2},
-    {.bitmap_index = 6264, .adv_w = 256, .box_w = 16, .box_h = 16, .ofs_x = 0, .ofs_y = -2},
-    {.bitmap_index = 6328, .adv_w = 256, .box_w = 15, .box_h = 15, .ofs_x = 1, .ofs_y = -1},
-    {.bitmap_index = 6385, .adv_w = 256, .box_w = 16, .box_h = 15, .ofs_x = 0, .ofs_y = -1},
-    {.bitmap_index = 6445, .adv_w = 256, .box_w = 15, .box_h = 16, .ofs_x = 0, .ofs_y = -2},
-    {.bitmap_index = 6505, .adv_w = 256, .box_w = 16, .box_h = 15, .ofs_x = 0, .ofs_y = -1},
-    {.bitmap_index = 6565, .adv_w = 256, .box_w = 16, .box_h = 15, .ofs_x = 0, .ofs_y = -1},
-    {.bitmap_index = 6625, .adv_w = 256, .box_w = 16, .box_h = 16, .ofs_x = 0, .ofs_y = -1},
-    {.bitmap_index = 6689, .adv_w = 256, .box_w = 16, .box_h = 16, .ofs_x = 0, .ofs_y = -2},
-    {.bitmap_index = 6753, .adv_w = 256, .box_w = 16, .box_h = 16, .ofs_x = 0, .ofs_y = -1},
-    {.bitmap_index = 6817, .adv_w = 256, .box_w = 16, .box_h = 16, .ofs_x = 0, .ofs_y = -2},
-    {.bitmap_index = 6881, .adv_w = 256, .box_w = 16, .box_h = 15, .ofs_x = 0, .ofs_y = -2},
-    {.bitmap_index = 6941, .adv_w = 256, .box_w = 15, .box_h = 17, .ofs_x = 0, .ofs_y = -2},
-    {.bitmap_index = 7005, .adv_w = 256, .box_w = 16, .box_h = 15, .ofs_x = 0, .ofs_y = -1},
-    {.bitmap_index = 7065, .adv_w = 256, .box_w = 16, .box_h = 16, .ofs_x = 0, .ofs_y = -2},
-    {.bitmap_index = 7129, .adv_w = 256, .box_w = 16, .box_h = 15, .ofs_x = 0, .ofs_y = -1},
-    {.bitmap_index = 7189, .adv_w = 256, .box_w = 16, .box_h = 16, .ofs_x = 0, .ofs_y = -2},
-    {.bitmap_index = 7253, .adv_w = 256, .box_w = 16, .box_h = 16, .ofs_x = 0, .ofs_y = -2},
-    {.bitmap_index = 7317, .adv_w = 256, .box_w = 14, .box_h = 16, .ofs_x = 1, .ofs_y = -2},
-    {.bitmap_index = 7373, .adv_w = 256, .box_w = 16, .box_h = 15, .ofs_x = 0, .ofs_y = -1},
-    {.bitmap_index = 7433, .adv_w = 256, .box_w = 16, .box_h = 15, .ofs_x = 0, .ofs_y = -1},
-    {.bitmap_index = 7493, .adv_w = 256, .box_w = 16, .box_h = 15, .ofs_x = 0, .ofs_y = -1},
-    {.bitmap_index = 7553, .adv_w = 256, .box_w = 16, .box_h = 15, .ofs_x = 0, .ofs_y = -2},
-    {.bitmap_index = 7613, .adv_w = 256, .box_w = 16, .box_h = 15, .ofs_x = 0, .ofs_y = -2},
-    {.bitmap_index = 7673, .adv_w = 256, .box_w = 16, .box_h = 16, .ofs_x = 0, .ofs_y = -2},
-    {.bitmap_index = 7737, .adv_w = 256, .box_w = 16, .box_h = 15, .ofs_x = 0, .ofs_y = -2},
-    {.bitmap_index = 7797, .adv_w = 256, .box_w = 16, .box_h = 16, .ofs_x = 0, .ofs_y = -2},
-    {.bitmap_index = 7861, .adv_w = 256, .box_w = 16, .box_h = 15, .ofs_x = 0, .ofs_y = -1},
-    {.bitmap_index = 7921, .adv_w = 256, .box_w = 16, .box_h = 16, .ofs_x = 0, .ofs_y = -2},
-    {.bitmap_index = 7985, .adv_w = 256, .box_w = 16, .box_h = 16, .ofs_x = 0, .ofs_y = -2},
-    {.bitmap_index = 8049, .adv_w = 256, .box_w = 15, .box_h = 15, .ofs_x = 0, .ofs_y = -1},
-    {.bitmap_index = 8106, .adv_w = 256, .box_w = 15, .box_h = 17, .ofs_x = 0, .ofs_y = -2},
-    {.bitmap_index = 8170, .adv_w = 256, .box_w = 16, .box_h = 17, .ofs_x = 0, .ofs_y = -2},
-    {.bitmap_index = 8238, .adv_w = 256, .box_w = 16, .box_h = 15, .ofs_x = 0, .ofs_y = -1},
-    {.bitmap_index = 8298, .adv_w = 256, .box_w = 16, .box_h = 16, .ofs_x = 0, .ofs_y = -2},
-    {.bitmap_index = 8362, .adv_w = 256, .box_w = 16, .box_h = 16, .ofs_x = 0, .ofs_y = -2},
-    {.bitmap_index = 8426, .adv_w = 256, .box_w = 16, .box_h = 16, .ofs_x = 0, .ofs_y = -2},
-    {.bitmap_index = 8490, .adv_w = 256, .box_w = 16, .box_h = 16, .ofs_x = 0, .ofs_y = -2},
-    {.bitmap_index = 8554, .adv_w = 256, .box_w = 15, .box_h = 16, .ofs_x = 0, .ofs_y = -2},
-    {.bitmap_index = 8614, .adv_w = 256, .box_w = 16, .box_h = 16, .ofs_x = 0, .ofs_y = -1},
-    {.bitmap_index = 8678, .adv_w = 256, .box_w = 16, .box_h = 16, .ofs_x = 0, .ofs_y = -2},
-    {.bitmap_index = 8742, .adv_w = 256, .box_w = 14, .box_h = 16, .ofs_x = 1, .ofs_y = -2},
-    {.bitmap_index = 8798, .adv_w = 256, .box_w = 16, .box_h = 17, .ofs_x = 0, .ofs_y = -2},
-    {.bitmap_index = 8866, .adv_w = 256, .box_w = 16, .box_h = 16, .ofs_x = 0, .ofs_y = -2},
-    {.bitmap_index = 8930, .adv_w = 256, .box_w = 16, .box_h = 16, .ofs_x = 0, .ofs_y = -2},
-    {.bitmap_index = 8994, .adv_w = 256, .box_w = 16, .box_h = 16, .ofs_x = 0, .ofs_y = -2},
-    {.bitmap_index = 9058, .adv_w = 256, .box_w = 16, .box_h = 16, .ofs_x = 0, .ofs_y = -2},
-    {.bitmap_index = 9122, .adv_w = 256, .box_w = 16, .box_h = 16, .ofs_x = 0, .ofs_y = -1},
-    {.bitmap_index = 9186, .adv_w = 256, .box_w = 16, .box_h = 16, .ofs_x = 0, .ofs_y = -2},
-    {.bitmap_index = 9250, .adv_w = 256, .box_w = 16, .box_h = 16, .ofs_x = 0, .ofs_y = -2},
-    {.bitmap_index = 9314, .adv_w = 256, .box_w = 16, .box_h = 17, .ofs_x = 0, .ofs_y = -2},
-    {.bitmap_index = 9382, .adv_w = 256, .box_w = 16, .box_h = 16, .ofs_x = 0, .ofs_y = -2},
-    {.bitmap_index = 9446, .adv_w = 256, .box_w = 16, .box_h = 15, .ofs_x = 0, .ofs_y = -2},
-    {.bitmap_index = 9506, .adv_w = 256, .box_w = 4, .box_h = 13, .ofs_x = 2, .ofs_y = -1},
-    {.bitmap_index = 9519, .adv_w = 256, .box_w = 6, .box_h = 16, .ofs_x = 10, .ofs_y = -2},
-    {.bitmap_index = 9543, .adv_w = 256, .box_w = 6, .box_h = 16, .ofs_x = 0, .ofs_y = -2},
-    {.bitmap_index = 9567, .adv_w = 256, .box_w = 4, .box_h = 6, .ofs_x = 2, .ofs_y = -2},
-    {.bitmap_index = 9573, .adv_w = 256, .box_w = 4, .box_h = 12, .ofs_x = 2, .ofs_y = -1},
-    {.bitmap_index = 9585, .adv_w = 256, .box_w = 8, .box_h = 14, .ofs_x = 0, .ofs_y = -1},
-    {.bitmap_index = 9613, .adv_w = 256, .box_w = 12, .box_h = 12, .ofs_x = 2, .ofs_y = 0}
-};
-
-/*---------------------
- *  CHARACTER MAPPING
- *--------------------*/
-
-static const uint8_t glyph_id_ofs_list_0[] = {
-    0, 1, 0, 2, 3, 4, 5
-};
-
-static const uint16_t unicode_list_5[] = {
-    0x0, 0x12, 0xfee, 0x2d04, 0x2d05, 0x2dec, 0x2df6, 0x2df7,
-    0x2e38, 0x2e72, 0x3157, 0x318c, 0x31d0, 0x328c, 0x3363, 0x33b5,
-    0x33b9, 0x33bd, 0x33e2, 0x34d1, 0x3530, 0x3588, 0x3620, 0x3656,
-    0x3908, 0x3913, 0x3916, 0x3920, 0x3beb, 0x3bfb, 0x3c2a, 0x3c5d,
-    0x3e12, 0x4062, 0x4220, 0x42cb, 0x434f, 0x4573, 0x457d, 0x459c,
-    0x45d1, 0x465a, 0x4683, 0x4714, 0x4718, 0x4751, 0x476a, 0x4783,
-    0x4b0d, 0x4c20, 0x4c4c, 0x505c, 0x51c1, 0x52c3, 0x53cc, 0x5421,
-    0x5669, 0x5722, 0x5728, 0x5d17, 0x5e8e, 0x5ecb, 0x5ecf, 0x5eeb,
-    0x5f09, 0x5fb1, 0x5fcc, 0x5fcd, 0x601f, 0x60c8, 0x60e4, 0x6106,
-    0x6124, 0x615c, 0x6165, 0x62b3, 0x62b9, 0x62d2, 0x63a6, 0x64c9,
-    0x66b3, 0x66b7, 0x66ee, 0x68fc, 0x69ae, 0x69be, 0x6b8d, 0x7006,
-    0x71bd, 0x74e2, 0x756b, 0x761f, 0x76a8, 0x76ac, 0x76c1, 0x76d4,
-    0x7861, 0x7872, 0x7874, 0x7b28, 0x7c68, 0x7ce9, 0x7d4b, 0x7e0b,
-    0x7e0c, 0x7e0e, 0x7e12, 0x7e17, 0x7e18, 0x7e1a, 0x7e1c, 0x7e1e,
-    0x7e26, 0x7e27, 0x7e2f, 0x7e36, 0x7e3a, 0x7e46, 0x7e4a, 0x7e4c,
-    0x7e4d, 0x7e58, 0x7e59, 0x7e5c, 0x7eb0, 0x7ebd, 0xdeed, 0xdef4,
-    0xdef5, 0xdef8, 0xdf06, 0xdf0b, 0xdfd1
-};
-
-/*Collect the unicode lists and glyph_id offsets*/
-static const lv_font_fmt_txt_cmap_t cmaps[] =
-{
-    {
-        .range_start = 32, .range_length = 7, .glyph_id_start = 1,
-        .unicode_list = NULL, .glyph_id_ofs_list = glyph_id_ofs_list_0, .list_length = 7, .type = LV_FONT_FMT_TXT_CMAP_FORMAT0_FULL
-    },
-    {
-        .range_start = 40, .range_length = 19, .glyph_id_start = 7,
-        .unicode_list = NULL, .glyph_id_ofs_list = NULL, .list_length = 0, .type = LV_FONT_FMT_TXT_CMAP_FORMAT0_TINY
-    },
-    {
-        .range_start = 64, .range_length = 27, .glyph_id_start = 26,
-        .unicode_list = NULL, .glyph_id_ofs_list = NULL, .list_length = 0, .type = LV_FONT_FMT_TXT_CMAP_FORMAT0_TINY
-    },
-    {
-        .range_start = 94, .range_length = 2, .glyph_id_start = 53,
-        .unicode_list = NULL, .glyph_id_ofs_list = NULL, .list_length = 0, .type = LV_FONT_FMT_TXT_CMAP_FORMAT0_TINY
-    },
-    {
-        .range_start = 97, .range_length = 26, .glyph_id_start = 55,
-        .unicode_list = NULL, .glyph_id_ofs_list = NULL, .list_length = 0, .type = LV_FONT_FMT_TXT_CMAP_FORMAT0_TINY
-    },
-    {
-        .range_start = 8212, .range_length = 57298, .glyph_id_start = 81,
-        .unicode_list = unicode_list_5, .glyph_id_ofs_list = NULL, .list_length = 133, .type = LV_FONT_FMT_TXT_CMAP_SPARSE_TINY
-    }
-};
-
-/*-----------------
- *    KERNING
- *----------------*/
-
-
-/*Map glyph_ids to kern left classes*/
-static const uint8_t kern_left_class_mapping[] =
-{
-    0, 0, 0, 0, 0, 0, 0, 1,
-    0, 0, 0, 2, 3, 2, 4, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 5, 0, 6, 7, 8, 9, 10,
-    11, 12, 0, 0, 13, 14, 15, 0,
-    0, 9, 16, 9, 17, 18, 19, 20,
-    21, 22, 23, 24, 25, 0, 0, 26,
-    27, 28, 0, 29, 30, 31, 32, 0,
-    0, 33, 34, 32, 32, 27, 27, 35,
-    36, 37, 38, 35, 39, 40, 41, 42,
-    43, 3, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0
-};
-
-/*Map glyph_ids to kern right classes*/
-static const uint8_t kern_right_class_mapping[] =
-{
-    0, 0, 1, 0, 0, 0, 0, 0,
-    2, 3, 0, 4, 5, 6, 7, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 8, 0, 9, 0, 10, 0, 0,
-    0, 10, 0, 0, 11, 0, 0, 0,
-    0, 10, 0, 10, 0, 12, 13, 14,
-    15, 16, 17, 18, 19, 0, 0, 20,
-    0, 21, 21, 21, 22, 23, 0, 24,
-    25, 0, 0, 26, 26, 21, 26, 21,
-    26, 27, 28, 29, 30, 31, 32, 33,
-    34, 5, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0
-};
-
-/*Kern values between classes*/
-static const int8_t kern_class_values[] =
-{
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, -7, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    22, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, -43, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, -29, -7,
-    -20, -11, 0, -29, 0, 0, -4, 0,
-    0, 0, 7, 0, 0, -16, 0, -13,
-    -8, 0, -7, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, -7, -7,
-    -15, 0, -7, -4, -10, -21, -7, 0,
-    0, 0, 0, 0, 0, 0, 0, -8,
-    0, -4, 0, -5, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, -13, -4,
-    -24, 0, 0, 0, 0, 0, 0, 0,
-    0, -8, -9, 0, -4, 5, 5, 0,
-    0, 0, -7, 0, 0, 0, 0, 0,
-    0, 0, -14, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, -9, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, -27, 0, 0, 0,
-    0, 0, -2, -4, 0, 0, -18, -5,
-    -5, 0, -1, -5, -3, 5, 0, -4,
-    0, 0, 0, 0, 5, -5, -2, -4,
-    -3, -3, -4, 0, 0, 0, -10, 0,
-    0, 0, 0, 0, 0, 0, -6, -5,
-    -8, 0, -3, -3, -3, -5, -3, 0,
-    0, 0, 0, 0, 0, 0, 0, -4,
-    0, -5, -4, -4, -5, 0, 0, 0,
-    0, 0, -9, 0, 0, 0, 0, -10,
-    -4, -8, -6, -5, -3, -3, -3, -4,
-    -4, 0, 0, 0, -7, 0, 0, 0,
-    0, -10, -4, -5, -4, 0, -5, 0,
-    0, 0, -10, 0, 0, 0, -6, 0,
-    -4, 0, -14, 0, -8, 0, -4, -2,
-    -7, -7, -7, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, -5,
-    0, -4, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, -4, 0,
-    0, 0, 0, 0, 0, -8, 0, -4,
-    0, -11, -4, 0, 0, 0, 0, -24,
-    0, -24, -19, 0, -12, -4, -40, -7,
-    0, 0, -1, -1, -8, -2, -10, -11,
-    -5, 0, -8, 0, 0, -7, -7, -4,
-    -6, -8, -7, -9, -7, -11, 0, 0,
-    -8, 0, 0, 0, 0, 0, -3, 0,
-    0, 0, -7, 0, -5, -3, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, -8, 0, -8, 0, 0,
-    0, 0, -13, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, -13, 0, -11, 0,
-    0, 0, -4, -7, 0, -5, -7, -5,
-    -5, -4, 0, -7, 0, 0, -4, 0,
-    0, 0, -4, 0, 0, -12, -5, -8,
-    -7, -7, -8, -5, 0, 0, -47, 0,
-    -16, 0, 0, 0, -1, -9, 0, -8,
-    -36, -10, -23, -17, 0, -24, 0, 0,
-    -5, -5, -3, 0, 0, 0, 0, -7,
-    -4, -13, -11, 0, -13, 0, 0, 0,
-    0, -35, -10, -35, -22, 0, -15, 0,
-    -43, -4, -7, 0, 0, 0, -8, -4,
-    -22, -13, -8, 0, -9, 0, 0, 0,
-    -4, 0, 0, 0, 0, -5, 0, -7,
-    0, 0, -4, 0, -9, 0, 0, 0,
-    -3, 0, -6, -5, -5, 0, -1, 0,
-    -3, -3, -4, -3, -4, 0, -3, 0,
-    0, 0, 0, 0, 0, 0, 0, -4,
-    0, -4, 0, 0, -5, 0, 3, 0,
-    0, 0, 0, 0, -5, -5, -7, 0,
-    0, 0, 0, -5, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, -8, 0, 0,
-    0, 0, 0, -2, 0, 0, 0, -32,
-    -21, -32, -25, -7, -13, -8, -37, -11,
-    0, 0, 0, 0, -7, -5, -16, -21,
-    -21, -6, -21, 0, 0, -14, -18, -6,
-    -14, -10, -10, -11, -10, -22, 0, 0,
-    0, -7, 0, -7, -9, 0, -5, 0,
-    -15, -4, 0, 0, -3, 0, -4, -5,
-    0, -3, 0, 0, -4, 0, 0, 0,
-    -3, 0, 0, 0, 0, -4, 0, 0,
-    0, 0, 0, -20, -7, -20, -13, 0,
-    -5, -4, -21, -4, 0, -4, 2, 0,
-    0, 0, -7, -8, -6, 0, -7, 0,
-    0, -7, -5, 0, -10, -4, -4, -6,
-    -4, -8, 0, 0, 0, -11, -4, -11,
-    -8, 0, 0, -2, -18, -2, 0, 0,
-    0, 0, 0, 0, -2, -5, 0, 0,
-    -4, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, -4, 0, 0, -4, 0,
-    -10, 0, 0, 0, -1, -7, -3, -5,
-    -7, -4, 0, 0, 0, 0, 0, -4,
-    -4, -7, 0, 0, 0, 0, 0, -7,
-    -4, -7, -5, -4, -7, -5, 0, 0,
-    0, -29, -21, -29, -19, -9, -5, -5,
-    -30, -6, -5, -4, 0, 0, 0, 0,
-    -8, -21, -14, 0, -18, 0, 0, -13,
-    -14, -11, -11, -5, -8, -11, -5, -15,
-    0, 0, 0, 0, -10, 0, 0, 0,
-    -2, -7, -10, -10, 0, -4, -2, -2,
-    0, -5, -5, -5, -6, -7, -5, 0,
-    0, 0, 0, -5, -7, -5, -5, -8,
-    -5, 0, 0, 0, -16, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, -8, 0,
-    -7, -3, 0, -8, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, -5, 0, 0,
-    0, 0, 0, 0, 0, 0, -7, -4,
-    0, -4, 0, 0, 0, 0, 0, 0,
-    -18, 0, -7, 0, -3, -15, 0, -5,
-    0, -2, 0, 0, 0, 0, -2, -7,
-    0, -3, -3, -7, -3, -3, 0, 0,
-    0, 0, -8, 0, 0, 0, 0, 0,
-    0, 0, -7, 0, -5, 0, 0, -8,
-    0, -4, -8, 0, -4, 0, 0, 0,
-    0, -4, 0, 0, 0, 0, 0, 0,
-    0, 0, -10, 0, 2, 0, 0, 0,
-    0, 0, -7, -7, -8, 0, -7, -4,
-    0, -9, 0, -5, 0, -2, -4, 0,
-    0, 0, 0, -4, 0, -1, -1, -4,
-    -1, -2, 2, 12, 0, -17, -5, -17,
-    -4, 0, 0, 0, 0, 0, 12, 0,
-    18, 12, 8, 15, 0, -7, -4, 0,
-    -5, 0, -4, 0, -3, 0, 0, 2,
-    0, -3, 0, -5, 0, 2, -10, 0,
-    0, 0, 11, 0, 0, 0, 0, 0,
-    -9, 0, 0, 0, 0, -5, 0, -6,
-    -5, 0, 0, 0, 10, 0, 0, 0,
-    0, -3, -3, 0, 2, -5, 0, 0,
-    -10, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, -8, 0, -4, 0, 0, -7,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, -7, 2, -16, 2, 0, 2,
-    0, 0, 0, 0, -13, 0, 0, 0,
-    0, -5, 0, -4, -7, 0, -4, 0,
-    -4, 0, 0, -8, -5, 0, 0, -4,
-    0, -4, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 2, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, -7, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    -7, 0, -5, 0, 0, -10, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, -20, -8, -20, -10, 5, -5, 0,
-    -18, 0, 0, 0, 0, 0, 0, 0,
-    -4, -8, -4, 0, -4, 0, 0, 0,
-    -3, 0, 0, 5, 3, 0, 5, -3,
-    0, 0, -14, 0, 2, 0, 0, 0,
-    0, 0, 0, 0, -8, 0, -4, 0,
-    0, -7, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, -7, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, -1, -9, -1,
-    1, 2, 0, 0, 0, 0, -5, 0,
-    0, 0, 0, -3, 0, -7, -5, 0,
-    -4, 0, 0, 0, -4, -7, 0, 0,
-    0, -5, 0, 0, 0, 0, -4, -13,
-    -4, -13, -7, 0, -4, 0, -13, 0,
-    -7, 0, -4, 0, 0, -5, -4, -7,
-    -3, 0, 0, 0, -4, 0, 0, 0,
-    0, 0, 0, 0, 0, -8, 0, 0,
-    -4, -16, 0, -16, -3, 0, -3, 0,
-    -10, 0, -8, 0, -4, 0, -5, -8,
-    0, -4, -3, 0, 0, 0, -4, 0,
-    0, 0, 0, 0, 0, 0, 0, -7,
-    -5, 0, -7, 2, -5, -4, 0, 0,
-    0, -4, 0, -3, -10, 0, -6, 0,
-    -4, -11, 0, -4, -7, 0, 0, 0,
-    0, 0, 0, -8, 0, 0, 0, 0,
-    -3, 0, 0, 0, 0, -13, 0, -13,
-    -4, 0, 0, 0, -13, 0, -7, 0,
-    -3, 0, -3, -4, 0, -7, -3, 0,
-    0, 0, -4, 0, 0, 0, 0, 0,
-    0, -5, 0, -8, 0, 0, 0, 0,
-    -7, 0, 0, 0, 0, 0, 0, 0,
-    -8, 0, 0, 0, 0, -8, 0, -7,
-    -4, 0, -2, 0, 0, 0, 0, 0,
-    -4, -3, 0, 0, -3, 0
-};
-
-
-/*Collect the kern class' data in one place*/
-static const lv_font_fmt_txt_kern_classes_t kern_classes =
-{
-    .class_pair_values   = kern_class_values,
-    .left_class_mapping  = kern_left_class_mapping,
-    .right_class_mapping = kern_right_class_mapping,
-    .left_class_cnt      = 43,
-    .right_class_cnt     = 34,
-};
-
-/*--------------------
- *  ALL CUSTOM DATA
- *--------------------*/
-
-#if LVGL_VERSION_MAJOR == 8
-/*Store all the custom data of the font*/
-static  lv_font_fmt_txt_glyph_cache_t cache;
-#endif
-
-#if LVGL_VERSION_MAJOR >= 8
-static const lv_font_fmt_txt_dsc_t font_dsc = {
-#else
-static lv_font_fmt_txt_dsc_t font_dsc = {
-#endif
-    .glyph_bitmap = glyph_bitmap,
-    .glyph_dsc = glyph_dsc,
-    .cmaps = cmaps,
-    .kern_dsc = &kern_classes,
-    .kern_scale = 16,
-    .cmap_num = 6,
-    .bpp = 2,
-    .kern_classes = 1,
-    .bitmap_format = 0,
-#if LVGL_VERSION_MAJOR == 8
-    .cache = &cache
-#endif
-
-};
-
-
-
-/*-----------------
- *  PUBLIC FONT
- *----------------*/
-
-/*Initialize a public general font descriptor*/
-#if LVGL_VERSION_MAJOR >= 8
-const lv_font_t lv_font_notosanssc_16 = {
-#else
-lv_font_t lv_font_notosanssc_16 = {
-#endif
-    .get_glyph_dsc = lv_font_get_glyph_dsc_fmt_txt,    /*Function pointer to get glyph's data*/
-    .get_glyph_bitmap = lv_font_get_bitmap_fmt_txt,    /*Function pointer to get glyph's bitmap*/
-    .line_height = 19,          /*The maximum line height required by the font*/
-    .base_line = 4,             /*Baseline measured from the bottom of the line*/
-#if !(LVGL_VERSION_MAJOR == 6 && LVGL_VERSION_MINOR == 0)
-    .subpx = LV_FONT_SUBPX_NONE,
-#endif
-#if LV_VERSION_CHECK(7, 4, 0) || LVGL_VERSION_MAJOR >= 8
-    .underline_position = -2,
-    .underline_thickness = 1,
-#endif
-    .static_bitmap = 0,
-    .dsc = &font_dsc,          /*The custom font data. Will be accessed by `get_glyph_bitmap/dsc` */
-#if LV_VERSION_CHECK(8, 2, 0) || LVGL_VERSION_MAJOR >= 9
-    .fallback = NULL,
-#endif
-    .user_data = NULL,
-};
-
-
-
-#endif /*#if LV_FONT_NOTOSANSSC_16*/
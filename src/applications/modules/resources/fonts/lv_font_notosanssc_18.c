@@ -1,2625 +0,0 @@
-/*******************************************************************************
- * Size: 18 px
- * Bpp: 2
- * Opts: --bpp 2 --size 18 --no-compress --stride 1 --align 1 --font NotoSansSC-Medium.ttf --symbols  !#$%&()*+,-./0123456789:@ABCDEFGHIJKLMNOPQRSTUVWXYZ^_abcdefghijklmnopqrstuvwxyz—…。䴘䴙一上下乌了八冠凤加卷叉反发叶哥啄喜嘴噪夜大太头寿小尾山带恶戴拟捣文斑新日普暗木本来松林次水池灰燕狗珠琵白眶眼紫红统绣绿缝翅翠翡耳胜胸脚脸腰腹苇苍苦莺蓝蛇蛋蜂褐观角计通金银长阳隼雀雕雨页领颈鬼鱼鳽鵟鸟鸠鸢鸦鸫鸬鸮鸰鸲鸺鸻鹃鹊鹎鹚鹞鹠鹡鹬鹭鹰黄黑！（），：？￥ --format lvgl -o lv_font_notosanssc_18.c
- ******************************************************************************/
-
-#ifdef __has_include
-    #if __has_include("lvgl.h")
-        #ifndef LV_LVGL_H_INCLUDE_SIMPLE
-            #define LV_LVGL_H_INCLUDE_SIMPLE
-        #endif
-    #endif
-#endif
-
-#ifdef LV_LVGL_H_INCLUDE_SIMPLE
-    #include "lvgl.h"
-#else
-    #include "lvgl/lvgl.h"
-#endif
-
-
-
-#ifndef LV_FONT_NOTOSANSSC_18
-#define LV_FONT_NOTOSANSSC_18 1
-#endif
-
-#if LV_FONT_NOTOSANSSC_18
-
-/*-----------------
- *    BITMAPS
- *----------------*/
-
-/*Store the image of the glyphs*/
-static LV_ATTRIBUTE_LARGE_CONST const uint8_t glyph_bitmap[] = {
-    /* U+0020 " " */
-
-    /* U+0021 "!" */
-    0x3c, 0x3c, 0x3c, 0x3c, 0x3c, 0x3c, 0x2c, 0x2c,
-    0x2c, 0x0, 0x2c, 0x7d, 0x3c,
-
-    /* U+0023 "#" */
-    0x2, 0x83, 0x40, 0x34, 0x34, 0x3, 0x43, 0x3,
-    0xff, 0xfe, 0x1b, 0x5b, 0x50, 0x70, 0xb0, 0x7,
-    0xa, 0x0, 0xb0, 0xa0, 0x7f, 0xff, 0xd1, 0xe5,
-    0xd4, 0xd, 0xc, 0x0, 0xd0, 0xc0, 0xc, 0x1c,
-    0x0,
-
-    /* U+0024 "$" */
-    0x0, 0xb0, 0x0, 0xb, 0x0, 0x2, 0xfd, 0x0,
-    0xfe, 0xf8, 0x1e, 0x1, 0x2, 0xd0, 0x0, 0x1f,
-    0x0, 0x0, 0xbe, 0x0, 0x1, 0xfd, 0x0, 0x1,
-    0xf4, 0x0, 0x7, 0xc0, 0x0, 0x3c, 0x18, 0x7,
-    0xc3, 0xfb, 0xf4, 0x7, 0xfd, 0x0, 0xb, 0x0,
-    0x0, 0xb0, 0x0,
-
-    /* U+0025 "%" */
-    0xb, 0xd0, 0x3, 0x40, 0xf, 0x6d, 0x1, 0xc0,
-    0x3, 0x43, 0x80, 0xd0, 0x1, 0xc0, 0xb0, 0xb0,
-    0x0, 0x70, 0x2c, 0x30, 0x0, 0xd, 0xe, 0x28,
-    0x7e, 0x3, 0xc7, 0x4c, 0x75, 0xe0, 0x3f, 0x8e,
-    0x3c, 0x1c, 0x0, 0x7, 0xe, 0x7, 0x0, 0x3,
-    0x43, 0x81, 0xc0, 0x1, 0xc0, 0xf0, 0x70, 0x0,
-    0xd0, 0x1d, 0x78, 0x0, 0xa0, 0x1, 0xf8, 0x0,
-
-    /* U+0026 "&" */
-    0x1, 0xfd, 0x0, 0x1, 0xf7, 0xc0, 0x0, 0xb0,
-    0x74, 0x0, 0x2c, 0x2c, 0x0, 0x7, 0x6e, 0x0,
-    0x0, 0xfd, 0x0, 0x0, 0xbe, 0x0, 0xf0, 0xba,
-    0xd0, 0x78, 0x3c, 0x3d, 0x3c, 0x1e, 0x3, 0xfe,
-    0x3, 0xc0, 0x3f, 0x40, 0xbe, 0xbf, 0xfc, 0x7,
-    0xfd, 0xb, 0x0,
-
-    /* U+0028 "(" */
-    0x1, 0x1, 0xd0, 0xf0, 0x74, 0x2c, 0xf, 0x3,
-    0x81, 0xd0, 0x74, 0x1d, 0x7, 0x41, 0xd0, 0x38,
-    0xf, 0x2, 0xc0, 0x74, 0xf, 0x1, 0xd0, 0x10,
-
-    /* U+0029 ")" */
-    0x10, 0xf, 0x1, 0xd0, 0x38, 0xb, 0x1, 0xd0,
-    0x38, 0xe, 0x3, 0xc0, 0xf0, 0x3c, 0xe, 0x3,
-    0x81, 0xd0, 0xb0, 0x38, 0x1c, 0xe, 0x1, 0x0,
-
-    /* U+002A "*" */
-    0x7, 0x0, 0x1c, 0xf, 0xff, 0x87, 0xf4, 0x1f,
-    0xc0, 0xe3, 0x80, 0x0, 0x0,
-
-    /* U+002B "+" */
-    0x0, 0x0, 0x0, 0xb, 0x0, 0x0, 0xb0, 0x0,
-    0xb, 0x0, 0x0, 0xb0, 0x7, 0xff, 0xfe, 0x15,
-    0xf5, 0x40, 0xb, 0x0, 0x0, 0xb0, 0x0, 0xb,
-    0x0,
-
-    /* U+002C "," */
-    0x9, 0xb, 0xc1, 0xf4, 0xd, 0xb, 0xf, 0x1,
-    0x0,
-
-    /* U+002D "-" */
-    0x2a, 0x93, 0xfe,
-
-    /* U+002E "." */
-    0x78, 0xbc, 0x78,
-
-    /* U+002F "/" */
-    0x0, 0x38, 0x0, 0xc0, 0x7, 0x0, 0x38, 0x0,
-    0xd0, 0x7, 0x0, 0x2c, 0x0, 0xe0, 0x3, 0x0,
-    0x1c, 0x0, 0xe0, 0x3, 0x40, 0x1c, 0x0, 0xb0,
-    0x3, 0x80, 0xc, 0x0, 0x70, 0x1, 0x40, 0x0,
-
-    /* U+0030 "0" */
-    0x2, 0xf8, 0x0, 0xfe, 0xf0, 0x1e, 0x7, 0x83,
-    0xc0, 0x3c, 0x3c, 0x2, 0xd3, 0xc0, 0x2d, 0x3c,
-    0x2, 0xd3, 0xc0, 0x2d, 0x3c, 0x2, 0xd3, 0xc0,
-    0x3c, 0x1e, 0x7, 0x80, 0xfe, 0xf0, 0x2, 0xf8,
-    0x0,
-
-    /* U+0031 "1" */
-    0x7, 0xe0, 0xf, 0xf8, 0x1, 0x6e, 0x0, 0xb,
-    0x80, 0x2, 0xe0, 0x0, 0xb8, 0x0, 0x2e, 0x0,
-    0xb, 0x80, 0x2, 0xe0, 0x0, 0xb8, 0x0, 0x2e,
-    0x1, 0xaf, 0xe8, 0x7f, 0xff, 0x0,
-
-    /* U+0032 "2" */
-    0x7, 0xf8, 0x3, 0xfb, 0xf0, 0x24, 0xb, 0x80,
-    0x0, 0x78, 0x0, 0x7, 0x80, 0x0, 0xb4, 0x0,
-    0xf, 0x0, 0x3, 0xd0, 0x0, 0xb8, 0x0, 0x2e,
-    0x0, 0xb, 0xc0, 0x3, 0xfa, 0xfd, 0x3f, 0xff,
-    0xd0,
-
-    /* U+0033 "3" */
-    0x7, 0xfd, 0x2, 0xfb, 0xf4, 0x4, 0x7, 0xc0,
-    0x0, 0x78, 0x0, 0x1f, 0x40, 0x3f, 0xc0, 0x1,
-    0xbf, 0x0, 0x0, 0x7c, 0x0, 0x3, 0xc0, 0x0,
-    0x3c, 0x34, 0x7, 0xc3, 0xfb, 0xf4, 0xb, 0xf9,
-    0x0,
-
-    /* U+0034 "4" */
-    0x0, 0x2f, 0x0, 0x7, 0xf0, 0x0, 0xff, 0x0,
-    0x2d, 0xf0, 0x7, 0xcf, 0x0, 0xf0, 0xf0, 0x2d,
-    0xf, 0x3, 0xc0, 0xf0, 0xbf, 0xff, 0xe6, 0xaa,
-    0xf9, 0x0, 0xf, 0x0, 0x0, 0xf0, 0x0, 0xf,
-    0x0,
-
-    /* U+0035 "5" */
-    0xf, 0xff, 0x80, 0xfa, 0xa4, 0xe, 0x0, 0x1,
-    0xe0, 0x0, 0x1e, 0x54, 0x1, 0xff, 0xf0, 0x8,
-    0xb, 0xc0, 0x0, 0x3c, 0x0, 0x3, 0xd0, 0x0,
-    0x3c, 0x34, 0xb, 0xc3, 0xfb, 0xf4, 0xb, 0xf8,
-    0x0,
-
-    /* U+0036 "6" */
-    0x1, 0xfe, 0x0, 0x7f, 0xbc, 0xf, 0x0, 0x2,
-    0xd0, 0x0, 0x3c, 0x14, 0x3, 0xef, 0xf4, 0x3f,
-    0x7, 0xc3, 0xc0, 0x2d, 0x3c, 0x1, 0xd2, 0xd0,
-    0x2d, 0x1f, 0x3, 0xc0, 0xbe, 0xf8, 0x1, 0xfd,
-    0x0,
-
-    /* U+0037 "7" */
-    0x3f, 0xff, 0xd2, 0xaa, 0xbc, 0x0, 0x7, 0x40,
-    0x0, 0xf0, 0x0, 0x2d, 0x0, 0x3, 0xc0, 0x0,
-    0x74, 0x0, 0xb, 0x0, 0x0, 0xf0, 0x0, 0xf,
-    0x0, 0x1, 0xf0, 0x0, 0x1e, 0x0, 0x2, 0xe0,
-    0x0,
-
-    /* U+0038 "8" */
-    0x2, 0xfd, 0x0, 0xfa, 0xf4, 0x1d, 0x3, 0xc2,
-    0xd0, 0x3c, 0x1e, 0x3, 0x80, 0xb8, 0xb0, 0x7,
-    0xfe, 0x1, 0xd1, 0xf8, 0x3c, 0x3, 0xc3, 0x80,
-    0x2d, 0x3c, 0x3, 0xd1, 0xfa, 0xfc, 0x7, 0xfd,
-    0x0,
-
-    /* U+0039 "9" */
-    0x7, 0xf8, 0x1, 0xfa, 0xf0, 0x3c, 0x7, 0x83,
-    0xc0, 0x3c, 0x38, 0x2, 0xc3, 0xc0, 0x3d, 0x3e,
-    0x1f, 0xd0, 0xff, 0xac, 0x0, 0x43, 0xc0, 0x0,
-    0x3c, 0x4, 0xf, 0x42, 0xfb, 0xe0, 0xb, 0xf4,
-    0x0,
-
-    /* U+003A ":" */
-    0x78, 0xbc, 0x78, 0x0, 0x0, 0x0, 0x0, 0x78,
-    0xbc, 0x78,
-
-    /* U+0040 "@" */
-    0x0, 0x1b, 0xfd, 0x0, 0x1, 0xf9, 0x5b, 0xd0,
-    0x7, 0x80, 0x0, 0xb0, 0x1e, 0x0, 0x0, 0x38,
-    0x3c, 0xb, 0xec, 0x1c, 0x70, 0x2d, 0x7c, 0xd,
-    0xb0, 0x74, 0x3c, 0xd, 0xe0, 0xb0, 0x38, 0xd,
-    0xd0, 0xf0, 0x34, 0xd, 0xe0, 0xe0, 0x74, 0x2c,
-    0xe0, 0xb0, 0xf8, 0x74, 0xb0, 0x3f, 0x6f, 0xd0,
-    0x34, 0x0, 0x0, 0x0, 0x2d, 0x0, 0x0, 0x0,
-    0xb, 0x90, 0x18, 0x0, 0x1, 0xff, 0xf8, 0x0,
-    0x0, 0x0, 0x0, 0x0,
-
-    /* U+0041 "A" */
-    0x0, 0xfc, 0x0, 0x0, 0xfd, 0x0, 0x1, 0xde,
-    0x0, 0x3, 0xcf, 0x0, 0x3, 0x8b, 0x40, 0x7,
-    0x47, 0x80, 0xf, 0x3, 0xc0, 0xf, 0xab, 0xd0,
-    0x1f, 0xff, 0xe0, 0x3c, 0x0, 0xf0, 0x3c, 0x0,
-    0xf4, 0x78, 0x0, 0x78, 0xf4, 0x0, 0x3c,
-
-    /* U+0042 "B" */
-    0x7f, 0xfe, 0x1, 0xfa, 0xbf, 0x7, 0xc0, 0x3d,
-    0x1f, 0x0, 0xb4, 0x7c, 0x3, 0xc1, 0xfa, 0xbd,
-    0x7, 0xff, 0xf8, 0x1f, 0x0, 0xbc, 0x7c, 0x0,
-    0xf1, 0xf0, 0x3, 0xc7, 0xc0, 0x1f, 0x1f, 0xab,
-    0xf4, 0x7f, 0xfe, 0x0,
-
-    /* U+0043 "C" */
-    0x1, 0xff, 0x40, 0x3f, 0xff, 0x43, 0xf0, 0x8,
-    0x1f, 0x0, 0x0, 0xb4, 0x0, 0x3, 0xc0, 0x0,
-    0xf, 0x0, 0x0, 0x3d, 0x0, 0x0, 0xf4, 0x0,
-    0x1, 0xf0, 0x0, 0x3, 0xf0, 0xe, 0x3, 0xff,
-    0xf8, 0x2, 0xff, 0x40,
-
-    /* U+0044 "D" */
-    0x7f, 0xf9, 0x1, 0xfa, 0xfe, 0x7, 0xc0, 0x7e,
-    0x1f, 0x0, 0x7c, 0x7c, 0x0, 0xf5, 0xf0, 0x2,
-    0xe7, 0xc0, 0xb, 0x9f, 0x0, 0x2e, 0x7c, 0x0,
-    0xf5, 0xf0, 0x7, 0xc7, 0xc0, 0x7e, 0x1f, 0xaf,
-    0xe0, 0x7f, 0xf9, 0x0,
-
-    /* U+0045 "E" */
-    0x7f, 0xff, 0x9f, 0xaa, 0x97, 0xc0, 0x1, 0xf0,
-    0x0, 0x7c, 0x0, 0x1f, 0xaa, 0x87, 0xff, 0xe1,
-    0xf0, 0x0, 0x7c, 0x0, 0x1f, 0x0, 0x7, 0xc0,
-    0x1, 0xff, 0xfe, 0x7f, 0xff, 0xc0,
-
-    /* U+0046 "F" */
-    0x7f, 0xff, 0x9f, 0xaa, 0x97, 0xc0, 0x1, 0xf0,
-    0x0, 0x7c, 0x0, 0x1f, 0x0, 0x7, 0xff, 0xf1,
-    0xfa, 0xa8, 0x7c, 0x0, 0x1f, 0x0, 0x7, 0xc0,
-    0x1, 0xf0, 0x0, 0x7c, 0x0, 0x0,
-
-    /* U+0047 "G" */
-    0x1, 0xff, 0x80, 0x3f, 0xff, 0xc3, 0xf0, 0x5,
-    0x1f, 0x0, 0x0, 0xb4, 0x0, 0x3, 0xc0, 0x0,
-    0xf, 0x0, 0xff, 0x7d, 0x2, 0xbd, 0xf4, 0x0,
-    0xb5, 0xf0, 0x2, 0xd3, 0xf0, 0xb, 0x43, 0xff,
-    0xfc, 0x1, 0xff, 0x80,
-
-    /* U+0048 "H" */
-    0x7c, 0x0, 0xb9, 0xf0, 0x2, 0xe7, 0xc0, 0xb,
-    0x9f, 0x0, 0x2e, 0x7c, 0x0, 0xb9, 0xff, 0xff,
-    0xe7, 0xff, 0xff, 0x9f, 0x0, 0x2e, 0x7c, 0x0,
-    0xb9, 0xf0, 0x2, 0xe7, 0xc0, 0xb, 0x9f, 0x0,
-    0x2e, 0x7c, 0x0, 0xb8,
-
-    /* U+0049 "I" */
-    0x7d, 0xf7, 0xdf, 0x7d, 0xf7, 0xdf, 0x7d, 0xf7,
-    0xdf, 0x7c,
-
-    /* U+004A "J" */
-    0x0, 0xf, 0x0, 0x3, 0xc0, 0x0, 0xf0, 0x0,
-    0x3c, 0x0, 0xf, 0x0, 0x3, 0xc0, 0x0, 0xf0,
-    0x0, 0x3c, 0x0, 0xf, 0x0, 0x3, 0xc3, 0x81,
-    0xf0, 0xff, 0xf8, 0xb, 0xf4, 0x0,
-
-    /* U+004B "K" */
-    0x7c, 0x2, 0xf1, 0xf0, 0x1f, 0x7, 0xc0, 0xf0,
-    0x1f, 0xf, 0x40, 0x7c, 0xb8, 0x1, 0xfb, 0xd0,
-    0x7, 0xff, 0xc0, 0x1f, 0xcb, 0x80, 0x7d, 0xf,
-    0x1, 0xf0, 0x1f, 0x7, 0xc0, 0x3d, 0x1f, 0x0,
-    0x7c, 0x7c, 0x0, 0xb8,
-
-    /* U+004C "L" */
-    0x7c, 0x0, 0x1f, 0x0, 0x7, 0xc0, 0x1, 0xf0,
-    0x0, 0x7c, 0x0, 0x1f, 0x0, 0x7, 0xc0, 0x1,
-    0xf0, 0x0, 0x7c, 0x0, 0x1f, 0x0, 0x7, 0xc0,
-    0x1, 0xff, 0xfd, 0x7f, 0xff, 0x40,
-
-    /* U+004D "M" */
-    0x7d, 0x0, 0x1f, 0x1f, 0x80, 0xf, 0xc7, 0xf0,
-    0x3, 0xf1, 0xed, 0x1, 0xec, 0x7b, 0xc0, 0xfb,
-    0x1e, 0xb0, 0x36, 0xc7, 0x8e, 0x2c, 0xb1, 0xe3,
-    0xce, 0x2c, 0x78, 0x77, 0x4b, 0x1e, 0xf, 0xc2,
-    0xc7, 0x82, 0xe0, 0xb1, 0xe0, 0x60, 0x2c, 0x78,
-    0x0, 0xb, 0x0,
-
-    /* U+004E "N" */
-    0x7c, 0x0, 0xb5, 0xfc, 0x2, 0xd7, 0xf4, 0xb,
-    0x5e, 0xf0, 0x2d, 0x79, 0xd0, 0xb5, 0xe3, 0xc2,
-    0xd7, 0x87, 0x8b, 0x5e, 0xf, 0x1d, 0x78, 0x1e,
-    0x75, 0xe0, 0x2e, 0xd7, 0x80, 0x3f, 0x5e, 0x0,
-    0xbd, 0x78, 0x0, 0xf4,
-
-    /* U+004F "O" */
-    0x2, 0xff, 0x40, 0xf, 0xff, 0xe0, 0x3e, 0x1,
-    0xf8, 0x7c, 0x0, 0x7c, 0xf4, 0x0, 0x3d, 0xf0,
-    0x0, 0x2e, 0xf0, 0x0, 0x2e, 0xf4, 0x0, 0x2d,
-    0xb4, 0x0, 0x3d, 0x7c, 0x0, 0x7c, 0x3e, 0x1,
-    0xf4, 0xf, 0xff, 0xe0, 0x2, 0xff, 0x40,
-
-    /* U+0050 "P" */
-    0x7f, 0xfe, 0x7, 0xea, 0xfc, 0x7c, 0x2, 0xe7,
-    0xc0, 0x1f, 0x7c, 0x1, 0xf7, 0xc0, 0x3e, 0x7e,
-    0xaf, 0xc7, 0xff, 0xe0, 0x7c, 0x0, 0x7, 0xc0,
-    0x0, 0x7c, 0x0, 0x7, 0xc0, 0x0, 0x7c, 0x0,
-    0x0,
-
-    /* U+0051 "Q" */
-    0x2, 0xff, 0x40, 0xf, 0xff, 0xe0, 0x3e, 0x1,
-    0xf8, 0x7c, 0x0, 0x7c, 0xf4, 0x0, 0x3d, 0xf0,
-    0x0, 0x2e, 0xf0, 0x0, 0x2e, 0xf0, 0x0, 0x2d,
-    0xb4, 0x0, 0x3d, 0x7c, 0x0, 0x7c, 0x3e, 0x0,
-    0xf4, 0xf, 0xef, 0xe0, 0x2, 0xff, 0x40, 0x0,
-    0x3e, 0x0, 0x0, 0xf, 0xfa, 0x0, 0x2, 0xfe,
-
-    /* U+0052 "R" */
-    0x7f, 0xfe, 0x1, 0xfa, 0xbf, 0x7, 0xc0, 0x2e,
-    0x1f, 0x0, 0x3c, 0x7c, 0x1, 0xf1, 0xf0, 0x1f,
-    0x47, 0xff, 0xf8, 0x1f, 0xaf, 0x40, 0x7c, 0x2e,
-    0x1, 0xf0, 0x3d, 0x7, 0xc0, 0x7c, 0x1f, 0x0,
-    0xf4, 0x7c, 0x1, 0xf0,
-
-    /* U+0053 "S" */
-    0x2, 0xfe, 0x40, 0x3f, 0xff, 0x41, 0xf0, 0x8,
-    0xb, 0x80, 0x0, 0x1f, 0x40, 0x0, 0x2f, 0xd0,
-    0x0, 0x1f, 0xf4, 0x0, 0x6, 0xf8, 0x0, 0x1,
-    0xf0, 0x0, 0x3, 0xc2, 0xd0, 0x1f, 0xb, 0xff,
-    0xf4, 0x6, 0xfe, 0x0,
-
-    /* U+0054 "T" */
-    0x7f, 0xff, 0xf5, 0xab, 0xfa, 0x90, 0xb, 0x80,
-    0x0, 0x2e, 0x0, 0x0, 0xb8, 0x0, 0x2, 0xe0,
-    0x0, 0xb, 0x80, 0x0, 0x2e, 0x0, 0x0, 0xb8,
-    0x0, 0x2, 0xe0, 0x0, 0xb, 0x80, 0x0, 0x2e,
-    0x0, 0x0, 0xb8, 0x0,
-
-    /* U+0055 "U" */
-    0x7c, 0x0, 0xb9, 0xf0, 0x2, 0xe7, 0xc0, 0xb,
-    0x9f, 0x0, 0x2e, 0x7c, 0x0, 0xb9, 0xf0, 0x2,
-    0xe7, 0xc0, 0xb, 0x9f, 0x0, 0x2e, 0x7c, 0x0,
-    0xb4, 0xf0, 0x3, 0xd2, 0xe0, 0x2f, 0x3, 0xff,
-    0xf4, 0x2, 0xfe, 0x0,
-
-    /* U+0056 "V" */
-    0x3d, 0x0, 0x2e, 0x2e, 0x0, 0x3d, 0xf, 0x0,
-    0x3c, 0xf, 0x0, 0x78, 0xb, 0x40, 0xb4, 0x7,
-    0xc0, 0xf0, 0x3, 0xc1, 0xe0, 0x2, 0xd2, 0xd0,
-    0x1, 0xe3, 0xc0, 0x0, 0xf3, 0x80, 0x0, 0xbb,
-    0x40, 0x0, 0x7f, 0x0, 0x0, 0x3f, 0x0,
-
-    /* U+0057 "W" */
-    0x78, 0x3, 0xc0, 0x1e, 0x7c, 0x3, 0xd0, 0x2d,
-    0x3c, 0x7, 0xe0, 0x3c, 0x3c, 0xb, 0xf0, 0x3c,
-    0x2d, 0xe, 0xb0, 0x3c, 0x1e, 0xd, 0x74, 0x78,
-    0x1f, 0x1c, 0x38, 0xb4, 0xf, 0x2c, 0x3c, 0xb0,
-    0xf, 0x38, 0x2c, 0xf0, 0xb, 0x74, 0x1d, 0xf0,
-    0x7, 0xf0, 0xf, 0xe0, 0x3, 0xf0, 0xf, 0xd0,
-    0x3, 0xf0, 0xb, 0xc0,
-
-    /* U+0058 "X" */
-    0x3c, 0x0, 0xf0, 0xb8, 0xf, 0x40, 0xf0, 0x7c,
-    0x1, 0xe3, 0xd0, 0x3, 0xde, 0x0, 0x7, 0xf0,
-    0x0, 0xf, 0xc0, 0x0, 0xbf, 0x40, 0x3, 0xdf,
-    0x0, 0x2d, 0x2d, 0x1, 0xf0, 0x3c, 0xf, 0x40,
-    0xb8, 0x7c, 0x0, 0xf0,
-
-    /* U+0059 "Y" */
-    0x3d, 0x0, 0x7c, 0x1f, 0x0, 0xf4, 0xf, 0x41,
-    0xf0, 0x7, 0x82, 0xd0, 0x3, 0xc3, 0xc0, 0x1,
-    0xeb, 0x40, 0x0, 0xff, 0x0, 0x0, 0x7d, 0x0,
-    0x0, 0x3c, 0x0, 0x0, 0x3c, 0x0, 0x0, 0x3c,
-    0x0, 0x0, 0x3c, 0x0, 0x0, 0x3c, 0x0,
-
-    /* U+005A "Z" */
-    0x2f, 0xff, 0xf0, 0x6a, 0xaf, 0xc0, 0x0, 0x3c,
-    0x0, 0x2, 0xe0, 0x0, 0x1f, 0x0, 0x0, 0xf0,
-    0x0, 0xb, 0x80, 0x0, 0x7c, 0x0, 0x3, 0xd0,
-    0x0, 0x2e, 0x0, 0x1, 0xf0, 0x0, 0xf, 0xff,
-    0xfc, 0x3f, 0xff, 0xf0,
-
-    /* U+005E "^" */
-    0x3, 0xc0, 0x1, 0xf8, 0x0, 0xbb, 0x0, 0x39,
-    0xd0, 0x1c, 0x3c, 0xf, 0xb, 0x7, 0x40, 0xe2,
-    0xc0, 0x3c,
-
-    /* U+005F "_" */
-    0x0, 0x0, 0xf, 0xff, 0xff, 0x0, 0x0, 0x0,
-
-    /* U+0061 "a" */
-    0x6, 0xfd, 0x7, 0xeb, 0xd0, 0x40, 0x7c, 0x0,
-    0x1f, 0x2, 0xff, 0xc7, 0xd0, 0xf3, 0xc0, 0x3c,
-    0xf0, 0x1f, 0x2f, 0xbf, 0xc2, 0xf8, 0xf0,
-
-    /* U+0062 "b" */
-    0x78, 0x0, 0x7, 0x80, 0x0, 0x78, 0x0, 0x7,
-    0x80, 0x0, 0x79, 0xfd, 0x7, 0xff, 0xf8, 0x7c,
-    0x7, 0xc7, 0x80, 0x3d, 0x78, 0x2, 0xd7, 0x80,
-    0x2d, 0x78, 0x3, 0xc7, 0xc0, 0xbc, 0x7f, 0xff,
-    0x47, 0x6f, 0x80,
-
-    /* U+0063 "c" */
-    0x1, 0xfe, 0x3, 0xfb, 0xd2, 0xf0, 0x0, 0xf4,
-    0x0, 0x3c, 0x0, 0xf, 0x0, 0x3, 0xd0, 0x0,
-    0xbc, 0x4, 0xf, 0xef, 0x80, 0xbf, 0x80,
-
-    /* U+0064 "d" */
-    0x0, 0x1, 0xf0, 0x0, 0x1f, 0x0, 0x1, 0xf0,
-    0x0, 0x1f, 0x2, 0xf9, 0xf0, 0xfe, 0xff, 0x2f,
-    0x1, 0xf3, 0xd0, 0x1f, 0x3c, 0x1, 0xf3, 0xc0,
-    0x1f, 0x3d, 0x1, 0xf2, 0xf0, 0x2f, 0xf, 0xef,
-    0xf0, 0x2f, 0x8f,
-
-    /* U+0065 "e" */
-    0x2, 0xfd, 0x0, 0xfe, 0xf8, 0x2e, 0x3, 0xc3,
-    0xc0, 0x1d, 0x3f, 0xff, 0xd3, 0xd5, 0x54, 0x3c,
-    0x0, 0x2, 0xf0, 0x0, 0xf, 0xeb, 0xc0, 0x2f,
-    0xe4,
-
-    /* U+0066 "f" */
-    0x2, 0xf8, 0x2f, 0x90, 0xf0, 0x3, 0xc0, 0x7f,
-    0xf1, 0xbe, 0x80, 0xf0, 0x3, 0xc0, 0xf, 0x0,
-    0x3c, 0x0, 0xf0, 0x3, 0xc0, 0xf, 0x0, 0x3c,
-    0x0,
-
-    /* U+0067 "g" */
-    0x7, 0xff, 0xf0, 0x7e, 0xbf, 0xc2, 0xd0, 0x78,
-    0xf, 0x0, 0xe0, 0x1e, 0xb, 0x40, 0x3f, 0xf8,
-    0x1, 0xd0, 0x0, 0xb, 0x0, 0x0, 0x1f, 0xaa,
-    0x40, 0x3f, 0xff, 0xc3, 0xc0, 0xf, 0xe, 0x0,
-    0x3c, 0x3e, 0x5b, 0xd0, 0x2f, 0xf8, 0x0,
-
-    /* U+0068 "h" */
-    0x78, 0x0, 0x1e, 0x0, 0x7, 0x80, 0x1, 0xe0,
-    0x0, 0x78, 0xfd, 0x1f, 0xff, 0xd7, 0xd0, 0xb9,
-    0xe0, 0x1f, 0x78, 0x7, 0xde, 0x1, 0xf7, 0x80,
-    0x7d, 0xe0, 0x1f, 0x78, 0x7, 0xde, 0x1, 0xf0,
-
-    /* U+0069 "i" */
-    0x7a, 0xf1, 0x0, 0x79, 0xe7, 0x9e, 0x79, 0xe7,
-    0x9e, 0x79, 0xe0,
-
-    /* U+006A "j" */
-    0x7, 0x82, 0xf0, 0x10, 0x0, 0x7, 0x81, 0xe0,
-    0x78, 0x1e, 0x7, 0x81, 0xe0, 0x78, 0x1e, 0x7,
-    0x81, 0xe0, 0x78, 0x2e, 0x6f, 0x6f, 0x40,
-
-    /* U+006B "k" */
-    0x78, 0x0, 0x7, 0x80, 0x0, 0x78, 0x0, 0x7,
-    0x80, 0x0, 0x78, 0xf, 0x47, 0x82, 0xe0, 0x78,
-    0x78, 0x7, 0x9f, 0x0, 0x7b, 0xe0, 0x7, 0xff,
-    0x40, 0x7d, 0x3c, 0x7, 0x82, 0xe0, 0x78, 0xf,
-    0x47, 0x80, 0x7c,
-
-    /* U+006C "l" */
-    0x78, 0x78, 0x78, 0x78, 0x78, 0x78, 0x78, 0x78,
-    0x78, 0x78, 0x78, 0x78, 0x7d, 0x2e,
-
-    /* U+006D "m" */
-    0x75, 0xfd, 0x1f, 0xd1, 0xfe, 0xbe, 0xeb, 0xc7,
-    0xc0, 0xbc, 0xf, 0x5e, 0x2, 0xe0, 0x2e, 0x78,
-    0xb, 0x80, 0xb9, 0xe0, 0x2e, 0x2, 0xe7, 0x80,
-    0xb8, 0xb, 0x9e, 0x2, 0xe0, 0x2e, 0x78, 0xb,
-    0x80, 0xb9, 0xe0, 0x2e, 0x2, 0xe0,
-
-    /* U+006E "n" */
-    0x75, 0xfd, 0x1f, 0xeb, 0xd7, 0xc0, 0xb9, 0xe0,
-    0x1f, 0x78, 0x7, 0xde, 0x1, 0xf7, 0x80, 0x7d,
-    0xe0, 0x1f, 0x78, 0x7, 0xde, 0x1, 0xf0,
-
-    /* U+006F "o" */
-    0x2, 0xfe, 0x0, 0x3f, 0xbf, 0x2, 0xf0, 0x2e,
-    0xf, 0x0, 0x3c, 0x3c, 0x0, 0xf0, 0xf0, 0x3,
-    0xc3, 0xc0, 0xf, 0xb, 0xc0, 0xb8, 0xf, 0xef,
-    0xc0, 0xb, 0xf8, 0x0,
-
-    /* U+0070 "p" */
-    0x75, 0xfd, 0x7, 0xfa, 0xf8, 0x7c, 0x3, 0xc7,
-    0x80, 0x3d, 0x78, 0x2, 0xd7, 0x80, 0x3d, 0x78,
-    0x3, 0xc7, 0xc0, 0xbc, 0x7f, 0xff, 0x47, 0xaf,
-    0x80, 0x78, 0x0, 0x7, 0x80, 0x0, 0x78, 0x0,
-    0x7, 0x80, 0x0,
-
-    /* U+0071 "q" */
-    0x2, 0xf8, 0xf0, 0xfe, 0xff, 0x2f, 0x1, 0xf3,
-    0xd0, 0x1f, 0x3c, 0x1, 0xf3, 0xc0, 0x1f, 0x3d,
-    0x1, 0xf2, 0xf0, 0x2f, 0xf, 0xef, 0xf0, 0x2f,
-    0x9f, 0x0, 0x1, 0xf0, 0x0, 0x1f, 0x0, 0x1,
-    0xf0, 0x0, 0x1f,
-
-    /* U+0072 "r" */
-    0x0, 0x1, 0xd7, 0xd7, 0xba, 0x1f, 0x40, 0x7c,
-    0x1, 0xe0, 0x7, 0x80, 0x1e, 0x0, 0x78, 0x1,
-    0xe0, 0x7, 0x80, 0x0,
-
-    /* U+0073 "s" */
-    0xb, 0xf8, 0xb, 0xeb, 0x83, 0xc0, 0x0, 0xf8,
-    0x0, 0xf, 0xe0, 0x0, 0x7f, 0x40, 0x1, 0xf0,
-    0x40, 0x3c, 0x3e, 0xbe, 0x6, 0xfd, 0x0,
-
-    /* U+0074 "t" */
-    0x5, 0x0, 0x3c, 0x0, 0xf0, 0x1f, 0xfe, 0x6f,
-    0xa4, 0x3c, 0x0, 0xf0, 0x3, 0xc0, 0xf, 0x0,
-    0x3c, 0x0, 0xf0, 0x2, 0xf9, 0x2, 0xf8,
-
-    /* U+0075 "u" */
-    0xb8, 0x7, 0xae, 0x1, 0xeb, 0x80, 0x7a, 0xe0,
-    0x1e, 0xb8, 0x7, 0xae, 0x1, 0xeb, 0x80, 0x79,
-    0xf0, 0x3e, 0x3f, 0xfb, 0x87, 0xf4, 0xe0,
-
-    /* U+0076 "v" */
-    0xb8, 0x2, 0xd3, 0xc0, 0x3c, 0x3c, 0x3, 0x82,
-    0xd0, 0xb4, 0xf, 0xf, 0x0, 0xf0, 0xe0, 0x7,
-    0x5d, 0x0, 0x3b, 0xc0, 0x3, 0xf8, 0x0, 0x1f,
-    0x40,
-
-    /* U+0077 "w" */
-    0x78, 0xb, 0x80, 0xb4, 0xf0, 0x3f, 0x3, 0xc3,
-    0xc0, 0xfc, 0xf, 0xb, 0x47, 0x74, 0x78, 0x1e,
-    0x2c, 0xe2, 0xd0, 0x3c, 0xe3, 0xcf, 0x0, 0xf3,
-    0x4b, 0x3c, 0x2, 0xec, 0x1e, 0xe0, 0x3, 0xf0,
-    0x3f, 0x40, 0xf, 0x80, 0xfc, 0x0,
-
-    /* U+0078 "x" */
-    0x3c, 0x7, 0x82, 0xe0, 0xf0, 0xf, 0x1d, 0x0,
-    0x7f, 0xc0, 0x2, 0xf4, 0x0, 0x3f, 0x40, 0xb,
-    0x7c, 0x0, 0xf2, 0xe0, 0x3d, 0xf, 0x7, 0x80,
-    0x7c,
-
-    /* U+0079 "y" */
-    0xb8, 0x2, 0xd3, 0xc0, 0x3c, 0x3c, 0x3, 0x81,
-    0xe0, 0xb4, 0xf, 0xf, 0x0, 0xb4, 0xe0, 0x3,
-    0x9d, 0x0, 0x3f, 0xc0, 0x1, 0xf8, 0x0, 0xf,
-    0x40, 0x0, 0xf0, 0x0, 0x2d, 0x0, 0x2f, 0xc0,
-    0x3, 0xe0, 0x0,
-
-    /* U+007A "z" */
-    0x3f, 0xff, 0xa, 0xaf, 0xc0, 0x3, 0xc0, 0x2,
-    0xe0, 0x1, 0xf0, 0x0, 0xf0, 0x0, 0xb8, 0x0,
-    0x7c, 0x0, 0x3f, 0xaa, 0x1f, 0xff, 0xd0,
-
-    /* U+2014 "—" */
-    0x0, 0x0, 0x0, 0x0, 0x3f, 0xff, 0xff, 0xfd,
-    0x15, 0x55, 0x55, 0x54,
-
-    /* U+2026 "…" */
-    0x14, 0x1, 0x40, 0x14, 0x3c, 0x3, 0xc0, 0x3c,
-    0x3c, 0x3, 0xc0, 0x3c,
-
-    /* U+3002 "。" */
-    0x0, 0x0, 0x7f, 0x43, 0x3, 0x1c, 0xd, 0x34,
-    0x70, 0x3f, 0x0,
-
-    /* U+4D18 "䴘" */
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x6d, 0x7,
-    0x0, 0x2f, 0xfe, 0x41, 0xf5, 0x3, 0x82, 0x80,
-    0x7f, 0xf4, 0x34, 0x2f, 0xe7, 0x43, 0x43, 0x57,
-    0x95, 0x7b, 0xb4, 0x37, 0xff, 0xfb, 0x17, 0x43,
-    0x76, 0x83, 0x71, 0xb0, 0x37, 0xbf, 0x57, 0x3e,
-    0x3, 0x7a, 0x82, 0x75, 0x54, 0x37, 0x1f, 0xe7,
-    0xff, 0xc3, 0x71, 0x64, 0x0, 0x1c, 0x37, 0x3f,
-    0x45, 0x55, 0xc3, 0x73, 0x34, 0xff, 0xec, 0x7a,
-    0x63, 0xa0, 0x2, 0xce, 0xed, 0x3c, 0x0, 0x78,
-    0x4, 0x81, 0x0, 0x2f, 0x40,
-
-    /* U+4D19 "䴙" */
-    0x0, 0x1, 0x40, 0x34, 0x2, 0xfd, 0x1c, 0x1b,
-    0x94, 0x2d, 0xdf, 0xfb, 0xff, 0xc2, 0xcd, 0x67,
-    0x79, 0x28, 0x2c, 0xd6, 0x37, 0xba, 0x82, 0xfd,
-    0x73, 0x34, 0x78, 0x2d, 0x47, 0x63, 0x5b, 0x42,
-    0x80, 0xff, 0xf4, 0x90, 0x2e, 0x91, 0xc3, 0x95,
-    0x42, 0xfe, 0x1c, 0x3f, 0xfd, 0x3d, 0xa6, 0xd0,
-    0x1, 0xd3, 0xda, 0xff, 0x95, 0x5c, 0x3d, 0xa1,
-    0xc3, 0xfe, 0xc7, 0xda, 0x1c, 0x0, 0x1c, 0x2f,
-    0xe1, 0xc0, 0x2, 0xc0, 0xd0, 0x1c, 0x2, 0xf4,
-    0x0, 0x0, 0x0, 0x0, 0x0,
-
-    /* U+4E00 "一" */
-    0x3f, 0xff, 0xff, 0xff, 0xd3, 0xff, 0xff, 0xff,
-    0xfd,
-
-    /* U+4E0A "上" */
-    0x0, 0x2, 0xc0, 0x0, 0x0, 0x0, 0xb0, 0x0,
-    0x0, 0x0, 0x2c, 0x0, 0x0, 0x0, 0xb, 0x0,
-    0x0, 0x0, 0x2, 0xc0, 0x0, 0x0, 0x0, 0xba,
-    0xaa, 0x40, 0x0, 0x2f, 0xff, 0xe0, 0x0, 0xb,
-    0x0, 0x0, 0x0, 0x2, 0xc0, 0x0, 0x0, 0x0,
-    0xb0, 0x0, 0x0, 0x0, 0x2c, 0x0, 0x0, 0x0,
-    0xb, 0x0, 0x0, 0x0, 0x2, 0xc0, 0x0, 0x0,
-    0x0, 0xb0, 0x0, 0x7, 0xff, 0xff, 0xff, 0xfd,
-    0xaa, 0xaa, 0xaa, 0xaa,
-
-    /* U+4E0B "下" */
-    0xbf, 0xff, 0xff, 0xff, 0x2f, 0xff, 0xff, 0xff,
-    0xc0, 0x0, 0x3c, 0x0, 0x0, 0x0, 0xf, 0x0,
-    0x0, 0x0, 0x3, 0xd0, 0x0, 0x0, 0x0, 0xff,
-    0x40, 0x0, 0x0, 0x3e, 0xfc, 0x0, 0x0, 0xf,
-    0xf, 0xe0, 0x0, 0x3, 0xc0, 0x7c, 0x0, 0x0,
-    0xf0, 0x0, 0x0, 0x0, 0x3c, 0x0, 0x0, 0x0,
-    0xf, 0x0, 0x0, 0x0, 0x3, 0xc0, 0x0, 0x0,
-    0x0, 0xf0, 0x0, 0x0, 0x0, 0x3c, 0x0, 0x0,
-
-    /* U+4E4C "乌" */
-    0x0, 0x0, 0x40, 0x0, 0x0, 0x0, 0xb0, 0x0,
-    0x0, 0x15, 0x7d, 0x55, 0x40, 0xb, 0xff, 0xff,
-    0xf0, 0x2, 0xc0, 0x0, 0x3c, 0x0, 0xb0, 0x0,
-    0xf, 0x0, 0x2c, 0x0, 0x5b, 0x80, 0xb, 0x0,
-    0x2f, 0xc0, 0x2, 0xc0, 0x0, 0x0, 0x0, 0xbf,
-    0xff, 0xff, 0xe0, 0x1a, 0xaa, 0xaa, 0xb8, 0x0,
-    0x0, 0x0, 0xe, 0x2a, 0xaa, 0xaa, 0x93, 0x8f,
-    0xff, 0xff, 0xf8, 0xd0, 0x0, 0x0, 0x0, 0x74,
-    0x0, 0x0, 0xa, 0xbc, 0x0, 0x0, 0x2, 0xfd,
-    0x0, 0x0, 0x0, 0x0, 0x0,
-
-    /* U+4E86 "了" */
-    0x0, 0x0, 0x0, 0x0, 0x7f, 0xff, 0xff, 0xf8,
-    0x2a, 0xaa, 0xab, 0xf8, 0x0, 0x0, 0x7, 0xd0,
-    0x0, 0x0, 0x2f, 0x40, 0x0, 0x1, 0xf8, 0x0,
-    0x0, 0x3, 0xc0, 0x0, 0x0, 0x3, 0xc0, 0x0,
-    0x0, 0x3, 0xc0, 0x0, 0x0, 0x3, 0xc0, 0x0,
-    0x0, 0x3, 0xc0, 0x0, 0x0, 0x3, 0xc0, 0x0,
-    0x0, 0x3, 0xc0, 0x0, 0x0, 0x3, 0xc0, 0x0,
-    0x1, 0xab, 0xc0, 0x0, 0x0, 0xff, 0x40, 0x0,
-    0x0, 0x0, 0x0, 0x0,
-
-    /* U+516B "八" */
-    0x0, 0x14, 0x7, 0x0, 0x0, 0x3, 0xc0, 0x74,
-    0x0, 0x0, 0x3c, 0x7, 0x40, 0x0, 0x3, 0xc0,
-    0x38, 0x0, 0x0, 0x38, 0x3, 0x80, 0x0, 0x7,
-    0x80, 0x3c, 0x0, 0x0, 0x74, 0x2, 0xc0, 0x0,
-    0xb, 0x0, 0x1d, 0x0, 0x0, 0xf0, 0x0, 0xf0,
-    0x0, 0x1e, 0x0, 0xb, 0x0, 0x3, 0xc0, 0x0,
-    0x78, 0x0, 0x78, 0x0, 0x3, 0xd0, 0xf, 0x0,
-    0x0, 0x1f, 0x3, 0xe0, 0x0, 0x0, 0xbc, 0x38,
-    0x0, 0x0, 0x3, 0xc0, 0x0, 0x0, 0x0, 0x0,
-
-    /* U+51A0 "冠" */
-    0x2f, 0xff, 0xff, 0xff, 0xc2, 0xea, 0xaa, 0xaa,
-    0xbc, 0x2c, 0x0, 0x0, 0x7, 0x80, 0xff, 0xf4,
-    0x1, 0xc0, 0xa, 0xaa, 0x55, 0x6e, 0x40, 0x0,
-    0x3, 0xff, 0xfc, 0x2a, 0xaa, 0x80, 0x1d, 0x3,
-    0xff, 0xfd, 0xe1, 0xc0, 0x3, 0x4e, 0xb, 0x1c,
-    0x0, 0x34, 0xe0, 0x35, 0xc0, 0x7, 0xe, 0x0,
-    0x1c, 0x0, 0xb0, 0xe0, 0x1b, 0xc4, 0xe, 0xe,
-    0x0, 0xf8, 0xd3, 0xc0, 0xfa, 0xaa, 0xbc, 0x34,
-    0x7, 0xff, 0xff, 0x80, 0x0, 0x0, 0x0, 0x0,
-
-    /* U+51E4 "凤" */
-    0xb, 0xff, 0xff, 0xfc, 0x0, 0xba, 0xaa, 0xab,
-    0xc0, 0xb, 0x0, 0x0, 0x2c, 0x0, 0xb2, 0xff,
-    0xf6, 0xc0, 0xb, 0x1a, 0xab, 0x2c, 0x0, 0xb0,
-    0x0, 0xb2, 0xc0, 0xb, 0x1d, 0xe, 0x2c, 0x0,
-    0xb0, 0xf6, 0xc2, 0xc0, 0xf, 0x2, 0xf8, 0x2c,
-    0x0, 0xf0, 0xf, 0x82, 0xc0, 0xe, 0x2, 0xfd,
-    0x1c, 0x1, 0xd0, 0xf4, 0xb5, 0xc8, 0x2c, 0x7d,
-    0x3, 0x4d, 0xc3, 0xc2, 0x0, 0x0, 0xfc, 0x74,
-    0x0, 0x0, 0x7, 0x80, 0x0, 0x0, 0x0, 0x0,
-
-    /* U+52A0 "加" */
-    0x2, 0xc0, 0x0, 0x0, 0x0, 0xb0, 0x0, 0x0,
-    0x0, 0x2c, 0x0, 0xff, 0xf8, 0xff, 0xff, 0x3e,
-    0xae, 0x2b, 0xeb, 0xcf, 0x3, 0x80, 0xf0, 0xf3,
-    0xc0, 0xe0, 0x3c, 0x3c, 0xf0, 0x38, 0xf, 0xf,
-    0x3c, 0xe, 0x3, 0x83, 0xcf, 0x3, 0x80, 0xe0,
-    0xf3, 0xc0, 0xe0, 0x74, 0x3c, 0xf0, 0x38, 0x2c,
-    0xe, 0x3c, 0xe, 0xf, 0x3, 0x8f, 0x3, 0x87,
-    0x80, 0xe3, 0xea, 0xe3, 0xc6, 0xf4, 0xff, 0xf8,
-    0xd1, 0xfc, 0x3c, 0xe, 0x0, 0x0, 0x0, 0x0,
-    0x0,
-
-    /* U+5377 "卷" */
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x9, 0xb, 0x2,
-    0x0, 0x0, 0xf0, 0xf0, 0xb0, 0x0, 0x17, 0x9f,
-    0x5e, 0x40, 0xf, 0xff, 0xff, 0xff, 0x0, 0x0,
-    0x7c, 0x0, 0x0, 0x0, 0xb, 0x40, 0x0, 0x3,
-    0xff, 0xff, 0xff, 0xfc, 0x15, 0xfd, 0x5b, 0xe5,
-    0x40, 0x2f, 0x0, 0x1f, 0x40, 0x1f, 0xff, 0xff,
-    0xfe, 0x43, 0xdb, 0xaa, 0xb8, 0xbc, 0x0, 0xb0,
-    0x3, 0x80, 0x40, 0xb, 0xb, 0xf4, 0x0, 0x0,
-    0xb0, 0x15, 0xd, 0x0, 0xb, 0xaa, 0xab, 0xc0,
-    0x0, 0x2f, 0xff, 0xf8, 0x0,
-
-    /* U+53C9 "叉" */
-    0xa, 0xaa, 0xaa, 0xa9, 0x1, 0xff, 0xff, 0xff,
-    0xe0, 0x3, 0xc0, 0x0, 0x2d, 0x0, 0x2c, 0x2c,
-    0x3, 0xc0, 0x0, 0xe0, 0xf0, 0x78, 0x0, 0xb,
-    0x3, 0x8f, 0x0, 0x0, 0x3c, 0x1, 0xd0, 0x0,
-    0x2, 0xd0, 0x3c, 0x0, 0x0, 0xf, 0x4f, 0x0,
-    0x0, 0x0, 0x3f, 0xd0, 0x0, 0x0, 0x2, 0xf8,
-    0x0, 0x0, 0x0, 0xbf, 0xf0, 0x0, 0x0, 0xbf,
-    0xb, 0xf4, 0x1, 0xff, 0x40, 0x1f, 0xf8, 0x3f,
-    0x40, 0x0, 0xb, 0xc0, 0x0, 0x0, 0x0, 0x0,
-
-    /* U+53CD "反" */
-    0x0, 0x0, 0x1, 0x6c, 0x0, 0x2a, 0xbf, 0xff,
-    0xe0, 0x3, 0xff, 0xa5, 0x0, 0x0, 0x38, 0x0,
-    0x0, 0x0, 0x3, 0x80, 0x0, 0x0, 0x0, 0x3f,
-    0xff, 0xff, 0xe0, 0x3, 0xff, 0xaa, 0xbd, 0x0,
-    0x38, 0xe0, 0x3, 0xc0, 0x3, 0x8b, 0x40, 0x78,
-    0x0, 0x74, 0x3c, 0xf, 0x0, 0x7, 0x41, 0xe2,
-    0xe0, 0x0, 0xb0, 0xb, 0xf8, 0x0, 0xf, 0x0,
-    0x3f, 0x0, 0x0, 0xe0, 0x2f, 0xfe, 0x0, 0x2d,
-    0x6f, 0xd1, 0xfe, 0x43, 0xc7, 0xd0, 0x1, 0xb8,
-    0x0, 0x0, 0x0, 0x0, 0x0,
-
-    /* U+53D1 "发" */
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x4, 0xf, 0x6,
-    0x0, 0x1, 0xe0, 0xf0, 0x78, 0x0, 0x2c, 0x1e,
-    0x2, 0xd0, 0x3, 0x82, 0xd0, 0x4, 0x0, 0xff,
-    0xff, 0xff, 0xfc, 0x6, 0xab, 0xea, 0xaa, 0x80,
-    0x0, 0x78, 0x0, 0x0, 0x0, 0xf, 0xff, 0xfd,
-    0x0, 0x1, 0xfa, 0xab, 0xc0, 0x0, 0x3f, 0x80,
-    0x78, 0x0, 0xb, 0xad, 0xf, 0x0, 0x2, 0xf0,
-    0xf7, 0xd0, 0x0, 0xbc, 0x3, 0xf8, 0x0, 0x3f,
-    0x0, 0xbf, 0xd0, 0x2, 0x81, 0xbf, 0x2f, 0xe4,
-    0x0, 0x7e, 0x40, 0x2f, 0xc0, 0x1, 0x0, 0x0,
-    0x0,
-
-    /* U+53F6 "叶" */
-    0x0, 0x0, 0xf, 0x0, 0x1a, 0xa4, 0x3, 0xc0,
-    0xb, 0xff, 0x0, 0xf0, 0x2, 0xc3, 0xc0, 0x3c,
-    0x0, 0xb0, 0xf0, 0xf, 0x0, 0x2c, 0x3c, 0x3,
-    0xc0, 0xb, 0xf, 0xff, 0xff, 0xf6, 0xc3, 0xea,
-    0xbe, 0xa9, 0xb0, 0xf0, 0xf, 0x0, 0x2c, 0x3c,
-    0x3, 0xc0, 0xb, 0xaf, 0x0, 0xf0, 0x2, 0xff,
-    0xc0, 0x3c, 0x0, 0xb0, 0x0, 0xf, 0x0, 0x14,
-    0x0, 0x3, 0xc0, 0x0, 0x0, 0x0, 0xf0, 0x0,
-    0x0, 0x0, 0x3c, 0x0,
-
-    /* U+54E5 "哥" */
-    0x2f, 0xff, 0xff, 0xff, 0xc0, 0x0, 0x0, 0x3,
-    0xc0, 0x3, 0xff, 0xfd, 0x3c, 0x0, 0x38, 0x1,
-    0xd3, 0xc0, 0x3, 0x80, 0x1d, 0x3c, 0x0, 0x3f,
-    0xff, 0xc3, 0xc0, 0x15, 0x55, 0x55, 0x7d, 0x43,
-    0xff, 0xff, 0xff, 0xfc, 0x0, 0x0, 0x0, 0x2c,
-    0x0, 0x15, 0x55, 0x42, 0xc0, 0x3, 0xff, 0xfc,
-    0x2c, 0x0, 0x38, 0x2, 0xc2, 0xc0, 0x3, 0xff,
-    0xfc, 0x2c, 0x0, 0x3d, 0x55, 0xab, 0xc0, 0x0,
-    0x0, 0x3, 0xf8, 0x0, 0x0, 0x0, 0x0, 0x0,
-
-    /* U+5544 "啄" */
-    0x6a, 0x9f, 0xff, 0xff, 0x2f, 0xf6, 0xaf, 0xea,
-    0x8b, 0x2c, 0x7, 0xc0, 0x2, 0xcb, 0xb, 0xc0,
-    0x14, 0xb2, 0xef, 0x7c, 0x1f, 0x2c, 0xba, 0xb,
-    0xaf, 0xb, 0x2c, 0xab, 0xff, 0x2, 0xcb, 0x1f,
-    0x1d, 0xd0, 0xb2, 0xef, 0xcf, 0x78, 0x2f, 0xf1,
-    0x2f, 0xe7, 0xb, 0xa8, 0xf, 0x38, 0xe2, 0xc0,
-    0x2e, 0xd, 0x2c, 0x0, 0x2d, 0x7, 0x43, 0x0,
-    0x0, 0x2b, 0xc0, 0x0, 0x0, 0xf, 0xc0, 0x0,
-    0x0, 0x0, 0x0, 0x0,
-
-    /* U+559C "喜" */
-    0x0, 0x0, 0xf0, 0x0, 0x2, 0xff, 0xff, 0xff,
-    0xf8, 0x0, 0x0, 0xf0, 0x0, 0x0, 0x6a, 0xaf,
-    0xaa, 0x90, 0x1, 0x55, 0x55, 0x54, 0x0, 0x2f,
-    0xff, 0xff, 0x80, 0x2, 0xc0, 0x0, 0x38, 0x0,
-    0x2d, 0x0, 0x7, 0x80, 0x1, 0xff, 0xff, 0xf8,
-    0x0, 0x3, 0x80, 0x2c, 0x0, 0x3f, 0xff, 0xff,
-    0xff, 0xc1, 0x55, 0x55, 0x55, 0x54, 0x3, 0xff,
-    0xff, 0xfc, 0x0, 0x3c, 0x0, 0x3, 0xc0, 0x3,
-    0xc0, 0x0, 0x3c, 0x0, 0x3f, 0xff, 0xff, 0xc0,
-
-    /* U+5634 "嘴" */
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x70, 0xb0,
-    0x1, 0x51, 0xde, 0x6d, 0xf2, 0xfc, 0x77, 0x9b,
-    0xe0, 0xa7, 0x1d, 0xd2, 0xc2, 0x28, 0xdf, 0xff,
-    0x7f, 0xca, 0x36, 0x6c, 0x5, 0x42, 0x8c, 0xf,
-    0xff, 0xc0, 0xa3, 0x1e, 0x3, 0xc0, 0x28, 0xdf,
-    0xff, 0xff, 0x8a, 0x30, 0xe0, 0xe0, 0xe2, 0xec,
-    0x3f, 0xff, 0xf8, 0xbf, 0xe, 0x5e, 0x5e, 0x29,
-    0x43, 0x97, 0x97, 0x89, 0x1, 0xff, 0xff, 0xe0,
-    0x0, 0xf0, 0x38, 0x38, 0x0, 0x74, 0xe, 0x7d,
-    0x0, 0x0, 0x0, 0x0, 0x0,
-
-    /* U+566A "噪" */
-    0x6a, 0x42, 0xff, 0xf0, 0x2f, 0xd0, 0xb0, 0x2c,
-    0xa, 0x34, 0x2e, 0xaf, 0x2, 0x8d, 0x5, 0x55,
-    0x40, 0xa3, 0x5f, 0xf3, 0xff, 0x28, 0xd7, 0x5c,
-    0xe6, 0xca, 0x35, 0xc3, 0x34, 0xb2, 0x8d, 0x7f,
-    0xcf, 0xfc, 0xa3, 0x45, 0x6a, 0x55, 0x2e, 0xd1,
-    0x57, 0x95, 0x4b, 0xf7, 0xff, 0xff, 0xf2, 0x80,
-    0x2, 0xff, 0x0, 0x50, 0x7, 0xde, 0xf4, 0x0,
-    0x2f, 0x83, 0x4b, 0xc0, 0x2, 0x0, 0xd0, 0x10,
-
-    /* U+591C "夜" */
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xe, 0x0,
-    0x0, 0x0, 0x0, 0xf0, 0x0, 0x3, 0xff, 0xff,
-    0xff, 0xfc, 0x1a, 0xba, 0xae, 0xaa, 0x80, 0xb,
-    0x42, 0xd0, 0x0, 0x0, 0xf0, 0x3f, 0xff, 0x40,
-    0x3c, 0xb, 0xaa, 0xf4, 0xb, 0xc2, 0xea, 0xf,
-    0x2, 0xfc, 0x7d, 0x3d, 0xd0, 0x7e, 0xcf, 0xb0,
-    0x7c, 0x1, 0x2c, 0x3, 0xcb, 0x40, 0x2, 0xc0,
-    0x1f, 0xe0, 0x0, 0x2c, 0x0, 0xfc, 0x0, 0x2,
-    0xc0, 0xbe, 0xf8, 0x0, 0x2c, 0xbe, 0x2, 0xf8,
-    0x2, 0xca, 0x40, 0x6, 0x80, 0x0, 0x0, 0x0,
-    0x0,
-
-    /* U+5927 "大" */
-    0x0, 0x0, 0xf0, 0x0, 0x0, 0x0, 0xf, 0x0,
-    0x0, 0x0, 0x0, 0xf0, 0x0, 0x0, 0x0, 0xf,
-    0x0, 0x0, 0x0, 0x0, 0xe0, 0x0, 0x3, 0xff,
-    0xff, 0xff, 0xfc, 0x2a, 0xab, 0xfe, 0xaa, 0x80,
-    0x0, 0x2f, 0x80, 0x0, 0x0, 0x3, 0xfc, 0x0,
-    0x0, 0x0, 0x79, 0xe0, 0x0, 0x0, 0xf, 0xf,
-    0x0, 0x0, 0x2, 0xe0, 0x7c, 0x0, 0x0, 0x7c,
-    0x2, 0xe0, 0x0, 0x1f, 0x40, 0xf, 0x80, 0xf,
-    0xd0, 0x0, 0x3f, 0x43, 0xf0, 0x0, 0x0, 0xbc,
-    0x4, 0x0, 0x0, 0x1, 0x0,
-
-    /* U+592A "太" */
-    0x0, 0x0, 0xf0, 0x0, 0x0, 0x0, 0xf, 0x0,
-    0x0, 0x0, 0x0, 0xf0, 0x0, 0x0, 0x0, 0xf,
-    0x0, 0x0, 0x2a, 0xaa, 0xfa, 0xaa, 0x83, 0xff,
-    0xff, 0xff, 0xfc, 0x0, 0x1, 0xf8, 0x0, 0x0,
-    0x0, 0x2f, 0xc0, 0x0, 0x0, 0x3, 0xdd, 0x0,
-    0x0, 0x0, 0x78, 0xf0, 0x0, 0x0, 0xf, 0x7,
-    0x80, 0x0, 0x2, 0xe0, 0x3d, 0x0, 0x0, 0xbf,
-    0x81, 0xf4, 0x0, 0x2f, 0x3e, 0x7, 0xd0, 0x2f,
-    0xc0, 0xf8, 0x1f, 0x83, 0xd0, 0x3, 0x40, 0x7c,
-    0x0, 0x0, 0x0, 0x0, 0x0,
-
-    /* U+5934 "头" */
-    0x0, 0x40, 0x2c, 0x0, 0x0, 0x1f, 0x42, 0xc0,
-    0x0, 0x0, 0x7f, 0x2c, 0x0, 0x0, 0x0, 0x62,
-    0xc0, 0x0, 0xf, 0x40, 0x2c, 0x0, 0x0, 0x7f,
-    0x2, 0xc0, 0x0, 0x0, 0xb8, 0x3c, 0x0, 0x0,
-    0x0, 0x3, 0xc0, 0x0, 0x3f, 0xff, 0xff, 0xff,
-    0xc2, 0xaa, 0xaf, 0xaa, 0xa8, 0x0, 0x0, 0xf0,
-    0x0, 0x0, 0x0, 0x2d, 0xa0, 0x0, 0x0, 0xb,
-    0xcb, 0xd0, 0x0, 0x3, 0xf0, 0xf, 0xc0, 0x7,
-    0xf8, 0x0, 0x1f, 0x82, 0xf8, 0x0, 0x0, 0x38,
-    0x4, 0x0, 0x0, 0x0, 0x0,
-
-    /* U+5BFF "寿" */
-    0x0, 0x0, 0x40, 0x0, 0x0, 0x0, 0x1d, 0x0,
-    0x0, 0xf, 0xff, 0xff, 0xff, 0x0, 0xaa, 0xbe,
-    0xaa, 0xa0, 0x0, 0x3, 0xc0, 0x0, 0x0, 0x7f,
-    0xff, 0xff, 0xd0, 0x1, 0x5f, 0x55, 0x54, 0x1,
-    0x55, 0xf5, 0x55, 0x54, 0x3f, 0xff, 0xff, 0xff,
-    0xc0, 0x3, 0xc0, 0xf, 0x0, 0x0, 0xbd, 0x55,
-    0xf5, 0x40, 0x1f, 0xff, 0xff, 0xf8, 0x7, 0xc4,
-    0x0, 0xf0, 0x2, 0xf0, 0xf0, 0xf, 0x0, 0x2c,
-    0x3, 0xc0, 0xf0, 0x0, 0x0, 0x14, 0xaf, 0x0,
-    0x0, 0x0, 0xf, 0xd0, 0x0, 0x0, 0x0, 0x0,
-    0x0,
-
-    /* U+5C0F "小" */
-    0x0, 0x0, 0xf0, 0x0, 0x0, 0x0, 0xf, 0x0,
-    0x0, 0x0, 0x0, 0xf0, 0x0, 0x0, 0x0, 0xf,
-    0x0, 0x0, 0x2, 0xc0, 0xf0, 0x34, 0x0, 0x3c,
-    0xf, 0x3, 0xc0, 0x3, 0xc0, 0xf0, 0x1e, 0x0,
-    0x74, 0xf, 0x0, 0xf0, 0xf, 0x0, 0xf0, 0xb,
-    0x81, 0xe0, 0xf, 0x0, 0x3c, 0x3c, 0x0, 0xf0,
-    0x3, 0xd3, 0x80, 0xf, 0x0, 0x1d, 0x0, 0x0,
-    0xf0, 0x0, 0x0, 0x0, 0xf, 0x0, 0x0, 0x0,
-    0x2a, 0xf0, 0x0, 0x0, 0x3, 0xfd, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0,
-
-    /* U+5C3E "尾" */
-    0xf, 0xff, 0xff, 0xff, 0x0, 0xf5, 0x55, 0x55,
-    0xf0, 0xf, 0x55, 0x55, 0x5f, 0x0, 0xff, 0xff,
-    0xff, 0xf0, 0xf, 0x0, 0x1b, 0xf0, 0x0, 0xf2,
-    0xbf, 0xf9, 0x0, 0xf, 0x2a, 0x78, 0x4, 0x0,
-    0xf0, 0x7, 0xff, 0xd0, 0xf, 0x3f, 0xfe, 0x50,
-    0x0, 0xe2, 0x43, 0x81, 0x64, 0xe, 0x5, 0xbf,
-    0xff, 0x41, 0xdf, 0xff, 0xd4, 0x0, 0x2c, 0x50,
-    0x38, 0x2, 0xc3, 0xc0, 0x3, 0xea, 0xbc, 0x34,
-    0x0, 0x2f, 0xff, 0x40, 0x0, 0x0, 0x0, 0x0,
-
-    /* U+5C71 "山" */
-    0x0, 0x3, 0xc0, 0x0, 0x0, 0x3, 0xc0, 0x0,
-    0x0, 0x3, 0xc0, 0x0, 0x24, 0x3, 0xc0, 0x18,
-    0x38, 0x3, 0xc0, 0x2c, 0x38, 0x3, 0xc0, 0x2c,
-    0x38, 0x3, 0xc0, 0x2c, 0x38, 0x3, 0xc0, 0x2c,
-    0x38, 0x3, 0xc0, 0x2c, 0x38, 0x3, 0xc0, 0x2c,
-    0x38, 0x3, 0xc0, 0x2c, 0x38, 0x3, 0xc0, 0x2c,
-    0x38, 0x3, 0xc0, 0x2c, 0x3f, 0xff, 0xff, 0xfc,
-    0x3f, 0xff, 0xff, 0xfc, 0x0, 0x0, 0x0, 0x2c,
-
-    /* U+5E26 "带" */
-    0x1, 0xd0, 0xf0, 0x38, 0x0, 0x1e, 0xf, 0x7,
-    0x80, 0x3f, 0xff, 0xff, 0xff, 0xd1, 0x5e, 0x5f,
-    0x57, 0x94, 0x1, 0xd0, 0xf0, 0x38, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x2f, 0xff, 0xff, 0xff, 0x82,
-    0xc0, 0xf, 0x0, 0x38, 0x2c, 0x0, 0xf0, 0x3,
-    0x81, 0xaf, 0xff, 0xff, 0xe4, 0x3, 0xea, 0xfa,
-    0xad, 0x0, 0x3c, 0xf, 0x1, 0xd0, 0x3, 0xc0,
-    0xf0, 0x1d, 0x0, 0x3c, 0xf, 0x1a, 0xc0, 0x2,
-    0xc0, 0xf0, 0xf8, 0x0, 0x0, 0xf, 0x0, 0x0,
-
-    /* U+6076 "恶" */
-    0xf, 0xff, 0xff, 0xff, 0x40, 0x0, 0x70, 0xe0,
-    0x0, 0x3, 0x87, 0xe, 0xd, 0x0, 0x2c, 0x70,
-    0xe2, 0xc0, 0x1, 0xd7, 0xe, 0x38, 0x0, 0x8,
-    0x70, 0xe2, 0x0, 0x15, 0x5b, 0x5f, 0x55, 0x43,
-    0xff, 0xff, 0xff, 0xfc, 0x0, 0x1, 0xd0, 0x0,
-    0x0, 0x1, 0xf, 0x1, 0xc0, 0xb, 0x38, 0x3c,
-    0xf, 0x0, 0xf3, 0x81, 0xc0, 0xb4, 0x1d, 0x38,
-    0x0, 0xb3, 0xc3, 0xc3, 0xea, 0xaf, 0x2c, 0x14,
-    0x2f, 0xff, 0xd0, 0x0,
-
-    /* U+6234 "戴" */
-    0x0, 0x38, 0x7, 0x54, 0x0, 0xff, 0xfe, 0x36,
-    0xe0, 0x5, 0x7d, 0x53, 0x4a, 0x7, 0xff, 0xff,
-    0xff, 0xf8, 0x2a, 0xaa, 0xab, 0xea, 0x80, 0x55,
-    0x55, 0x38, 0x0, 0x1d, 0x79, 0xb3, 0x87, 0x1,
-    0xff, 0xff, 0x3c, 0xb0, 0x1c, 0x38, 0xb2, 0xcf,
-    0x0, 0xff, 0xfe, 0x2d, 0xd0, 0x16, 0xdb, 0x91,
-    0xfc, 0x1, 0xbe, 0xba, 0xf, 0x80, 0x2b, 0xeb,
-    0xa4, 0xf0, 0x2, 0xbe, 0xba, 0x7f, 0x4c, 0xb,
-    0x87, 0x9f, 0x7f, 0xc2, 0xd0, 0x18, 0x90, 0xf8,
-    0x0, 0x0, 0x0, 0x0, 0x0,
-
-    /* U+62DF "拟" */
-    0x3, 0x40, 0x0, 0x0, 0x0, 0x34, 0x2c, 0x0,
-    0xb0, 0x3, 0x42, 0xdc, 0xb, 0x2, 0xbe, 0x2c,
-    0xe0, 0xb0, 0x3f, 0xf2, 0xcb, 0xb, 0x0, 0x34,
-    0x2c, 0x38, 0xf0, 0x3, 0x42, 0xc2, 0xcf, 0x0,
-    0x39, 0x2c, 0x0, 0xe0, 0xb, 0xf2, 0xc0, 0x1d,
-    0x7, 0xf8, 0x2c, 0x12, 0xe0, 0x13, 0x42, 0xcb,
-    0x3f, 0x0, 0x34, 0x2f, 0xd7, 0xf8, 0x3, 0x43,
-    0xe0, 0xf3, 0xc0, 0x34, 0x78, 0x2d, 0x1d, 0x2b,
-    0x41, 0xf, 0x80, 0xe2, 0xf0, 0x0, 0x60, 0x4,
-
-    /* U+6363 "捣" */
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x38, 0x0, 0xe0,
-    0x0, 0x3, 0x81, 0xae, 0xa9, 0x0, 0x38, 0x3f,
-    0xff, 0xe0, 0x2b, 0xe3, 0x84, 0xd, 0x7, 0xff,
-    0x79, 0xe0, 0xd0, 0x3, 0x83, 0x87, 0x5d, 0x0,
-    0x38, 0x38, 0xf, 0xc0, 0x3, 0x93, 0x80, 0x50,
-    0x0, 0x7f, 0x7f, 0xff, 0xfc, 0x7f, 0xd1, 0x55,
-    0x56, 0xc2, 0x78, 0x3, 0x40, 0x2c, 0x3, 0x8d,
-    0x34, 0xe2, 0xc0, 0x38, 0xd3, 0x4e, 0x38, 0x3,
-    0x8f, 0xbe, 0xe3, 0x82, 0xb4, 0xaa, 0xae, 0x34,
-    0x2e, 0x0, 0x0, 0xbe, 0x0, 0x0, 0x0, 0x0,
-    0x0,
-
-    /* U+6587 "文" */
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xf, 0x0,
-    0x0, 0x0, 0x0, 0xf4, 0x0, 0x0, 0x0, 0x7,
-    0x40, 0x0, 0x3f, 0xff, 0xff, 0xff, 0xc2, 0xaf,
-    0xaa, 0xaf, 0xa8, 0x0, 0xf0, 0x0, 0xf0, 0x0,
-    0x7, 0x40, 0x1e, 0x0, 0x0, 0x3c, 0x3, 0xc0,
-    0x0, 0x1, 0xe0, 0xb8, 0x0, 0x0, 0xb, 0x5f,
-    0x0, 0x0, 0x0, 0x3f, 0xc0, 0x0, 0x0, 0x2,
-    0xf8, 0x0, 0x0, 0x0, 0xbf, 0xf0, 0x0, 0x0,
-    0xbf, 0xb, 0xe0, 0x1, 0xbf, 0x40, 0x1f, 0xf4,
-    0x3f, 0x40, 0x0, 0x1f, 0xc0, 0x0, 0x0, 0x0,
-    0x0,
-
-    /* U+6591 "斑" */
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1c, 0x0,
-    0x0, 0x7f, 0xe1, 0xe3, 0xff, 0xc2, 0xb9, 0xe,
-    0x17, 0xd4, 0x7, 0xf, 0xff, 0x2c, 0x0, 0x70,
-    0xab, 0xe2, 0xc0, 0x7, 0x4, 0x38, 0x2c, 0x1,
-    0xb4, 0xf3, 0x82, 0xc0, 0x3f, 0xe7, 0x75, 0xbe,
-    0x41, 0xb4, 0x3f, 0x2f, 0xf8, 0x7, 0x1, 0xf0,
-    0x2c, 0x0, 0x70, 0xf, 0x2, 0xc0, 0x7, 0x1,
-    0xf4, 0x2c, 0x0, 0xbf, 0x3f, 0xc2, 0xc0, 0x7f,
-    0x9b, 0x28, 0x2c, 0x2, 0x41, 0xe0, 0x7f, 0xfd,
-    0x0, 0x2c, 0x7, 0xff, 0xd0, 0x0, 0x0, 0x0,
-    0x0,
-
-    /* U+65B0 "新" */
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xe, 0x0, 0x0,
-    0xb0, 0x15, 0xf5, 0x46, 0xff, 0x43, 0xff, 0xfc,
-    0xf5, 0x0, 0xa, 0xb, 0xe, 0x0, 0x0, 0x70,
-    0xe0, 0xe0, 0x0, 0x2b, 0xae, 0x8f, 0x55, 0x43,
-    0xff, 0xfd, 0xff, 0xfd, 0x0, 0xb0, 0xf, 0x1e,
-    0x0, 0xb, 0x0, 0xe0, 0xe0, 0x3f, 0xff, 0xce,
-    0xe, 0x1, 0x5b, 0x54, 0xe0, 0xe0, 0xd, 0xb7,
-    0xd, 0xe, 0x2, 0xcb, 0x39, 0xd0, 0xe0, 0x34,
-    0xb1, 0xac, 0xe, 0x0, 0x1f, 0x3, 0x80, 0xe0,
-    0x3, 0xd0, 0x20, 0xe, 0x0,
-
-    /* U+65E5 "日" */
-    0xff, 0xff, 0xff, 0x3e, 0xaa, 0xab, 0xcf, 0x0,
-    0x0, 0xf3, 0xc0, 0x0, 0x3c, 0xf0, 0x0, 0xf,
-    0x3c, 0x0, 0x3, 0xcf, 0xff, 0xff, 0xf3, 0xff,
-    0xff, 0xfc, 0xf0, 0x0, 0xf, 0x3c, 0x0, 0x3,
-    0xcf, 0x0, 0x0, 0xf3, 0xc0, 0x0, 0x3c, 0xfa,
-    0xaa, 0xaf, 0x3f, 0xff, 0xff, 0xcf, 0x0, 0x0,
-    0xf0, 0x0, 0x0, 0x0,
-
-    /* U+666E "普" */
-    0x0, 0x10, 0x0, 0x40, 0x0, 0xb, 0x40, 0x1e,
-    0x0, 0x5, 0x79, 0x57, 0xd5, 0x0, 0xff, 0xff,
-    0xff, 0xf4, 0x2, 0x4b, 0xe, 0x1c, 0x0, 0x3c,
-    0xb0, 0xe3, 0xc0, 0x1, 0xcb, 0xe, 0x74, 0x2,
-    0xaa, 0xfa, 0xfb, 0xa8, 0x3f, 0xff, 0xff, 0xff,
-    0xc0, 0x0, 0x0, 0x0, 0x0, 0x3, 0xff, 0xff,
-    0xfc, 0x0, 0x3d, 0x55, 0x57, 0xc0, 0x3, 0xc0,
-    0x0, 0x3c, 0x0, 0x3f, 0xff, 0xff, 0xc0, 0x3,
-    0xc0, 0x0, 0x3c, 0x0, 0x3d, 0x55, 0x57, 0xc0,
-    0x3, 0xff, 0xff, 0xfc, 0x0, 0x0, 0x0, 0x0,
-    0x0,
-
-    /* U+6697 "暗" */
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3, 0x80,
-    0xb, 0xfd, 0x0, 0xf0, 0x2, 0xeb, 0x6f, 0xff,
-    0xfc, 0xb0, 0xd1, 0xd5, 0x78, 0x2c, 0x34, 0x34,
-    0x1d, 0xb, 0xe, 0xf, 0xb, 0x2, 0xeb, 0xbf,
-    0xff, 0xfd, 0xbf, 0xe5, 0x55, 0x55, 0x2c, 0x34,
-    0x55, 0x55, 0xb, 0xd, 0x3f, 0xff, 0xd2, 0xc3,
-    0x4e, 0x0, 0x74, 0xba, 0xd3, 0xea, 0xbd, 0x2f,
-    0xf4, 0xfa, 0xab, 0x4b, 0x0, 0x38, 0x1, 0xd1,
-    0x40, 0xe, 0x55, 0xb4, 0x0, 0x3, 0xff, 0xfd,
-    0x0, 0x0, 0x0, 0x0, 0x0,
-
-    /* U+6728 "木" */
-    0x0, 0x0, 0xf0, 0x0, 0x0, 0x0, 0xf, 0x0,
-    0x0, 0x0, 0x0, 0xf0, 0x0, 0x0, 0x0, 0xf,
-    0x0, 0x0, 0x3f, 0xff, 0xff, 0xff, 0xc2, 0xaa,
-    0xbf, 0xea, 0xa8, 0x0, 0x3, 0xfc, 0x0, 0x0,
-    0x0, 0xff, 0xf0, 0x0, 0x0, 0x2d, 0xf7, 0x80,
-    0x0, 0x7, 0xcf, 0x2d, 0x0, 0x1, 0xf0, 0xf0,
-    0xf4, 0x0, 0xbc, 0xf, 0x3, 0xe0, 0x3f, 0x0,
-    0xf0, 0xf, 0xc3, 0x80, 0xf, 0x0, 0x2c, 0x0,
-    0x0, 0xf0, 0x0, 0x0, 0x0, 0xf, 0x0, 0x0,
-
-    /* U+672C "本" */
-    0x0, 0x0, 0xf0, 0x0, 0x0, 0x0, 0xf, 0x0,
-    0x0, 0x0, 0x0, 0xf0, 0x0, 0x2, 0xaa, 0xaf,
-    0xaa, 0xa8, 0x3f, 0xff, 0xff, 0xff, 0xc0, 0x0,
-    0xef, 0xf0, 0x0, 0x0, 0x2c, 0xf7, 0x80, 0x0,
-    0x3, 0x8f, 0x3c, 0x0, 0x0, 0xf0, 0xf0, 0xf0,
-    0x0, 0x2e, 0xf, 0xb, 0x80, 0x7, 0xc0, 0xf0,
-    0x3e, 0x2, 0xfa, 0xaf, 0xaa, 0xf8, 0x3c, 0xff,
-    0xff, 0xf3, 0xc0, 0x0, 0xf, 0x0, 0x0, 0x0,
-    0x0, 0xf0, 0x0, 0x0, 0x0, 0xf, 0x0, 0x0,
-
-    /* U+6765 "来" */
-    0x0, 0x0, 0xf0, 0x0, 0x0, 0x0, 0xf, 0x0,
-    0x0, 0xf, 0xff, 0xff, 0xff, 0x40, 0xaa, 0xaf,
-    0xaa, 0xa0, 0x2, 0xc0, 0xf0, 0x3c, 0x0, 0xe,
-    0xf, 0x7, 0x80, 0x0, 0xf0, 0xf0, 0xf0, 0x0,
-    0x6, 0xf, 0x9, 0x0, 0x3f, 0xff, 0xff, 0xff,
-    0xc2, 0xaa, 0xbf, 0xea, 0xa8, 0x0, 0xf, 0xff,
-    0x0, 0x0, 0x3, 0xcf, 0x3c, 0x0, 0x1, 0xf0,
-    0xf0, 0xf4, 0x1, 0xf8, 0xf, 0x3, 0xf4, 0x3d,
-    0x0, 0xf0, 0x7, 0xc0, 0x0, 0xf, 0x0, 0x0,
-
-    /* U+677E "松" */
-    0x2, 0xc0, 0x4, 0x14, 0x0, 0x2c, 0x2, 0xc3,
-    0x80, 0x2, 0xc0, 0x3c, 0x3c, 0x2, 0xbe, 0x87,
-    0x81, 0xd0, 0x7f, 0xfc, 0xb0, 0xf, 0x0, 0x3c,
-    0xe, 0x10, 0xb8, 0x3, 0xe3, 0xc3, 0x83, 0xc0,
-    0xbf, 0x68, 0xb4, 0x14, 0xf, 0xec, 0xf, 0x0,
-    0x1, 0xec, 0xd0, 0xe0, 0x0, 0x3a, 0xc4, 0x2d,
-    0x2c, 0x7, 0x2c, 0x3, 0xc1, 0xe0, 0x12, 0xc0,
-    0xb4, 0xf, 0x0, 0x2c, 0xf, 0xaf, 0xf4, 0x2,
-    0xc2, 0xff, 0xeb, 0xc0, 0x2c, 0x14, 0x0, 0x14,
-
-    /* U+6797 "林" */
-    0x0, 0xe0, 0x0, 0xe0, 0x0, 0xe, 0x0, 0xe,
-    0x0, 0x0, 0xe0, 0x0, 0xe0, 0x2, 0xaf, 0xa2,
-    0xaf, 0xa8, 0x3f, 0xff, 0x7f, 0xff, 0xc0, 0x1f,
-    0x0, 0x2f, 0x40, 0x2, 0xf8, 0x3, 0xf8, 0x0,
-    0x3f, 0xe0, 0x7f, 0xc0, 0xb, 0xeb, 0x4f, 0xfd,
-    0x0, 0xde, 0x21, 0xde, 0xb0, 0x3c, 0xe0, 0x38,
-    0xe7, 0x87, 0x4e, 0xf, 0xe, 0x3d, 0x10, 0xe0,
-    0xd0, 0xe0, 0x80, 0xe, 0x0, 0xe, 0x0, 0x0,
-    0xe0, 0x0, 0xe0, 0x0, 0xe, 0x0, 0xe, 0x0,
-
-    /* U+6B21 "次" */
-    0x0, 0x0, 0xe0, 0x0, 0x1, 0x40, 0x1e, 0x0,
-    0x0, 0x3f, 0x2, 0xd0, 0x0, 0x0, 0x7d, 0x3f,
-    0xff, 0xf8, 0x0, 0x87, 0xea, 0xab, 0x80, 0x0,
-    0xf0, 0xa0, 0x74, 0x0, 0x1f, 0xf, 0xf, 0x0,
-    0x2, 0xd0, 0xf0, 0xe0, 0x0, 0x40, 0xf, 0x4,
-    0x0, 0x1d, 0x1, 0xf4, 0x0, 0x3, 0xc0, 0x2f,
-    0xc0, 0x0, 0xb4, 0x3, 0xed, 0x0, 0x1f, 0x0,
-    0xf4, 0xf0, 0x3, 0xc0, 0x2f, 0x7, 0xc0, 0x18,
-    0xf, 0xc0, 0x2f, 0x40, 0x7, 0xe0, 0x0, 0xbc,
-    0x0, 0x24, 0x0, 0x0, 0x0,
-
-    /* U+6C34 "水" */
-    0x0, 0x0, 0xf0, 0x0, 0x0, 0x0, 0xf, 0x0,
-    0x0, 0x0, 0x0, 0xf0, 0x0, 0x0, 0x0, 0xf,
-    0x0, 0x80, 0x2a, 0xa8, 0xf0, 0x2e, 0x3, 0xff,
-    0xcf, 0x4b, 0x80, 0x0, 0x3c, 0xfe, 0xe0, 0x0,
-    0x7, 0x4f, 0xf8, 0x0, 0x0, 0xf0, 0xfb, 0x40,
-    0x0, 0x1e, 0xf, 0x3c, 0x0, 0x3, 0xc0, 0xf1,
-    0xf0, 0x0, 0xb8, 0xf, 0x7, 0xd0, 0x3e, 0x0,
-    0xf0, 0x1f, 0xc3, 0x80, 0xf, 0x0, 0x38, 0x0,
-    0x1f, 0xe0, 0x0, 0x0, 0x0, 0xfc, 0x0, 0x0,
-
-    /* U+6C60 "池" */
-    0x9, 0x0, 0x3, 0x80, 0x0, 0xfd, 0x10, 0x38,
-    0x0, 0x1, 0xd3, 0x83, 0x80, 0x0, 0x0, 0x38,
-    0x38, 0xb8, 0x0, 0x3, 0x83, 0xff, 0x83, 0x80,
-    0x3e, 0xfe, 0x38, 0x2f, 0x47, 0xff, 0x83, 0x80,
-    0x33, 0xfc, 0x38, 0x38, 0x0, 0x17, 0x83, 0x83,
-    0x80, 0x4, 0x38, 0x38, 0x38, 0x0, 0xe3, 0x83,
-    0xaf, 0x40, 0x2c, 0x38, 0x39, 0x90, 0x7, 0x83,
-    0x82, 0x40, 0x40, 0xf0, 0x38, 0x0, 0x1d, 0x1e,
-    0x3, 0xea, 0xab, 0xc0, 0x80, 0x1f, 0xff, 0xf4,
-
-    /* U+7070 "灰" */
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x3, 0xc0, 0x0,
-    0x0, 0x0, 0x3c, 0x0, 0x0, 0x3, 0xff, 0xff,
-    0xff, 0xf8, 0x2a, 0xbe, 0xaa, 0xaa, 0x40, 0x7,
-    0x40, 0x60, 0x0, 0x0, 0xb0, 0xf, 0x0, 0x0,
-    0xf, 0x10, 0xf0, 0x50, 0x0, 0xf3, 0x8f, 0xe,
-    0x0, 0x1e, 0x34, 0xe2, 0xc0, 0x2, 0xc7, 0xf,
-    0x38, 0x0, 0x3c, 0x21, 0xf4, 0x0, 0xb, 0x40,
-    0x3f, 0xc0, 0x2, 0xf0, 0x7, 0x8e, 0x0, 0x3c,
-    0x1, 0xf0, 0xb8, 0x1, 0x40, 0xbc, 0x2, 0xf0,
-    0x0, 0x3e, 0x0, 0xb, 0x80, 0x0, 0x40, 0x0,
-    0x0,
-
-    /* U+71D5 "燕" */
-    0x0, 0xd, 0x7, 0x40, 0x3, 0xff, 0xff, 0xff,
-    0xfc, 0x2a, 0xaf, 0xab, 0xaa, 0x80, 0x0, 0xe0,
-    0xb4, 0x0, 0x0, 0x5f, 0xff, 0x50, 0x0, 0xd,
-    0x0, 0x3, 0x40, 0x2f, 0xd7, 0xfe, 0x3b, 0xc0,
-    0x5d, 0x75, 0xe3, 0xe0, 0x0, 0xd7, 0xe, 0x38,
-    0x0, 0x2d, 0x70, 0xe3, 0x4c, 0x3f, 0xd7, 0xfe,
-    0x3a, 0xc2, 0x4d, 0x2a, 0x92, 0xf8, 0x2, 0x40,
-    0x0, 0x9, 0x0, 0xb4, 0xb0, 0xf0, 0xf0, 0xf,
-    0x7, 0xb, 0x43, 0x83, 0xd0, 0x74, 0x78, 0x2c,
-    0x4, 0x0, 0x1, 0x0, 0x40,
-
-    /* U+72D7 "狗" */
-    0x0, 0x0, 0x0, 0x0, 0xa, 0xd, 0xd, 0x0,
-    0x1, 0xef, 0xb, 0x0, 0x0, 0x2f, 0x83, 0xea,
-    0xa9, 0xb, 0xc1, 0xff, 0xff, 0xcb, 0xf4, 0xf0,
-    0x0, 0xf3, 0x8e, 0xb4, 0x0, 0x38, 0x3, 0xef,
-    0xff, 0x4e, 0x0, 0xf1, 0xe5, 0xd3, 0x80, 0xfc,
-    0x70, 0x34, 0xe0, 0xbf, 0x1c, 0xd, 0x38, 0xb6,
-    0xc7, 0x57, 0x4e, 0x38, 0xb1, 0xff, 0xd3, 0x40,
-    0x3c, 0x74, 0x1, 0xd0, 0xe, 0x4, 0x0, 0xb0,
-    0x6f, 0x40, 0x6, 0xbc, 0x1f, 0x80, 0x0, 0xfd,
-    0x0, 0x0, 0x0, 0x0, 0x0,
-
-    /* U+73E0 "珠" */
-    0x0, 0x0, 0x2, 0xc0, 0x3, 0xff, 0xcb, 0x2c,
-    0x0, 0x2b, 0xe4, 0xf2, 0xc0, 0x0, 0x38, 0xf,
-    0xff, 0xf8, 0x3, 0x81, 0xeb, 0xea, 0x40, 0x38,
-    0x3c, 0x2c, 0x0, 0x3f, 0xfa, 0x42, 0xc0, 0x2,
-    0xbe, 0x6a, 0xbe, 0xa8, 0x3, 0x83, 0xff, 0xff,
-    0xd0, 0x38, 0x0, 0xbf, 0x0, 0x3, 0x80, 0x1f,
-    0xf8, 0x0, 0x39, 0x83, 0xad, 0xd0, 0x1b, 0xf8,
-    0xf2, 0xcf, 0x3, 0xe4, 0x7c, 0x2c, 0x3d, 0x0,
-    0xb, 0x2, 0xc0, 0xc0, 0x0, 0x0, 0x2c, 0x0,
-
-    /* U+7435 "琵" */
-    0x3f, 0xff, 0x6f, 0xff, 0xc0, 0xe, 0x0, 0xb,
-    0x0, 0x5, 0xf5, 0x5, 0xf5, 0x41, 0xff, 0xf2,
-    0xff, 0xf8, 0x0, 0xe0, 0x0, 0xb0, 0x3, 0xff,
-    0xf6, 0xff, 0xfd, 0x2a, 0xaa, 0x6a, 0xaa, 0x80,
-    0xa0, 0x1, 0x80, 0x0, 0xf, 0x0, 0x2c, 0x6,
-    0x0, 0xff, 0xfa, 0xdb, 0xf4, 0xf, 0x55, 0x6f,
-    0xe4, 0x0, 0xf0, 0x2, 0xd0, 0x4, 0xf, 0x0,
-    0x6c, 0x0, 0xd0, 0xff, 0xfa, 0xea, 0xbc, 0xf,
-    0xe5, 0xf, 0xff, 0x80, 0x0, 0x0, 0x0, 0x0,
-
-    /* U+767D "白" */
-    0x0, 0x4, 0x0, 0x0, 0x2, 0xe0, 0x0, 0x0,
-    0x3c, 0x0, 0x6, 0xab, 0xea, 0xa9, 0xbf, 0xff,
-    0xff, 0xeb, 0x0, 0x0, 0xe, 0xb0, 0x0, 0x0,
-    0xeb, 0x0, 0x0, 0xe, 0xb0, 0x0, 0x0, 0xeb,
-    0xff, 0xff, 0xfe, 0xba, 0xaa, 0xaa, 0xeb, 0x0,
-    0x0, 0xe, 0xb0, 0x0, 0x0, 0xeb, 0x0, 0x0,
-    0xe, 0xba, 0xaa, 0xaa, 0xeb, 0xff, 0xff, 0xfe,
-    0xb0, 0x0, 0x0, 0xe0, 0x0, 0x0, 0x0,
-
-    /* U+7736 "眶" */
-    0xff, 0xeb, 0xff, 0xff, 0x3e, 0xba, 0xea, 0xaa,
-    0x8f, 0xe, 0xb1, 0x55, 0x43, 0xd7, 0xac, 0xff,
-    0xf4, 0xff, 0xeb, 0x2, 0xc0, 0x3c, 0x3a, 0xc0,
-    0xb0, 0xf, 0xe, 0xb2, 0xff, 0xc3, 0xff, 0xac,
-    0x6f, 0xa0, 0xfa, 0xeb, 0x2, 0xc0, 0x3c, 0x3a,
-    0xc0, 0xb0, 0xf, 0xe, 0xb3, 0xff, 0xe3, 0xff,
-    0xac, 0xaa, 0xa4, 0xfa, 0x9b, 0x0, 0x0, 0x3c,
-    0x2, 0xff, 0xff, 0xd0, 0x0, 0x6a, 0xaa, 0xa0,
-
-    /* U+773C "眼" */
-    0xff, 0xd3, 0xff, 0xfc, 0x3e, 0xb4, 0xfa, 0xaf,
-    0xe, 0xd, 0x38, 0x2, 0xc3, 0xd7, 0x4f, 0xff,
-    0xf0, 0xff, 0xd3, 0x95, 0x6c, 0x38, 0x34, 0xe0,
-    0xb, 0xe, 0xd, 0x3e, 0xab, 0xc3, 0xeb, 0x4f,
-    0xff, 0xf0, 0xff, 0xd3, 0x87, 0x5, 0x38, 0x34,
-    0xe0, 0xdb, 0x8e, 0xd, 0x38, 0x3f, 0x43, 0xff,
-    0x4e, 0x7, 0x40, 0xfa, 0x83, 0x84, 0xf4, 0x38,
-    0x1, 0xff, 0x8f, 0x80, 0x0, 0xbe, 0x40, 0xe0,
-    0x0, 0x0, 0x0, 0x0,
-
-    /* U+7D2B "紫" */
-    0x0, 0x3c, 0xd, 0x0, 0x0, 0xd3, 0xd5, 0xd1,
-    0xf0, 0xd, 0x3f, 0xdf, 0xfe, 0x0, 0xd3, 0xc0,
-    0xf4, 0x0, 0xd, 0x3d, 0x5d, 0x1, 0xc2, 0xff,
-    0xfd, 0xff, 0xfc, 0x3e, 0x96, 0xd1, 0x55, 0x0,
-    0x1, 0xf4, 0x3c, 0x0, 0x2, 0xff, 0xff, 0x40,
-    0x0, 0x3a, 0xff, 0x4a, 0x0, 0x1, 0xbe, 0x0,
-    0x7c, 0x0, 0xff, 0xff, 0xff, 0xf0, 0x6, 0xa5,
-    0xf0, 0x43, 0x80, 0x1f, 0xb, 0x1f, 0x80, 0x1f,
-    0x85, 0xf0, 0x1f, 0x40, 0x80, 0xbe, 0x0, 0x10,
-    0x0, 0x0, 0x0, 0x0, 0x0,
-
-    /* U+7EA2 "红" */
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xd, 0x0, 0x0,
-    0x0, 0x2, 0xd1, 0xaa, 0xaa, 0x40, 0x3c, 0x2f,
-    0xff, 0xfc, 0xb, 0x0, 0x3, 0xc0, 0x1, 0xe2,
-    0xd0, 0x3c, 0x0, 0x3d, 0xbc, 0x3, 0xc0, 0x7,
-    0xff, 0x0, 0x3c, 0x0, 0x12, 0xd0, 0x3, 0xc0,
-    0x0, 0x78, 0x0, 0x3c, 0x0, 0x1f, 0x68, 0x3,
-    0xc0, 0x7, 0xff, 0xc0, 0x3c, 0x0, 0x39, 0x0,
-    0x3, 0xc0, 0x0, 0x0, 0x0, 0x3c, 0x0, 0x5,
-    0xbc, 0x3, 0xc0, 0x7, 0xff, 0xbf, 0xff, 0xfc,
-    0x25, 0x1, 0xaa, 0xaa, 0x80,
-
-    /* U+7EDF "统" */
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x1d, 0x0, 0x38,
-    0x0, 0x2, 0xc0, 0x3, 0xc0, 0x0, 0x38, 0x1a,
-    0xbe, 0xa8, 0xb, 0x2, 0xff, 0xff, 0xc1, 0xe3,
-    0xc0, 0xf0, 0x40, 0x3e, 0xb8, 0x3c, 0x1d, 0x7,
-    0xff, 0xb, 0x85, 0xf0, 0x12, 0xc3, 0xff, 0xff,
-    0x80, 0x78, 0x27, 0x85, 0x28, 0x1f, 0xf8, 0x38,
-    0xb0, 0x3, 0xf9, 0x3, 0x8b, 0x0, 0x20, 0x0,
-    0x74, 0xb0, 0x0, 0x7, 0x8b, 0xb, 0x8, 0x2f,
-    0xf4, 0xf0, 0xb0, 0xd3, 0xe0, 0x7c, 0xb, 0xac,
-    0x10, 0xf, 0x40, 0x3f, 0x80, 0x0, 0x0, 0x0,
-    0x0,
-
-    /* U+7EE3 "绣" */
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x18, 0x0, 0x16,
-    0xa0, 0x3, 0xc0, 0xff, 0xf9, 0x0, 0x34, 0x4,
-    0x2c, 0x0, 0xb, 0x2, 0xff, 0xff, 0xd0, 0xd3,
-    0xda, 0xff, 0xe8, 0x3e, 0xb4, 0x2f, 0xed, 0x7,
-    0xfe, 0xf, 0x6c, 0xf4, 0x3, 0xc3, 0xd2, 0xc3,
-    0xc0, 0xb0, 0x19, 0x55, 0x44, 0x1e, 0x6c, 0xff,
-    0xf8, 0x3, 0xff, 0x82, 0xd3, 0x80, 0x24, 0x0,
-    0x2c, 0x7f, 0xc0, 0x1, 0x43, 0xc1, 0x7c, 0x2f,
-    0xf8, 0x74, 0x3, 0x83, 0x90, 0x2e, 0x1, 0x78,
-    0x0, 0x2, 0x80, 0x3f, 0x0, 0x0, 0x0, 0x0,
-    0x0,
-
-    /* U+7EFF "绿" */
-    0x1, 0x0, 0x0, 0x0, 0x0, 0x3c, 0x1f, 0xff,
-    0xf0, 0x3, 0x80, 0x55, 0x5f, 0x0, 0xb1, 0xf,
-    0xff, 0xf0, 0xe, 0x38, 0x55, 0x5f, 0x2, 0xef,
-    0x0, 0x0, 0xe0, 0x7f, 0xd2, 0xff, 0xff, 0xd2,
-    0x7c, 0x1a, 0xbe, 0xa8, 0xb, 0x0, 0x82, 0xc1,
-    0x42, 0xea, 0xf, 0x2c, 0xb4, 0x3f, 0xe0, 0x37,
-    0xfc, 0x1, 0x0, 0x1, 0xff, 0x40, 0x0, 0xb5,
-    0xfa, 0xee, 0x2, 0xfe, 0x7c, 0x2c, 0x7c, 0x39,
-    0x0, 0x7, 0xc0, 0x40, 0x0, 0x0, 0xf8, 0x0,
-
-    /* U+7F1D "缝" */
-    0x0, 0x0, 0x0, 0x40, 0x0, 0x38, 0x40, 0x1c,
-    0x0, 0x7, 0x4e, 0x7, 0xff, 0x40, 0xb0, 0x71,
-    0xf4, 0xf0, 0xe, 0x3, 0x7f, 0x9e, 0x2, 0xc7,
-    0x20, 0x1f, 0x80, 0x38, 0xe0, 0x7, 0xfe, 0x7,
-    0xfd, 0xa7, 0xe4, 0xbc, 0x27, 0x9f, 0x95, 0xb5,
-    0x40, 0xb0, 0x39, 0xff, 0xf8, 0x1d, 0x53, 0x85,
-    0xb5, 0x3, 0xff, 0x38, 0xff, 0xf0, 0x35, 0x3,
-    0x85, 0xb5, 0x0, 0x6, 0x3a, 0xff, 0xf8, 0x1b,
-    0xf7, 0xc0, 0xb0, 0x3, 0xd1, 0xeb, 0xaa, 0x68,
-    0x0, 0x18, 0x1f, 0xff, 0xc0, 0x0, 0x0, 0x0,
-    0x0,
-
-    /* U+7FC5 "翅" */
-    0x2, 0xc0, 0x0, 0x0, 0x0, 0x2c, 0x2f, 0xeb,
-    0xf8, 0x2b, 0xe9, 0x5e, 0x57, 0x87, 0xff, 0xe4,
-    0xe2, 0x38, 0x2, 0xc0, 0xce, 0x37, 0x80, 0x2c,
-    0xa, 0xe2, 0xb8, 0x3f, 0xfc, 0xe, 0x3, 0x83,
-    0xeb, 0xc1, 0xe0, 0xb8, 0x1c, 0x2c, 0xbe, 0x7f,
-    0x80, 0xd3, 0xad, 0xea, 0x38, 0xe, 0x71, 0xe,
-    0x3, 0x80, 0x7e, 0x0, 0xe0, 0x38, 0x3, 0xd0,
-    0xfe, 0x3f, 0x80, 0xbf, 0x85, 0x41, 0x50, 0x2e,
-    0x2f, 0xea, 0xaa, 0x83, 0x80, 0x2f, 0xff, 0xfc,
-    0x0, 0x0, 0x0, 0x0, 0x0,
-
-    /* U+7FE0 "翠" */
-    0xf, 0xff, 0x7f, 0xff, 0x40, 0x65, 0x75, 0xa5,
-    0xb4, 0x7, 0xd3, 0x4f, 0xd7, 0x40, 0xa, 0xf4,
-    0xe, 0xf4, 0xf, 0xeb, 0x5f, 0xeb, 0x40, 0x90,
-    0x2a, 0x40, 0x20, 0xf, 0xff, 0xff, 0xff, 0x80,
-    0x57, 0xd5, 0x6e, 0x54, 0x0, 0x38, 0x3, 0xc0,
-    0x0, 0x1f, 0xf0, 0xff, 0x80, 0x7, 0x82, 0x7c,
-    0x2d, 0x1, 0x65, 0x5f, 0x55, 0x54, 0x3f, 0xff,
-    0xff, 0xff, 0xc0, 0x0, 0xf, 0x0, 0x0, 0x0,
-    0x0, 0xf0, 0x0, 0x0,
-
-    /* U+7FE1 "翡" */
-    0x0, 0xb, 0xf, 0x0, 0x2, 0xff, 0xf0, 0xff,
-    0xf8, 0x5, 0x5f, 0xf, 0x55, 0x0, 0xff, 0xf0,
-    0xff, 0xf0, 0x1, 0x5b, 0xf, 0x55, 0x1, 0x55,
-    0xf0, 0xf5, 0x54, 0x2f, 0xff, 0xf, 0xff, 0xc0,
-    0x0, 0xb0, 0xb0, 0x0, 0x1f, 0xff, 0x5f, 0xff,
-    0x40, 0xa5, 0xb4, 0xa5, 0xb8, 0xb, 0x7, 0x4b,
-    0x3, 0x80, 0x2c, 0x74, 0x2c, 0x38, 0x0, 0xbb,
-    0x41, 0xbb, 0x82, 0xfd, 0x76, 0xfd, 0x38, 0x28,
-    0x1b, 0x58, 0x17, 0x80, 0x3, 0xf0, 0x3, 0xf0,
-    0x0, 0x0, 0x0, 0x0, 0x0,
-
-    /* U+8033 "耳" */
-    0xbf, 0xff, 0xff, 0xff, 0x15, 0xf5, 0x55, 0xf9,
-    0x40, 0x3c, 0x0, 0x2c, 0x0, 0xf, 0x0, 0xb,
-    0x0, 0x3, 0xff, 0xff, 0xc0, 0x0, 0xfa, 0xaa,
-    0xf0, 0x0, 0x3c, 0x0, 0x2c, 0x0, 0xf, 0xaa,
-    0xaf, 0x0, 0x3, 0xff, 0xff, 0xc0, 0x0, 0xf0,
-    0x0, 0xb0, 0x0, 0x3c, 0x0, 0x2c, 0x0, 0xf,
-    0x5, 0x5f, 0xfc, 0xff, 0xff, 0xff, 0xff, 0x3f,
-    0xaa, 0x54, 0xb0, 0x0, 0x0, 0x0, 0x2c, 0x0,
-
-    /* U+80DC "胜" */
-    0x0, 0x0, 0x2, 0xc0, 0x1, 0xff, 0x86, 0x2c,
-    0x0, 0x1e, 0xb8, 0xb2, 0xc0, 0x1, 0xc3, 0x8f,
-    0x2d, 0x0, 0x1e, 0xb8, 0xff, 0xff, 0xc1, 0xff,
-    0x9d, 0x2d, 0x0, 0x1c, 0x3f, 0xc2, 0xc0, 0x1,
-    0xc3, 0xe4, 0x2c, 0x0, 0x2c, 0x38, 0x2, 0xc0,
-    0x2, 0xff, 0x8f, 0xff, 0xf8, 0x2e, 0xb8, 0xab,
-    0xea, 0x42, 0xc3, 0x80, 0x2c, 0x0, 0x38, 0x38,
-    0x2, 0xc0, 0x3, 0x83, 0x80, 0x2c, 0x0, 0x35,
-    0xba, 0xff, 0xff, 0xc7, 0x1f, 0x7f, 0xff, 0xfd,
-    0x0, 0x0, 0x0, 0x0, 0x0,
-
-    /* U+80F8 "胸" */
-    0x0, 0x0, 0x10, 0x0, 0x7, 0xfe, 0x2c, 0x0,
-    0x1, 0xeb, 0x8f, 0x55, 0x54, 0x70, 0xeb, 0xff,
-    0xff, 0x1e, 0xbf, 0x80, 0x2, 0xc7, 0xff, 0x98,
-    0x70, 0xb1, 0xc3, 0xb7, 0x76, 0xac, 0x70, 0xed,
-    0x7c, 0xab, 0x1c, 0x3b, 0x4f, 0x2a, 0xc7, 0xfe,
-    0xd7, 0xda, 0xb2, 0xeb, 0xbb, 0x5e, 0xac, 0xb0,
-    0xef, 0x82, 0xeb, 0x38, 0x3b, 0x95, 0x7b, 0xce,
-    0xe, 0xff, 0xfe, 0xe7, 0x5b, 0x40, 0x5, 0xb8,
-    0x8b, 0xc0, 0x1, 0xfc, 0x0, 0x0, 0x0, 0x0,
-    0x0,
-
-    /* U+811A "脚" */
-    0x0, 0x0, 0x70, 0x0, 0xb, 0xf8, 0x1c, 0x2f,
-    0xe2, 0xee, 0x2f, 0x9b, 0xb8, 0xb2, 0x8f, 0xfa,
-    0xce, 0x2e, 0xe0, 0xb0, 0xb3, 0x8b, 0xf8, 0x1c,
-    0x2c, 0xe2, 0xde, 0xb, 0xb, 0x38, 0xb2, 0xaf,
-    0xfe, 0xce, 0x2c, 0xa6, 0xfa, 0xb3, 0x8b, 0xf8,
-    0x34, 0x2c, 0xe2, 0xee, 0x1d, 0xcb, 0x38, 0xa2,
-    0x8b, 0x36, 0xce, 0x38, 0xa3, 0x9e, 0xbb, 0x8d,
-    0x29, 0xff, 0xed, 0x43, 0x1e, 0x10, 0x1b, 0x1,
-    0xcb, 0x40, 0x2, 0xc0, 0x0, 0x0, 0x0, 0x0,
-    0x0,
-
-    /* U+8138 "脸" */
-    0x0, 0x0, 0x3, 0x40, 0x1, 0xff, 0x80, 0x7c,
-    0x0, 0x1e, 0xb8, 0x1f, 0xe0, 0x1, 0xc3, 0x83,
-    0xc7, 0xc0, 0x1c, 0x39, 0xf0, 0x1f, 0x41, 0xff,
-    0xfe, 0xaa, 0xbd, 0x1d, 0x7e, 0xbf, 0xfc, 0x81,
-    0xc3, 0x80, 0x0, 0x0, 0x1c, 0x38, 0x83, 0x43,
-    0x41, 0xff, 0x8c, 0x38, 0x70, 0x2e, 0xb8, 0xe2,
-    0xcb, 0x2, 0xc3, 0x8b, 0x1c, 0xd0, 0x28, 0x38,
-    0x60, 0x2c, 0x3, 0x83, 0x80, 0x3, 0x40, 0x35,
-    0xbb, 0xff, 0xff, 0xc7, 0x1f, 0x6a, 0xaa, 0xa8,
-    0x0, 0x0, 0x0, 0x0, 0x0,
-
-    /* U+8170 "腰" */
-    0x1f, 0xfb, 0xff, 0xff, 0xc1, 0xeb, 0x40, 0xc7,
-    0x0, 0x1c, 0x35, 0xae, 0xba, 0x1, 0xd7, 0x6f,
-    0xff, 0xf4, 0x1f, 0xf6, 0x8c, 0x73, 0x41, 0xc7,
-    0x68, 0xc7, 0x34, 0x1c, 0x36, 0xff, 0xff, 0x41,
-    0xc3, 0x55, 0xe5, 0x50, 0x2f, 0xf5, 0x6e, 0x55,
-    0x42, 0xdb, 0xbf, 0xff, 0xfc, 0x28, 0x34, 0x74,
-    0x1d, 0x3, 0x83, 0x4f, 0x43, 0xc0, 0x34, 0x34,
-    0x6f, 0xf4, 0x3, 0x1b, 0x46, 0xff, 0xe4, 0x72,
-    0xf3, 0xf8, 0x7, 0x80, 0x0, 0x0, 0x0, 0x0,
-
-    /* U+8179 "腹" */
-    0x0, 0x0, 0x24, 0x0, 0x1, 0xff, 0x87, 0xea,
-    0xa4, 0x1e, 0xb8, 0xff, 0xff, 0xc1, 0xc3, 0xbd,
-    0x0, 0x0, 0x1d, 0x7f, 0xff, 0xff, 0x1, 0xff,
-    0x8e, 0x0, 0xb0, 0x1c, 0x38, 0xff, 0xff, 0x1,
-    0xc3, 0x8e, 0x0, 0xb0, 0x1c, 0x38, 0xff, 0xff,
-    0x2, 0xff, 0x81, 0xe0, 0x0, 0x2d, 0x78, 0x3f,
-    0xff, 0x2, 0xc3, 0x9f, 0x96, 0xe0, 0x38, 0x3f,
-    0xad, 0xb8, 0x3, 0x43, 0x80, 0xff, 0x0, 0x71,
-    0xb9, 0xbe, 0xff, 0x87, 0x1f, 0x3d, 0x0, 0xb8,
-    0x0, 0x0, 0x0, 0x0, 0x0,
-
-    /* U+82C7 "苇" */
-    0x0, 0xe0, 0xb, 0x0, 0x3f, 0xff, 0xff, 0xff,
-    0xc5, 0x6f, 0x55, 0xf9, 0x50, 0x3, 0x85, 0x2c,
-    0x0, 0x0, 0x3, 0x80, 0x0, 0xf, 0xff, 0xff,
-    0xff, 0x41, 0x55, 0x7d, 0x55, 0x40, 0x15, 0x5f,
-    0x55, 0x40, 0xf, 0xff, 0xff, 0xf0, 0x0, 0x0,
-    0xe0, 0x0, 0x1, 0x55, 0x7d, 0x55, 0x52, 0xff,
-    0xff, 0xff, 0xf8, 0x0, 0x3, 0x80, 0xe, 0x0,
-    0x0, 0xe0, 0x7, 0x40, 0x0, 0x38, 0x2f, 0xc0,
-    0x0, 0xe, 0x6, 0x40,
-
-    /* U+82CD "苍" */
-    0x0, 0x38, 0x0, 0xe0, 0x0, 0x6a, 0xfa, 0xab,
-    0xea, 0x3, 0xff, 0xff, 0xff, 0xfd, 0x0, 0xe,
-    0x8, 0x38, 0x0, 0x0, 0x24, 0xf8, 0x90, 0x0,
-    0x0, 0x1f, 0xf8, 0x0, 0x0, 0x7, 0xf0, 0xbe,
-    0x0, 0x1, 0xfe, 0x0, 0x2f, 0xe4, 0x3f, 0xfa,
-    0xaa, 0xab, 0xd0, 0x53, 0xff, 0xff, 0xc0, 0x0,
-    0xf, 0x0, 0xe, 0x0, 0x0, 0x3c, 0x0, 0x38,
-    0x0, 0x0, 0xf0, 0x3f, 0xd0, 0x0, 0x3, 0xc0,
-    0x54, 0x2c, 0x0, 0xb, 0xaa, 0xaa, 0xf0, 0x0,
-    0xb, 0xff, 0xff, 0x0,
-
-    /* U+82E6 "苦" */
-    0x0, 0xe0, 0xb, 0x0, 0xaa, 0xfa, 0xaf, 0xaa,
-    0xff, 0xff, 0xff, 0xff, 0x0, 0xe0, 0xb, 0x0,
-    0x0, 0xe3, 0x8b, 0x0, 0x0, 0x3, 0xc0, 0x0,
-    0xff, 0xff, 0xff, 0xff, 0xaa, 0xab, 0xea, 0xaa,
-    0x0, 0x3, 0xc0, 0x0, 0x0, 0x3, 0xc0, 0x0,
-    0xf, 0xff, 0xff, 0xf0, 0xf, 0xaa, 0xaa, 0xf0,
-    0xf, 0x0, 0x0, 0xb0, 0xf, 0x0, 0x0, 0xb0,
-    0xf, 0xff, 0xff, 0xf0, 0xf, 0xaa, 0xaa, 0xf0,
-    0x0, 0x0, 0x0, 0x0,
-
-    /* U+83BA "莺" */
-    0x0, 0xe0, 0xf, 0x0, 0x3f, 0xff, 0xff, 0xff,
-    0xc5, 0x5f, 0x55, 0xf5, 0x50, 0x57, 0x95, 0x6d,
-    0x54, 0xbf, 0xff, 0xff, 0xfe, 0x2c, 0x0, 0xd0,
-    0x3, 0x8b, 0x7f, 0xff, 0xfe, 0xe0, 0x1d, 0x75,
-    0x57, 0x80, 0x7, 0xf, 0x40, 0xd0, 0x1, 0xc0,
-    0x73, 0xf0, 0x0, 0x75, 0x55, 0x65, 0x40, 0x1f,
-    0xff, 0xff, 0xf8, 0x0, 0x0, 0x0, 0xe, 0x3f,
-    0xff, 0xff, 0xc3, 0x45, 0x55, 0x55, 0x66, 0xd0,
-    0x0, 0x0, 0xf, 0xe0,
-
-    /* U+84DD "蓝" */
-    0x0, 0x3c, 0x2, 0xc0, 0x3, 0xff, 0xff, 0xff,
-    0xfc, 0x15, 0x7d, 0x57, 0xd5, 0x40, 0x1, 0x40,
-    0x64, 0x0, 0x6, 0x1d, 0xe, 0x0, 0x0, 0xb1,
-    0xd1, 0xff, 0xf4, 0xb, 0x1d, 0x2d, 0xa5, 0x0,
-    0xb1, 0xd7, 0x8e, 0x0, 0xb, 0x1d, 0xb0, 0x74,
-    0x0, 0x61, 0xd0, 0x3, 0x80, 0x1, 0x55, 0x55,
-    0x54, 0x0, 0x3f, 0xff, 0xff, 0xd0, 0x3, 0x47,
-    0xe, 0x1d, 0x0, 0x34, 0x70, 0xe1, 0xd0, 0x1b,
-    0x9b, 0x5e, 0x6e, 0x43, 0xff, 0xff, 0xff, 0xfc,
-
-    /* U+86C7 "蛇" */
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x1c, 0x0, 0x2c,
-    0x0, 0x1, 0xc0, 0x0, 0xe0, 0x0, 0x1c, 0x6,
-    0xaf, 0xa8, 0x2f, 0xff, 0xbf, 0xff, 0xc3, 0xed,
-    0xbb, 0x0, 0x2c, 0x39, 0xc7, 0x79, 0x1, 0xc3,
-    0x9c, 0x70, 0xe0, 0x0, 0x39, 0xc7, 0xe, 0x2,
-    0x3, 0xed, 0xb0, 0xe2, 0xf0, 0x3f, 0xff, 0xf,
-    0xf8, 0x2, 0x5c, 0x0, 0xf8, 0x0, 0x1, 0xca,
-    0xe, 0x0, 0x0, 0x1c, 0x70, 0xe0, 0x4, 0x17,
-    0xff, 0x4e, 0x0, 0xd3, 0xfa, 0x78, 0xf5, 0x6c,
-    0x0, 0x0, 0xb, 0xff, 0x80,
-
-    /* U+86CB "蛋" */
-    0x0, 0x0, 0x0, 0x0, 0x1, 0xff, 0xff, 0xff,
-    0xf4, 0x0, 0x90, 0xe0, 0xf, 0x0, 0x1d, 0xf,
-    0xff, 0x90, 0x3, 0xf0, 0xe5, 0x40, 0x0, 0xf7,
-    0xff, 0x55, 0x54, 0x3e, 0x6, 0xff, 0xff, 0x87,
-    0x80, 0x5, 0x0, 0x0, 0x11, 0x55, 0xf5, 0x54,
-    0x0, 0xbf, 0xff, 0xff, 0xc0, 0xb, 0x0, 0xe0,
-    0x2c, 0x0, 0xb5, 0x5f, 0x57, 0xc0, 0xb, 0xff,
-    0xff, 0xfc, 0x0, 0x0, 0xe, 0xf, 0x0, 0x2b,
-    0xff, 0xff, 0xfe, 0x3, 0xfe, 0xaa, 0x95, 0xb8,
-    0x0, 0x0, 0x0, 0x1, 0x0,
-
-    /* U+8702 "蜂" */
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x1c, 0x0, 0xb0,
-    0x0, 0x1, 0xc0, 0x1f, 0xfe, 0x0, 0x1c, 0x3,
-    0xd6, 0xe0, 0x2f, 0xfd, 0xfd, 0x3c, 0x3, 0xae,
-    0xec, 0xbf, 0x40, 0x35, 0xcc, 0x3, 0xf0, 0x3,
-    0x5c, 0xc2, 0xfb, 0xe0, 0x35, 0xcf, 0xf5, 0x8b,
-    0xd3, 0xad, 0xd9, 0x6d, 0x54, 0x3f, 0xfc, 0xbf,
-    0xff, 0x42, 0x6c, 0x1, 0x6d, 0x50, 0x2, 0xdc,
-    0x7f, 0xff, 0x0, 0x2c, 0xd0, 0x2c, 0x0, 0x17,
-    0xff, 0xff, 0xff, 0xc3, 0xf9, 0xf5, 0x6d, 0x54,
-    0x0, 0x0, 0x2, 0xc0, 0x0,
-
-    /* U+8910 "褐" */
-    0x2, 0x0, 0x0, 0x0, 0x0, 0x38, 0xf, 0xff,
-    0xf8, 0x2, 0xc0, 0xe5, 0x57, 0x83, 0xff, 0x8f,
-    0xff, 0xf8, 0x15, 0xb4, 0xe5, 0x57, 0x80, 0xb,
-    0xe, 0x55, 0x78, 0x1, 0xd0, 0xff, 0xff, 0x40,
-    0x3d, 0xc3, 0x80, 0x0, 0xf, 0xf4, 0xff, 0xff,
-    0xc2, 0xff, 0xad, 0x18, 0x2c, 0x77, 0x9b, 0xc2,
-    0xc2, 0xc1, 0x38, 0xd, 0xbb, 0x6c, 0x3, 0x80,
-    0xdc, 0x16, 0xc0, 0x38, 0xf, 0xff, 0x7c, 0x3,
-    0x80, 0x55, 0x57, 0x80, 0x38, 0x0, 0x3, 0xf0,
-    0x0, 0x0, 0x0, 0x0, 0x0,
-
-    /* U+89C2 "观" */
-    0x0, 0x0, 0x0, 0x0, 0x3, 0xff, 0xdb, 0xff,
-    0xf8, 0x2a, 0xae, 0xb9, 0x57, 0x80, 0x1, 0xdb,
-    0x18, 0x38, 0x8, 0x1c, 0xb2, 0xc3, 0x82, 0xd2,
-    0xcb, 0x2c, 0x38, 0xf, 0x3c, 0xb2, 0xc3, 0x80,
-    0x3f, 0x4b, 0x2c, 0x38, 0x2, 0xf0, 0xb2, 0xc3,
-    0x80, 0xf, 0xb, 0x3c, 0x38, 0x1, 0xf8, 0x63,
-    0xf2, 0x40, 0x3f, 0xc0, 0xbf, 0x0, 0xb, 0x5d,
-    0x1e, 0xb0, 0x91, 0xe0, 0x83, 0xcb, 0xe, 0x3c,
-    0x1, 0xf0, 0xb5, 0xd0, 0x0, 0x3c, 0x7, 0xfc,
-    0x0, 0x0, 0x0, 0x0, 0x0,
-
-    /* U+89D2 "角" */
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x2c, 0x0, 0x0,
-    0x0, 0x7f, 0xff, 0xc0, 0x0, 0xf5, 0x5b, 0xc0,
-    0x3, 0xd0, 0xf, 0x0, 0xf, 0xff, 0xff, 0xfe,
-    0x3f, 0xea, 0xfa, 0xaf, 0x7, 0xc0, 0xb0, 0xf,
-    0x3, 0xea, 0xfa, 0xaf, 0x3, 0xff, 0xff, 0xff,
-    0x3, 0xc0, 0xb0, 0xf, 0x3, 0xc0, 0xb0, 0xf,
-    0x3, 0xff, 0xff, 0xff, 0x7, 0x95, 0xf9, 0x5f,
-    0xb, 0x0, 0xb0, 0xf, 0x1e, 0x0, 0xb2, 0xaf,
-    0x1c, 0x0, 0xb1, 0xfd, 0x0, 0x0, 0x0, 0x0,
-
-    /* U+8BA1 "计" */
-    0x8, 0x0, 0xb, 0x0, 0x3, 0xc0, 0x2, 0xc0,
-    0x0, 0x7c, 0x0, 0xb0, 0x0, 0x3, 0x0, 0x2c,
-    0x0, 0x0, 0x0, 0xb, 0x0, 0x15, 0x40, 0x3,
-    0xc0, 0xf, 0xf4, 0xff, 0xff, 0xf5, 0x5d, 0x2a,
-    0xbe, 0xa9, 0x7, 0x40, 0xb, 0x0, 0x1, 0xd0,
-    0x2, 0xc0, 0x0, 0x74, 0x0, 0xb0, 0x0, 0x1d,
-    0x10, 0x2c, 0x0, 0x7, 0xfc, 0xb, 0x0, 0x1,
-    0xf8, 0x2, 0xc0, 0x0, 0xf4, 0x0, 0xb0, 0x0,
-    0x10, 0x0, 0x2c, 0x0,
-
-    /* U+901A "通" */
-    0x0, 0x0, 0x0, 0x0, 0x1, 0x80, 0xbf, 0xff,
-    0xf4, 0x1f, 0x1, 0x65, 0x7d, 0x0, 0x3c, 0xb,
-    0xfe, 0x0, 0x0, 0x46, 0xaf, 0xfa, 0x40, 0x0,
-    0xba, 0xfa, 0xb8, 0x15, 0x4b, 0xb, 0x3, 0x87,
-    0xf8, 0xbf, 0xff, 0xf8, 0x3, 0x8b, 0xb, 0x3,
-    0x80, 0x38, 0xb5, 0xb5, 0x78, 0x3, 0x8b, 0xff,
-    0xff, 0x80, 0x38, 0xb0, 0x70, 0x38, 0x3, 0x8b,
-    0x7, 0x17, 0x80, 0xbd, 0xb0, 0x72, 0xf0, 0x3d,
-    0x7e, 0x55, 0x5a, 0x83, 0x40, 0xbf, 0xff, 0xfc,
-    0x0, 0x0, 0x0, 0x0, 0x0,
-
-    /* U+91D1 "金" */
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xb, 0x0,
-    0x0, 0x0, 0x2, 0xf4, 0x0, 0x0, 0x0, 0xbf,
-    0xe0, 0x0, 0x0, 0x7e, 0xb, 0xd0, 0x0, 0x2f,
-    0x80, 0x1f, 0x90, 0x3f, 0xfa, 0xaa, 0xff, 0xc2,
-    0x8b, 0xff, 0xfe, 0x28, 0x0, 0x0, 0xf0, 0x0,
-    0x0, 0x0, 0xf, 0x0, 0x0, 0xf, 0xff, 0xff,
-    0xff, 0x0, 0x6a, 0xaf, 0xaa, 0x90, 0x1, 0xd0,
-    0xf0, 0x74, 0x0, 0xf, 0xf, 0xf, 0x0, 0x0,
-    0x34, 0xf1, 0xc0, 0x2, 0xab, 0xaf, 0xae, 0xa8,
-    0x3f, 0xff, 0xff, 0xff, 0xc0,
-
-    /* U+94F6 "银" */
-    0x2, 0x0, 0x0, 0x0, 0x0, 0x74, 0xb, 0xff,
-    0xf4, 0xf, 0xfd, 0xba, 0xab, 0x42, 0xea, 0x8b,
-    0x0, 0x34, 0x38, 0x0, 0xbf, 0xff, 0x42, 0xff,
-    0xcb, 0xaa, 0xb4, 0xb, 0xfc, 0xb0, 0x3, 0x40,
-    0x2c, 0xb, 0xaa, 0xf4, 0x17, 0xe4, 0xb7, 0xd5,
-    0x3, 0xff, 0xeb, 0x1c, 0x1c, 0x2, 0xc0, 0xb0,
-    0xeb, 0xc0, 0x2c, 0xb, 0xb, 0xd0, 0x2, 0xc0,
-    0xb0, 0x3c, 0x0, 0x2e, 0xeb, 0x16, 0xe0, 0x3,
-    0xf8, 0xff, 0xcb, 0xd0, 0x38, 0xf, 0x90, 0x2c,
-    0x0, 0x0, 0x0, 0x0, 0x0,
-
-    /* U+957F "长" */
-    0x0, 0xb0, 0x0, 0x14, 0x0, 0xb, 0x0, 0xb,
-    0xc0, 0x0, 0xb0, 0x2, 0xf0, 0x0, 0xb, 0x1,
-    0xf8, 0x0, 0x0, 0xb1, 0xfd, 0x0, 0x0, 0xb,
-    0xe, 0x0, 0x0, 0x0, 0xf0, 0x0, 0x0, 0x3,
-    0xff, 0xff, 0xff, 0xfc, 0x2a, 0xfa, 0xfe, 0xaa,
-    0x80, 0xb, 0x3, 0xc0, 0x0, 0x0, 0xb0, 0x2d,
-    0x0, 0x0, 0xb, 0x0, 0xf4, 0x0, 0x0, 0xb0,
-    0x3, 0xd0, 0x0, 0xb, 0x6, 0x1f, 0x80, 0x0,
-    0xff, 0xf0, 0x3f, 0x80, 0x1f, 0xe4, 0x0, 0x78,
-    0x0, 0x40, 0x0, 0x0, 0x0,
-
-    /* U+9633 "阳" */
-    0x0, 0x0, 0x0, 0x0, 0xbf, 0xf7, 0xff, 0xfe,
-    0xba, 0xf3, 0xea, 0xae, 0xb0, 0xe3, 0xc0, 0xe,
-    0xb2, 0xc3, 0xc0, 0xe, 0xb3, 0x83, 0xc0, 0xe,
-    0xb2, 0xc3, 0xc0, 0xe, 0xb0, 0xe3, 0xff, 0xfe,
-    0xb0, 0xb3, 0xea, 0xae, 0xb0, 0x73, 0xc0, 0xe,
-    0xb0, 0xb3, 0xc0, 0xe, 0xb7, 0xf3, 0xc0, 0xe,
-    0xb1, 0x43, 0xc0, 0xe, 0xb0, 0x3, 0xea, 0xae,
-    0xb0, 0x3, 0xff, 0xfe, 0xb0, 0x3, 0xc0, 0xe,
-    0x0, 0x0, 0x0, 0x0,
-
-    /* U+96BC "隼" */
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xf, 0x7, 0x40,
-    0x0, 0x2, 0xe0, 0x7c, 0x0, 0x0, 0x7f, 0xff,
-    0xff, 0xf0, 0x1f, 0xc0, 0x38, 0x0, 0x3, 0xff,
-    0xff, 0xff, 0xd0, 0x13, 0xd5, 0x79, 0x54, 0x0,
-    0x3d, 0x57, 0x95, 0x40, 0x3, 0xff, 0xff, 0xfd,
-    0x0, 0x3c, 0x3, 0x80, 0x0, 0x3, 0xff, 0xff,
-    0xff, 0x40, 0x3d, 0x5e, 0x55, 0x50, 0x0, 0x0,
-    0xf0, 0x0, 0x3, 0xff, 0xff, 0xff, 0xfd, 0x15,
-    0x55, 0xf5, 0x55, 0x40, 0x0, 0xf, 0x0, 0x0,
-    0x0, 0x0, 0xf0, 0x0, 0x0,
-
-    /* U+96C0 "雀" */
-    0x0, 0x0, 0xe0, 0x0, 0x0, 0xb, 0x4e, 0xb,
-    0x40, 0x1, 0xf0, 0xe0, 0x7e, 0x0, 0x3c, 0xe,
-    0x3d, 0xb8, 0xf, 0x0, 0xff, 0x43, 0x40, 0x0,
-    0x6f, 0x80, 0x0, 0x1, 0xbf, 0x9d, 0x0, 0x3,
-    0xff, 0xea, 0xfa, 0xa4, 0x29, 0xfa, 0xaf, 0xaa,
-    0x40, 0xf, 0x0, 0xf0, 0x0, 0x0, 0xff, 0xff,
-    0xfe, 0x0, 0xe, 0x0, 0xf0, 0x0, 0x0, 0xff,
-    0xff, 0xfe, 0x0, 0xf, 0x0, 0xf0, 0x0, 0x0,
-    0xfa, 0xaf, 0xaa, 0x40, 0xf, 0xff, 0xff, 0xf8,
-
-    /* U+96D5 "雕" */
-    0x0, 0x0, 0x1, 0x44, 0x2, 0xff, 0xfc, 0x39,
-    0xc0, 0x2d, 0xb6, 0xc3, 0x4d, 0x2, 0xc7, 0x1c,
-    0xbf, 0xfc, 0x2e, 0xfd, 0xdf, 0xbf, 0x82, 0xc7,
-    0x1f, 0xf1, 0xc0, 0x2d, 0xfa, 0xff, 0x2d, 0x2,
-    0xda, 0x9e, 0xbf, 0xfc, 0x2d, 0x55, 0xcb, 0x2d,
-    0x2, 0xef, 0xdc, 0xb1, 0xc0, 0x2e, 0x8d, 0xcb,
-    0x6e, 0x42, 0xa8, 0xdc, 0xbf, 0xfc, 0x2a, 0xfd,
-    0xcb, 0x1c, 0x3, 0x68, 0x1c, 0xb1, 0xc0, 0x34,
-    0xa, 0xcb, 0xff, 0xd7, 0x0, 0xf8, 0xba, 0xa9,
-
-    /* U+96E8 "雨" */
-    0xff, 0xff, 0xff, 0xff, 0x6a, 0xaa, 0xfa, 0xaa,
-    0x80, 0x0, 0x2c, 0x0, 0x0, 0xaa, 0xaf, 0xaa,
-    0xa4, 0x3f, 0xff, 0xff, 0xfe, 0xe, 0x0, 0xb0,
-    0x3, 0x83, 0xac, 0x2c, 0xe0, 0xe0, 0xe3, 0xeb,
-    0x1f, 0x78, 0x38, 0x16, 0xc0, 0x8e, 0xe, 0x40,
-    0xb2, 0x3, 0x83, 0xae, 0x2d, 0xf4, 0xe0, 0xe1,
-    0xeb, 0xb, 0x38, 0x38, 0x2, 0xc0, 0xe, 0xe,
-    0x0, 0xb0, 0x57, 0x83, 0x80, 0x2c, 0x1f, 0xd0,
-    0x0, 0x0, 0x0, 0x0,
-
-    /* U+9875 "页" */
-    0x2f, 0xff, 0xff, 0xff, 0xc6, 0xaa, 0xbe, 0xaa,
-    0xa0, 0x0, 0x2d, 0x0, 0x0, 0xa, 0xaf, 0xaa,
-    0xa0, 0x3, 0xff, 0xff, 0xfd, 0x0, 0xe0, 0x0,
-    0x7, 0x40, 0x38, 0xf, 0x1, 0xd0, 0xe, 0x3,
-    0xc0, 0x74, 0x3, 0x80, 0xf0, 0x1d, 0x0, 0xe0,
-    0x3c, 0x7, 0x40, 0x38, 0xf, 0x1, 0xd0, 0xe,
-    0xb, 0x68, 0x74, 0x0, 0xb, 0xcb, 0xe0, 0x0,
-    0x6f, 0x80, 0x2f, 0x82, 0xfe, 0x0, 0x0, 0xb8,
-    0x24, 0x0, 0x0, 0x4,
-
-    /* U+9886 "领" */
-    0x0, 0x70, 0x0, 0x0, 0x0, 0xf, 0x3, 0xff,
-    0xfc, 0x1, 0xfc, 0x1a, 0xfa, 0x80, 0x3c, 0xf0,
-    0xe, 0x0, 0xf, 0x43, 0x9f, 0xff, 0xc3, 0xdf,
-    0x1e, 0xd5, 0x7c, 0x14, 0x38, 0x1c, 0xb3, 0xc0,
-    0x1, 0x1, 0xcb, 0x3c, 0xf, 0xff, 0x5c, 0xb3,
-    0xc0, 0x55, 0xf1, 0xca, 0x3c, 0x0, 0xe, 0x1c,
-    0xa3, 0xc0, 0x12, 0xc1, 0xce, 0x3c, 0x7, 0xb4,
-    0x4, 0xd1, 0x40, 0x2f, 0x0, 0x2e, 0xd0, 0x0,
-    0xb4, 0xb, 0x4b, 0x40, 0x2, 0xc7, 0xd0, 0x2c,
-    0x0, 0x0, 0x10, 0x0, 0x40,
-
-    /* U+9888 "颈" */
-    0x2f, 0xfe, 0xff, 0xff, 0xc2, 0xab, 0xe6, 0xaf,
-    0xa8, 0x0, 0x3c, 0x2, 0xc0, 0x0, 0xf, 0x3,
-    0xff, 0xf8, 0x7, 0xfd, 0x39, 0x5b, 0x83, 0xe0,
-    0xf7, 0x49, 0x38, 0x24, 0x1, 0x34, 0xd3, 0x81,
-    0x55, 0x53, 0x4d, 0x38, 0x2f, 0xff, 0x34, 0xd3,
-    0x80, 0xe, 0x3, 0x4d, 0x38, 0x0, 0xe0, 0x35,
-    0xd3, 0x80, 0xe, 0x1, 0x2c, 0x10, 0x0, 0xff,
-    0x7, 0x7d, 0x3, 0xff, 0x92, 0xe0, 0xf4, 0x29,
-    0x0, 0xf8, 0x2, 0xc0, 0x0, 0x0, 0x0, 0x0,
-
-    /* U+9B3C "鬼" */
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xf0, 0x0,
-    0x0, 0x55, 0xf9, 0x55, 0x0, 0x3f, 0xff, 0xff,
-    0xc0, 0xe, 0x2, 0xc0, 0xb0, 0x3, 0x95, 0xf5,
-    0x7c, 0x0, 0xff, 0xff, 0xff, 0x0, 0x38, 0xf,
-    0x2, 0xc0, 0xe, 0x3, 0xc0, 0xb0, 0x3, 0xff,
-    0xff, 0xfc, 0x0, 0x0, 0xb9, 0x14, 0x0, 0x0,
-    0x3f, 0x8e, 0x40, 0x0, 0x3d, 0xe7, 0x34, 0x0,
-    0x3e, 0x3b, 0xff, 0x0, 0x7e, 0xe, 0x50, 0xb0,
-    0xbd, 0x3, 0xd5, 0x6c, 0x78, 0x0, 0xbf, 0xfe,
-    0x0, 0x0, 0x0, 0x0, 0x0,
-
-    /* U+9C7C "鱼" */
-    0x0, 0x4, 0x0, 0x0, 0x0, 0xb, 0x40, 0x0,
-    0x0, 0x7, 0xff, 0xf8, 0x0, 0x7, 0xea, 0xbd,
-    0x0, 0x7, 0xc0, 0xf, 0x0, 0x7, 0xfa, 0xaf,
-    0xaa, 0x3, 0xff, 0xff, 0xff, 0xd0, 0xe, 0x3,
-    0xc0, 0x74, 0x3, 0x80, 0xf0, 0x1d, 0x0, 0xff,
-    0xff, 0xff, 0x40, 0x38, 0xf, 0x1, 0xd0, 0xe,
-    0x3, 0xc0, 0x74, 0x3, 0xff, 0xff, 0xfd, 0x0,
-    0xaa, 0xaa, 0xaa, 0x40, 0x0, 0x0, 0x0, 0x0,
-    0xff, 0xff, 0xff, 0xff, 0x2a, 0xaa, 0xaa, 0xaa,
-    0x80,
-
-    /* U+9CFD "鳽" */
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1c,
-    0x0, 0x3f, 0xff, 0x47, 0xd5, 0x2, 0xfb, 0xe6,
-    0xff, 0xf0, 0x7, 0x1c, 0x2c, 0xb, 0x0, 0x71,
-    0xc2, 0xff, 0xf0, 0x7, 0x1c, 0x2c, 0xb, 0x0,
-    0xb2, 0xc2, 0xff, 0xf0, 0x7f, 0xff, 0xac, 0x0,
-    0x1, 0xb6, 0xd2, 0xff, 0xfd, 0xb, 0x1c, 0x2c,
-    0x0, 0x0, 0xb1, 0xc2, 0xff, 0xfc, 0xf, 0x1c,
-    0x15, 0x56, 0xc0, 0xe1, 0xc3, 0x69, 0xec, 0x2d,
-    0x1c, 0x73, 0x67, 0xc3, 0xc1, 0xce, 0x21, 0x38,
-    0x34, 0x1c, 0x0, 0x3f, 0x0, 0x0, 0x0, 0x0,
-    0x0,
-
-    /* U+9D5F "鵟" */
-    0x2, 0x10, 0x0, 0x0, 0x0, 0x7f, 0x2a, 0xbe,
-    0xa8, 0x3e, 0xb0, 0x57, 0x95, 0x0, 0x2f, 0x5f,
-    0xff, 0xf0, 0x3e, 0x35, 0x57, 0xd5, 0x40, 0x6f,
-    0x6f, 0xaa, 0xa8, 0x3, 0xe1, 0xe0, 0x0, 0x0,
-    0xf, 0xaa, 0xab, 0xc0, 0x0, 0xfa, 0xaa, 0xbc,
-    0x0, 0xf, 0xaa, 0xab, 0xc0, 0x0, 0xf5, 0x55,
-    0x54, 0x0, 0xf, 0xff, 0xff, 0xfc, 0x0, 0xfa,
-    0xaa, 0xaa, 0x0, 0x25, 0x9a, 0x65, 0x74, 0xf,
-    0x1c, 0x72, 0xcb, 0x2, 0xc0, 0x82, 0x7, 0xe0,
-    0x0, 0x0, 0x0, 0x0, 0x0,
-
-    /* U+9E1F "鸟" */
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x78, 0x0,
-    0x0, 0x1a, 0xbe, 0xaa, 0x40, 0xf, 0xff, 0xff,
-    0xe0, 0x3, 0xc0, 0x0, 0x38, 0x0, 0xf3, 0xe0,
-    0xe, 0x0, 0x3c, 0x1f, 0x7, 0x40, 0xf, 0x0,
-    0x4f, 0xc0, 0x3, 0xc0, 0x1, 0x40, 0x0, 0xff,
-    0xff, 0xff, 0xe0, 0x1a, 0xaa, 0xaa, 0xb8, 0x0,
-    0x0, 0x0, 0xe, 0x15, 0x55, 0x55, 0x43, 0x4f,
-    0xff, 0xff, 0xf1, 0xd0, 0x0, 0x0, 0x0, 0xb0,
-    0x0, 0x0, 0x5, 0x7c, 0x0, 0x0, 0x1, 0xfd,
-    0x0,
-
-    /* U+9E20 "鸠" */
-    0x0, 0x0, 0x0, 0x0, 0x1, 0xc0, 0x0, 0xe0,
-    0x0, 0x70, 0x2, 0xfa, 0xa0, 0x1c, 0x1, 0xff,
-    0xfc, 0x2f, 0xa4, 0x71, 0x7, 0xf, 0xfe, 0x1d,
-    0xf2, 0xc0, 0x72, 0x87, 0xa, 0xb0, 0x2c, 0xa1,
-    0xc1, 0x7c, 0xb, 0x28, 0x70, 0x7d, 0x2, 0xca,
-    0x1d, 0x55, 0x40, 0xb2, 0x87, 0xff, 0xfc, 0x38,
-    0xbd, 0x0, 0xf, 0xd, 0x3e, 0x55, 0x53, 0x87,
-    0xd, 0x3f, 0xfd, 0xe3, 0xc0, 0x0, 0x0, 0x35,
-    0xd0, 0x0, 0x1, 0x6d, 0x10, 0x0, 0x0, 0xfe,
-    0x0, 0x0, 0x0, 0x0, 0x0,
-
-    /* U+9E22 "鸢" */
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xe, 0xe,
-    0x0, 0x0, 0x1, 0xfa, 0xff, 0xc3, 0xff, 0xff,
-    0xfa, 0x54, 0x15, 0x1, 0xf, 0x80, 0x80, 0x0,
-    0x38, 0x2f, 0xec, 0x1, 0xff, 0xff, 0xff, 0x40,
-    0x2d, 0x65, 0x57, 0x80, 0x2, 0xcb, 0x40, 0x34,
-    0x0, 0x2c, 0x1f, 0x3f, 0x0, 0x2, 0xc0, 0x11,
-    0x50, 0x0, 0x2f, 0xff, 0xff, 0xf8, 0x0, 0x55,
-    0x55, 0x57, 0x80, 0x0, 0x0, 0x0, 0x34, 0x3f,
-    0xff, 0xff, 0xc3, 0x40, 0x0, 0x0, 0x19, 0xb0,
-    0x0, 0x0, 0x0, 0xfe, 0x0, 0x0, 0x0, 0x0,
-    0x0,
-
-    /* U+9E26 "鸦" */
-    0x0, 0x0, 0x1, 0xc0, 0x3, 0xff, 0xf5, 0x7d,
-    0x54, 0x15, 0x6e, 0x3f, 0xff, 0x80, 0xd1, 0xc3,
-    0xc4, 0x38, 0x1d, 0x1c, 0x3c, 0xe3, 0x41, 0xc1,
-    0xc3, 0xc7, 0x34, 0x2c, 0x2d, 0x3c, 0x7, 0x43,
-    0xff, 0xfb, 0xc3, 0xf0, 0x15, 0xfd, 0x3c, 0x14,
-    0x0, 0x1f, 0xc3, 0xff, 0xfc, 0x3, 0xdc, 0x0,
-    0x1, 0xc0, 0xb5, 0xc1, 0x55, 0x5c, 0x1e, 0x1c,
-    0xbf, 0xfd, 0xc3, 0xc1, 0xc0, 0x0, 0x2c, 0x12,
-    0xbc, 0x0, 0x17, 0x80, 0x2f, 0x80, 0x3, 0xf0,
-
-    /* U+9E2B "鸫" */
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xb0, 0x0, 0x34,
-    0x0, 0x2c, 0x0, 0xae, 0xa0, 0xff, 0xff, 0x7f,
-    0xfd, 0x2b, 0xaa, 0x5d, 0x43, 0x41, 0xc0, 0x7,
-    0x78, 0xd0, 0xe7, 0x1, 0xc2, 0x30, 0x35, 0xc0,
-    0x70, 0x6c, 0x2d, 0xb9, 0x1c, 0x3d, 0xf, 0xff,
-    0xd7, 0x55, 0x50, 0x7, 0x1, 0xff, 0xfc, 0x25,
-    0xdc, 0x0, 0x7, 0xd, 0x73, 0x85, 0x51, 0xc7,
-    0x1c, 0xb7, 0xfe, 0x73, 0x87, 0xd, 0x0, 0x28,
-    0x46, 0xc0, 0x1, 0x5e, 0x3, 0xe0, 0x0, 0xbf,
-    0x0, 0x0, 0x0, 0x0, 0x0,
-
-    /* U+9E2C "鸬" */
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x38, 0x0, 0x38,
-    0x0, 0xf, 0x54, 0x5e, 0x50, 0x3, 0xff, 0x7f,
-    0xfd, 0x0, 0xe0, 0x1c, 0x43, 0x42, 0xbe, 0x97,
-    0x38, 0xd1, 0xff, 0xf9, 0xc2, 0x34, 0x70, 0xe,
-    0x70, 0x6c, 0x1c, 0x3, 0x9c, 0x3e, 0x7, 0x0,
-    0xe7, 0x0, 0x1, 0xff, 0xf9, 0xff, 0xfc, 0x75,
-    0x5e, 0x15, 0x5b, 0x2c, 0x1, 0x55, 0x52, 0xcf,
-    0x0, 0xf, 0xfd, 0xb3, 0x80, 0x0, 0x0, 0x29,
-    0xd0, 0x0, 0x0, 0x5e, 0x20, 0x0, 0x0, 0x7f,
-    0x0, 0x0, 0x0, 0x0, 0x0,
-
-    /* U+9E2E "鸮" */
-    0x0, 0x0, 0x1, 0xd0, 0x1, 0xff, 0xf0, 0x7d,
-    0x54, 0x1d, 0xb, 0x2f, 0xff, 0x81, 0xc0, 0x72,
-    0xc4, 0x38, 0x1f, 0xff, 0x2c, 0xf3, 0x80, 0x55,
-    0x52, 0xc2, 0x34, 0x15, 0x55, 0x6c, 0x1b, 0x43,
-    0xff, 0xfe, 0xc2, 0xf0, 0xb, 0x0, 0x2c, 0x0,
-    0x0, 0xb5, 0x52, 0xff, 0xfc, 0xf, 0xff, 0x0,
-    0x1, 0xc0, 0x0, 0xb1, 0x55, 0x5c, 0x0, 0xb,
-    0x7f, 0xfd, 0xc0, 0x0, 0xe0, 0x0, 0x2c, 0x1,
-    0x6d, 0x0, 0x17, 0x80, 0x1f, 0xc0, 0x3, 0xf0,
-    0x0, 0x0, 0x0, 0x0, 0x0,
-
-    /* U+9E30 "鸰" */
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xb, 0x0, 0x1d,
-    0x0, 0x0, 0xf0, 0x7, 0xd5, 0x40, 0x2f, 0xc2,
-    0xff, 0xf8, 0x3, 0x8f, 0x2c, 0x43, 0x80, 0xf0,
-    0x7a, 0xce, 0x38, 0x3d, 0xe2, 0xec, 0x37, 0x42,
-    0x47, 0x2, 0xc1, 0x74, 0x0, 0x20, 0x2c, 0x3f,
-    0x1, 0xff, 0xf2, 0xc0, 0x0, 0xa, 0xaf, 0x6f,
-    0xff, 0xd0, 0x0, 0xf0, 0x0, 0x1c, 0x1, 0x2c,
-    0x15, 0x55, 0xc0, 0xbb, 0x87, 0xff, 0xdc, 0x2,
-    0xf0, 0x0, 0x2, 0xc0, 0x7, 0xc0, 0x1, 0x7c,
-    0x0, 0x18, 0x0, 0x3f, 0x40, 0x0, 0x0, 0x0,
-    0x0,
-
-    /* U+9E32 "鸲" */
-    0x1, 0x0, 0x0, 0x40, 0x1, 0xd0, 0x0, 0xb0,
-    0x0, 0xb0, 0x1, 0xff, 0xe0, 0x3f, 0xfe, 0xba,
-    0xbc, 0x1e, 0xab, 0xad, 0x4b, 0xf, 0x0, 0xeb,
-    0x76, 0xc7, 0x95, 0x3a, 0xc6, 0xf0, 0xff, 0xce,
-    0xb1, 0x78, 0x1c, 0x73, 0xac, 0xbc, 0x7, 0x1c,
-    0xeb, 0x0, 0x41, 0xc7, 0x36, 0xff, 0xf8, 0x76,
-    0xcd, 0x0, 0xe, 0x1f, 0xf3, 0x55, 0x53, 0x87,
-    0x0, 0xdf, 0xfd, 0xe0, 0x0, 0x70, 0x0, 0x74,
-    0x1, 0x7c, 0x1, 0x7c, 0x0, 0xfd, 0x0, 0xfe,
-    0x0, 0x0, 0x0, 0x0, 0x0,
-
-    /* U+9E3A "鸺" */
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x38, 0xe0, 0xe,
-    0x0, 0x3, 0x4e, 0x5, 0xe5, 0x0, 0xb0, 0xe0,
-    0xff, 0xf0, 0xe, 0xe, 0xe, 0x47, 0x1, 0xef,
-    0xfd, 0xee, 0x70, 0x3e, 0x6f, 0x8e, 0x3b, 0xb,
-    0xe1, 0xe0, 0xe1, 0xf0, 0xae, 0x2f, 0x4e, 0x3d,
-    0x0, 0xe3, 0xfc, 0xe0, 0x0, 0xe, 0x7e, 0xdf,
-    0xff, 0xc0, 0xea, 0xe8, 0x0, 0x2c, 0xe, 0xde,
-    0x15, 0x52, 0xc0, 0xec, 0xe3, 0xff, 0xbc, 0xe,
-    0xe, 0x0, 0x3, 0xc0, 0xe0, 0xe0, 0x1, 0x78,
-    0xe, 0xe, 0x0, 0x3f, 0x0,
-
-    /* U+9E3B "鸻" */
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x34, 0x0, 0x7,
-    0x0, 0xb, 0x3f, 0xe1, 0xf5, 0x1, 0xd1, 0x55,
-    0xbf, 0xf4, 0x38, 0x0, 0xb, 0x3, 0x41, 0x38,
-    0x0, 0xbb, 0x34, 0x7, 0xbf, 0xeb, 0x27, 0x40,
-    0xf2, 0xbd, 0xb1, 0xb0, 0x2f, 0x3, 0x4b, 0x3e,
-    0x7, 0xf0, 0x34, 0xb0, 0x0, 0x1b, 0x3, 0x4b,
-    0xff, 0xc0, 0xb0, 0x34, 0x0, 0x1c, 0xb, 0x3,
-    0x45, 0x55, 0xc0, 0xb0, 0x36, 0xff, 0xdc, 0xb,
-    0x3, 0x40, 0x2, 0xc0, 0xb1, 0x74, 0x1, 0x78,
-    0xb, 0x2f, 0x0, 0x3f, 0x0, 0x0, 0x0, 0x0,
-    0x0,
-
-    /* U+9E43 "鹃" */
-    0x0, 0x0, 0x6, 0x0, 0x3f, 0xfc, 0xb, 0x0,
-    0x35, 0x6c, 0x7f, 0xfc, 0x35, 0x6c, 0x71, 0x2c,
-    0x3f, 0xfc, 0x77, 0x6c, 0x0, 0x0, 0x71, 0xac,
-    0xbf, 0xfd, 0x70, 0x78, 0xb5, 0x5d, 0x71, 0xf4,
-    0xb5, 0x5d, 0x70, 0x4, 0xbf, 0xfd, 0x7f, 0xfe,
-    0xb0, 0xd, 0x0, 0xe, 0xb5, 0x5d, 0x55, 0x4e,
-    0xbf, 0xfe, 0xff, 0xde, 0xb0, 0xd, 0x0, 0x1d,
-    0xb0, 0x5d, 0x1, 0x6c, 0xb0, 0xbc, 0x2, 0xf8,
-    0x0, 0x0, 0x0, 0x0,
-
-    /* U+9E4A "鹊" */
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x70, 0xd0, 0xb,
-    0x0, 0x7, 0xd, 0xa, 0xfa, 0x3, 0xff, 0xfc,
-    0xff, 0xf4, 0x2b, 0xae, 0x8e, 0x43, 0x40, 0x70,
-    0xd0, 0xee, 0x34, 0xb, 0x5e, 0xe, 0x37, 0x7,
-    0xff, 0xfd, 0xe1, 0xb0, 0x15, 0x55, 0x4e, 0x3e,
-    0x0, 0xaa, 0xa0, 0xe0, 0x0, 0x1f, 0xaf, 0x4f,
-    0xff, 0xc1, 0xc0, 0x34, 0x0, 0x2c, 0x1f, 0xab,
-    0x55, 0x55, 0xc1, 0xfa, 0xb7, 0xff, 0xec, 0x1c,
-    0x3, 0x40, 0x2, 0xc1, 0xe5, 0xb4, 0x1, 0x78,
-    0x1f, 0xff, 0x40, 0x3f, 0x0, 0x0, 0x0, 0x0,
-    0x0,
-
-    /* U+9E4E "鹎" */
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x3c, 0x0, 0x38,
-    0x0, 0x6e, 0x54, 0xae, 0xa0, 0x7f, 0xff, 0x7f,
-    0xfd, 0x1c, 0xb2, 0xdd, 0x43, 0x47, 0x6d, 0xb7,
-    0x74, 0xd1, 0xff, 0xfd, 0xd7, 0x34, 0x72, 0xcb,
-    0x74, 0x6c, 0x1e, 0xfb, 0xdd, 0x3e, 0x6, 0xfa,
-    0xa7, 0x40, 0x0, 0x75, 0x81, 0xff, 0xfc, 0xb8,
-    0x70, 0x0, 0x7, 0x3e, 0xbe, 0x85, 0x51, 0xcf,
-    0xff, 0xfb, 0xfe, 0x70, 0x1, 0xc0, 0x0, 0x28,
-    0x0, 0x70, 0x0, 0x4e, 0x0, 0x1c, 0x0, 0x7f,
-    0x0, 0x0, 0x0, 0x0, 0x0,
-
-    /* U+9E5A "鹚" */
-    0x0, 0x0, 0x0, 0x10, 0x0, 0xa0, 0x38, 0xb,
-    0x0, 0x7, 0x7, 0x6, 0xfa, 0x40, 0x34, 0xe0,
-    0xba, 0xb4, 0x3f, 0xff, 0xfa, 0x53, 0x41, 0xa5,
-    0x75, 0xa7, 0x34, 0xb, 0x3, 0x4a, 0x13, 0x40,
-    0xd0, 0x70, 0xa1, 0xb4, 0x1c, 0xdd, 0xba, 0x3e,
-    0x3, 0x9e, 0xcd, 0xb0, 0x0, 0x3f, 0xaf, 0xcb,
-    0xff, 0xc1, 0x70, 0x28, 0x0, 0x1c, 0xb, 0x43,
-    0x85, 0x55, 0xc0, 0xdc, 0xaa, 0xff, 0xdc, 0x3e,
-    0xde, 0xb0, 0x2, 0xc3, 0xaf, 0xeb, 0x1, 0x7c,
-    0x0, 0x40, 0x10, 0x3f, 0x40, 0x0, 0x0, 0x0,
-    0x0,
-
-    /* U+9E5E "鹞" */
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x1, 0xb8, 0xe,
-    0x0, 0x2f, 0xfe, 0x46, 0xe5, 0x42, 0x99, 0x8,
-    0xff, 0xf8, 0x2c, 0xe2, 0xce, 0x43, 0x80, 0xc7,
-    0x34, 0xef, 0x34, 0xd, 0x7, 0xe, 0x37, 0x40,
-    0xf5, 0x50, 0xe1, 0x74, 0x1f, 0xff, 0x8e, 0x3f,
-    0x3, 0xcb, 0x0, 0xe0, 0x0, 0x29, 0xf5, 0x4f,
-    0xff, 0xc3, 0xff, 0xfd, 0x0, 0x1c, 0x4, 0xb1,
-    0x55, 0x55, 0xc1, 0xcb, 0x3a, 0xff, 0xec, 0x1c,
-    0xb3, 0x80, 0x2, 0xc1, 0xff, 0xf8, 0x1, 0x78,
-    0x1a, 0xa7, 0x80, 0x7f, 0x0, 0x0, 0x0, 0x0,
-    0x0,
-
-    /* U+9E60 "鹠" */
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x68, 0x0, 0xe,
-    0x0, 0x3f, 0x7f, 0xe6, 0xe5, 0x43, 0x41, 0xde,
-    0xff, 0xf8, 0x35, 0xc, 0xee, 0x43, 0x83, 0x68,
-    0xce, 0xeb, 0x34, 0x3f, 0xdc, 0xee, 0x23, 0x43,
-    0xdf, 0xbd, 0xe1, 0xb0, 0x0, 0x11, 0xe, 0x3e,
-    0x1, 0xaa, 0xa8, 0xe0, 0x0, 0x2e, 0xfb, 0xcf,
-    0xff, 0xc2, 0x8b, 0x3c, 0x0, 0x2c, 0x2e, 0xfb,
-    0xc5, 0x56, 0xc2, 0xef, 0xbe, 0xff, 0xac, 0x28,
-    0xb3, 0xc0, 0x3, 0xc2, 0xff, 0xfc, 0x0, 0x78,
-    0x2d, 0x57, 0xc0, 0x7f, 0x0, 0x0, 0x0, 0x0,
-    0x0,
-
-    /* U+9E61 "鹡" */
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x1d, 0x10, 0x3c,
-    0x2, 0xe7, 0x2d, 0x5e, 0x50, 0x5, 0xd8, 0x3f,
-    0xfd, 0x5, 0xb2, 0x4e, 0x43, 0x4f, 0xbd, 0x77,
-    0xac, 0xd0, 0x3d, 0xe0, 0xe1, 0x30, 0x7d, 0xf,
-    0x38, 0xac, 0x3f, 0xff, 0xde, 0x19, 0x2, 0xd5,
-    0xe3, 0x95, 0x50, 0xb5, 0x78, 0xff, 0xfc, 0x2f,
-    0xfe, 0x0, 0x7, 0xb, 0x3, 0x95, 0x55, 0xc2,
-    0xff, 0xeb, 0xfe, 0x70, 0xb5, 0x78, 0x0, 0x28,
-    0x2c, 0x5e, 0x0, 0x5e, 0xb, 0x2f, 0x40, 0x3f,
-    0x0,
-
-    /* U+9E6C "鹬" */
-    0x0, 0x0, 0x0, 0x50, 0x0, 0xff, 0xf8, 0x1f,
-    0x54, 0x2, 0x9f, 0x7, 0xff, 0xc2, 0xbf, 0xe9,
-    0x71, 0x2c, 0x2a, 0xfe, 0xd7, 0x36, 0xc0, 0x7a,
-    0x6c, 0x71, 0xa8, 0x3d, 0x34, 0x7, 0x3, 0x80,
-    0xf, 0x0, 0x72, 0xf0, 0x1f, 0xff, 0xd7, 0x0,
-    0x1, 0xc9, 0x8d, 0x7f, 0xfc, 0x1d, 0xcd, 0xd0,
-    0x1, 0xc1, 0xee, 0xed, 0x55, 0x5c, 0x1c, 0xdc,
-    0xdf, 0xfd, 0xc1, 0xcc, 0xcd, 0x0, 0x2c, 0x1c,
-    0xfc, 0xd0, 0x17, 0x81, 0xc8, 0x3c, 0x3, 0xf0,
-    0x0, 0x0, 0x0, 0x0, 0x0,
-
-    /* U+9E6D "鹭" */
-    0x0, 0x0, 0x0, 0x40, 0x1, 0xff, 0xf5, 0xbf,
-    0xf0, 0x1f, 0xff, 0x67, 0xad, 0x0, 0x4e, 0x1,
-    0xbf, 0xe4, 0xc, 0xff, 0x6e, 0x5b, 0x80, 0xce,
-    0x10, 0xe5, 0xb0, 0x3f, 0xfe, 0x8f, 0xaf, 0x1,
-    0x4, 0x2e, 0x55, 0x0, 0x2, 0xff, 0xff, 0xf4,
-    0x0, 0x2c, 0x74, 0x3, 0x40, 0x2, 0xc1, 0xf2,
-    0xf0, 0x0, 0x2d, 0x56, 0x69, 0x50, 0x1, 0xff,
-    0xff, 0xff, 0x81, 0x55, 0x55, 0x54, 0x34, 0x3f,
-    0xff, 0xff, 0xc7, 0x40, 0x0, 0x0, 0xf, 0xe0,
-    0x0, 0x0, 0x0, 0x0, 0x0,
-
-    /* U+9E70 "鹰" */
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xb, 0x40,
-    0x0, 0xf, 0xff, 0xff, 0xff, 0xd0, 0xf0, 0xa2,
-    0x8a, 0x0, 0xf, 0xd, 0x3f, 0xff, 0x80, 0xf3,
-    0xcf, 0xb, 0x0, 0xf, 0xfe, 0xfa, 0xfa, 0x0,
-    0xf5, 0xc7, 0xaf, 0xa0, 0xe, 0x1c, 0x75, 0xb5,
-    0x40, 0xe1, 0xcb, 0x55, 0x54, 0xe, 0x1b, 0xea,
-    0xa9, 0x0, 0xe2, 0xdf, 0x55, 0xd0, 0xd, 0x28,
-    0x6d, 0xbc, 0x1, 0xc2, 0xea, 0xfa, 0xa8, 0x2c,
-    0x5, 0x55, 0x57, 0xc3, 0x9f, 0xff, 0xff, 0x38,
-    0x20, 0x0, 0x0, 0x7f, 0x40, 0x0, 0x0, 0x0,
-    0x0,
-
-    /* U+9EC4 "黄" */
-    0x0, 0x2c, 0x3, 0xc0, 0x0, 0x6b, 0xea, 0xbe,
-    0xa0, 0xb, 0xff, 0xff, 0xff, 0x0, 0x2, 0xc0,
-    0x3c, 0x0, 0x2a, 0xbf, 0xab, 0xea, 0x83, 0xff,
-    0xff, 0xff, 0xfc, 0x0, 0x0, 0xf0, 0x0, 0x0,
-    0x3f, 0xff, 0xff, 0xd0, 0x3, 0x80, 0xf0, 0x1d,
-    0x0, 0x39, 0x5f, 0x56, 0xd0, 0x3, 0xff, 0xff,
-    0xfd, 0x0, 0x38, 0xf, 0x1, 0xd0, 0x3, 0xff,
-    0xff, 0xfd, 0x0, 0x1, 0x90, 0x29, 0x0, 0x1,
-    0xfd, 0x2, 0xf9, 0x2, 0xfd, 0x0, 0x1, 0xf8,
-    0x4, 0x0, 0x0, 0x1, 0x0,
-
-    /* U+9ED1 "黑" */
-    0x3, 0xff, 0xff, 0xfe, 0x0, 0x39, 0x4b, 0x8,
-    0xe0, 0x3, 0x9c, 0xb2, 0xce, 0x0, 0x38, 0xdb,
-    0x34, 0xe0, 0x3, 0xd9, 0xfa, 0x5e, 0x0, 0x3f,
-    0xff, 0xff, 0xe0, 0x0, 0x0, 0xb0, 0x0, 0x0,
-    0xbf, 0xff, 0xff, 0xe0, 0x1, 0x55, 0xf5, 0x54,
-    0x0, 0x0, 0xb, 0x0, 0x0, 0x3f, 0xff, 0xff,
-    0xff, 0xc2, 0xaa, 0xaa, 0xaa, 0xa8, 0x3, 0x45,
-    0x5, 0xe, 0x0, 0xf0, 0xb0, 0xb0, 0xb4, 0x2e,
-    0xb, 0x7, 0x43, 0xc1, 0x80, 0x50, 0x10, 0x14,
-
-    /* U+FF01 "！" */
-    0x10, 0x7c, 0x7c, 0x7c, 0x7c, 0x78, 0x38, 0x38,
-    0x38, 0x34, 0x0, 0x24, 0xbc, 0x7c, 0x0,
-
-    /* U+FF08 "（" */
-    0x0, 0x0, 0x3c, 0xb, 0x1, 0xd0, 0x3c, 0x3,
-    0x40, 0x70, 0xb, 0x0, 0xb0, 0xb, 0x0, 0xb0,
-    0xb, 0x0, 0x74, 0x3, 0xc0, 0x2d, 0x0, 0xf0,
-    0x7, 0x80, 0x14,
-
-    /* U+FF09 "）" */
-    0x0, 0x3, 0xc0, 0xe, 0x0, 0x74, 0x3, 0xc0,
-    0x1c, 0x0, 0xd0, 0xe, 0x0, 0xe0, 0xe, 0x0,
-    0xe0, 0xe, 0x1, 0xd0, 0x3c, 0x7, 0x80, 0xf0,
-    0x2d, 0x1, 0x40,
-
-    /* U+FF0C "，" */
-    0x0, 0xb, 0xc3, 0xf4, 0x2d, 0x7, 0x7, 0x83,
-    0x80, 0x0,
-
-    /* U+FF1A "：" */
-    0x1d, 0xf, 0xc2, 0xe0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x7, 0x43, 0xf0, 0xb8, 0x0,
-    0x0,
-
-    /* U+FF1F "？" */
-    0x2, 0xa4, 0xb, 0xff, 0x83, 0x81, 0xf0, 0x0,
-    0x2d, 0x0, 0xf, 0x0, 0xb, 0x80, 0xb, 0x80,
-    0x7, 0xc0, 0x2, 0xd0, 0x0, 0x60, 0x0, 0x0,
-    0x0, 0x6, 0x0, 0x3, 0xe0, 0x0, 0xf4, 0x0,
-    0x0, 0x0,
-
-    /* U+FFE5 "￥" */
-    0x2e, 0x0, 0xf, 0x43, 0xc0, 0xb, 0x80, 0xb8,
-    0x3, 0xc0, 0xf, 0x2, 0xd0, 0x1, 0xf0, 0xf0,
-    0x0, 0x2d, 0xb0, 0x0, 0x7, 0xf8, 0x0, 0x3f,
-    0xff, 0xf4, 0x0, 0x1f, 0x0, 0x3, 0xff, 0xff,
-    0x40, 0x1, 0xf0, 0x0, 0x0, 0x7c, 0x0, 0x0,
-    0x1f, 0x0, 0x0
-};
-
-
-/*---------------------
- *  GLYPH DESCRIPTION
- *--------------------*/
-
-static const lv_font_fmt_txt_glyph_dsc_t glyph_dsc[] = {
-    {.bitmap_index = 0, .adv_w = 0, .box_w = 0, .box_h = 0, .ofs_x = 0, .ofs_y = 0} /* id = 0 reserved */,
-    {.bitmap_index = 0, .adv_w = 65, .box_w = 0, .box_h = 0, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 0, .adv_w = 99, .box_w = 4, .box_h = 13, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 13, .adv_w = 164, .box_w = 10, .box_h = 13, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 46, .adv_w = 164, .box_w = 10, .box_h = 17, .ofs_x = 0, .ofs_y = -2},
-    {.bitmap_index = 89, .adv_w = 270, .box_w = 17, .box_h = 13, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 145, .adv_w = 203, .box_w = 13, .box_h = 13, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 188, .adv_w = 103, .box_w = 5, .box_h = 19, .ofs_x = 1, .ofs_y = -4},
-    {.bitmap_index = 212, .adv_w = 103, .box_w = 5, .box_h = 19, .ofs_x = 0, .ofs_y = -4},
-    {.bitmap_index = 236, .adv_w = 139, .box_w = 7, .box_h = 7, .ofs_x = 1, .ofs_y = 7},
-    {.bitmap_index = 249, .adv_w = 164, .box_w = 10, .box_h = 10, .ofs_x = 0, .ofs_y = 2},
-    {.bitmap_index = 274, .adv_w = 86, .box_w = 5, .box_h = 7, .ofs_x = 0, .ofs_y = -4},
-    {.bitmap_index = 283, .adv_w = 103, .box_w = 6, .box_h = 2, .ofs_x = 0, .ofs_y = 4},
-    {.bitmap_index = 286, .adv_w = 86, .box_w = 4, .box_h = 3, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 289, .adv_w = 112, .box_w = 7, .box_h = 18, .ofs_x = 0, .ofs_y = -4},
-    {.bitmap_index = 321, .adv_w = 164, .box_w = 10, .box_h = 13, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 354, .adv_w = 164, .box_w = 9, .box_h = 13, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 384, .adv_w = 164, .box_w = 10, .box_h = 13, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 417, .adv_w = 164, .box_w = 10, .box_h = 13, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 450, .adv_w = 164, .box_w = 10, .box_h = 13, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 483, .adv_w = 164, .box_w = 10, .box_h = 13, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 516, .adv_w = 164, .box_w = 10, .box_h = 13, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 549, .adv_w = 164, .box_w = 10, .box_h = 13, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 582, .adv_w = 164, .box_w = 10, .box_h = 13, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 615, .adv_w = 164, .box_w = 10, .box_h = 13, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 648, .adv_w = 86, .box_w = 4, .box_h = 10, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 658, .adv_w = 280, .box_w = 16, .box_h = 17, .ofs_x = 1, .ofs_y = -4},
-    {.bitmap_index = 726, .adv_w = 179, .box_w = 12, .box_h = 13, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 765, .adv_w = 192, .box_w = 11, .box_h = 13, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 801, .adv_w = 186, .box_w = 11, .box_h = 13, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 837, .adv_w = 201, .box_w = 11, .box_h = 13, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 873, .adv_w = 173, .box_w = 9, .box_h = 13, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 903, .adv_w = 163, .box_w = 9, .box_h = 13, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 933, .adv_w = 202, .box_w = 11, .box_h = 13, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 969, .adv_w = 213, .box_w = 11, .box_h = 13, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 1005, .adv_w = 89, .box_w = 3, .box_h = 13, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 1015, .adv_w = 158, .box_w = 9, .box_h = 13, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 1045, .adv_w = 191, .box_w = 11, .box_h = 13, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 1081, .adv_w = 161, .box_w = 9, .box_h = 13, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 1111, .adv_w = 239, .box_w = 13, .box_h = 13, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 1154, .adv_w = 211, .box_w = 11, .box_h = 13, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 1190, .adv_w = 217, .box_w = 12, .box_h = 13, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 1229, .adv_w = 187, .box_w = 10, .box_h = 13, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 1262, .adv_w = 217, .box_w = 12, .box_h = 16, .ofs_x = 1, .ofs_y = -3},
-    {.bitmap_index = 1310, .adv_w = 189, .box_w = 11, .box_h = 13, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 1346, .adv_w = 175, .box_w = 11, .box_h = 13, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 1382, .adv_w = 176, .box_w = 11, .box_h = 13, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 1418, .adv_w = 211, .box_w = 11, .box_h = 13, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 1454, .adv_w = 171, .box_w = 12, .box_h = 13, .ofs_x = -1, .ofs_y = 0},
-    {.bitmap_index = 1493, .adv_w = 257, .box_w = 16, .box_h = 13, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 1545, .adv_w = 172, .box_w = 11, .box_h = 13, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 1581, .adv_w = 159, .box_w = 12, .box_h = 13, .ofs_x = -1, .ofs_y = 0},
-    {.bitmap_index = 1620, .adv_w = 175, .box_w = 11, .box_h = 13, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 1656, .adv_w = 164, .box_w = 9, .box_h = 8, .ofs_x = 1, .ofs_y = 6},
-    {.bitmap_index = 1674, .adv_w = 162, .box_w = 10, .box_h = 3, .ofs_x = 0, .ofs_y = -3},
-    {.bitmap_index = 1682, .adv_w = 166, .box_w = 9, .box_h = 10, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 1705, .adv_w = 181, .box_w = 10, .box_h = 14, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 1740, .adv_w = 149, .box_w = 9, .box_h = 10, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 1763, .adv_w = 181, .box_w = 10, .box_h = 14, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 1798, .adv_w = 163, .box_w = 10, .box_h = 10, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 1823, .adv_w = 100, .box_w = 7, .box_h = 14, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 1848, .adv_w = 166, .box_w = 11, .box_h = 14, .ofs_x = 0, .ofs_y = -4},
-    {.bitmap_index = 1887, .adv_w = 179, .box_w = 9, .box_h = 14, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 1919, .adv_w = 83, .box_w = 3, .box_h = 14, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 1930, .adv_w = 83, .box_w = 5, .box_h = 18, .ofs_x = -1, .ofs_y = -4},
-    {.bitmap_index = 1953, .adv_w = 166, .box_w = 10, .box_h = 14, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 1988, .adv_w = 86, .box_w = 4, .box_h = 14, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 2002, .adv_w = 272, .box_w = 15, .box_h = 10, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 2040, .adv_w = 180, .box_w = 9, .box_h = 10, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 2063, .adv_w = 177, .box_w = 11, .box_h = 10, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 2091, .adv_w = 181, .box_w = 10, .box_h = 14, .ofs_x = 1, .ofs_y = -4},
-    {.bitmap_index = 2126, .adv_w = 181, .box_w = 10, .box_h = 14, .ofs_x = 0, .ofs_y = -4},
-    {.bitmap_index = 2161, .adv_w = 118, .box_w = 7, .box_h = 11, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 2181, .adv_w = 138, .box_w = 9, .box_h = 10, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 2204, .adv_w = 114, .box_w = 7, .box_h = 13, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 2227, .adv_w = 179, .box_w = 9, .box_h = 10, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 2250, .adv_w = 157, .box_w = 10, .box_h = 10, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 2275, .adv_w = 239, .box_w = 15, .box_h = 10, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 2313, .adv_w = 151, .box_w = 10, .box_h = 10, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 2338, .adv_w = 157, .box_w = 10, .box_h = 14, .ofs_x = 0, .ofs_y = -4},
-    {.bitmap_index = 2373, .adv_w = 141, .box_w = 9, .box_h = 10, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 2396, .adv_w = 259, .box_w = 16, .box_h = 3, .ofs_x = 0, .ofs_y = 4},
-    {.bitmap_index = 2408, .adv_w = 288, .box_w = 16, .box_h = 3, .ofs_x = 1, .ofs_y = 5},
-    {.bitmap_index = 2420, .adv_w = 288, .box_w = 7, .box_h = 6, .ofs_x = 0, .ofs_y = -1},
-    {.bitmap_index = 2431, .adv_w = 288, .box_w = 18, .box_h = 17, .ofs_x = 0, .ofs_y = -1},
-    {.bitmap_index = 2508, .adv_w = 288, .box_w = 18, .box_h = 17, .ofs_x = 0, .ofs_y = -2},
-    {.bitmap_index = 2585, .adv_w = 288, .box_w = 18, .box_h = 2, .ofs_x = 0, .ofs_y = 6},
-    {.bitmap_index = 2594, .adv_w = 288, .box_w = 17, .box_h = 16, .ofs_x = 0, .ofs_y = -1},
-    {.bitmap_index = 2662, .adv_w = 288, .box_w = 17, .box_h = 15, .ofs_x = 1, .ofs_y = -1},
-    {.bitmap_index = 2726, .adv_w = 288, .box_w = 17, .box_h = 18, .ofs_x = 0, .ofs_y = -2},
-    {.bitmap_index = 2803, .adv_w = 288, .box_w = 16, .box_h = 17, .ofs_x = 1, .ofs_y = -2},
-    {.bitmap_index = 2871, .adv_w = 288, .box_w = 18, .box_h = 16, .ofs_x = 0, .ofs_y = -2},
-    {.bitmap_index = 2943, .adv_w = 288, .box_w = 18, .box_h = 16, .ofs_x = 0, .ofs_y = -2},
-    {.bitmap_index = 3015, .adv_w = 288, .box_w = 18, .box_h = 16, .ofs_x = 0, .ofs_y = -2},
-    {.bitmap_index = 3087, .adv_w = 288, .box_w = 17, .box_h = 17, .ofs_x = 0, .ofs_y = -2},
-    {.bitmap_index = 3160, .adv_w = 288, .box_w = 18, .box_h = 17, .ofs_x = 0, .ofs_y = -1},
-    {.bitmap_index = 3237, .adv_w = 288, .box_w = 18, .box_h = 16, .ofs_x = 0, .ofs_y = -2},
-    {.bitmap_index = 3309, .adv_w = 288, .box_w = 18, .box_h = 17, .ofs_x = 0, .ofs_y = -2},
-    {.bitmap_index = 3386, .adv_w = 288, .box_w = 18, .box_h = 18, .ofs_x = 0, .ofs_y = -2},
-    {.bitmap_index = 3467, .adv_w = 288, .box_w = 17, .box_h = 16, .ofs_x = 1, .ofs_y = -1},
-    {.bitmap_index = 3535, .adv_w = 288, .box_w = 18, .box_h = 16, .ofs_x = 0, .ofs_y = -2},
-    {.bitmap_index = 3607, .adv_w = 288, .box_w = 17, .box_h = 16, .ofs_x = 1, .ofs_y = -2},
-    {.bitmap_index = 3675, .adv_w = 288, .box_w = 18, .box_h = 16, .ofs_x = 0, .ofs_y = -1},
-    {.bitmap_index = 3747, .adv_w = 288, .box_w = 17, .box_h = 18, .ofs_x = 1, .ofs_y = -2},
-    {.bitmap_index = 3824, .adv_w = 288, .box_w = 17, .box_h = 15, .ofs_x = 1, .ofs_y = -1},
-    {.bitmap_index = 3888, .adv_w = 288, .box_w = 18, .box_h = 18, .ofs_x = 0, .ofs_y = -2},
-    {.bitmap_index = 3969, .adv_w = 288, .box_w = 18, .box_h = 17, .ofs_x = 0, .ofs_y = -2},
-    {.bitmap_index = 4046, .adv_w = 288, .box_w = 18, .box_h = 17, .ofs_x = 0, .ofs_y = -2},
-    {.bitmap_index = 4123, .adv_w = 288, .box_w = 18, .box_h = 17, .ofs_x = 0, .ofs_y = -2},
-    {.bitmap_index = 4200, .adv_w = 288, .box_w = 18, .box_h = 18, .ofs_x = 0, .ofs_y = -2},
-    {.bitmap_index = 4281, .adv_w = 288, .box_w = 18, .box_h = 17, .ofs_x = 0, .ofs_y = -2},
-    {.bitmap_index = 4358, .adv_w = 288, .box_w = 18, .box_h = 16, .ofs_x = 0, .ofs_y = -2},
-    {.bitmap_index = 4430, .adv_w = 288, .box_w = 16, .box_h = 16, .ofs_x = 1, .ofs_y = -1},
-    {.bitmap_index = 4494, .adv_w = 288, .box_w = 18, .box_h = 16, .ofs_x = 0, .ofs_y = -1},
-    {.bitmap_index = 4566, .adv_w = 288, .box_w = 18, .box_h = 15, .ofs_x = 0, .ofs_y = -1},
-    {.bitmap_index = 4634, .adv_w = 288, .box_w = 18, .box_h = 17, .ofs_x = 0, .ofs_y = -2},
-    {.bitmap_index = 4711, .adv_w = 288, .box_w = 18, .box_h = 16, .ofs_x = 0, .ofs_y = -1},
-    {.bitmap_index = 4783, .adv_w = 288, .box_w = 18, .box_h = 18, .ofs_x = 0, .ofs_y = -2},
-    {.bitmap_index = 4864, .adv_w = 288, .box_w = 18, .box_h = 18, .ofs_x = 0, .ofs_y = -2},
-    {.bitmap_index = 4945, .adv_w = 288, .box_w = 18, .box_h = 18, .ofs_x = 0, .ofs_y = -2},
-    {.bitmap_index = 5026, .adv_w = 288, .box_w = 18, .box_h = 17, .ofs_x = 0, .ofs_y = -1},
-    {.bitmap_index = 5103, .adv_w = 288, .box_w = 13, .box_h = 16, .ofs_x = 3, .ofs_y = -2},
-    {.bitmap_index = 5155, .adv_w = 288, .box_w = 18, .box_h = 18, .ofs_x = 0, .ofs_y = -2},
-    {.bitmap_index = 5236, .adv_w = 288, .box_w = 17, .box_h = 18, .ofs_x = 1, .ofs_y = -2},
-    {.bitmap_index = 5313, .adv_w = 288, .box_w = 18, .box_h = 16, .ofs_x = 0, .ofs_y = -1},
-    {.bitmap_index = 5385, .adv_w = 288, .box_w = 18, .box_h = 16, .ofs_x = 0, .ofs_y = -1},
-    {.bitmap_index = 5457, .adv_w = 288, .box_w = 18, .box_h = 16, .ofs_x = 0, .ofs_y = -1},
-    {.bitmap_index = 5529, .adv_w = 288, .box_w = 18, .box_h = 16, .ofs_x = 0, .ofs_y = -1},
-    {.bitmap_index = 5601, .adv_w = 288, .box_w = 18, .box_h = 16, .ofs_x = 0, .ofs_y = -1},
-    {.bitmap_index = 5673, .adv_w = 288, .box_w = 18, .box_h = 17, .ofs_x = 0, .ofs_y = -2},
-    {.bitmap_index = 5750, .adv_w = 288, .box_w = 18, .box_h = 16, .ofs_x = 0, .ofs_y = -1},
-    {.bitmap_index = 5822, .adv_w = 288, .box_w = 18, .box_h = 16, .ofs_x = 0, .ofs_y = -1},
-    {.bitmap_index = 5894, .adv_w = 288, .box_w = 18, .box_h = 18, .ofs_x = 0, .ofs_y = -2},
-    {.bitmap_index = 5975, .adv_w = 288, .box_w = 18, .box_h = 17, .ofs_x = 0, .ofs_y = -2},
-    {.bitmap_index = 6052, .adv_w = 288, .box_w = 17, .box_h = 18, .ofs_x = 0, .ofs_y = -2},
-    {.bitmap_index = 6129, .adv_w = 288, .box_w = 18, .box_h = 16, .ofs_x = 0, .ofs_y = -1},
-    {.bitmap_index = 6201, .adv_w = 288, .box_w = 18, .box_h = 16, .ofs_x = 0, .ofs_y = -2},
-    {.bitmap_index = 6273, .adv_w = 288, .box_w = 14, .box_h = 18, .ofs_x = 2, .ofs_y = -2},
-    {.bitmap_index = 6336, .adv_w = 288, .box_w = 17, .box_h = 15, .ofs_x = 1, .ofs_y = -1},
-    {.bitmap_index = 6400, .adv_w = 288, .box_w = 17, .box_h = 16, .ofs_x = 1, .ofs_y = -2},
-    {.bitmap_index = 6468, .adv_w = 288, .box_w = 18, .box_h = 17, .ofs_x = 0, .ofs_y = -2},
-    {.bitmap_index = 6545, .adv_w = 288, .box_w = 18, .box_h = 17, .ofs_x = 0, .ofs_y = -1},
-    {.bitmap_index = 6622, .adv_w = 288, .box_w = 18, .box_h = 18, .ofs_x = 0, .ofs_y = -2},
-    {.bitmap_index = 6703, .adv_w = 288, .box_w = 18, .box_h = 18, .ofs_x = 0, .ofs_y = -2},
-    {.bitmap_index = 6784, .adv_w = 288, .box_w = 18, .box_h = 16, .ofs_x = 0, .ofs_y = -1},
-    {.bitmap_index = 6856, .adv_w = 288, .box_w = 18, .box_h = 18, .ofs_x = 0, .ofs_y = -2},
-    {.bitmap_index = 6937, .adv_w = 288, .box_w = 18, .box_h = 17, .ofs_x = 0, .ofs_y = -2},
-    {.bitmap_index = 7014, .adv_w = 288, .box_w = 18, .box_h = 15, .ofs_x = 0, .ofs_y = -1},
-    {.bitmap_index = 7082, .adv_w = 288, .box_w = 18, .box_h = 17, .ofs_x = 0, .ofs_y = -2},
-    {.bitmap_index = 7159, .adv_w = 288, .box_w = 17, .box_h = 15, .ofs_x = 1, .ofs_y = -1},
-    {.bitmap_index = 7223, .adv_w = 288, .box_w = 18, .box_h = 17, .ofs_x = 0, .ofs_y = -2},
-    {.bitmap_index = 7300, .adv_w = 288, .box_w = 17, .box_h = 17, .ofs_x = 0, .ofs_y = -2},
-    {.bitmap_index = 7373, .adv_w = 288, .box_w = 17, .box_h = 17, .ofs_x = 0, .ofs_y = -2},
-    {.bitmap_index = 7446, .adv_w = 288, .box_w = 18, .box_h = 17, .ofs_x = 0, .ofs_y = -2},
-    {.bitmap_index = 7523, .adv_w = 288, .box_w = 18, .box_h = 16, .ofs_x = 0, .ofs_y = -2},
-    {.bitmap_index = 7595, .adv_w = 288, .box_w = 18, .box_h = 17, .ofs_x = 0, .ofs_y = -2},
-    {.bitmap_index = 7672, .adv_w = 288, .box_w = 17, .box_h = 16, .ofs_x = 1, .ofs_y = -1},
-    {.bitmap_index = 7740, .adv_w = 288, .box_w = 19, .box_h = 16, .ofs_x = 0, .ofs_y = -1},
-    {.bitmap_index = 7816, .adv_w = 288, .box_w = 16, .box_h = 17, .ofs_x = 1, .ofs_y = -2},
-    {.bitmap_index = 7884, .adv_w = 288, .box_w = 17, .box_h = 16, .ofs_x = 1, .ofs_y = -1},
-    {.bitmap_index = 7952, .adv_w = 288, .box_w = 18, .box_h = 16, .ofs_x = 0, .ofs_y = -1},
-    {.bitmap_index = 8024, .adv_w = 288, .box_w = 18, .box_h = 17, .ofs_x = 0, .ofs_y = -1},
-    {.bitmap_index = 8101, .adv_w = 288, .box_w = 18, .box_h = 17, .ofs_x = 0, .ofs_y = -2},
-    {.bitmap_index = 8178, .adv_w = 288, .box_w = 18, .box_h = 17, .ofs_x = 0, .ofs_y = -1},
-    {.bitmap_index = 8255, .adv_w = 288, .box_w = 18, .box_h = 17, .ofs_x = 0, .ofs_y = -2},
-    {.bitmap_index = 8332, .adv_w = 288, .box_w = 18, .box_h = 17, .ofs_x = 0, .ofs_y = -2},
-    {.bitmap_index = 8409, .adv_w = 288, .box_w = 16, .box_h = 18, .ofs_x = 0, .ofs_y = -2},
-    {.bitmap_index = 8481, .adv_w = 288, .box_w = 17, .box_h = 16, .ofs_x = 1, .ofs_y = -1},
-    {.bitmap_index = 8549, .adv_w = 288, .box_w = 18, .box_h = 17, .ofs_x = 0, .ofs_y = -2},
-    {.bitmap_index = 8626, .adv_w = 288, .box_w = 18, .box_h = 17, .ofs_x = 0, .ofs_y = -1},
-    {.bitmap_index = 8703, .adv_w = 288, .box_w = 18, .box_h = 17, .ofs_x = 0, .ofs_y = -2},
-    {.bitmap_index = 8780, .adv_w = 288, .box_w = 18, .box_h = 17, .ofs_x = 0, .ofs_y = -2},
-    {.bitmap_index = 8857, .adv_w = 288, .box_w = 16, .box_h = 17, .ofs_x = 1, .ofs_y = -2},
-    {.bitmap_index = 8925, .adv_w = 288, .box_w = 18, .box_h = 17, .ofs_x = 0, .ofs_y = -1},
-    {.bitmap_index = 9002, .adv_w = 288, .box_w = 18, .box_h = 16, .ofs_x = 0, .ofs_y = -1},
-    {.bitmap_index = 9074, .adv_w = 288, .box_w = 18, .box_h = 16, .ofs_x = 0, .ofs_y = -1},
-    {.bitmap_index = 9146, .adv_w = 288, .box_w = 17, .box_h = 16, .ofs_x = 1, .ofs_y = -2},
-    {.bitmap_index = 9214, .adv_w = 288, .box_w = 17, .box_h = 16, .ofs_x = 0, .ofs_y = -2},
-    {.bitmap_index = 9282, .adv_w = 288, .box_w = 18, .box_h = 17, .ofs_x = 0, .ofs_y = -2},
-    {.bitmap_index = 9359, .adv_w = 288, .box_w = 18, .box_h = 16, .ofs_x = 0, .ofs_y = -2},
-    {.bitmap_index = 9431, .adv_w = 288, .box_w = 17, .box_h = 18, .ofs_x = 1, .ofs_y = -2},
-    {.bitmap_index = 9508, .adv_w = 288, .box_w = 17, .box_h = 17, .ofs_x = 0, .ofs_y = -1},
-    {.bitmap_index = 9581, .adv_w = 288, .box_w = 18, .box_h = 18, .ofs_x = 0, .ofs_y = -2},
-    {.bitmap_index = 9662, .adv_w = 288, .box_w = 18, .box_h = 17, .ofs_x = 0, .ofs_y = -2},
-    {.bitmap_index = 9739, .adv_w = 288, .box_w = 17, .box_h = 17, .ofs_x = 0, .ofs_y = -1},
-    {.bitmap_index = 9812, .adv_w = 288, .box_w = 17, .box_h = 18, .ofs_x = 0, .ofs_y = -2},
-    {.bitmap_index = 9889, .adv_w = 288, .box_w = 18, .box_h = 18, .ofs_x = 0, .ofs_y = -2},
-    {.bitmap_index = 9970, .adv_w = 288, .box_w = 18, .box_h = 16, .ofs_x = 0, .ofs_y = -1},
-    {.bitmap_index = 10042, .adv_w = 288, .box_w = 17, .box_h = 18, .ofs_x = 0, .ofs_y = -2},
-    {.bitmap_index = 10119, .adv_w = 288, .box_w = 17, .box_h = 18, .ofs_x = 0, .ofs_y = -2},
-    {.bitmap_index = 10196, .adv_w = 288, .box_w = 18, .box_h = 17, .ofs_x = 0, .ofs_y = -2},
-    {.bitmap_index = 10273, .adv_w = 288, .box_w = 18, .box_h = 18, .ofs_x = 0, .ofs_y = -2},
-    {.bitmap_index = 10354, .adv_w = 288, .box_w = 17, .box_h = 18, .ofs_x = 0, .ofs_y = -2},
-    {.bitmap_index = 10431, .adv_w = 288, .box_w = 18, .box_h = 17, .ofs_x = 0, .ofs_y = -1},
-    {.bitmap_index = 10508, .adv_w = 288, .box_w = 18, .box_h = 18, .ofs_x = 0, .ofs_y = -2},
-    {.bitmap_index = 10589, .adv_w = 288, .box_w = 16, .box_h = 17, .ofs_x = 1, .ofs_y = -2},
-    {.bitmap_index = 10657, .adv_w = 288, .box_w = 18, .box_h = 18, .ofs_x = 0, .ofs_y = -2},
-    {.bitmap_index = 10738, .adv_w = 288, .box_w = 17, .box_h = 18, .ofs_x = 0, .ofs_y = -2},
-    {.bitmap_index = 10815, .adv_w = 288, .box_w = 18, .box_h = 18, .ofs_x = 0, .ofs_y = -2},
-    {.bitmap_index = 10896, .adv_w = 288, .box_w = 18, .box_h = 18, .ofs_x = 0, .ofs_y = -2},
-    {.bitmap_index = 10977, .adv_w = 288, .box_w = 18, .box_h = 18, .ofs_x = 0, .ofs_y = -2},
-    {.bitmap_index = 11058, .adv_w = 288, .box_w = 17, .box_h = 17, .ofs_x = 0, .ofs_y = -1},
-    {.bitmap_index = 11131, .adv_w = 288, .box_w = 18, .box_h = 17, .ofs_x = 0, .ofs_y = -2},
-    {.bitmap_index = 11208, .adv_w = 288, .box_w = 18, .box_h = 17, .ofs_x = 0, .ofs_y = -2},
-    {.bitmap_index = 11285, .adv_w = 288, .box_w = 18, .box_h = 18, .ofs_x = 0, .ofs_y = -2},
-    {.bitmap_index = 11366, .adv_w = 288, .box_w = 18, .box_h = 17, .ofs_x = 0, .ofs_y = -2},
-    {.bitmap_index = 11443, .adv_w = 288, .box_w = 18, .box_h = 16, .ofs_x = 0, .ofs_y = -2},
-    {.bitmap_index = 11515, .adv_w = 288, .box_w = 4, .box_h = 15, .ofs_x = 3, .ofs_y = -1},
-    {.bitmap_index = 11530, .adv_w = 288, .box_w = 6, .box_h = 18, .ofs_x = 12, .ofs_y = -2},
-    {.bitmap_index = 11557, .adv_w = 288, .box_w = 6, .box_h = 18, .ofs_x = 0, .ofs_y = -2},
-    {.bitmap_index = 11584, .adv_w = 288, .box_w = 5, .box_h = 8, .ofs_x = 2, .ofs_y = -3},
-    {.bitmap_index = 11594, .adv_w = 288, .box_w = 5, .box_h = 13, .ofs_x = 2, .ofs_y = -1},
-    {.bitmap_index = 11611, .adv_w = 288, .box_w = 9, .box_h = 15, .ofs_x = 0, .ofs_y = -1},
-    {.bitmap_index = 11645, .adv_w = 288, .box_w = 13, .box_h = 13, .ofs_x = 2, .ofs_y = 0}
-};
-
-/*---------------------
- *  CHARACTER MAPPING
- *--------------------*/
-
-static const uint8_t glyph_id_ofs_list_0[] = {
-    0, 1, 0, 2, 3, 4, 5
-};
-
-static const uint16_t unicode_list_5[] = {
-    0x0, 0x12, 0xfee, 0x2d04, 0x2d05, 0x2dec, 0x2df6, 0x2df7,
-    0x2e38, 0x2e72, 0x3157, 0x318c, 0x31d0, 0x328c, 0x3363, 0x33b5,
-    0x33b9, 0x33bd, 0x33e2, 0x34d1, 0x3530, 0x3588, 0x3620, 0x3656,
-    0x3908, 0x3913, 0x3916, 0x3920, 0x3beb, 0x3bfb, 0x3c2a, 0x3c5d,
-    0x3e12, 0x4062, 0x4220, 0x42cb, 0x434f, 0x4573, 0x457d, 0x459c,
-    0x45d1, 0x465a, 0x4683, 0x4714, 0x4718, 0x4751, 0x476a, 0x4783,
-    0x4b0d, 0x4c20, 0x4c4c, 0x505c, 0x51c1, 0x52c3, 0x53cc, 0x5421,
-    0x5669, 0x5722, 0x5728, 0x5d17, 0x5e8e, 0x5ecb, 0x5ecf, 0x5eeb,
-    0x5f09, 0x5fb1, 0x5fcc, 0x5fcd, 0x601f, 0x60c8, 0x60e4, 0x6106,
-    0x6124, 0x615c, 0x6165, 0x62b3, 0x62b9, 0x62d2, 0x63a6, 0x64c9,
-    0x66b3, 0x66b7, 0x66ee, 0x68fc, 0x69ae, 0x69be, 0x6b8d, 0x7006,
-    0x71bd, 0x74e2, 0x756b, 0x761f, 0x76a8, 0x76ac, 0x76c1, 0x76d4,
-    0x7861, 0x7872, 0x7874, 0x7b28, 0x7c68, 0x7ce9, 0x7d4b, 0x7e0b,
-    0x7e0c, 0x7e0e, 0x7e12, 0x7e17, 0x7e18, 0x7e1a, 0x7e1c, 0x7e1e,
-    0x7e26, 0x7e27, 0x7e2f, 0x7e36, 0x7e3a, 0x7e46, 0x7e4a, 0x7e4c,
-    0x7e4d, 0x7e58, 0x7e59, 0x7e5c, 0x7eb0, 0x7ebd, 0xdeed, 0xdef4,
-    0xdef5, 0xdef8, 0xdf06, 0xdf0b, 0xdfd1
-};
-
-/*Collect the unicode lists and glyph_id offsets*/
-static const lv_font_fmt_txt_cmap_t cmaps[] =
-{
-    {
-        .range_start = 32, .range_length = 7, .glyph_id_start = 1,
-        .unicode_list = NULL, .glyph_id_ofs_list = glyph_id_ofs_list_0, .list_length = 7, .type = LV_FONT_FMT_TXT_CMAP_FORMAT0_FULL
-    },
-    {
-        .range_start = 40, .range_length = 19, .glyph_id_start = 7,
-        .unicode_list = NULL, .glyph_id_ofs_list = NULL, .list_length = 0, .type = LV_FONT_FMT_TXT_CMAP_FORMAT0_TINY
-    },
-    {
-        .range_start = 64, .range_length = 27, .glyph_id_start = 26,
-        .unicode_list = NULL, .glyph_id_ofs_list = NULL, .list_length = 0, .type = LV_FONT_FMT_TXT_CMAP_FORMAT0_TINY
-    },
-    {
-        .range_start = 94, .range_length = 2, .glyph_id_start = 53,
-        .unicode_list = NULL, .glyph_id_ofs_list = NULL, .list_length = 0, .type = LV_FONT_FMT_TXT_CMAP_FORMAT0_TINY
-    },
-    {
-        .range_start = 97, .range_length = 26, .glyph_id_start = 55,
-        .unicode_list = NULL, .glyph_id_ofs_list = NULL, .list_length = 0, .type = LV_FONT_FMT_TXT_CMAP_FORMAT0_TINY
-    },
-    {
-        .range_start = 8212, .range_length = 57298, .glyph_id_start = 81,
-        .unicode_list = unicode_list_5, .glyph_id_ofs_list = NULL, .list_length = 133, .type = LV_FONT_FMT_TXT_CMAP_SPARSE_TINY
-    }
-};
-
-/*-----------------
- *    KERNING
- *----------------*/
-
-
-/*Map glyph_ids to kern left classes*/
-static const uint8_t kern_left_class_mapping[] =
-{
-    0, 0, 0, 0, 0, 0, 0, 1,
-    0, 0, 0, 2, 3, 2, 4, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 5, 0, 6, 7, 8, 9, 10,
-    11, 12, 0, 0, 13, 14, 15, 0,
-    0, 9, 16, 9, 17, 18, 19, 20,
-    21, 22, 23, 24, 25, 0, 0, 26,
-    27, 28, 0, 29, 30, 31, 32, 0,
-    0, 33, 34, 32, 32, 27, 27, 35,
-    36, 37, 38, 35, 39, 40, 41, 42,
-    43, 3, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0
-};
-
-/*Map glyph_ids to kern right classes*/
-static const uint8_t kern_right_class_mapping[] =
-{
-    0, 0, 1, 0, 0, 0, 0, 0,
-    2, 3, 0, 4, 5, 6, 7, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 8, 0, 9, 0, 10, 0, 0,
-    0, 10, 0, 0, 11, 0, 0, 0,
-    0, 10, 0, 10, 0, 12, 13, 14,
-    15, 16, 17, 18, 19, 0, 0, 20,
-    0, 21, 21, 21, 22, 23, 0, 24,
-    25, 0, 0, 26, 26, 21, 26, 21,
-    26, 27, 28, 29, 30, 31, 32, 33,
-    34, 5, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0
-};
-
-/*Kern values between classes*/
-static const int8_t kern_class_values[] =
-{
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, -7, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    25, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, -48, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, -33, -8,
-    -23, -12, 0, -33, 0, 0, -5, 0,
-    0, 0, 8, 0, 0, -18, 0, -15,
-    -10, 0, -7, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, -7, -8,
-    -17, 0, -7, -4, -11, -24, -7, 0,
-    0, 0, 0, 0, 0, 0, 0, -9,
-    0, -4, 0, -6, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, -14, -4,
-    -27, 0, 0, 0, 0, 0, 0, 0,
-    0, -9, -10, 0, -4, 5, 5, 0,
-    0, 0, -7, 0, 0, 0, 0, 0,
-    0, 0, -16, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, -11, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, -31, 0, 0, 0,
-    0, 0, -3, -4, 0, 0, -20, -6,
-    -6, 0, -1, -6, -3, 5, 0, -4,
-    0, 0, 0, 0, 5, -6, -3, -4,
-    -3, -3, -4, 0, 0, 0, -11, 0,
-    0, 0, 0, 0, 0, 0, -7, -6,
-    -9, 0, -4, -3, -3, -6, -3, 0,
-    0, 0, 0, 0, 0, 0, 0, -4,
-    0, -6, -4, -4, -6, 0, 0, 0,
-    0, 0, -11, 0, 0, 0, 0, -11,
-    -4, -9, -6, -6, -3, -3, -3, -4,
-    -4, 0, 0, 0, -7, 0, 0, 0,
-    0, -11, -4, -6, -4, 0, -6, 0,
-    0, 0, -11, 0, 0, 0, -6, 0,
-    -4, 0, -16, 0, -9, 0, -4, -3,
-    -8, -7, -7, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, -6,
-    0, -4, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, -4, 0,
-    0, 0, 0, 0, 0, -9, 0, -4,
-    0, -13, -4, 0, 0, 0, 0, -26,
-    0, -26, -22, 0, -14, -4, -46, -8,
-    0, 0, -1, -1, -9, -2, -11, -12,
-    -6, 0, -9, 0, 0, -7, -8, -4,
-    -7, -9, -7, -11, -7, -13, 0, 0,
-    -10, 0, 0, 0, 0, 0, -3, 0,
-    0, 0, -7, 0, -6, -3, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, -9, 0, -9, 0, 0,
-    0, 0, -14, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, -14, 0, -13, 0,
-    0, 0, -4, -8, 0, -5, -8, -6,
-    -6, -4, 0, -7, 0, 0, -4, 0,
-    0, 0, -4, 0, 0, -14, -6, -9,
-    -7, -7, -9, -6, 0, 0, -52, 0,
-    -18, 0, 0, 0, -1, -11, 0, -9,
-    -40, -11, -26, -20, 0, -27, 0, 0,
-    -5, -6, -3, 0, 0, 0, 0, -8,
-    -4, -14, -12, 0, -14, 0, 0, 0,
-    0, -39, -11, -39, -24, 0, -17, 0,
-    -48, -4, -8, 0, 0, 0, -9, -4,
-    -25, -14, -9, 0, -10, 0, 0, 0,
-    -4, 0, 0, 0, 0, -6, 0, -7,
-    0, 0, -4, 0, -10, 0, 0, 0,
-    -3, 0, -6, -5, -6, 0, -1, 0,
-    -3, -3, -4, -3, -4, 0, -3, 0,
-    0, 0, 0, 0, 0, 0, 0, -4,
-    0, -4, 0, 0, -6, 0, 4, 0,
-    0, 0, 0, 0, -6, -6, -7, 0,
-    0, 0, 0, -6, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, -9, 0, 0,
-    0, 0, 0, -3, 0, 0, 0, -36,
-    -24, -36, -29, -7, -14, -9, -42, -13,
-    0, 0, 0, 0, -7, -6, -18, -24,
-    -24, -6, -24, 0, 0, -16, -20, -6,
-    -16, -11, -11, -13, -11, -24, 0, 0,
-    0, -7, 0, -7, -10, 0, -6, 0,
-    -17, -4, 0, 0, -3, 0, -4, -6,
-    0, -3, 0, 0, -4, 0, 0, 0,
-    -3, 0, 0, 0, 0, -4, 0, 0,
-    0, 0, 0, -23, -7, -23, -15, 0,
-    -6, -4, -24, -4, 0, -4, 2, 0,
-    0, 0, -7, -10, -6, 0, -8, 0,
-    0, -7, -6, 0, -11, -4, -4, -6,
-    -4, -9, 0, 0, 0, -12, -4, -12,
-    -9, 0, 0, -3, -21, -3, 0, 0,
-    0, 0, 0, 0, -3, -6, 0, 0,
-    -4, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, -4, 0, 0, -4, 0,
-    -11, 0, 0, 0, -1, -8, -3, -6,
-    -7, -4, 0, 0, 0, 0, 0, -4,
-    -4, -7, 0, 0, 0, 0, 0, -7,
-    -4, -7, -6, -4, -7, -6, 0, 0,
-    0, -33, -24, -33, -21, -10, -6, -6,
-    -33, -7, -6, -4, 0, 0, 0, 0,
-    -9, -24, -16, 0, -21, 0, 0, -14,
-    -16, -12, -12, -6, -9, -12, -6, -17,
-    0, 0, 0, 0, -11, 0, 0, 0,
-    -3, -7, -11, -11, 0, -4, -3, -3,
-    0, -6, -6, -6, -7, -7, -6, 0,
-    0, 0, 0, -6, -8, -6, -6, -9,
-    -6, 0, 0, 0, -18, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, -9, 0,
-    -7, -3, 0, -9, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, -6, 0, 0,
-    0, 0, 0, 0, 0, 0, -8, -4,
-    0, -4, 0, 0, 0, 0, 0, 0,
-    -20, 0, -7, 0, -3, -17, 0, -6,
-    0, -2, 0, 0, 0, 0, -2, -8,
-    0, -3, -3, -8, -3, -4, 0, 0,
-    0, 0, -9, 0, 0, 0, 0, 0,
-    0, 0, -7, 0, -6, 0, 0, -9,
-    0, -4, -9, 0, -4, 0, 0, 0,
-    0, -4, 0, 0, 0, 0, 0, 0,
-    0, 0, -11, 0, 2, 0, 0, 0,
-    0, 0, -7, -7, -9, 0, -7, -4,
-    0, -11, 0, -6, 0, -2, -4, 0,
-    0, 0, 0, -4, 0, -1, -1, -4,
-    -1, -2, 2, 14, 0, -19, -6, -19,
-    -5, 0, 0, 0, 0, 0, 14, 0,
-    20, 14, 9, 17, 0, -7, -4, 0,
-    -6, 0, -4, 0, -3, 0, 0, 2,
-    0, -3, 0, -6, 0, 2, -11, 0,
-    0, 0, 12, 0, 0, 0, 0, 0,
-    -11, 0, 0, 0, 0, -6, 0, -7,
-    -6, 0, 0, 0, 12, 0, 0, 0,
-    0, -3, -3, 0, 3, -6, 0, 0,
-    -11, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, -9, 0, -4, 0, 0, -7,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, -8, 2, -18, 2, 0, 2,
-    0, 0, 0, 0, -14, 0, 0, 0,
-    0, -5, 0, -4, -8, 0, -4, 0,
-    -4, 0, 0, -10, -6, 0, 0, -4,
-    0, -4, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 2, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, -8, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    -7, 0, -6, 0, 0, -11, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, -22, -9, -22, -11, 5, -6, 0,
-    -20, 0, 0, 0, 0, 0, 0, 0,
-    -4, -9, -4, 0, -4, 0, 0, 0,
-    -3, 0, 0, 5, 4, 0, 5, -3,
-    0, 0, -16, 0, 2, 0, 0, 0,
-    0, 0, 0, 0, -9, 0, -4, 0,
-    0, -7, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, -7, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, -1, -11, -1,
-    1, 2, 0, 0, 0, 0, -6, 0,
-    0, 0, 0, -3, 0, -8, -6, 0,
-    -4, 0, 0, 0, -4, -7, 0, 0,
-    0, -6, 0, 0, 0, 0, -5, -15,
-    -4, -15, -7, 0, -5, 0, -14, 0,
-    -7, 0, -4, 0, 0, -6, -4, -7,
-    -3, 0, 0, 0, -4, 0, 0, 0,
-    0, 0, 0, 0, 0, -9, 0, 0,
-    -5, -18, 0, -18, -3, 0, -3, 0,
-    -11, 0, -9, 0, -4, 0, -6, -9,
-    0, -4, -3, 0, 0, 0, -4, 0,
-    0, 0, 0, 0, 0, 0, 0, -8,
-    -6, 0, -8, 2, -6, -4, 0, 0,
-    0, -4, 0, -3, -11, 0, -6, 0,
-    -4, -12, 0, -4, -8, 0, 0, 0,
-    0, 0, 0, -9, 0, 0, 0, 0,
-    -3, 0, 0, 0, 0, -15, 0, -15,
-    -5, 0, 0, 0, -14, 0, -7, 0,
-    -3, 0, -3, -4, 0, -7, -3, 0,
-    0, 0, -4, 0, 0, 0, 0, 0,
-    0, -6, 0, -9, 0, 0, 0, 0,
-    -7, 0, 0, 0, 0, 0, 0, 0,
-    -9, 0, 0, 0, 0, -10, 0, -8,
-    -4, 0, -3, 0, 0, 0, 0, 0,
-    -4, -3, 0, 0, -3, 0
-};
-
-
-/*Collect the kern class' data in one place*/
-static const lv_font_fmt_txt_kern_classes_t kern_classes =
-{
-    .class_pair_values   = kern_class_values,
-    .left_class_mapping  = kern_left_class_mapping,
-    .right_class_mapping = kern_right_class_mapping,
-    .left_class_cnt      = 43,
-    .right_class_cnt     = 34,
-};
-
-/*--------------------
- *  ALL CUSTOM DATA
- *--------------------*/
-
-#if LVGL_VERSION_MAJOR == 8
-/*Store all the custom data of the font*/
-static  lv_font_fmt_txt_glyph_cache_t cache;
-#endif
-
-#if LVGL_VERSION_MAJOR >= 8
-static const lv_font_fmt_txt_dsc_t font_dsc = {
-#else
-static lv_font_fmt_txt_dsc_t font_dsc = {
-#endif
-    .glyph_bitmap = glyph_bitmap,
-    .glyph_dsc = glyph_dsc,
-    .cmaps = cmaps,
-    .kern_dsc = &kern_classes,
-    .kern_scale = 16,
-    .cmap_num = 6,
-    .bpp = 2,
-    .kern_classes = 1,
-    .bitmap_format = 0,
-#if LVGL_VERSION_MAJOR == 8
-    .cache = &cache
-#endif
-
-};
-
-
-
-/*-----------------
- *  PUBLIC FONT
- *----------------*/
-
-/*Initialize a public general font descriptor*/
-#if LVGL_VERSION_MAJOR >= 8
-const lv_font_t lv_font_notosanssc_18 = {
-#else
-lv_font_t lv_font_notosanssc_18 = {
-#endif
-    .get_glyph_dsc = lv_font_get_glyph_dsc_fmt_txt,    /*Function pointer to get glyph's data*/
-    .get_glyph_bitmap = lv_font_get_bitmap_fmt_txt,    /*Function pointer to get glyph's bitmap*/
-    .line_height = 20,          /*The maximum line height required by the font*/
-    .base_line = 4,             /*Baseline measured from the bottom of the line*/
-#if !(LVGL_VERSION_MAJOR == 6 && LVGL_VERSION_MINOR == 0)
-    .subpx = LV_FONT_SUBPX_NONE,
-#endif
-#if LV_VERSION_CHECK(7, 4, 0) || LVGL_VERSION_MAJOR >= 8
-    .underline_position = -2,
-    .underline_thickness = 1,
-#endif
-    .static_bitmap = 0,
-    .dsc = &font_dsc,          /*The custom font data. Will be accessed by `get_glyph_bitmap/dsc` */
-#if LV_VERSION_CHECK(8, 2, 0) || LVGL_VERSION_MAJOR >= 9
-    .fallback = NULL,
-#endif
-    .user_data = NULL,
-};
-
-
-
-#endif /*#if LV_FONT_NOTOSANSSC_18*/
@@ -1,1355 +0,0 @@
-#include "lvgl.h"
-
-/*******************************************************************************
- * Size: 12 px
- * Bpp: 4
- * Opts: 
- ******************************************************************************/
-
-#ifndef LV_FONT_SIMSUN_12
-#define LV_FONT_SIMSUN_12 1
-#endif
-
-#if LV_FONT_SIMSUN_12
-
-/*-----------------
- *    BITMAPS
- *----------------*/
-
-/*Store the image of the glyphs*/
-static LV_ATTRIBUTE_LARGE_CONST const uint8_t gylph_bitmap[] = {
-    /* U+21 "!" */
-    0x75, 0x86, 0x75, 0x54, 0x43, 0x32, 0x0, 0x22,
-    0x87,
-
-    /* U+22 "\"" */
-    0x0, 0xd2, 0xd0, 0x6, 0x88, 0x60, 0x7, 0x16,
-    0x0, 0x0, 0x0, 0x0,
-
-    /* U+23 "#" */
-    0x4, 0x20, 0x60, 0x5, 0x10, 0x60, 0x8f, 0xff,
-    0xf8, 0x6, 0x0, 0x60, 0x6, 0x0, 0x60, 0x6,
-    0x0, 0x60, 0x8f, 0xff, 0xf8, 0x6, 0x2, 0x40,
-    0x6, 0x3, 0x30,
-
-    /* U+24 "$" */
-    0x0, 0x11, 0x0, 0x3, 0x88, 0x50, 0xa, 0x34,
-    0xd0, 0xc, 0x34, 0x40, 0x6, 0xd4, 0x0, 0x0,
-    0x7e, 0x10, 0x0, 0x38, 0xb0, 0x7, 0x33, 0xb0,
-    0x1c, 0x33, 0x90, 0x6, 0x88, 0x30, 0x0, 0x33,
-    0x0, 0x0, 0x11, 0x0,
-
-    /* U+25 "%" */
-    0x57, 0x30, 0x50, 0x80, 0x82, 0x40, 0x90, 0x95,
-    0x0, 0x80, 0x85, 0x0, 0x25, 0x53, 0x61, 0x0,
-    0x58, 0x8, 0x0, 0x49, 0x9, 0x5, 0x8, 0x9,
-    0x5, 0x4, 0x64,
-
-    /* U+26 "&" */
-    0x5, 0x64, 0x0, 0x8, 0x9, 0x0, 0xa, 0x28,
-    0x0, 0xb, 0x62, 0x0, 0xc, 0x42, 0x81, 0x74,
-    0x80, 0x70, 0xb0, 0xa2, 0x30, 0xb0, 0x2d, 0x1,
-    0x3b, 0x76, 0xb5,
-
-    /* U+27 "'" */
-    0x1e, 0x20, 0x93, 0x8, 0x0, 0x0,
-
-    /* U+28 "(" */
-    0x0, 0x2, 0x0, 0x70, 0x4, 0x40, 0xa, 0x0,
-    0x28, 0x0, 0x55, 0x0, 0x64, 0x0, 0x46, 0x0,
-    0x19, 0x0, 0x9, 0x0, 0x2, 0x60, 0x0, 0x52,
-    0x0, 0x0,
-
-    /* U+29 ")" */
-    0x20, 0x0, 0x17, 0x0, 0x5, 0x40, 0x0, 0xa0,
-    0x0, 0x81, 0x0, 0x64, 0x0, 0x55, 0x0, 0x64,
-    0x0, 0x90, 0x0, 0x90, 0x7, 0x10, 0x34, 0x0,
-    0x0, 0x0,
-
-    /* U+2A "*" */
-    0x0, 0x22, 0x0, 0x0, 0x66, 0x0, 0x6a, 0x44,
-    0xa6, 0x3, 0x98, 0x30, 0x3b, 0x77, 0xb3, 0x32,
-    0x64, 0x33, 0x0, 0x75, 0x0,
-
-    /* U+2B "+" */
-    0x0, 0x13, 0x0, 0x0, 0x24, 0x0, 0x0, 0x24,
-    0x0, 0x37, 0x89, 0x74, 0x0, 0x24, 0x0, 0x0,
-    0x24, 0x0, 0x0, 0x13, 0x0,
-
-    /* U+2D "-" */
-    0x47, 0x77, 0x74,
-
-    /* U+2E "." */
-    0x6, 0x1, 0xe1,
-
-    /* U+2F "/" */
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x15, 0x0, 0x0,
-    0x60, 0x0, 0x0, 0x60, 0x0, 0x5, 0x10, 0x0,
-    0x6, 0x0, 0x0, 0x42, 0x0, 0x0, 0x60, 0x0,
-    0x2, 0x40, 0x0, 0x6, 0x0, 0x0, 0x15, 0x0,
-    0x0, 0x50, 0x0, 0x0,
-
-    /* U+30 "0" */
-    0x3, 0x88, 0x30, 0xc, 0x0, 0xb0, 0x3a, 0x0,
-    0xa2, 0x58, 0x0, 0x84, 0x67, 0x0, 0x85, 0x58,
-    0x0, 0x84, 0x3a, 0x0, 0xa2, 0xb, 0x0, 0xb0,
-    0x3, 0x88, 0x30,
-
-    /* U+31 "1" */
-    0x0, 0x50, 0x2a, 0x60, 0x5, 0x60, 0x5, 0x60,
-    0x5, 0x60, 0x5, 0x60, 0x5, 0x60, 0x5, 0x60,
-    0x3a, 0xc4,
-
-    /* U+32 "2" */
-    0x5, 0x57, 0x60, 0x18, 0x0, 0xb0, 0x2b, 0x0,
-    0xa1, 0x0, 0x0, 0xb0, 0x0, 0x7, 0x30, 0x0,
-    0x44, 0x0, 0x2, 0x60, 0x0, 0x7, 0x0, 0x32,
-    0x5c, 0xcc, 0xe0,
-
-    /* U+33 "3" */
-    0x5, 0x58, 0x30, 0x1a, 0x0, 0xb0, 0x6, 0x0,
-    0xc0, 0x0, 0x3, 0x80, 0x0, 0x5b, 0x10, 0x0,
-    0x0, 0xb0, 0x2, 0x0, 0xa3, 0x3b, 0x0, 0xb1,
-    0x7, 0x56, 0x50,
-
-    /* U+34 "4" */
-    0x0, 0x6, 0x50, 0x0, 0xc, 0x50, 0x0, 0x67,
-    0x50, 0x1, 0x57, 0x50, 0x6, 0x7, 0x50, 0x24,
-    0x7, 0x50, 0x55, 0x59, 0x82, 0x0, 0x7, 0x50,
-    0x0, 0x3b, 0x92,
-
-    /* U+35 "5" */
-    0xa, 0xcc, 0xb0, 0x5, 0x0, 0x0, 0x5, 0x0,
-    0x0, 0x8, 0x79, 0x60, 0x5, 0x0, 0xc0, 0x0,
-    0x0, 0x93, 0x17, 0x0, 0x92, 0x39, 0x0, 0xb0,
-    0x5, 0x57, 0x40,
-
-    /* U+36 "6" */
-    0x1, 0x76, 0x90, 0x9, 0x0, 0x70, 0x29, 0x0,
-    0x0, 0x59, 0x88, 0x70, 0x6c, 0x0, 0xa2, 0x67,
-    0x0, 0x75, 0x49, 0x0, 0x64, 0xc, 0x0, 0x81,
-    0x4, 0x85, 0x50,
-
-    /* U+37 "7" */
-    0xe, 0xcc, 0xd3, 0x24, 0x0, 0x60, 0x0, 0x3,
-    0x30, 0x0, 0x7, 0x0, 0x0, 0x18, 0x0, 0x0,
-    0x64, 0x0, 0x0, 0xa2, 0x0, 0x0, 0xd2, 0x0,
-    0x0, 0xc2, 0x0,
-
-    /* U+38 "8" */
-    0x6, 0x66, 0x50, 0x27, 0x0, 0x91, 0x38, 0x0,
-    0x82, 0xb, 0x72, 0x70, 0x5, 0x9e, 0x30, 0x27,
-    0x2, 0xd0, 0x73, 0x0, 0x74, 0x45, 0x0, 0x81,
-    0x6, 0x55, 0x50,
-
-    /* U+39 "9" */
-    0x6, 0x67, 0x30, 0x38, 0x0, 0xa0, 0x65, 0x0,
-    0x92, 0x65, 0x0, 0x94, 0x3a, 0x2, 0xc4, 0x5,
-    0x85, 0xa3, 0x0, 0x0, 0xb0, 0x7, 0x2, 0x80,
-    0xa, 0x68, 0x0,
-
-    /* U+3A ":" */
-    0x96, 0x31, 0x0, 0x0, 0x31, 0x96,
-
-    /* U+3B ";" */
-    0x97, 0x10, 0x0, 0x0, 0x10, 0x97, 0x44, 0x30,
-
-    /* U+3C "<" */
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x70, 0x0, 0x7,
-    0x10, 0x0, 0x71, 0x0, 0x6, 0x20, 0x0, 0x17,
-    0x0, 0x0, 0x3, 0x50, 0x0, 0x0, 0x44, 0x0,
-    0x0, 0x4, 0x40, 0x0, 0x0, 0x50,
-
-    /* U+3D "=" */
-    0x47, 0x77, 0x74, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x47, 0x77, 0x74,
-
-    /* U+3E ">" */
-    0x0, 0x0, 0x0, 0x7, 0x0, 0x0, 0x1, 0x70,
-    0x0, 0x0, 0x17, 0x0, 0x0, 0x2, 0x60, 0x0,
-    0x0, 0x71, 0x0, 0x5, 0x30, 0x0, 0x44, 0x0,
-    0x4, 0x40, 0x0, 0x5, 0x0, 0x0,
-
-    /* U+3F "?" */
-    0x4, 0x78, 0x70, 0x24, 0x0, 0x93, 0x59, 0x0,
-    0x85, 0x2, 0x0, 0xc1, 0x0, 0x9, 0x20, 0x0,
-    0x42, 0x0, 0x0, 0x30, 0x0, 0x0, 0x31, 0x0,
-    0x0, 0x96, 0x0,
-
-    /* U+40 "@" */
-    0x2, 0x75, 0x60, 0x8, 0x16, 0x75, 0x35, 0x71,
-    0x86, 0x63, 0x82, 0x66, 0x84, 0x74, 0x46, 0x65,
-    0x68, 0x35, 0x45, 0x74, 0x71, 0x8, 0x0, 0x24,
-    0x3, 0x86, 0x60,
-
-    /* U+41 "A" */
-    0x0, 0x66, 0x0, 0x0, 0x79, 0x0, 0x0, 0x6b,
-    0x0, 0x2, 0x3a, 0x0, 0x5, 0x7, 0x40, 0x7,
-    0x57, 0x70, 0x6, 0x0, 0xb0, 0x14, 0x0, 0xc0,
-    0x87, 0x1, 0xd6,
-
-    /* U+42 "B" */
-    0x4d, 0x46, 0x70, 0xb, 0x0, 0xb1, 0xb, 0x0,
-    0xa2, 0xb, 0x0, 0xb0, 0xc, 0x49, 0x40, 0xb,
-    0x0, 0x93, 0xb, 0x0, 0x58, 0xb, 0x0, 0x77,
-    0x4d, 0x55, 0x90,
-
-    /* U+43 "C" */
-    0x2, 0x76, 0xd3, 0xb, 0x0, 0x16, 0x48, 0x0,
-    0x1, 0x85, 0x0, 0x0, 0x94, 0x0, 0x0, 0x95,
-    0x0, 0x0, 0x67, 0x0, 0x2, 0x1c, 0x0, 0x23,
-    0x4, 0x97, 0x50,
-
-    /* U+44 "D" */
-    0x4d, 0x57, 0x30, 0xb, 0x0, 0xb0, 0xb, 0x0,
-    0x75, 0xb, 0x0, 0x58, 0xb, 0x0, 0x59, 0xb,
-    0x0, 0x58, 0xb, 0x0, 0x85, 0xb, 0x0, 0xb0,
-    0x4d, 0x58, 0x20,
-
-    /* U+45 "E" */
-    0x3e, 0x45, 0xc1, 0xc, 0x0, 0x15, 0xc, 0x0,
-    0x0, 0xc, 0x0, 0x40, 0xc, 0x48, 0x50, 0xc,
-    0x0, 0x40, 0xc, 0x0, 0x0, 0xc, 0x0, 0x5,
-    0x3d, 0x55, 0xb3,
-
-    /* U+46 "F" */
-    0x3e, 0x45, 0xa5, 0xc, 0x0, 0x6, 0xc, 0x0,
-    0x0, 0xc, 0x0, 0x50, 0xd, 0x56, 0x70, 0xc,
-    0x0, 0x50, 0xc, 0x0, 0x0, 0xc, 0x0, 0x0,
-    0x4e, 0x20, 0x0,
-
-    /* U+47 "G" */
-    0x3, 0x78, 0xb0, 0xa, 0x0, 0x80, 0x56, 0x0,
-    0x20, 0x83, 0x0, 0x0, 0xa2, 0x0, 0x0, 0x93,
-    0x2, 0x94, 0x66, 0x0, 0xb0, 0x1a, 0x0, 0xb0,
-    0x5, 0x76, 0x70,
-
-    /* U+48 "H" */
-    0x6c, 0x1, 0xc5, 0x29, 0x0, 0xa1, 0x29, 0x0,
-    0xa1, 0x29, 0x0, 0xa1, 0x2b, 0x55, 0xc1, 0x29,
-    0x0, 0xa1, 0x29, 0x0, 0xa1, 0x29, 0x0, 0xa1,
-    0x6c, 0x11, 0xc5,
-
-    /* U+49 "I" */
-    0x49, 0x94, 0x6, 0x60, 0x6, 0x60, 0x6, 0x60,
-    0x6, 0x60, 0x6, 0x60, 0x6, 0x60, 0x6, 0x60,
-    0x49, 0x94,
-
-    /* U+4A "J" */
-    0x0, 0x4b, 0x73, 0x0, 0x9, 0x20, 0x0, 0x9,
-    0x20, 0x0, 0x9, 0x20, 0x0, 0x9, 0x20, 0x0,
-    0x9, 0x20, 0x0, 0x9, 0x20, 0x0, 0x9, 0x20,
-    0x0, 0x9, 0x20, 0x53, 0xa, 0x0, 0x49, 0x54,
-    0x0,
-
-    /* U+4B "K" */
-    0x4d, 0x22, 0xc2, 0xb, 0x4, 0x20, 0xb, 0x15,
-    0x0, 0xb, 0x91, 0x0, 0xe, 0x87, 0x0, 0xc,
-    0xc, 0x0, 0xb, 0x8, 0x40, 0xb, 0x1, 0xb0,
-    0x4d, 0x21, 0xe5,
-
-    /* U+4C "L" */
-    0x2e, 0x30, 0x0, 0xc, 0x0, 0x0, 0xc, 0x0,
-    0x0, 0xc, 0x0, 0x0, 0xc, 0x0, 0x0, 0xc,
-    0x0, 0x0, 0xc, 0x0, 0x0, 0xc, 0x0, 0x5,
-    0x3e, 0x55, 0xa4,
-
-    /* U+4D "M" */
-    0x88, 0x0, 0xb7, 0x4a, 0x0, 0xd4, 0x4a, 0x2,
-    0xa4, 0x48, 0x24, 0x84, 0x45, 0x55, 0x84, 0x42,
-    0x85, 0x84, 0x40, 0xa4, 0x84, 0x40, 0xc1, 0x84,
-    0x83, 0x70, 0xb7,
-
-    /* U+4E "N" */
-    0x5c, 0x0, 0x76, 0x1b, 0x30, 0x21, 0x14, 0xa0,
-    0x21, 0x12, 0xa2, 0x21, 0x12, 0x39, 0x21, 0x12,
-    0xb, 0x41, 0x12, 0x4, 0xb1, 0x12, 0x0, 0xd1,
-    0x67, 0x0, 0x61,
-
-    /* U+4F "O" */
-    0x4, 0x76, 0x50, 0xa, 0x0, 0x91, 0x57, 0x0,
-    0x66, 0x75, 0x0, 0x49, 0x85, 0x0, 0x3a, 0x75,
-    0x0, 0x49, 0x47, 0x0, 0x56, 0xa, 0x0, 0x91,
-    0x3, 0x66, 0x50,
-
-    /* U+50 "P" */
-    0x3d, 0x45, 0x70, 0xc, 0x0, 0x65, 0xc, 0x0,
-    0x47, 0xc, 0x0, 0x93, 0xd, 0x56, 0x40, 0xc,
-    0x0, 0x0, 0xc, 0x0, 0x0, 0xc, 0x0, 0x0,
-    0x4e, 0x20, 0x0,
-
-    /* U+51 "Q" */
-    0x5, 0x76, 0x40, 0xa, 0x0, 0xa1, 0x66, 0x0,
-    0x66, 0x84, 0x0, 0x59, 0x94, 0x0, 0x49, 0x94,
-    0x0, 0x48, 0x67, 0x84, 0x66, 0x1e, 0xb, 0x91,
-    0x5, 0x6b, 0x70, 0x0, 0x2, 0xc3,
-
-    /* U+52 "R" */
-    0x3e, 0x56, 0x80, 0xc, 0x0, 0xa2, 0xc, 0x0,
-    0x83, 0xc, 0x0, 0xb0, 0xc, 0x4a, 0x20, 0xc,
-    0xb, 0x0, 0xc, 0x6, 0x50, 0xc, 0x1, 0xa0,
-    0x3e, 0x20, 0xb4,
-
-    /* U+53 "S" */
-    0x6, 0x58, 0xd0, 0x35, 0x0, 0x70, 0x55, 0x0,
-    0x0, 0x1c, 0x60, 0x0, 0x0, 0x8c, 0x30, 0x0,
-    0x2, 0xc0, 0x20, 0x0, 0x64, 0x53, 0x0, 0x71,
-    0x3e, 0x75, 0x50,
-
-    /* U+54 "T" */
-    0x58, 0xa9, 0x84, 0x50, 0x65, 0x5, 0x0, 0x65,
-    0x0, 0x0, 0x65, 0x0, 0x0, 0x65, 0x0, 0x0,
-    0x65, 0x0, 0x0, 0x65, 0x0, 0x0, 0x65, 0x0,
-    0x1, 0xa9, 0x0,
-
-    /* U+55 "U" */
-    0x6c, 0x10, 0x84, 0x29, 0x0, 0x40, 0x29, 0x0,
-    0x40, 0x29, 0x0, 0x40, 0x29, 0x0, 0x40, 0x29,
-    0x0, 0x40, 0x29, 0x0, 0x40, 0xa, 0x0, 0x50,
-    0x6, 0x76, 0x30,
-
-    /* U+56 "V" */
-    0x6d, 0x0, 0xa4, 0xc, 0x0, 0x50, 0xb, 0x0,
-    0x50, 0x8, 0x31, 0x40, 0x5, 0x74, 0x0, 0x1,
-    0xa5, 0x0, 0x0, 0xc5, 0x0, 0x0, 0xa4, 0x0,
-    0x0, 0x61, 0x0,
-
-    /* U+57 "W" */
-    0x96, 0x78, 0x38, 0x55, 0x37, 0x13, 0x37, 0x39,
-    0x31, 0x9, 0x5a, 0x50, 0xa, 0x5a, 0x50, 0xa,
-    0x5a, 0x50, 0x9, 0x58, 0x60, 0x8, 0x36, 0x40,
-    0x6, 0x4, 0x20,
-
-    /* U+58 "X" */
-    0x2e, 0x21, 0xb2, 0x8, 0x30, 0x50, 0x2, 0x95,
-    0x0, 0x0, 0xa6, 0x0, 0x0, 0x66, 0x0, 0x0,
-    0x6b, 0x0, 0x1, 0x48, 0x30, 0x6, 0x2, 0xa0,
-    0x4b, 0x1, 0xe4,
-
-    /* U+59 "Y" */
-    0x5d, 0x10, 0xb4, 0xb, 0x0, 0x50, 0x7, 0x41,
-    0x40, 0x1, 0x95, 0x0, 0x0, 0xb5, 0x0, 0x0,
-    0x75, 0x0, 0x0, 0x65, 0x0, 0x0, 0x65, 0x0,
-    0x1, 0xa9, 0x0,
-
-    /* U+5A "Z" */
-    0xc, 0x64, 0xb3, 0x32, 0x1, 0xb0, 0x0, 0x7,
-    0x40, 0x0, 0xb, 0x0, 0x0, 0x75, 0x0, 0x0,
-    0xc0, 0x0, 0x6, 0x60, 0x0, 0xc, 0x0, 0x24,
-    0x5a, 0x55, 0xc0,
-
-    /* U+5B "[" */
-    0x67, 0x71, 0x70, 0x0, 0x70, 0x0, 0x70, 0x0,
-    0x70, 0x0, 0x70, 0x0, 0x70, 0x0, 0x70, 0x0,
-    0x70, 0x0, 0x70, 0x0, 0x70, 0x0, 0x67, 0x71,
-
-    /* U+5C "\\" */
-    0x8, 0x0, 0x0, 0x8, 0x0, 0x0, 0x3, 0x50,
-    0x0, 0x0, 0x80, 0x0, 0x0, 0x71, 0x0, 0x0,
-    0x17, 0x0, 0x0, 0x9, 0x0, 0x0, 0x6, 0x20,
-    0x0, 0x1, 0x70, 0x0, 0x0, 0x80, 0x0, 0x0,
-    0x44,
-
-    /* U+5D "]" */
-    0x17, 0x76, 0x0, 0x7, 0x0, 0x7, 0x0, 0x7,
-    0x0, 0x7, 0x0, 0x7, 0x0, 0x7, 0x0, 0x7,
-    0x0, 0x7, 0x0, 0x7, 0x0, 0x7, 0x17, 0x76,
-
-    /* U+5E "^" */
-    0x1a, 0xa0, 0x20, 0x2,
-
-    /* U+5F "_" */
-    0x55, 0x55, 0x54,
-
-    /* U+60 "`" */
-    0x6, 0xa0, 0x0, 0x1,
-
-    /* U+61 "a" */
-    0x7, 0x55, 0x50, 0x17, 0x0, 0xa0, 0x2, 0x65,
-    0xb0, 0x2a, 0x0, 0xa0, 0x66, 0x0, 0xa1, 0x19,
-    0x55, 0xa5,
-
-    /* U+62 "b" */
-    0x2, 0x0, 0x0, 0x4a, 0x0, 0x0, 0xa, 0x0,
-    0x0, 0xa, 0x0, 0x0, 0xa, 0x66, 0x70, 0xd,
-    0x0, 0x92, 0xa, 0x0, 0x74, 0xa, 0x0, 0x74,
-    0xb, 0x0, 0x91, 0xa, 0x56, 0x50,
-
-    /* U+63 "c" */
-    0x3, 0x65, 0x60, 0xa, 0x0, 0xb0, 0x38, 0x0,
-    0x0, 0x37, 0x0, 0x0, 0xa, 0x0, 0x31, 0x5,
-    0x86, 0x50,
-
-    /* U+64 "d" */
-    0x0, 0x0, 0x20, 0x0, 0x2, 0xc0, 0x0, 0x0,
-    0xa0, 0x0, 0x0, 0xa0, 0x4, 0x76, 0xc0, 0xa,
-    0x0, 0xa0, 0x38, 0x0, 0xa0, 0x37, 0x0, 0xa0,
-    0x19, 0x0, 0xc0, 0x5, 0x76, 0xa3,
-
-    /* U+65 "e" */
-    0x3, 0x66, 0x60, 0x8, 0x0, 0x91, 0x2a, 0x55,
-    0x72, 0x29, 0x0, 0x0, 0xb, 0x0, 0x40, 0x4,
-    0x86, 0x40,
-
-    /* U+66 "f" */
-    0x0, 0x35, 0x66, 0x0, 0x90, 0x14, 0x0, 0xa0,
-    0x0, 0x14, 0xc4, 0x30, 0x0, 0xa0, 0x0, 0x0,
-    0xa0, 0x0, 0x0, 0xa0, 0x0, 0x0, 0xa0, 0x0,
-    0x5, 0xd5, 0x10,
-
-    /* U+67 "g" */
-    0x5, 0x57, 0x87, 0xa, 0x0, 0xa0, 0x9, 0x0,
-    0x80, 0x7, 0x55, 0x0, 0xb, 0x85, 0x10, 0xa,
-    0x7a, 0xd2, 0x45, 0x0, 0x53, 0x7, 0x54, 0x60,
-
-    /* U+68 "h" */
-    0x3a, 0x0, 0x0, 0xa, 0x0, 0x0, 0xa, 0x0,
-    0x0, 0xb, 0x77, 0x70, 0xc, 0x0, 0xa0, 0xa,
-    0x0, 0xa0, 0xa, 0x0, 0xa0, 0xa, 0x0, 0xa0,
-    0x3d, 0x11, 0xd3,
-
-    /* U+69 "i" */
-    0x6, 0x80, 0x0, 0x10, 0x1, 0x10, 0x39, 0x50,
-    0x5, 0x50, 0x5, 0x50, 0x5, 0x50, 0x5, 0x50,
-    0x39, 0x93,
-
-    /* U+6A "j" */
-    0x0, 0x3, 0xb0, 0x0, 0x2, 0x0, 0x0, 0x20,
-    0x1, 0x5a, 0x0, 0x0, 0xa0, 0x0, 0xa, 0x0,
-    0x0, 0xa0, 0x0, 0xa, 0x0, 0x0, 0x90, 0x30,
-    0x27, 0xb, 0x66, 0x0,
-
-    /* U+6B "k" */
-    0x3b, 0x0, 0x0, 0xa, 0x0, 0x0, 0xa, 0x0,
-    0x0, 0xa, 0x6, 0x81, 0xa, 0x7, 0x0, 0xa,
-    0x95, 0x0, 0xc, 0x1b, 0x0, 0xa, 0x5, 0x70,
-    0x3d, 0x21, 0xe3,
-
-    /* U+6C "l" */
-    0x39, 0x50, 0x5, 0x50, 0x5, 0x50, 0x5, 0x50,
-    0x5, 0x50, 0x5, 0x50, 0x5, 0x50, 0x5, 0x50,
-    0x49, 0x94,
-
-    /* U+6D "m" */
-    0x98, 0x97, 0x83, 0x65, 0x46, 0x27, 0x64, 0x46,
-    0x27, 0x64, 0x46, 0x27, 0x64, 0x46, 0x27, 0x97,
-    0x78, 0x5a,
-
-    /* U+6E "n" */
-    0x3b, 0x66, 0x70, 0xc, 0x0, 0xa0, 0xa, 0x0,
-    0xa0, 0xa, 0x0, 0xa0, 0xa, 0x0, 0xa0, 0x3d,
-    0x11, 0xd3,
-
-    /* U+6F "o" */
-    0x4, 0x66, 0x50, 0x19, 0x0, 0x91, 0x55, 0x0,
-    0x55, 0x55, 0x0, 0x55, 0x18, 0x0, 0x81, 0x5,
-    0x55, 0x40,
-
-    /* U+70 "p" */
-    0x4b, 0x66, 0x70, 0xc, 0x0, 0x83, 0xa, 0x0,
-    0x56, 0xa, 0x0, 0x55, 0xb, 0x0, 0x92, 0xc,
-    0x56, 0x60, 0xa, 0x0, 0x0, 0x3d, 0x20, 0x0,
-
-    /* U+71 "q" */
-    0x5, 0x65, 0x90, 0x19, 0x0, 0xb0, 0x56, 0x0,
-    0xa0, 0x56, 0x0, 0xa0, 0x28, 0x0, 0xb0, 0x6,
-    0x66, 0xb0, 0x0, 0x0, 0xa0, 0x0, 0x2, 0xd3,
-
-    /* U+72 "r" */
-    0x39, 0x66, 0x95, 0x4, 0xb0, 0x11, 0x4, 0x60,
-    0x0, 0x4, 0x60, 0x0, 0x4, 0x60, 0x0, 0x38,
-    0xa4, 0x0,
-
-    /* U+73 "s" */
-    0x4, 0x56, 0xc0, 0x9, 0x0, 0x50, 0x6, 0xb4,
-    0x0, 0x0, 0x18, 0xa0, 0x6, 0x0, 0x80, 0xd,
-    0x64, 0x60,
-
-    /* U+74 "t" */
-    0x0, 0x20, 0x0, 0x1, 0x90, 0x0, 0x14, 0xc4,
-    0x30, 0x0, 0xa0, 0x0, 0x0, 0xa0, 0x0, 0x0,
-    0xa0, 0x0, 0x0, 0xa0, 0x20, 0x0, 0x67, 0x50,
-
-    /* U+75 "u" */
-    0x4a, 0x2, 0xc0, 0xa, 0x0, 0xa0, 0xa, 0x0,
-    0xa0, 0xa, 0x0, 0xa0, 0xa, 0x0, 0xc0, 0x8,
-    0x86, 0xa3,
-
-    /* U+76 "v" */
-    0x3d, 0x21, 0xb2, 0x9, 0x10, 0x50, 0x4, 0x62,
-    0x20, 0x0, 0xa5, 0x0, 0x0, 0xa5, 0x0, 0x0,
-    0x63, 0x0,
-
-    /* U+77 "w" */
-    0x97, 0x88, 0x48, 0x36, 0x47, 0x31, 0x9, 0x49,
-    0x40, 0x9, 0x49, 0x40, 0x8, 0x48, 0x50, 0x5,
-    0x24, 0x30,
-
-    /* U+78 "x" */
-    0x1b, 0x72, 0xa1, 0x1, 0xb6, 0x10, 0x0, 0x87,
-    0x0, 0x0, 0x7a, 0x0, 0x3, 0x36, 0x40, 0x3b,
-    0x13, 0xd2,
-
-    /* U+79 "y" */
-    0x2d, 0x21, 0xb3, 0x8, 0x20, 0x60, 0x2, 0x73,
-    0x20, 0x0, 0x96, 0x0, 0x0, 0x76, 0x0, 0x0,
-    0x34, 0x0, 0x0, 0x50, 0x0, 0xc, 0x40, 0x0,
-
-    /* U+7A "z" */
-    0xc, 0x46, 0xa0, 0x13, 0xa, 0x10, 0x0, 0x47,
-    0x0, 0x0, 0xb0, 0x0, 0x7, 0x40, 0x51, 0x1d,
-    0x55, 0xc0,
-
-    /* U+7B "{" */
-    0x0, 0x60, 0x5, 0x10, 0x6, 0x0, 0x6, 0x0,
-    0x6, 0x0, 0x16, 0x0, 0x16, 0x0, 0x7, 0x0,
-    0x6, 0x0, 0x6, 0x0, 0x5, 0x10, 0x0, 0x60,
-
-    /* U+7C "|" */
-    0x31, 0x31, 0x31, 0x31, 0x31, 0x31, 0x31, 0x31,
-    0x31, 0x31, 0x31, 0x31, 0x31,
-
-    /* U+7D "}" */
-    0x5, 0x0, 0x1, 0x50, 0x0, 0x60, 0x0, 0x60,
-    0x0, 0x60, 0x0, 0x61, 0x0, 0x61, 0x0, 0x70,
-    0x0, 0x60, 0x0, 0x60, 0x1, 0x50, 0x6, 0x0,
-
-    /* U+7E "~" */
-    0x6, 0x60, 0x0, 0x40, 0x57, 0x4, 0x0, 0x5,
-    0x70,
-
-    /* U+F001 "" */
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x12, 0x0, 0x0,
-    0x0, 0x3, 0x7c, 0xff, 0x0, 0x0, 0x59, 0xef,
-    0xff, 0xff, 0x0, 0xe, 0xff, 0xff, 0xff, 0xff,
-    0x0, 0xf, 0xff, 0xfd, 0x84, 0x8f, 0x0, 0xf,
-    0xd7, 0x20, 0x0, 0x8f, 0x0, 0xf, 0x80, 0x0,
-    0x0, 0x8f, 0x0, 0xf, 0x80, 0x0, 0x0, 0x8f,
-    0x0, 0xf, 0x80, 0x0, 0x7b, 0xdf, 0x2, 0x3f,
-    0x80, 0x6, 0xff, 0xff, 0xaf, 0xff, 0x80, 0x2,
-    0xef, 0xf9, 0xef, 0xff, 0x60, 0x0, 0x2, 0x10,
-    0x29, 0xa7, 0x0, 0x0, 0x0, 0x0,
-
-    /* U+F008 "" */
-    0xb4, 0xdf, 0xff, 0xff, 0xfd, 0x4b, 0xe8, 0xe7,
-    0x22, 0x22, 0x7e, 0x8e, 0xc0, 0xc5, 0x0, 0x0,
-    0x6c, 0xc, 0xfc, 0xf6, 0x11, 0x11, 0x7f, 0xcf,
-    0xc0, 0xcf, 0xff, 0xff, 0xfb, 0xc, 0xfc, 0xf6,
-    0x11, 0x11, 0x7f, 0xcf, 0xc0, 0xc5, 0x0, 0x0,
-    0x6c, 0xc, 0xe8, 0xe7, 0x22, 0x22, 0x7e, 0x8e,
-    0xb4, 0xdf, 0xff, 0xff, 0xfd, 0x4b,
-
-    /* U+F00B "" */
-    0xdf, 0xf6, 0x9f, 0xff, 0xff, 0xfd, 0xff, 0xf8,
-    0xcf, 0xff, 0xff, 0xff, 0xef, 0xf6, 0xaf, 0xff,
-    0xff, 0xfe, 0x13, 0x20, 0x3, 0x33, 0x33, 0x31,
-    0xff, 0xf7, 0xbf, 0xff, 0xff, 0xff, 0xff, 0xf8,
-    0xcf, 0xff, 0xff, 0xff, 0xff, 0xf7, 0xbf, 0xff,
-    0xff, 0xff, 0x13, 0x20, 0x3, 0x33, 0x33, 0x31,
-    0xef, 0xf6, 0xaf, 0xff, 0xff, 0xfe, 0xff, 0xf8,
-    0xcf, 0xff, 0xff, 0xff, 0xdf, 0xf6, 0xaf, 0xff,
-    0xff, 0xfd,
-
-    /* U+F00C "" */
-    0x0, 0x0, 0x0, 0x0, 0x3, 0xd4, 0x0, 0x0,
-    0x0, 0x0, 0x3f, 0xfe, 0x0, 0x0, 0x0, 0x3,
-    0xff, 0xf4, 0x4d, 0x30, 0x0, 0x3f, 0xff, 0x40,
-    0xef, 0xf3, 0x3, 0xff, 0xf4, 0x0, 0x4f, 0xff,
-    0x6f, 0xff, 0x40, 0x0, 0x4, 0xff, 0xff, 0xf4,
-    0x0, 0x0, 0x0, 0x4f, 0xff, 0x40, 0x0, 0x0,
-    0x0, 0x3, 0xd3, 0x0, 0x0, 0x0,
-
-    /* U+F00D "" */
-    0x14, 0x0, 0x0, 0x22, 0xd, 0xf7, 0x0, 0x4f,
-    0xf1, 0x9f, 0xf7, 0x4f, 0xfd, 0x0, 0xaf, 0xff,
-    0xfd, 0x10, 0x0, 0xbf, 0xfe, 0x10, 0x0, 0x4f,
-    0xff, 0xf7, 0x0, 0x4f, 0xfd, 0xaf, 0xf7, 0xe,
-    0xfd, 0x10, 0xaf, 0xf2, 0x5b, 0x10, 0x0, 0x99,
-    0x0,
-
-    /* U+F011 "" */
-    0x0, 0x0, 0x7, 0x70, 0x0, 0x0, 0x0, 0x32,
-    0xf, 0xf0, 0x24, 0x0, 0x5, 0xfc, 0xf, 0xf0,
-    0xcf, 0x50, 0x1f, 0xf4, 0xf, 0xf0, 0x5f, 0xf1,
-    0x7f, 0x80, 0xf, 0xf0, 0x8, 0xf7, 0xbf, 0x20,
-    0xf, 0xf0, 0x2, 0xfb, 0xcf, 0x10, 0xe, 0xe0,
-    0x1, 0xfc, 0xaf, 0x40, 0x1, 0x10, 0x4, 0xfa,
-    0x5f, 0xb0, 0x0, 0x0, 0xb, 0xf6, 0xd, 0xfa,
-    0x10, 0x1, 0xaf, 0xd0, 0x2, 0xdf, 0xfc, 0xcf,
-    0xfd, 0x20, 0x0, 0x8, 0xef, 0xfe, 0x91, 0x0,
-    0x0, 0x0, 0x1, 0x10, 0x0, 0x0,
-
-    /* U+F013 "" */
-    0x0, 0x0, 0x14, 0x41, 0x0, 0x0, 0x0, 0x0,
-    0x7f, 0xf7, 0x0, 0x0, 0x3, 0x43, 0xdf, 0xfd,
-    0x34, 0x30, 0xe, 0xff, 0xff, 0xff, 0xff, 0xe0,
-    0x6f, 0xff, 0xfb, 0xbf, 0xff, 0xf6, 0x1b, 0xff,
-    0x70, 0x7, 0xff, 0xb1, 0x7, 0xff, 0x20, 0x2,
-    0xff, 0x70, 0x1b, 0xff, 0x70, 0x7, 0xff, 0xb1,
-    0x6f, 0xff, 0xfb, 0xbf, 0xff, 0xf6, 0xe, 0xff,
-    0xff, 0xff, 0xff, 0xe0, 0x3, 0x42, 0xcf, 0xfc,
-    0x23, 0x30, 0x0, 0x0, 0x7f, 0xf7, 0x0, 0x0,
-    0x0, 0x0, 0x4, 0x41, 0x0, 0x0,
-
-    /* U+F015 "" */
-    0x0, 0x0, 0x0, 0x73, 0x3, 0x83, 0x0, 0x0,
-    0x0, 0x1d, 0xff, 0x67, 0xf7, 0x0, 0x0, 0x3,
-    0xee, 0x5a, 0xfe, 0xf7, 0x0, 0x0, 0x6f, 0xd3,
-    0xb5, 0x7f, 0xf7, 0x0, 0x9, 0xfb, 0x3d, 0xff,
-    0x85, 0xfe, 0x30, 0xbf, 0x95, 0xff, 0xff, 0xfb,
-    0x3e, 0xf4, 0x76, 0x6f, 0xff, 0xff, 0xff, 0xd2,
-    0xa1, 0x0, 0xcf, 0xff, 0xff, 0xff, 0xf4, 0x0,
-    0x0, 0xcf, 0xfa, 0x2, 0xff, 0xf4, 0x0, 0x0,
-    0xcf, 0xfa, 0x2, 0xff, 0xf4, 0x0, 0x0, 0xaf,
-    0xf8, 0x1, 0xff, 0xf3, 0x0,
-
-    /* U+F019 "" */
-    0x0, 0x0, 0x27, 0x72, 0x0, 0x0, 0x0, 0x0,
-    0x7f, 0xf7, 0x0, 0x0, 0x0, 0x0, 0x8f, 0xf8,
-    0x0, 0x0, 0x0, 0x0, 0x8f, 0xf8, 0x0, 0x0,
-    0x0, 0x0, 0x8f, 0xf8, 0x0, 0x0, 0x0, 0xdf,
-    0xff, 0xff, 0xfd, 0x0, 0x0, 0x4f, 0xff, 0xff,
-    0xf4, 0x0, 0x0, 0x4, 0xff, 0xff, 0x40, 0x0,
-    0x23, 0x33, 0x5f, 0xf5, 0x33, 0x32, 0xff, 0xff,
-    0xa4, 0x4a, 0xff, 0xff, 0xff, 0xff, 0xfc, 0xcf,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x5c, 0x8f,
-    0x9a, 0xaa, 0xaa, 0xaa, 0xaa, 0xa8,
-
-    /* U+F01C "" */
-    0x0, 0x4f, 0xff, 0xff, 0xff, 0xb0, 0x0, 0x1,
-    0xed, 0x88, 0x88, 0x89, 0xf8, 0x0, 0xa, 0xf2,
-    0x0, 0x0, 0x0, 0xaf, 0x30, 0x5f, 0x70, 0x0,
-    0x0, 0x0, 0x1e, 0xc0, 0xef, 0x88, 0x60, 0x0,
-    0x28, 0x8b, 0xf6, 0xff, 0xff, 0xf3, 0x0, 0xbf,
-    0xff, 0xf8, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xf8, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf7,
-    0xbf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf4,
-
-    /* U+F021 "" */
-    0x0, 0x0, 0x1, 0x10, 0x0, 0x59, 0x0, 0x19,
-    0xef, 0xfd, 0x70, 0x9f, 0x3, 0xef, 0xda, 0x9d,
-    0xfe, 0xbf, 0xe, 0xf6, 0x0, 0x0, 0x5f, 0xff,
-    0x7f, 0x70, 0x0, 0x3f, 0xff, 0xff, 0x69, 0x0,
-    0x0, 0x2a, 0xaa, 0xa9, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xaa, 0xaa, 0xa2, 0x0, 0x0, 0xa6,
-    0xff, 0xfe, 0xf3, 0x0, 0x7, 0xf7, 0xff, 0xf5,
-    0x0, 0x0, 0x7f, 0xe0, 0xfb, 0xef, 0xd9, 0xad,
-    0xfe, 0x30, 0xfa, 0x8, 0xef, 0xfe, 0x91, 0x0,
-    0x95, 0x0, 0x1, 0x10, 0x0, 0x0,
-
-    /* U+F026 "" */
-    0x0, 0x0, 0x2a, 0x0, 0x2, 0xef, 0x78, 0x8e,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xdf, 0xff, 0xff, 0x0, 0x7, 0xff,
-    0x0, 0x0, 0x7f, 0x0, 0x0, 0x1,
-
-    /* U+F027 "" */
-    0x0, 0x0, 0x2a, 0x0, 0x0, 0x0, 0x2e, 0xf0,
-    0x0, 0x78, 0x8e, 0xff, 0x3, 0xf, 0xff, 0xff,
-    0xf0, 0xba, 0xff, 0xff, 0xff, 0x3, 0xff, 0xff,
-    0xff, 0xf0, 0xaa, 0xdf, 0xff, 0xff, 0x4, 0x0,
-    0x0, 0x8f, 0xf0, 0x0, 0x0, 0x0, 0x8f, 0x0,
-    0x0, 0x0, 0x0, 0x10, 0x0,
-
-    /* U+F028 "" */
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x6, 0xd2, 0x0, 0x0, 0x0,
-    0x2a, 0x0, 0x11, 0x8e, 0x10, 0x0, 0x2, 0xef,
-    0x0, 0x7d, 0x2b, 0x90, 0x78, 0x8e, 0xff, 0x3,
-    0xa, 0xb3, 0xf0, 0xff, 0xff, 0xff, 0xb, 0xa1,
-    0xf1, 0xe3, 0xff, 0xff, 0xff, 0x3, 0xf0, 0xe3,
-    0xc5, 0xff, 0xff, 0xff, 0xb, 0xa1, 0xf1, 0xe3,
-    0xdf, 0xff, 0xff, 0x3, 0xa, 0xb3, 0xf0, 0x0,
-    0x7, 0xff, 0x0, 0x7d, 0x2b, 0x90, 0x0, 0x0,
-    0x7f, 0x0, 0x11, 0x9e, 0x10, 0x0, 0x0, 0x1,
-    0x0, 0x6, 0xd2, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0,
-
-    /* U+F03E "" */
-    0xbf, 0xff, 0xff, 0xff, 0xff, 0xfb, 0xfd, 0x5b,
-    0xff, 0xff, 0xff, 0xff, 0xf5, 0x1, 0xff, 0xff,
-    0xef, 0xff, 0xfb, 0x18, 0xff, 0xf6, 0x1c, 0xff,
-    0xff, 0xfc, 0xff, 0x60, 0x1, 0xdf, 0xff, 0x60,
-    0x96, 0x0, 0x0, 0x8f, 0xf9, 0x0, 0x0, 0x0,
-    0x0, 0x8f, 0xfc, 0x88, 0x88, 0x88, 0x88, 0xcf,
-    0xbf, 0xff, 0xff, 0xff, 0xff, 0xfb,
-
-    /* U+F048 "" */
-    0x58, 0x0, 0x0, 0x35, 0x9f, 0x10, 0x5, 0xfe,
-    0x9f, 0x10, 0x6f, 0xfe, 0x9f, 0x17, 0xff, 0xfe,
-    0x9f, 0x9f, 0xff, 0xfe, 0x9f, 0xff, 0xff, 0xfe,
-    0x9f, 0xef, 0xff, 0xfe, 0x9f, 0x2d, 0xff, 0xfe,
-    0x9f, 0x10, 0xcf, 0xfe, 0x9f, 0x10, 0xb, 0xfe,
-    0x8f, 0x0, 0x0, 0x9b, 0x0, 0x0, 0x0, 0x0,
-
-    /* U+F04B "" */
-    0x46, 0x0, 0x0, 0x0, 0x0, 0xf, 0xfd, 0x40,
-    0x0, 0x0, 0x0, 0xff, 0xff, 0xa1, 0x0, 0x0,
-    0xf, 0xff, 0xff, 0xf7, 0x0, 0x0, 0xff, 0xff,
-    0xff, 0xfd, 0x50, 0xf, 0xff, 0xff, 0xff, 0xff,
-    0xb1, 0xff, 0xff, 0xff, 0xff, 0xff, 0x6f, 0xff,
-    0xff, 0xff, 0xff, 0xb1, 0xff, 0xff, 0xff, 0xfd,
-    0x40, 0xf, 0xff, 0xff, 0xf7, 0x0, 0x0, 0xff,
-    0xff, 0xa1, 0x0, 0x0, 0xf, 0xfd, 0x40, 0x0,
-    0x0, 0x0, 0x36, 0x0, 0x0, 0x0, 0x0, 0x0,
-
-    /* U+F04C "" */
-    0xaf, 0xfe, 0x30, 0xaf, 0xfe, 0x3f, 0xff, 0xf7,
-    0xf, 0xff, 0xf7, 0xff, 0xff, 0x80, 0xff, 0xff,
-    0x8f, 0xff, 0xf8, 0xf, 0xff, 0xf8, 0xff, 0xff,
-    0x80, 0xff, 0xff, 0x8f, 0xff, 0xf8, 0xf, 0xff,
-    0xf8, 0xff, 0xff, 0x80, 0xff, 0xff, 0x8f, 0xff,
-    0xf8, 0xf, 0xff, 0xf8, 0xff, 0xff, 0x80, 0xff,
-    0xff, 0x8f, 0xff, 0xf7, 0xf, 0xff, 0xf7, 0x48,
-    0x98, 0x10, 0x48, 0x98, 0x10,
-
-    /* U+F04D "" */
-    0x48, 0x88, 0x88, 0x88, 0x88, 0x1f, 0xff, 0xff,
-    0xff, 0xff, 0xf7, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0x8f, 0xff, 0xff, 0xff, 0xff, 0xf8, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0x8f, 0xff, 0xff, 0xff, 0xff,
-    0xf8, 0xff, 0xff, 0xff, 0xff, 0xff, 0x8f, 0xff,
-    0xff, 0xff, 0xff, 0xf8, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0x8f, 0xff, 0xff, 0xff, 0xff, 0xf7, 0xaf,
-    0xff, 0xff, 0xff, 0xfe, 0x30,
-
-    /* U+F051 "" */
-    0x26, 0x0, 0x0, 0x58, 0x7f, 0xa0, 0x0, 0xbf,
-    0x8f, 0xfb, 0x0, 0xbf, 0x8f, 0xff, 0xc1, 0xbf,
-    0x8f, 0xff, 0xfd, 0xcf, 0x8f, 0xff, 0xff, 0xff,
-    0x8f, 0xff, 0xff, 0xef, 0x8f, 0xff, 0xf4, 0xbf,
-    0x8f, 0xff, 0x40, 0xbf, 0x8f, 0xe3, 0x0, 0xbf,
-    0x5d, 0x20, 0x0, 0xae, 0x0, 0x0, 0x0, 0x0,
-
-    /* U+F052 "" */
-    0x0, 0x0, 0x3, 0x70, 0x0, 0x0, 0x0, 0x0,
-    0x3f, 0xfa, 0x0, 0x0, 0x0, 0x2, 0xef, 0xff,
-    0x90, 0x0, 0x0, 0x1e, 0xff, 0xff, 0xf8, 0x0,
-    0x1, 0xdf, 0xff, 0xff, 0xff, 0x70, 0xc, 0xff,
-    0xff, 0xff, 0xff, 0xf4, 0xd, 0xff, 0xff, 0xff,
-    0xff, 0xf5, 0x1, 0x34, 0x44, 0x44, 0x44, 0x30,
-    0xd, 0xff, 0xff, 0xff, 0xff, 0xf5, 0xf, 0xff,
-    0xff, 0xff, 0xff, 0xf8, 0xc, 0xff, 0xff, 0xff,
-    0xff, 0xf5,
-
-    /* U+F053 "" */
-    0x0, 0x0, 0x3, 0x10, 0x0, 0x5, 0xfb, 0x0,
-    0x5, 0xff, 0x40, 0x5, 0xff, 0x40, 0x5, 0xff,
-    0x50, 0x3, 0xff, 0x50, 0x0, 0xb, 0xfc, 0x10,
-    0x0, 0xb, 0xfc, 0x10, 0x0, 0xc, 0xfc, 0x10,
-    0x0, 0xc, 0xfb, 0x0, 0x0, 0xa, 0x50,
-
-    /* U+F054 "" */
-    0x3, 0x10, 0x0, 0x3, 0xfc, 0x10, 0x0, 0xb,
-    0xfc, 0x10, 0x0, 0xb, 0xfc, 0x10, 0x0, 0xb,
-    0xfc, 0x10, 0x0, 0xd, 0xfb, 0x0, 0x5, 0xff,
-    0x50, 0x5, 0xff, 0x50, 0x5, 0xff, 0x50, 0x3,
-    0xff, 0x50, 0x0, 0xa, 0x50, 0x0, 0x0,
-
-    /* U+F067 "" */
-    0x0, 0x0, 0x69, 0x10, 0x0, 0x0, 0x0, 0xd,
-    0xf5, 0x0, 0x0, 0x0, 0x0, 0xef, 0x60, 0x0,
-    0x0, 0x0, 0xe, 0xf6, 0x0, 0x0, 0x58, 0x88,
-    0xff, 0xb8, 0x88, 0x1f, 0xff, 0xff, 0xff, 0xff,
-    0xf7, 0x9b, 0xbb, 0xff, 0xdb, 0xbb, 0x30, 0x0,
-    0xe, 0xf6, 0x0, 0x0, 0x0, 0x0, 0xef, 0x60,
-    0x0, 0x0, 0x0, 0xe, 0xf6, 0x0, 0x0, 0x0,
-    0x0, 0x9d, 0x20, 0x0, 0x0,
-
-    /* U+F068 "" */
-    0x46, 0x66, 0x66, 0x66, 0x66, 0x1f, 0xff, 0xff,
-    0xff, 0xff, 0xf7, 0xad, 0xdd, 0xdd, 0xdd, 0xdd,
-    0x40,
-
-    /* U+F06E "" */
-    0x0, 0x3, 0xad, 0xff, 0xc7, 0x0, 0x0, 0x0,
-    0x9f, 0xe6, 0x24, 0xaf, 0xe3, 0x0, 0xb, 0xff,
-    0x20, 0x77, 0x9, 0xff, 0x40, 0x7f, 0xf9, 0x0,
-    0xcf, 0xa1, 0xff, 0xe1, 0xef, 0xf6, 0x7f, 0xff,
-    0xf0, 0xef, 0xf7, 0x8f, 0xf9, 0x3f, 0xff, 0xc1,
-    0xff, 0xe1, 0xb, 0xff, 0x26, 0xca, 0x19, 0xff,
-    0x40, 0x0, 0x9f, 0xe6, 0x24, 0xaf, 0xe3, 0x0,
-    0x0, 0x3, 0x9d, 0xff, 0xc7, 0x0, 0x0,
-
-    /* U+F070 "" */
-    0x32, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xdf, 0x50, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x1c, 0xf8, 0x4a, 0xef, 0xeb, 0x50, 0x0, 0x0,
-    0x0, 0x9f, 0xfd, 0x52, 0x5d, 0xfc, 0x10, 0x0,
-    0x0, 0x5, 0xfe, 0x4a, 0x70, 0xcf, 0xe1, 0x0,
-    0xb, 0x80, 0x2d, 0xff, 0xf7, 0x4f, 0xfb, 0x0,
-    0x2f, 0xfb, 0x0, 0xaf, 0xfb, 0x2f, 0xff, 0x30,
-    0xb, 0xff, 0x50, 0x7, 0xfe, 0x7f, 0xfb, 0x0,
-    0x1, 0xdf, 0xc0, 0x0, 0x3e, 0xff, 0xe1, 0x0,
-    0x0, 0x1b, 0xfc, 0x42, 0x1, 0xbf, 0xa0, 0x0,
-    0x0, 0x0, 0x5b, 0xef, 0xb0, 0x8, 0xfc, 0x10,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4f, 0xe0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2, 0x40,
-
-    /* U+F071 "" */
-    0x0, 0x0, 0x0, 0x3, 0x10, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x5, 0xfd, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xef, 0xf7, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x8f, 0xff, 0xf1, 0x0, 0x0, 0x0, 0x0,
-    0x2f, 0xfd, 0xef, 0xa0, 0x0, 0x0, 0x0, 0xb,
-    0xfb, 0x3, 0xff, 0x30, 0x0, 0x0, 0x4, 0xff,
-    0xc0, 0x4f, 0xfc, 0x0, 0x0, 0x0, 0xdf, 0xfd,
-    0x5, 0xff, 0xf6, 0x0, 0x0, 0x7f, 0xff, 0xf8,
-    0xcf, 0xff, 0xe1, 0x0, 0x1f, 0xff, 0xfc, 0x4,
-    0xff, 0xff, 0x90, 0xa, 0xff, 0xff, 0xd2, 0x7f,
-    0xff, 0xff, 0x20, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xf6, 0x4, 0x78, 0x88, 0x88, 0x88, 0x88,
-    0x87, 0x0,
-
-    /* U+F074 "" */
-    0x0, 0x0, 0x0, 0x0, 0x6, 0x10, 0x0, 0x0,
-    0x0, 0x0, 0xf, 0xc1, 0xff, 0xf8, 0x0, 0x2e,
-    0xff, 0xfc, 0xcd, 0xff, 0x62, 0xef, 0xdf, 0xf9,
-    0x0, 0x2c, 0x4e, 0xf9, 0xf, 0x90, 0x0, 0x2,
-    0xef, 0x90, 0x7, 0x0, 0x0, 0x2e, 0xf8, 0x88,
-    0xf, 0xa0, 0xcd, 0xff, 0x80, 0xdf, 0xdf, 0xf9,
-    0xff, 0xf8, 0x0, 0x1e, 0xff, 0xfc, 0x0, 0x0,
-    0x0, 0x0, 0xf, 0xc0, 0x0, 0x0, 0x0, 0x0,
-    0x6, 0x10,
-
-    /* U+F077 "" */
-    0x0, 0x0, 0x27, 0x0, 0x0, 0x0, 0x0, 0x2e,
-    0xf9, 0x0, 0x0, 0x0, 0x2e, 0xff, 0xf9, 0x0,
-    0x0, 0x2e, 0xf9, 0x2e, 0xf9, 0x0, 0x2e, 0xf9,
-    0x0, 0x2e, 0xf9, 0xb, 0xf9, 0x0, 0x0, 0x2e,
-    0xf4, 0x27, 0x0, 0x0, 0x0, 0x27, 0x0,
-
-    /* U+F078 "" */
-    0x27, 0x0, 0x0, 0x0, 0x27, 0xb, 0xf9, 0x0,
-    0x0, 0x2e, 0xf4, 0x2e, 0xf9, 0x0, 0x2e, 0xf9,
-    0x0, 0x2e, 0xf9, 0x2e, 0xf9, 0x0, 0x0, 0x2e,
-    0xff, 0xf9, 0x0, 0x0, 0x0, 0x2e, 0xf9, 0x0,
-    0x0, 0x0, 0x0, 0x26, 0x0, 0x0, 0x0,
-
-    /* U+F079 "" */
-    0x0, 0x1, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x3f, 0xc0, 0x7, 0x77, 0x77, 0x72, 0x0,
-    0x3, 0xff, 0xfc, 0x2e, 0xff, 0xff, 0xf9, 0x0,
-    0xf, 0xcf, 0xcf, 0xa0, 0x0, 0x0, 0xe9, 0x0,
-    0x4, 0x1e, 0x93, 0x20, 0x0, 0x0, 0xe9, 0x0,
-    0x0, 0xe, 0x90, 0x0, 0x0, 0x0, 0xe9, 0x0,
-    0x0, 0xe, 0x90, 0x0, 0x0, 0xb5, 0xe9, 0x97,
-    0x0, 0xe, 0xc7, 0x77, 0x73, 0xbf, 0xff, 0xf6,
-    0x0, 0xd, 0xff, 0xff, 0xfd, 0xb, 0xff, 0x70,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xa6, 0x0,
-
-    /* U+F07B "" */
-    0xbf, 0xff, 0xf6, 0x0, 0x0, 0x0, 0xff, 0xff,
-    0xff, 0x98, 0x88, 0x74, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xbf, 0xff, 0xff, 0xff, 0xff, 0xfb,
-
-    /* U+F093 "" */
-    0x0, 0x0, 0x2, 0x20, 0x0, 0x0, 0x0, 0x0,
-    0x3e, 0xe3, 0x0, 0x0, 0x0, 0x3, 0xef, 0xfe,
-    0x30, 0x0, 0x0, 0x3e, 0xff, 0xff, 0xe3, 0x0,
-    0x0, 0xef, 0xff, 0xff, 0xfe, 0x0, 0x0, 0x0,
-    0x8f, 0xf8, 0x0, 0x0, 0x0, 0x0, 0x8f, 0xf8,
-    0x0, 0x0, 0x0, 0x0, 0x8f, 0xf8, 0x0, 0x0,
-    0x23, 0x32, 0x8f, 0xf8, 0x23, 0x32, 0xff, 0xfe,
-    0x39, 0x93, 0xef, 0xff, 0xff, 0xff, 0xc9, 0x9c,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x5c, 0x8f,
-    0x9a, 0xaa, 0xaa, 0xaa, 0xaa, 0xa8,
-
-    /* U+F095 "" */
-    0x0, 0x0, 0x0, 0x0, 0x3, 0x62, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xcf, 0xfe, 0x0, 0x0, 0x0,
-    0x0, 0x3f, 0xff, 0xe0, 0x0, 0x0, 0x0, 0x9,
-    0xff, 0xfd, 0x0, 0x0, 0x0, 0x0, 0x2d, 0xff,
-    0x90, 0x0, 0x0, 0x0, 0x0, 0x4f, 0xf4, 0x0,
-    0x0, 0x0, 0x0, 0xc, 0xfd, 0x0, 0x0, 0x1,
-    0x0, 0x9, 0xff, 0x40, 0x1, 0x8e, 0xe1, 0x1a,
-    0xff, 0x70, 0x0, 0xef, 0xff, 0xde, 0xff, 0x90,
-    0x0, 0xc, 0xff, 0xff, 0xff, 0x60, 0x0, 0x0,
-    0x8f, 0xff, 0xe9, 0x10, 0x0, 0x0, 0x2, 0x76,
-    0x30, 0x0, 0x0, 0x0, 0x0,
-
-    /* U+F0C4 "" */
-    0x7, 0x93, 0x0, 0x0, 0x22, 0xa, 0xff, 0xf2,
-    0x0, 0x8f, 0xf5, 0xf9, 0x1f, 0x70, 0x8f, 0xf9,
-    0xc, 0xfc, 0xf8, 0x8f, 0xf9, 0x0, 0x1a, 0xef,
-    0xff, 0xf9, 0x0, 0x0, 0x0, 0xef, 0xfc, 0x0,
-    0x0, 0x7, 0xbf, 0xff, 0xf6, 0x0, 0xa, 0xff,
-    0xfa, 0xbf, 0xf6, 0x0, 0xf9, 0x1f, 0x70, 0xbf,
-    0xf6, 0xc, 0xfc, 0xf4, 0x0, 0xbf, 0xf4, 0x1a,
-    0xc6, 0x0, 0x0, 0x56, 0x0,
-
-    /* U+F0C5 "" */
-    0x0, 0x3, 0x44, 0x41, 0x20, 0x0, 0x0, 0xff,
-    0xff, 0x5e, 0x40, 0x24, 0x1f, 0xff, 0xf5, 0xee,
-    0x2f, 0xf4, 0xff, 0xff, 0xc8, 0x82, 0xff, 0x4f,
-    0xff, 0xff, 0xff, 0x5f, 0xf4, 0xff, 0xff, 0xff,
-    0xf5, 0xff, 0x4f, 0xff, 0xff, 0xff, 0x5f, 0xf4,
-    0xff, 0xff, 0xff, 0xf5, 0xff, 0x4f, 0xff, 0xff,
-    0xff, 0x5f, 0xf4, 0xff, 0xff, 0xff, 0xf4, 0xff,
-    0x93, 0x44, 0x44, 0x43, 0xf, 0xff, 0xff, 0xff,
-    0x50, 0x0, 0x68, 0x88, 0x88, 0x71, 0x0, 0x0,
-
-    /* U+F0C7 "" */
-    0x48, 0x88, 0x88, 0x87, 0x0, 0xf, 0xff, 0xff,
-    0xff, 0xfb, 0x0, 0xf8, 0x0, 0x0, 0xb, 0xfb,
-    0xf, 0x80, 0x0, 0x0, 0xbf, 0xf3, 0xfb, 0x77,
-    0x77, 0x7d, 0xff, 0x4f, 0xff, 0xff, 0xff, 0xff,
-    0xf4, 0xff, 0xff, 0x42, 0xdf, 0xff, 0x4f, 0xff,
-    0xc0, 0x8, 0xff, 0xf4, 0xff, 0xfe, 0x0, 0xaf,
-    0xff, 0x4f, 0xff, 0xfc, 0xaf, 0xff, 0xf4, 0xaf,
-    0xff, 0xff, 0xff, 0xfd, 0x10,
-
-    /* U+F0E7 "" */
-    0x1, 0xbb, 0xba, 0x10, 0x0, 0x5f, 0xff, 0xf1,
-    0x0, 0x7, 0xff, 0xfb, 0x0, 0x0, 0x9f, 0xff,
-    0x60, 0x0, 0xb, 0xff, 0xff, 0xff, 0x60, 0xef,
-    0xff, 0xff, 0xf1, 0xe, 0xff, 0xff, 0xf8, 0x0,
-    0x0, 0xc, 0xfe, 0x0, 0x0, 0x0, 0xff, 0x50,
-    0x0, 0x0, 0x3f, 0xc0, 0x0, 0x0, 0x7, 0xf3,
-    0x0, 0x0, 0x0, 0xa9, 0x0, 0x0, 0x0, 0x2,
-    0x0, 0x0, 0x0,
-
-    /* U+F0EA "" */
-    0x0, 0x2a, 0x50, 0x0, 0x0, 0xe, 0xff, 0x8f,
-    0xff, 0x20, 0x0, 0xff, 0xf8, 0xff, 0xf4, 0x0,
-    0xf, 0xff, 0xeb, 0xbb, 0x30, 0x0, 0xff, 0xf4,
-    0x99, 0x92, 0x60, 0xf, 0xff, 0x5f, 0xff, 0x4f,
-    0xa0, 0xff, 0xf5, 0xff, 0xf5, 0x56, 0x1f, 0xff,
-    0x5f, 0xff, 0xff, 0xf4, 0xff, 0xf5, 0xff, 0xff,
-    0xff, 0x4e, 0xff, 0x5f, 0xff, 0xff, 0xf4, 0x0,
-    0x5, 0xff, 0xff, 0xff, 0x40, 0x0, 0x5f, 0xff,
-    0xff, 0xf4, 0x0, 0x0, 0x44, 0x44, 0x44, 0x0,
-
-    /* U+F0F3 "" */
-    0x0, 0x0, 0x15, 0x0, 0x0, 0x0, 0x0, 0x9,
-    0xf1, 0x0, 0x0, 0x0, 0x2d, 0xff, 0xf9, 0x0,
-    0x0, 0xe, 0xff, 0xff, 0xf7, 0x0, 0x5, 0xff,
-    0xff, 0xff, 0xd0, 0x0, 0x8f, 0xff, 0xff, 0xff,
-    0x0, 0xa, 0xff, 0xff, 0xff, 0xf2, 0x0, 0xdf,
-    0xff, 0xff, 0xff, 0x50, 0x6f, 0xff, 0xff, 0xff,
-    0xfd, 0xe, 0xff, 0xff, 0xff, 0xff, 0xf6, 0x24,
-    0x44, 0x44, 0x44, 0x43, 0x0, 0x0, 0x2f, 0xf9,
-    0x0, 0x0, 0x0, 0x0, 0x46, 0x0, 0x0, 0x0,
-
-    /* U+F11C "" */
-    0xbf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf4, 0xfc,
-    0x8e, 0x8e, 0x8e, 0x88, 0xe8, 0xf7, 0xf8, 0xc,
-    0xc, 0xb, 0x0, 0xb0, 0xf8, 0xff, 0xec, 0xfc,
-    0xec, 0xee, 0xcf, 0xf8, 0xff, 0xa0, 0xc0, 0xa0,
-    0x77, 0x2f, 0xf8, 0xff, 0xec, 0xfc, 0xec, 0xee,
-    0xcf, 0xf8, 0xf8, 0xc, 0x0, 0x0, 0x0, 0xb0,
-    0xf8, 0xfc, 0x8e, 0x88, 0x88, 0x88, 0xe8, 0xf7,
-    0xbf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf4,
-
-    /* U+F124 "" */
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x6, 0x30, 0x0,
-    0x0, 0x0, 0x0, 0x18, 0xef, 0xe0, 0x0, 0x0,
-    0x0, 0x29, 0xff, 0xff, 0xb0, 0x0, 0x0, 0x3a,
-    0xff, 0xff, 0xff, 0x30, 0x0, 0x4c, 0xff, 0xff,
-    0xff, 0xfc, 0x0, 0xb, 0xff, 0xff, 0xff, 0xff,
-    0xf5, 0x0, 0xe, 0xff, 0xff, 0xff, 0xff, 0xd0,
-    0x0, 0x1, 0x34, 0x44, 0xdf, 0xff, 0x60, 0x0,
-    0x0, 0x0, 0x0, 0xcf, 0xfe, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xcf, 0xf8, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xcf, 0xf1, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xbf, 0x90, 0x0, 0x0, 0x0, 0x0, 0x0, 0x26,
-    0x0, 0x0, 0x0,
-
-    /* U+F15B "" */
-    0x9b, 0xbb, 0xb2, 0x70, 0xf, 0xff, 0xff, 0x4f,
-    0x90, 0xff, 0xff, 0xf4, 0xff, 0x9f, 0xff, 0xff,
-    0x54, 0x44, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x34, 0x44,
-    0x44, 0x44, 0x30,
-
-    /* U+F1EB "" */
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x5, 0x9b, 0xcb, 0x95, 0x0, 0x0, 0x0,
-    0x8f, 0xff, 0xff, 0xff, 0xff, 0x80, 0x3, 0xef,
-    0xfa, 0x53, 0x23, 0x5a, 0xff, 0xe3, 0xdf, 0xa1,
-    0x0, 0x0, 0x0, 0x1, 0xaf, 0xd2, 0x60, 0x5,
-    0xbe, 0xfe, 0xb5, 0x0, 0x52, 0x0, 0x1c, 0xff,
-    0xfe, 0xff, 0xfc, 0x10, 0x0, 0x2, 0xec, 0x40,
-    0x0, 0x4c, 0xe2, 0x0, 0x0, 0x1, 0x0, 0x1,
-    0x0, 0x1, 0x0, 0x0, 0x0, 0x0, 0xa, 0xfa,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xff, 0xf0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x6, 0xd6, 0x0,
-    0x0, 0x0,
-
-    /* U+F240 "" */
-    0x37, 0x77, 0x77, 0x77, 0x77, 0x77, 0x75, 0xf,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf3, 0xf8,
-    0x34, 0x44, 0x44, 0x44, 0x44, 0x4f, 0xdf, 0x8c,
-    0xff, 0xff, 0xff, 0xff, 0xf2, 0xcf, 0xf8, 0xcf,
-    0xff, 0xff, 0xff, 0xff, 0x8, 0xff, 0x89, 0xcc,
-    0xcc, 0xcc, 0xcc, 0xc3, 0xff, 0xfb, 0x77, 0x77,
-    0x77, 0x77, 0x77, 0x9f, 0x9c, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xe1, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0,
-
-    /* U+F241 "" */
-    0x37, 0x77, 0x77, 0x77, 0x77, 0x77, 0x75, 0xf,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf3, 0xf8,
-    0x34, 0x44, 0x44, 0x43, 0x0, 0x4f, 0xdf, 0x8c,
-    0xff, 0xff, 0xff, 0xc0, 0x2, 0xcf, 0xf8, 0xcf,
-    0xff, 0xff, 0xfc, 0x0, 0x8, 0xff, 0x89, 0xcc,
-    0xcc, 0xcc, 0x90, 0x3, 0xff, 0xfb, 0x77, 0x77,
-    0x77, 0x77, 0x77, 0x9f, 0x9c, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xe1, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0,
-
-    /* U+F242 "" */
-    0x37, 0x77, 0x77, 0x77, 0x77, 0x77, 0x75, 0xf,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf3, 0xf8,
-    0x34, 0x44, 0x42, 0x0, 0x0, 0x4f, 0xdf, 0x8c,
-    0xff, 0xff, 0x80, 0x0, 0x2, 0xcf, 0xf8, 0xcf,
-    0xff, 0xf8, 0x0, 0x0, 0x8, 0xff, 0x89, 0xcc,
-    0xcc, 0x60, 0x0, 0x3, 0xff, 0xfb, 0x77, 0x77,
-    0x77, 0x77, 0x77, 0x9f, 0x9c, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xe1, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0,
-
-    /* U+F243 "" */
-    0x37, 0x77, 0x77, 0x77, 0x77, 0x77, 0x75, 0xf,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf3, 0xf8,
-    0x34, 0x41, 0x0, 0x0, 0x0, 0x4f, 0xdf, 0x8c,
-    0xff, 0x40, 0x0, 0x0, 0x2, 0xcf, 0xf8, 0xcf,
-    0xf4, 0x0, 0x0, 0x0, 0x8, 0xff, 0x89, 0xcc,
-    0x30, 0x0, 0x0, 0x3, 0xff, 0xfb, 0x77, 0x77,
-    0x77, 0x77, 0x77, 0x9f, 0x9c, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xe1, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0,
-
-    /* U+F244 "" */
-    0x37, 0x77, 0x77, 0x77, 0x77, 0x77, 0x75, 0xf,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf3, 0xf8,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x4f, 0xdf, 0x80,
-    0x0, 0x0, 0x0, 0x0, 0x2, 0xcf, 0xf8, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x8, 0xff, 0x80, 0x0,
-    0x0, 0x0, 0x0, 0x3, 0xff, 0xfb, 0x77, 0x77,
-    0x77, 0x77, 0x77, 0x9f, 0x9c, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xe1, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0,
-
-    /* U+F287 "" */
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x25, 0xfb, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x5, 0xcb, 0xfe, 0x0, 0x0, 0x0,
-    0x1, 0x0, 0xd, 0x10, 0x42, 0x0, 0x0, 0x0,
-    0x9f, 0xd1, 0x68, 0x0, 0x0, 0x0, 0x68, 0x0,
-    0xff, 0xfe, 0xee, 0xed, 0xdd, 0xdd, 0xef, 0xc0,
-    0x9f, 0xd1, 0x0, 0xb3, 0x0, 0x0, 0x68, 0x0,
-    0x1, 0x0, 0x0, 0x3b, 0x5, 0x74, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x9, 0xbe, 0xfb, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x2d, 0xfb, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-
-    /* U+F293 "" */
-    0x0, 0x0, 0x34, 0x20, 0x0, 0x0, 0x6e, 0xfe,
-    0xfd, 0x20, 0x4, 0xff, 0xf3, 0xff, 0xd0, 0xc,
-    0xff, 0xf0, 0x4f, 0xf5, 0xf, 0xd5, 0xf2, 0x95,
-    0xf8, 0x2f, 0xf7, 0x41, 0x3c, 0xfa, 0x3f, 0xff,
-    0x60, 0xaf, 0xfb, 0x3f, 0xfe, 0x20, 0x4f, 0xfb,
-    0x2f, 0xe2, 0x92, 0x75, 0xfa, 0xf, 0xeb, 0xf1,
-    0x49, 0xf8, 0x9, 0xff, 0xf0, 0x9f, 0xf2, 0x1,
-    0xdf, 0xf9, 0xff, 0x90, 0x0, 0x6, 0xab, 0x95,
-    0x0,
-
-    /* U+F2ED "" */
-    0x0, 0x4, 0x88, 0x70, 0x0, 0xb, 0xcc, 0xff,
-    0xff, 0xdc, 0xc5, 0xbc, 0xcc, 0xcc, 0xcc, 0xcc,
-    0x52, 0x88, 0x88, 0x88, 0x88, 0x60, 0x4f, 0xff,
-    0xff, 0xff, 0xfc, 0x4, 0xfa, 0xae, 0x6f, 0x5f,
-    0xc0, 0x4f, 0xaa, 0xe6, 0xf4, 0xfc, 0x4, 0xfa,
-    0xae, 0x6f, 0x4f, 0xc0, 0x4f, 0xaa, 0xe6, 0xf4,
-    0xfc, 0x4, 0xfa, 0xae, 0x6f, 0x4f, 0xc0, 0x4f,
-    0xaa, 0xe6, 0xf5, 0xfc, 0x3, 0xff, 0xff, 0xff,
-    0xff, 0xb0, 0x6, 0x88, 0x88, 0x88, 0x72, 0x0,
-
-    /* U+F304 "" */
-    0x0, 0x0, 0x0, 0x0, 0x1, 0x71, 0x0, 0x0,
-    0x0, 0x0, 0x2, 0xef, 0xd1, 0x0, 0x0, 0x0,
-    0x1, 0x5f, 0xff, 0xc0, 0x0, 0x0, 0x2, 0xea,
-    0x5f, 0xfd, 0x0, 0x0, 0x2, 0xef, 0xfa, 0x5d,
-    0x20, 0x0, 0x2, 0xef, 0xff, 0xf8, 0x0, 0x0,
-    0x2, 0xef, 0xff, 0xfe, 0x20, 0x0, 0x2, 0xef,
-    0xff, 0xfe, 0x20, 0x0, 0x2, 0xef, 0xff, 0xfe,
-    0x20, 0x0, 0x0, 0xbf, 0xff, 0xfe, 0x20, 0x0,
-    0x0, 0xd, 0xff, 0xfe, 0x20, 0x0, 0x0, 0x0,
-    0xff, 0xfe, 0x20, 0x0, 0x0, 0x0, 0x6, 0x64,
-    0x10, 0x0, 0x0, 0x0, 0x0,
-
-    /* U+F55A "" */
-    0x0, 0x5, 0xef, 0xff, 0xff, 0xff, 0xff, 0x80,
-    0x5, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x5,
-    0xff, 0xff, 0x91, 0xdd, 0x19, 0xff, 0xf5, 0xff,
-    0xff, 0xfd, 0x11, 0x11, 0xdf, 0xff, 0xef, 0xff,
-    0xff, 0xfb, 0x0, 0xbf, 0xff, 0xf5, 0xff, 0xff,
-    0xfd, 0x11, 0x11, 0xdf, 0xff, 0x5, 0xff, 0xff,
-    0x91, 0xdd, 0x19, 0xff, 0xf0, 0x5, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0x0, 0x4, 0xef, 0xff,
-    0xff, 0xff, 0xff, 0x80,
-
-    /* U+F7C2 "" */
-    0x0, 0x17, 0x88, 0x87, 0x20, 0x2d, 0xff, 0xff,
-    0xfd, 0x2e, 0xa0, 0xb3, 0x78, 0xfe, 0xfa, 0xb,
-    0x37, 0x8f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xfc, 0xff, 0xff, 0xff, 0xfc, 0x4, 0x44,
-    0x44, 0x44, 0x0,
-
-    /* U+F8A2 "" */
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x2, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x4, 0xf0, 0x0, 0x69, 0x0,
-    0x0, 0x0, 0xdf, 0x0, 0x7f, 0xc0, 0x0, 0x0,
-    0xd, 0xf0, 0x8f, 0xff, 0xdd, 0xdd, 0xdd, 0xff,
-    0xb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf0, 0xb,
-    0xfc, 0x0, 0x0, 0x0, 0x0, 0x0, 0xa, 0xc0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0
-};
-
-
-/*---------------------
- *  GLYPH DESCRIPTION
- *--------------------*/
-
-static const lv_font_fmt_txt_glyph_dsc_t glyph_dsc[] = {
-    {.bitmap_index = 0, .adv_w = 0, .box_w = 0, .box_h = 0, .ofs_x = 0, .ofs_y = 0} /* id = 0 reserved */,
-    {.bitmap_index = 0, .adv_w = 96, .box_w = 2, .box_h = 9, .ofs_x = 2, .ofs_y = 0},
-    {.bitmap_index = 9, .adv_w = 96, .box_w = 6, .box_h = 4, .ofs_x = 0, .ofs_y = 6},
-    {.bitmap_index = 21, .adv_w = 96, .box_w = 6, .box_h = 9, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 48, .adv_w = 96, .box_w = 6, .box_h = 12, .ofs_x = 0, .ofs_y = -2},
-    {.bitmap_index = 84, .adv_w = 96, .box_w = 6, .box_h = 9, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 111, .adv_w = 96, .box_w = 6, .box_h = 9, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 138, .adv_w = 96, .box_w = 3, .box_h = 4, .ofs_x = 0, .ofs_y = 6},
-    {.bitmap_index = 144, .adv_w = 96, .box_w = 4, .box_h = 13, .ofs_x = 2, .ofs_y = -2},
-    {.bitmap_index = 170, .adv_w = 96, .box_w = 4, .box_h = 13, .ofs_x = 0, .ofs_y = -2},
-    {.bitmap_index = 196, .adv_w = 96, .box_w = 6, .box_h = 7, .ofs_x = 0, .ofs_y = 1},
-    {.bitmap_index = 217, .adv_w = 96, .box_w = 6, .box_h = 7, .ofs_x = 0, .ofs_y = 1},
-    {.bitmap_index = 238, .adv_w = 96, .box_w = 6, .box_h = 1, .ofs_x = 0, .ofs_y = 4},
-    {.bitmap_index = 241, .adv_w = 96, .box_w = 3, .box_h = 2, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 244, .adv_w = 96, .box_w = 6, .box_h = 12, .ofs_x = 0, .ofs_y = -1},
-    {.bitmap_index = 280, .adv_w = 96, .box_w = 6, .box_h = 9, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 307, .adv_w = 96, .box_w = 4, .box_h = 9, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 325, .adv_w = 96, .box_w = 6, .box_h = 9, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 352, .adv_w = 96, .box_w = 6, .box_h = 9, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 379, .adv_w = 96, .box_w = 6, .box_h = 9, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 406, .adv_w = 96, .box_w = 6, .box_h = 9, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 433, .adv_w = 96, .box_w = 6, .box_h = 9, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 460, .adv_w = 96, .box_w = 6, .box_h = 9, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 487, .adv_w = 96, .box_w = 6, .box_h = 9, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 514, .adv_w = 96, .box_w = 6, .box_h = 9, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 541, .adv_w = 96, .box_w = 2, .box_h = 6, .ofs_x = 2, .ofs_y = 0},
-    {.bitmap_index = 547, .adv_w = 96, .box_w = 2, .box_h = 8, .ofs_x = 2, .ofs_y = -2},
-    {.bitmap_index = 555, .adv_w = 96, .box_w = 6, .box_h = 10, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 585, .adv_w = 96, .box_w = 6, .box_h = 4, .ofs_x = 0, .ofs_y = 3},
-    {.bitmap_index = 597, .adv_w = 96, .box_w = 6, .box_h = 10, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 627, .adv_w = 96, .box_w = 6, .box_h = 9, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 654, .adv_w = 96, .box_w = 6, .box_h = 9, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 681, .adv_w = 96, .box_w = 6, .box_h = 9, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 708, .adv_w = 96, .box_w = 6, .box_h = 9, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 735, .adv_w = 96, .box_w = 6, .box_h = 9, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 762, .adv_w = 96, .box_w = 6, .box_h = 9, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 789, .adv_w = 96, .box_w = 6, .box_h = 9, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 816, .adv_w = 96, .box_w = 6, .box_h = 9, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 843, .adv_w = 96, .box_w = 6, .box_h = 9, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 870, .adv_w = 96, .box_w = 6, .box_h = 9, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 897, .adv_w = 96, .box_w = 4, .box_h = 9, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 915, .adv_w = 96, .box_w = 6, .box_h = 11, .ofs_x = 0, .ofs_y = -2},
-    {.bitmap_index = 948, .adv_w = 96, .box_w = 6, .box_h = 9, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 975, .adv_w = 96, .box_w = 6, .box_h = 9, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 1002, .adv_w = 96, .box_w = 6, .box_h = 9, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 1029, .adv_w = 96, .box_w = 6, .box_h = 9, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 1056, .adv_w = 96, .box_w = 6, .box_h = 9, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 1083, .adv_w = 96, .box_w = 6, .box_h = 9, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 1110, .adv_w = 96, .box_w = 6, .box_h = 10, .ofs_x = 0, .ofs_y = -1},
-    {.bitmap_index = 1140, .adv_w = 96, .box_w = 6, .box_h = 9, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 1167, .adv_w = 96, .box_w = 6, .box_h = 9, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 1194, .adv_w = 96, .box_w = 6, .box_h = 9, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 1221, .adv_w = 96, .box_w = 6, .box_h = 9, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 1248, .adv_w = 96, .box_w = 6, .box_h = 9, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 1275, .adv_w = 96, .box_w = 6, .box_h = 9, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 1302, .adv_w = 96, .box_w = 6, .box_h = 9, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 1329, .adv_w = 96, .box_w = 6, .box_h = 9, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 1356, .adv_w = 96, .box_w = 6, .box_h = 9, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 1383, .adv_w = 96, .box_w = 4, .box_h = 12, .ofs_x = 2, .ofs_y = -1},
-    {.bitmap_index = 1407, .adv_w = 96, .box_w = 6, .box_h = 11, .ofs_x = 0, .ofs_y = -2},
-    {.bitmap_index = 1440, .adv_w = 96, .box_w = 4, .box_h = 12, .ofs_x = 0, .ofs_y = -1},
-    {.bitmap_index = 1464, .adv_w = 96, .box_w = 4, .box_h = 2, .ofs_x = 1, .ofs_y = 9},
-    {.bitmap_index = 1468, .adv_w = 96, .box_w = 6, .box_h = 1, .ofs_x = 0, .ofs_y = -2},
-    {.bitmap_index = 1471, .adv_w = 96, .box_w = 4, .box_h = 2, .ofs_x = 0, .ofs_y = 9},
-    {.bitmap_index = 1475, .adv_w = 96, .box_w = 6, .box_h = 6, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 1493, .adv_w = 96, .box_w = 6, .box_h = 10, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 1523, .adv_w = 96, .box_w = 6, .box_h = 6, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 1541, .adv_w = 96, .box_w = 6, .box_h = 10, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 1571, .adv_w = 96, .box_w = 6, .box_h = 6, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 1589, .adv_w = 96, .box_w = 6, .box_h = 9, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 1616, .adv_w = 96, .box_w = 6, .box_h = 8, .ofs_x = 0, .ofs_y = -2},
-    {.bitmap_index = 1640, .adv_w = 96, .box_w = 6, .box_h = 9, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 1667, .adv_w = 96, .box_w = 4, .box_h = 9, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 1685, .adv_w = 96, .box_w = 5, .box_h = 11, .ofs_x = 0, .ofs_y = -2},
-    {.bitmap_index = 1713, .adv_w = 96, .box_w = 6, .box_h = 9, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 1740, .adv_w = 96, .box_w = 4, .box_h = 9, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 1758, .adv_w = 96, .box_w = 6, .box_h = 6, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 1776, .adv_w = 96, .box_w = 6, .box_h = 6, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 1794, .adv_w = 96, .box_w = 6, .box_h = 6, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 1812, .adv_w = 96, .box_w = 6, .box_h = 8, .ofs_x = 0, .ofs_y = -2},
-    {.bitmap_index = 1836, .adv_w = 96, .box_w = 6, .box_h = 8, .ofs_x = 0, .ofs_y = -2},
-    {.bitmap_index = 1860, .adv_w = 96, .box_w = 6, .box_h = 6, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 1878, .adv_w = 96, .box_w = 6, .box_h = 6, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 1896, .adv_w = 96, .box_w = 6, .box_h = 8, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 1920, .adv_w = 96, .box_w = 6, .box_h = 6, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 1938, .adv_w = 96, .box_w = 6, .box_h = 6, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 1956, .adv_w = 96, .box_w = 6, .box_h = 6, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 1974, .adv_w = 96, .box_w = 6, .box_h = 6, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 1992, .adv_w = 96, .box_w = 6, .box_h = 8, .ofs_x = 0, .ofs_y = -2},
-    {.bitmap_index = 2016, .adv_w = 96, .box_w = 6, .box_h = 6, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 2034, .adv_w = 96, .box_w = 4, .box_h = 12, .ofs_x = 2, .ofs_y = -1},
-    {.bitmap_index = 2058, .adv_w = 96, .box_w = 2, .box_h = 13, .ofs_x = 2, .ofs_y = -2},
-    {.bitmap_index = 2071, .adv_w = 96, .box_w = 4, .box_h = 12, .ofs_x = 0, .ofs_y = -1},
-    {.bitmap_index = 2095, .adv_w = 96, .box_w = 6, .box_h = 3, .ofs_x = 0, .ofs_y = 8},
-    {.bitmap_index = 2104, .adv_w = 192, .box_w = 12, .box_h = 13, .ofs_x = 0, .ofs_y = -2},
-    {.bitmap_index = 2182, .adv_w = 192, .box_w = 12, .box_h = 9, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 2236, .adv_w = 192, .box_w = 12, .box_h = 11, .ofs_x = 0, .ofs_y = -1},
-    {.bitmap_index = 2302, .adv_w = 192, .box_w = 12, .box_h = 9, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 2356, .adv_w = 132, .box_w = 9, .box_h = 9, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 2397, .adv_w = 192, .box_w = 12, .box_h = 13, .ofs_x = 0, .ofs_y = -2},
-    {.bitmap_index = 2475, .adv_w = 192, .box_w = 12, .box_h = 13, .ofs_x = 0, .ofs_y = -2},
-    {.bitmap_index = 2553, .adv_w = 216, .box_w = 14, .box_h = 11, .ofs_x = 0, .ofs_y = -1},
-    {.bitmap_index = 2630, .adv_w = 192, .box_w = 12, .box_h = 13, .ofs_x = 0, .ofs_y = -2},
-    {.bitmap_index = 2708, .adv_w = 216, .box_w = 14, .box_h = 9, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 2771, .adv_w = 192, .box_w = 12, .box_h = 13, .ofs_x = 0, .ofs_y = -2},
-    {.bitmap_index = 2849, .adv_w = 96, .box_w = 6, .box_h = 10, .ofs_x = 0, .ofs_y = -1},
-    {.bitmap_index = 2879, .adv_w = 144, .box_w = 9, .box_h = 10, .ofs_x = 0, .ofs_y = -1},
-    {.bitmap_index = 2924, .adv_w = 216, .box_w = 14, .box_h = 13, .ofs_x = 0, .ofs_y = -2},
-    {.bitmap_index = 3015, .adv_w = 192, .box_w = 12, .box_h = 9, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 3069, .adv_w = 168, .box_w = 8, .box_h = 12, .ofs_x = 1, .ofs_y = -2},
-    {.bitmap_index = 3117, .adv_w = 168, .box_w = 11, .box_h = 13, .ofs_x = 0, .ofs_y = -2},
-    {.bitmap_index = 3189, .adv_w = 168, .box_w = 11, .box_h = 11, .ofs_x = 0, .ofs_y = -1},
-    {.bitmap_index = 3250, .adv_w = 168, .box_w = 11, .box_h = 11, .ofs_x = 0, .ofs_y = -1},
-    {.bitmap_index = 3311, .adv_w = 168, .box_w = 8, .box_h = 12, .ofs_x = 1, .ofs_y = -2},
-    {.bitmap_index = 3359, .adv_w = 168, .box_w = 12, .box_h = 11, .ofs_x = -1, .ofs_y = -1},
-    {.bitmap_index = 3425, .adv_w = 120, .box_w = 7, .box_h = 11, .ofs_x = 0, .ofs_y = -1},
-    {.bitmap_index = 3464, .adv_w = 120, .box_w = 7, .box_h = 11, .ofs_x = 0, .ofs_y = -1},
-    {.bitmap_index = 3503, .adv_w = 168, .box_w = 11, .box_h = 11, .ofs_x = 0, .ofs_y = -1},
-    {.bitmap_index = 3564, .adv_w = 168, .box_w = 11, .box_h = 3, .ofs_x = 0, .ofs_y = 3},
-    {.bitmap_index = 3581, .adv_w = 216, .box_w = 14, .box_h = 9, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 3644, .adv_w = 240, .box_w = 16, .box_h = 13, .ofs_x = 0, .ofs_y = -2},
-    {.bitmap_index = 3748, .adv_w = 216, .box_w = 15, .box_h = 13, .ofs_x = -1, .ofs_y = -2},
-    {.bitmap_index = 3846, .adv_w = 192, .box_w = 12, .box_h = 11, .ofs_x = 0, .ofs_y = -1},
-    {.bitmap_index = 3912, .adv_w = 168, .box_w = 11, .box_h = 7, .ofs_x = 0, .ofs_y = 1},
-    {.bitmap_index = 3951, .adv_w = 168, .box_w = 11, .box_h = 7, .ofs_x = 0, .ofs_y = 1},
-    {.bitmap_index = 3990, .adv_w = 240, .box_w = 16, .box_h = 10, .ofs_x = -1, .ofs_y = 0},
-    {.bitmap_index = 4070, .adv_w = 192, .box_w = 12, .box_h = 9, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 4124, .adv_w = 192, .box_w = 12, .box_h = 13, .ofs_x = 0, .ofs_y = -2},
-    {.bitmap_index = 4202, .adv_w = 192, .box_w = 13, .box_h = 13, .ofs_x = -1, .ofs_y = -2},
-    {.bitmap_index = 4287, .adv_w = 168, .box_w = 11, .box_h = 11, .ofs_x = 0, .ofs_y = -1},
-    {.bitmap_index = 4348, .adv_w = 168, .box_w = 11, .box_h = 13, .ofs_x = 0, .ofs_y = -2},
-    {.bitmap_index = 4420, .adv_w = 168, .box_w = 11, .box_h = 11, .ofs_x = 0, .ofs_y = -1},
-    {.bitmap_index = 4481, .adv_w = 120, .box_w = 9, .box_h = 13, .ofs_x = -1, .ofs_y = -2},
-    {.bitmap_index = 4540, .adv_w = 168, .box_w = 11, .box_h = 13, .ofs_x = 0, .ofs_y = -2},
-    {.bitmap_index = 4612, .adv_w = 168, .box_w = 11, .box_h = 13, .ofs_x = 0, .ofs_y = -2},
-    {.bitmap_index = 4684, .adv_w = 216, .box_w = 14, .box_h = 9, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 4747, .adv_w = 192, .box_w = 14, .box_h = 13, .ofs_x = -1, .ofs_y = -2},
-    {.bitmap_index = 4838, .adv_w = 144, .box_w = 9, .box_h = 13, .ofs_x = 0, .ofs_y = -2},
-    {.bitmap_index = 4897, .adv_w = 240, .box_w = 15, .box_h = 12, .ofs_x = 0, .ofs_y = -1},
-    {.bitmap_index = 4987, .adv_w = 240, .box_w = 15, .box_h = 9, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 5055, .adv_w = 240, .box_w = 15, .box_h = 9, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 5123, .adv_w = 240, .box_w = 15, .box_h = 9, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 5191, .adv_w = 240, .box_w = 15, .box_h = 9, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 5259, .adv_w = 240, .box_w = 15, .box_h = 9, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 5327, .adv_w = 240, .box_w = 16, .box_h = 11, .ofs_x = 0, .ofs_y = -1},
-    {.bitmap_index = 5415, .adv_w = 168, .box_w = 10, .box_h = 13, .ofs_x = 0, .ofs_y = -2},
-    {.bitmap_index = 5480, .adv_w = 168, .box_w = 11, .box_h = 13, .ofs_x = 0, .ofs_y = -2},
-    {.bitmap_index = 5552, .adv_w = 192, .box_w = 13, .box_h = 13, .ofs_x = -1, .ofs_y = -2},
-    {.bitmap_index = 5637, .adv_w = 240, .box_w = 15, .box_h = 9, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 5705, .adv_w = 144, .box_w = 9, .box_h = 13, .ofs_x = 0, .ofs_y = -2},
-    {.bitmap_index = 5764, .adv_w = 193, .box_w = 13, .box_h = 9, .ofs_x = 0, .ofs_y = 0}
-};
-
-/*---------------------
- *  CHARACTER MAPPING
- *--------------------*/
-
-static const uint16_t unicode_list_2[] = {
-    0x0, 0x7, 0xa, 0xb, 0xc, 0x10, 0x12, 0x14,
-    0x18, 0x1b, 0x20, 0x25, 0x26, 0x27, 0x3d, 0x47,
-    0x4a, 0x4b, 0x4c, 0x50, 0x51, 0x52, 0x53, 0x66,
-    0x67, 0x6d, 0x6f, 0x70, 0x73, 0x76, 0x77, 0x78,
-    0x7a, 0x92, 0x94, 0xc3, 0xc4, 0xc6, 0xe6, 0xe9,
-    0xf2, 0x11b, 0x123, 0x15a, 0x1ea, 0x23f, 0x240, 0x241,
-    0x242, 0x243, 0x286, 0x292, 0x2ec, 0x303, 0x559, 0x7c1,
-    0x8a1
-};
-
-/*Collect the unicode lists and glyph_id offsets*/
-static const lv_font_fmt_txt_cmap_t cmaps[] =
-{
-    {
-        .range_start = 33, .range_length = 11, .glyph_id_start = 1,
-        .unicode_list = NULL, .glyph_id_ofs_list = NULL, .list_length = 0, .type = LV_FONT_FMT_TXT_CMAP_FORMAT0_TINY
-    },
-    {
-        .range_start = 45, .range_length = 82, .glyph_id_start = 12,
-        .unicode_list = NULL, .glyph_id_ofs_list = NULL, .list_length = 0, .type = LV_FONT_FMT_TXT_CMAP_FORMAT0_TINY
-    },
-    {
-        .range_start = 61441, .range_length = 2210, .glyph_id_start = 94,
-        .unicode_list = unicode_list_2, .glyph_id_ofs_list = NULL, .list_length = 57, .type = LV_FONT_FMT_TXT_CMAP_SPARSE_TINY
-    }
-};
-
-
-
-/*--------------------
- *  ALL CUSTOM DATA
- *--------------------*/
-
-/*Store all the custom data of the font*/
-static lv_font_fmt_txt_dsc_t font_dsc = {
-    .glyph_bitmap = gylph_bitmap,
-    .glyph_dsc = glyph_dsc,
-    .cmaps = cmaps,
-    .kern_dsc = NULL,
-    .kern_scale = 0,
-    .cmap_num = 3,
-    .bpp = 4,
-    .kern_classes = 0,
-    .bitmap_format = 0
-};
-
-
-/*-----------------
- *  PUBLIC FONT
- *----------------*/
-
-/*Initialize a public general font descriptor*/
-lv_font_t lv_font_simsun_12 = {
-    .get_glyph_dsc = lv_font_get_glyph_dsc_fmt_txt,    /*Function pointer to get glyph's data*/
-    .get_glyph_bitmap = lv_font_get_bitmap_fmt_txt,    /*Function pointer to get glyph's bitmap*/
-    .line_height = 13,          /*The maximum line height required by the font*/
-    .base_line = 2,             /*Baseline measured from the bottom of the line*/
-#if !(LVGL_VERSION_MAJOR == 6 && LVGL_VERSION_MINOR == 0)
-    .subpx = LV_FONT_SUBPX_NONE,
-#endif
-#if LV_VERSION_CHECK(7, 4, 0)
-    .underline_position = -2,
-    .underline_thickness = 1,
-#endif
-    .dsc = &font_dsc           /*The custom font data. Will be accessed by `get_glyph_bitmap/dsc` */
-};
-
-
-
-#endif /*#if LV_FONT_SIMSUN_12*/
-
@@ -6,9 +6,7 @@
     #endif
     
     #include "lvgl.h"
-    LV_FONT_DECLARE(lv_font_notosanssc_18)
-    LV_FONT_DECLARE(lv_font_notosanssc_16)
-    LV_FONT_DECLARE(lv_font_notosanssc_12)
+    // 中文字体不再编译进固件, 运行时从SD卡/static/fonts加载(见system/fonts/font_manager.h)
 
     
     #ifdef __cplusplus
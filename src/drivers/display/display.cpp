@@ -1,12 +1,19 @@
 #include "display.h"
 #include <TFT_eSPI.h>
 #include "log_manager.h"
+#include "mem_tracker.h"
+#include "esp_timer.h"
+#include <driver/ledc.h>
+#include <esp_sleep.h>
 
 /*
 TFT pins should be set in path/to/Arduino/libraries/TFT_eSPI/User_Setups/Setup24_ST7789.h
 */
 TFT_eSPI tft = TFT_eSPI();
 
+static FlushStats s_flush_stats;
+static portMUX_TYPE s_flush_mux = portMUX_INITIALIZER_UNLOCKED;
+
 
 
 void my_print(lv_log_level_t level, const char* file, uint32_t line, const char* fun, const char* dsc)
@@ -39,29 +46,72 @@ void my_print(lv_log_level_t level, const char* file, uint32_t line, const char*
 }
 
 
+// LVGL系统tick：直接取esp_timer的微秒计数，不再依赖任务周期手动累加
+static uint32_t my_tick_get(void)
+{
+	return (uint32_t)(esp_timer_get_time() / 1000);
+}
+
+
 void my_disp_flush(lv_display_t* disp, const lv_area_t* area, uint8_t* px_map)
 {
 	uint32_t w = (area->x2 - area->x1 + 1);
 	uint32_t h = (area->y2 - area->y1 + 1);
 
+	int64_t start = esp_timer_get_time();
+
 	tft.startWrite();
 	tft.setAddrWindow(area->x1, area->y1, w, h);
-	tft.pushColors((uint16_t*)px_map, w * h, true);
+	// 原生字节序时缓冲区已是面板需要的高字节在前, 直接发送
+	tft.pushColors((uint16_t*)px_map, w * h, !LCD_NATIVE_BYTE_ORDER);
 	tft.endWrite();
 
+	uint32_t elapsed = (uint32_t)(esp_timer_get_time() - start);
+	portENTER_CRITICAL(&s_flush_mux);
+	s_flush_stats.flushes++;
+	s_flush_stats.pixels += w * h;
+	s_flush_stats.busy_us += elapsed;
+	if (elapsed > s_flush_stats.max_us) {
+		s_flush_stats.max_us = elapsed;
+	}
+	portEXIT_CRITICAL(&s_flush_mux);
+
 	lv_display_flush_ready(disp);
 }
 
 
+Display::Display()
+	: bl_current(1.0f)
+	, bl_from(1.0f)
+	, bl_target(1.0f)
+	, bl_fade_start(0)
+	, bl_fade_ms(0)
+{
+}
+
 void Display::init()
 {
-	// Temporarily disable PWM backlight to avoid GPIO error
-	// ledcSetup(LCD_BL_PWM_CHANNEL, 5000, 8);
-	// ledcAttachPin(LCD_BL_PIN, LCD_BL_PWM_CHANNEL);
-	pinMode(LCD_BL_PIN, OUTPUT);
-	digitalWrite(LCD_BL_PIN, HIGH);
+	// PWM背光, 初始化期间全亮
+	ledcSetup(LCD_BL_PWM_CHANNEL, LCD_BL_PWM_FREQ, LCD_BL_PWM_BITS);
+	ledcAttachPin(LCD_BL_PIN, LCD_BL_PWM_CHANNEL);
+#if CONFIG_PM_ENABLE
+	// APB时钟在自动light sleep时停止, 背光定时器改用RTC8M时钟(通道8对应低速定时器0)
+	ledc_timer_config_t bl_timer = {};
+	bl_timer.speed_mode = LEDC_LOW_SPEED_MODE;
+	bl_timer.duty_resolution = (ledc_timer_bit_t)LCD_BL_PWM_BITS;
+	bl_timer.timer_num = LEDC_TIMER_0;
+	bl_timer.freq_hz = LCD_BL_PWM_FREQ;
+	bl_timer.clk_cfg = LEDC_USE_RTC8M_CLK;
+	if (ledc_timer_config(&bl_timer) == ESP_OK) {
+		esp_sleep_pd_config(ESP_PD_DOMAIN_RTC8M, ESP_PD_OPTION_ON);
+	} else {
+		LOG_WARN("TFT", "Backlight timer stays on APB clock");
+	}
+#endif
+	setBackLight(1.0f);
 
 	lv_init();
+	lv_tick_set_cb(my_tick_get);
 
 	// lv_log_register_print_cb() is deprecated in LVGL 9.x
 
@@ -85,6 +135,10 @@ void Display::init()
 	/* Create the display */
 	lv_display_t* disp = lv_display_create(240, 240);
 	lv_display_set_flush_cb(disp, my_disp_flush);
+#if LCD_NATIVE_BYTE_ORDER
+	// 渲染结果直接为面板字节序; RGB565_SWAPPED格式的小鸟帧按原样拷贝, 普通RGB565图片在混合时交换
+	lv_display_set_color_format(disp, LV_COLOR_FORMAT_RGB565_SWAPPED);
+#endif
 
 	/* Set display buffers - the old draw_buf approach is deprecated */
 	static lv_color_t buf1[240 * 10];
@@ -97,21 +151,138 @@ void Display::init()
 	lv_scr_load(black_scr);
 }
 
-void Display::routine()
+uint32_t Display::routine()
 {
-    // 更新LVGL系统tick，1ms
-    lv_tick_inc(1);
+	// tick由esp_timer提供，这里只需处理LVGL定时器
+	// 返回值为距离下一个LVGL定时器到期的毫秒数
+	return lv_timer_handler();
+}
 
-    // 处理LVGL定时器
-    lv_timer_handler();
+void Display::writeBackLight(float duty)
+{
+	bl_current = duty;
+	ledcWrite(LCD_BL_PWM_CHANNEL, (uint32_t)(duty * LCD_BL_PWM_MAX + 0.5f));
 }
 
 void Display::setBackLight(float duty)
 {
-	// Simple digital backlight control for now
-	if (duty > 0.5) {
-		digitalWrite(LCD_BL_PIN, HIGH);
-	} else {
-		digitalWrite(LCD_BL_PIN, LOW);
+	duty = constrain(duty, 0.0f, 1.0f);
+	bl_target = duty;
+	bl_fade_ms = 0;
+	writeBackLight(duty);
+}
+
+void Display::fadeBackLight(float duty, uint32_t fade_ms)
+{
+	duty = constrain(duty, 0.0f, 1.0f);
+	if (fade_ms == 0) {
+		setBackLight(duty);
+		return;
+	}
+	bl_from = bl_current;
+	bl_target = duty;
+	bl_fade_start = millis();
+	bl_fade_ms = fade_ms;
+}
+
+void Display::updateBackLight()
+{
+	if (bl_fade_ms == 0) {
+		return;
+	}
+
+	uint32_t elapsed = millis() - bl_fade_start;
+	if (elapsed >= bl_fade_ms) {
+		bl_fade_ms = 0;
+		writeBackLight(bl_target);
+		return;
+	}
+
+	// 平滑渐变(smoothstep), 起止处无突变
+	float t = (float)elapsed / bl_fade_ms;
+	t = t * t * (3.0f - 2.0f * t);
+	writeBackLight(bl_from + (bl_target - bl_from) * t);
+}
+
+void Display::setRefreshPeriod(uint32_t period_ms)
+{
+	lv_display_t* disp = lv_display_get_default();
+	lv_timer_t* refr_timer = disp ? lv_display_get_refr_timer(disp) : NULL;
+	if (refr_timer) {
+		lv_timer_set_period(refr_timer, period_ms);
 	}
 }
+
+void Display::sleep()
+{
+	setBackLight(0.0f);
+	tft.writecommand(TFT_SLPIN);
+}
+
+FlushStats Display::getFlushStats() const
+{
+	portENTER_CRITICAL(&s_flush_mux);
+	FlushStats copy = s_flush_stats;
+	portEXIT_CRITICAL(&s_flush_mux);
+	return copy;
+}
+
+void Display::resetFlushStats()
+{
+	portENTER_CRITICAL(&s_flush_mux);
+	memset(&s_flush_stats, 0, sizeof(s_flush_stats));
+	portEXIT_CRITICAL(&s_flush_mux);
+}
+
+void Display::printFlushStats()
+{
+	FlushStats stats = getFlushStats();
+
+	Serial.println("=== Display Flush ===");
+	Serial.printf("Byte order: %s\r\n", LCD_NATIVE_BYTE_ORDER ? "native (RGB565_SWAPPED, no swap on flush)" : "RGB565, swapped on flush");
+	Serial.printf("Flushes: %u, pixels: %u, busy: %u ms\r\n",
+				  stats.flushes, stats.pixels, (uint32_t)(stats.busy_us / 1000));
+	if (stats.pixels > 0) {
+		Serial.printf("Avg: %u us/flush, %u us per 1000 px, max %u us\r\n",
+					  (uint32_t)(stats.busy_us / stats.flushes),
+					  (uint32_t)(stats.busy_us * 1000 / stats.pixels), stats.max_us);
+	}
+}
+
+void Display::benchmarkFlush(uint16_t rounds)
+{
+	const uint32_t w = 240;
+	const uint32_t h = 10;
+	uint16_t* band = (uint16_t*)MemTracker::alloc(MEM_TAG_LVGL, w * h * sizeof(uint16_t));
+	if (!band) {
+		Serial.println("Flush benchmark: out of memory");
+		return;
+	}
+	for (uint32_t i = 0; i < w * h; i++) {
+		band[i] = (uint16_t)(i * 37);
+	}
+
+	// 同一条带分别带/不带字节交换推送, 差值即每像素交换的开销
+	uint32_t elapsed[2];
+	for (int swap = 1; swap >= 0; swap--) {
+		int64_t start = esp_timer_get_time();
+		for (uint16_t r = 0; r < rounds; r++) {
+			tft.startWrite();
+			tft.setAddrWindow(0, 0, w, h);
+			tft.pushColors(band, w * h, swap != 0);
+			tft.endWrite();
+		}
+		elapsed[swap] = (uint32_t)((esp_timer_get_time() - start) / rounds);
+	}
+	MemTracker::free(band);
+
+	int32_t saved = (int32_t)elapsed[1] - (int32_t)elapsed[0];
+	Serial.printf("Flush benchmark (%u rounds, 240x10 band):\r\n", rounds);
+	Serial.printf("  with swap:    %u us/band\r\n", elapsed[1]);
+	Serial.printf("  native order: %u us/band\r\n", elapsed[0]);
+	Serial.printf("  saved:        %d us/band, %d us per 120x120 bird frame, %d us per full screen\r\n",
+				  saved, saved * 6, saved * 24);
+
+	// 测试覆盖了屏幕顶部, 整屏重绘
+	lv_obj_invalidate(lv_screen_active());
+}
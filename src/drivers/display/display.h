@@ -4,18 +4,60 @@
 #include <lvgl.h>
 
 #define LCD_BL_PIN 5
-#define LCD_BL_PWM_CHANNEL 0
+#define LCD_BL_PWM_CHANNEL 8		// 低速通道组(可使用RTC8M时钟, light sleep期间PWM不停)
+#define LCD_BL_PWM_FREQ    5000
+#define LCD_BL_PWM_BITS    10
+#define LCD_BL_PWM_MAX     ((1 << LCD_BL_PWM_BITS) - 1)
+
+// 面板字节序: 1 = LVGL直接按RGB565_SWAPPED(高字节在前)渲染, flush时不再逐像素交换
+#ifndef LCD_NATIVE_BYTE_ORDER
+#define LCD_NATIVE_BYTE_ORDER 1
+#endif
+
+// flush统计(在UI任务的flush回调中累计)
+struct FlushStats {
+	uint32_t flushes;
+	uint32_t pixels;
+	uint64_t busy_us;
+	uint32_t max_us;
+};
 
 
 class Display
 {
 private:
+	// 背光渐变状态(占空比0~1)
+	float bl_current;
+	float bl_from;
+	float bl_target;
+	uint32_t bl_fade_start;
+	uint32_t bl_fade_ms;
 
+	void writeBackLight(float duty);
 
 public:
+	Display();
+
 	void init();
-	void routine();
-	void setBackLight(float);
+	uint32_t routine();	// 处理LVGL定时器，返回下次需要调用的间隔(ms)
+
+	// 背光(LEDC PWM): 立即设置 / 在fade_ms内渐变
+	void setBackLight(float duty);
+	void fadeBackLight(float duty, uint32_t fade_ms);
+	void updateBackLight();	// 推进渐变(在系统任务中周期调用)
+	float getBackLight() const { return bl_current; }
+
+	// LVGL刷新周期(控制SPI刷屏频率), 需持有LVGL锁
+	void setRefreshPeriod(uint32_t period_ms);
+
+	// 关闭背光并让屏幕进入睡眠(深度睡眠前调用), 需持有LVGL锁
+	void sleep();
+
+	// flush耗时统计与字节交换开销测试(benchmarkFlush需持有LVGL锁, 结束后整屏重绘)
+	FlushStats getFlushStats() const;
+	void resetFlushStats();
+	void printFlushStats();
+	void benchmarkFlush(uint16_t rounds);
 };
 
 #endif
\ No newline at end of file
@@ -1,6 +1,17 @@
 #include "rgb_led.h"
+#include "log_manager.h"
 
 
+Pixel::Pixel()
+	: fx_queue(NULL)
+	, show_mutex(NULL)
+	, fx_abort(false)
+	, fx_dropped(0)
+	, current_color(CRGB(0, 0, 0))
+	, current_brightness(0)
+{
+}
+
 void Pixel::init()
 {
 	FastLED.addLeds<WS2812, RGB_LED_PIN, GRB>(color_buffers, RGB_LED_NUM);
@@ -10,13 +21,38 @@ void Pixel::init()
 	for (int i = 0; i < RGB_LED_NUM; i++) {
 		color_buffers[i] = CRGB(0, 0, 0);
 	}
+
+	show_mutex = xSemaphoreCreateMutex();
+	show();
+
+	// 灯效任务
+	fx_queue = xQueueCreate(LED_FX_QUEUE_LEN, sizeof(LedEffect));
+	if (!fx_queue || xTaskCreatePinnedToCore(fxTask, "LedFx", LED_FX_TASK_STACK, this,
+											 LED_FX_TASK_PRIO, NULL, LED_FX_TASK_CORE) != pdPASS) {
+		LOG_ERROR("RGB", "Failed to start LED effect task");
+		if (fx_queue) {
+			vQueueDelete(fx_queue);
+			fx_queue = NULL;
+		}
+	}
+}
+
+void Pixel::show()
+{
+	if (show_mutex) {
+		xSemaphoreTake(show_mutex, portMAX_DELAY);
+	}
 	FastLED.show();
+	if (show_mutex) {
+		xSemaphoreGive(show_mutex);
+	}
 }
 
 Pixel& Pixel::setRGB(int id, int r, int g, int b)
 {
 	color_buffers[id] = CRGB(r, g, b);
-	FastLED.show();
+	current_color = color_buffers[id];
+	show();
 
 	return *this;
 }
@@ -24,33 +60,145 @@ Pixel& Pixel::setRGB(int id, int r, int g, int b)
 Pixel& Pixel::setBrightness(float duty)
 {
 	duty = constrain(duty, 0, 1);
-	FastLED.setBrightness((uint8_t)(255 * duty));
-	FastLED.show();
+	current_brightness = (uint8_t)(255 * duty);
+	FastLED.setBrightness(current_brightness);
+	show();
 
 	return *this;
 }
 
-void Pixel::flash(uint8_t r, uint8_t g, uint8_t b, int duration_ms)
+bool Pixel::play(const LedStep* steps, uint8_t count, uint16_t repeat, bool restore)
 {
-	// 保存当前亮度
-	uint8_t prev_brightness = FastLED.getBrightness();
-	
-	// 设置颜色并点亮
-	FastLED.setBrightness(128); // 中等亮度
-	for (int i = 0; i < RGB_LED_NUM; i++) {
-		color_buffers[i] = CRGB(r, g, b);
+	if (!fx_queue || !steps || count == 0) {
+		return false;
 	}
-	FastLED.show();
-	
-	// 延时
-	delay(duration_ms);
-	
-	// 关闭并恢复原亮度
+
+	LedEffect fx;
+	fx.step_count = count > LED_FX_MAX_STEPS ? LED_FX_MAX_STEPS : count;
+	fx.repeat = repeat;
+	fx.restore = restore;
+	memcpy(fx.steps, steps, sizeof(LedStep) * fx.step_count);
+
+	if (xQueueSend(fx_queue, &fx, 0) != pdTRUE) {
+		fx_dropped++;
+		return false;
+	}
+	return true;
+}
+
+bool Pixel::flash(uint8_t r, uint8_t g, uint8_t b, int duration_ms)
+{
+	// 中等亮度闪一下, 结束后恢复闪烁前的颜色和亮度
+	const LedStep step = { r, g, b, 128, (uint16_t)duration_ms, false };
+	return play(&step, 1, 1, true);
+}
+
+bool Pixel::fadeTo(uint8_t r, uint8_t g, uint8_t b, uint8_t brightness, int duration_ms)
+{
+	const LedStep step = { r, g, b, brightness, (uint16_t)duration_ms, true };
+	return play(&step, 1);
+}
+
+bool Pixel::breathe(uint8_t r, uint8_t g, uint8_t b, int period_ms, uint16_t cycles)
+{
+	const LedStep steps[] = {
+		{ r, g, b, 128, (uint16_t)(period_ms / 2), true },
+		{ r, g, b, 0,   (uint16_t)(period_ms / 2), true },
+	};
+	return play(steps, 2, cycles);
+}
+
+void Pixel::stopEffects()
+{
+	if (!fx_queue) {
+		return;
+	}
+	xQueueReset(fx_queue);
+	fx_abort = true;
+
+	const LedStep off = { 0, 0, 0, 0, 0, false };
+	play(&off, 1);
+}
+
+void Pixel::fxTask(void* param)
+{
+	Pixel* self = static_cast<Pixel*>(param);
+	LedEffect fx;
+
+	while (true) {
+		if (xQueueReceive(self->fx_queue, &fx, portMAX_DELAY) == pdTRUE) {
+			self->fx_abort = false;
+			self->playEffect(fx);
+		}
+	}
+}
+
+void Pixel::playEffect(const LedEffect& fx)
+{
+	CRGB saved_color = current_color;
+	uint8_t saved_brightness = current_brightness;
+
+	bool endless = (fx.repeat == 0);
+	for (uint16_t n = 0; endless || n < fx.repeat; n++) {
+		for (uint8_t i = 0; i < fx.step_count; i++) {
+			if (!runStep(fx.steps[i], endless)) {
+				return;
+			}
+		}
+	}
+
+	if (fx.restore) {
+		render(saved_color, saved_brightness);
+	}
+}
+
+bool Pixel::runStep(const LedStep& step, bool yield_to_queue)
+{
+	CRGB target(step.r, step.g, step.b);
+
+	if (!step.fade || step.duration_ms < LED_FX_FRAME_MS) {
+		render(target, step.brightness);
+		if (step.duration_ms > 0) {
+			// 分帧等待, 以便及时响应中止
+			uint32_t remaining = step.duration_ms;
+			while (remaining > 0) {
+				uint32_t wait = remaining > LED_FX_FRAME_MS ? LED_FX_FRAME_MS : remaining;
+				vTaskDelay(pdMS_TO_TICKS(wait));
+				remaining -= wait;
+				if (fx_abort || (yield_to_queue && uxQueueMessagesWaiting(fx_queue) > 0)) {
+					return false;
+				}
+			}
+		}
+		return true;
+	}
+
+	// 线性渐变
+	CRGB from = current_color;
+	uint8_t from_brightness = current_brightness;
+	uint16_t frames = step.duration_ms / LED_FX_FRAME_MS;
+
+	for (uint16_t f = 1; f <= frames; f++) {
+		fract8 t = (fract8)((uint32_t)f * 255 / frames);
+		render(blend(from, target, t), lerp8by8(from_brightness, step.brightness, t));
+		vTaskDelay(pdMS_TO_TICKS(LED_FX_FRAME_MS));
+		if (fx_abort || (yield_to_queue && uxQueueMessagesWaiting(fx_queue) > 0)) {
+			return false;
+		}
+	}
+	return true;
+}
+
+void Pixel::render(CRGB color, uint8_t brightness)
+{
 	for (int i = 0; i < RGB_LED_NUM; i++) {
-		color_buffers[i] = CRGB(0, 0, 0);
+		color_buffers[i] = color;
 	}
-	FastLED.setBrightness(prev_brightness);
-	FastLED.show();
+	current_color = color;
+	current_brightness = brightness;
+
+	FastLED.setBrightness(brightness);
+	show();
 }
 
 void Pixel::flashBlue(int duration_ms)
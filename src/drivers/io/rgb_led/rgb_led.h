@@ -2,28 +2,87 @@
 #define RGB_H
 
 #include <FastLED.h>
+#include <freertos/FreeRTOS.h>
+#include <freertos/queue.h>
+#include <freertos/semphr.h>
 
 #define RGB_LED_NUM 2
 #define RGB_LED_PIN 27
 
+// 灯效任务参数
+#define LED_FX_QUEUE_LEN   8       // 排队灯效数
+#define LED_FX_MAX_STEPS   8       // 单个灯效最多步数
+#define LED_FX_FRAME_MS    20      // 渐变刷新间隔(50Hz)
+#define LED_FX_TASK_STACK  3072
+#define LED_FX_TASK_PRIO   1
+#define LED_FX_TASK_CORE   1
 
+// 灯效中的一步: 在duration_ms内切换(或渐变)到目标颜色和亮度
+struct LedStep {
+	uint8_t r, g, b;
+	uint8_t brightness;
+	uint16_t duration_ms;
+	bool fade;              // true: 从当前状态线性渐变; false: 立即切换并保持
+};
+
+struct LedEffect {
+	LedStep steps[LED_FX_MAX_STEPS];
+	uint8_t step_count;
+	uint16_t repeat;        // 重复次数, 0表示一直重复直到有新灯效排队
+	bool restore;           // 播放完成后恢复到开始前的颜色和亮度(中止时不恢复)
+};
+
+
+/**
+ * RGB灯及异步灯效
+ *
+ * flash/fadeTo/breathe/play只把灯效放入队列就返回, 由独立的小任务按帧播放,
+ * 调用方(手势处理等)不会被灯效时长阻塞。灯效按顺序播放; 无限重复的灯效
+ * 在有新灯效排队时让出。
+ */
 class Pixel
 {
 private:
 	CRGB color_buffers[RGB_LED_NUM];
-	
-	// 通用闪烁方法
-	void flash(uint8_t r, uint8_t g, uint8_t b, int duration_ms);
+
+	QueueHandle_t fx_queue;
+	SemaphoreHandle_t show_mutex;
+	volatile bool fx_abort;
+	uint32_t fx_dropped;
+
+	// 当前输出状态(渐变起点)
+	CRGB current_color;
+	uint8_t current_brightness;
+
+	static void fxTask(void* param);
+	void playEffect(const LedEffect& fx);
+	bool runStep(const LedStep& step, bool yield_to_queue);
+	void render(CRGB color, uint8_t brightness);
+	void show();
 
 public:
+	Pixel();
+
 	void init();
 
+	// 直接设置(会与正在播放的灯效互相覆盖)
 	Pixel& setRGB(int id, int r, int g, int b);
 	Pixel& setBrightness(float duty);
-	
+
+	// 异步灯效(立即返回, 队列满时丢弃)
+	bool flash(uint8_t r, uint8_t g, uint8_t b, int duration_ms);
+	bool fadeTo(uint8_t r, uint8_t g, uint8_t b, uint8_t brightness, int duration_ms);
+	bool breathe(uint8_t r, uint8_t g, uint8_t b, int period_ms, uint16_t cycles = 0);
+	bool play(const LedStep* steps, uint8_t count, uint16_t repeat = 1, bool restore = false);
+
+	// 清空队列, 中止当前灯效并熄灭
+	void stopEffects();
+
+	uint32_t getDroppedEffects() const { return fx_dropped; }
+
 	// 闪烁效果（非阻塞）
 	void flashBlue(int duration_ms = 100);
 	void flashGreen(int duration_ms = 100);
 };
 
-#endif
\ No newline at end of file
+#endif
@@ -1,7 +1,7 @@
 #include "ambient.h"
 
 
-void Ambient::init(int mode)
+bool Ambient::init(int mode)
 {
 	mMode = mode;
 	switch (mode)
@@ -23,11 +23,18 @@ void Ambient::init(int mode)
 
 	Wire.beginTransmission(ADDRESS_BH1750FVI); //"notify" the matching device
 	Wire.write(mMode);     //set operation mode
-	Wire.endTransmission();
+	present = (Wire.endTransmission() == 0);
+	last_time = millis();
+
+	return present;
 }
 
 unsigned int Ambient::getLux()
 {
+	if (!present) {
+		return 0;
+	}
+
 	if (millis() - last_time > sample_time)
 	{
 		last_time = millis();
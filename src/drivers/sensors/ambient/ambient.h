@@ -23,9 +23,12 @@ private:
 	unsigned int lux[5];
 	long sample_time = 125;
 	long last_time;
+	bool present = false;
 
 public:
-	void init(int mode);
+	// 返回传感器是否应答
+	bool init(int mode);
+	bool isPresent() const { return present; }
 	unsigned int getLux();
 };
 
@@ -0,0 +1,278 @@
+#include "gesture_engine.h"
+#include <string.h>
+
+// 默认规则表(角度单位0.01°)
+// 摆正时: ax≈5000, ay≈-660, az≈18000, 即俯仰约+15°, 横滚约-2°
+// 原加速度阈值换算: 前倾 ax<-10000 ≈ -32°, 后仰 ax>14000 ≈ +48°, 左右倾 |ay|>10000 ≈ ±33°
+// 角度经陀螺仪融合后不受快速晃动影响, 保持时间可比纯加速度计方案短
+static const GestureRule kDefaultRules[] = {
+	// gesture               signal     dir  threshold release hold cooldown flags
+	{ GESTURE_FORWARD_HOLD,  SIG_PITCH, -1,  3000,     2200,   400, 0,       0 },
+	{ GESTURE_BACKWARD_HOLD, SIG_PITCH, +1,  4500,     3800,   400, 0,       0 },
+	{ GESTURE_LEFT_TILT,     SIG_ROLL,  +1,  3000,     2200,   200, 500,     GESTURE_RULE_REPEAT },
+	{ GESTURE_RIGHT_TILT,    SIG_ROLL,  -1,  3000,     2200,   200, 500,     GESTURE_RULE_REPEAT },
+};
+
+static const char* const kGestureNames[GESTURE_TYPE_COUNT] = {
+	"NONE",
+	"FORWARD_TILT",
+	"BACKWARD_TILT",
+	"SHAKE",
+	"DOUBLE_TILT",
+	"LEFT_RIGHT_TILT",
+	"FORWARD_HOLD",
+	"BACKWARD_HOLD",
+	"LEFT_TILT",
+	"RIGHT_TILT",
+};
+
+static inline int32_t iabs(int32_t v)
+{
+	return v < 0 ? -v : v;
+}
+
+static uint32_t isqrt(uint32_t v)
+{
+	uint32_t result = 0;
+	uint32_t bit = 1UL << 30;
+	while (bit > v) {
+		bit >>= 2;
+	}
+	while (bit != 0) {
+		if (v >= result + bit) {
+			v -= result + bit;
+			result = (result >> 1) + bit;
+		} else {
+			result >>= 1;
+		}
+		bit >>= 2;
+	}
+	return result;
+}
+
+// 角度差归一化到(-180°, 180°]
+static inline int32_t wrapCentideg(int32_t a)
+{
+	while (a > 18000) {
+		a -= 36000;
+	}
+	while (a <= -18000) {
+		a += 36000;
+	}
+	return a;
+}
+
+int32_t GestureEngine::atan2Centideg(int32_t y, int32_t x)
+{
+	if (x == 0 && y == 0) {
+		return 0;
+	}
+
+	// 先求第一象限的 atan(min/max), 再按象限展开
+	// atan(z) ≈ 45°·z + 15.64°·z·(1-z), 0 <= z <= 1
+	int32_t ax = iabs(x);
+	int32_t ay = iabs(y);
+	bool swap = ay > ax;
+	int32_t num = swap ? ax : ay;
+	int32_t den = swap ? ay : ax;
+	int32_t z = (int32_t)(((int64_t)num << 15) / den);     // Q15
+	int32_t angle = (4500 * z + (int32_t)(((int64_t)1564 * z * (32768 - z)) >> 15)) >> 15;
+
+	if (swap) {
+		angle = 9000 - angle;
+	}
+	if (x < 0) {
+		angle = 18000 - angle;
+	}
+	return y < 0 ? -angle : angle;
+}
+
+GestureEngine::GestureEngine()
+	: rules_(kDefaultRules)
+	, rule_count_(sizeof(kDefaultRules) / sizeof(kDefaultRules[0]))
+{
+	reset();
+	resetStats();
+}
+
+void GestureEngine::setRules(const GestureRule* rules, uint8_t count)
+{
+	if (!rules || count == 0) {
+		rules_ = kDefaultRules;
+		rule_count_ = sizeof(kDefaultRules) / sizeof(kDefaultRules[0]);
+	} else {
+		rules_ = rules;
+		rule_count_ = count > GESTURE_MAX_RULES ? GESTURE_MAX_RULES : count;
+	}
+	reset();
+}
+
+void GestureEngine::reset()
+{
+	memset(state_, 0, sizeof(state_));
+	memset(lp_q4_, 0, sizeof(lp_q4_));
+	memset(signals_, 0, sizeof(signals_));
+	memset(raw_, 0, sizeof(raw_));
+	filter_primed_ = false;
+	pitch_q8_ = 0;
+	roll_q8_ = 0;
+	last_time_ms_ = 0;
+}
+
+void GestureEngine::resetStats()
+{
+	memset(stats_, 0, sizeof(stats_));
+}
+
+const char* GestureEngine::gestureName(GestureType gesture)
+{
+	return (gesture >= 0 && gesture < GESTURE_TYPE_COUNT) ? kGestureNames[gesture] : "?";
+}
+
+void GestureEngine::updateFilters(const GestureSample& sample)
+{
+	const int32_t in[3] = { sample.ax, sample.ay, sample.az };
+
+	// 首个样本直接作为初值, 避免从0开始的启动瞬态被识别为手势
+	bool first = !filter_primed_;
+	if (first) {
+		for (int i = 0; i < 3; i++) {
+			lp_q4_[i] = in[i] * 16;
+		}
+		filter_primed_ = true;
+	}
+
+	int32_t hp_mag = 0;
+	for (int i = 0; i < 3; i++) {
+		int32_t x_q4 = in[i] * 16;
+		lp_q4_[i] += (x_q4 - lp_q4_[i]) >> LP_SHIFT;
+		int32_t lp = lp_q4_[i] >> 4;
+		signals_[SIG_LP_AX + i] = lp;
+		raw_[SIG_LP_AX + i] = in[i];
+		hp_mag += iabs(in[i] - lp);
+	}
+
+	signals_[SIG_HP_MAG] = hp_mag;
+	raw_[SIG_HP_MAG] = hp_mag;
+
+	updateOrientation(sample, first);
+}
+
+void GestureEngine::updateOrientation(const GestureSample& sample, bool first)
+{
+	// 加速度计角度: pitch = atan2(ax, sqrt(ay²+az²)), roll = atan2(ay, az)
+	int32_t ay = sample.ay;
+	int32_t az = sample.az;
+	int32_t acc_pitch = atan2Centideg(sample.ax, (int32_t)isqrt((uint32_t)(ay * ay) + (uint32_t)(az * az)));
+	int32_t acc_roll = atan2Centideg(ay, az);
+
+	raw_[SIG_PITCH] = acc_pitch;
+	raw_[SIG_ROLL] = acc_roll;
+
+	if (first) {
+		pitch_q8_ = acc_pitch * 256;
+		roll_q8_ = acc_roll * 256;
+	} else {
+		// 陀螺仪积分: 横滚对应gx, 俯仰(ax方向后仰为正)对应-gy
+		// Δ(0.01°·256) = g / 65.5 * dt_ms / 1000 * 100 * 256
+		uint32_t dt = sample.time_ms - last_time_ms_;
+		if (dt > 100) {
+			dt = 100;   // 样本中断过久时不做长时间积分
+		}
+		pitch_q8_ -= (int32_t)sample.gy * (int32_t)dt * 256 / GYRO_LSB_PER_DPS_X10;
+		roll_q8_ += (int32_t)sample.gx * (int32_t)dt * 256 / GYRO_LSB_PER_DPS_X10;
+
+		// 向加速度计角度修正(误差先归一化, 防止横滚在±180°处跳变)
+		pitch_q8_ += (wrapCentideg(acc_pitch - (pitch_q8_ >> 8)) * 256) >> CF_SHIFT;
+		roll_q8_ += (wrapCentideg(acc_roll - (roll_q8_ >> 8)) * 256) >> CF_SHIFT;
+		roll_q8_ = wrapCentideg(roll_q8_ >> 8) * 256 + (roll_q8_ & 0xFF);
+	}
+	last_time_ms_ = sample.time_ms;
+
+	signals_[SIG_PITCH] = pitch_q8_ >> 8;
+	signals_[SIG_ROLL] = roll_q8_ >> 8;
+}
+
+bool GestureEngine::evaluate(uint8_t index, uint32_t now)
+{
+	const GestureRule& rule = rules_[index];
+	RuleState& st = state_[index];
+
+	int32_t value = signals_[rule.signal] * rule.direction;
+	int32_t raw = raw_[rule.signal] * rule.direction;
+
+	// 记录原始信号越阈时间, 用于统计滤波+保持带来的总延迟
+	if (raw > rule.threshold) {
+		if (!st.raw_onset_valid) {
+			st.raw_onset = now;
+			st.raw_onset_valid = true;
+		}
+	} else if (!st.active && raw < rule.release) {
+		st.raw_onset_valid = false;
+	}
+
+	// 滞回: 超过threshold进入, 低于release退出
+	if (!st.active) {
+		if (value > rule.threshold) {
+			st.active = true;
+			st.fired = false;
+			st.active_since = now;
+		}
+		return false;
+	}
+
+	if (value < rule.release) {
+		st.active = false;
+		st.fired = false;
+		st.raw_onset_valid = false;
+		return false;
+	}
+
+	if (st.fired || now - st.active_since < rule.hold_ms) {
+		return false;
+	}
+
+	if (st.has_triggered && now - st.last_trigger < rule.cooldown_ms) {
+		return false;
+	}
+
+	// 触发
+	uint32_t onset = st.raw_onset_valid ? st.raw_onset : st.active_since;
+	uint32_t latency = now - onset;
+
+	GestureStats& stats = stats_[rule.gesture];
+	if (stats.triggers == 0 || latency < stats.latency_min_ms) {
+		stats.latency_min_ms = latency;
+	}
+	if (latency > stats.latency_max_ms) {
+		stats.latency_max_ms = latency;
+	}
+	stats.latency_total_ms += latency;
+	stats.triggers++;
+
+	st.last_trigger = now;
+	st.has_triggered = true;
+
+	if (rule.flags & GESTURE_RULE_REPEAT) {
+		// 重复规则: 继续保持hold_ms后再次触发
+		st.active_since = now;
+		st.raw_onset = now;
+	} else {
+		st.fired = true;
+	}
+	return true;
+}
+
+GestureType GestureEngine::process(const GestureSample& sample)
+{
+	updateFilters(sample);
+
+	// 所有规则都要更新状态, 返回表中第一个触发的手势
+	GestureType result = GESTURE_NONE;
+	for (uint8_t i = 0; i < rule_count_; i++) {
+		if (evaluate(i, sample.time_ms) && result == GESTURE_NONE) {
+			result = rules_[i].gesture;
+		}
+	}
+	return result;
+}
@@ -0,0 +1,132 @@
+#ifndef GESTURE_ENGINE_H
+#define GESTURE_ENGINE_H
+
+// 手势识别引擎 - 纯整数运算, 不依赖Arduino, 可在主机上编译用于离线回放
+// (见 scripts/host_tools/gesture_replay.cpp)
+
+#include <stdint.h>
+
+// 手势类型定义
+enum GestureType {
+	GESTURE_NONE = 0,
+	GESTURE_FORWARD_TILT,    // 向前倾斜
+	GESTURE_BACKWARD_TILT,   // 向后倾斜
+	GESTURE_SHAKE,           // 摇动
+	GESTURE_DOUBLE_TILT,     // 双向倾斜
+	GESTURE_LEFT_RIGHT_TILT, // 左右倾斜
+	GESTURE_FORWARD_HOLD,    // 前倾保持(默认规则400ms)
+	GESTURE_BACKWARD_HOLD,   // 后倾保持(默认规则400ms)
+	GESTURE_LEFT_TILT,       // 左倾
+	GESTURE_RIGHT_TILT,      // 右倾
+	GESTURE_TYPE_COUNT
+};
+
+// 引擎输入样本(原始寄存器值)
+struct GestureSample {
+	uint32_t time_ms;
+	int16_t ax, ay, az;
+	int16_t gx, gy, gz;
+};
+
+// 规则可引用的信号(由滤波器组计算)
+enum GestureSignal {
+	SIG_LP_AX = 0,      // 低通后的加速度
+	SIG_LP_AY,
+	SIG_LP_AZ,
+	SIG_HP_MAG,         // 高通加速度幅值(|hx|+|hy|+|hz|), 用于检测摇动
+	SIG_PITCH,          // 互补滤波俯仰角(0.01°), 后仰为正
+	SIG_ROLL,           // 互补滤波横滚角(0.01°), 左倾为正
+	SIG_COUNT
+};
+
+// 规则标志
+#define GESTURE_RULE_REPEAT 0x01    // 保持期间每隔hold_ms重复触发(否则每次进入只触发一次)
+
+/**
+ * 声明式手势规则
+ * 条件: signal * direction > threshold 进入激活; signal * direction < release 退出(滞回)
+ * 激活持续hold_ms后触发, 触发后cooldown_ms内不再触发
+ */
+struct GestureRule {
+	GestureType gesture;
+	GestureSignal signal;
+	int8_t direction;       // +1: 大于阈值, -1: 小于负阈值
+	int32_t threshold;
+	int32_t release;
+	uint16_t hold_ms;
+	uint16_t cooldown_ms;
+	uint8_t flags;
+};
+
+// 单个手势的延迟统计(从原始信号越过阈值到触发)
+struct GestureStats {
+	uint32_t triggers;
+	uint32_t latency_total_ms;
+	uint32_t latency_max_ms;
+	uint32_t latency_min_ms;
+};
+
+#define GESTURE_MAX_RULES 8
+
+class GestureEngine {
+public:
+	GestureEngine();
+
+	// 使用自定义规则表(nullptr恢复默认规则)
+	void setRules(const GestureRule* rules, uint8_t count);
+
+	// 处理一个样本, 返回本样本触发的手势(多个规则同时触发时返回表中靠前的)
+	GestureType process(const GestureSample& sample);
+
+	void reset();
+
+	int32_t getSignal(GestureSignal signal) const { return signals_[signal]; }
+	const GestureStats& getStats(GestureType gesture) const { return stats_[gesture]; }
+	void resetStats();
+
+	static const char* gestureName(GestureType gesture);
+
+	// 滤波器系数: y += (x - y) >> shift, 100Hz采样下shift=2约为35ms时间常数
+	static const uint8_t LP_SHIFT = 2;
+
+	// 互补滤波: 角度按陀螺仪积分, 每个样本向加速度计角度修正1/2^shift,
+	// 100Hz采样下shift=5约为0.3s时间常数(快速晃动主要由陀螺仪决定, 不会被误认为倾斜)
+	static const uint8_t CF_SHIFT = 5;
+
+	// 陀螺仪灵敏度(±500dps): 65.5 LSB/(°/s)
+	static const int32_t GYRO_LSB_PER_DPS_X10 = 655;
+
+	// 整数atan2, 返回0.01°(-18000..18000), 误差约0.3°
+	static int32_t atan2Centideg(int32_t y, int32_t x);
+
+private:
+	struct RuleState {
+		bool active;                // 滤波后信号处于激活区
+		bool fired;                 // 本次激活已触发(非重复规则)
+		uint32_t active_since;      // 激活开始时间
+		uint32_t raw_onset;         // 原始信号首次越过阈值的时间(用于延迟统计)
+		bool raw_onset_valid;
+		uint32_t last_trigger;
+		bool has_triggered;
+	};
+
+	const GestureRule* rules_;
+	uint8_t rule_count_;
+	RuleState state_[GESTURE_MAX_RULES];
+
+	bool filter_primed_;
+	int32_t lp_q4_[3];              // 低通状态(Q4定点)
+	int32_t pitch_q8_;              // 互补滤波角度状态(0.01° * 256)
+	int32_t roll_q8_;
+	uint32_t last_time_ms_;
+	int32_t signals_[SIG_COUNT];
+	int32_t raw_[SIG_COUNT];        // 未滤波的对应信号(用于记录越阈时间)
+
+	GestureStats stats_[GESTURE_TYPE_COUNT];
+
+	void updateFilters(const GestureSample& sample);
+	void updateOrientation(const GestureSample& sample, bool first);
+	bool evaluate(uint8_t index, uint32_t now);
+};
+
+#endif // GESTURE_ENGINE_H
@@ -1,14 +1,63 @@
 #include "imu.h"
 #include "log_manager.h"
+#include "boot_profiler.h"
+
+#define MPU_ADDR          0x68
+#define MPU_SMPLRT_DIV    0x19
+#define MPU_CONFIG        0x1A
+#define MPU_GYRO_CONFIG   0x1B
+#define MPU_ACCEL_CONFIG  0x1C
+#define MPU_MOT_THR       0x1F
+#define MPU_MOT_DUR       0x20
+#define MPU_FIFO_EN       0x23
+#define MPU_INT_PIN_CFG   0x37
+#define MPU_INT_ENABLE    0x38
+#define MPU_INT_STATUS    0x3A
+#define MPU_ACCEL_XOUT_H  0x3B
+#define MPU_USER_CTRL     0x6A
+#define MPU_PWR_MGMT_1    0x6B
+#define MPU_PWR_MGMT_2    0x6C
+#define MPU_FIFO_COUNTH   0x72
+#define MPU_FIFO_R_W      0x74
+
+#define MPU_FIFO_SIZE        1024   // 硬件FIFO容量(字节)
+#define MPU_FIFO_SAMPLE_SIZE 12     // 加速度6字节 + 陀螺仪6字节
+#define MPU_MAX_BURST        10     // 单次读取样本数(受Wire 128字节缓冲区限制)
 
 bool IMU::initialized = false;
+volatile uint32_t IMU::int_count = 0;
+
+void IRAM_ATTR IMU::onDataReady()
+{
+	int_count++;
+}
 
 void IMU::init()
 {
+	fifo_enabled = false;
+	last_drain_time = 0;
+	fifo_overflows = 0;
+	int_count = 0;
+	ring_head = 0;
+	ring_tail = 0;
+	ring_dropped = 0;
+	sample_tap = nullptr;
+	sample_tap_ctx = nullptr;
+
 	LOG_INFO("IMU", "Starting I2C...");
 	Wire.begin(IMU_I2C_SDA, IMU_I2C_SCL);
-	Wire.setClock(100000); // Reduce clock speed for more reliable communication
-
+	Wire.setClock(IMU_I2C_CLOCK);
+
+#if FAST_BOOT
+	// 快速启动: 只探测MPU6050地址
+	LOG_INFO("IMU", "Probing MPU6050 at 0x68...");
+	Wire.beginTransmission(MPU_ADDR);
+	if (Wire.endTransmission() != 0) {
+		LOG_ERROR("IMU", "No device at 0x68 - MPU may not be connected");
+		initialized = false;
+		return;
+	}
+#else
 	LOG_INFO("IMU", "Scanning I2C bus...");
 	byte error, address;
 	int nDevices = 0;
@@ -30,6 +79,7 @@ void IMU::init()
 	} else {
 		LOG_INFO("IMU", "Found " + String(nDevices) + " I2C device(s)");
 	}
+#endif
 
 	// MPU6050 was found at 0x68, try direct I2C communication
 	LOG_INFO("IMU", "Testing direct I2C communication with MPU6050...");
@@ -55,7 +105,20 @@ void IMU::init()
 			int result = Wire.endTransmission();
 			Serial.printf("  Wake up result: %d\n", result);
 
+#if FAST_BOOT
+			// 轮询PWR_MGMT_1直到SLEEP位清除(最多100ms)
+			uint32_t wake_start = millis();
+			uint8_t pwr = 0x40;
+			while (millis() - wake_start < 100) {
+				if (readRegisters(MPU_PWR_MGMT_1, &pwr, 1) && (pwr & 0x40) == 0) {
+					break;
+				}
+				delay(1);
+			}
+			Serial.printf("  MPU awake after %u ms\n", millis() - wake_start);
+#else
 			delay(100); // Wait for MPU to wake up
+#endif
 
 			// Configure accelerometer
 			Serial.println("  Configuring accelerometer...");
@@ -65,11 +128,21 @@ void IMU::init()
 			result = Wire.endTransmission();
 			Serial.printf("  Accelerometer config result: %d\n", result);
 
+			// 配置FIFO采样(加速度+陀螺仪)
+			Serial.println("  Configuring FIFO sampling...");
+			fifo_enabled = setupFifo();
+			if (fifo_enabled) {
+				Serial.printf("  FIFO enabled: %d Hz, %s\n", IMU_SAMPLE_RATE_HZ,
+							  IMU_INT_PIN >= 0 ? "data-ready interrupt" : "timed drain");
+			} else {
+				Serial.println("  FIFO setup failed, falling back to single reads");
+			}
+
 			Serial.println("  MPU6050 manual initialization complete");
 			initialized = true;
 
 			// 初始化手势检测状态
-			resetGestureState();
+			gesture_engine.reset();
 			Serial.println("  Gesture detection initialized");
 		} else {
 			Serial.printf("  Unexpected WHO_AM_I value: 0x%02X\n", whoami);
@@ -81,50 +154,231 @@ void IMU::init()
 	}
 }
 
-void IMU::update(int interval)
+bool IMU::writeRegister(uint8_t reg, uint8_t value)
+{
+	Wire.beginTransmission(MPU_ADDR);
+	Wire.write(reg);
+	Wire.write(value);
+	return Wire.endTransmission() == 0;
+}
+
+bool IMU::readRegisters(uint8_t reg, uint8_t* buffer, size_t length)
+{
+	Wire.beginTransmission(MPU_ADDR);
+	Wire.write(reg);
+	if (Wire.endTransmission(false) != 0) {
+		return false;
+	}
+
+	if (Wire.requestFrom((uint8_t)MPU_ADDR, (uint8_t)length) != length) {
+		return false;
+	}
+	for (size_t i = 0; i < length; i++) {
+		buffer[i] = Wire.read();
+	}
+	return true;
+}
+
+bool IMU::setupFifo()
+{
+	bool ok = true;
+
+	ok &= writeRegister(MPU_PWR_MGMT_1, 0x01);                          // 时钟源: X轴陀螺仪PLL
+	ok &= writeRegister(MPU_PWR_MGMT_2, 0x00);                          // 退出运动唤醒模式的低功耗循环/待机设置
+	ok &= writeRegister(MPU_CONFIG, 0x03);                              // DLPF 44Hz, 陀螺仪输出1kHz
+	ok &= writeRegister(MPU_SMPLRT_DIV, 1000 / IMU_SAMPLE_RATE_HZ - 1);  // 采样率
+	ok &= writeRegister(MPU_GYRO_CONFIG, 0x08);                         // ±500dps
+	ok &= writeRegister(MPU_ACCEL_CONFIG, 0x00);                        // ±2g
+	if (!ok) {
+		return false;
+	}
+
+	resetFifo();
+	ok &= writeRegister(MPU_FIFO_EN, 0x78);                             // 加速度 + 陀螺仪XYZ
+
+#if IMU_INT_PIN >= 0
+	ok &= writeRegister(MPU_INT_PIN_CFG, 0x10);                         // 读任意寄存器即清除中断
+	ok &= writeRegister(MPU_INT_ENABLE, 0x01);                          // 数据就绪中断
+	pinMode(IMU_INT_PIN, INPUT);
+	attachInterrupt(digitalPinToInterrupt(IMU_INT_PIN), onDataReady, RISING);
+#else
+	ok &= writeRegister(MPU_INT_ENABLE, 0x00);
+#endif
+
+	return ok;
+}
+
+bool IMU::enableMotionWake(uint8_t threshold, uint8_t duration_ms)
 {
 	if (!initialized) {
-		return; // Skip update if MPU is not initialized
+		return false;
+	}
+
+#if IMU_INT_PIN >= 0
+	detachInterrupt(digitalPinToInterrupt(IMU_INT_PIN));
+#endif
+
+	bool ok = true;
+	ok &= writeRegister(MPU_INT_ENABLE, 0x00);
+	ok &= writeRegister(MPU_FIFO_EN, 0x00);
+	ok &= writeRegister(MPU_USER_CTRL, 0x00);
+	ok &= writeRegister(MPU_ACCEL_CONFIG, 0x01);                        // ±2g, 高通滤波5Hz(只对变化敏感)
+	ok &= writeRegister(MPU_MOT_THR, threshold);
+	ok &= writeRegister(MPU_MOT_DUR, duration_ms);
+	ok &= writeRegister(MPU_INT_PIN_CFG, 0x20);                         // 高电平有效, 锁存直到读INT_STATUS
+	ok &= writeRegister(MPU_INT_ENABLE, 0x40);                          // 运动检测中断
+
+	uint8_t status;
+	readRegisters(MPU_INT_STATUS, &status, 1);                          // 清除已锁存的中断
+
+	ok &= writeRegister(MPU_PWR_MGMT_2, 0x47);                          // 5Hz唤醒采样, 陀螺仪XYZ待机
+	ok &= writeRegister(MPU_PWR_MGMT_1, 0x28);                          // CYCLE模式, 关闭温度传感器
+	return ok;
+}
+
+void IMU::resetFifo()
+{
+	writeRegister(MPU_USER_CTRL, 0x00);   // 先关闭FIFO
+	writeRegister(MPU_USER_CTRL, 0x04);   // FIFO_RESET
+	writeRegister(MPU_USER_CTRL, 0x40);   // FIFO_EN
+}
+
+void IMU::pushSample(const ImuSample& sample)
+{
+	if ((uint16_t)(ring_head - ring_tail) >= IMU_RING_SIZE) {
+		// 缓冲区满, 丢弃最旧的样本
+		ring_tail++;
+		ring_dropped++;
+	}
+	ring[ring_head & (IMU_RING_SIZE - 1)] = sample;
+	ring_head++;
+
+	if (sample_tap) {
+		sample_tap(sample, sample_tap_ctx);
+	}
+}
+
+bool IMU::popSample(ImuSample& sample)
+{
+	if (ring_head == ring_tail) {
+		return false;
+	}
+	sample = ring[ring_tail & (IMU_RING_SIZE - 1)];
+	ring_tail++;
+	return true;
+}
+
+void IMU::applySample(const ImuSample& sample)
+{
+	ax = sample.ax;
+	ay = sample.ay;
+	az = sample.az;
+	gx = sample.gx;
+	gy = sample.gy;
+	gz = sample.gz;
+}
+
+void IMU::drainFifo()
+{
+	uint8_t count_buf[2];
+	if (!readRegisters(MPU_FIFO_COUNTH, count_buf, 2)) {
+		return;
 	}
-	Wire.beginTransmission(0x68);
-	Wire.write(0x3B); // Start from ACCEL_XOUT_H
-	int result = Wire.endTransmission(false);
 
-	if (result != 0) {
-		Serial.printf("  I2C transmission error: %d\n", result);
+	uint16_t count = ((uint16_t)count_buf[0] << 8) | count_buf[1];
+	if (count >= MPU_FIFO_SIZE) {
+		// FIFO溢出后数据可能错位, 直接复位
+		fifo_overflows++;
+		resetFifo();
 		return;
 	}
-	Wire.requestFrom(0x68, 6); // Read 6 bytes for accelerometer
 
-	int bytes_received = Wire.available();
+	uint16_t total = count / MPU_FIFO_SAMPLE_SIZE;
+	if (total == 0) {
+		return;
+	}
 
-	if (bytes_received >= 6) {
-		uint8_t data[6];
-		for (int i = 0; i < 6; i++) {
-			data[i] = Wire.read();
+	// FIFO中最后一个样本视为当前时刻, 之前的样本按采样周期向前推算
+	const uint32_t period_ms = 1000 / IMU_SAMPLE_RATE_HZ;
+	uint32_t now = millis();
+	uint8_t data[MPU_FIFO_SAMPLE_SIZE * MPU_MAX_BURST];
+	uint16_t index = 0;
+	ImuSample sample = {};
+
+	while (index < total) {
+		uint16_t burst = total - index;
+		if (burst > MPU_MAX_BURST) {
+			burst = MPU_MAX_BURST;
 		}
 
-		int16_t ax_raw = (data[0] << 8) | data[1];
-		int16_t ay_raw = (data[2] << 8) | data[3];
-		int16_t az_raw = (data[4] << 8) | data[5];
+		// FIFO_R_W不会自动递增地址, 连续读取即依次取出FIFO数据
+		if (!readRegisters(MPU_FIFO_R_W, data, burst * MPU_FIFO_SAMPLE_SIZE)) {
+			resetFifo();
+			break;
+		}
 
-		ax = ax_raw;
-		ay = ay_raw;
-		az = az_raw;
+		for (uint16_t i = 0; i < burst; i++, index++) {
+			const uint8_t* p = data + i * MPU_FIFO_SAMPLE_SIZE;
+			sample.time_ms = now - (total - 1 - index) * period_ms;
+			sample.ax = (int16_t)((p[0] << 8) | p[1]);
+			sample.ay = (int16_t)((p[2] << 8) | p[3]);
+			sample.az = (int16_t)((p[4] << 8) | p[5]);
+			sample.gx = (int16_t)((p[6] << 8) | p[7]);
+			sample.gy = (int16_t)((p[8] << 8) | p[9]);
+			sample.gz = (int16_t)((p[10] << 8) | p[11]);
+			pushSample(sample);
+		}
+	}
 
-		// Simple gyroscope read (optional for basic functionality)
-		gx = 0;
-		gy = 0;
-		gz = 0;
+	if (index > 0) {
+		applySample(sample);
+	}
+}
+
+void IMU::readSingleSample()
+{
+	// 一次读取加速度、温度、陀螺仪共14字节
+	uint8_t data[14];
+	if (!readRegisters(MPU_ACCEL_XOUT_H, data, sizeof(data))) {
+		Serial.println("  Failed to read MPU data");
+		return;
+	}
+
+	ImuSample sample;
+	sample.time_ms = millis();
+	sample.ax = (int16_t)((data[0] << 8) | data[1]);
+	sample.ay = (int16_t)((data[2] << 8) | data[3]);
+	sample.az = (int16_t)((data[4] << 8) | data[5]);
+	sample.gx = (int16_t)((data[8] << 8) | data[9]);
+	sample.gy = (int16_t)((data[10] << 8) | data[11]);
+	sample.gz = (int16_t)((data[12] << 8) | data[13]);
+	pushSample(sample);
+	applySample(sample);
+}
+
+void IMU::update(int interval)
+{
+	if (!initialized) {
+		return; // Skip update if MPU is not initialized
+	}
 
-		// Debug output for MPU data - 用于调试左倾方向
-		static unsigned long last_debug_print = 0;
-		if (millis() - last_debug_print > 1000) { // 每秒打印一次
-			// Serial.printf("MPU: ax=%d, ay=%d, az=%d\n", ax, ay, az);
-			last_debug_print = millis();
+	unsigned long now = millis();
+	bool due = (now - last_drain_time >= IMU_DRAIN_INTERVAL_MS);
+#if IMU_INT_PIN >= 0
+	// 有INT引脚时, 累计到一批样本即读取
+	if (fifo_enabled && int_count >= IMU_BURST_SAMPLES) {
+		due = true;
+	}
+#endif
+
+	if (due) {
+		int_count = 0;
+		last_drain_time = now;
+		if (fifo_enabled) {
+			drainFifo();
+		} else {
+			readSingleSample();
 		}
-	} else {
-		Serial.printf("  Failed to read MPU data, only got %d bytes\n", bytes_received);
 	}
 
 	if (millis() - last_update_time > interval)
@@ -196,171 +450,25 @@ GestureType IMU::detectGesture()
 		return GESTURE_NONE;
 	}
 
-	unsigned long current_time = millis();
-
-	// 检测持续前倾手势（保持1秒）
-	if (isForwardTilt()) {
-		if (forward_hold_start == 0) {
-			// 开始前倾
-			forward_hold_start = current_time;
-			forward_hold_triggered = false;
-		} else if (!forward_hold_triggered && (current_time - forward_hold_start >= 1000)) {
-			// 保持3秒，触发
-			forward_hold_triggered = true;
-			Serial.println("Gesture detected: FORWARD_HOLD (1s)");
-			return GESTURE_FORWARD_HOLD;
-		}
-	} else {
-		// 不再前倾，重置
-		forward_hold_start = 0;
-		forward_hold_triggered = false;
-	}
-	
-	// 检测持续后倾手势（保持1秒）
-	if (isBackwardTilt()) {
-		if (backward_hold_start == 0) {
-			// 开始后倾
-			backward_hold_start = current_time;
-			backward_hold_triggered = false;
-		} else if (!backward_hold_triggered && (current_time - backward_hold_start >= 1000)) {
-			// 保持3秒，触发
-			backward_hold_triggered = true;
-			Serial.println("Gesture detected: BACKWARD_HOLD (1s)");
-			return GESTURE_BACKWARD_HOLD;
+	// 按时间顺序处理所有待处理样本, 检测到手势即返回(剩余样本下次处理)
+	ImuSample sample;
+	while (popSample(sample)) {
+		applySample(sample);
+
+		GestureSample gs;
+		gs.time_ms = sample.time_ms;
+		gs.ax = sample.ax;
+		gs.ay = sample.ay;
+		gs.az = sample.az;
+		gs.gx = sample.gx;
+		gs.gy = sample.gy;
+		gs.gz = sample.gz;
+
+		GestureType gesture = gesture_engine.process(gs);
+		if (gesture != GESTURE_NONE) {
+			return gesture;
 		}
-	} else {
-		// 不再后倾，重置
-		backward_hold_start = 0;
-		backward_hold_triggered = false;
-	}
-	
-	// 检测左倾手势（0.5秒）
-	if (isLeftTilt()) {
-		if (left_tilt_start == 0) {
-			left_tilt_start = current_time;
-		} else if (current_time - left_tilt_start >= 500) {
-			// 保持0.5秒，触发
-			left_tilt_start = 0;
-			Serial.println("Gesture detected: LEFT_TILT");
-			return GESTURE_LEFT_TILT;
-		}
-	} else {
-		left_tilt_start = 0;
-	}
-	
-	// 检测右倾手势（0.5秒）
-	if (isRightTilt()) {
-		if (right_tilt_start == 0) {
-			right_tilt_start = current_time;
-		} else if (current_time - right_tilt_start >= 500) {
-			// 保持0.5秒，触发
-			right_tilt_start = 0;
-			Serial.println("Gesture detected: RIGHT_TILT");
-			return GESTURE_RIGHT_TILT;
-		}
-	} else {
-		right_tilt_start = 0;
 	}
 
 	return GESTURE_NONE;
 }
-
-// 检测摇动手势
-bool IMU::isShaking()
-{
-	// 简单的震动检测：加速度变化率
-	static int16_t last_ax = 0, last_ay = 0, last_az = 0;
-
-	int16_t delta_ax = abs(ax - last_ax);
-	int16_t delta_ay = abs(ay - last_ay);
-	int16_t delta_az = abs(az - last_az);
-
-	last_ax = ax;
-	last_ay = ay;
-	last_az = az;
-
-	// 如果加速度变化很大，认为是摇动
-	if (delta_ax > 8000 || delta_ay > 8000 || delta_az > 8000) {
-		shake_counter++;
-		if (shake_counter > 3) {
-			shake_counter = 0;
-			return true;
-		}
-	} else {
-		shake_counter = 0;
-	}
-
-	return false;
-}
-
-// 检测前倾手势
-bool IMU::isForwardTilt()
-{
-	// 前倾：X轴负值较大（ax < -10000）
-	return (ax < -10000);
-}
-
-// 检测后倾手势
-bool IMU::isBackwardTilt()
-{
-	// 后倾：X轴正值较大（ax > 14000）
-	return (ax > 14000);
-}
-
-// 检测左倾或右倾手势
-bool IMU::isLeftOrRightTilt()
-{
-	// 根据实际测试数据：
-	// 摆正时：ax≈5000,  ay≈-660,   az≈18000
-	// 左倾时：ax≈3000,  ay≈12000,  az≈11000
-	// 右倾时：ax≈?,     ay≈-12000?, az≈?
-	// 
-	// 检测条件：Y轴绝对值大于10000（左倾或右倾）
-	bool is_tilting = (ay > 10000 || ay < -10000);
-	
-	if (is_tilting) {
-		static unsigned long last_tilt_debug = 0;
-		if (millis() - last_tilt_debug > 500) {
-			Serial.printf("Left/Right tilt: ax=%d, ay=%d, az=%d\n", ax, ay, az);
-			last_tilt_debug = millis();
-		}
-	}
-	
-	return is_tilting;
-}
-
-// 检测左倾手势
-bool IMU::isLeftTilt()
-{
-	// 左倾：Y轴正值大于10000
-	return (ay > 10000);
-}
-
-// 检测右倾手势
-bool IMU::isRightTilt()
-{
-	// 右倾：Y轴负值小于-10000
-	return (ay < -10000);
-}
-
-// 重置手势状态
-void IMU::resetGestureState()
-{
-	last_gesture_time = 0;
-	shake_counter = 0;
-	was_forward_tilt = false;
-	was_backward_tilt = false;
-	consecutive_tilt_count = 0;
-	
-	// 重置左右倾相关状态
-	last_tilt_trigger_time = 0;
-	was_tilted = false;
-	
-	// 重置持续手势状态
-	forward_hold_start = 0;
-	backward_hold_start = 0;
-	left_tilt_start = 0;
-	right_tilt_start = 0;
-	forward_hold_triggered = false;
-	backward_hold_triggered = false;
-}
@@ -5,24 +5,34 @@
 #include <I2Cdev.h>
 #include <MPU6050.h>
 #include "lv_port_indev.h"
+#include "gesture_engine.h"
 
 #define IMU_I2C_SDA 32
 #define IMU_I2C_SCL 33
+#define IMU_I2C_CLOCK 400000        // I2C快速模式
 
-// 手势类型定义
-enum GestureType {
-    GESTURE_NONE = 0,
-    GESTURE_FORWARD_TILT,    // 向前倾斜
-    GESTURE_BACKWARD_TILT,   // 向后倾斜
-    GESTURE_SHAKE,           // 摇动
-    GESTURE_DOUBLE_TILT,     // 双向倾斜
-    GESTURE_LEFT_RIGHT_TILT, // 左右倾斜 - 触发小鸟（10秒CD）
-    GESTURE_FORWARD_HOLD,    // 前倾保持3秒
-    GESTURE_BACKWARD_HOLD,   // 后倾保持3秒
-    GESTURE_LEFT_TILT,       // 左倾
-    GESTURE_RIGHT_TILT       // 右倾
+// MPU6050 INT引脚(数据就绪中断), -1表示未连接, 按时间间隔轮询FIFO
+#ifndef IMU_INT_PIN
+#define IMU_INT_PIN -1
+#endif
+
+// FIFO采样配置
+#define IMU_SAMPLE_RATE_HZ 100      // 采样率: 1kHz / (1 + SMPLRT_DIV)
+#define IMU_DRAIN_INTERVAL_MS 50    // FIFO读取间隔(每次约5个样本)
+#define IMU_BURST_SAMPLES 5         // 有INT引脚时, 累计多少个样本后读取一次
+#define IMU_RING_SIZE 64            // 样本环形缓冲区容量(必须为2的幂)
+
+
+// 单个IMU样本(加速度 ±2g: 16384 LSB/g, 陀螺仪 ±500dps: 65.5 LSB/dps)
+struct ImuSample {
+	uint32_t time_ms;
+	int16_t ax, ay, az;
+	int16_t gx, gy, gz;
 };
 
+// 样本回调(在IMU读取FIFO时逐样本调用, 用于录制等)
+typedef void (*ImuSampleTap)(const ImuSample& sample, void* ctx);
+
 extern int32_t encoder_diff;
 extern lv_indev_state_t encoder_state;
 
@@ -37,24 +47,24 @@ private:
 	long  last_update_time;
 	static bool initialized;
 
-	// 手势检测相关变量
-	long last_gesture_time;
-	int shake_counter;
-	bool was_forward_tilt;
-	bool was_backward_tilt;
-	int consecutive_tilt_count;
-	
-	// 左右倾检测相关变量（简化版）
-	unsigned long last_tilt_trigger_time;  // 上次触发时间（用于10秒CD）
-	bool was_tilted;                       // 上一帧是否处于倾斜状态
-	
-	// 持续手势检测相关变量
-	unsigned long forward_hold_start;      // 前倾开始时间
-	unsigned long backward_hold_start;     // 后倾开始时间
-	unsigned long left_tilt_start;         // 左倾开始时间
-	unsigned long right_tilt_start;        // 右倾开始时间
-	bool forward_hold_triggered;           // 前倾保持是否已触发
-	bool backward_hold_triggered;          // 后倾保持是否已触发
+	// FIFO采样
+	bool fifo_enabled;                     // FIFO是否配置成功(失败时退回单次读取)
+	unsigned long last_drain_time;         // 上次读取FIFO的时间
+	uint32_t fifo_overflows;               // FIFO溢出次数
+	static volatile uint32_t int_count;    // INT引脚触发次数(ISR中累加)
+
+	// 样本环形缓冲区(生产者: update, 消费者: detectGesture, 同一任务内调用)
+	ImuSample ring[IMU_RING_SIZE];
+	uint16_t ring_head;
+	uint16_t ring_tail;
+	uint32_t ring_dropped;
+
+	// 手势识别引擎(表驱动, 逐样本处理)
+	GestureEngine gesture_engine;
+
+	// 样本回调
+	ImuSampleTap sample_tap;
+	void* sample_tap_ctx;
 
 public:
 	void init();
@@ -69,18 +79,40 @@ public:
 	int16_t getGyroY();
 	int16_t getGyroZ();
 
-	// 手势检测方法
+	// 手势检测方法(消费环形缓冲区中的所有样本)
 	GestureType detectGesture();
 
+	// 从环形缓冲区取出一个样本
+	bool popSample(ImuSample& sample);
+	uint16_t pendingSamples() const { return (uint16_t)(ring_head - ring_tail); }
+	uint32_t getFifoOverflows() const { return fifo_overflows; }
+	uint32_t getDroppedSamples() const { return ring_dropped; }
+
+	GestureEngine& getGestureEngine() { return gesture_engine; }
+
+	// 设置样本回调(nullptr取消)
+	void setSampleTap(ImuSampleTap tap, void* ctx) { sample_tap = tap; sample_tap_ctx = ctx; }
+
+	bool isInitialized() const { return initialized; }
+
+	// 切换到运动检测唤醒模式(深度睡眠前调用): 关闭FIFO与陀螺仪, 加速度计低功耗循环采样,
+	// 加速度变化超过threshold(2mg/LSB)持续duration_ms后INT引脚输出锁存高电平
+	// 重新调用init()恢复正常采样
+	bool enableMotionWake(uint8_t threshold, uint8_t duration_ms);
+
 private:
-	// 手势检测辅助方法
-	bool isShaking();
-	bool isForwardTilt();
-	bool isBackwardTilt();
-	bool isLeftOrRightTilt();
-	bool isLeftTilt();
-	bool isRightTilt();
-	void resetGestureState();
+	// 寄存器访问
+	bool writeRegister(uint8_t reg, uint8_t value);
+	bool readRegisters(uint8_t reg, uint8_t* buffer, size_t length);
+
+	// FIFO配置与读取
+	bool setupFifo();
+	void resetFifo();
+	void drainFifo();
+	void readSingleSample();
+	void pushSample(const ImuSample& sample);
+	void applySample(const ImuSample& sample);
+	static void IRAM_ATTR onDataReady();
 
 };
 
@@ -0,0 +1,228 @@
+#include "imu_recorder.h"
+#include "log_manager.h"
+
+#define IMU_TRACE_MAGIC   0x494D5552
+#define IMU_TRACE_VERSION 1
+#define RECORDS_PER_SECTOR (IMU_TRACE_SECTOR_SIZE / sizeof(ImuTraceRecord))
+
+static_assert(sizeof(ImuTraceRecord) == 16, "ImuTraceRecord must be 16 bytes");
+static_assert(sizeof(ImuTraceHeader) <= IMU_TRACE_SECTOR_SIZE, "ImuTraceHeader must fit in one sector");
+
+extern IMU mpu;
+
+ImuRecorder imuRecorder;
+
+ImuRecorder::ImuRecorder()
+	: recording(false)
+	, end_time_ms(0)
+	, sector_fill(0)
+	, sectors_written(0)
+	, write_errors(0)
+{
+	memset(&header, 0, sizeof(header));
+}
+
+bool ImuRecorder::start(uint32_t duration_ms)
+{
+	if (recording) {
+		stop();
+	}
+
+	if (!SD.exists(IMU_TRACE_DIR)) {
+		SD.mkdir(IMU_TRACE_DIR);
+	}
+
+	// 每次录制重新创建文件
+	file = SD.open(IMU_TRACE_PATH, FILE_WRITE);
+	if (!file) {
+		LOG_ERROR("IMU_REC", "Failed to create " IMU_TRACE_PATH);
+		return false;
+	}
+
+	memset(&header, 0, sizeof(header));
+	header.magic = IMU_TRACE_MAGIC;
+	header.version = IMU_TRACE_VERSION;
+	header.record_size = sizeof(ImuTraceRecord);
+	header.sample_rate_hz = IMU_SAMPLE_RATE_HZ;
+	header.accel_lsb_per_g = 16384;
+	header.gyro_lsb_per_dps_x10 = 655;
+	header.capacity_records = IMU_TRACE_CAPACITY_SECTORS * RECORDS_PER_SECTOR;
+	header.total_records = 0;
+	header.start_time_ms = millis();
+
+	sector_fill = 0;
+	sectors_written = 0;
+	write_errors = 0;
+
+	if (!writeHeader()) {
+		file.close();
+		LOG_ERROR("IMU_REC", "Failed to write trace header");
+		return false;
+	}
+
+	end_time_ms = duration_ms > 0 ? millis() + duration_ms : 0;
+	recording = true;
+	mpu.setSampleTap(onSample, this);
+
+	LOG_INFO("IMU_REC", "Recording IMU trace to " IMU_TRACE_PATH);
+	return true;
+}
+
+void ImuRecorder::stop()
+{
+	if (!recording) {
+		return;
+	}
+
+	mpu.setSampleTap(nullptr, nullptr);
+	recording = false;
+
+	// 写入最后一个不完整的扇区(剩余部分补0, 由total_records界定有效范围)
+	if (sector_fill > 0) {
+		memset(sector_buf + sector_fill * sizeof(ImuTraceRecord), 0,
+			   IMU_TRACE_SECTOR_SIZE - sector_fill * sizeof(ImuTraceRecord));
+		flushSector();
+	}
+
+	writeHeader();
+	file.close();
+
+	LOG_INFO("IMU_REC", "IMU trace stopped: " + String(header.total_records) + " samples, " +
+			 String(write_errors) + " write errors");
+}
+
+void ImuRecorder::service()
+{
+	if (recording && end_time_ms != 0 && (int32_t)(millis() - end_time_ms) >= 0) {
+		stop();
+	}
+}
+
+uint32_t ImuRecorder::getRemainingMs() const
+{
+	if (!recording || end_time_ms == 0) {
+		return 0;
+	}
+	int32_t left = (int32_t)(end_time_ms - millis());
+	return left > 0 ? (uint32_t)left : 0;
+}
+
+void ImuRecorder::onSample(const ImuSample& sample, void* ctx)
+{
+	static_cast<ImuRecorder*>(ctx)->append(sample);
+}
+
+void ImuRecorder::append(const ImuSample& sample)
+{
+	ImuTraceRecord* rec = reinterpret_cast<ImuTraceRecord*>(sector_buf) + sector_fill;
+	rec->time_ms = sample.time_ms;
+	rec->ax = sample.ax;
+	rec->ay = sample.ay;
+	rec->az = sample.az;
+	rec->gx = sample.gx;
+	rec->gy = sample.gy;
+	rec->gz = sample.gz;
+
+	sector_fill++;
+	header.total_records++;
+
+	// 凑满一个扇区才写SD卡
+	if (sector_fill >= RECORDS_PER_SECTOR) {
+		flushSector();
+		if (sectors_written % IMU_TRACE_HEADER_SYNC == 0) {
+			writeHeader();
+		}
+	}
+}
+
+bool ImuRecorder::flushSector()
+{
+	uint32_t slot = sectors_written % IMU_TRACE_CAPACITY_SECTORS;
+	uint32_t pos = IMU_TRACE_SECTOR_SIZE * (1 + slot);
+
+	bool ok = file.seek(pos) && file.write(sector_buf, IMU_TRACE_SECTOR_SIZE) == IMU_TRACE_SECTOR_SIZE;
+	if (!ok) {
+		write_errors++;
+	}
+
+	sectors_written++;
+	sector_fill = 0;
+	return ok;
+}
+
+bool ImuRecorder::writeHeader()
+{
+	uint8_t sector[IMU_TRACE_SECTOR_SIZE];
+	memset(sector, 0, sizeof(sector));
+	memcpy(sector, &header, sizeof(header));
+
+	bool ok = file.seek(0) && file.write(sector, sizeof(sector)) == sizeof(sector);
+	file.flush();
+	return ok;
+}
+
+bool ImuRecorder::dump(Print& out, uint32_t max_records)
+{
+	if (recording) {
+		out.println("Recording in progress, use 'imu record stop' first");
+		return false;
+	}
+
+	File in = SD.open(IMU_TRACE_PATH, FILE_READ);
+	if (!in) {
+		out.println("No trace file: " IMU_TRACE_PATH);
+		return false;
+	}
+
+	ImuTraceHeader h;
+	if (in.read((uint8_t*)&h, sizeof(h)) != sizeof(h) || h.magic != IMU_TRACE_MAGIC ||
+		h.record_size != sizeof(ImuTraceRecord) || h.capacity_records == 0 ||
+		h.capacity_records % RECORDS_PER_SECTOR != 0) {
+		out.println("Invalid trace file");
+		in.close();
+		return false;
+	}
+
+	// 从写指针(下一条记录在环中的位置)往回取有效记录;
+	// 已循环覆盖时, 停止录制写入的最后一个不完整扇区补了0, 该扇区中写指针之后的旧记录不再有效
+	uint32_t cursor = h.total_records % h.capacity_records;
+	uint32_t valid = h.total_records;
+	if (h.total_records >= h.capacity_records) {
+		uint32_t tail = cursor % RECORDS_PER_SECTOR;
+		valid = h.capacity_records - (tail ? RECORDS_PER_SECTOR - tail : 0);
+	}
+	uint32_t count = valid;
+	if (max_records > 0 && count > max_records) {
+		// 只导出最新的max_records条
+		count = max_records;
+	}
+	uint32_t first = (cursor + h.capacity_records - count) % h.capacity_records;
+
+	out.printf("# imu trace: %u samples @ %u Hz, accel %u LSB/g, gyro %u.%u LSB/dps\r\n",
+			   count, h.sample_rate_hz, h.accel_lsb_per_g,
+			   h.gyro_lsb_per_dps_x10 / 10, h.gyro_lsb_per_dps_x10 % 10);
+	out.println("t_ms,ax,ay,az,gx,gy,gz");
+
+	// 按扇区读取, 减少SD访问次数
+	uint8_t sector[IMU_TRACE_SECTOR_SIZE];
+	uint32_t loaded_slot = UINT32_MAX;
+	for (uint32_t i = 0; i < count; i++) {
+		uint32_t index = (first + i) % h.capacity_records;
+		uint32_t slot = index / RECORDS_PER_SECTOR;
+		if (slot != loaded_slot) {
+			if (!in.seek(IMU_TRACE_SECTOR_SIZE * (1 + slot)) ||
+				in.read(sector, sizeof(sector)) != sizeof(sector)) {
+				out.println("# read error");
+				break;
+			}
+			loaded_slot = slot;
+			yield();
+		}
+
+		const ImuTraceRecord* rec = reinterpret_cast<const ImuTraceRecord*>(sector) + (index % RECORDS_PER_SECTOR);
+		out.printf("%u,%d,%d,%d,%d,%d,%d\r\n", rec->time_ms, rec->ax, rec->ay, rec->az, rec->gx, rec->gy, rec->gz);
+	}
+
+	in.close();
+	return true;
+}
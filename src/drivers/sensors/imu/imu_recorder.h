@@ -0,0 +1,86 @@
+#ifndef IMU_RECORDER_H
+#define IMU_RECORDER_H
+
+#include <Arduino.h>
+#include <SD.h>
+#include "imu.h"
+
+#define IMU_TRACE_DIR            "/imu"
+#define IMU_TRACE_PATH           "/imu/trace.bin"
+#define IMU_TRACE_SECTOR_SIZE    512
+#define IMU_TRACE_CAPACITY_SECTORS 1024     // 512KB, 100Hz下约5.5分钟, 超出后循环覆盖
+#define IMU_TRACE_HEADER_SYNC    16         // 每写入多少个扇区更新一次文件头
+
+/**
+ * 轨迹文件格式 (小端):
+ *   扇区0: ImuTraceHeader, 其余补0
+ *   扇区1..N: 每扇区32条ImuTraceRecord, 按扇区循环写入
+ * total_records记录累计写入条数, 写指针 = total_records % 容量;
+ * 已循环时最后一个不完整扇区补0写入, 有效记录为写指针之前的 容量 - 补0条数 条
+ */
+struct ImuTraceHeader {
+	uint32_t magic;             // 0x494D5552 ("IMUR")
+	uint16_t version;           // 1
+	uint16_t record_size;       // sizeof(ImuTraceRecord)
+	uint16_t sample_rate_hz;
+	uint16_t accel_lsb_per_g;   // 16384 (±2g)
+	uint16_t gyro_lsb_per_dps_x10; // 655 (±500dps)
+	uint16_t reserved0;
+	uint32_t capacity_records;
+	uint32_t total_records;
+	uint32_t start_time_ms;
+	uint32_t reserved[3];
+} __attribute__((packed));
+
+struct ImuTraceRecord {
+	uint32_t time_ms;
+	int16_t ax, ay, az;
+	int16_t gx, gy, gz;
+} __attribute__((packed));
+
+/**
+ * IMU原始样本录制器
+ *
+ * 样本在IMU读取FIFO时通过回调写入内存中的扇区缓冲区,
+ * 凑满一个扇区(32条)才写一次SD卡, 不影响硬件FIFO采样。
+ * 所有方法均在系统任务中调用。
+ */
+class ImuRecorder
+{
+public:
+	ImuRecorder();
+
+	// 开始录制, duration_ms为0表示一直录制直到stop()
+	bool start(uint32_t duration_ms);
+	void stop();
+
+	// 在系统任务中周期调用, 处理录制超时
+	void service();
+
+	bool isRecording() const { return recording; }
+	uint32_t getRecordedCount() const { return header.total_records; }
+	uint32_t getRemainingMs() const;
+
+	// 以CSV导出录制结果(与scripts/host_tools/gesture_replay的输入格式一致)
+	bool dump(Print& out, uint32_t max_records = 0);
+
+private:
+	File file;
+	bool recording;
+	uint32_t end_time_ms;       // 0表示不限时
+	ImuTraceHeader header;
+
+	uint8_t sector_buf[IMU_TRACE_SECTOR_SIZE];
+	uint16_t sector_fill;       // 缓冲区中的记录条数
+	uint32_t sectors_written;
+	uint32_t write_errors;
+
+	static void onSample(const ImuSample& sample, void* ctx);
+	void append(const ImuSample& sample);
+	bool flushSector();
+	bool writeHeader();
+};
+
+extern ImuRecorder imuRecorder;
+
+#endif
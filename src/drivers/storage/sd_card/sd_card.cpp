@@ -1,94 +1,165 @@
 #include "sd_card.h"
 #include "log_manager.h"
-
-
-void SdCard::init()
+#include "boot_profiler.h"
+#include "mem_tracker.h"
+#include <Preferences.h>
+#include <esp_timer.h>
+#include <diskio_impl.h>
+
+// 复位时序: SD规范只要求上电后≥1ms并提供≥74个时钟, 快速启动使用最小值
+#if FAST_BOOT
+#define SD_POWER_UP_DELAY_MS 1
+#define SD_CS_LOW_MS         1
+#define SD_CS_HIGH_MS        1
+#define SD_BUS_SETTLE_MS     1
+#else
+#define SD_POWER_UP_DELAY_MS 500
+#define SD_CS_LOW_MS         100
+#define SD_CS_HIGH_MS        200
+#define SD_BUS_SETTLE_MS     100
+#endif
+
+
+// 挂载频率候选(从高到低)
+static const uint32_t kFreqList[] = {
+	25000000,  // 25MHz - ESP32 SPI最大
+	20000000,  // 20MHz
+	16000000,  // 16MHz
+	12000000,  // 12MHz
+	10000000,  // 10MHz
+	8000000,   // 8MHz
+	5000000,   // 5MHz
+	4000000,   // 4MHz
+	2000000,   // 2MHz
+	1000000    // 1MHz - 最后保底
+};
+static const int kFreqCount = sizeof(kFreqList) / sizeof(kFreqList[0]);
+
+SdCard::SdCard()
+	: sd_spi(nullptr)
+	, mounted(false)
+	, mount_freq(0)
+	, mount_attempts(0)
+	, mount_time_ms(0)
+	, mounted_since_ms(0)
+	, fingerprint(0)
+	, fat_drive(0xFF)
+	, from_profile(false)
+	, probe_scheduled(false)
+	, bench_bytes(0)
+	, bench_kbps(0)
 {
-	LOG_INFO("SD", "Initializing SD card with HSPI...");
-
-	// 延迟以让SD卡稳定（尤其是在烧录后）
-	delay(500);
+}
 
-	// Create HSPI instance with custom MISO pin 26 to avoid GPIO12 boot issue
-	SPIClass* sd_spi = new SPIClass(HSPI); // another SPI
-	
+void SdCard::resetBus()
+{
 	// 【关键】完全复位SD卡和SPI总线
 	pinMode(15, OUTPUT);
 	digitalWrite(15, LOW);  // 先拉低CS强制复位SD卡
-	delay(100);
+	delay(SD_CS_LOW_MS);
 	digitalWrite(15, HIGH); // 拉高CS释放SD卡
-	delay(200);             // 等待SD卡完全复位
-	
+	delay(SD_CS_HIGH_MS);   // 等待SD卡完全复位
+
 	// 初始化SPI总线
 	sd_spi->begin(14, 26, 13, 15); // SCK=14, MISO=26, MOSI=13, SS=15
-	delay(100);
-	
-	// 【新增】发送至少74个时钟脉冲让SD卡进入SPI模式（SD规范要求）
+	delay(SD_BUS_SETTLE_MS);
+
+	// 发送至少74个时钟脉冲让SD卡进入SPI模式（SD规范要求）
 	sd_spi->beginTransaction(SPISettings(400000, MSBFIRST, SPI_MODE0)); // 低速400kHz
 	for (int i = 0; i < 10; i++) {
 		sd_spi->transfer(0xFF); // 发送10字节（80个时钟）
 	}
 	sd_spi->endTransaction();
-	delay(100);
-
-	// 扩展重试机制：测试多个频率找到最佳速度
-	bool mounted = false;
-	const uint32_t freq_list[] = {
-		25000000,  // 25MHz - ESP32 SPI最大
-		20000000,  // 20MHz
-		16000000,  // 16MHz
-		12000000,  // 12MHz
-		10000000,  // 10MHz
-		8000000,   // 8MHz
-		5000000,   // 5MHz
-		4000000,   // 4MHz
-		2000000,   // 2MHz
-		1000000    // 1MHz - 最后保底
-	};
-	const int freq_count = sizeof(freq_list) / sizeof(freq_list[0]);
-	
-	for (int attempt = 0; attempt < freq_count; attempt++)
-	{
-		uint32_t spi_freq = freq_list[attempt];
-		Serial.printf("[SD] Testing %dMHz...\n", spi_freq / 1000000);
-		LOG_INFO("SD", "Testing " + String(spi_freq/1000000) + "MHz...");
-		
-		if (SD.begin(15, *sd_spi, spi_freq)) // SD-Card SS pin is 15
-		{
-			mounted = true;
-			LOG_INFO("SD", "✓✓✓ SUCCESS! Card mounted at " + String(spi_freq/1000000) + "MHz");
-			Serial.printf("[SD] ✓✓✓ SUCCESS! Card mounted at %dMHz\n", spi_freq/1000000);
-			break;
+	delay(SD_BUS_SETTLE_MS);
+}
+
+bool SdCard::tryMount(uint32_t spi_freq)
+{
+	mount_attempts++;
+	Serial.printf("[SD] Testing %dMHz...\n", spi_freq / 1000000);
+	LOG_INFO("SD", "Testing " + String(spi_freq/1000000) + "MHz...");
+
+	// SD库在begin()中占用第一个空闲的FatFs驱动器号并以"<n>:"挂载, 先记下该号
+	BYTE pdrv = 0xFF;
+	if (ff_diskio_get_drive(&pdrv) != ESP_OK) {
+		pdrv = 0xFF;
+	}
+
+	if (SD.begin(15, *sd_spi, spi_freq, SD_MOUNT_POINT)) // SD-Card SS pin is 15
+	{
+		fat_drive = pdrv;
+		LOG_INFO("SD", "✓✓✓ SUCCESS! Card mounted at " + String(spi_freq/1000000) + "MHz");
+		Serial.printf("[SD] ✓✓✓ SUCCESS! Card mounted at %dMHz\n", spi_freq/1000000);
+		return true;
+	}
+
+	// 失败后的完整复位流程
+	Serial.println("[SD] Failed, resetting bus...");
+	SD.end(); // 结束之前的尝试
+	sd_spi->end();                 // 关闭SPI总线
+	delay(SD_BUS_SETTLE_MS);
+	resetBus();
+	return false;
+}
+
+void SdCard::init()
+{
+	LOG_INFO("SD", "Initializing SD card with HSPI...");
+	uint32_t init_start = millis();
+
+	// 延迟以让SD卡稳定（尤其是在烧录后）
+	delay(SD_POWER_UP_DELAY_MS);
+
+	// Create HSPI instance with custom MISO pin 26 to avoid GPIO12 boot issue
+	if (!sd_spi) {
+		sd_spi = new SPIClass(HSPI); // another SPI
+	}
+	resetBus();
+
+	// 读取上次成功的挂载参数(NVS)
+	Preferences prefs;
+	prefs.begin(SD_NVS_NAMESPACE, true);
+	uint32_t saved_freq = prefs.getUInt("freq", 0);
+	uint32_t saved_fp = prefs.getUInt("fp", 0);
+	uint32_t probe_freq = prefs.getUInt("probe", 0);
+	uint32_t ceiling = prefs.getUInt("ceiling", 0);
+	prefs.end();
+
+	mounted = false;
+	from_profile = false;
+	mount_attempts = 0;
+	uint32_t failed_probe = 0;
+
+	// 1. 上次运行稳定后安排的升频尝试
+	if (probe_freq > 0 && tryMount(probe_freq)) {
+		mounted = true;
+		mount_freq = probe_freq;
+		from_profile = true;
+	} else if (probe_freq > 0) {
+		failed_probe = probe_freq;
+	}
+
+	// 2. 上次成功的频率
+	if (!mounted && saved_freq > 0 && tryMount(saved_freq)) {
+		mounted = true;
+		mount_freq = saved_freq;
+		from_profile = true;
+	}
+
+	// 3. 从高到低逐个尝试(跳过已经试过的频率)
+	for (int i = 0; i < kFreqCount && !mounted; i++) {
+		uint32_t spi_freq = kFreqList[i];
+		if (spi_freq == probe_freq || spi_freq == saved_freq) {
+			continue;
 		}
-		
-		// 失败后的完整复位流程
-		if (attempt < freq_count - 1)
-		{
-			Serial.println("[SD] Failed, trying lower speed...");
-			SD.end(); // 结束之前的尝试
-			
-			// 【完全复位】重新初始化SPI总线和SD卡
-			sd_spi->end();                 // 关闭SPI总线
-			delay(100);
-			
-			digitalWrite(15, LOW);         // CS拉低
-			delay(100);
-			digitalWrite(15, HIGH);        // CS拉高
-			delay(200);
-			
-			sd_spi->begin(14, 26, 13, 15); // 重新初始化SPI
-			delay(100);
-			
-			// 再次发送时钟脉冲
-			sd_spi->beginTransaction(SPISettings(400000, MSBFIRST, SPI_MODE0));
-			for (int i = 0; i < 10; i++) {
-				sd_spi->transfer(0xFF);
-			}
-			sd_spi->endTransaction();
-			delay(100);
+		if (tryMount(spi_freq)) {
+			mounted = true;
+			mount_freq = spi_freq;
 		}
 	}
 
+	mount_time_ms = millis() - init_start;
+
 	if (!mounted)
 	{
 		LOG_ERROR("SD", "Card Mount Failed at all speeds!");
@@ -100,10 +171,36 @@ void SdCard::init()
 
 	if (cardType == CARD_NONE)
 	{
+		mounted = false;
 		LOG_WARN("SD", "No SD card attached");
 		return;
 	}
 
+	mounted_since_ms = millis();
+	probe_scheduled = false;
+	fingerprint = computeFingerprint();
+
+	// 保存挂载参数: 换卡后清除升频上限; 升频失败则记为上限, 不再尝试
+	if (fingerprint != saved_fp) {
+		ceiling = 0;
+		LOG_INFO("SD", "New card detected, fingerprint 0x" + String(fingerprint, HEX));
+	}
+	if (failed_probe > 0 && fingerprint == saved_fp) {
+		ceiling = failed_probe;
+		LOG_WARN("SD", "Probe at " + String(failed_probe / 1000000) + "MHz failed, keeping " +
+				 String(mount_freq / 1000000) + "MHz");
+	}
+
+	prefs.begin(SD_NVS_NAMESPACE, false);
+	prefs.putUInt("freq", mount_freq);
+	prefs.putUInt("fp", fingerprint);
+	prefs.putUInt("ceiling", ceiling);
+	prefs.remove("probe");
+	prefs.end();
+
+	LOG_INFO("SD", "Mounted at " + String(mount_freq / 1000000) + "MHz after " + String(mount_attempts) +
+			 " attempt(s), " + String(mount_time_ms) + "ms");
+
 	String cardTypeStr = "UNKNOWN";
 	if (cardType == CARD_MMC)
 	{
@@ -124,6 +221,160 @@ void SdCard::init()
 	LOG_INFO("SD", "SD Card Size: " + String(cardSize) + "MB");
 }
 
+uint32_t SdCard::computeFingerprint()
+{
+	// Arduino SD库不提供CID, 使用卡类型 + 扇区数 + FAT卷序列号作为卡指纹
+	uint32_t hash = 2166136261u;   // FNV-1a
+	uint32_t parts[3] = { SD.cardType(), (uint32_t)SD.numSectors(), 0 };
+
+	uint8_t* sector = static_cast<uint8_t*>(MemTracker::alloc(MEM_TAG_OTHER, 512));
+	if (sector) {
+		uint32_t boot_lba = 0;
+		if (SD.readRAW(sector, 0) && sector[510] == 0x55 && sector[511] == 0xAA) {
+			// MBR: 第一个分区的起始扇区; 无分区表时扇区0即为引导扇区
+			bool is_boot_sector = (sector[0] == 0xEB || sector[0] == 0xE9);
+			if (!is_boot_sector) {
+				boot_lba = sector[0x1C6] | (sector[0x1C7] << 8) | (sector[0x1C8] << 16) | ((uint32_t)sector[0x1C9] << 24);
+			}
+			if (boot_lba == 0 || SD.readRAW(sector, boot_lba)) {
+				// FAT32卷序列号在0x43, FAT12/16在0x27
+				bool fat32 = (sector[0x16] | (sector[0x17] << 8)) == 0;
+				uint32_t off = fat32 ? 0x43 : 0x27;
+				parts[2] = sector[off] | (sector[off + 1] << 8) | (sector[off + 2] << 16) | ((uint32_t)sector[off + 3] << 24);
+			}
+		}
+		MemTracker::free(sector);
+	}
+
+	for (int i = 0; i < 3; i++) {
+		for (int b = 0; b < 4; b++) {
+			hash ^= (parts[i] >> (b * 8)) & 0xFF;
+			hash *= 16777619u;
+		}
+	}
+	return hash;
+}
+
+void SdCard::service()
+{
+	if (!mounted || probe_scheduled || millis() - mounted_since_ms < SD_STABLE_MS) {
+		return;
+	}
+	probe_scheduled = true;
+
+	// 已是最高频率或更高一档曾经失败, 不再升频
+	int index = -1;
+	for (int i = 0; i < kFreqCount; i++) {
+		if (kFreqList[i] == mount_freq) {
+			index = i;
+			break;
+		}
+	}
+	if (index <= 0) {
+		return;
+	}
+
+	uint32_t next_freq = kFreqList[index - 1];
+	Preferences prefs;
+	prefs.begin(SD_NVS_NAMESPACE, false);
+	uint32_t ceiling = prefs.getUInt("ceiling", 0);
+	if (ceiling == 0 || next_freq < ceiling) {
+		// 运行期间不能重新挂载(文件可能正被读取), 下次启动时先尝试更高一档
+		prefs.putUInt("probe", next_freq);
+		LOG_INFO("SD", "Link stable at " + String(mount_freq / 1000000) + "MHz, will probe " +
+				 String(next_freq / 1000000) + "MHz on next boot");
+	}
+	prefs.end();
+}
+
+void SdCard::forgetMountProfile()
+{
+	Preferences prefs;
+	prefs.begin(SD_NVS_NAMESPACE, false);
+	prefs.clear();
+	prefs.end();
+	probe_scheduled = false;
+	mounted_since_ms = millis();
+}
+
+uint32_t SdCard::benchmarkRead(const char* path, uint32_t max_bytes)
+{
+	File file = SD.open(path, FILE_READ);
+	if (!file) {
+		return 0;
+	}
+
+	uint8_t* chunk = static_cast<uint8_t*>(MemTracker::alloc(MEM_TAG_OTHER, SD_BENCH_CHUNK));
+	if (!chunk) {
+		file.close();
+		return 0;
+	}
+
+	uint32_t total = 0;
+	int64_t start = esp_timer_get_time();
+	while (total < max_bytes) {
+		int n = file.read(chunk, SD_BENCH_CHUNK);
+		if (n <= 0) {
+			break;
+		}
+		total += n;
+	}
+	int64_t elapsed_us = esp_timer_get_time() - start;
+
+	MemTracker::free(chunk);
+	file.close();
+
+	bench_bytes = total;
+	bench_kbps = elapsed_us > 0 ? (uint32_t)((uint64_t)total * 1000000 / 1024 / elapsed_us) : 0;
+	return bench_kbps;
+}
+
+void SdCard::printInfo(const char* bench_path)
+{
+	Serial.println("=== SD Card ===");
+	if (!mounted) {
+		Serial.println("Not mounted");
+		return;
+	}
+
+	const char* type = "UNKNOWN";
+	switch (SD.cardType()) {
+		case CARD_MMC:  type = "MMC";  break;
+		case CARD_SD:   type = "SDSC"; break;
+		case CARD_SDHC: type = "SDHC"; break;
+		default: break;
+	}
+
+	Serial.printf("Type: %s, Size: %llu MB, Used: %llu MB\r\n", type,
+				  SD.cardSize() / (1024 * 1024), SD.usedBytes() / (1024 * 1024));
+	Serial.printf("SPI clock: %u MHz (%s), mount attempts: %u, mount time: %u ms\r\n",
+				  mount_freq / 1000000, from_profile ? "from NVS" : "probed",
+				  mount_attempts, mount_time_ms);
+	Serial.printf("Fingerprint: 0x%08X\r\n", fingerprint);
+
+	Preferences prefs;
+	prefs.begin(SD_NVS_NAMESPACE, true);
+	uint32_t probe = prefs.getUInt("probe", 0);
+	uint32_t ceiling = prefs.getUInt("ceiling", 0);
+	prefs.end();
+	if (probe > 0) {
+		Serial.printf("Next boot: probe %u MHz\r\n", probe / 1000000);
+	} else if (ceiling > 0) {
+		Serial.printf("Probe ceiling: %u MHz failed before\r\n", ceiling / 1000000);
+	} else if (!probe_scheduled) {
+		uint32_t up = millis() - mounted_since_ms;
+		Serial.printf("Upward probe after %u s of stable operation\r\n",
+					  up < SD_STABLE_MS ? (SD_STABLE_MS - up) / 1000 : 0);
+	}
+
+	if (bench_path && benchmarkRead(bench_path, SD_BENCH_MAX_BYTES) > 0) {
+		Serial.printf("Read throughput: %u KB/s (%u bytes from %s, %u-byte reads)\r\n",
+					  bench_kbps, bench_bytes, bench_path, SD_BENCH_CHUNK);
+	} else if (bench_path) {
+		Serial.printf("Read throughput: n/a (cannot read %s)\r\n", bench_path);
+	}
+}
+
 
 
 void SdCard::listDir(const char* dirname, uint8_t levels)
@@ -4,15 +4,63 @@
 #include "FS.h"
 #include "SD.h"
 #include "SPI.h"
- 
+
+#define SD_NVS_NAMESPACE   "sdcard"
+#define SD_MOUNT_POINT     "/sd"                // VFS挂载点(POSIX接口访问时使用)
+#define SD_STABLE_MS       (10UL * 60 * 1000)   // 稳定运行多久后安排下次启动升频
+#define SD_BENCH_PATH      "/static/logo.bin"   // `sd info` 默认测速文件
+#define SD_BENCH_CHUNK     4096
+#define SD_BENCH_MAX_BYTES (512UL * 1024)
+
+/**
+ * 挂载参数保存在NVS(命名空间 "sdcard"):
+ *   freq    - 上次成功的SPI频率, 下次启动优先尝试
+ *   fp      - 卡指纹, 换卡后清除升频上限
+ *   probe   - 稳定运行后安排的升频频率, 下次启动最先尝试
+ *   ceiling - 升频失败的频率, 同一张卡不再尝试
+ */
 class SdCard
 {
 private:
 	char buf[128];
 
+	SPIClass* sd_spi;
+	bool mounted;
+	uint32_t mount_freq;
+	uint32_t mount_attempts;
+	uint32_t mount_time_ms;
+	uint32_t mounted_since_ms;
+	uint32_t fingerprint;
+	uint8_t fat_drive;          // FatFs驱动器号(0xFF: 未挂载)
+	bool from_profile;          // 使用NVS中保存的频率挂载
+	bool probe_scheduled;
+	uint32_t bench_bytes;
+	uint32_t bench_kbps;
+
+	void resetBus();
+	bool tryMount(uint32_t spi_freq);
+	uint32_t computeFingerprint();
+
 public:
+	SdCard();
+
 	void init();
 
+	// 在系统任务中周期调用: 链路稳定后安排下次启动尝试更高频率
+	void service();
+
+	bool isMounted() const { return mounted; }
+	uint32_t getMountFrequency() const { return mount_freq; }
+	// 直接调用FatFs接口时的驱动器号, 路径需加前缀"<n>:"; 0xFF表示未挂载
+	uint8_t getFatDrive() const { return mounted ? fat_drive : 0xFF; }
+
+	// 打印挂载信息, bench_path非空时顺序读取该文件测速
+	void printInfo(const char* bench_path);
+	uint32_t benchmarkRead(const char* path, uint32_t max_bytes);
+
+	// 清除NVS中的挂载参数(下次启动重新从高到低探测)
+	void forgetMountProfile();
+
 	void listDir(  const char* dirname, uint8_t levels);
 	void treeDir(const char* dirname, uint8_t levels, const char* prefix = "");
 
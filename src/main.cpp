@@ -15,12 +15,17 @@
 #include "system/commands/serial_commands.h"
 #include "applications/modules/bird_watching/core/bird_watching.h"
 #include "system/tasks/task_manager.h"
+#include "system/profiler/boot_profiler.h"
+#include "system/power/ambient_governor.h"
+#include "system/power/power_manager.h"
+#include "system/fonts/font_manager.h"
 
 /*** Component objects ***/
 Display screen;
 IMU mpu;
 Pixel rgb;
 SdCard tf;
+Ambient ambient;
 Network wifi;
 
 lv_ui guider_ui;
@@ -28,19 +33,81 @@ lv_ui guider_ui;
 /*** Task Manager ***/
 TaskManager* taskManager = nullptr;
 
+static void initScreen()
+{
+    screen.init();
+    screen.setBackLight(0.2);
+}
+
+static void initImu()
+{
+    mpu.init();
+}
+
+#if BOOT_PARALLEL_INIT
+// 启动阶段的一次性初始化任务, 完成后释放信号量并自行删除
+struct BootJob {
+    const char* name;
+    void (*fn)();
+    SemaphoreHandle_t done;
+};
+
+static void bootJobTask(void* param)
+{
+    BootJob* job = static_cast<BootJob*>(param);
+    {
+        BOOT_PHASE(job->name);
+        job->fn();
+    }
+    xSemaphoreGive(job->done);
+    vTaskDelete(NULL);
+}
+
+// 在指定核心上启动初始化任务; 失败时在当前任务中同步执行
+static void startBootJob(BootJob& job, uint32_t stack_size, BaseType_t core)
+{
+    job.done = xSemaphoreCreateBinary();
+    if (job.done && xTaskCreatePinnedToCore(bootJobTask, job.name, stack_size, &job, 1, NULL, core) == pdPASS) {
+        return;
+    }
+
+    LOG_WARN("MAIN", String("Parallel init unavailable, running inline: ") + job.name);
+    if (job.done) {
+        vSemaphoreDelete(job.done);
+        job.done = NULL;
+    }
+    BOOT_PHASE(job.name);
+    job.fn();
+}
+
+static void waitBootJob(BootJob& job)
+{
+    if (job.done) {
+        xSemaphoreTake(job.done, portMAX_DELAY);
+        vSemaphoreDelete(job.done);
+        job.done = NULL;
+    }
+}
+#endif
+
 void setup()
 {
     // 配置看门狗超时时间为10秒（避免图像加载时触发看门狗）
     esp_task_wdt_init(10, true);
     // 初始化串口通信
+    int8_t serialPhase = BootProfiler::begin("serial");
     Serial.begin(115200);
+#if !FAST_BOOT
     delay(1000); // 等待串口稳定
+#endif
 
     // 立即输出标识，不依赖日志系统
     Serial.println("=== CybirdWatching Starting ===");
     Serial.println(FIRMWARE_BANNER);
     Serial.println("Core 0: UI Rendering | Core 1: System Logic");
+#if !FAST_BOOT
     delay(1000);
+#endif
 
     // 初始化日志系统 - 先只用串口输出，等SD卡初始化完成后再启用SD卡
     LogManager* logManager = LogManager::getInstance();
@@ -48,48 +115,95 @@ void setup()
 
     LOG_INFO("MAIN", "=== CybirdWatching Starting ===");
     LOG_INFO("MAIN", FIRMWARE_BANNER);
+#if !FAST_BOOT
     delay(1000);
+#endif
     LOG_INFO("MAIN", "Serial communication OK");
 
+    // 电源管理(读取唤醒原因, 配置动态调频)
+    PowerManager::getInstance()->init();
+
     // 初始化串口命令系统
     SerialCommands* serialCommands = SerialCommands::getInstance();
     serialCommands->initialize();
+    BootProfiler::end(serialPhase);
+
+#if BOOT_PARALLEL_INIT
+    /*** 并行初始化: SD卡(HSPI)在当前任务, 显示屏(VSPI)在Core 0, IMU(I2C)在Core 1 ***/
+    // 三者使用不同的总线, 互不冲突; LVGL在显示任务中初始化, 汇合前其他任务不访问LVGL
+    LOG_INFO("MAIN", "Initializing SD card, screen and MPU in parallel...");
+    BootJob displayJob = { "display", initScreen, NULL };
+    BootJob imuJob = { "imu", initImu, NULL };
+    startBootJob(displayJob, 8192, 0);
+    startBootJob(imuJob, 4096, 1);
 
+    {
+        BOOT_PHASE("sd_card");
+        tf.init();
+    }
+
+    waitBootJob(displayJob);
+    waitBootJob(imuJob);
+    LOG_INFO("MAIN", "SD card, screen and MPU initialized");
+#else
     /*** Init micro SD-Card EARLY (before screen to avoid SPI conflicts) ***/
     LOG_INFO("MAIN", "Initializing SD card...");
-    // 在烧录后添加额外延迟，让硬件稳定
-    delay(500);  // 增加延迟确保供电稳定
-    tf.init();
+    {
+        BOOT_PHASE("sd_card");
+        tf.init();
+    }
     LOG_INFO("MAIN", "SD card initialized");
 
-    // 通知LogManager SD卡已初始化
-    LOG_INFO("MAIN", "Re-initializing log manager with SD card support...");
-    // Use SD card only to keep CLI responses clean
-    // Use 'log cat' command to view full log when needed
-    logManager->setLogOutput(LogManager::OUTPUT_SD_CARD);
-
     /*** Init screen ***/
     LOG_INFO("MAIN", "Initializing screen...");
-    screen.init();
+    {
+        BOOT_PHASE("display");
+        initScreen();
+    }
     LOG_INFO("MAIN", "Screen initialized");
+#endif
 
-    LOG_INFO("MAIN", "Setting backlight...");
-    screen.setBackLight(0.2);
-    LOG_INFO("MAIN", "Backlight set");
+    // 通知LogManager SD卡已初始化(并行初始化时需等所有任务结束后再切换)
+    LOG_INFO("MAIN", "Re-initializing log manager with SD card support...");
+    // Use SD card only to keep CLI responses clean
+    // Use 'log cat' command to view full log when needed
+    logManager->setLogOutput(LogManager::OUTPUT_SD_CARD);
 
     /*** Init LVGL file system ***/
     LOG_INFO("MAIN", "Initializing LVGL file system...");
-    lv_fs_if_init();
+    {
+        BOOT_PHASE("lvgl_fs");
+        lv_fs_if_init();
+    }
     LOG_INFO("MAIN", "LVGL file system initialized");
 
+    /*** Open CJK fonts on SD (字形在绘制时按需读取) ***/
+    if (tf.isMounted()) {
+        BOOT_PHASE("fonts");
+        FontManager::getInstance()->init();
+    }
+
     /*** Init IMU as input device ***/
     LOG_INFO("MAIN", "Initializing LVGL input device...");
     lv_port_indev_init();
     LOG_INFO("MAIN", "LVGL input device initialized");
 
+#if !BOOT_PARALLEL_INIT
     LOG_INFO("MAIN", "Initializing MPU...");
-    mpu.init();
+    {
+        BOOT_PHASE("imu");
+        initImu();
+    }
     LOG_INFO("MAIN", "MPU initialized");
+#endif
+
+    /*** Init ambient light sensor (与IMU共用I2C总线, 需在IMU之后) ***/
+    LOG_INFO("MAIN", "Initializing ambient light sensor...");
+    {
+        BOOT_PHASE("ambient");
+        ambient.init(ONE_TIME_H_RESOLUTION_MODE);
+        AmbientGovernor::getInstance()->init(&ambient);
+    }
 
     /*** Init on-board RGB ***/
     LOG_INFO("MAIN", "Initializing RGB LED...");
@@ -103,11 +217,15 @@ void setup()
 
     /*** Inflate GUI objects ***/
     LOG_INFO("MAIN", "Creating GUI...");
-    setup_ui(&guider_ui);  // 创建UI界面(包括scenes)
+    {
+        BOOT_PHASE("gui");
+        setup_ui(&guider_ui);  // 创建UI界面(包括scenes)
+    }
     LOG_INFO("MAIN", "GUI UI created");
 
     /*** Init Task Manager FIRST (creates LVGL mutex) ***/
     LOG_INFO("MAIN", "Initializing Task Manager...");
+    int8_t tasksPhase = BootProfiler::begin("tasks");
     taskManager = TaskManager::getInstance();
     
     if (!taskManager->initialize()) {
@@ -123,23 +241,29 @@ void setup()
         LOG_ERROR("MAIN", "Failed to start tasks");
         return;
     }
+    BootProfiler::end(tasksPhase);
     LOG_INFO("MAIN", "Dual-core tasks started successfully");
     LOG_INFO("MAIN", "  - Core 0: UI Task (LVGL + Display + Animation)");
     LOG_INFO("MAIN", "  - Core 1: System Task (Sensors + Commands + Business Logic)");
 
     // ⚠️ 重要：先加载并显示logo（在扫描资源之前）
     LOG_INFO("MAIN", "Loading and displaying logo...");
-    lv_init_gui();  // 尝试加载logo(如果SD卡可用),否则显示小鸟界面
+    {
+        BOOT_PHASE("logo");
+        lv_init_gui();  // 尝试加载logo(如果SD卡可用),否则显示小鸟界面
+    }
     LOG_INFO("MAIN", "Logo displayed, starting to scan bird resources...");
 
     /*** Init Bird Watching System (扫描小鸟资源期间logo持续显示) ***/
     LOG_INFO("MAIN", "Initializing Bird Watching System (scanning bird resources)...");
     // 传入scenes给BirdManager作为显示对象（统计界面的父对象）
+    int8_t birdPhase = BootProfiler::begin("bird_scan");
     if (BirdWatching::initializeBirdWatching(guider_ui.scenes)) {
         LOG_INFO("MAIN", "Bird Watching System initialized successfully");
     } else {
         LOG_ERROR("MAIN", "Failed to initialize Bird Watching System");
     }
+    BootProfiler::end(birdPhase);
     LOG_INFO("MAIN", "Bird resources scan completed");
     
     // 扫描完成后立即关闭logo，显示小鸟界面
@@ -148,9 +272,16 @@ void setup()
     LOG_INFO("MAIN", "Logo closed, bird interface ready");
 
     LOG_INFO("MAIN", "Setup completed, tasks running...");
-    
+    BootProfiler::finish();
+    PowerManager::getInstance()->markReady();
+
+    // 打印启动时间线(之后可用 `task boot` 再次查看)
+    BootProfiler::printTimeline();
+
     // 打印任务统计信息
+#if !FAST_BOOT
     delay(2000);
+#endif
     taskManager->printTaskStats();
 }
 
@@ -158,7 +289,7 @@ void loop()
 {
     // 在双核架构下，主loop可以空闲或处理其他低优先级任务
     // 所有核心功能已经在FreeRTOS任务中运行：
-    // - Core 0: UI Task (200Hz - LVGL + Display)
+    // - Core 0: UI Task (事件驱动 - LVGL + Display)
     // - Core 1: System Task (100Hz - Sensors + Commands + Business Logic)
     
     // 可选：定期打印任务统计信息
@@ -178,8 +309,11 @@ void loop()
 
             // 触发一次小鸟动画以测试任务间通信
             LOG_INFO("TASK_LOOP", "Triggering bird animation");
-            TaskMessage msg;
-            msg.type = MSG_TRIGGER_BIRD;
+            BirdTriggerMsg msg;
+            msg.bird_id = 0;
+            msg.trigger_type = BirdWatching::TRIGGER_AUTO;
+            msg.record_stats = true;
+            msg.request_ms = millis();
             taskManager->sendToUITask(msg);
         }
         lastStatsTime = currentTime;
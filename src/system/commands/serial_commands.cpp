@@ -2,12 +2,35 @@
 #include "serial_commands.h"
 #include "log_manager.h"
 #include "system/tasks/task_manager.h"
+#include "system/profiler/profiler.h"
+#include "system/profiler/boot_profiler.h"
+#include "system/memory/mem_tracker.h"
 #include "config/version.h"
+#include "drivers/display/display.h"
+#include "drivers/sensors/imu/imu.h"
+#include "drivers/sensors/imu/imu_recorder.h"
+#include "drivers/storage/sd_card/sd_card.h"
+#include "system/fonts/font_manager.h"
+#include "system/power/ambient_governor.h"
+#include "system/power/power_manager.h"
+#include "applications/modules/bird_watching/core/frame_cache.h"
+#include "applications/modules/bird_watching/core/bird_transition.h"
+#include "applications/modules/bird_watching/core/favourite_store.h"
+#include "applications/modules/bird_watching/core/bird_bundle_loader.h"
+
+// 外部对象引用(在main.cpp中定义)
+extern IMU mpu;
+extern Display screen;
 
 // 前向声明Bird Watching便捷函数
 namespace BirdWatching {
     bool triggerBird(uint16_t bird_id = 0);
     void listBirds();
+    void benchmarkBundle(uint16_t bird_id);
+    void printTriggerLatency();
+    void resetTriggerLatency();
+    void setWarmStart(bool enabled);
+    void setFadeSteps(uint8_t steps);
     bool isBirdManagerInitialized();
     bool isAnimationPlaying();
 }
@@ -24,6 +47,7 @@ SerialCommands::SerialCommands() {
 SerialCommands* SerialCommands::getInstance() {
     if (instance == nullptr) {
         instance = new SerialCommands();
+        MemTracker::adjust(MEM_TAG_SERIAL, sizeof(SerialCommands));
     }
     return instance;
 }
@@ -38,8 +62,14 @@ void SerialCommands::initialize() {
     registerCommand("clear", "Clear terminal screen");
     registerCommand("tree", "Show SD card directory tree structure [path] [levels]");
     registerCommand("bird", "Bird watching commands (trigger, stats, help)");
-    registerCommand("task", "Task monitoring commands (stats, info)");
+    registerCommand("task", "Task monitoring commands (stats, info, top, bus)");
     registerCommand("file", "File transfer commands (upload, download, delete, info)");
+    registerCommand("mem", "Memory usage by subsystem (history, reset)");
+    registerCommand("imu", "IMU sampling, gesture statistics and trace recording (stats, reset, record, dump)");
+    registerCommand("sd", "SD card mount clock, fingerprint and read throughput (info, forget)");
+    registerCommand("backlight", "Backlight and ambient light status (auto, <0-100>)");
+    registerCommand("power", "Power state, time in state and wake latency (idle, sleep, timeouts)");
+    registerCommand("font", "SD card fonts and glyph cache statistics (clear, reset)");
 
     LOG_INFO("CMD", "Serial command system initialized");
     Serial.println("Serial command system ready. Type 'help' for available commands.");
@@ -65,6 +95,9 @@ void SerialCommands::handleInput() {
 
         LOG_DEBUG("CMD", "Received command: " + input);
 
+        // 串口操作视为用户活动(空闲时恢复正常刷新)
+        PowerManager::getInstance()->notifyActivity();
+
         // 解析命令和参数
         String command = input;
         String param = "";
@@ -106,6 +139,30 @@ void SerialCommands::handleInput() {
             handleFileCommand(param);
             commandFound = true;
         }
+        else if (command.equals("mem")) {
+            handleMemCommand(param);
+            commandFound = true;
+        }
+        else if (command.equals("imu")) {
+            handleImuCommand(param);
+            commandFound = true;
+        }
+        else if (command.equals("sd")) {
+            handleSdCommand(param);
+            commandFound = true;
+        }
+        else if (command.equals("backlight")) {
+            handleBacklightCommand(param);
+            commandFound = true;
+        }
+        else if (command.equals("power")) {
+            handlePowerCommand(param);
+            commandFound = true;
+        }
+        else if (command.equals("font")) {
+            handleFontCommand(param);
+            commandFound = true;
+        }
 
         if (!commandFound) {
             Serial.println("Unknown command: " + command);
@@ -123,6 +180,7 @@ void SerialCommands::handleLogCommand(const String& param) {
             logManager->logToSDOnly(LogManager::LM_LOG_INFO, "CMD", "Showing last 20 lines of log:");
         }
         String logContent = logManager->getLogContent(20);
+        MemCharge charge(MEM_TAG_SERIAL, logContent.length() + 1);
         Serial.print(logContent); // 使用 print 避免额外换行
         Serial.println("<<<RESPONSE_END>>>");
     }
@@ -149,6 +207,7 @@ void SerialCommands::handleLogCommand(const String& param) {
         if (lines > 0 && lines <= 500) {
             Serial.println("<<<RESPONSE_START>>>");
             String logContent = logManager->getLogContent(lines);
+            MemCharge charge(MEM_TAG_SERIAL, logContent.length() + 1);
             Serial.print(logContent); // 使用 print 避免额外换行
             Serial.println("<<<RESPONSE_END>>>");
             if (logManager) {
@@ -336,6 +395,19 @@ void SerialCommands::handleBirdCommand(const String& param) {
         Serial.println("  stats        - Show bird watching statistics");
         Serial.println("  status       - Show bird watching system status");
         Serial.println("  reset        - Reset bird watching statistics and save to file");
+        Serial.println("  bench <id>   - Read all frames of a bundle, raw sector vs FAT frames/s");
+        Serial.println("  cache        - Frame cache hit rate, resident bytes and SD bytes saved");
+        Serial.println("  cache clear  - Evict all cached frames not on screen");
+        Serial.println("  cache reset  - Reset frame cache statistics");
+        Serial.println("  cache budget <KB> - Set frame cache budget");
+        Serial.println("  fav          - Flash favourites: stored bundles, play counts, sync progress");
+        Serial.println("  fav add <id> - Copy a bird's bundle to flash in the background");
+        Serial.println("  fav remove <id> - Drop a bird from flash favourites");
+        Serial.println("  fav clear    - Drop all favourites and play counts");
+        Serial.println("  latency      - Trigger to first pixel latency (cold / warm start)");
+        Serial.println("  latency reset - Reset latency statistics");
+        Serial.println("  warm on|off  - Preload the next random bird while playing");
+        Serial.println("  fade <steps> - Cross-fade steps when switching birds (0: cut, 20ms each)");
         Serial.println("  help         - Show this help");
         Serial.println("Examples:");
         Serial.println("  bird trigger      - Trigger a random bird");
@@ -344,6 +416,8 @@ void SerialCommands::handleBirdCommand(const String& param) {
         Serial.println("  bird stats        - Show statistics");
         Serial.println("  bird status       - Show system status");
         Serial.println("  bird reset        - Reset all statistics");
+        Serial.println("  bird bench 1001   - Benchmark bundle reads of bird 1001");
+        Serial.println("  bird cache budget 96 - Allow 96 KB of cached frames");
     }
     else if (param.equals("trigger") || param.startsWith("trigger ")) {
         uint16_t bird_id = 0;
@@ -375,6 +449,110 @@ void SerialCommands::handleBirdCommand(const String& param) {
             Serial.println("Failed to trigger bird. Check if system is initialized or bird ID exists.");
         }
     }
+    else if (param.startsWith("bench ")) {
+        String id_str = param.substring(6);
+        id_str.trim();
+        uint16_t bird_id = id_str.toInt();
+        if (bird_id > 0) {
+            BirdWatching::benchmarkBundle(bird_id);
+        } else {
+            Serial.println("Invalid bird ID: " + id_str);
+        }
+    }
+    else if (param.equals("cache") || param.startsWith("cache ")) {
+        // 帧缓存只在UI任务中修改, 访问前持有LVGL锁
+        BirdWatching::FrameCache* cache = BirdWatching::FrameCache::getInstance();
+        TaskManager* taskMgr = TaskManager::getInstance();
+        if (!taskMgr->takeLVGLMutex(500)) {
+            Serial.println("LVGL busy, try again");
+        } else {
+            if (param.equals("cache")) {
+                cache->printStats();
+            } else if (param.equals("cache clear")) {
+                uint32_t freed = cache->evictAll();
+                Serial.println("Frame cache cleared, freed " + String(freed / 1024) + " KB");
+            } else if (param.equals("cache reset")) {
+                cache->resetStats();
+                Serial.println("Frame cache statistics reset");
+            } else if (param.startsWith("cache budget ")) {
+                int kb = param.substring(13).toInt();
+                if (kb >= 0 && kb <= 1024) {
+                    cache->setBudget((uint32_t)kb * 1024);
+                    Serial.println("Frame cache budget: " + String(kb) + " KB (applies from the next bird)");
+                } else {
+                    Serial.println("Budget must be 0-1024 KB");
+                }
+            } else {
+                Serial.println("Unknown cache subcommand, use 'bird help'");
+            }
+            taskMgr->giveLVGLMutex();
+        }
+    }
+    else if (param.equals("fav") || param.startsWith("fav ")) {
+        // 收藏库只在UI任务中修改, 访问前持有LVGL锁
+        BirdWatching::FavouriteStore* store = BirdWatching::FavouriteStore::getInstance();
+        TaskManager* taskMgr = TaskManager::getInstance();
+        if (!taskMgr->takeLVGLMutex(500)) {
+            Serial.println("LVGL busy, try again");
+        } else {
+            if (param.equals("fav")) {
+                store->printStatus();
+            } else if (!store->isAvailable()) {
+                Serial.println("No favourites partition (flash with partitions.csv)");
+            } else if (param.startsWith("fav add ")) {
+                uint16_t bird_id = param.substring(8).toInt();
+                if (bird_id > 0) {
+                    store->requestSync(bird_id);
+                    Serial.println("Bird " + String(bird_id) + " queued for flash sync, see 'bird fav'");
+                } else {
+                    Serial.println("Invalid bird ID");
+                }
+            } else if (param.startsWith("fav remove ")) {
+                uint16_t bird_id = param.substring(11).toInt();
+                Serial.println(store->remove(bird_id) ? "Bird " + String(bird_id) + " removed from favourites"
+                                                      : String("Not in favourites or currently playing"));
+            } else if (param.equals("fav clear")) {
+                store->clear();
+                Serial.println("Favourites cleared (the playing bird is kept)");
+            } else {
+                Serial.println("Unknown fav subcommand, use 'bird help'");
+            }
+            taskMgr->giveLVGLMutex();
+        }
+    }
+    else if (param.equals("latency")) {
+        BirdWatching::printTriggerLatency();
+    }
+    else if (param.equals("latency reset")) {
+        BirdWatching::resetTriggerLatency();
+        Serial.println("Trigger latency statistics reset");
+    }
+    else if (param.equals("warm on") || param.equals("warm off")) {
+        bool enabled = param.equals("warm on");
+        TaskManager* taskMgr = TaskManager::getInstance();
+        if (taskMgr->takeLVGLMutex(500)) {
+            BirdWatching::setWarmStart(enabled);
+            taskMgr->giveLVGLMutex();
+            Serial.println(String("Warm start ") + (enabled ? "enabled" : "disabled"));
+        } else {
+            Serial.println("LVGL busy, try again");
+        }
+    }
+    else if (param.startsWith("fade ")) {
+        int steps = param.substring(5).toInt();
+        if (steps < 0 || steps > BIRD_FADE_MAX_STEPS) {
+            Serial.println("Invalid steps (0-" + String(BIRD_FADE_MAX_STEPS) + ")");
+        } else {
+            TaskManager* taskMgr = TaskManager::getInstance();
+            if (taskMgr->takeLVGLMutex(500)) {
+                BirdWatching::setFadeSteps((uint8_t)steps);
+                taskMgr->giveLVGLMutex();
+                Serial.println("Cross-fade steps set to " + String(steps));
+            } else {
+                Serial.println("LVGL busy, try again");
+            }
+        }
+    }
     else if (param.equals("list")) {
         Serial.println("=== Available Birds ===");
         BirdWatching::listBirds();
@@ -399,10 +577,74 @@ void SerialCommands::handleTaskCommand(const String& param) {
         Serial.println("Task monitoring subcommands:");
         Serial.println("  stats      - Show task statistics (stack usage, heap)");
         Serial.println("  info       - Show detailed task information");
+        Serial.println("  top [ms]   - Refresh per-task/per-section CPU usage (default 2000ms)");
+        Serial.println("  top once   - Print CPU usage once");
+        Serial.println("  top off    - Stop refreshing");
+        Serial.println("  top reset  - Reset section statistics");
+        Serial.println("  bus        - Show message bus statistics");
+        Serial.println("  bus reset  - Reset message bus statistics");
+        Serial.println("  boot       - Show boot timeline (per init phase)");
+        Serial.println("  flush      - Show display flush time (byte order, us per 1000 px)");
+        Serial.println("  flush bench- Measure flush time saved by native byte order");
+        Serial.println("  flush reset- Reset flush statistics");
         Serial.println("  help       - Show this help");
         Serial.println("Examples:");
         Serial.println("  task stats  - Show task statistics");
         Serial.println("  task info   - Show detailed info");
+        Serial.println("  task top    - Show where CPU time goes every 2s");
+        Serial.println("  task bus    - Show queue depth, drops and latency");
+    }
+    else if (param.startsWith("top")) {
+        Profiler* profiler = Profiler::getInstance();
+        String arg = param.substring(3);
+        arg.trim();
+
+        if (arg.equals("off")) {
+            profiler->setRefreshInterval(0);
+            Serial.println("Task top stopped");
+        } else if (arg.equals("once")) {
+            profiler->printTop();
+        } else if (arg.equals("reset")) {
+            profiler->reset();
+            Serial.println("Profiler statistics reset");
+        } else {
+            uint32_t interval = arg.isEmpty() ? 2000 : (uint32_t)arg.toInt();
+            if (interval < 500) {
+                interval = 500;
+            }
+            profiler->printTop();
+            profiler->setRefreshInterval(interval);
+            Serial.printf("Refreshing every %u ms, use 'task top off' to stop\r\n", interval);
+        }
+    }
+    else if (param.equals("bus") || param.equals("bus reset")) {
+        TaskManager* taskMgr = TaskManager::getInstance();
+        if (param.equals("bus reset")) {
+            taskMgr->resetBusStats();
+            Serial.println("Message bus statistics reset");
+        } else {
+            taskMgr->printBusStats();
+        }
+    }
+    else if (param.equals("boot")) {
+        BootProfiler::printTimeline();
+    }
+    else if (param.equals("flush")) {
+        screen.printFlushStats();
+    }
+    else if (param.equals("flush reset")) {
+        screen.resetFlushStats();
+        Serial.println("Flush statistics reset");
+    }
+    else if (param.equals("flush bench")) {
+        // 测试期间持有LVGL锁, UI任务不会同时刷屏
+        TaskManager* taskMgr = TaskManager::getInstance();
+        if (taskMgr->takeLVGLMutex(500)) {
+            screen.benchmarkFlush(50);
+            taskMgr->giveLVGLMutex();
+        } else {
+            Serial.println("LVGL busy, try again");
+        }
     }
     else if (param.equals("stats") || param.equals("info")) {
         Serial.println("=== Dual-Core Task Monitor ===");
@@ -411,18 +653,21 @@ void SerialCommands::handleTaskCommand(const String& param) {
         if (taskMgr) {
             Serial.println("\n--- Architecture ---");
             Serial.println("Core 0 (Protocol Core):  UI Task");
-            Serial.println("  - LVGL GUI (200Hz)");
+            Serial.println("  - LVGL GUI (event-driven)");
             Serial.println("  - Display Driver");
             Serial.println("  - Bird Animation");
             Serial.println("");
             Serial.println("Core 1 (Application Core): System Task");
-            Serial.println("  - IMU Sensors (5Hz)");
+            Serial.println("  - IMU Sensors (100Hz FIFO)");
             Serial.println("  - Serial Commands");
             Serial.println("  - Bird Manager Logic");
             Serial.println("  - Statistics");
             
             Serial.println("\n--- Task Statistics ---");
             taskMgr->printTaskStats();
+
+            Serial.println("\n--- Message Bus ---");
+            taskMgr->printBusStats();
             
             if (param.equals("info")) {
                 Serial.println("\n--- FreeRTOS Info ---");
@@ -510,6 +755,30 @@ void SerialCommands::handleFileCommand(const String& param) {
     }
 }
 
+bool SerialCommands::evictCachedBird(const String& path) {
+    // 只有/birds/<id>/下的文件属于某只小鸟
+    if (!path.startsWith("/birds/")) {
+        return true;
+    }
+    int bird_id = path.substring(7).toInt();
+    if (bird_id <= 0 || bird_id > 0xFFFF) {
+        return true;
+    }
+
+    // 帧缓存只在UI任务中修改, 访问前持有LVGL锁
+    TaskManager* taskMgr = TaskManager::getInstance();
+    if (!taskMgr->takeLVGLMutex(1000)) {
+        Serial.println("ERROR: LVGL busy, try again");
+        return false;
+    }
+    uint32_t freed = BirdWatching::FrameCache::getInstance()->evictBird((uint16_t)bird_id);
+    taskMgr->giveLVGLMutex();
+    if (freed) {
+        LOG_INFO("CMD", "Dropped " + String(freed / 1024) + " KB of cached frames for bird " + String(bird_id));
+    }
+    return true;
+}
+
 void SerialCommands::handleFileUpload(const String& path) {
     if (!logManager || !logManager->isSDCardAvailable()) {
         Serial.println("ERROR: SD card not available");
@@ -570,6 +839,11 @@ void SerialCommands::handleFileUpload(const String& path) {
     }
 
     // 打开文件准备写入
+    // 覆盖已有文件会改变其簇链, 正在直读扇区的bundle加载器须先放弃映射; 该小鸟缓存的旧帧也要丢弃
+    if (!evictCachedBird(path)) {
+        return;
+    }
+    BirdWatching::BirdBundleLoader::invalidateExtentMaps();
     File file = SD.open(path, FILE_WRITE);
     if (!file) {
         Serial.println("ERROR: Failed to create file: " + path);
@@ -692,6 +966,10 @@ void SerialCommands::handleFileDelete(const String& path) {
         return;
     }
 
+    if (!evictCachedBird(path)) {
+        return;
+    }
+    BirdWatching::BirdBundleLoader::invalidateExtentMaps();
     if (SD.remove(path)) {
         Serial.println("SUCCESS: File deleted: " + path);
     } else {
@@ -770,4 +1048,293 @@ size_t SerialCommands::base64Decode(const String& input, uint8_t* output, size_t
     }
 
     return outLen;
-}
\ No newline at end of file
+}
+
+void SerialCommands::handleMemCommand(const String& param) {
+    Serial.println("<<<RESPONSE_START>>>");
+
+    if (param.isEmpty()) {
+        MemTracker::printReport();
+    }
+    else if (param.equals("history")) {
+        MemTracker::printHistory();
+    }
+    else if (param.equals("reset")) {
+        MemTracker::resetPeaks();
+        Serial.println("Memory peaks and counters reset");
+    }
+    else if (param.equals("help")) {
+        Serial.println("Memory subcommands:");
+        Serial.println("  mem          - Live/peak bytes per subsystem, heap and LVGL pool");
+        Serial.println("  mem history  - Heap samples (free, largest block, fragmentation) as CSV");
+        Serial.println("  mem reset    - Reset peaks and allocation counters");
+    }
+    else {
+        Serial.println("Unknown mem subcommand: " + param);
+        Serial.println("Use 'mem help' for available subcommands");
+    }
+
+    Serial.println("<<<RESPONSE_END>>>");
+
+    if (logManager) {
+        logManager->logToSDOnly(LogManager::LM_LOG_INFO, "CMD", "Mem command executed: " + param);
+    }
+}
+
+void SerialCommands::handleImuCommand(const String& param) {
+    Serial.println("<<<RESPONSE_START>>>");
+
+    GestureEngine& engine = mpu.getGestureEngine();
+
+    if (param.isEmpty() || param.equals("stats")) {
+        Serial.println("=== IMU ===");
+        Serial.printf("Accel: ax=%d ay=%d az=%d  Gyro: gx=%d gy=%d gz=%d\r\n",
+                      mpu.getAccelX(), mpu.getAccelY(), mpu.getAccelZ(),
+                      mpu.getGyroX(), mpu.getGyroY(), mpu.getGyroZ());
+        Serial.printf("Filtered: ax=%ld ay=%ld az=%ld  HP magnitude=%ld\r\n",
+                      (long)engine.getSignal(SIG_LP_AX), (long)engine.getSignal(SIG_LP_AY),
+                      (long)engine.getSignal(SIG_LP_AZ), (long)engine.getSignal(SIG_HP_MAG));
+        Serial.printf("Orientation: pitch=%.2f roll=%.2f deg (gyro-fused)\r\n",
+                      engine.getSignal(SIG_PITCH) / 100.0f, engine.getSignal(SIG_ROLL) / 100.0f);
+        Serial.printf("FIFO overflows: %u, dropped samples: %u\r\n",
+                      mpu.getFifoOverflows(), mpu.getDroppedSamples());
+        if (imuRecorder.isRecording()) {
+            Serial.printf("Recording: %u samples, %u ms left\r\n",
+                          imuRecorder.getRecordedCount(), imuRecorder.getRemainingMs());
+        }
+
+        Serial.println("\n=== Gestures (raw threshold crossing -> trigger) ===");
+        Serial.println("Gesture          Count   Avg(ms)  Min(ms)  Max(ms)");
+        Serial.println("---------------  ------  -------  -------  -------");
+        for (int i = 1; i < GESTURE_TYPE_COUNT; i++) {
+            const GestureStats& st = engine.getStats((GestureType)i);
+            if (st.triggers == 0) {
+                continue;
+            }
+            Serial.printf("%-15s  %6u  %7u  %7u  %7u\r\n",
+                          GestureEngine::gestureName((GestureType)i), st.triggers,
+                          st.latency_total_ms / st.triggers, st.latency_min_ms, st.latency_max_ms);
+        }
+    }
+    else if (param.equals("reset")) {
+        engine.resetStats();
+        Serial.println("Gesture statistics reset");
+    }
+    else if (param.equals("record stop")) {
+        if (imuRecorder.isRecording()) {
+            imuRecorder.stop();
+            Serial.printf("Recording stopped, %u samples saved to %s\r\n",
+                          imuRecorder.getRecordedCount(), IMU_TRACE_PATH);
+        } else {
+            Serial.println("Not recording");
+        }
+    }
+    else if (param.startsWith("record")) {
+        int seconds = param.length() > 6 ? param.substring(7).toInt() : 0;
+        if (seconds <= 0 || seconds > 3600) {
+            Serial.println("Usage: imu record <seconds 1-3600> | imu record stop");
+        } else if (imuRecorder.start((uint32_t)seconds * 1000)) {
+            Serial.printf("Recording IMU trace for %d s to %s\r\n", seconds, IMU_TRACE_PATH);
+        } else {
+            Serial.println("Failed to start recording (SD card not available?)");
+        }
+    }
+    else if (param.startsWith("dump")) {
+        int max_records = param.length() > 4 ? param.substring(5).toInt() : 0;
+        imuRecorder.dump(Serial, max_records > 0 ? (uint32_t)max_records : 0);
+    }
+    else if (param.equals("help")) {
+        Serial.println("IMU subcommands:");
+        Serial.println("  imu stats            - Current readings, FIFO health and gesture latency");
+        Serial.println("  imu reset            - Reset gesture statistics");
+        Serial.println("  imu record <seconds> - Record raw samples to " IMU_TRACE_PATH);
+        Serial.println("  imu record stop      - Stop recording early");
+        Serial.println("  imu dump [N]         - Export the trace (last N samples) as CSV");
+    }
+    else {
+        Serial.println("Unknown imu subcommand: " + param);
+        Serial.println("Use 'imu help' for available subcommands");
+    }
+
+    Serial.println("<<<RESPONSE_END>>>");
+
+    if (logManager) {
+        logManager->logToSDOnly(LogManager::LM_LOG_INFO, "CMD", "IMU command executed: " + param);
+    }
+}
+
+void SerialCommands::handleSdCommand(const String& param) {
+    Serial.println("<<<RESPONSE_START>>>");
+
+    if (param.isEmpty() || param.equals("info")) {
+        tf.printInfo(SD_BENCH_PATH);
+    }
+    else if (param.startsWith("info ")) {
+        String path = param.substring(5);
+        path.trim();
+        tf.printInfo(path.c_str());
+    }
+    else if (param.equals("forget")) {
+        tf.forgetMountProfile();
+        Serial.println("Saved SD mount profile cleared, next boot probes from the highest clock");
+    }
+    else if (param.equals("help")) {
+        Serial.println("SD subcommands:");
+        Serial.println("  sd info [path]  - Mount clock, fingerprint and read throughput (default " SD_BENCH_PATH ")");
+        Serial.println("  sd forget       - Clear the saved mount clock in NVS");
+    }
+    else {
+        Serial.println("Unknown sd subcommand: " + param);
+        Serial.println("Use 'sd help' for available subcommands");
+    }
+
+    Serial.println("<<<RESPONSE_END>>>");
+
+    if (logManager) {
+        logManager->logToSDOnly(LogManager::LM_LOG_INFO, "CMD", "SD command executed: " + param);
+    }
+}
+
+void SerialCommands::handleBacklightCommand(const String& param) {
+    Serial.println("<<<RESPONSE_START>>>");
+
+    AmbientGovernor* governor = AmbientGovernor::getInstance();
+
+    if (param.isEmpty()) {
+        governor->printStatus();
+    }
+    else if (param.equals("auto")) {
+        governor->setAuto(true);
+        if (governor->isAuto()) {
+            Serial.println("Automatic backlight enabled");
+        } else {
+            Serial.println("No ambient light sensor, automatic backlight unavailable");
+        }
+    }
+    else if (param.equals("help")) {
+        Serial.println("Backlight subcommands:");
+        Serial.println("  backlight          - Ambient lux, mode and current brightness");
+        Serial.println("  backlight auto     - Follow ambient light (dark room also lowers frame rate)");
+        Serial.println("  backlight <0-100>  - Set brightness manually (disables auto)");
+    }
+    else {
+        int percent = param.toInt();
+        if (percent < 0 || percent > 100 || (percent == 0 && !param.equals("0"))) {
+            Serial.println("Invalid brightness: " + param);
+            Serial.println("Use 'backlight help' for available subcommands");
+        } else {
+            governor->setManualBrightness(percent / 100.0f);
+            Serial.printf("Backlight set to %d%% (auto off)\r\n", percent);
+        }
+    }
+
+    Serial.println("<<<RESPONSE_END>>>");
+
+    if (logManager) {
+        logManager->logToSDOnly(LogManager::LM_LOG_INFO, "CMD", "Backlight command executed: " + param);
+    }
+}
+
+void SerialCommands::handlePowerCommand(const String& param) {
+    Serial.println("<<<RESPONSE_START>>>");
+
+    PowerManager* power = PowerManager::getInstance();
+
+    String sub = param;
+    String value = "";
+    int spaceIndex = param.indexOf(' ');
+    if (spaceIndex > 0) {
+        sub = param.substring(0, spaceIndex);
+        value = param.substring(spaceIndex + 1);
+        value.trim();
+    }
+
+    if (sub.isEmpty()) {
+        power->printStatus();
+    }
+    else if (sub.equals("idle")) {
+        power->enterIdle();
+        Serial.println("Entered idle mode (next gesture or command resumes)");
+    }
+    else if (sub.equals("sleep")) {
+        if (!power->canDeepSleep()) {
+            Serial.println("Deep sleep unavailable: MPU6050 INT must be wired to an RTC GPIO (IMU_INT_PIN)");
+        } else {
+            Serial.println("Entering deep sleep, move the device to wake it");
+            Serial.println("<<<RESPONSE_END>>>");
+            Serial.flush();
+            power->enterDeepSleep();
+            Serial.println("<<<RESPONSE_START>>>");
+            Serial.println("Deep sleep failed, see log");
+        }
+    }
+    else if (sub.equals("idle-timeout") || sub.equals("sleep-timeout")) {
+        int amount = value.toInt();
+        if (amount < 0 || (amount == 0 && !value.equals("0"))) {
+            Serial.println("Invalid timeout: " + value);
+        } else if (sub.equals("idle-timeout")) {
+            power->setIdleTimeout(amount);
+            Serial.printf("Idle after %d s without gesture%s\r\n", amount, amount == 0 ? " (disabled)" : "");
+        } else {
+            power->setSleepTimeout(amount);
+            Serial.printf("Deep sleep after %d min without gesture%s\r\n", amount, amount == 0 ? " (disabled)" : "");
+        }
+    }
+    else if (sub.equals("help")) {
+        Serial.println("Power subcommands:");
+        Serial.println("  power                      - State, time in each state, wake latency");
+        Serial.println("  power idle                 - Enter idle mode now");
+        Serial.println("  power sleep                - Enter deep sleep now (wake on motion)");
+        Serial.println("  power idle-timeout <s>     - Idle after N seconds without gesture (0: never)");
+        Serial.println("  power sleep-timeout <min>  - Deep sleep after N minutes without gesture (0: never)");
+    }
+    else {
+        Serial.println("Unknown power subcommand: " + sub);
+        Serial.println("Use 'power help' for available subcommands");
+    }
+
+    Serial.println("<<<RESPONSE_END>>>");
+
+    if (logManager) {
+        logManager->logToSDOnly(LogManager::LM_LOG_INFO, "CMD", "Power command executed: " + param);
+    }
+}
+
+void SerialCommands::handleFontCommand(const String& param) {
+    Serial.println("<<<RESPONSE_START>>>");
+
+    if (param.equals("help")) {
+        Serial.println("Font subcommands:");
+        Serial.println("  font        - Loaded fonts, glyph cache hit rate and SD read time");
+        Serial.println("  font clear  - Drop all cached glyphs");
+        Serial.println("  font reset  - Reset cache statistics");
+    }
+    else {
+        // 字形缓存只在UI任务渲染时修改, 访问前持有LVGL锁
+        FontManager* fonts = FontManager::getInstance();
+        TaskManager* taskMgr = TaskManager::getInstance();
+        if (!taskMgr->takeLVGLMutex(500)) {
+            Serial.println("LVGL busy, try again");
+        } else {
+            if (param.isEmpty()) {
+                fonts->printStatus();
+            } else if (param.equals("clear")) {
+                fonts->clearCache();
+                Serial.println("Glyph cache cleared");
+            } else if (param.equals("reset")) {
+                fonts->resetStats();
+                Serial.println("Glyph cache statistics reset");
+            } else {
+                Serial.println("Unknown font subcommand: " + param);
+                Serial.println("Use 'font help' for available subcommands");
+            }
+            taskMgr->giveLVGLMutex();
+        }
+    }
+
+    Serial.println("<<<RESPONSE_END>>>");
+
+    if (logManager) {
+        logManager->logToSDOnly(LogManager::LM_LOG_INFO, "CMD", "Font command executed: " + param);
+    }
+}
@@ -55,12 +55,20 @@ private:
     void handleBirdCommand(const String& param);
     void handleTaskCommand(const String& param);
     void handleFileCommand(const String& param);
+    void handleMemCommand(const String& param);
+    void handleImuCommand(const String& param);
+    void handleSdCommand(const String& param);
+    void handleBacklightCommand(const String& param);
+    void handlePowerCommand(const String& param);
+    void handleFontCommand(const String& param);
     
     // 文件传输辅助函数
     void handleFileUpload(const String& param);
     void handleFileDownload(const String& param);
     void handleFileDelete(const String& param);
     void handleFileInfo(const String& param);
+    // 覆盖或删除小鸟文件前丢弃其缓存帧; LVGL锁拿不到时返回false, 调用方放弃操作
+    bool evictCachedBird(const String& path);
     String base64Encode(const uint8_t* data, size_t length);
     size_t base64Decode(const String& input, uint8_t* output, size_t maxLength);
 };
\ No newline at end of file
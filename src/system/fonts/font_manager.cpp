@@ -0,0 +1,383 @@
+#include "font_manager.h"
+#include "log_manager.h"
+#include "system/memory/mem_tracker.h"
+
+// gid.index = 缓存项下标 << 21 | 码点, 绘制时据此找回缓存项
+#define GID_LETTER_BITS     21
+#define GID_LETTER_MASK     ((1UL << GID_LETTER_BITS) - 1)
+#define ENTRY_EMPTY         0xFF
+
+FontManager* FontManager::instance_ = nullptr;
+
+FontManager* FontManager::getInstance()
+{
+    if (!instance_) {
+        instance_ = new FontManager();
+        MemTracker::adjust(MEM_TAG_FONT, sizeof(FontManager));
+    }
+    return instance_;
+}
+
+FontManager::FontManager()
+    : bitmaps_(nullptr)
+    , open_index_(-1)
+    , use_clock_(0)
+    , hits_(0)
+    , misses_(0)
+    , evictions_(0)
+    , oversize_reads_(0)
+    , sd_time_us_(0)
+{
+    static const uint16_t sizes[FONT_SIZE_COUNT] = FONT_SIZES;
+    for (uint8_t i = 0; i < FONT_SIZE_COUNT; i++) {
+        slots_[i].size = sizes[i];
+        slots_[i].index = i;
+        memset(&slots_[i].font, 0, sizeof(lv_font_t));
+    }
+    for (uint8_t i = 0; i < FONT_CACHE_GLYPHS; i++) {
+        entries_[i].font_index = ENTRY_EMPTY;
+    }
+}
+
+bool FontManager::init()
+{
+    uint8_t loaded = 0;
+    for (uint8_t i = 0; i < FONT_SIZE_COUNT; i++) {
+        FontSlot& slot = slots_[i];
+        String path = String(FONT_DIR "/" FONT_FILE_PREFIX) + slot.size + ".bin";
+        if (!slot.sd.open(path.c_str())) {
+            continue;
+        }
+
+        lv_font_t& font = slot.font;
+        font.get_glyph_dsc = getGlyphDsc;
+        font.get_glyph_bitmap = getGlyphBitmap;
+        font.release_glyph = nullptr;
+        font.line_height = slot.sd.getLineHeight();
+        font.base_line = slot.sd.getBaseLine();
+        font.subpx = LV_FONT_SUBPX_NONE;
+        font.kerning = LV_FONT_KERNING_NONE;
+        font.static_bitmap = 0;
+        font.underline_position = slot.sd.getUnderlinePosition();
+        font.underline_thickness = slot.sd.getUnderlineThickness();
+        font.dsc = &slot;
+        font.fallback = LV_FONT_DEFAULT;   // 字体中没有的字符(如子集外的符号)
+        loaded++;
+    }
+
+    if (loaded == 0) {
+        LOG_WARN("FONT", "No fonts in " FONT_DIR ", using built-in Latin font");
+        return false;
+    }
+
+    if (!bitmaps_) {
+        bitmaps_ = (uint8_t*)MemTracker::alloc(MEM_TAG_FONT, FONT_CACHE_GLYPHS * FONT_GLYPH_SLOT_BYTES);
+        if (!bitmaps_) {
+            LOG_ERROR("FONT", "Failed to allocate glyph cache");
+            return false;
+        }
+    }
+
+    LOG_INFO("FONT", String(loaded) + " fonts from " FONT_DIR ", glyph cache " +
+             String(FONT_CACHE_GLYPHS * FONT_GLYPH_SLOT_BYTES) + " bytes");
+    return true;
+}
+
+const lv_font_t* FontManager::getFont(uint16_t size)
+{
+    for (uint8_t i = 0; i < FONT_SIZE_COUNT; i++) {
+        if (slots_[i].size == size && slots_[i].sd.isLoaded() && bitmaps_) {
+            return &slots_[i].font;
+        }
+    }
+    return LV_FONT_DEFAULT;
+}
+
+bool FontManager::isLoaded(uint16_t size) const
+{
+    for (uint8_t i = 0; i < FONT_SIZE_COUNT; i++) {
+        if (slots_[i].size == size) {
+            return slots_[i].sd.isLoaded();
+        }
+    }
+    return false;
+}
+
+SdFont& FontManager::activate(uint8_t font_index)
+{
+    // 同一时间只保持一个字体文件打开
+    if (open_index_ >= 0 && open_index_ != font_index) {
+        slots_[open_index_].sd.closeFile();
+    }
+    open_index_ = font_index;
+    return slots_[font_index].sd;
+}
+
+int16_t FontManager::findEntry(uint8_t font_index, uint32_t letter) const
+{
+    for (uint8_t i = 0; i < FONT_CACHE_GLYPHS; i++) {
+        if (entries_[i].letter == letter && entries_[i].font_index == font_index) {
+            return i;
+        }
+    }
+    return -1;
+}
+
+int16_t FontManager::lookup(uint8_t font_index, uint32_t letter)
+{
+    if (!bitmaps_) {
+        return -1;
+    }
+
+    use_clock_++;
+    int16_t index = findEntry(font_index, letter);
+    if (index >= 0) {
+        entries_[index].last_use = use_clock_;
+        hits_++;
+        return index;
+    }
+
+    // 未命中: 占用空项或淘汰最久未用的项
+    misses_++;
+    index = 0;
+    for (uint8_t i = 0; i < FONT_CACHE_GLYPHS; i++) {
+        if (entries_[i].font_index == ENTRY_EMPTY) {
+            index = i;
+            break;
+        }
+        if (entries_[i].last_use < entries_[index].last_use) {
+            index = i;
+        }
+    }
+    GlyphEntry& entry = entries_[index];
+    if (entry.font_index != ENTRY_EMPTY) {
+        evictions_++;
+    }
+
+    uint32_t start_us = micros();
+    uint8_t* bitmap = bitmaps_ + index * FONT_GLYPH_SLOT_BYTES;
+    entry.found = activate(font_index).readGlyph(letter, &entry.glyph, bitmap, FONT_GLYPH_SLOT_BYTES);
+    sd_time_us_ += micros() - start_us;
+
+    entry.letter = letter;
+    entry.font_index = font_index;
+    entry.last_use = use_clock_;
+    entry.has_bitmap = entry.found && entry.glyph.bitmap_size <= FONT_GLYPH_SLOT_BYTES;
+    return index;
+}
+
+bool FontManager::getGlyphDsc(const lv_font_t* font, lv_font_glyph_dsc_t* dsc_out, uint32_t letter,
+                              uint32_t letter_next)
+{
+    (void)letter_next;
+    bool is_tab = letter == '\t';
+    if (is_tab) {
+        letter = ' ';
+    }
+
+    const FontSlot* slot = static_cast<const FontSlot*>(font->dsc);
+    FontManager* self = getInstance();
+    int16_t index = self->lookup(slot->index, letter);
+    if (index < 0 || !self->entries_[index].found) {
+        return false;
+    }
+
+    const SdFont::Glyph& glyph = self->entries_[index].glyph;
+    dsc_out->adv_w = is_tab ? glyph.adv_w * 2 : glyph.adv_w;
+    dsc_out->box_w = glyph.box_w;
+    dsc_out->box_h = glyph.box_h;
+    dsc_out->ofs_x = glyph.ofs_x;
+    dsc_out->ofs_y = glyph.ofs_y;
+    dsc_out->stride = 0;
+    dsc_out->format = (lv_font_glyph_format_t)slot->sd.getBpp();
+    dsc_out->is_placeholder = false;
+    dsc_out->gid.index = ((uint32_t)index << GID_LETTER_BITS) | letter;
+    return true;
+}
+
+const void* FontManager::getGlyphBitmap(lv_font_glyph_dsc_t* g_dsc, lv_draw_buf_t* draw_buf)
+{
+    const FontSlot* slot = static_cast<const FontSlot*>(g_dsc->resolved_font->dsc);
+    FontManager* self = getInstance();
+    uint32_t letter = g_dsc->gid.index & GID_LETTER_MASK;
+    int16_t index = g_dsc->gid.index >> GID_LETTER_BITS;
+
+    // 取度量后缓存项可能已被其他字形替换, 重新查找
+    if (index >= FONT_CACHE_GLYPHS || self->entries_[index].letter != letter ||
+        self->entries_[index].font_index != slot->index) {
+        index = self->lookup(slot->index, letter);
+    }
+    if (index < 0 || !self->entries_[index].found) {
+        return nullptr;
+    }
+
+    const GlyphEntry& entry = self->entries_[index];
+    if (entry.has_bitmap) {
+        const uint8_t* raw = self->bitmaps_ + index * FONT_GLYPH_SLOT_BYTES;
+        if (g_dsc->req_raw_bitmap) {
+            return raw;
+        }
+        if (!draw_buf) {
+            return nullptr;
+        }
+        expandToA8(raw, slot->sd.getBpp(), entry.glyph.box_w, entry.glyph.box_h, draw_buf);
+        return draw_buf;
+    }
+
+    // 超出槽大小的字形: 临时读入后展开, 不缓存位图
+    if (g_dsc->req_raw_bitmap || !draw_buf || entry.glyph.bitmap_size == 0) {
+        return nullptr;
+    }
+    uint8_t* raw = (uint8_t*)MemTracker::alloc(MEM_TAG_FONT, entry.glyph.bitmap_size);
+    if (!raw) {
+        return nullptr;
+    }
+    SdFont::Glyph glyph;
+    uint32_t start_us = micros();
+    bool ok = self->activate(slot->index).readGlyph(letter, &glyph, raw, entry.glyph.bitmap_size);
+    self->sd_time_us_ += micros() - start_us;
+    self->oversize_reads_++;
+    if (ok) {
+        expandToA8(raw, slot->sd.getBpp(), glyph.box_w, glyph.box_h, draw_buf);
+    }
+    MemTracker::free(raw);
+    return ok ? draw_buf : nullptr;
+}
+
+void FontManager::expandToA8(const uint8_t* raw, uint8_t bpp, uint16_t box_w, uint16_t box_h,
+                             lv_draw_buf_t* draw_buf)
+{
+    uint8_t* out = draw_buf->data;
+    uint32_t stride = draw_buf->header.stride;
+    uint8_t mask = (1 << bpp) - 1;
+    uint8_t scale = 255 / mask;     // 1bpp: 255, 2bpp: 85, 4bpp: 17, 8bpp: 1
+    uint32_t bit = 0;
+
+    // 位图逐行连续存放, 行末不补齐
+    for (uint16_t y = 0; y < box_h; y++) {
+        for (uint16_t x = 0; x < box_w; x++) {
+            uint8_t value = (raw[bit >> 3] >> (8 - bpp - (bit & 7))) & mask;
+            out[x] = value * scale;
+            bit += bpp;
+        }
+        out += stride;
+    }
+    lv_draw_buf_flush_cache(draw_buf, NULL);
+}
+
+// 解码一个UTF-8字符, 返回码点并前移指针(非法字节按单字节跳过)
+static uint32_t decodeUtf8(const char** text)
+{
+    const uint8_t* p = (const uint8_t*)*text;
+    uint32_t letter = p[0];
+    uint8_t extra = 0;
+    if (letter >= 0xF0) {
+        letter &= 0x07;
+        extra = 3;
+    } else if (letter >= 0xE0) {
+        letter &= 0x0F;
+        extra = 2;
+    } else if (letter >= 0xC0) {
+        letter &= 0x1F;
+        extra = 1;
+    }
+
+    uint8_t i = 1;
+    for (; i <= extra && (p[i] & 0xC0) == 0x80; i++) {
+        letter = (letter << 6) | (p[i] & 0x3F);
+    }
+    *text += i;
+    return i == extra + 1 ? letter : 0xFFFD;
+}
+
+uint16_t FontManager::prefetch(const lv_font_t* font, const char* text)
+{
+    uint8_t font_index = ENTRY_EMPTY;
+    for (uint8_t i = 0; i < FONT_SIZE_COUNT; i++) {
+        if (font == &slots_[i].font) {
+            font_index = i;
+        }
+    }
+    if (font_index == ENTRY_EMPTY || !bitmaps_ || !text) {
+        return 0;
+    }
+
+    uint32_t misses_before = misses_;
+    uint32_t start_ms = millis();
+    uint16_t letters = 0;
+    while (*text) {
+        uint32_t letter = decodeUtf8(&text);
+        if (letter == '\n' || letter == '\r') {
+            continue;
+        }
+        lookup(font_index, letter);
+        letters++;
+    }
+
+    uint16_t loaded = misses_ - misses_before;
+    if (letters > FONT_CACHE_GLYPHS) {
+        LOG_WARN("FONT", "Text has " + String(letters) + " letters, more than the glyph cache holds");
+    }
+    if (loaded > 0) {
+        LOG_INFO("FONT", "Prefetched " + String(loaded) + " glyphs (" + String(slots_[font_index].size) +
+                 "px) in " + String(millis() - start_ms) + " ms");
+    }
+    return loaded;
+}
+
+void FontManager::clearCache()
+{
+    for (uint8_t i = 0; i < FONT_CACHE_GLYPHS; i++) {
+        entries_[i].font_index = ENTRY_EMPTY;
+    }
+    if (open_index_ >= 0) {
+        slots_[open_index_].sd.closeFile();
+        open_index_ = -1;
+    }
+}
+
+void FontManager::resetStats()
+{
+    hits_ = 0;
+    misses_ = 0;
+    evictions_ = 0;
+    oversize_reads_ = 0;
+    sd_time_us_ = 0;
+}
+
+void FontManager::printStatus()
+{
+    Serial.println("=== Fonts ===");
+    for (uint8_t i = 0; i < FONT_SIZE_COUNT; i++) {
+        const FontSlot& slot = slots_[i];
+        if (slot.sd.isLoaded()) {
+            Serial.printf("%2upx: %s (%u bpp, %u SD reads)\r\n", slot.size, slot.sd.getPath(), slot.sd.getBpp(),
+                          slot.sd.getReads());
+        } else {
+            Serial.printf("%2upx: not loaded, using built-in Latin font\r\n", slot.size);
+        }
+    }
+
+    uint8_t used = 0;
+    uint8_t missing = 0;
+    uint16_t bitmap_bytes = 0;
+    for (uint8_t i = 0; i < FONT_CACHE_GLYPHS; i++) {
+        if (entries_[i].font_index == ENTRY_EMPTY) {
+            continue;
+        }
+        used++;
+        if (!entries_[i].found) {
+            missing++;
+        } else if (entries_[i].has_bitmap) {
+            bitmap_bytes += entries_[i].glyph.bitmap_size;
+        }
+    }
+
+    uint32_t lookups = hits_ + misses_;
+    Serial.printf("Glyph cache: %u/%u entries (%u not in font), %u/%u bitmap bytes\r\n", used, FONT_CACHE_GLYPHS,
+                  missing, bitmap_bytes, bitmaps_ ? FONT_CACHE_GLYPHS * FONT_GLYPH_SLOT_BYTES : 0);
+    Serial.printf("Lookups: %u, hit rate %.1f%%, evictions %u, oversize reads %u\r\n", lookups,
+                  lookups ? hits_ * 100.0f / lookups : 0.0f, evictions_, oversize_reads_);
+    Serial.printf("SD time: %u ms (%.1f ms per miss)\r\n", sd_time_us_ / 1000,
+                  misses_ ? sd_time_us_ / 1000.0f / misses_ : 0.0f);
+}
@@ -0,0 +1,97 @@
+#ifndef FONT_MANAGER_H
+#define FONT_MANAGER_H
+
+#include <Arduino.h>
+#include "lvgl.h"
+#include "sd_font.h"
+
+// 字体文件: /static/fonts/notosanssc_<字号>.bin (lv_font_conv --format bin --no-compress)
+#define FONT_DIR                "/static/fonts"
+#define FONT_FILE_PREFIX        "notosanssc_"
+#define FONT_SIZE_COUNT         3
+#define FONT_SIZES              { 12, 16, 18 }
+
+// 字形缓存(所有字号共用, LRU淘汰)
+#define FONT_CACHE_GLYPHS       64      // 缓存项数, 需不少于一屏用到的不同字符数
+#define FONT_GLYPH_SLOT_BYTES   192     // 每项位图槽大小: 18px 4bpp汉字约160字节, 更大的字形每次从SD读取
+
+/**
+ * @brief SD卡中文字体与字形缓存
+ *
+ * 取代编译进固件的中文字体数组: 字体放在SD卡/static/fonts下, 每个字号一个lv_font_t,
+ * 其get_glyph_dsc/get_glyph_bitmap回调从字形缓存取字, 未命中时由SdFont从SD读取单个字形。
+ * - 缓存项记录度量和原始位图(负缓存字体中没有的字, 由fallback字体显示)
+ * - prefetch()在设置界面文本前预读所需字形, 使首次绘制不在渲染中逐字读SD
+ * - 字体文件不存在时getFont()返回LV_FONT_DEFAULT, 界面仍能显示ASCII
+ *
+ * 只在持有LVGL锁时使用(UI任务渲染, 或串口命令先获取LVGL锁)
+ */
+class FontManager {
+public:
+    static FontManager* getInstance();
+
+    // 打开SD上的字体文件并分配字形缓存(SD挂载后调用)
+    bool init();
+
+    // 指定字号的中文字体, 没有时返回LV_FONT_DEFAULT
+    const lv_font_t* getFont(uint16_t size);
+    bool isLoaded(uint16_t size) const;
+
+    // 预读text中的字形, 返回从SD读取的字形数
+    uint16_t prefetch(const lv_font_t* font, const char* text);
+
+    void clearCache();
+    void resetStats();
+    void printStatus();
+
+private:
+    FontManager();
+
+    static FontManager* instance_;
+
+    struct FontSlot {
+        uint16_t size;
+        uint8_t index;
+        SdFont sd;
+        lv_font_t font;
+    };
+
+    struct GlyphEntry {
+        uint32_t letter;
+        uint32_t last_use;
+        SdFont::Glyph glyph;
+        uint8_t font_index;     // 0xFF: 空项
+        bool found;             // false: 字体中没有该字(负缓存)
+        bool has_bitmap;        // 位图在槽中(超出槽大小的字形为false)
+    };
+
+    FontSlot slots_[FONT_SIZE_COUNT];
+    GlyphEntry entries_[FONT_CACHE_GLYPHS];
+    uint8_t* bitmaps_;          // FONT_CACHE_GLYPHS * FONT_GLYPH_SLOT_BYTES
+    int8_t open_index_;         // 当前打开文件的字体(-1: 无)
+    uint32_t use_clock_;
+
+    // 统计
+    uint32_t hits_;
+    uint32_t misses_;
+    uint32_t evictions_;
+    uint32_t oversize_reads_;
+    uint32_t sd_time_us_;
+
+    // 查找或载入字形, 返回缓存项下标(-1: 缓存未分配)
+    int16_t lookup(uint8_t font_index, uint32_t letter);
+    int16_t findEntry(uint8_t font_index, uint32_t letter) const;
+    SdFont& activate(uint8_t font_index);
+
+    // 原始位图展开为A8(与lv_font_fmt_txt的PLAIN格式相同)
+    static void expandToA8(const uint8_t* raw, uint8_t bpp, uint16_t box_w, uint16_t box_h, lv_draw_buf_t* draw_buf);
+
+    // lv_font_t回调
+    static bool getGlyphDsc(const lv_font_t* font, lv_font_glyph_dsc_t* dsc_out, uint32_t letter, uint32_t letter_next);
+    static const void* getGlyphBitmap(lv_font_glyph_dsc_t* g_dsc, lv_draw_buf_t* draw_buf);
+
+    FontManager(const FontManager&) = delete;
+    FontManager& operator=(const FontManager&) = delete;
+};
+
+#endif // FONT_MANAGER_H
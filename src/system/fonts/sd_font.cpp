@@ -0,0 +1,309 @@
+#include "sd_font.h"
+#include "log_manager.h"
+
+#define SD_FONT_RECORD_MAX  1024    // 单个字形记录(头+位图)上限, 32px 4bpp约520字节
+
+// 字形记录读取缓冲区(只在UI任务中使用)
+static uint8_t s_record[SD_FONT_RECORD_MAX];
+
+// 位流读取(高位在前), 与lv_binfont_loader.c的read_bits一致
+static uint32_t readBits(const uint8_t* data, uint32_t* bit_pos, uint8_t n_bits)
+{
+    uint32_t value = 0;
+    for (uint8_t i = 0; i < n_bits; i++) {
+        uint32_t pos = *bit_pos + i;
+        value = (value << 1) | ((data[pos >> 3] >> (7 - (pos & 7))) & 1);
+    }
+    *bit_pos += n_bits;
+    return value;
+}
+
+static int32_t readBitsSigned(const uint8_t* data, uint32_t* bit_pos, uint8_t n_bits)
+{
+    uint32_t value = readBits(data, bit_pos, n_bits);
+    if (n_bits > 0 && (value & (1UL << (n_bits - 1)))) {
+        value |= ~0UL << n_bits;
+    }
+    return (int32_t)value;
+}
+
+SdFont::SdFont()
+    : loaded_(false)
+    , font_size_(0)
+    , ascent_(0)
+    , descent_(0)
+    , underline_position_(0)
+    , underline_thickness_(0)
+    , default_adv_w_(0)
+    , loca_format_(0)
+    , adv_format_(0)
+    , bpp_(0)
+    , xy_bits_(0)
+    , wh_bits_(0)
+    , adv_bits_(0)
+    , cmap_count_(0)
+    , cmap_start_(0)
+    , loca_start_(0)
+    , loca_count_(0)
+    , glyf_start_(0)
+    , glyf_length_(0)
+    , reads_(0)
+{
+    path_[0] = '\0';
+}
+
+SdFont::~SdFont()
+{
+    close();
+}
+
+bool SdFont::open(const char* path)
+{
+    close();
+    strncpy(path_, path, sizeof(path_) - 1);
+    path_[sizeof(path_) - 1] = '\0';
+
+    if (!SD.exists(path_)) {
+        LOG_WARN("FONT", String("Font not found: ") + path_);
+        return false;
+    }
+
+    int32_t head_length = readLabel(0, "head");
+    Header header;
+    if (head_length < 0 || !readAt(8, &header, sizeof(header))) {
+        LOG_ERROR("FONT", String("Invalid font header: ") + path_);
+        closeFile();
+        return false;
+    }
+
+    if (header.compression_id != 0) {
+        LOG_ERROR("FONT", String("Compressed glyphs not supported (convert with --no-compress): ") + path_);
+        closeFile();
+        return false;
+    }
+    if ((header.bits_per_pixel != 1 && header.bits_per_pixel != 2 && header.bits_per_pixel != 4 &&
+         header.bits_per_pixel != 8) || header.index_to_loc_format > 1) {
+        LOG_ERROR("FONT", String("Unsupported font format: bpp=") + header.bits_per_pixel +
+                  ", loca=" + header.index_to_loc_format);
+        closeFile();
+        return false;
+    }
+
+    font_size_ = header.font_size;
+    ascent_ = header.ascent;
+    descent_ = header.descent;
+    underline_position_ = (int8_t)header.underline_position;
+    underline_thickness_ = (int8_t)header.underline_thickness;
+    default_adv_w_ = header.default_advance_width;
+    loca_format_ = header.index_to_loc_format;
+    adv_format_ = header.advance_width_format;
+    bpp_ = header.bits_per_pixel;
+    xy_bits_ = header.xy_bits;
+    wh_bits_ = header.wh_bits;
+    adv_bits_ = header.advance_width_bits;
+
+    // cmap: 只保留子表头, 列表留在SD上
+    cmap_start_ = head_length;
+    int32_t cmap_length = readLabel(cmap_start_, "cmap");
+    uint32_t cmap_count = 0;
+    if (cmap_length < 0 || !readAt(cmap_start_ + 8, &cmap_count, sizeof(cmap_count)) ||
+        cmap_count > SD_FONT_MAX_CMAPS || !readAt(cmap_start_ + 12, cmaps_, cmap_count * sizeof(Cmap))) {
+        LOG_ERROR("FONT", String("Invalid cmap table (max ") + SD_FONT_MAX_CMAPS + " ranges): " + path_);
+        closeFile();
+        return false;
+    }
+    cmap_count_ = cmap_count;
+
+    uint32_t loca_pos = cmap_start_ + cmap_length;
+    int32_t loca_length = readLabel(loca_pos, "loca");
+    if (loca_length < 0 || !readAt(loca_pos + 8, &loca_count_, sizeof(loca_count_))) {
+        LOG_ERROR("FONT", String("Invalid loca table: ") + path_);
+        closeFile();
+        return false;
+    }
+    loca_start_ = loca_pos + 12;
+
+    glyf_start_ = loca_pos + loca_length;
+    int32_t glyf_length = readLabel(glyf_start_, "glyf");
+    if (glyf_length < 0) {
+        LOG_ERROR("FONT", String("Invalid glyf table: ") + path_);
+        closeFile();
+        return false;
+    }
+    glyf_length_ = glyf_length;
+
+    closeFile();
+    loaded_ = true;
+    LOG_INFO("FONT", String("Font ") + path_ + ": " + font_size_ + "px, " + bpp_ + " bpp, " +
+             loca_count_ + " glyphs, " + cmap_count_ + " ranges");
+    return true;
+}
+
+void SdFont::close()
+{
+    closeFile();
+    loaded_ = false;
+    cmap_count_ = 0;
+    loca_count_ = 0;
+}
+
+bool SdFont::ensureOpen()
+{
+    if (file_) {
+        return true;
+    }
+    if (path_[0] == '\0') {
+        return false;
+    }
+    file_ = SD.open(path_, FILE_READ);
+    if (!file_) {
+        LOG_ERROR("FONT", String("Failed to open font: ") + path_);
+        return false;
+    }
+    return true;
+}
+
+void SdFont::closeFile()
+{
+    if (file_) {
+        file_.close();
+    }
+}
+
+int32_t SdFont::readLabel(uint32_t offset, const char* label)
+{
+    uint32_t length = 0;
+    char name[4];
+    if (!readAt(offset, &length, sizeof(length)) || !readAt(offset + 4, name, sizeof(name)) ||
+        memcmp(name, label, 4) != 0) {
+        return -1;
+    }
+    return (int32_t)length;
+}
+
+bool SdFont::readAt(uint32_t offset, void* buf, uint32_t size)
+{
+    if (!ensureOpen() || !file_.seek(offset)) {
+        return false;
+    }
+    reads_++;
+    return file_.read((uint8_t*)buf, size) == size;
+}
+
+uint32_t SdFont::lookupGlyphId(uint32_t letter)
+{
+    for (uint8_t i = 0; i < cmap_count_; i++) {
+        const Cmap& cmap = cmaps_[i];
+        if (letter < cmap.range_start || letter >= cmap.range_start + cmap.range_length) {
+            continue;
+        }
+
+        uint32_t rcp = letter - cmap.range_start;
+        uint32_t data = cmap_start_ + cmap.data_offset;
+
+        if (cmap.format_type == LV_FONT_FMT_TXT_CMAP_FORMAT0_TINY) {
+            return cmap.glyph_id_start + rcp;
+        }
+        if (cmap.format_type == LV_FONT_FMT_TXT_CMAP_FORMAT0_FULL) {
+            uint8_t ofs = 0;
+            return readAt(data + rcp, &ofs, sizeof(ofs)) ? cmap.glyph_id_start + ofs : 0;
+        }
+
+        // 稀疏表: 在SD上二分查找相对码点列表
+        int32_t lo = 0;
+        int32_t hi = (int32_t)cmap.data_entries_count - 1;
+        while (lo <= hi) {
+            int32_t mid = (lo + hi) / 2;
+            uint16_t value = 0;
+            if (!readAt(data + mid * 2, &value, sizeof(value))) {
+                return 0;
+            }
+            if (value == rcp) {
+                if (cmap.format_type == LV_FONT_FMT_TXT_CMAP_SPARSE_TINY) {
+                    return cmap.glyph_id_start + mid;
+                }
+                uint16_t ofs = 0;
+                uint32_t ofs_pos = data + cmap.data_entries_count * 2 + mid * 2;
+                return readAt(ofs_pos, &ofs, sizeof(ofs)) ? cmap.glyph_id_start + ofs : 0;
+            }
+            if (value < rcp) {
+                lo = mid + 1;
+            } else {
+                hi = mid - 1;
+            }
+        }
+        return 0;
+    }
+    return 0;
+}
+
+bool SdFont::readLoca(uint32_t glyph_id, uint32_t* out_offset)
+{
+    if (loca_format_ == 0) {
+        uint16_t offset = 0;
+        if (!readAt(loca_start_ + glyph_id * 2, &offset, sizeof(offset))) {
+            return false;
+        }
+        *out_offset = offset;
+        return true;
+    }
+    return readAt(loca_start_ + glyph_id * 4, out_offset, sizeof(uint32_t));
+}
+
+bool SdFont::readGlyph(uint32_t letter, Glyph* out, uint8_t* bitmap, uint16_t capacity)
+{
+    if (!loaded_ || letter == 0) {
+        return false;
+    }
+
+    uint32_t glyph_id = lookupGlyphId(letter);
+    if (glyph_id == 0 || glyph_id >= loca_count_) {
+        return false;
+    }
+
+    uint32_t start = 0;
+    uint32_t end = glyf_length_;
+    if (!readLoca(glyph_id, &start) || (glyph_id + 1 < loca_count_ && !readLoca(glyph_id + 1, &end))) {
+        return false;
+    }
+    if (end <= start || end > glyf_length_ || end - start > SD_FONT_RECORD_MAX) {
+        LOG_WARN("FONT", "Glyph U+" + String(letter, HEX) + " record too large: " + String(end - start));
+        return false;
+    }
+
+    uint32_t record_size = end - start;
+    if (!readAt(glyf_start_ + start, s_record, record_size)) {
+        return false;
+    }
+
+    uint32_t bit_pos = 0;
+    uint32_t adv_w = adv_bits_ ? readBits(s_record, &bit_pos, adv_bits_) : default_adv_w_;
+    out->adv_w = adv_format_ == 0 ? adv_w : (adv_w + 8) >> 4;  // 格式1为1/16像素
+    out->ofs_x = readBitsSigned(s_record, &bit_pos, xy_bits_);
+    out->ofs_y = readBitsSigned(s_record, &bit_pos, xy_bits_);
+    out->box_w = readBits(s_record, &bit_pos, wh_bits_);
+    out->box_h = readBits(s_record, &bit_pos, wh_bits_);
+
+    uint32_t bitmap_bits = (uint32_t)out->box_w * out->box_h * bpp_;
+    out->bitmap_size = (bitmap_bits + 7) / 8;
+    if (bit_pos + bitmap_bits > record_size * 8) {
+        LOG_WARN("FONT", "Glyph U+" + String(letter, HEX) + " bitmap truncated");
+        return false;
+    }
+    if (!bitmap || out->bitmap_size > capacity) {
+        return true;
+    }
+
+    // 位图紧跟在头部位流之后, 不一定按字节对齐
+    uint32_t first = bit_pos >> 3;
+    uint8_t shift = bit_pos & 7;
+    if (shift == 0) {
+        memcpy(bitmap, s_record + first, out->bitmap_size);
+    } else {
+        for (uint16_t i = 0; i < out->bitmap_size; i++) {
+            uint8_t next = first + i + 1 < record_size ? s_record[first + i + 1] : 0;
+            bitmap[i] = (uint8_t)((s_record[first + i] << shift) | (next >> (8 - shift)));
+        }
+    }
+    return true;
+}
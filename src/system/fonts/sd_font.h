@@ -0,0 +1,141 @@
+#ifndef SD_FONT_H
+#define SD_FONT_H
+
+#include <Arduino.h>
+#include <SD.h>
+#include "lvgl.h"
+
+#define SD_FONT_MAX_CMAPS   16      // lv_font_conv按连续区间生成cmap子表, 常用字体只有几个
+
+/**
+ * @brief lv_font_conv生成的LVGL二进制字体(--format bin)的按需读取器
+ *
+ * 与lv_binfont_create()读取同样的文件, 但不把整套字形载入RAM:
+ * - open()只读取head段和cmap子表头(每个16字节), 记下loca/glyf段位置
+ * - 查字时在SD上二分查找cmap列表、读取loca项和单个字形记录
+ * - 字形位图按原始bpp位流返回(与lv_font_fmt_txt相同, 无行填充), 缓存由FontManager负责
+ *
+ * 不支持压缩位图(lv_font_conv需加--no-compress)和字距调整表(中文字体一般不需要)
+ */
+class SdFont {
+public:
+    struct Glyph {
+        uint16_t adv_w;         // 前进宽度(像素)
+        uint8_t box_w;
+        uint8_t box_h;
+        int8_t ofs_x;
+        int8_t ofs_y;
+        uint16_t bitmap_size;   // 原始位图字节数(box_w * box_h * bpp位, 向上取整)
+    };
+
+    SdFont();
+    ~SdFont();
+
+    // 解析文件头, 成功后文件保持关闭, 查字时由ensureOpen()打开
+    bool open(const char* path);
+    void close();
+    bool isLoaded() const { return loaded_; }
+
+    // 同一时间只保持一个字体文件打开(SD库默认最多5个文件句柄)
+    bool ensureOpen();
+    void closeFile();
+
+    const char* getPath() const { return path_; }
+    uint8_t getBpp() const { return bpp_; }
+    uint16_t getSize() const { return font_size_; }
+    int16_t getLineHeight() const { return ascent_ - descent_; }
+    int16_t getBaseLine() const { return -descent_; }
+    int8_t getUnderlinePosition() const { return underline_position_; }
+    int8_t getUnderlineThickness() const { return underline_thickness_; }
+
+    /**
+     * @brief 读取一个字形
+     * @param letter Unicode码点
+     * @param out 字形度量
+     * @param bitmap 位图输出(可为nullptr, 只取度量); 容量不足时只返回度量, bitmap_size仍为实际大小
+     * @return 字体中没有该字或读取失败时返回false
+     */
+    bool readGlyph(uint32_t letter, Glyph* out, uint8_t* bitmap, uint16_t capacity);
+
+    // 统计
+    uint32_t getReads() const { return reads_; }
+
+private:
+    // 与lv_binfont_loader.c中的font_header_bin_t一致
+    struct Header {
+        uint32_t version;
+        uint16_t tables_count;
+        uint16_t font_size;
+        uint16_t ascent;
+        int16_t descent;
+        uint16_t typo_ascent;
+        int16_t typo_descent;
+        uint16_t typo_line_gap;
+        int16_t min_y;
+        int16_t max_y;
+        uint16_t default_advance_width;
+        uint16_t kerning_scale;
+        uint8_t index_to_loc_format;
+        uint8_t glyph_id_format;
+        uint8_t advance_width_format;
+        uint8_t bits_per_pixel;
+        uint8_t xy_bits;
+        uint8_t wh_bits;
+        uint8_t advance_width_bits;
+        uint8_t compression_id;
+        uint8_t subpixels_mode;
+        uint8_t padding;
+        int16_t underline_position;
+        uint16_t underline_thickness;
+    } __attribute__((packed));
+
+    struct Cmap {
+        uint32_t data_offset;
+        uint32_t range_start;
+        uint16_t range_length;
+        uint16_t glyph_id_start;
+        uint16_t data_entries_count;
+        uint8_t format_type;
+        uint8_t padding;
+    } __attribute__((packed));
+
+    char path_[48];
+    File file_;
+    bool loaded_;
+
+    uint16_t font_size_;
+    int16_t ascent_;
+    int16_t descent_;
+    int8_t underline_position_;
+    int8_t underline_thickness_;
+    uint16_t default_adv_w_;
+    uint8_t loca_format_;
+    uint8_t adv_format_;
+    uint8_t bpp_;
+    uint8_t xy_bits_;
+    uint8_t wh_bits_;
+    uint8_t adv_bits_;
+
+    Cmap cmaps_[SD_FONT_MAX_CMAPS];
+    uint8_t cmap_count_;
+    uint32_t cmap_start_;
+    uint32_t loca_start_;       // 第一个loca项的文件偏移
+    uint32_t loca_count_;
+    uint32_t glyf_start_;
+    uint32_t glyf_length_;
+
+    uint32_t reads_;
+
+    // 读取段标签, 返回段长度(失败返回-1)
+    int32_t readLabel(uint32_t offset, const char* label);
+    bool readAt(uint32_t offset, void* buf, uint32_t size);
+
+    // Unicode -> 字形ID(0: 不存在)
+    uint32_t lookupGlyphId(uint32_t letter);
+    bool readLoca(uint32_t glyph_id, uint32_t* out_offset);
+
+    SdFont(const SdFont&) = delete;
+    SdFont& operator=(const SdFont&) = delete;
+};
+
+#endif // SD_FONT_H
@@ -1,6 +1,7 @@
 #include <Arduino.h>
 #include "log_manager.h"
 #include "sd_card.h"
+#include "system/memory/mem_tracker.h"
 #include <vector>
 
 // 静态成员初始化
@@ -277,8 +278,8 @@ String LogManager::getLogContent(int maxLines) {
         logFile.readStringUntil('\n'); // 丢弃第一个可能不完整的行
     }
 
-    // 使用动态分配的vector
-    std::vector<String> lineBuffer;
+    // 使用动态分配的vector(计入logging内存统计)
+    std::vector<String, TrackedAllocator<String, MEM_TAG_LOGGING>> lineBuffer;
     lineBuffer.reserve(safeMaxLines);
     
     int totalLines = 0;
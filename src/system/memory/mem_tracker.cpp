@@ -0,0 +1,263 @@
+#include "mem_tracker.h"
+#include "system/tasks/task_manager.h"
+#include <lvgl.h>
+#include <stdlib.h>
+
+// 前缀头(8字节), 位于返回给调用方的指针之前
+struct AllocHeader {
+    uint32_t size;      // 用户请求的大小
+    uint8_t tag;        // MemTag
+    uint8_t magic;      // 释放时校验(检测重复释放和非本模块指针)
+    uint16_t offset;    // 用户指针到malloc原始指针的偏移
+};
+
+static_assert(sizeof(AllocHeader) == 8, "AllocHeader must stay 8 bytes");
+
+static const uint8_t ALLOC_MAGIC = 0xA5;
+
+static const char* const kTagNames[MEM_TAG_COUNT] = {
+    "animation",
+    "loader",
+    "lvgl",
+    "logging",
+    "selector",
+    "serial",
+    "font",
+    "other",
+};
+
+static MemTracker::TagStats s_stats[MEM_TAG_COUNT];
+static portMUX_TYPE s_mux = portMUX_INITIALIZER_UNLOCKED;
+
+// 采样环形缓冲区
+static MemTracker::HeapSample s_samples[MEM_SAMPLE_COUNT];
+static uint8_t s_sample_head = 0;
+static uint8_t s_sample_count = 0;
+static uint32_t s_last_sample_ms = 0;
+static uint32_t s_last_sample_allocs = 0;
+
+void* MemTracker::alloc(MemTag tag, size_t size)
+{
+    return allocAligned(tag, size, 4);
+}
+
+void* MemTracker::allocAligned(MemTag tag, size_t size, size_t alignment)
+{
+    if (tag >= MEM_TAG_COUNT) {
+        tag = MEM_TAG_OTHER;
+    }
+    if (alignment < 4 || (alignment & (alignment - 1)) != 0) {
+        alignment = 4;
+    }
+
+    // malloc至少4字节对齐, 对齐要求更高时需要额外空间
+    size_t extra = sizeof(AllocHeader) + (alignment > 4 ? alignment - 4 : 0);
+    uint8_t* raw = static_cast<uint8_t*>(malloc(size + extra));
+    if (!raw) {
+        portENTER_CRITICAL(&s_mux);
+        s_stats[tag].failures++;
+        portEXIT_CRITICAL(&s_mux);
+        return nullptr;
+    }
+
+    uintptr_t user = (reinterpret_cast<uintptr_t>(raw) + sizeof(AllocHeader) + alignment - 1) & ~(uintptr_t)(alignment - 1);
+    AllocHeader* header = reinterpret_cast<AllocHeader*>(user - sizeof(AllocHeader));
+    header->size = size;
+    header->tag = tag;
+    header->magic = ALLOC_MAGIC;
+    header->offset = (uint16_t)(user - reinterpret_cast<uintptr_t>(raw));
+
+    record(tag, (int32_t)size, true);
+    return reinterpret_cast<void*>(user);
+}
+
+void MemTracker::free(void* ptr)
+{
+    if (!ptr) {
+        return;
+    }
+
+    // 只接受MemTracker::alloc返回的指针: 其他指针之前的内存不属于它, 不能读取后再退回::free
+    // magic不符说明重复释放或传入了普通malloc指针, 属于调用方错误
+    AllocHeader* header = reinterpret_cast<AllocHeader*>(static_cast<uint8_t*>(ptr) - sizeof(AllocHeader));
+    configASSERT(header->magic == ALLOC_MAGIC && header->tag < MEM_TAG_COUNT);
+
+    MemTag tag = (MemTag)header->tag;
+    uint32_t size = header->size;
+    uint8_t* raw = static_cast<uint8_t*>(ptr) - header->offset;
+    header->magic = 0;  // 防止重复释放时被误认
+
+    ::free(raw);
+    record(tag, -(int32_t)size, false);
+}
+
+size_t MemTracker::allocatedBytes(const void* ptr)
+{
+    if (!ptr) {
+        return 0;
+    }
+
+    const AllocHeader* header = reinterpret_cast<const AllocHeader*>(static_cast<const uint8_t*>(ptr) - sizeof(AllocHeader));
+    configASSERT(header->magic == ALLOC_MAGIC && header->tag < MEM_TAG_COUNT);
+    return header->size + header->offset;
+}
+
+void MemTracker::adjust(MemTag tag, int32_t delta)
+{
+    if (tag >= MEM_TAG_COUNT || delta == 0) {
+        return;
+    }
+    record(tag, delta, delta > 0);
+}
+
+void MemTracker::record(MemTag tag, int32_t delta, bool is_alloc)
+{
+    portENTER_CRITICAL(&s_mux);
+    TagStats& s = s_stats[tag];
+    if (delta < 0 && (uint32_t)(-delta) > s.live_bytes) {
+        s.live_bytes = 0;
+    } else {
+        s.live_bytes += delta;
+    }
+    if (s.live_bytes > s.peak_bytes) {
+        s.peak_bytes = s.live_bytes;
+    }
+    if (is_alloc) {
+        s.allocs++;
+    } else {
+        s.frees++;
+    }
+    portEXIT_CRITICAL(&s_mux);
+}
+
+MemTracker::TagStats MemTracker::getStats(MemTag tag)
+{
+    TagStats copy = {};
+    if (tag < MEM_TAG_COUNT) {
+        portENTER_CRITICAL(&s_mux);
+        copy = s_stats[tag];
+        portEXIT_CRITICAL(&s_mux);
+    }
+    return copy;
+}
+
+const char* MemTracker::tagName(MemTag tag)
+{
+    return tag < MEM_TAG_COUNT ? kTagNames[tag] : "?";
+}
+
+void MemTracker::service()
+{
+    uint32_t now = millis();
+    if (s_sample_count > 0 && now - s_last_sample_ms < MEM_SAMPLE_INTERVAL_MS) {
+        return;
+    }
+    takeSample();
+}
+
+void MemTracker::takeSample()
+{
+    uint32_t now = millis();
+
+    uint32_t total_allocs = 0;
+    portENTER_CRITICAL(&s_mux);
+    for (int i = 0; i < MEM_TAG_COUNT; i++) {
+        total_allocs += s_stats[i].allocs;
+    }
+    portEXIT_CRITICAL(&s_mux);
+
+    HeapSample sample = {};
+    sample.time_ms = now;
+    sample.free_heap = ESP.getFreeHeap();
+    sample.largest_block = ESP.getMaxAllocHeap();
+    sample.frag_pct = sample.free_heap > 0 ?
+        (uint8_t)(100 - (uint64_t)sample.largest_block * 100 / sample.free_heap) : 0;
+
+    uint32_t elapsed = now - s_last_sample_ms;
+    if (s_sample_count > 0 && elapsed > 0) {
+        uint32_t rate = (total_allocs - s_last_sample_allocs) * 1000 / elapsed;
+        sample.alloc_rate = rate > 0xFFFF ? 0xFFFF : (uint16_t)rate;
+    }
+
+    // LVGL内存池需在持有LVGL锁时读取; 拿不到锁就跳过, 不阻塞系统任务
+    TaskManager* taskMgr = TaskManager::getInstance();
+    if (taskMgr->takeLVGLMutex(10)) {
+        lv_mem_monitor_t mon;
+        lv_mem_monitor(&mon);
+        taskMgr->giveLVGLMutex();
+        sample.lvgl_used = mon.total_size - mon.free_size;
+        sample.lvgl_frag_pct = mon.frag_pct;
+    }
+
+    s_samples[s_sample_head] = sample;
+    s_sample_head = (s_sample_head + 1) % MEM_SAMPLE_COUNT;
+    if (s_sample_count < MEM_SAMPLE_COUNT) {
+        s_sample_count++;
+    }
+    s_last_sample_ms = now;
+    s_last_sample_allocs = total_allocs;
+}
+
+void MemTracker::printReport()
+{
+    TagStats stats[MEM_TAG_COUNT];
+    portENTER_CRITICAL(&s_mux);
+    memcpy(stats, s_stats, sizeof(stats));
+    portEXIT_CRITICAL(&s_mux);
+
+    Serial.println("=== Memory by Subsystem ===");
+    Serial.println("Tag         Live(B)   Peak(B)   Allocs    Frees     Failed");
+    Serial.println("----------  --------  --------  --------  --------  ------");
+    uint32_t total_live = 0;
+    for (int i = 0; i < MEM_TAG_COUNT; i++) {
+        Serial.printf("%-10s  %8u  %8u  %8u  %8u  %6u\r\n",
+                      kTagNames[i], stats[i].live_bytes, stats[i].peak_bytes,
+                      stats[i].allocs, stats[i].frees, stats[i].failures);
+        total_live += stats[i].live_bytes;
+    }
+    Serial.printf("Tracked live total: %u bytes\r\n", total_live);
+
+    Serial.println("\n=== Heap ===");
+    uint32_t free_heap = ESP.getFreeHeap();
+    uint32_t largest = ESP.getMaxAllocHeap();
+    Serial.printf("Free: %u bytes, Min free ever: %u bytes\r\n", free_heap, ESP.getMinFreeHeap());
+    Serial.printf("Largest free block: %u bytes, Fragmentation: %u%%\r\n",
+                  largest, free_heap > 0 ? (unsigned)(100 - (uint64_t)largest * 100 / free_heap) : 0);
+
+    TaskManager* taskMgr = TaskManager::getInstance();
+    if (taskMgr->takeLVGLMutex(100)) {
+        lv_mem_monitor_t mon;
+        lv_mem_monitor(&mon);
+        taskMgr->giveLVGLMutex();
+        Serial.printf("LVGL pool: used %u / %u bytes, max used %u, frag %u%%\r\n",
+                      (unsigned)(mon.total_size - mon.free_size), (unsigned)mon.total_size,
+                      (unsigned)mon.max_used, (unsigned)mon.frag_pct);
+    }
+}
+
+void MemTracker::printHistory()
+{
+    Serial.printf("=== Heap Samples (every %u ms, newest last) ===\r\n", MEM_SAMPLE_INTERVAL_MS);
+    Serial.println("time_ms,free,largest,frag%,lvgl_used,lvgl_frag%,allocs/s");
+
+    uint8_t start = (s_sample_head + MEM_SAMPLE_COUNT - s_sample_count) % MEM_SAMPLE_COUNT;
+    for (uint8_t i = 0; i < s_sample_count; i++) {
+        const HeapSample& s = s_samples[(start + i) % MEM_SAMPLE_COUNT];
+        Serial.printf("%u,%u,%u,%u,%u,%u,%u\r\n",
+                      s.time_ms, s.free_heap, s.largest_block, s.frag_pct,
+                      s.lvgl_used, s.lvgl_frag_pct, s.alloc_rate);
+    }
+}
+
+void MemTracker::resetPeaks()
+{
+    portENTER_CRITICAL(&s_mux);
+    for (int i = 0; i < MEM_TAG_COUNT; i++) {
+        s_stats[i].peak_bytes = s_stats[i].live_bytes;
+        s_stats[i].allocs = 0;
+        s_stats[i].frees = 0;
+        s_stats[i].failures = 0;
+    }
+    portEXIT_CRITICAL(&s_mux);
+    s_last_sample_allocs = 0;
+}
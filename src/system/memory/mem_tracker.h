@@ -0,0 +1,136 @@
+#ifndef MEM_TRACKER_H
+#define MEM_TRACKER_H
+
+#include <Arduino.h>
+#include <freertos/FreeRTOS.h>
+#include <cstddef>
+
+// 内存归属标签
+enum MemTag : uint8_t {
+    MEM_TAG_ANIMATION = 0,  // 动画播放器(测试图像/手动加载)
+    MEM_TAG_LOADER,         // Bundle加载器(帧缓冲区)
+    MEM_TAG_LVGL,           // LVGL相关(LVGL内置内存池单独统计)
+    MEM_TAG_LOGGING,        // 日志系统
+    MEM_TAG_SELECTOR,       // 小鸟选择器(小鸟列表)
+    MEM_TAG_SERIAL,         // 串口命令
+    MEM_TAG_FONT,           // SD字体字形缓存
+    MEM_TAG_OTHER,
+    MEM_TAG_COUNT
+};
+
+// 堆采样环形缓冲区大小及采样间隔
+#define MEM_SAMPLE_COUNT        32
+#define MEM_SAMPLE_INTERVAL_MS  5000
+
+/**
+ * @brief 按子系统归属的堆内存统计
+ *
+ * - MemTracker::alloc/free: 带8字节前缀头的分配包装, 释放时无需知道标签
+ *   (前缀头记录大小与标签, 因此跨模块释放也能正确归属)
+ * - MemTracker::adjust: 记录由std容器/String持有、无法包装的内存
+ * - service(): 在系统任务中调用, 每5秒采样一次空闲堆/最大空闲块/LVGL内存池,
+ *   保存到环形缓冲区, 用于观察碎片化趋势
+ *
+ * 注意: 通过MemTracker::alloc分配的指针必须用MemTracker::free释放,
+ *       MemTracker::free也只接受MemTracker::alloc返回的指针(否则断言失败)
+ */
+class MemTracker {
+public:
+    struct TagStats {
+        uint32_t live_bytes;    // 当前占用
+        uint32_t peak_bytes;    // 峰值占用
+        uint32_t allocs;        // 累计分配次数
+        uint32_t frees;         // 累计释放次数
+        uint32_t failures;      // 分配失败次数
+    };
+
+    struct HeapSample {
+        uint32_t time_ms;
+        uint32_t free_heap;
+        uint32_t largest_block;
+        uint32_t lvgl_used;     // LVGL内存池已用(无法获取时为0)
+        uint8_t frag_pct;       // 碎片率: 100 - 最大块/空闲
+        uint8_t lvgl_frag_pct;
+        uint16_t alloc_rate;    // 采样周期内的分配次数/秒
+    };
+
+    static void* alloc(MemTag tag, size_t size);
+    static void* allocAligned(MemTag tag, size_t size, size_t alignment);
+    static void free(void* ptr);
+
+    // alloc返回的指针实际占用的堆内存(请求大小 + 记账头与对齐填充)
+    static size_t allocatedBytes(const void* ptr);
+
+    // 手动记账(delta可为负)
+    static void adjust(MemTag tag, int32_t delta);
+
+    static TagStats getStats(MemTag tag);
+    static const char* tagName(MemTag tag);
+
+    // 周期采样(在系统任务中调用)
+    static void service();
+
+    // 串口输出
+    static void printReport();
+    static void printHistory();
+    static void resetPeaks();
+
+private:
+    static void record(MemTag tag, int32_t delta, bool is_alloc);
+    static void takeSample();
+};
+
+/**
+ * @brief 作用域记账: 构造时计入bytes, 析构时扣除(用于临时String等)
+ */
+class MemCharge {
+public:
+    MemCharge(MemTag tag, size_t bytes) : tag_(tag), bytes_((int32_t)bytes) {
+        MemTracker::adjust(tag_, bytes_);
+    }
+    ~MemCharge() { MemTracker::adjust(tag_, -bytes_); }
+
+private:
+    MemTag tag_;
+    int32_t bytes_;
+
+    MemCharge(const MemCharge&) = delete;
+    MemCharge& operator=(const MemCharge&) = delete;
+};
+
+/**
+ * @brief 记账到指定标签的STL分配器
+ *
+ * 用法: std::vector<String, TrackedAllocator<String, MEM_TAG_LOGGING>> lines;
+ */
+template<typename T, MemTag Tag>
+struct TrackedAllocator {
+    typedef T value_type;
+
+    TrackedAllocator() {}
+    template<typename U>
+    TrackedAllocator(const TrackedAllocator<U, Tag>&) {}
+
+    template<typename U>
+    struct rebind { typedef TrackedAllocator<U, Tag> other; };
+
+    T* allocate(size_t n) {
+        T* p = static_cast<T*>(MemTracker::alloc(Tag, n * sizeof(T)));
+        if (!p) {
+            abort();    // 与默认分配器行为一致(未开启异常)
+        }
+        return p;
+    }
+
+    void deallocate(T* p, size_t) {
+        MemTracker::free(p);
+    }
+};
+
+template<typename T, typename U, MemTag Tag>
+inline bool operator==(const TrackedAllocator<T, Tag>&, const TrackedAllocator<U, Tag>&) { return true; }
+
+template<typename T, typename U, MemTag Tag>
+inline bool operator!=(const TrackedAllocator<T, Tag>&, const TrackedAllocator<U, Tag>&) { return false; }
+
+#endif // MEM_TRACKER_H
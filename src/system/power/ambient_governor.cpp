@@ -0,0 +1,178 @@
+#include "ambient_governor.h"
+#include "drivers/sensors/ambient/ambient.h"
+#include "drivers/display/display.h"
+#include "applications/modules/bird_watching/core/bird_animation.h"
+#include "power_manager.h"
+#include "log_manager.h"
+
+extern Display screen;
+
+// 照度 → 背光亮度(分段线性)
+struct LuxPoint {
+    uint32_t lux;
+    float brightness;
+};
+
+static const LuxPoint kLuxCurve[] = {
+    { 0,    0.05f },
+    { 10,   0.15f },
+    { 50,   0.30f },
+    { 200,  0.60f },
+    { 1000, 1.00f },
+};
+static const int kLuxCurveCount = sizeof(kLuxCurve) / sizeof(kLuxCurve[0]);
+
+AmbientGovernor* AmbientGovernor::instance_ = nullptr;
+
+AmbientGovernor* AmbientGovernor::getInstance()
+{
+    if (!instance_) {
+        instance_ = new AmbientGovernor();
+    }
+    return instance_;
+}
+
+AmbientGovernor::AmbientGovernor()
+    : sensor_(nullptr)
+    , auto_enabled_(false)
+    , primed_(false)
+    , lux_q4_(0)
+    , last_raw_lux_(0)
+    , last_sample_ms_(0)
+    , dark_candidate_since_(0)
+    , mode_(MODE_NORMAL)
+    , target_brightness_(0.2f)
+{
+}
+
+void AmbientGovernor::init(Ambient* sensor)
+{
+    sensor_ = (sensor && sensor->isPresent()) ? sensor : nullptr;
+    auto_enabled_ = (sensor_ != nullptr);
+    target_brightness_ = screen.getBackLight();
+
+    if (sensor_) {
+        LOG_INFO("AMBIENT", "BH1750 found, automatic backlight enabled");
+    } else {
+        LOG_WARN("AMBIENT", "No ambient light sensor, using manual backlight");
+    }
+}
+
+float AmbientGovernor::brightnessForLux(uint32_t lux)
+{
+    if (lux >= kLuxCurve[kLuxCurveCount - 1].lux) {
+        return kLuxCurve[kLuxCurveCount - 1].brightness;
+    }
+    for (int i = 1; i < kLuxCurveCount; i++) {
+        if (lux < kLuxCurve[i].lux) {
+            const LuxPoint& a = kLuxCurve[i - 1];
+            const LuxPoint& b = kLuxCurve[i];
+            float t = (float)(lux - a.lux) / (b.lux - a.lux);
+            return a.brightness + (b.brightness - a.brightness) * t;
+        }
+    }
+    return kLuxCurve[0].brightness;
+}
+
+void AmbientGovernor::service()
+{
+    if (!auto_enabled_ || !sensor_) {
+        return;
+    }
+
+    uint32_t now = millis();
+    if (primed_ && now - last_sample_ms_ < AMBIENT_SAMPLE_INTERVAL_MS) {
+        return;
+    }
+    last_sample_ms_ = now;
+
+    uint32_t raw = sensor_->getLux();
+    last_raw_lux_ = raw;
+
+    // 指数滤波(首个样本直接作为初值)
+    if (!primed_) {
+        lux_q4_ = raw << 4;
+        primed_ = true;
+    } else {
+        int32_t diff = (int32_t)(raw << 4) - (int32_t)lux_q4_;
+        lux_q4_ = (uint32_t)((int32_t)lux_q4_ + diff / (1 << AMBIENT_FILTER_SHIFT));
+    }
+    uint32_t lux = lux_q4_ >> 4;
+
+    float brightness = brightnessForLux(lux);
+    float delta = brightness - target_brightness_;
+    if (delta > BACKLIGHT_MIN_STEP || delta < -BACKLIGHT_MIN_STEP) {
+        target_brightness_ = brightness;
+        screen.fadeBackLight(brightness, BACKLIGHT_FADE_MS);
+    }
+
+    updateMode(lux, now);
+}
+
+void AmbientGovernor::updateMode(uint32_t lux, uint32_t now)
+{
+    bool want_switch = (mode_ == MODE_NORMAL) ? (lux < AMBIENT_DARK_ENTER_LUX)
+                                              : (lux > AMBIENT_DARK_EXIT_LUX);
+    if (!want_switch) {
+        dark_candidate_since_ = 0;
+        return;
+    }
+
+    if (dark_candidate_since_ == 0) {
+        dark_candidate_since_ = now;
+        return;
+    }
+
+    if (now - dark_candidate_since_ >= AMBIENT_DARK_HOLD_MS) {
+        dark_candidate_since_ = 0;
+        applyMode(mode_ == MODE_NORMAL ? MODE_DARK : MODE_NORMAL);
+    }
+}
+
+void AmbientGovernor::applyMode(Mode mode)
+{
+    mode_ = mode;
+
+    // 由PowerManager与空闲状态合并后下发给UI任务
+    PowerManager::getInstance()->updateDisplayMode();
+    LOG_INFO("AMBIENT", String(mode == MODE_DARK ? "Dark" : "Normal") + " mode, lux=" + String(getLux()));
+}
+
+void AmbientGovernor::setAuto(bool enabled)
+{
+    auto_enabled_ = enabled && sensor_ != nullptr;
+    dark_candidate_since_ = 0;
+    if (!auto_enabled_ && mode_ != MODE_NORMAL) {
+        applyMode(MODE_NORMAL);
+    }
+    if (auto_enabled_) {
+        // 下次service()立即采样并重新计算亮度
+        primed_ = false;
+        target_brightness_ = -1.0f;
+    }
+}
+
+void AmbientGovernor::setManualBrightness(float duty)
+{
+    setAuto(false);
+    target_brightness_ = duty;
+    screen.fadeBackLight(duty, BACKLIGHT_FADE_MS);
+}
+
+void AmbientGovernor::printStatus()
+{
+    Serial.println("=== Backlight ===");
+    if (sensor_) {
+        Serial.printf("Ambient: %u lux (filtered), %u lux (last reading)\r\n", getLux(), last_raw_lux_);
+    } else {
+        Serial.println("Ambient: no BH1750 detected");
+    }
+    Serial.printf("Mode: %s, %s\r\n", auto_enabled_ ? "auto" : "manual",
+                  mode_ == MODE_DARK ? "dark (reduced refresh)" : "normal");
+    Serial.printf("Backlight: %u%% (target %u%%)\r\n",
+                  (unsigned)(screen.getBackLight() * 100 + 0.5f),
+                  (unsigned)(target_brightness_ < 0 ? 0 : target_brightness_ * 100 + 0.5f));
+    Serial.printf("Animation frame interval: %u ms, LVGL refresh period: %u ms\r\n",
+                  mode_ == MODE_DARK ? FRAME_INTERVAL_DARK_MS : BIRD_FRAME_INTERVAL_MS,
+                  mode_ == MODE_DARK ? REFRESH_PERIOD_DARK_MS : REFRESH_PERIOD_NORMAL_MS);
+}
@@ -0,0 +1,80 @@
+#ifndef AMBIENT_GOVERNOR_H
+#define AMBIENT_GOVERNOR_H
+
+#include <Arduino.h>
+
+class Ambient;
+
+// 采样与滤波
+#define AMBIENT_SAMPLE_INTERVAL_MS  250
+#define AMBIENT_FILTER_SHIFT        3       // EMA系数1/8, 4Hz采样下约2秒时间常数
+
+// 暗环境判定(滞回 + 持续时间, 避免开关灯瞬间来回切换)
+#define AMBIENT_DARK_ENTER_LUX      5
+#define AMBIENT_DARK_EXIT_LUX       15
+#define AMBIENT_DARK_HOLD_MS        3000
+
+// 背光渐变
+#define BACKLIGHT_FADE_MS           800
+#define BACKLIGHT_MIN_STEP          0.03f   // 目标亮度变化小于该值不重新渐变
+
+// 刷新策略
+#define FRAME_INTERVAL_DARK_MS      200     // 暗环境下小鸟动画5 FPS
+#define REFRESH_PERIOD_NORMAL_MS    33      // LV_DEF_REFR_PERIOD
+#define REFRESH_PERIOD_DARK_MS      100
+
+/**
+ * @brief 环境光驱动的背光与刷新率调节
+ *
+ * 在系统任务中周期调用service():
+ * - 读取BH1750照度并做指数滤波
+ * - 按照度分段映射背光亮度, 通过Display::fadeBackLight平滑过渡
+ * - 持续处于暗环境时经消息总线通知UI任务降低动画帧率和LVGL刷新周期,
+ *   环境变亮后恢复
+ */
+class AmbientGovernor {
+public:
+    enum Mode {
+        MODE_NORMAL = 0,
+        MODE_DARK
+    };
+
+    static AmbientGovernor* getInstance();
+
+    // sensor为nullptr或传感器不存在时只保留手动背光
+    void init(Ambient* sensor);
+    void service();
+
+    // 自动亮度开关; 关闭时使用手动亮度并恢复正常刷新率
+    void setAuto(bool enabled);
+    bool isAuto() const { return auto_enabled_; }
+    void setManualBrightness(float duty);
+
+    uint32_t getLux() const { return lux_q4_ >> 4; }
+    Mode getMode() const { return mode_; }
+    void printStatus();
+
+private:
+    AmbientGovernor();
+
+    static AmbientGovernor* instance_;
+
+    Ambient* sensor_;
+    bool auto_enabled_;
+    bool primed_;
+    uint32_t lux_q4_;               // 滤波后照度(Q4定点)
+    uint32_t last_raw_lux_;
+    uint32_t last_sample_ms_;
+    uint32_t dark_candidate_since_; // 满足切换条件的开始时间, 0表示未满足
+    Mode mode_;
+    float target_brightness_;
+
+    static float brightnessForLux(uint32_t lux);
+    void updateMode(uint32_t lux, uint32_t now);
+    void applyMode(Mode mode);
+
+    AmbientGovernor(const AmbientGovernor&) = delete;
+    AmbientGovernor& operator=(const AmbientGovernor&) = delete;
+};
+
+#endif // AMBIENT_GOVERNOR_H
@@ -0,0 +1,338 @@
+#include "power_manager.h"
+#include "ambient_governor.h"
+#include "drivers/display/display.h"
+#include "drivers/sensors/imu/imu.h"
+#include "drivers/io/rgb_led/rgb_led.h"
+#include "applications/modules/bird_watching/core/bird_animation.h"
+#include "system/tasks/task_manager.h"
+#include "log_manager.h"
+#include <Preferences.h>
+#include <esp_sleep.h>
+#include <driver/rtc_io.h>
+#include <sys/time.h>
+#if CONFIG_PM_ENABLE
+#include <esp_pm.h>
+#include <driver/uart.h>
+#endif
+
+extern Display screen;
+extern IMU mpu;
+extern Pixel rgb;
+
+#define POWER_NVS_NAMESPACE "power"
+
+// 跨深度睡眠保留的统计(RTC慢速内存, 断电清零)
+RTC_DATA_ATTR static uint32_t s_sleep_count = 0;
+RTC_DATA_ATTR static uint32_t s_sleep_total_s = 0;
+RTC_DATA_ATTR static int64_t s_sleep_enter_us = 0;     // 进入睡眠时的RTC时间(gettimeofday)
+
+#if CONFIG_PM_ENABLE
+static esp_pm_lock_handle_t s_active_lock = NULL;      // ACTIVE状态持有: 最高频率且不进入light sleep
+#endif
+
+static const char* const kStateNames[PowerManager::STATE_COUNT] = {
+    "active",
+    "idle",
+};
+
+static int64_t rtcTimeUs()
+{
+    struct timeval tv;
+    gettimeofday(&tv, NULL);
+    return (int64_t)tv.tv_sec * 1000000LL + tv.tv_usec;
+}
+
+PowerManager* PowerManager::instance_ = nullptr;
+
+PowerManager* PowerManager::getInstance()
+{
+    if (!instance_) {
+        instance_ = new PowerManager();
+    }
+    return instance_;
+}
+
+PowerManager::PowerManager()
+    : state_(STATE_ACTIVE)
+    , state_since_ms_(0)
+    , last_activity_ms_(0)
+    , idle_timeout_s_(POWER_IDLE_TIMEOUT_S)
+    , sleep_timeout_min_(POWER_SLEEP_TIMEOUT_MIN)
+    , wake_cause_(0)
+    , last_sleep_ms_(0)
+    , boot_ready_ms_(0)
+    , resume_pending_ms_(0)
+    , resume_last_ms_(0)
+    , resume_max_ms_(0)
+{
+    memset(state_total_ms_, 0, sizeof(state_total_ms_));
+}
+
+void PowerManager::init()
+{
+    wake_cause_ = (int)esp_sleep_get_wakeup_cause();
+    if (wake_cause_ == ESP_SLEEP_WAKEUP_EXT0 && s_sleep_enter_us > 0) {
+        int64_t slept_us = rtcTimeUs() - s_sleep_enter_us;
+        if (slept_us > 0) {
+            last_sleep_ms_ = (uint32_t)(slept_us / 1000);
+            s_sleep_total_s += (uint32_t)(slept_us / 1000000);
+        }
+    }
+    s_sleep_enter_us = 0;
+
+    loadSettings();
+
+#if CONFIG_PM_ENABLE
+    esp_pm_config_esp32_t pm_config = {};
+    pm_config.max_freq_mhz = POWER_ACTIVE_CPU_MHZ;
+    pm_config.min_freq_mhz = POWER_IDLE_CPU_MHZ;
+    pm_config.light_sleep_enable = POWER_AUTO_LIGHT_SLEEP;
+    if (esp_pm_configure(&pm_config) != ESP_OK ||
+        esp_pm_lock_create(ESP_PM_CPU_FREQ_MAX, 0, "active", &s_active_lock) != ESP_OK) {
+        LOG_WARN("POWER", "esp_pm unavailable, idle mode only lowers frame rate");
+        s_active_lock = NULL;
+    } else {
+        esp_pm_lock_acquire(s_active_lock);
+    }
+#if POWER_AUTO_LIGHT_SLEEP
+    // light sleep期间串口收到字符即唤醒(首个字符可能丢失)
+    uart_set_wakeup_threshold(UART_NUM_0, 3);
+    esp_sleep_enable_uart_wakeup(UART_NUM_0);
+#endif
+#endif
+
+    state_ = STATE_ACTIVE;
+    state_since_ms_ = millis();
+    last_activity_ms_ = state_since_ms_;
+
+    if (wake_cause_ == ESP_SLEEP_WAKEUP_EXT0) {
+        LOG_INFO("POWER", "Woke from deep sleep by motion after " + String(last_sleep_ms_ / 1000) + " s");
+    }
+}
+
+void PowerManager::markReady()
+{
+    // millis()从应用启动开始计时, 不含ROM/bootloader时间
+    boot_ready_ms_ = millis();
+    last_activity_ms_ = boot_ready_ms_;
+}
+
+void PowerManager::loadSettings()
+{
+    Preferences prefs;
+    if (prefs.begin(POWER_NVS_NAMESPACE, true)) {
+        idle_timeout_s_ = prefs.getUInt("idle_s", POWER_IDLE_TIMEOUT_S);
+        sleep_timeout_min_ = prefs.getUInt("sleep_min", POWER_SLEEP_TIMEOUT_MIN);
+        prefs.end();
+    }
+}
+
+void PowerManager::saveSettings()
+{
+    Preferences prefs;
+    if (prefs.begin(POWER_NVS_NAMESPACE, false)) {
+        prefs.putUInt("idle_s", idle_timeout_s_);
+        prefs.putUInt("sleep_min", sleep_timeout_min_);
+        prefs.end();
+    }
+}
+
+uint32_t PowerManager::getLoopPeriodMs() const
+{
+    return state_ == STATE_IDLE ? POWER_IDLE_LOOP_MS : POWER_ACTIVE_LOOP_MS;
+}
+
+void PowerManager::service()
+{
+    uint32_t now = millis();
+    uint32_t inactive_ms = now - last_activity_ms_;
+
+    if (state_ == STATE_ACTIVE && idle_timeout_s_ > 0 && inactive_ms >= idle_timeout_s_ * 1000UL) {
+        enterIdle();
+    }
+
+    if (state_ == STATE_IDLE && sleep_timeout_min_ > 0 && canDeepSleep() &&
+        inactive_ms >= sleep_timeout_min_ * 60000UL) {
+        if (!enterDeepSleep()) {
+            // 失败时推迟到下一个超时周期再尝试
+            last_activity_ms_ = now;
+        }
+    }
+}
+
+void PowerManager::notifyActivity()
+{
+    last_activity_ms_ = millis();
+    if (state_ != STATE_ACTIVE) {
+        resume_pending_ms_ = last_activity_ms_ ? last_activity_ms_ : 1;
+        setState(STATE_ACTIVE);
+    }
+}
+
+void PowerManager::enterIdle()
+{
+    if (state_ != STATE_IDLE) {
+        setState(STATE_IDLE);
+    }
+}
+
+void PowerManager::setState(State state)
+{
+    uint32_t now = millis();
+    state_total_ms_[state_] += now - state_since_ms_;
+    state_since_ms_ = now;
+    state_ = state;
+
+    applyPowerState(state);
+    updateDisplayMode();
+    LOG_INFO("POWER", String("Enter ") + kStateNames[state] + " state");
+}
+
+void PowerManager::applyPowerState(State state)
+{
+#if CONFIG_PM_ENABLE
+    if (s_active_lock) {
+        if (state == STATE_ACTIVE) {
+            esp_pm_lock_acquire(s_active_lock);
+        } else {
+            esp_pm_lock_release(s_active_lock);
+        }
+        return;
+    }
+#endif
+    setCpuFrequencyMhz(state == STATE_ACTIVE ? POWER_ACTIVE_CPU_MHZ : POWER_IDLE_CPU_MHZ);
+}
+
+void PowerManager::updateDisplayMode()
+{
+    // 取空闲与暗环境中更慢的一档
+    DisplayModeMsg msg;
+    if (state_ == STATE_IDLE) {
+        msg.frame_interval_ms = POWER_IDLE_FRAME_MS;
+        msg.refresh_period_ms = POWER_IDLE_REFRESH_MS;
+    } else if (AmbientGovernor::getInstance()->getMode() == AmbientGovernor::MODE_DARK) {
+        msg.frame_interval_ms = FRAME_INTERVAL_DARK_MS;
+        msg.refresh_period_ms = REFRESH_PERIOD_DARK_MS;
+    } else {
+        msg.frame_interval_ms = BIRD_FRAME_INTERVAL_MS;
+        msg.refresh_period_ms = REFRESH_PERIOD_NORMAL_MS;
+    }
+
+    if (!TaskManager::getInstance()->sendToUITask(msg)) {
+        LOG_WARN("POWER", "Failed to post display mode");
+    }
+}
+
+void PowerManager::onDisplayModeApplied()
+{
+    uint32_t pending = resume_pending_ms_;
+    if (pending == 0) {
+        return;
+    }
+    resume_pending_ms_ = 0;
+    resume_last_ms_ = millis() - pending;
+    if (resume_last_ms_ > resume_max_ms_) {
+        resume_max_ms_ = resume_last_ms_;
+    }
+}
+
+bool PowerManager::canDeepSleep() const
+{
+#if IMU_INT_PIN >= 0
+    // ext0唤醒只能用RTC GPIO, 否则睡下去就醒不过来
+    return rtc_gpio_is_valid_gpio((gpio_num_t)IMU_INT_PIN) && mpu.isInitialized();
+#else
+    return false;
+#endif
+}
+
+bool PowerManager::enterDeepSleep()
+{
+    if (!canDeepSleep()) {
+        LOG_WARN("POWER", "Deep sleep needs MPU6050 INT on an RTC GPIO (IMU_INT_PIN)");
+        return false;
+    }
+
+#if IMU_INT_PIN >= 0
+    LOG_INFO("POWER", "Entering deep sleep, wake on motion (GPIO" + String(IMU_INT_PIN) + ")");
+
+    // 持有LVGL锁直到睡眠, UI任务不再刷屏
+    TaskManager* taskMgr = TaskManager::getInstance();
+    if (!taskMgr->takeLVGLMutex(500)) {
+        LOG_WARN("POWER", "LVGL busy, deep sleep postponed");
+        return false;
+    }
+
+    if (!mpu.enableMotionWake(POWER_MOTION_THRESHOLD, POWER_MOTION_DURATION_MS)) {
+        taskMgr->giveLVGLMutex();
+        LOG_ERROR("POWER", "Failed to arm MPU6050 motion interrupt");
+        mpu.init();
+        return false;
+    }
+
+    rgb.stopEffects();
+    screen.sleep();
+
+    uint32_t now = millis();
+    state_total_ms_[state_] += now - state_since_ms_;
+    state_since_ms_ = now;
+
+    s_sleep_count++;
+    s_sleep_enter_us = rtcTimeUs();
+    LogManager::getInstance()->flush();
+
+    esp_sleep_enable_ext0_wakeup((gpio_num_t)IMU_INT_PIN, 1);
+    esp_deep_sleep_start();
+#endif
+    return false;
+}
+
+void PowerManager::setIdleTimeout(uint32_t seconds)
+{
+    idle_timeout_s_ = seconds;
+    saveSettings();
+}
+
+void PowerManager::setSleepTimeout(uint32_t minutes)
+{
+    sleep_timeout_min_ = minutes;
+    saveSettings();
+}
+
+void PowerManager::printStatus()
+{
+    uint32_t now = millis();
+    uint32_t totals[STATE_COUNT];
+    memcpy(totals, state_total_ms_, sizeof(totals));
+    totals[state_] += now - state_since_ms_;
+
+    Serial.println("=== Power ===");
+    Serial.printf("State: %s (for %u s), last activity %u s ago\r\n",
+                  kStateNames[state_], (now - state_since_ms_) / 1000, (now - last_activity_ms_) / 1000);
+    Serial.printf("CPU: %u MHz, system loop %u ms\r\n", (unsigned)getCpuFrequencyMhz(), getLoopPeriodMs());
+#if CONFIG_PM_ENABLE
+    Serial.printf("Light sleep between ticks: %s\r\n",
+                  s_active_lock ? (POWER_AUTO_LIGHT_SLEEP ? "idle only" : "disabled (no tickless idle)") : "unavailable");
+#else
+    Serial.println("Light sleep between ticks: unavailable (CONFIG_PM_ENABLE off, idle uses 80 MHz)");
+#endif
+    Serial.printf("Idle after: %u s, deep sleep after: %u min%s\r\n", idle_timeout_s_, sleep_timeout_min_,
+                  canDeepSleep() ? "" : " (disabled: IMU_INT_PIN missing or not an RTC GPIO)");
+
+    Serial.println("");
+    Serial.println("Time in state since boot:");
+    for (int i = 0; i < STATE_COUNT; i++) {
+        Serial.printf("  %-8s %8u s  %5.1f%%\r\n", kStateNames[i], totals[i] / 1000,
+                      now > 0 ? totals[i] * 100.0f / now : 0.0f);
+    }
+    Serial.printf("  %-8s %8u s  (%u times, kept in RTC memory)\r\n", "deep", s_sleep_total_s, s_sleep_count);
+
+    Serial.println("");
+    Serial.printf("Wake cause: %s\r\n", wake_cause_ == ESP_SLEEP_WAKEUP_EXT0 ? "motion (ext0)" : "power-on/reset");
+    if (wake_cause_ == ESP_SLEEP_WAKEUP_EXT0) {
+        Serial.printf("Last deep sleep: %u s\r\n", last_sleep_ms_ / 1000);
+    }
+    Serial.printf("Wake latency: %u ms to ready (app start to end of setup)\r\n", boot_ready_ms_);
+    Serial.printf("Idle resume latency: last %u ms, max %u ms (gesture to display mode applied)\r\n",
+                  resume_last_ms_, resume_max_ms_);
+}
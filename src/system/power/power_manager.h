@@ -0,0 +1,107 @@
+#ifndef POWER_MANAGER_H
+#define POWER_MANAGER_H
+
+#include <Arduino.h>
+
+// 状态切换超时(可用 `power idle-timeout` / `power sleep-timeout` 修改, 保存在NVS)
+#define POWER_IDLE_TIMEOUT_S        120     // 无手势多久后进入空闲
+#define POWER_SLEEP_TIMEOUT_MIN     30      // 无手势多久后深度睡眠(0: 不睡眠)
+
+// 空闲模式下的刷新策略
+#define POWER_IDLE_FRAME_MS         500     // 小鸟动画2 FPS
+#define POWER_IDLE_REFRESH_MS       250     // LVGL刷新周期
+#define POWER_ACTIVE_LOOP_MS        10      // 系统任务周期(100Hz)
+#define POWER_IDLE_LOOP_MS          50      // 与IMU FIFO读取间隔一致, 不丢样本
+
+// 动态调频(自动light sleep需要CONFIG_PM_ENABLE + CONFIG_FREERTOS_USE_TICKLESS_IDLE)
+#define POWER_ACTIVE_CPU_MHZ        240
+#define POWER_IDLE_CPU_MHZ          80
+
+#if defined(CONFIG_PM_ENABLE) && defined(CONFIG_FREERTOS_USE_TICKLESS_IDLE)
+#define POWER_AUTO_LIGHT_SLEEP      1
+#else
+#define POWER_AUTO_LIGHT_SLEEP      0
+#endif
+
+// 运动唤醒(MPU6050 MOT_THR: 2mg/LSB, MOT_DUR: 1ms/LSB)
+// 需要把MPU6050 INT接到RTC GPIO并定义IMU_INT_PIN, 否则只进入空闲模式不深度睡眠
+#define POWER_MOTION_THRESHOLD      20      // 40mg
+#define POWER_MOTION_DURATION_MS    1
+
+/**
+ * @brief 电源状态管理
+ *
+ * - ACTIVE: 正常运行
+ * - IDLE: 一段时间没有手势后进入; 降低动画帧率和LVGL刷新率, 系统任务降到20Hz,
+ *   释放CPU频率锁让电源管理在两次tick之间自动light sleep(不支持时降频到80MHz)
+ * - 深度睡眠: 更长时间没有手势后, MPU6050切换到运动检测, INT引脚作为ext0唤醒源;
+ *   唤醒后重新启动, 睡眠次数/时长保存在RTC内存中
+ *
+ * 手势与串口命令调用notifyActivity()回到ACTIVE
+ */
+class PowerManager {
+public:
+    enum State {
+        STATE_ACTIVE = 0,
+        STATE_IDLE,
+        STATE_COUNT
+    };
+
+    static PowerManager* getInstance();
+
+    // setup()开头调用: 读取唤醒原因、配置电源管理
+    void init();
+    // setup()结束时调用: 记录唤醒(启动)延迟
+    void markReady();
+
+    // 在系统任务中周期调用
+    void service();
+    void notifyActivity();
+
+    State getState() const { return state_; }
+    uint32_t getLoopPeriodMs() const;
+
+    // 按电源状态和环境光模式向UI任务下发帧率/刷新周期
+    void updateDisplayMode();
+    // UI任务应用显示模式后调用(统计空闲退出延迟)
+    void onDisplayModeApplied();
+
+    void enterIdle();
+    bool canDeepSleep() const;
+    bool enterDeepSleep();      // 成功时不返回
+
+    void setIdleTimeout(uint32_t seconds);
+    void setSleepTimeout(uint32_t minutes);
+
+    void printStatus();
+
+private:
+    PowerManager();
+
+    static PowerManager* instance_;
+
+    State state_;
+    uint32_t state_since_ms_;
+    uint32_t state_total_ms_[STATE_COUNT];
+    uint32_t last_activity_ms_;
+    uint32_t idle_timeout_s_;
+    uint32_t sleep_timeout_min_;
+
+    // 唤醒统计
+    int wake_cause_;
+    uint32_t last_sleep_ms_;        // 本次唤醒前的睡眠时长
+    uint32_t boot_ready_ms_;        // 上电/唤醒到setup结束
+    volatile uint32_t resume_pending_ms_;   // 空闲退出请求时间, 0表示无
+    uint32_t resume_last_ms_;
+    uint32_t resume_max_ms_;
+
+    void setState(State state);
+    void applyPowerState(State state);
+    void loadSettings();
+    void saveSettings();
+
+    PowerManager(const PowerManager&) = delete;
+    PowerManager& operator=(const PowerManager&) = delete;
+};
+
+#endif // POWER_MANAGER_H
@@ -0,0 +1,99 @@
+#include "boot_profiler.h"
+
+#define BOOT_TIMELINE_WIDTH 40
+
+static BootProfiler::Phase s_phases[BOOT_PROFILER_MAX_PHASES];
+static uint8_t s_phase_count = 0;
+static int64_t s_finish_us = 0;
+static portMUX_TYPE s_mux = portMUX_INITIALIZER_UNLOCKED;
+
+int8_t BootProfiler::begin(const char* phase)
+{
+    int64_t now = esp_timer_get_time();
+    int8_t id = -1;
+
+    portENTER_CRITICAL(&s_mux);
+    if (s_phase_count < BOOT_PROFILER_MAX_PHASES) {
+        id = (int8_t)s_phase_count++;
+        s_phases[id].name = phase;
+        s_phases[id].start_us = now;
+        s_phases[id].end_us = 0;
+        s_phases[id].core = (uint8_t)xPortGetCoreID();
+    }
+    portEXIT_CRITICAL(&s_mux);
+
+    return id;
+}
+
+void BootProfiler::end(int8_t id)
+{
+    if (id < 0) {
+        return;
+    }
+    int64_t now = esp_timer_get_time();
+
+    portENTER_CRITICAL(&s_mux);
+    s_phases[id].end_us = now;
+    portEXIT_CRITICAL(&s_mux);
+}
+
+void BootProfiler::finish()
+{
+    s_finish_us = esp_timer_get_time();
+}
+
+bool BootProfiler::isFinished()
+{
+    return s_finish_us != 0;
+}
+
+void BootProfiler::printTimeline()
+{
+    Phase phases[BOOT_PROFILER_MAX_PHASES];
+    portENTER_CRITICAL(&s_mux);
+    uint8_t count = s_phase_count;
+    memcpy(phases, s_phases, sizeof(Phase) * count);
+    portEXIT_CRITICAL(&s_mux);
+
+    int64_t total_us = s_finish_us;
+    for (uint8_t i = 0; i < count; i++) {
+        if (phases[i].end_us > total_us) {
+            total_us = phases[i].end_us;
+        }
+    }
+    if (total_us <= 0) {
+        total_us = esp_timer_get_time();
+    }
+
+    Serial.printf("=== Boot Timeline (FAST_BOOT=%d, parallel=%d) ===\r\n", FAST_BOOT, BOOT_PARALLEL_INIT);
+    Serial.println("Phase                 Core  Start(ms)  Dur(ms)  Timeline");
+    Serial.println("--------------------  ----  ---------  -------  ----------------------------------------");
+
+    for (uint8_t i = 0; i < count; i++) {
+        const Phase& p = phases[i];
+        int64_t end_us = p.end_us > 0 ? p.end_us : total_us;
+
+        // 按总时长等比例绘制, 至少一个字符
+        char bar[BOOT_TIMELINE_WIDTH + 1];
+        int from = (int)(p.start_us * BOOT_TIMELINE_WIDTH / total_us);
+        int to = (int)(end_us * BOOT_TIMELINE_WIDTH / total_us);
+        if (to <= from) {
+            to = from + 1;
+        }
+        for (int c = 0; c < BOOT_TIMELINE_WIDTH; c++) {
+            bar[c] = (c >= from && c < to) ? '#' : '.';
+        }
+        bar[BOOT_TIMELINE_WIDTH] = '\0';
+
+        Serial.printf("%-20s  %4u  %9u  %7u%s  %s\r\n",
+                      p.name, p.core, (uint32_t)(p.start_us / 1000),
+                      (uint32_t)((end_us - p.start_us) / 1000),
+                      p.end_us > 0 ? " " : "+", bar);
+    }
+
+    if (s_finish_us > 0) {
+        Serial.printf("Setup finished at %u ms since app start\r\n", (uint32_t)(s_finish_us / 1000));
+    } else {
+        Serial.println("Setup still running ('+' marks unfinished phases)");
+    }
+}
@@ -0,0 +1,66 @@
+#ifndef BOOT_PROFILER_H
+#define BOOT_PROFILER_H
+
+#include <Arduino.h>
+#include <freertos/FreeRTOS.h>
+#include <esp_timer.h>
+
+// 快速启动: 只探测已知I2C地址, 用就绪轮询代替固定延时, 外设并行初始化
+#ifndef FAST_BOOT
+#define FAST_BOOT 1
+#endif
+
+// 并行初始化(SD卡/HSPI、显示屏/VSPI、IMU/I2C分属不同总线)
+#ifndef BOOT_PARALLEL_INIT
+#define BOOT_PARALLEL_INIT FAST_BOOT
+#endif
+
+#define BOOT_PROFILER_MAX_PHASES 32
+
+/**
+ * @brief 启动阶段计时
+ *
+ * 每个初始化阶段记录开始/结束时间(esp_timer, 自应用启动起)及所在核心,
+ * printTimeline() 输出启动时间线, 由setup()结束时及 `task boot` 命令使用。
+ * 可在多个任务中并发调用(并行初始化)。
+ */
+class BootProfiler {
+public:
+    // 开始一个阶段, 返回阶段编号(超出容量返回-1)
+    static int8_t begin(const char* phase);
+    static void end(int8_t id);
+
+    // 启动完成(setup结束)
+    static void finish();
+    static bool isFinished();
+
+    static void printTimeline();
+
+    struct Phase {
+        const char* name;
+        int64_t start_us;
+        int64_t end_us;
+        uint8_t core;
+    };
+};
+
+/**
+ * @brief 作用域阶段计时
+ */
+class BootPhase {
+public:
+    explicit BootPhase(const char* phase) : id_(BootProfiler::begin(phase)) {}
+    ~BootPhase() { BootProfiler::end(id_); }
+
+private:
+    int8_t id_;
+
+    BootPhase(const BootPhase&) = delete;
+    BootPhase& operator=(const BootPhase&) = delete;
+};
+
+#define BOOT_PHASE_CONCAT_INNER(a, b) a##b
+#define BOOT_PHASE_CONCAT(a, b) BOOT_PHASE_CONCAT_INNER(a, b)
+#define BOOT_PHASE(name) BootPhase BOOT_PHASE_CONCAT(_boot_phase_, __LINE__)(name)
+
+#endif // BOOT_PROFILER_H
@@ -0,0 +1,190 @@
+#include "profiler.h"
+#include <freertos/task.h>
+
+// 代码段名称与预算(超过预算计为一次超时)
+struct SectionInfo {
+    const char* name;
+    uint32_t budget_us;
+};
+
+static const SectionInfo kSectionInfo[PROF_SECTION_COUNT] = {
+    { "ui_loop",      33000 },  // 一个刷新周期(LV_DEF_REFR_PERIOD)
+    { "lv_timer",     33000 },
+    { "bird_trigger", 100000 }, // 首帧加载允许较长时间
+    { "sys_loop",     10000 },  // 系统任务周期10ms
+    { "mpu_update",   10000 },
+    { "serial_input", 10000 },
+};
+
+#define PROFILER_MAX_TASKS 24
+
+Profiler* Profiler::instance_ = nullptr;
+
+Profiler* Profiler::getInstance()
+{
+    if (!instance_) {
+        instance_ = new Profiler();
+    }
+    return instance_;
+}
+
+Profiler::Profiler()
+    : last_sample_us_(0)
+    , refresh_interval_ms_(0)
+    , last_refresh_ms_(0)
+{
+    mux_ = portMUX_INITIALIZER_UNLOCKED;
+    memset(stats_, 0, sizeof(stats_));
+    memset(last_, 0, sizeof(last_));
+    last_sample_us_ = esp_timer_get_time();
+}
+
+void Profiler::record(ProfileSection section, uint32_t elapsed_us)
+{
+    if (section >= PROF_SECTION_COUNT) {
+        return;
+    }
+
+    portENTER_CRITICAL(&mux_);
+    SectionStats& s = stats_[section];
+    s.count++;
+    s.total_us += elapsed_us;
+    if (elapsed_us > s.max_us) {
+        s.max_us = elapsed_us;
+    }
+    if (elapsed_us > kSectionInfo[section].budget_us) {
+        s.overruns++;
+    }
+    portEXIT_CRITICAL(&mux_);
+}
+
+void Profiler::reset()
+{
+    portENTER_CRITICAL(&mux_);
+    memset(stats_, 0, sizeof(stats_));
+    memset(last_, 0, sizeof(last_));
+    portEXIT_CRITICAL(&mux_);
+    last_sample_us_ = esp_timer_get_time();
+}
+
+void Profiler::setRefreshInterval(uint32_t interval_ms)
+{
+    refresh_interval_ms_ = interval_ms;
+    last_refresh_ms_ = millis();
+}
+
+void Profiler::service()
+{
+    if (refresh_interval_ms_ == 0) {
+        return;
+    }
+
+    uint32_t now = millis();
+    if (now - last_refresh_ms_ >= refresh_interval_ms_) {
+        last_refresh_ms_ = now;
+        Serial.println("<<<RESPONSE_START>>>");
+        printTop();
+        Serial.println("<<<RESPONSE_END>>>");
+    }
+}
+
+void Profiler::printTop()
+{
+    int64_t now_us = esp_timer_get_time();
+    uint32_t window_us = (uint32_t)(now_us - last_sample_us_);
+    last_sample_us_ = now_us;
+
+    Serial.printf("=== Task Top (window %u ms) ===\r\n", window_us / 1000);
+    printTasks();
+    printSections(window_us);
+}
+
+void Profiler::printTasks()
+{
+#if (configUSE_TRACE_FACILITY == 1) && (configGENERATE_RUN_TIME_STATS == 1)
+    // 上次采样的任务运行时间, 用于计算增量
+    static TaskHandle_t prev_handles[PROFILER_MAX_TASKS];
+    static uint32_t prev_runtime[PROFILER_MAX_TASKS];
+    static UBaseType_t prev_count = 0;
+    static uint32_t prev_total = 0;
+
+    TaskStatus_t* tasks = (TaskStatus_t*)malloc(sizeof(TaskStatus_t) * PROFILER_MAX_TASKS);
+    if (!tasks) {
+        Serial.println("Profiler: out of memory");
+        return;
+    }
+
+    uint32_t total_runtime = 0;
+    UBaseType_t count = uxTaskGetSystemState(tasks, PROFILER_MAX_TASKS, &total_runtime);
+    uint32_t total_delta = total_runtime - prev_total;
+
+    Serial.println("Task              Core  Prio  CPU%   Stack free");
+    Serial.println("----------------  ----  ----  -----  ----------");
+    for (UBaseType_t i = 0; i < count; i++) {
+        uint32_t prev = 0;
+        for (UBaseType_t j = 0; j < prev_count; j++) {
+            if (prev_handles[j] == tasks[i].xHandle) {
+                prev = prev_runtime[j];
+                break;
+            }
+        }
+
+        uint32_t delta = tasks[i].ulRunTimeCounter - prev;
+        float cpu = total_delta > 0 ? (delta * 100.0f / total_delta) : 0.0f;
+
+        int core = -1;
+#if defined(CONFIG_FREERTOS_VTASKLIST_INCLUDE_COREID)
+        core = tasks[i].xCoreID == tskNO_AFFINITY ? -1 : (int)tasks[i].xCoreID;
+#endif
+        char core_str[8];
+        if (core < 0) {
+            snprintf(core_str, sizeof(core_str), "%s", "-");
+        } else {
+            snprintf(core_str, sizeof(core_str), "%d", core);
+        }
+
+        Serial.printf("%-16s  %-4s  %-4u  %5.1f  %u\r\n",
+                      tasks[i].pcTaskName, core_str, (unsigned)tasks[i].uxCurrentPriority,
+                      cpu, (unsigned)tasks[i].usStackHighWaterMark);
+    }
+
+    // 保存快照
+    prev_count = count;
+    for (UBaseType_t i = 0; i < count; i++) {
+        prev_handles[i] = tasks[i].xHandle;
+        prev_runtime[i] = tasks[i].ulRunTimeCounter;
+    }
+    prev_total = total_runtime;
+
+    free(tasks);
+    Serial.println("(CPU% is relative to a single core)");
+#else
+    Serial.println("Per-task CPU% unavailable (configGENERATE_RUN_TIME_STATS disabled)");
+#endif
+}
+
+void Profiler::printSections(uint32_t window_us)
+{
+    SectionStats current[PROF_SECTION_COUNT];
+    portENTER_CRITICAL(&mux_);
+    memcpy(current, stats_, sizeof(current));
+    portEXIT_CRITICAL(&mux_);
+
+    Serial.println("");
+    Serial.println("Section        CPU%   Calls   Avg(us)  Max(us)  Overrun  Budget(us)");
+    Serial.println("-------------  -----  ------  -------  -------  -------  ----------");
+    for (int i = 0; i < PROF_SECTION_COUNT; i++) {
+        uint32_t calls = current[i].count - last_[i].count;
+        uint64_t busy = current[i].total_us - last_[i].total_us;
+        uint32_t overruns = current[i].overruns - last_[i].overruns;
+        uint32_t avg = calls > 0 ? (uint32_t)(busy / calls) : 0;
+        float cpu = window_us > 0 ? (float)(busy * 100.0 / window_us) : 0.0f;
+
+        Serial.printf("%-13s  %5.1f  %6u  %7u  %7u  %7u  %10u\r\n",
+                      kSectionInfo[i].name, cpu, calls, avg, current[i].max_us,
+                      overruns, kSectionInfo[i].budget_us);
+    }
+    Serial.println("(Max is since boot or last reset; other columns cover this window)");
+
+    memcpy(last_, current, sizeof(last_));
+}
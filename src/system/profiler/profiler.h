@@ -0,0 +1,102 @@
+#ifndef PROFILER_H
+#define PROFILER_H
+
+#include <Arduino.h>
+#include <freertos/FreeRTOS.h>
+#include <esp_timer.h>
+
+// 编译期开关: 关闭后PROFILE_SCOPE展开为空, 无任何运行时开销
+#ifndef ENABLE_PROFILER
+#define ENABLE_PROFILER 1
+#endif
+
+// 被统计的代码段
+enum ProfileSection {
+    PROF_UI_LOOP = 0,       // UI任务单次循环(不含阻塞等待)
+    PROF_LV_TIMER,          // screen.routine() / lv_timer_handler()
+    PROF_BIRD_TRIGGER,      // 小鸟触发请求处理(图像加载)
+    PROF_SYS_LOOP,          // 系统任务单次循环
+    PROF_MPU_UPDATE,        // mpu.update()
+    PROF_SERIAL_INPUT,      // 串口命令处理
+    PROF_SECTION_COUNT
+};
+
+/**
+ * @brief 轻量级性能分析器
+ *
+ * - 代码段计时: PROFILE_SCOPE(section) 在作用域结束时记录耗时(esp_timer, 微秒)
+ *   统计次数/累计/最大耗时, 超过该段预算(周期)即计为一次超时
+ * - 任务CPU占用: 基于FreeRTOS运行时统计(需 configGENERATE_RUN_TIME_STATS)
+ * - 输出: printTop() 打印自上次调用以来的增量数据, 由 `task top` 命令使用
+ */
+class Profiler {
+public:
+    static Profiler* getInstance();
+
+    // 记录一次代码段执行
+    void record(ProfileSection section, uint32_t elapsed_us);
+
+    // 打印自上次调用以来的任务/代码段CPU占用
+    void printTop();
+
+    // 清空统计
+    void reset();
+
+    // 周期刷新(在系统任务中调用), interval_ms为0表示关闭
+    void setRefreshInterval(uint32_t interval_ms);
+    uint32_t getRefreshInterval() const { return refresh_interval_ms_; }
+    void service();
+
+private:
+    Profiler();
+
+    struct SectionStats {
+        uint32_t count;
+        uint32_t max_us;
+        uint32_t overruns;
+        uint64_t total_us;
+    };
+
+    static Profiler* instance_;
+
+    SectionStats stats_[PROF_SECTION_COUNT];
+    SectionStats last_[PROF_SECTION_COUNT];     // 上次printTop时的快照
+    int64_t last_sample_us_;
+    portMUX_TYPE mux_;
+
+    uint32_t refresh_interval_ms_;
+    uint32_t last_refresh_ms_;
+
+    void printTasks();
+    void printSections(uint32_t window_us);
+
+    Profiler(const Profiler&) = delete;
+    Profiler& operator=(const Profiler&) = delete;
+};
+
+/**
+ * @brief 作用域计时器, 析构时将耗时记录到Profiler
+ */
+class ProfileScope {
+public:
+    explicit ProfileScope(ProfileSection section)
+        : section_(section), start_us_(esp_timer_get_time()) {}
+
+    ~ProfileScope() {
+        Profiler::getInstance()->record(section_, (uint32_t)(esp_timer_get_time() - start_us_));
+    }
+
+private:
+    ProfileSection section_;
+    int64_t start_us_;
+};
+
+#if ENABLE_PROFILER
+#define PROFILE_CONCAT_INNER(a, b) a##b
+#define PROFILE_CONCAT(a, b) PROFILE_CONCAT_INNER(a, b)
+#define PROFILE_SCOPE(section) ProfileScope PROFILE_CONCAT(_profile_scope_, __LINE__)(section)
+#else
+#define PROFILE_SCOPE(section) do {} while (0)
+#endif
+
+#endif // PROFILER_H
@@ -0,0 +1,371 @@
+#ifndef MESSAGE_BUS_H
+#define MESSAGE_BUS_H
+
+#include <Arduino.h>
+#include <freertos/FreeRTOS.h>
+#include <freertos/queue.h>
+#include <esp_timer.h>
+#include <new>
+#include <utility>
+
+/**
+ * @brief 类型化任务间消息总线 (header-only)
+ *
+ * 设计要点:
+ * - 消息类型在编译期绑定消息ID: 每个负载结构体声明 kId / kPoolSize / kCoalesce
+ * - 队列中只传递固定大小的信封(Envelope)，负载存放在按类型划分的对象池中，
+ *   接收方通过 take<T>() 取得所有权(零拷贝)，MessagePtr析构时归还槽位
+ * - kCoalesce=true 的消息在尚未被消费时会被合并(后到的覆盖先到的)，避免重复触发
+ * - 投递为非阻塞: 队列满时直接丢弃并计数，不会阻塞发送方
+ *   (已合并到该负载、尚未入队的消息一并计入丢弃数)
+ * - 每个通道统计高水位、丢弃数、合并数以及端到端延迟(投递→处理完成)
+ *
+ * 负载结构体示例:
+ *   struct FooMsg {
+ *       static constexpr uint16_t kId = MSG_FOO;
+ *       static constexpr uint8_t kPoolSize = 4;
+ *       static constexpr bool kCoalesce = false;
+ *       uint32_t value;
+ *   };
+ */
+namespace MessageBus {
+
+constexpr uint8_t NO_SLOT = 0xFF;
+
+// 队列中传递的信封(12字节)
+struct Envelope {
+    uint16_t id;        // 消息ID
+    uint8_t slot;       // 负载在对象池中的槽位, NO_SLOT表示无负载(纯信号)
+    uint8_t reserved;
+    uint32_t post_us;   // 投递时间戳(esp_timer低32位, 仅用于计算差值)
+    uint32_t param;     // 附加参数(纯信号消息使用)
+};
+
+// 单个通道的统计信息
+struct QueueMetrics {
+    uint32_t posted;            // 成功投递数
+    uint32_t handled;           // 已处理数
+    uint32_t dropped;           // 队列满或对象池耗尽导致的丢弃数
+    uint32_t coalesced;         // 被合并的消息数
+    uint32_t high_water;        // 队列深度高水位
+    uint32_t latency_max_us;    // 最大端到端延迟
+    uint64_t latency_total_us;  // 累计端到端延迟(用于计算平均值)
+};
+
+/**
+ * @brief 固定槽位的负载对象池
+ *
+ * 每种消息类型一个池，由 poolFor<T>() 提供单例。
+ * 对于可合并消息，pending_ 记录尚在队列中的槽位，merges_ 记录合并到该槽位的消息数。
+ */
+template<typename T, uint8_t N>
+class PayloadPool {
+    static_assert(N > 0 && N <= 32, "PayloadPool supports 1..32 slots");
+
+public:
+    PayloadPool() : free_mask_(N == 32 ? 0xFFFFFFFFu : ((1u << N) - 1)), pending_(NO_SLOT), merges_(0) {
+        mux_ = portMUX_INITIALIZER_UNLOCKED;
+    }
+
+    T* at(uint8_t slot) {
+        return reinterpret_cast<T*>(storage_[slot]);
+    }
+
+    portMUX_TYPE* mux() { return &mux_; }
+
+    // 以下函数调用方必须持有mux
+    uint8_t acquireLocked() {
+        if (free_mask_ == 0) {
+            return NO_SLOT;
+        }
+        uint8_t slot = __builtin_ctz(free_mask_);
+        free_mask_ &= ~(1u << slot);
+        return slot;
+    }
+
+    void releaseLocked(uint8_t slot) {
+        if (pending_ == slot) {
+            pending_ = NO_SLOT;
+        }
+        free_mask_ |= (1u << slot);
+    }
+
+    uint8_t pendingLocked() const { return pending_; }
+    void setPendingLocked(uint8_t slot) {
+        pending_ = slot;
+        merges_ = 0;
+    }
+
+    void countMergeLocked() { merges_++; }
+    uint32_t mergesLocked() const { return merges_; }
+
+    void release(uint8_t slot) {
+        at(slot)->~T();
+        portENTER_CRITICAL(&mux_);
+        releaseLocked(slot);
+        portEXIT_CRITICAL(&mux_);
+    }
+
+private:
+    alignas(T) uint8_t storage_[N][sizeof(T)];
+    uint32_t free_mask_;
+    uint8_t pending_;
+    uint32_t merges_;
+    portMUX_TYPE mux_;
+};
+
+template<typename T>
+inline PayloadPool<T, T::kPoolSize>& poolFor() {
+    static PayloadPool<T, T::kPoolSize> pool;
+    return pool;
+}
+
+/**
+ * @brief 负载所有权句柄(仅可移动)，析构时归还对象池槽位
+ */
+template<typename T>
+class MessagePtr {
+public:
+    MessagePtr() : slot_(NO_SLOT) {}
+    explicit MessagePtr(uint8_t slot) : slot_(slot) {}
+    MessagePtr(MessagePtr&& other) : slot_(other.slot_) { other.slot_ = NO_SLOT; }
+    MessagePtr& operator=(MessagePtr&& other) {
+        if (this != &other) {
+            reset();
+            slot_ = other.slot_;
+            other.slot_ = NO_SLOT;
+        }
+        return *this;
+    }
+    ~MessagePtr() { reset(); }
+
+    MessagePtr(const MessagePtr&) = delete;
+    MessagePtr& operator=(const MessagePtr&) = delete;
+
+    explicit operator bool() const { return slot_ != NO_SLOT; }
+    T* get() const { return slot_ != NO_SLOT ? poolFor<T>().at(slot_) : nullptr; }
+    T* operator->() const { return get(); }
+    T& operator*() const { return *get(); }
+
+    void reset() {
+        if (slot_ != NO_SLOT) {
+            poolFor<T>().release(slot_);
+            slot_ = NO_SLOT;
+        }
+    }
+
+private:
+    uint8_t slot_;
+};
+
+/**
+ * @brief 单个接收方的消息通道(FreeRTOS队列 + 统计)
+ *
+ * 接收方用法:
+ *   Envelope env;
+ *   while (channel.receive(env, timeout)) {
+ *       switch (env.id) {
+ *           case MSG_FOO: { auto msg = channel.take<FooMsg>(env); ... break; }
+ *       }
+ *       channel.complete(env);   // 记录延迟
+ *   }
+ */
+template<uint8_t Capacity>
+class Channel {
+public:
+    Channel() : queue_(nullptr) {
+        mux_ = portMUX_INITIALIZER_UNLOCKED;
+        resetMetrics();
+    }
+
+    ~Channel() {
+        if (queue_) {
+            vQueueDelete(queue_);
+        }
+    }
+
+    bool init() {
+        if (!queue_) {
+            queue_ = xQueueCreate(Capacity, sizeof(Envelope));
+        }
+        return queue_ != nullptr;
+    }
+
+    bool isReady() const { return queue_ != nullptr; }
+
+    // 投递带负载的消息(非阻塞)
+    template<typename T>
+    bool post(const T& payload) {
+        if (!queue_) {
+            return false;
+        }
+
+        PayloadPool<T, T::kPoolSize>& pool = poolFor<T>();
+        uint8_t slot;
+
+        portENTER_CRITICAL(pool.mux());
+        if (T::kCoalesce && pool.pendingLocked() != NO_SLOT) {
+            // 同类消息尚未被消费: 原地覆盖，不再占用队列
+            *pool.at(pool.pendingLocked()) = payload;
+            pool.countMergeLocked();
+            portEXIT_CRITICAL(pool.mux());
+            countCoalesced();
+            return true;
+        }
+        slot = pool.acquireLocked();
+        if (slot != NO_SLOT) {
+            // 负载为POD，在临界区内构造，保证合并覆盖不会早于构造
+            new (pool.at(slot)) T(payload);
+            if (T::kCoalesce) {
+                pool.setPendingLocked(slot);
+            }
+        }
+        portEXIT_CRITICAL(pool.mux());
+
+        if (slot == NO_SLOT) {
+            countDropped();
+            return false;
+        }
+
+        Envelope env;
+        env.id = T::kId;
+        env.slot = slot;
+        env.reserved = 0;
+        env.post_us = (uint32_t)esp_timer_get_time();
+        env.param = 0;
+
+        if (!send(env)) {
+            // 入队前已有消息合并到该槽位(其post已返回true): 随本消息一起丢弃, 从合并数转入丢弃数
+            uint32_t merges = 0;
+            if (T::kCoalesce) {
+                portENTER_CRITICAL(pool.mux());
+                if (pool.pendingLocked() == slot) {
+                    merges = pool.mergesLocked();
+                    pool.setPendingLocked(NO_SLOT);
+                }
+                portEXIT_CRITICAL(pool.mux());
+            }
+            pool.release(slot);
+            if (merges > 0) {
+                countMergesDropped(merges);
+            }
+            return false;
+        }
+        return true;
+    }
+
+    // 投递无负载的信号消息(非阻塞)
+    bool signal(uint16_t id, uint32_t param = 0) {
+        if (!queue_) {
+            return false;
+        }
+        Envelope env;
+        env.id = id;
+        env.slot = NO_SLOT;
+        env.reserved = 0;
+        env.post_us = (uint32_t)esp_timer_get_time();
+        env.param = param;
+        return send(env);
+    }
+
+    bool receive(Envelope& env, TickType_t wait) {
+        if (!queue_) {
+            return false;
+        }
+        return xQueueReceive(queue_, &env, wait) == pdTRUE;
+    }
+
+    // 领取负载所有权; 之后同类可合并消息将重新入队而不是覆盖本负载
+    template<typename T>
+    MessagePtr<T> take(Envelope& env) {
+        if (env.id != T::kId || env.slot == NO_SLOT) {
+            return MessagePtr<T>();
+        }
+        uint8_t slot = env.slot;
+        env.slot = NO_SLOT;
+        if (T::kCoalesce) {
+            PayloadPool<T, T::kPoolSize>& pool = poolFor<T>();
+            portENTER_CRITICAL(pool.mux());
+            if (pool.pendingLocked() == slot) {
+                pool.setPendingLocked(NO_SLOT);
+            }
+            portEXIT_CRITICAL(pool.mux());
+        }
+        return MessagePtr<T>(slot);
+    }
+
+    // 处理完成: 记录端到端延迟
+    // 注意: 带负载的消息必须在complete之前通过take()领取，否则负载会泄漏在池中
+    void complete(const Envelope& env) {
+        uint32_t latency = (uint32_t)esp_timer_get_time() - env.post_us;
+        portENTER_CRITICAL(&mux_);
+        metrics_.handled++;
+        metrics_.latency_total_us += latency;
+        if (latency > metrics_.latency_max_us) {
+            metrics_.latency_max_us = latency;
+        }
+        portEXIT_CRITICAL(&mux_);
+    }
+
+    QueueMetrics metrics() {
+        portENTER_CRITICAL(&mux_);
+        QueueMetrics copy = metrics_;
+        portEXIT_CRITICAL(&mux_);
+        return copy;
+    }
+
+    void resetMetrics() {
+        portENTER_CRITICAL(&mux_);
+        metrics_ = QueueMetrics();
+        portEXIT_CRITICAL(&mux_);
+    }
+
+    uint32_t depth() const {
+        return queue_ ? (uint32_t)uxQueueMessagesWaiting(queue_) : 0;
+    }
+
+    static constexpr uint8_t capacity() { return Capacity; }
+
+private:
+    QueueHandle_t queue_;
+    QueueMetrics metrics_;
+    portMUX_TYPE mux_;
+
+    bool send(const Envelope& env) {
+        if (xQueueSend(queue_, &env, 0) != pdTRUE) {
+            countDropped();
+            return false;
+        }
+        uint32_t depth = Capacity - (uint32_t)uxQueueSpacesAvailable(queue_);
+        portENTER_CRITICAL(&mux_);
+        metrics_.posted++;
+        if (depth > metrics_.high_water) {
+            metrics_.high_water = depth;
+        }
+        portEXIT_CRITICAL(&mux_);
+        return true;
+    }
+
+    void countDropped() {
+        portENTER_CRITICAL(&mux_);
+        metrics_.dropped++;
+        portEXIT_CRITICAL(&mux_);
+    }
+
+    void countCoalesced() {
+        portENTER_CRITICAL(&mux_);
+        metrics_.coalesced++;
+        portEXIT_CRITICAL(&mux_);
+    }
+
+    void countMergesDropped(uint32_t merges) {
+        portENTER_CRITICAL(&mux_);
+        metrics_.coalesced -= merges < metrics_.coalesced ? merges : metrics_.coalesced;
+        metrics_.dropped += merges;
+        portEXIT_CRITICAL(&mux_);
+    }
+};
+
+} // namespace MessageBus
+
+#endif // MESSAGE_BUS_H
@@ -2,8 +2,14 @@
 #include "system/logging/log_manager.h"
 #include "drivers/display/display.h"
 #include "drivers/sensors/imu/imu.h"
+#include "drivers/sensors/imu/imu_recorder.h"
+#include "drivers/storage/sd_card/sd_card.h"
 #include "drivers/io/rgb_led/rgb_led.h"
 #include "system/commands/serial_commands.h"
+#include "system/profiler/profiler.h"
+#include "system/memory/mem_tracker.h"
+#include "system/power/ambient_governor.h"
+#include "system/power/power_manager.h"
 #include "applications/modules/bird_watching/core/bird_watching.h"
 #include "applications/gui/core/lv_cubic_gui.h"
 
@@ -17,20 +23,12 @@ TaskManager* TaskManager::instance_ = nullptr;
 TaskManager::TaskManager()
     : ui_task_handle_(nullptr)
     , system_task_handle_(nullptr)
-    , ui_queue_(nullptr)
-    , system_queue_(nullptr)
     , lvgl_mutex_(nullptr)
 {
 }
 
 TaskManager::~TaskManager()
 {
-    if (ui_queue_) {
-        vQueueDelete(ui_queue_);
-    }
-    if (system_queue_) {
-        vQueueDelete(system_queue_);
-    }
     if (lvgl_mutex_) {
         vSemaphoreDelete(lvgl_mutex_);
     }
@@ -48,15 +46,13 @@ bool TaskManager::initialize()
 {
     LOG_INFO("TASK_MGR", "Initializing Task Manager...");
 
-    // 创建消息队列
-    ui_queue_ = xQueueCreate(10, sizeof(TaskMessage));
-    if (!ui_queue_) {
+    // 创建消息总线
+    if (!ui_bus_.init()) {
         LOG_ERROR("TASK_MGR", "Failed to create UI queue");
         return false;
     }
 
-    system_queue_ = xQueueCreate(20, sizeof(TaskMessage));
-    if (!system_queue_) {
+    if (!system_bus_.init()) {
         LOG_ERROR("TASK_MGR", "Failed to create System queue");
         return false;
     }
@@ -114,20 +110,9 @@ bool TaskManager::startTasks()
     return true;
 }
 
-bool TaskManager::sendToUITask(const TaskMessage& msg)
-{
-    if (!ui_queue_) {
-        return false;
-    }
-    return xQueueSend(ui_queue_, &msg, pdMS_TO_TICKS(100)) == pdTRUE;
-}
-
-bool TaskManager::sendToSystemTask(const TaskMessage& msg)
+void TaskManager::wakeUITask()
 {
-    if (!system_queue_) {
-        return false;
-    }
-    return xQueueSend(system_queue_, &msg, pdMS_TO_TICKS(100)) == pdTRUE;
+    ui_bus_.signal(MSG_WAKE_UI);
 }
 
 bool TaskManager::takeLVGLMutex(uint32_t timeout_ms)
@@ -135,7 +120,9 @@ bool TaskManager::takeLVGLMutex(uint32_t timeout_ms)
     if (!lvgl_mutex_) {
         return false;
     }
-    return xSemaphoreTake(lvgl_mutex_, pdMS_TO_TICKS(timeout_ms)) == pdTRUE;
+    // portMAX_DELAY表示一直等待, 不能再按毫秒换算
+    TickType_t ticks = timeout_ms == portMAX_DELAY ? portMAX_DELAY : pdMS_TO_TICKS(timeout_ms);
+    return xSemaphoreTake(lvgl_mutex_, ticks) == pdTRUE;
 }
 
 void TaskManager::giveLVGLMutex()
@@ -167,6 +154,62 @@ void TaskManager::printTaskStats()
     LOG_INFO("TASK_MGR", buffer);
 }
 
+// 打印单个通道的统计信息
+template<uint8_t Capacity>
+static void printChannelStats(const char* name, MessageBus::Channel<Capacity>& channel)
+{
+    MessageBus::QueueMetrics m = channel.metrics();
+    uint32_t avg_us = m.handled > 0 ? (uint32_t)(m.latency_total_us / m.handled) : 0;
+
+    Serial.printf("%-10s depth %u/%u  high-water %u\r\n",
+                  name, channel.depth(), (unsigned)Capacity, m.high_water);
+    Serial.printf("           posted %u  handled %u  dropped %u  coalesced %u\r\n",
+                  m.posted, m.handled, m.dropped, m.coalesced);
+    Serial.printf("           latency avg %u us  max %u us\r\n", avg_us, m.latency_max_us);
+}
+
+void TaskManager::printBusStats()
+{
+    Serial.println("=== Message Bus Statistics ===");
+    printChannelStats("UI bus", ui_bus_);
+    printChannelStats("System bus", system_bus_);
+}
+
+void TaskManager::resetBusStats()
+{
+    ui_bus_.resetMetrics();
+    system_bus_.resetMetrics();
+}
+
+void TaskManager::dispatchGesture(int gesture)
+{
+    // 将手势类型转发给BirdWatching系统
+    // BirdManager会根据当前状态决定如何响应; 触发请求经消息总线投递给UI任务
+    switch (gesture) {
+        case GESTURE_FORWARD_HOLD:
+            LOG_INFO("SYS_TASK", "Forward hold detected");
+            break;
+
+        case GESTURE_BACKWARD_HOLD:
+            LOG_INFO("SYS_TASK", "Backward hold detected");
+            break;
+
+        case GESTURE_LEFT_TILT:
+            LOG_DEBUG("SYS_TASK", "Left tilt detected");
+            break;
+
+        case GESTURE_RIGHT_TILT:
+            LOG_DEBUG("SYS_TASK", "Right tilt detected");
+            break;
+
+        default:
+            return;
+    }
+
+    PowerManager::getInstance()->notifyActivity();
+    BirdWatching::onGesture(gesture);
+}
+
 /**
  * @brief UI任务函数 - 运行在Core 0
  * 
@@ -175,57 +218,87 @@ void TaskManager::printTaskStats()
  * - Display驱动 (screen.routine)
  * - BirdAnimation动画播放
  * - 图片解码和渲染
+ *
+ * 调度方式: 事件驱动。任务阻塞在消息队列上, 直到收到消息或
+ * lv_timer_handler()返回的下一个LVGL定时器到期, 空闲时不再空转。
  */
 void TaskManager::uiTaskFunction(void* parameter)
 {
     TaskManager* manager = static_cast<TaskManager*>(parameter);
     LOG_INFO("UI_TASK", "UI Task started on Core 0");
 
-    TaskMessage msg;
-    TickType_t lastWakeTime = xTaskGetTickCount();
-    const TickType_t taskPeriod = pdMS_TO_TICKS(5); // 5ms周期 = 200Hz
+    MessageBus::Envelope env;
+    uint32_t idle_ms = UI_TASK_MIN_IDLE_MS;
 
     while (true) {
-        // 处理消息队列(非阻塞)
-        while (xQueueReceive(manager->ui_queue_, &msg, 0) == pdTRUE) {
-            // 处理UI相关消息
-            switch (msg.type) {
-                case MSG_TRIGGER_BIRD:
-                    // 触发小鸟动画
-                    if (manager->takeLVGLMutex(100)) {
-                        BirdWatching::triggerBird();
-                        manager->giveLVGLMutex();
+        // 阻塞等待消息, 超时即LVGL下一个定时器到期
+        if (manager->ui_bus_.receive(env, pdMS_TO_TICKS(idle_ms))) {
+            do {
+                // 处理UI相关消息
+                switch (env.id) {
+                    case MSG_TRIGGER_BIRD: {
+                        // 处理小鸟触发请求(必须在UI任务中执行)
+                        // 注意: 图像加载可能耗时较长，但已优化为分块加载
+                        // 消息取出后不能再丢: UI任务是唯一消费者且此时未持锁, 一直等到拿到LVGL锁
+                        MessageBus::MessagePtr<BirdTriggerMsg> request =
+                            manager->ui_bus_.take<BirdTriggerMsg>(env);
+                        if (request && manager->takeLVGLMutex()) {
+                            PROFILE_SCOPE(PROF_BIRD_TRIGGER);
+                            BirdWatching::handleTriggerRequest(*request);
+                            manager->giveLVGLMutex();
+                        }
+                        break;
                     }
-                    break;
-                
-                default:
-                    break;
-            }
+
+                    case MSG_DISPLAY_MODE: {
+                        // 环境光调节: 动画帧率与LVGL刷新周期
+                        MessageBus::MessagePtr<DisplayModeMsg> mode =
+                            manager->ui_bus_.take<DisplayModeMsg>(env);
+                        if (mode && manager->takeLVGLMutex()) {
+                            screen.setRefreshPeriod(mode->refresh_period_ms);
+                            BirdWatching::setFrameInterval(mode->frame_interval_ms);
+                            manager->giveLVGLMutex();
+                            PowerManager::getInstance()->onDisplayModeApplied();
+                        }
+                        break;
+                    }
+
+                    case MSG_WAKE_UI:
+                        // 仅用于唤醒, 实际处理在下方
+                        break;
+
+                    default:
+                        break;
+                }
+                manager->ui_bus_.complete(env);
+            } while (manager->ui_bus_.receive(env, 0));
         }
 
         // 获取LVGL互斥锁并更新UI
         if (manager->takeLVGLMutex(10)) {
+            PROFILE_SCOPE(PROF_UI_LOOP);
+
             // 检查logo显示超时（必须在UI任务中执行）
             lv_check_logo_timeout();
-            
-            // 处理BirdWatching触发请求(必须在UI任务中执行)
-            // 注意: 图像加载可能耗时较长，但已优化为分块加载
-            BirdWatching::processBirdTriggerRequest();
 
-            // LVGL定时器处理
-            lv_timer_handler();
-            
-            // Display驱动更新
-            screen.routine();
+            // LVGL定时器处理(tick由esp_timer提供), 返回下一个定时器到期时间
+            {
+                PROFILE_SCOPE(PROF_LV_TIMER);
+                idle_ms = screen.routine();
+            }
             
             manager->giveLVGLMutex();
         } else {
-            // 如果无法获取互斥锁，让出CPU避免死锁
-            vTaskDelay(1);
+            // 如果无法获取互斥锁，稍后重试
+            idle_ms = UI_TASK_MIN_IDLE_MS;
         }
 
-        // 精确延时,保证稳定的刷新率
-        vTaskDelayUntil(&lastWakeTime, taskPeriod);
+        // LV_NO_TIMER_READY 等超大值也会被限制到最长等待时间
+        if (idle_ms < UI_TASK_MIN_IDLE_MS) {
+            idle_ms = UI_TASK_MIN_IDLE_MS;
+        } else if (idle_ms > UI_TASK_MAX_IDLE_MS) {
+            idle_ms = UI_TASK_MAX_IDLE_MS;
+        }
     }
 }
 
@@ -245,82 +318,76 @@ void TaskManager::systemTaskFunction(void* parameter)
     TaskManager* manager = static_cast<TaskManager*>(parameter);
     LOG_INFO("SYS_TASK", "System Task started on Core 1");
 
-    TaskMessage msg;
+    MessageBus::Envelope env;
     TickType_t lastWakeTime = xTaskGetTickCount();
-    const TickType_t taskPeriod = pdMS_TO_TICKS(10); // 10ms周期 = 100Hz
-
-    unsigned long lastMPUUpdate = 0;
-    const unsigned long MPU_UPDATE_INTERVAL = 200; // 200ms更新一次IMU
+    PowerManager* power = PowerManager::getInstance();
 
     while (true) {
-        unsigned long currentTime = millis();
+#if ENABLE_PROFILER
+        int64_t loopStart = esp_timer_get_time();
+#endif
 
         // 处理消息队列(非阻塞)
-        while (xQueueReceive(manager->system_queue_, &msg, 0) == pdTRUE) {
+        while (manager->system_bus_.receive(env, 0)) {
             // 处理系统相关消息
-            switch (msg.type) {
-                case MSG_GESTURE_EVENT:
-                    // 处理手势事件
+            switch (env.id) {
+                case MSG_GESTURE_EVENT: {
+                    // 处理外部注入的手势事件
+                    MessageBus::MessagePtr<GestureEventMsg> event =
+                        manager->system_bus_.take<GestureEventMsg>(env);
+                    if (event) {
+                        manager->dispatchGesture(event->gesture);
+                    }
                     break;
-                
+                }
+
                 default:
                     break;
             }
+            manager->system_bus_.complete(env);
         }
 
-        // 更新IMU数据 (200ms间隔)
-        if (currentTime - lastMPUUpdate >= MPU_UPDATE_INTERVAL) {
+        // 更新IMU数据: 内部按IMU_DRAIN_INTERVAL_MS(或INT引脚累计样本数)批量读取FIFO
+        {
+            PROFILE_SCOPE(PROF_MPU_UPDATE);
             mpu.update(0); // 不使用内部延时
-            lastMPUUpdate = currentTime;
-
-            // 检测手势并触发相应事件
-            GestureType gesture = mpu.detectGesture();
-            if (gesture != GESTURE_NONE) {
-                // 将手势类型转发给BirdWatching系统
-                // BirdManager会根据当前状态决定如何响应
-                switch (gesture) {
-                    case GESTURE_FORWARD_HOLD:
-                        LOG_INFO("SYS_TASK", "Forward hold detected (1s)");
-                        if (manager->takeLVGLMutex(100)) {
-                            BirdWatching::onGesture(GESTURE_FORWARD_HOLD);
-                            manager->giveLVGLMutex();
-                        }
-                        break;
-                    
-                    case GESTURE_BACKWARD_HOLD:
-                        LOG_INFO("SYS_TASK", "Backward hold detected (1s)");
-                        if (manager->takeLVGLMutex(100)) {
-                            BirdWatching::onGesture(GESTURE_BACKWARD_HOLD);
-                            manager->giveLVGLMutex();
-                        }
-                        break;
-                    
-                    case GESTURE_LEFT_TILT:
-                        LOG_DEBUG("SYS_TASK", "Left tilt detected");
-                        if (manager->takeLVGLMutex(100)) {
-                            BirdWatching::onGesture(GESTURE_LEFT_TILT);
-                            manager->giveLVGLMutex();
-                        }
-                        break;
-                    
-                    case GESTURE_RIGHT_TILT:
-                        LOG_DEBUG("SYS_TASK", "Right tilt detected");
-                        if (manager->takeLVGLMutex(100)) {
-                            BirdWatching::onGesture(GESTURE_RIGHT_TILT);
-                            manager->giveLVGLMutex();
-                        }
-                        break;
-                    
-                    default:
-                        break;
-                }
-            }
         }
 
+        // IMU轨迹录制超时检查(样本由IMU回调写入)
+        imuRecorder.service();
+
+        // 检测手势并触发相应事件(消费本次读取到的所有样本)
+        GestureType gesture = mpu.detectGesture();
+        if (gesture != GESTURE_NONE) {
+            manager->dispatchGesture(gesture);
+        }
+
+        // 堆内存采样(内部按MEM_SAMPLE_INTERVAL_MS节流)
+        MemTracker::service();
+
+        // SD卡链路稳定后安排下次启动升频
+        tf.service();
+
+        // 环境光采样(内部节流)与背光渐变
+        AmbientGovernor::getInstance()->service();
+        screen.updateBackLight();
+
+        // 电源状态: 无手势超时进入空闲/深度睡眠
+        power->service();
+
         // 处理串口命令
-        SerialCommands::getInstance()->handleInput();
+        {
+            PROFILE_SCOPE(PROF_SERIAL_INPUT);
+            SerialCommands::getInstance()->handleInput();
+        }
+
+#if ENABLE_PROFILER
+        // 记录本次循环耗时(超过10ms周期即为超时), 并按需刷新 `task top`
+        Profiler::getInstance()->record(PROF_SYS_LOOP, (uint32_t)(esp_timer_get_time() - loopStart));
+        Profiler::getInstance()->service();
+#endif
 
-        // 任务延时
-        vTaskDelayUntil(&lastWakeTime, taskPeriod);
+        // 任务延时: ACTIVE 10ms(100Hz), IDLE 50ms
+        vTaskDelayUntil(&lastWakeTime, pdMS_TO_TICKS(power->getLoopPeriodMs()));
     }
 }
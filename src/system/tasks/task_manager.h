@@ -6,6 +6,8 @@
 #include <freertos/task.h>
 #include <freertos/queue.h>
 #include <freertos/semphr.h>
+#include "message_bus.h"
+#include "task_messages.h"
 
 // 任务配置
 #define UI_TASK_STACK_SIZE      8192    // UI任务栈大小(8KB)
@@ -15,22 +17,13 @@
 #define UI_TASK_CORE            0       // UI任务运行在Core 0 (Protocol Core)
 #define SYSTEM_TASK_CORE        1       // 系统任务运行在Core 1 (Application Core)
 
-// 任务间消息类型
-enum TaskMessageType {
-    MSG_TRIGGER_BIRD = 0,      // 触发小鸟动画
-    MSG_UPDATE_CONFIG,         // 更新配置
-    MSG_SHOW_STATS,           // 显示统计信息
-    MSG_GESTURE_EVENT,        // 手势事件
-    MSG_SYSTEM_EVENT          // 系统事件
-};
+// UI任务调度: 阻塞等待消息, 超时时间由lv_timer_handler()返回的下一个定时器到期时间决定
+#define UI_TASK_MIN_IDLE_MS     1       // 最短等待时间(至少让出1个tick给IDLE任务喂狗)
+#define UI_TASK_MAX_IDLE_MS     50      // 最长等待时间(保证logo超时等轮询逻辑及时执行)
 
-// 任务间消息结构
-struct TaskMessage {
-    TaskMessageType type;
-    uint32_t param1;
-    uint32_t param2;
-    void* data;
-};
+// 消息队列容量
+#define UI_BUS_CAPACITY         10
+#define SYSTEM_BUS_CAPACITY     20
 
 /**
  * @brief 双核任务管理器
@@ -49,11 +42,16 @@ public:
     // 启动所有任务
     bool startTasks();
 
-    // 发送消息到UI任务
-    bool sendToUITask(const TaskMessage& msg);
+    // 发送消息到UI任务(非阻塞, 负载类型见task_messages.h)
+    template<typename M>
+    bool sendToUITask(const M& msg) { return ui_bus_.post(msg); }
+
+    // 发送消息到系统任务(非阻塞)
+    template<typename M>
+    bool sendToSystemTask(const M& msg) { return system_bus_.post(msg); }
 
-    // 发送消息到系统任务
-    bool sendToSystemTask(const TaskMessage& msg);
+    // 唤醒UI任务(非阻塞, 队列满时说明UI任务已有待处理消息, 直接忽略)
+    void wakeUITask();
 
     // 获取LVGL互斥锁(在访问LVGL对象前必须获取)
     bool takeLVGLMutex(uint32_t timeout_ms = portMAX_DELAY);
@@ -66,6 +64,10 @@ public:
     // 任务统计信息
     void printTaskStats();
 
+    // 消息总线统计(队列深度/高水位/丢弃/合并/延迟)
+    void printBusStats();
+    void resetBusStats();
+
 private:
     TaskManager();
     ~TaskManager();
@@ -76,9 +78,9 @@ private:
     TaskHandle_t ui_task_handle_;
     TaskHandle_t system_task_handle_;
 
-    // 消息队列
-    QueueHandle_t ui_queue_;
-    QueueHandle_t system_queue_;
+    // 消息总线
+    MessageBus::Channel<UI_BUS_CAPACITY> ui_bus_;
+    MessageBus::Channel<SYSTEM_BUS_CAPACITY> system_bus_;
 
     // LVGL互斥锁(保护LVGL对象访问)
     SemaphoreHandle_t lvgl_mutex_;
@@ -87,6 +89,9 @@ private:
     static void uiTaskFunction(void* parameter);
     static void systemTaskFunction(void* parameter);
 
+    // 手势分发(系统任务中调用)
+    void dispatchGesture(int gesture);
+
     // 禁止拷贝
     TaskManager(const TaskManager&) = delete;
     TaskManager& operator=(const TaskManager&) = delete;
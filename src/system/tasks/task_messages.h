@@ -0,0 +1,57 @@
+#ifndef TASK_MESSAGES_H
+#define TASK_MESSAGES_H
+
+#include <stdint.h>
+
+// 任务间消息ID
+enum TaskMessageType : uint16_t {
+    MSG_TRIGGER_BIRD = 0,      // 触发小鸟动画
+    MSG_UPDATE_CONFIG,         // 更新配置
+    MSG_SHOW_STATS,           // 显示统计信息
+    MSG_GESTURE_EVENT,        // 手势事件
+    MSG_SYSTEM_EVENT,         // 系统事件
+    MSG_WAKE_UI,              // 唤醒UI任务(状态已变更, 需要立即处理)
+    MSG_DISPLAY_MODE          // 显示刷新策略(环境光调节帧率)
+};
+
+/**
+ * 消息负载定义 (配合 message_bus.h 使用)
+ * - kId:       绑定的消息ID
+ * - kPoolSize: 对象池槽位数(同时在途的最大消息数)
+ * - kCoalesce: 未消费时是否合并(后到的覆盖先到的)
+ */
+
+// 小鸟触发请求 → UI任务
+// 连续触发只保留最后一次请求, 避免UI任务积压多次图像加载
+struct BirdTriggerMsg {
+    static constexpr uint16_t kId = MSG_TRIGGER_BIRD;
+    static constexpr uint8_t kPoolSize = 2;
+    static constexpr bool kCoalesce = true;
+
+    uint16_t bird_id;       // 0表示随机
+    uint8_t trigger_type;   // BirdWatching::TriggerType
+    bool record_stats;      // 是否记录统计
+    uint32_t request_ms;    // 投递时间(统计触发到首帧上屏的延迟, 0表示未知)
+};
+
+// 手势事件 → 系统任务
+struct GestureEventMsg {
+    static constexpr uint16_t kId = MSG_GESTURE_EVENT;
+    static constexpr uint8_t kPoolSize = 4;
+    static constexpr bool kCoalesce = false;
+
+    int16_t gesture;        // GestureType
+};
+
+// 显示刷新策略 → UI任务
+// 只有最新的策略有意义, 未处理时合并
+struct DisplayModeMsg {
+    static constexpr uint16_t kId = MSG_DISPLAY_MODE;
+    static constexpr uint8_t kPoolSize = 1;
+    static constexpr bool kCoalesce = true;
+
+    uint16_t frame_interval_ms;     // 小鸟动画帧间隔
+    uint16_t refresh_period_ms;     // LVGL刷新(SPI flush)周期
+};
+
+#endif // TASK_MESSAGES_H